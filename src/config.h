@@ -0,0 +1,297 @@
+/* src/config.h.  Generated from config.h.in by configure.  */
+/* src/config.h.in.  Generated from configure.ac by autoheader.  */
+
+/* Passed CFLAGS from environment */
+#define CONFIGURE_CFLAGS "-g -O2"
+
+/* Params passed to configure */
+#define CONFIGURE_PARAMS "linux gnu"
+
+/* Configure summary */
+#define CONFIGURE_SUMMARY "  Knot DNS 3.0.dev.1792342122.b38d9c0\n\n    Target:   linux-gnu x86_64\n    Compiler: gcc\n    CFLAGS:   -g -O2 -Wall -Wshadow -Werror=format-security -Werror=implicit -Wstrict-prototypes -fpredictive-commoning \n    LIBS:      \n    LibURCU:  -L/tmp/shim/lib -Wl,-rpath,/tmp/shim/lib -lurcu  -I/tmp/shim/include \n    GnuTLS:   -lgnutls  -I/usr/include/p11-kit-1 \n    Libedit:  -L/tmp/shim/lib -ledit  -I/tmp/shim/include \n    LMDB:     embedded  -I$(top_srcdir)/src/contrib/lmdb\n    Config:   500 MiB default mapsize\n\n    Prefix:      /usr/local\n    Run dir:     ${prefix}/var/run/knot\n    Storage dir: ${prefix}/var/lib/knot\n    Config dir:  ${prefix}/etc/knot\n    Module dir:  \n\n    Static modules: cookies dnsproxy geoip noudp onlinesign queryacl rrl stats synthrecord whoami \n    Shared modules: \n\n    Knot DNS libraries:     yes\n    Knot DNS daemon:        yes\n    Knot DNS utilities:     yes\n    Knot DNS documentation: no\n\n    Use recvmmsg:           yes\n    Use SO_REUSEPORT(_LB):  yes\n    Memory allocator:       auto\n    Fast zone parser:       no\n    Utilities with IDN:     libidn2\n    Utilities with Dnstap:  no\n    MaxMind DB support:     no\n    Journal compression:    yes\n    Systemd integration:    no\n    POSIX capabilities:     no\n    PKCS #11 support:       yes\n    Ed25519 support:        yes\n    Ed448 support:          yes\n    Code coverage:          no\n    Sanitizer:              no\n    LibFuzzer:              no\n    OSS-Fuzz:               no"
+
+/* Configuration DB mapsize. */
+#define CONF_MAPSIZE 500
+
+/* POSIX capabilities available */
+/* #undef ENABLE_CAP_NG */
+
+/* PKCS #11 support available */
+#define ENABLE_PKCS11 1
+
+/* Use recvmmsg(). */
+#define ENABLE_RECVMMSG 1
+
+/* Use SO_REUSEPORT(_LB). */
+#define ENABLE_REUSEPORT 1
+
+/* Use systemd integration. */
+/* #undef ENABLE_SYSTEMD */
+
+/* Define to 1 if you have the `accept4' function. */
+#define HAVE_ACCEPT4 1
+
+/* Define to 1 if you have the <arpa/nameser.h> header file. */
+#define HAVE_ARPA_NAMESER_H 1
+
+/* Define to 1 if you have '__atomic' functions. */
+#define HAVE_ATOMIC 1
+
+/* Define to 1 if you have the <bsd/string.h> header file. */
+/* #undef HAVE_BSD_STRING_H */
+
+/* Define to 1 if you have the `clock_gettime' function. */
+#define HAVE_CLOCK_GETTIME 1
+
+/* Define if FreeBSD-like cpuset_t exists. */
+/* #undef HAVE_CPUSET_BSD */
+
+/* Define if Linux-like cpu_set_t exists. */
+#define HAVE_CPUSET_LINUX 1
+
+/* Define if cpuset_t and cpuset(3) exists. */
+/* #undef HAVE_CPUSET_NETBSD */
+
+/* Define to 1 if you have the <dlfcn.h> header file. */
+#define HAVE_DLFCN_H 1
+
+/* GnuTLS ED25519 support available */
+#define HAVE_ED25519 1
+
+/* GnuTLS ED448 support available */
+#define HAVE_ED448 1
+
+/* explicit_bzero available */
+#define HAVE_EXPLICIT_BZERO 1
+
+/* explicit_memset available */
+/* #undef HAVE_EXPLICIT_MEMSET */
+
+/* Define to 1 if you have the `fgetln' function. */
+/* #undef HAVE_FGETLN */
+
+/* Define to 1 if you have the `getline' function. */
+#define HAVE_GETLINE 1
+
+/* GnuTLS kernel TLS support available */
+#define HAVE_GNUTLS_KTLS 1
+
+/* gnutls_memset available */
+#define HAVE_GNUTLS_MEMSET 1
+
+/* Define to 1 if you have the `initgroups' function. */
+#define HAVE_INITGROUPS 1
+
+/* Define to 1 if you have the <inttypes.h> header file. */
+#define HAVE_INTTYPES_H 1
+
+/* Define to 1 if you have the <lmdb.h> header file. */
+/* #undef HAVE_LMDB_H */
+
+/* Define to 1 if you have the `malloc_trim' function. */
+#define HAVE_MALLOC_TRIM 1
+
+/* Define to 1 to enable MaxMind DB. */
+/* #undef HAVE_MAXMINDDB */
+
+/* Define to 1 if you have the <minix/config.h> header file. */
+/* #undef HAVE_MINIX_CONFIG_H */
+
+/* Define to 1 if you have the <netdb.h> header file. */
+#define HAVE_NETDB_H 1
+
+/* Define to 1 if you have the <netinet/in.h> header file. */
+#define HAVE_NETINET_IN_H 1
+
+/* Define to 1 if you have the <pthread_np.h> header file. */
+/* #undef HAVE_PTHREAD_NP_H */
+
+/* Define to 1 if you have the pthread_setaffinity_np function. */
+#define HAVE_PTHREAD_SETAFFINITY_NP 1
+
+/* Define to 1 if you have the <resolv.h> header file. */
+#define HAVE_RESOLV_H 1
+
+/* Define to 1 if you have the `setgroups' function. */
+#define HAVE_SETGROUPS 1
+
+/* gnutls_privkey_sign_data2 available */
+#define HAVE_SIGN_DATA2 1
+
+/* Define to 1 if you have the <stdint.h> header file. */
+#define HAVE_STDINT_H 1
+
+/* Define to 1 if you have the <stdio.h> header file. */
+#define HAVE_STDIO_H 1
+
+/* Define to 1 if you have the <stdlib.h> header file. */
+#define HAVE_STDLIB_H 1
+
+/* Define to 1 if you have the <strings.h> header file. */
+#define HAVE_STRINGS_H 1
+
+/* Define to 1 if you have the <string.h> header file. */
+#define HAVE_STRING_H 1
+
+/* Define to 1 if you have the `strlcat' function. */
+/* #undef HAVE_STRLCAT */
+
+/* Define to 1 if you have the `strlcpy' function. */
+/* #undef HAVE_STRLCPY */
+
+/* Define to 1 if you have '__sync' functions. */
+#define HAVE_SYNC_ATOMIC 1
+
+/* Define to 1 if you have the `sysctlbyname' function. */
+/* #undef HAVE_SYSCTLBYNAME */
+
+/* Define to 1 if you have the <sys/stat.h> header file. */
+#define HAVE_SYS_STAT_H 1
+
+/* Define to 1 if you have the <sys/types.h> header file. */
+#define HAVE_SYS_TYPES_H 1
+
+/* Define to 1 if you have the <sys/uio.h> header file. */
+#define HAVE_SYS_UIO_H 1
+
+/* Define to 1 if you have the <unistd.h> header file. */
+#define HAVE_UNISTD_H 1
+
+/* Define to 1 or 0, depending whether the compiler supports simple visibility
+   declarations. */
+#define HAVE_VISIBILITY 1
+
+/* Define to 1 if you have the <wchar.h> header file. */
+#define HAVE_WCHAR_H 1
+
+/* Define to 1 to enable Zstandard. */
+#define HAVE_ZSTD 1
+
+/* Define to 1 to enable IDN support */
+#define LIBIDN 1
+
+/* Define to proper libidn header */
+#define LIBIDN_HEADER <idn2.h>
+
+/* Define to the sub-directory where libtool stores uninstalled libraries. */
+#define LT_OBJDIR ".libs/"
+
+/* Name of package */
+#define PACKAGE "knot"
+
+/* Define to the address where bug reports for this package should be sent. */
+#define PACKAGE_BUGREPORT "knot-dns@labs.nic.cz"
+
+/* Define to the full name of this package. */
+#define PACKAGE_NAME "knot"
+
+/* Define to the full name and version of this package. */
+#define PACKAGE_STRING "knot 3.0.dev.1792342122.b38d9c0"
+
+/* Define to the one symbol short name of this package. */
+#define PACKAGE_TARNAME "knot"
+
+/* Define to the home page for this package. */
+#define PACKAGE_URL ""
+
+/* Define to the version of this package. */
+#define PACKAGE_VERSION "3.0.dev.1792342122.b38d9c0"
+
+/* Define to 1 if all of the C90 standard headers exist (not just the ones
+   required in a freestanding environment). This macro is provided for
+   backward compatibility; new code need not use it. */
+#define STDC_HEADERS 1
+
+/* Define to 1 to enable dnstap support for kdig */
+/* #undef USE_DNSTAP */
+
+/* Enable extensions on AIX 3, Interix.  */
+#ifndef _ALL_SOURCE
+# define _ALL_SOURCE 1
+#endif
+/* Enable general extensions on macOS.  */
+#ifndef _DARWIN_C_SOURCE
+# define _DARWIN_C_SOURCE 1
+#endif
+/* Enable general extensions on Solaris.  */
+#ifndef __EXTENSIONS__
+# define __EXTENSIONS__ 1
+#endif
+/* Enable GNU extensions on systems that have them.  */
+#ifndef _GNU_SOURCE
+# define _GNU_SOURCE 1
+#endif
+/* Enable X/Open compliant socket functions that do not require linking
+   with -lxnet on HP-UX 11.11.  */
+#ifndef _HPUX_ALT_XOPEN_SOCKET_API
+# define _HPUX_ALT_XOPEN_SOCKET_API 1
+#endif
+/* Identify the host operating system as Minix.
+   This macro does not affect the system headers' behavior.
+   A future release of Autoconf may stop defining this macro.  */
+#ifndef _MINIX
+/* # undef _MINIX */
+#endif
+/* Enable general extensions on NetBSD.
+   Enable NetBSD compatibility extensions on Minix.  */
+#ifndef _NETBSD_SOURCE
+# define _NETBSD_SOURCE 1
+#endif
+/* Enable OpenBSD compatibility extensions on NetBSD.
+   Oddly enough, this does nothing on OpenBSD.  */
+#ifndef _OPENBSD_SOURCE
+# define _OPENBSD_SOURCE 1
+#endif
+/* Define to 1 if needed for POSIX-compatible behavior.  */
+#ifndef _POSIX_SOURCE
+/* # undef _POSIX_SOURCE */
+#endif
+/* Define to 2 if needed for POSIX-compatible behavior.  */
+#ifndef _POSIX_1_SOURCE
+/* # undef _POSIX_1_SOURCE */
+#endif
+/* Enable POSIX-compatible threading on Solaris.  */
+#ifndef _POSIX_PTHREAD_SEMANTICS
+# define _POSIX_PTHREAD_SEMANTICS 1
+#endif
+/* Enable extensions specified by ISO/IEC TS 18661-5:2014.  */
+#ifndef __STDC_WANT_IEC_60559_ATTRIBS_EXT__
+# define __STDC_WANT_IEC_60559_ATTRIBS_EXT__ 1
+#endif
+/* Enable extensions specified by ISO/IEC TS 18661-1:2014.  */
+#ifndef __STDC_WANT_IEC_60559_BFP_EXT__
+# define __STDC_WANT_IEC_60559_BFP_EXT__ 1
+#endif
+/* Enable extensions specified by ISO/IEC TS 18661-2:2015.  */
+#ifndef __STDC_WANT_IEC_60559_DFP_EXT__
+# define __STDC_WANT_IEC_60559_DFP_EXT__ 1
+#endif
+/* Enable extensions specified by ISO/IEC TS 18661-4:2015.  */
+#ifndef __STDC_WANT_IEC_60559_FUNCS_EXT__
+# define __STDC_WANT_IEC_60559_FUNCS_EXT__ 1
+#endif
+/* Enable extensions specified by ISO/IEC TS 18661-3:2015.  */
+#ifndef __STDC_WANT_IEC_60559_TYPES_EXT__
+# define __STDC_WANT_IEC_60559_TYPES_EXT__ 1
+#endif
+/* Enable extensions specified by ISO/IEC TR 24731-2:2010.  */
+#ifndef __STDC_WANT_LIB_EXT2__
+# define __STDC_WANT_LIB_EXT2__ 1
+#endif
+/* Enable extensions specified by ISO/IEC 24747:2009.  */
+#ifndef __STDC_WANT_MATH_SPEC_FUNCS__
+# define __STDC_WANT_MATH_SPEC_FUNCS__ 1
+#endif
+/* Enable extensions on HP NonStop.  */
+#ifndef _TANDEM_SOURCE
+# define _TANDEM_SOURCE 1
+#endif
+/* Enable X/Open extensions.  Define to 500 only if necessary
+   to make mbstate_t available.  */
+#ifndef _XOPEN_SOURCE
+/* # undef _XOPEN_SOURCE */
+#endif
+
+
+/* Version number of package */
+#define VERSION "3.0.dev.1792342122.b38d9c0"
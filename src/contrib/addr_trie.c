@@ -0,0 +1,323 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "contrib/addr_trie.h"
+#include "contrib/macros.h"
+#include "libknot/errcode.h"
+
+#define ADDR_MAXLEN 16
+
+/*!
+ * \brief Path-compressed binary trie node.
+ *
+ * The node represents the network given by the first 'len' bits of 'key'.
+ * Nodes without identifiers are just branching points.
+ */
+typedef struct node {
+	struct node *child[2];
+	uint8_t key[ADDR_MAXLEN];
+	uint8_t len;
+	uint32_t ids_count;
+	uint32_t *ids;
+} node_t;
+
+struct addr_trie {
+	node_t *ipv4;
+	node_t *ipv6;
+};
+
+static bool get_bit(const uint8_t *key, unsigned pos)
+{
+	return (key[pos / 8] >> (7 - pos % 8)) & 1;
+}
+
+/*! \brief Get the number of common leading bits, up to 'max'. */
+static unsigned common_bits(const uint8_t *a, const uint8_t *b, unsigned max)
+{
+	unsigned pos = 0;
+	while (pos < max && a[pos / 8] == b[pos / 8]) {
+		pos += 8;
+	}
+	if (pos >= max) {
+		return max;
+	}
+
+	uint8_t diff = a[pos / 8] ^ b[pos / 8];
+	while (!(diff & 0x80)) {
+		diff <<= 1;
+		pos++;
+	}
+
+	return MIN(pos, max);
+}
+
+static node_t *node_new(const uint8_t *key, unsigned len)
+{
+	node_t *node = calloc(1, sizeof(*node));
+	if (node == NULL) {
+		return NULL;
+	}
+
+	node->len = len;
+	memcpy(node->key, key, (len + 7) / 8);
+	if (len % 8 != 0) {
+		node->key[len / 8] &= 0xff << (8 - len % 8);
+	}
+
+	return node;
+}
+
+static void node_free(node_t *node)
+{
+	if (node == NULL) {
+		return;
+	}
+
+	node_free(node->child[0]);
+	node_free(node->child[1]);
+	free(node->ids);
+	free(node);
+}
+
+static int node_add_id(node_t *node, uint32_t id)
+{
+	// Identifiers are mostly inserted in ascending order.
+	if (node->ids_count > 0 && node->ids[node->ids_count - 1] == id) {
+		return KNOT_EOK;
+	}
+
+	uint32_t *ids = realloc(node->ids, (node->ids_count + 1) * sizeof(*ids));
+	if (ids == NULL) {
+		return KNOT_ENOMEM;
+	}
+	ids[node->ids_count++] = id;
+	node->ids = ids;
+
+	return KNOT_EOK;
+}
+
+static int trie_insert(node_t **root, const uint8_t *key, unsigned len, uint32_t id)
+{
+	node_t **pos = root;
+	for (;;) {
+		node_t *node = *pos;
+		if (node == NULL) {
+			node = node_new(key, len);
+			if (node == NULL) {
+				return KNOT_ENOMEM;
+			}
+			*pos = node;
+			return node_add_id(node, id);
+		}
+
+		unsigned common = common_bits(node->key, key, MIN(node->len, len));
+		if (common < node->len) {
+			// Split the node at the first differing bit.
+			node_t *split = node_new(key, common);
+			if (split == NULL) {
+				return KNOT_ENOMEM;
+			}
+			split->child[get_bit(node->key, common)] = node;
+			*pos = split;
+			if (common == len) {
+				return node_add_id(split, id);
+			}
+			pos = &split->child[get_bit(key, common)];
+			continue;
+		}
+
+		if (node->len == len) {
+			return node_add_id(node, id);
+		}
+		pos = &node->child[get_bit(key, node->len)];
+	}
+}
+
+static node_t **get_root(const addr_trie_t *trie, int family, unsigned *bits)
+{
+	switch (family) {
+	case AF_INET:
+		*bits = IPV4_PREFIXLEN;
+		return (node_t **)&trie->ipv4;
+	case AF_INET6:
+		*bits = IPV6_PREFIXLEN;
+		return (node_t **)&trie->ipv6;
+	default:
+		return NULL;
+	}
+}
+
+addr_trie_t *addr_trie_new(void)
+{
+	return calloc(1, sizeof(addr_trie_t));
+}
+
+void addr_trie_free(addr_trie_t *trie)
+{
+	if (trie == NULL) {
+		return;
+	}
+
+	node_free(trie->ipv4);
+	node_free(trie->ipv6);
+	free(trie);
+}
+
+int addr_trie_add_net(addr_trie_t *trie, const struct sockaddr_storage *addr,
+                      unsigned prefix, uint32_t id)
+{
+	if (trie == NULL || addr == NULL) {
+		return KNOT_EINVAL;
+	}
+
+	unsigned bits;
+	node_t **root = get_root(trie, addr->ss_family, &bits);
+	if (root == NULL) {
+		return KNOT_EINVAL;
+	}
+
+	size_t len;
+	const uint8_t *raw = sockaddr_raw(addr, &len);
+
+	return trie_insert(root, raw, MIN(prefix, bits), id);
+}
+
+/*! \brief Increment a big-endian number, return false on overflow. */
+static bool raw_inc(uint8_t *raw, size_t len)
+{
+	for (size_t i = len; i > 0; i--) {
+		if (++raw[i - 1] != 0) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/*! \brief Set the host part of the address (all bits after the prefix). */
+static void raw_set_host(uint8_t *raw, size_t len, unsigned prefix)
+{
+	for (unsigned pos = prefix; pos < len * 8; pos++) {
+		raw[pos / 8] |= 0x80 >> (pos % 8);
+	}
+}
+
+/*! \brief Check if the host part of the address is zero. */
+static bool raw_host_zero(const uint8_t *raw, size_t len, unsigned prefix)
+{
+	for (unsigned pos = prefix; pos < len * 8; pos++) {
+		if (get_bit(raw, pos)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+int addr_trie_add_range(addr_trie_t *trie, const struct sockaddr_storage *min,
+                        const struct sockaddr_storage *max, uint32_t id)
+{
+	if (trie == NULL || min == NULL || max == NULL ||
+	    min->ss_family != max->ss_family) {
+		return KNOT_EINVAL;
+	}
+
+	unsigned bits;
+	node_t **root = get_root(trie, min->ss_family, &bits);
+	if (root == NULL) {
+		return KNOT_EINVAL;
+	}
+
+	size_t len;
+	uint8_t cur[ADDR_MAXLEN], last[ADDR_MAXLEN];
+	const uint8_t *raw_min = sockaddr_raw(min, &len);
+	const uint8_t *raw_max = sockaddr_raw(max, &len);
+	memcpy(cur, raw_min, len);
+	memcpy(last, raw_max, len);
+
+	// Cover the range with the largest aligned networks.
+	while (memcmp(cur, last, len) <= 0) {
+		unsigned prefix = 0;
+		uint8_t end[ADDR_MAXLEN];
+		for (; prefix < bits; prefix++) {
+			memcpy(end, cur, len);
+			raw_set_host(end, len, prefix);
+			if (raw_host_zero(cur, len, prefix) && memcmp(end, last, len) <= 0) {
+				break;
+			}
+		}
+		if (prefix == bits) {
+			memcpy(end, cur, len);
+		}
+
+		int ret = trie_insert(root, cur, prefix, id);
+		if (ret != KNOT_EOK) {
+			return ret;
+		}
+
+		memcpy(cur, end, len);
+		if (!raw_inc(cur, len)) {
+			break;
+		}
+	}
+
+	return KNOT_EOK;
+}
+
+bool addr_trie_match(const addr_trie_t *trie, const struct sockaddr_storage *addr,
+                     addr_trie_cb cb, void *ctx)
+{
+	if (trie == NULL || addr == NULL || cb == NULL) {
+		return false;
+	}
+
+	unsigned bits;
+	node_t **root = get_root(trie, addr->ss_family, &bits);
+	if (root == NULL) {
+		return false;
+	}
+
+	size_t len;
+	const uint8_t *raw = sockaddr_raw(addr, &len);
+
+	const node_t *node = *root;
+	while (node != NULL && common_bits(node->key, raw, node->len) == node->len) {
+		for (uint32_t i = 0; i < node->ids_count; i++) {
+			if (cb(node->ids[i], ctx)) {
+				return true;
+			}
+		}
+		if (node->len == bits) {
+			break;
+		}
+		node = node->child[get_bit(raw, node->len)];
+	}
+
+	return false;
+}
+
+static bool stop_cb(uint32_t id, void *ctx)
+{
+	return true;
+}
+
+bool addr_trie_contains(const addr_trie_t *trie, const struct sockaddr_storage *addr)
+{
+	return addr_trie_match(trie, addr, stop_cb, NULL);
+}
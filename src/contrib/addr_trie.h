@@ -0,0 +1,101 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \brief Prefix trie of IPv4 and IPv6 networks.
+ *
+ * Each inserted network carries a numeric identifier. A lookup visits all
+ * networks covering the given address, from the shortest to the longest
+ * prefix, in time proportional to the address length.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "contrib/sockaddr.h"
+
+struct addr_trie;
+typedef struct addr_trie addr_trie_t;
+
+/*!
+ * \brief Callback for matching networks.
+ *
+ * \param id   Identifier of the matching network.
+ * \param ctx  Callback context.
+ *
+ * \return True to stop the lookup.
+ */
+typedef bool (*addr_trie_cb)(uint32_t id, void *ctx);
+
+/*!
+ * \brief Create an empty address trie.
+ *
+ * \return New trie or NULL if no memory.
+ */
+addr_trie_t *addr_trie_new(void);
+
+/*!
+ * \brief Free the address trie.
+ */
+void addr_trie_free(addr_trie_t *trie);
+
+/*!
+ * \brief Insert a network given by an address and a prefix length.
+ *
+ * \param trie    Address trie.
+ * \param addr    Network address (IPv4 or IPv6).
+ * \param prefix  Prefix length, longer values are truncated to the address length.
+ * \param id      Identifier of the network.
+ *
+ * \return KNOT_E*
+ */
+int addr_trie_add_net(addr_trie_t *trie, const struct sockaddr_storage *addr,
+                      unsigned prefix, uint32_t id);
+
+/*!
+ * \brief Insert an inclusive address range.
+ *
+ * The range is split into a minimal set of networks.
+ *
+ * \param trie  Address trie.
+ * \param min   First address of the range.
+ * \param max   Last address of the range (same family as min).
+ * \param id    Identifier of the range.
+ *
+ * \return KNOT_E*
+ */
+int addr_trie_add_range(addr_trie_t *trie, const struct sockaddr_storage *min,
+                        const struct sockaddr_storage *max, uint32_t id);
+
+/*!
+ * \brief Find the networks covering the address.
+ *
+ * \param trie  Address trie.
+ * \param addr  Address to look up.
+ * \param cb    Callback called for each matching network identifier.
+ * \param ctx   Callback context.
+ *
+ * \return True if the lookup was stopped by the callback.
+ */
+bool addr_trie_match(const addr_trie_t *trie, const struct sockaddr_storage *addr,
+                     addr_trie_cb cb, void *ctx);
+
+/*!
+ * \brief Check if the address is covered by any network.
+ */
+bool addr_trie_contains(const addr_trie_t *trie, const struct sockaddr_storage *addr);
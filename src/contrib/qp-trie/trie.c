@@ -451,6 +451,65 @@ trie_val_t* trie_get_try(trie_t *tbl, const trie_key_t *key, uint32_t len)
 	return tvalp(t);
 }
 
+/*! \brief Number of keys traversed in lockstep by trie_get_try_batch(). */
+#define BATCH_LANES 16
+
+void trie_get_try_batch(trie_t *tbl, const trie_key_t **keys, const uint32_t *lens,
+                        uint32_t count, trie_val_t **vals)
+{
+	assert(tbl && (keys || count == 0) && (lens || count == 0) && (vals || count == 0));
+	if (!tbl->weight) {
+		for (uint32_t k = 0; k < count; ++k)
+			vals[k] = NULL;
+		return;
+	}
+
+	for (uint32_t base = 0; base < count; base += BATCH_LANES) {
+		const uint n = MIN(count - base, BATCH_LANES);
+		node_t *t[BATCH_LANES];
+		uint active = 0; // bitmap of lanes still descending through branches
+		for (uint k = 0; k < n; ++k) {
+			t[k] = &tbl->root;
+			active |= 1U << k;
+		}
+
+		/* Advance each lane by one level per round. The next twig is only
+		 * prefetched here, it's read in the next round after the other
+		 * lanes, so the cache misses of all the lanes overlap. */
+		while (active) {
+			for (uint k = 0; k < n; ++k) {
+				if (!(active & (1U << k)))
+					continue;
+				node_t *cur = t[k];
+				if (!isbranch(cur)) {
+					__builtin_prefetch(tkey(cur));
+					active &= ~(1U << k);
+					continue;
+				}
+				bitmap_t b = twigbit(cur, keys[base + k], lens[base + k]);
+				if (!hastwig(cur, b)) {
+					t[k] = NULL;
+					active &= ~(1U << k);
+					continue;
+				}
+				t[k] = twig(cur, twigoff(cur, b));
+				__builtin_prefetch(t[k]);
+			}
+		}
+
+		for (uint k = 0; k < n; ++k) {
+			trie_val_t *val = NULL;
+			if (t[k] != NULL) {
+				tkey_t *lkey = tkey(t[k]);
+				if (key_cmp(keys[base + k], lens[base + k],
+				            lkey->chars, lkey->len) == 0)
+					val = tvalp(t[k]);
+			}
+			vals[base + k] = val;
+		}
+	}
+}
+
 /* Optimization: the approach isn't ideal, as e.g. walking through the prefix
  * is duplicated and we explicitly construct the wildcard key.  Still, it's close
  * to optimum which would be significantly more complicated and error-prone to write. */
@@ -77,6 +77,21 @@ size_t trie_weight(const trie_t *tbl);
 /*! \brief Search the trie, returning NULL on failure. */
 trie_val_t* trie_get_try(trie_t *tbl, const trie_key_t *key, uint32_t len);
 
+/*!
+ * \brief Search the trie for several keys at once, like trie_get_try().
+ *
+ * The keys are traversed in lockstep, one level per round, prefetching
+ * the next node of each key, so that the cache misses of the keys overlap.
+ *
+ * \param tbl    Trie.
+ * \param keys   Searched keys.
+ * \param lens   Key lengths.
+ * \param count  Number of keys.
+ * \param vals   Found values, NULL for keys not found.
+ */
+void trie_get_try_batch(trie_t *tbl, const trie_key_t **keys, const uint32_t *lens,
+                        uint32_t count, trie_val_t **vals);
+
 /*! \brief Search the trie including DNS wildcard semantics, returning NULL on failure.
  *
  * \note We assume the key is in knot_dname_lf() format, i.e. labels are ordered
@@ -23,40 +23,128 @@
 #include "libknot/libknot.h"
 #include "knot/server/dthreads.h"
 #include "knot/common/evsched.h"
+#include "contrib/time.h"
 
-/*! \brief Some implementations of timercmp >= are broken, this is for compat.*/
-static inline int timercmp_ge(struct timeval *a, struct timeval *b) {
-	return timercmp(a, b, >) || timercmp(a, b, ==);
+#define SLOT_MASK	(EVSCHED_WHEEL_SLOTS - 1)
+#define LEVEL_SHIFT(l)	((l) * EVSCHED_WHEEL_BITS)
+#define WHEEL_SPAN	(UINT64_C(1) << LEVEL_SHIFT(EVSCHED_WHEEL_LEVELS))
+#define NO_TICK		UINT64_MAX
+
+/*! \brief Current scheduler tick (milliseconds since the epoch). */
+static uint64_t current_tick(evsched_t *sched)
+{
+	struct timespec now = time_now();
+	double diff = time_diff_ms(&sched->epoch, &now);
+	return diff > 0 ? (uint64_t)diff : 0;
+}
+
+static void wheel_add(evsched_t *sched, event_t *ev)
+{
+	if (ev->expires < sched->next_tick) {
+		ev->expires = sched->next_tick;
+	}
+	uint64_t delta = ev->expires - sched->next_tick;
+	if (delta >= WHEEL_SPAN) {
+		ev->expires = sched->next_tick + WHEEL_SPAN - 1;
+		delta = WHEEL_SPAN - 1;
+	}
+
+	unsigned level = 0;
+	while (delta >> LEVEL_SHIFT(level + 1) != 0) {
+		level++;
+	}
+	unsigned slot = (ev->expires >> LEVEL_SHIFT(level)) & SLOT_MASK;
+
+	add_tail(&sched->wheel[level].slots[slot], &ev->node);
+	sched->wheel[level].used |= UINT64_C(1) << slot;
+	ev->level = level;
+	ev->slot = slot;
+}
+
+static void wheel_del(evsched_t *sched, event_t *ev)
+{
+	rem_node(&ev->node);
+	list_t *slot = &sched->wheel[ev->level].slots[ev->slot];
+	if (EMPTY_LIST(*slot)) {
+		sched->wheel[ev->level].used &= ~(UINT64_C(1) << ev->slot);
+	}
 }
 
-static int compare_event_heap_nodes(void *e1, void *e2)
+static bool is_scheduled(const event_t *ev)
 {
-	if (timercmp(&((event_t *)e1)->tv, &((event_t *)e2)->tv, <)) return -1;
-	if (timercmp(&((event_t *)e1)->tv, &((event_t *)e2)->tv, >)) return 1;
-	return 0;
+	return ev->node.prev != NULL;
 }
 
 /*!
- * \brief Get time T (now) + dt miliseconds.
+ * \brief Get the first tick, not before next_tick, when a wheel slot is due.
+ *
+ * Level 0 slots are due when their events expire, higher level slots are due
+ * when their events are to be moved (cascaded) to lower levels.
  */
-static struct timeval timeval_in(uint32_t dt)
+static uint64_t wheel_next_tick(evsched_t *sched)
 {
-	struct timeval tv = { 0 };
-	gettimeofday(&tv, NULL);
+	uint64_t res = NO_TICK;
+	for (unsigned level = 0; level < EVSCHED_WHEEL_LEVELS; level++) {
+		uint64_t used = sched->wheel[level].used;
+		if (used == 0) {
+			continue;
+		}
+		// First boundary of this level's resolution not processed yet.
+		unsigned shift = LEVEL_SHIFT(level);
+		uint64_t block = (sched->next_tick + (UINT64_C(1) << shift) - 1) >> shift;
+		unsigned rot = block & SLOT_MASK;
+		if (rot != 0) {
+			used = (used >> rot) | (used << (EVSCHED_WHEEL_SLOTS - rot));
+		}
+		uint64_t tick = (block + __builtin_ctzll(used)) << shift;
+		if (tick < res) {
+			res = tick;
+		}
+	}
+	return res;
+}
 
-	/* Add number of seconds. */
-	tv.tv_sec += dt / 1000;
+/*! \brief Move events from a higher level slot to lower levels. */
+static unsigned wheel_cascade(evsched_t *sched, unsigned level, uint64_t tick)
+{
+	unsigned idx = (tick >> LEVEL_SHIFT(level)) & SLOT_MASK;
+	list_t *slot = &sched->wheel[level].slots[idx];
+	while (!EMPTY_LIST(*slot)) {
+		event_t *ev = HEAD(*slot);
+		rem_node(&ev->node);
+		wheel_add(sched, ev);
+	}
+	sched->wheel[level].used &= ~(UINT64_C(1) << idx);
+	return idx;
+}
 
-	/* Add the number of microseconds. */
-	tv.tv_usec += (dt % 1000) * 1000;
+/*! \brief Process all ticks up to the target one, run expired events. */
+static void wheel_advance(evsched_t *sched, uint64_t target)
+{
+	while (sched->next_tick <= target && !sched->paused) {
+		uint64_t tick = wheel_next_tick(sched);
+		if (tick > target) {
+			// Only empty slots in between, skip them.
+			sched->next_tick = target + 1;
+			break;
+		}
+		sched->next_tick = tick;
 
-	/* Check for overflow. */
-	while (tv.tv_usec > 999999) {
-		tv.tv_sec += 1;
-		tv.tv_usec -= 1 * 1000 * 1000;
-	}
+		unsigned idx = tick & SLOT_MASK;
+		for (unsigned level = 1; idx == 0 && level < EVSCHED_WHEEL_LEVELS; level++) {
+			idx = wheel_cascade(sched, level, tick);
+		}
 
-	return tv;
+		// Dispatch the whole slot under one lock.
+		list_t *slot = &sched->wheel[0].slots[tick & SLOT_MASK];
+		sched->wheel[0].used &= ~(UINT64_C(1) << (tick & SLOT_MASK));
+		sched->next_tick = tick + 1;
+		while (!EMPTY_LIST(*slot)) {
+			event_t *ev = HEAD(*slot);
+			rem_node(&ev->node);
+			ev->cb(ev);
+		}
+	}
 }
 
 /*! \brief Event scheduler loop. */
@@ -68,33 +156,35 @@ static int evsched_run(dthread_t *thread)
 	}
 
 	/* Run event loop. */
-	pthread_mutex_lock(&sched->heap_lock);
+	pthread_mutex_lock(&sched->lock);
 	while (!dt_is_cancelled(thread)) {
-		if (!!EMPTY_HEAP(&sched->heap) || sched->paused) {
-			pthread_cond_wait(&sched->notify, &sched->heap_lock);
+		if (sched->paused) {
+			sched->wake_tick = NO_TICK;
+			pthread_cond_wait(&sched->notify, &sched->lock);
 			continue;
 		}
 
-		/* Get current time. */
-		struct timeval dt;
-		gettimeofday(&dt, 0);
-
-		/* Get next event. */
-		event_t *ev = *((event_t**)HHEAD(&sched->heap));
-		assert(ev != NULL);
-
-		if (timercmp_ge(&dt, &ev->tv)) {
-			heap_delmin(&sched->heap);
-			ev->cb(ev);
-		} else {
-			/* Wait for next event or interrupt. Unlock calendar. */
+		/* Run all expired events. */
+		uint64_t now = current_tick(sched);
+		wheel_advance(sched, now);
+
+		/* Wait for next event or interrupt. Unlock calendar. */
+		sched->wake_tick = wheel_next_tick(sched);
+		if (sched->wake_tick == NO_TICK) {
+			pthread_cond_wait(&sched->notify, &sched->lock);
+		} else if (sched->wake_tick > now) {
+			uint64_t wait = sched->wake_tick - now;
+			struct timeval tv;
+			gettimeofday(&tv, NULL);
 			struct timespec ts;
-			ts.tv_sec = ev->tv.tv_sec;
-			ts.tv_nsec = ev->tv.tv_usec * 1000L;
-			pthread_cond_timedwait(&sched->notify, &sched->heap_lock, &ts);
+			ts.tv_sec = tv.tv_sec + wait / 1000;
+			ts.tv_nsec = tv.tv_usec * 1000L + (wait % 1000) * 1000000L;
+			ts.tv_sec += ts.tv_nsec / 1000000000L;
+			ts.tv_nsec %= 1000000000L;
+			pthread_cond_timedwait(&sched->notify, &sched->lock, &ts);
 		}
 	}
-	pthread_mutex_unlock(&sched->heap_lock);
+	pthread_mutex_unlock(&sched->lock);
 
 	return KNOT_EOK;
 }
@@ -105,9 +195,15 @@ int evsched_init(evsched_t *sched, void *ctx)
 	sched->ctx = ctx;
 
 	/* Initialize event calendar. */
-	pthread_mutex_init(&sched->heap_lock, 0);
+	pthread_mutex_init(&sched->lock, 0);
 	pthread_cond_init(&sched->notify, 0);
-	heap_init(&sched->heap, compare_event_heap_nodes, 0);
+	for (unsigned level = 0; level < EVSCHED_WHEEL_LEVELS; level++) {
+		for (unsigned slot = 0; slot < EVSCHED_WHEEL_SLOTS; slot++) {
+			init_list(&sched->wheel[level].slots[slot]);
+		}
+	}
+	sched->epoch = time_now();
+	sched->wake_tick = NO_TICK;
 
 	sched->thread = dt_create(1, evsched_run, NULL, sched);
 
@@ -126,17 +222,20 @@ void evsched_deinit(evsched_t *sched)
 	}
 
 	/* Deinitialize event calendar. */
-	pthread_mutex_destroy(&sched->heap_lock);
+	pthread_mutex_destroy(&sched->lock);
 	pthread_cond_destroy(&sched->notify);
 
-	while (!EMPTY_HEAP(&sched->heap)) {
-		event_t *e = (event_t *)*HHEAD(&sched->heap);
-		heap_delmin(&sched->heap);
-		evsched_event_free(e);
+	for (unsigned level = 0; level < EVSCHED_WHEEL_LEVELS; level++) {
+		for (unsigned slot = 0; slot < EVSCHED_WHEEL_SLOTS; slot++) {
+			list_t *list = &sched->wheel[level].slots[slot];
+			while (list->head != NULL && !EMPTY_LIST(*list)) {
+				event_t *e = HEAD(*list);
+				rem_node(&e->node);
+				evsched_event_free(e);
+			}
+		}
 	}
 
-	heap_deinit(&sched->heap);
-
 	if (sched->thread != NULL) {
 		dt_delete(&sched->thread);
 	}
@@ -163,7 +262,6 @@ event_t *evsched_event_create(evsched_t *sched, event_cb_t cb, void *data)
 	e->sched = sched;
 	e->cb = cb;
 	e->data = data;
-	e->hpos.pos=0;
 
 	return e;
 }
@@ -183,26 +281,33 @@ int evsched_schedule(event_t *ev, uint32_t dt)
 		return KNOT_EINVAL;
 	}
 
-	struct timeval new_time = timeval_in(dt);
-
 	evsched_t *sched = ev->sched;
 
-	/* Lock calendar. */
-	pthread_mutex_lock(&sched->heap_lock);
+	uint64_t expires = current_tick(sched) + dt;
 
-	ev->tv = new_time;
+	/* Lock calendar. */
+	pthread_mutex_lock(&sched->lock);
 
 	/* Make sure it's not already enqueued. */
-	int found = heap_find(&sched->heap, (heap_val_t *)ev);
-	if (found > 0) {
-		heap_replace(&sched->heap, found, (heap_val_t *)ev);
-	} else {
-		heap_insert(&sched->heap, (heap_val_t *)ev);
+	if (is_scheduled(ev)) {
+		wheel_del(sched, ev);
+	}
+
+	/* Idle wheel can catch up with time without processing. */
+	if (expires > sched->next_tick && wheel_next_tick(sched) == NO_TICK) {
+		sched->next_tick = expires - dt;
+	}
+
+	ev->expires = expires;
+	wheel_add(sched, ev);
+
+	/* Wake up the scheduler only if it would sleep too long. */
+	if (ev->expires < sched->wake_tick) {
+		pthread_cond_signal(&sched->notify);
 	}
 
 	/* Unlock calendar. */
-	pthread_cond_signal(&sched->notify);
-	pthread_mutex_unlock(&sched->heap_lock);
+	pthread_mutex_unlock(&sched->lock);
 
 	return KNOT_EOK;
 }
@@ -216,19 +321,17 @@ int evsched_cancel(event_t *ev)
 	evsched_t *sched = ev->sched;
 
 	/* Lock calendar. */
-	pthread_mutex_lock(&sched->heap_lock);
+	pthread_mutex_lock(&sched->lock);
 
-	int found = heap_find(&sched->heap, (heap_val_t *)ev);
-	if (found > 0) {
-		heap_delete(&sched->heap, found);
+	if (is_scheduled(ev)) {
+		wheel_del(sched, ev);
 	}
 
 	/* Unlock calendar. */
-	pthread_cond_signal(&sched->notify);
-	pthread_mutex_unlock(&sched->heap_lock);
+	pthread_mutex_unlock(&sched->lock);
 
 	/* Reset event timer. */
-	memset(&ev->tv, 0, sizeof(struct timeval));
+	ev->expires = 0;
 
 	return KNOT_EOK;
 }
@@ -240,10 +343,10 @@ void evsched_start(evsched_t *sched)
 
 void evsched_stop(evsched_t *sched)
 {
-	pthread_mutex_lock(&sched->heap_lock);
+	pthread_mutex_lock(&sched->lock);
 	dt_stop(sched->thread);
 	pthread_cond_signal(&sched->notify);
-	pthread_mutex_unlock(&sched->heap_lock);
+	pthread_mutex_unlock(&sched->lock);
 }
 
 void evsched_join(evsched_t *sched)
@@ -253,15 +356,15 @@ void evsched_join(evsched_t *sched)
 
 void evsched_pause(evsched_t *sched)
 {
-	pthread_mutex_lock(&sched->heap_lock);
+	pthread_mutex_lock(&sched->lock);
 	sched->paused = true;
-	pthread_mutex_unlock(&sched->heap_lock);
+	pthread_mutex_unlock(&sched->lock);
 }
 
 void evsched_resume(evsched_t *sched)
 {
-	pthread_mutex_lock(&sched->heap_lock);
+	pthread_mutex_lock(&sched->lock);
 	sched->paused = false;
 	pthread_cond_signal(&sched->notify);
-	pthread_mutex_unlock(&sched->heap_lock);
+	pthread_mutex_unlock(&sched->lock);
 }
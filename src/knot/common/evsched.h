@@ -24,9 +24,14 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <sys/time.h>
+#include <time.h>
 
 #include "knot/server/dthreads.h"
-#include "contrib/ucw/heap.h"
+#include "contrib/ucw/lists.h"
+
+#define EVSCHED_WHEEL_BITS   6  /*!< Slots per wheel level (log2). */
+#define EVSCHED_WHEEL_SLOTS  (1 << EVSCHED_WHEEL_BITS)
+#define EVSCHED_WHEEL_LEVELS 6  /*!< Covers 2^36 ms, i.e. over two years. */
 
 /* Forward decls. */
 struct evsched;
@@ -51,8 +56,10 @@ typedef void (*event_cb_t)(struct event *);
  * \brief Event structure.
  */
 typedef struct event {
-	struct heap_val hpos;
-	struct timeval tv; /*!< Event scheduled time. */
+	node_t node;       /*!< Position in a timing wheel slot. */
+	uint64_t expires;  /*!< Event scheduled time (scheduler tick). */
+	uint8_t level;     /*!< Timing wheel level of the slot. */
+	uint8_t slot;      /*!< Timing wheel slot index. */
 	void *data;        /*!< Usable data ptr. */
 	event_cb_t cb;     /*!< Event callback. */
 	struct evsched *sched; /*!< Scheduler for this event. */
@@ -60,12 +67,23 @@ typedef struct event {
 
 /*!
  * \brief Event scheduler structure.
+ *
+ * Events are kept in a hierarchical timing wheel with millisecond ticks.
+ * Each level has a slot per tick of its resolution, level N+1 resolution is
+ * the span of the whole level N. Events are moved to lower levels as their
+ * time approaches, so that scheduling and cancelling an event is O(1).
  */
 typedef struct evsched {
 	volatile bool paused;      /*!< Temporarily stop processing events. */
-	pthread_mutex_t heap_lock; /*!< Event heap locking. */
-	pthread_cond_t notify;     /*!< Event heap notification. */
-	struct heap heap;          /*!< Event heap. */
+	pthread_mutex_t lock;      /*!< Timing wheel locking. */
+	pthread_cond_t notify;     /*!< Timing wheel notification. */
+	struct {
+		list_t slots[EVSCHED_WHEEL_SLOTS];
+		uint64_t used;     /*!< Bitmap of non-empty slots. */
+	} wheel[EVSCHED_WHEEL_LEVELS];
+	uint64_t next_tick;        /*!< First tick not processed yet. */
+	uint64_t wake_tick;        /*!< Tick the scheduler thread sleeps until. */
+	struct timespec epoch;     /*!< Time of tick zero. */
 	void *ctx;                 /*!< Scheduler context. */
 	dt_unit_t *thread;
 } evsched_t;
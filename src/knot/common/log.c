@@ -14,6 +14,7 @@
     along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <pthread.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <string.h>
@@ -31,12 +32,28 @@
 
 #include "knot/common/log.h"
 #include "libknot/libknot.h"
+#include "contrib/openbsd/strlcpy.h"
 #include "contrib/ucw/lists.h"
 
 /*! Single log message buffer length (one line). */
 #define LOG_BUFLEN	512
 #define NULL_ZONE_STR	"?"
 
+/*! Asynchronous logging: records per thread ring (power of two). */
+#define LOG_RING_SIZE	256
+/*! Asynchronous logging: journal parameter maximum length. */
+#define LOG_PARAMLEN	64
+/*! Asynchronous logging: output buffer size per target. */
+#define LOG_BATCHLEN	(16 * 1024)
+/*! Asynchronous logging: idle wait of the logger thread (ms). */
+#define LOG_IDLE_MS	50
+
+#ifdef HAVE_ATOMIC
+#define ATOMIC_LOAD(src)        __atomic_load_n(&(src), __ATOMIC_ACQUIRE)
+#define ATOMIC_STORE(dst, val)  __atomic_store_n(&(dst), (val), __ATOMIC_RELEASE)
+#define ATOMIC_INC(dst)         __atomic_fetch_add(&(dst), 1, __ATOMIC_RELAXED)
+#endif
+
 #ifdef ENABLE_SYSTEMD
 int use_journal = 0;
 #endif
@@ -178,6 +195,8 @@ void log_init(void)
 
 void log_close(void)
 {
+	log_async_stop();
+
 	sink_publish(NULL);
 
 	fflush(stdout);
@@ -207,8 +226,26 @@ void log_levels_add(log_target_t target, log_source_t src, int levels)
 	}
 }
 
+/*! Output buffer of a stream target, filled by the logger thread. */
+typedef struct {
+	size_t len;
+	char data[LOG_BATCHLEN];
+} log_batch_t;
+
+static void batch_flush(log_batch_t *batch, FILE *stream)
+{
+	if (batch->len > 0) {
+		fwrite(batch->data, 1, batch->len, stream);
+		if (stream == stdout) {
+			fflush(stream);
+		}
+		batch->len = 0;
+	}
+}
+
 static void emit_log_msg(int level, log_source_t src, const char *zone,
-                         size_t zone_len, const char *msg, const char *param)
+                         size_t zone_len, const char *msg, const char *param,
+                         const struct timeval *tv, log_batch_t *batches)
 {
 	log_t *log = s_log;
 
@@ -232,9 +269,7 @@ static void emit_log_msg(int level, log_source_t src, const char *zone,
 	char tstr[LOG_BUFLEN] = { 0 };
 	if (!(s_log->flags & LOG_FLAG_NOTIMESTAMP)) {
 		struct tm lt;
-		struct timeval tv;
-		gettimeofday(&tv, NULL);
-		time_t sec = tv.tv_sec;
+		time_t sec = tv->tv_sec;
 		if (localtime_r(&sec, &lt) != NULL) {
 			strftime(tstr, sizeof(tstr), KNOT_LOG_TIME_FORMAT " ", &lt);
 		}
@@ -250,7 +285,21 @@ static void emit_log_msg(int level, log_source_t src, const char *zone,
 			default: stream = log->file[i - LOG_TARGET_FILE]; break;
 			}
 
-			// Print the message.
+			// Print the message or append it to the target batch.
+			if (batches != NULL) {
+				log_batch_t *batch = &batches[i - LOG_TARGET_STDERR];
+				size_t len = strlen(tstr) + strlen(msg) + 1;
+				if (batch->len + len > sizeof(batch->data)) {
+					batch_flush(batch, stream);
+				}
+				if (len <= sizeof(batch->data)) {
+					int ret = snprintf(batch->data + batch->len,
+					                   sizeof(batch->data) - batch->len,
+					                   "%s%s\n", tstr, msg);
+					batch->len += (ret > 0) ? ret : 0;
+				}
+				continue;
+			}
 			fprintf(stream, "%s%s\n", tstr, msg);
 			if (stream == stdout) {
 				fflush(stream);
@@ -289,50 +338,458 @@ static int log_msg_add(char **write, size_t *capacity, const char *fmt, ...)
 	return KNOT_EOK;
 }
 
-static void log_msg_text(int level, log_source_t src, const char *zone,
-                         const char *fmt, va_list args, const char *param)
+/*!
+ * \brief Format the log message with level and zone prefixes.
+ *
+ * \param zone_len  Output: zone name length without the trailing dot.
+ * \param zone_off  Output: offset of the zone name in the output buffer.
+ *
+ * \return KNOT_E*
+ */
+static int log_msg_format(char *buff, size_t size, int level, const char *zone,
+                          size_t *zone_len, size_t *zone_off,
+                          const char *fmt, va_list args)
 {
-	if (!log_isopen() || src == LOG_SOURCE_ANY) {
-		return;
-	}
-
-	// Buffer for log message.
-	char buff[LOG_BUFLEN];
 	char *write = buff;
-	size_t capacity = sizeof(buff);
-
-	rcu_read_lock();
+	size_t capacity = size;
 
 	// Prefix error level.
 	if (level != LOG_INFO || !(s_log->flags & LOG_FLAG_NOINFO)) {
 		const char *prefix = level_prefix(level);
 		int ret = log_msg_add(&write, &capacity, "%s: ", prefix);
 		if (ret != KNOT_EOK) {
-			rcu_read_unlock();
-			return;
+			return ret;
 		}
 	}
 
 	// Prefix zone name.
-	size_t zone_len = 0;
+	*zone_len = 0;
+	*zone_off = 0;
 	if (zone != NULL) {
-		zone_len = strlen(zone);
-		if (zone_len > 0 && zone[zone_len - 1] == '.') {
-			zone_len--;
+		*zone_len = strlen(zone);
+		if (*zone_len > 0 && zone[*zone_len - 1] == '.') {
+			(*zone_len)--;
 		}
 
-		int ret = log_msg_add(&write, &capacity, "[%.*s.] ", (int)zone_len, zone);
+		*zone_off = write - buff + 1;
+		int ret = log_msg_add(&write, &capacity, "[%.*s.] ", (int)*zone_len, zone);
 		if (ret != KNOT_EOK) {
-			rcu_read_unlock();
-			return;
+			return ret;
 		}
 	}
 
 	// Compile log message.
 	int ret = vsnprintf(write, capacity, fmt, args);
-	if (ret >= 0) {
+	return (ret >= 0) ? KNOT_EOK : KNOT_ERROR;
+}
+
+#ifdef HAVE_ATOMIC
+
+/*! Preformatted log record. */
+typedef struct {
+	uint64_t seq;          /*!< Global sequence number for ordering. */
+	struct timeval tv;     /*!< Time of logging. */
+	int level;
+	log_source_t src;
+	bool has_zone;
+	uint16_t zone_off;     /*!< Offset of the zone name in the message. */
+	uint16_t zone_len;
+	bool has_param;
+	char param[LOG_PARAMLEN];
+	char msg[LOG_BUFLEN];
+} log_record_t;
+
+/*!
+ * Single-producer single-consumer ring of log records.
+ *
+ * The producer is the logging thread, the consumer is the logger thread.
+ */
+typedef struct log_ring {
+	struct log_ring *next;
+	size_t head;           /*!< Next record to write (producer). */
+	size_t tail;           /*!< Next record to read (consumer). */
+	size_t dropped;        /*!< Records dropped due to a full ring. */
+	size_t reported;       /*!< Dropped records already reported (consumer). */
+	bool orphaned;         /*!< The producer thread has exited. */
+	log_record_t records[LOG_RING_SIZE];
+} log_ring_t;
+
+/*! Asynchronous logging context. */
+typedef struct {
+	pthread_t thread;
+	pthread_key_t ring_key;
+	pthread_mutex_t lock;  /*!< Protects the ring list and the wake condition. */
+	pthread_cond_t wake;
+	log_ring_t *rings;
+	uint64_t seq;
+	bool sleeping;
+	bool stop;
+} log_async_t;
+
+/*! Asynchronous logging singleton. */
+static log_async_t *s_async = NULL;
+
+static void ring_orphan(void *ptr)
+{
+	log_ring_t *ring = ptr;
+	ATOMIC_STORE(ring->orphaned, true);
+}
+
+static log_ring_t *ring_get(log_async_t *async)
+{
+	log_ring_t *ring = pthread_getspecific(async->ring_key);
+	if (ring != NULL) {
+		return ring;
+	}
+
+	// First message from this thread, the registration may block once.
+	ring = calloc(1, sizeof(*ring));
+	if (ring == NULL) {
+		return NULL;
+	}
+
+	pthread_mutex_lock(&async->lock);
+	ring->next = async->rings;
+	ATOMIC_STORE(async->rings, ring);
+	pthread_mutex_unlock(&async->lock);
+
+	pthread_setspecific(async->ring_key, ring);
+
+	return ring;
+}
+
+/*!
+ * \brief Format the message directly into the calling thread ring.
+ *
+ * \retval true if the message was handled (queued or dropped).
+ */
+static bool log_async_push(log_async_t *async, int level, log_source_t src,
+                           const char *zone, const char *fmt, va_list args,
+                           const char *param)
+{
+	log_ring_t *ring = ring_get(async);
+	if (ring == NULL) {
+		return false;
+	}
+
+	size_t head = ring->head;
+	if (head - ATOMIC_LOAD(ring->tail) >= LOG_RING_SIZE) {
+		// Never block, count the loss instead.
+		ATOMIC_INC(ring->dropped);
+		return true;
+	}
+
+	log_record_t *rec = &ring->records[head % LOG_RING_SIZE];
+	size_t zone_len, zone_off;
+	if (log_msg_format(rec->msg, sizeof(rec->msg), level, zone, &zone_len,
+	                   &zone_off, fmt, args) != KNOT_EOK) {
+		return true;
+	}
+
+	gettimeofday(&rec->tv, NULL);
+	rec->seq = ATOMIC_INC(async->seq);
+	rec->level = level;
+	rec->src = src;
+	rec->has_zone = (zone != NULL);
+	rec->zone_off = zone_off;
+	rec->zone_len = zone_len;
+	rec->has_param = (param != NULL);
+	if (param != NULL) {
+		strlcpy(rec->param, param, sizeof(rec->param));
+	}
+
+	ATOMIC_STORE(ring->head, head + 1);
+
+	if (ATOMIC_LOAD(async->sleeping)) {
+		pthread_cond_signal(&async->wake);
+	}
+
+	return true;
+}
+
+static FILE *target_stream(log_t *log, int target)
+{
+	switch (target) {
+	case LOG_TARGET_STDERR: return stderr;
+	case LOG_TARGET_STDOUT: return stdout;
+	default:                return log->file[target - LOG_TARGET_FILE];
+	}
+}
+
+/*!
+ * \brief Emit all pending records, ordered by their sequence numbers.
+ *
+ * \return Number of emitted records.
+ */
+static size_t log_async_drain(log_async_t *async)
+{
+	size_t emitted = 0;
+
+	rcu_read_lock();
+
+	log_t *log = s_log;
+	if (log == NULL) {
+		rcu_read_unlock();
+		return 0;
+	}
+
+	size_t batch_count = LOG_TARGET_FILE + log->file_count - LOG_TARGET_STDERR;
+	log_batch_t *batches = malloc(batch_count * sizeof(*batches));
+	if (batches != NULL) {
+		for (size_t i = 0; i < batch_count; i++) {
+			batches[i].len = 0;
+		}
+	}
+
+	log_ring_t *rings = ATOMIC_LOAD(async->rings);
+	for (;;) {
+		// Pick the oldest pending record among all rings.
+		log_ring_t *next = NULL;
+		for (log_ring_t *ring = rings; ring != NULL; ring = ring->next) {
+			if (ring->tail == ATOMIC_LOAD(ring->head)) {
+				continue;
+			}
+			if (next == NULL || ring->records[ring->tail % LOG_RING_SIZE].seq <
+			                    next->records[next->tail % LOG_RING_SIZE].seq) {
+				next = ring;
+			}
+		}
+		if (next == NULL) {
+			break;
+		}
+
+		log_record_t *rec = &next->records[next->tail % LOG_RING_SIZE];
+		char journal_param[LOG_PARAMLEN];
+		if (rec->has_param) {
+			memcpy(journal_param, rec->param, sizeof(journal_param));
+		}
+		emit_log_msg(rec->level, rec->src,
+		             rec->has_zone ? rec->msg + rec->zone_off : NULL,
+		             rec->zone_len, rec->msg,
+		             rec->has_param ? journal_param : NULL, &rec->tv, batches);
+		ATOMIC_STORE(next->tail, next->tail + 1);
+		emitted++;
+	}
+
+	// Report the dropped records.
+	for (log_ring_t *ring = rings; ring != NULL; ring = ring->next) {
+		size_t dropped = ATOMIC_LOAD(ring->dropped);
+		if (dropped != ring->reported) {
+			char msg[LOG_BUFLEN];
+			(void)snprintf(msg, sizeof(msg), "%s: logging, dropped %zu messages",
+			               level_prefix(LOG_WARNING), dropped - ring->reported);
+			struct timeval tv;
+			gettimeofday(&tv, NULL);
+			emit_log_msg(LOG_WARNING, LOG_SOURCE_SERVER, NULL, 0, msg, NULL,
+			             &tv, batches);
+			ring->reported = dropped;
+		}
+	}
+
+	if (batches != NULL) {
+		for (size_t i = 0; i < batch_count; i++) {
+			batch_flush(&batches[i], target_stream(log, i + LOG_TARGET_STDERR));
+		}
+		free(batches);
+	}
+
+	rcu_read_unlock();
+
+	return emitted;
+}
+
+/*! \brief Free the rings of exited threads if already drained. */
+static void log_async_purge(log_async_t *async)
+{
+	pthread_mutex_lock(&async->lock);
+	log_ring_t **pos = &async->rings;
+	while (*pos != NULL) {
+		log_ring_t *ring = *pos;
+		if (ATOMIC_LOAD(ring->orphaned) && ring->tail == ring->head &&
+		    ring->reported == ring->dropped) {
+			*pos = ring->next;
+			free(ring);
+		} else {
+			pos = &ring->next;
+		}
+	}
+	pthread_mutex_unlock(&async->lock);
+}
+
+static bool log_async_pending(log_async_t *async)
+{
+	for (log_ring_t *ring = ATOMIC_LOAD(async->rings); ring != NULL;
+	     ring = ring->next) {
+		if (ring->tail != ATOMIC_LOAD(ring->head) ||
+		    ring->reported != ATOMIC_LOAD(ring->dropped)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void *log_async_main(void *arg)
+{
+	log_async_t *async = arg;
+
+	rcu_register_thread();
+
+	for (;;) {
+		bool stop = ATOMIC_LOAD(async->stop);
+		if (log_async_drain(async) > 0) {
+			continue;
+		}
+		if (stop) {
+			break;
+		}
+
+		log_async_purge(async);
+
+		pthread_mutex_lock(&async->lock);
+		__atomic_store_n(&async->sleeping, true, __ATOMIC_SEQ_CST);
+		if (!log_async_pending(async) && !ATOMIC_LOAD(async->stop)) {
+			// Producers signal without the lock, so a wake-up can be missed.
+			struct timeval now;
+			gettimeofday(&now, NULL);
+			long nsec = now.tv_usec * 1000L + LOG_IDLE_MS * 1000000L;
+			struct timespec ts = {
+				.tv_sec = now.tv_sec + nsec / 1000000000L,
+				.tv_nsec = nsec % 1000000000L
+			};
+			pthread_cond_timedwait(&async->wake, &async->lock, &ts);
+		}
+		ATOMIC_STORE(async->sleeping, false);
+		pthread_mutex_unlock(&async->lock);
+	}
+
+	rcu_unregister_thread();
+
+	return NULL;
+}
+
+int log_async_start(void)
+{
+	if (s_async != NULL) {
+		return KNOT_EOK;
+	}
+
+	log_async_t *async = calloc(1, sizeof(*async));
+	if (async == NULL) {
+		return KNOT_ENOMEM;
+	}
+
+	int ret = pthread_cond_init(&async->wake, NULL);
+	if (ret != 0) {
+		free(async);
+		return knot_map_errno_code(ret);
+	}
+	pthread_mutex_init(&async->lock, NULL);
+
+	ret = pthread_key_create(&async->ring_key, ring_orphan);
+	if (ret == 0) {
+		ret = pthread_create(&async->thread, NULL, log_async_main, async);
+		if (ret != 0) {
+			pthread_key_delete(async->ring_key);
+		}
+	}
+	if (ret != 0) {
+		pthread_cond_destroy(&async->wake);
+		pthread_mutex_destroy(&async->lock);
+		free(async);
+		return knot_map_errno_code(ret);
+	}
+
+	rcu_assign_pointer(s_async, async);
+
+	return KNOT_EOK;
+}
+
+void log_async_stop(void)
+{
+	log_async_t **current = &s_async;
+	log_async_t *async = rcu_xchg_pointer(current, NULL);
+	if (async == NULL) {
+		return;
+	}
+
+	// Wait for the producers still writing into the rings.
+	synchronize_rcu();
+
+	ATOMIC_STORE(async->stop, true);
+	pthread_cond_signal(&async->wake);
+	pthread_join(async->thread, NULL);
+
+	pthread_key_delete(async->ring_key);
+	while (async->rings != NULL) {
+		log_ring_t *ring = async->rings;
+		async->rings = ring->next;
+		free(ring);
+	}
+	pthread_cond_destroy(&async->wake);
+	pthread_mutex_destroy(&async->lock);
+	free(async);
+}
+
+#else
+
+int log_async_start(void)
+{
+	return KNOT_ENOTSUP;
+}
+
+void log_async_stop(void)
+{
+}
+
+#endif // HAVE_ATOMIC
+
+/*! \brief Check if any target accepts the level from the source. */
+static bool level_enabled(log_t *log, int level, log_source_t src)
+{
+	for (int i = LOG_TARGET_SYSLOG; i < LOG_TARGET_FILE + log->file_count; ++i) {
+		if (*src_levels(log, i, src) & LOG_MASK(level)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void log_msg_text(int level, log_source_t src, const char *zone,
+                         const char *fmt, va_list args, const char *param)
+{
+	if (!log_isopen() || src == LOG_SOURCE_ANY) {
+		return;
+	}
+
+	rcu_read_lock();
+
+	// Drop filtered out messages before formatting or queueing them.
+	if (!level_enabled(s_log, level, src)) {
+		rcu_read_unlock();
+		return;
+	}
+
+#ifdef HAVE_ATOMIC
+	// Pass to the logger thread if enabled.
+	log_async_t *async = rcu_dereference(s_async);
+	if (async != NULL && log_async_push(async, level, src, zone, fmt, args, param)) {
+		rcu_read_unlock();
+		return;
+	}
+#endif
+
+	// Buffer for log message.
+	char buff[LOG_BUFLEN];
+	size_t zone_len, zone_off;
+	int ret = log_msg_format(buff, sizeof(buff), level, zone, &zone_len,
+	                         &zone_off, fmt, args);
+	if (ret == KNOT_EOK) {
 		// Send to logging targets.
-		emit_log_msg(level, src, zone, zone_len, buff, param);
+		struct timeval tv;
+		gettimeofday(&tv, NULL);
+		emit_log_msg(level, src, zone, zone_len, buff, param, &tv, NULL);
 	}
 
 	rcu_read_unlock();
@@ -424,7 +881,8 @@ void log_reconfigure(conf_t *conf)
 {
 	// Use defaults if no 'log' section is configured.
 	if (conf_id_count(conf, C_LOG) == 0) {
-		log_close();
+		sink_publish(NULL);
+		closelog();
 		log_init();
 		return;
 	}
@@ -65,9 +65,29 @@ void log_init(void);
 
 /*!
  * \brief Close and deinitialize log.
+ *
+ * Stops asynchronous logging if enabled, pending messages are written.
  */
 void log_close(void);
 
+/*!
+ * \brief Switch to asynchronous logging.
+ *
+ * Messages are formatted into a per-thread ring and written by a dedicated
+ * logger thread in batches. A logging thread never waits for the output;
+ * if its ring is full, the message is dropped and the number of dropped
+ * messages is logged later.
+ *
+ * \retval KNOT_EOK if started or already running.
+ * \retval KNOT_ENOTSUP if not supported on the platform.
+ */
+int log_async_start(void);
+
+/*!
+ * \brief Write pending messages and switch back to synchronous logging.
+ */
+void log_async_stop(void);
+
 /*!
  * \brief Set logging format flag.
  */
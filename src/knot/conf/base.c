@@ -23,6 +23,7 @@
 #include "knot/conf/tools.h"
 #include "knot/common/log.h"
 #include "knot/nameserver/query_module.h"
+#include "knot/updates/acl.h"
 #include "libknot/libknot.h"
 #include "libknot/yparser/ypformat.h"
 #include "libknot/yparser/yptrafo.h"
@@ -232,6 +233,13 @@ int conf_new(
 	}
 	init_list(out->query_modules);
 
+	// Initialize compiled ACL cache.
+	out->acl_cache = acl_cache_new();
+	if (out->acl_cache == NULL) {
+		ret = KNOT_ENOMEM;
+		goto new_error;
+	}
+
 	// Set the DB api.
 	out->api = knot_db_lmdb_api();
 	struct knot_db_lmdb_opts lmdb_opts = KNOT_DB_LMDB_OPTS_INITIALIZER;
@@ -356,9 +364,19 @@ int conf_clone(
 	}
 	init_list(out->query_modules);
 
+	// Initialize compiled ACL cache.
+	out->acl_cache = acl_cache_new();
+	if (out->acl_cache == NULL) {
+		free(out->query_modules);
+		yp_schema_free(out->schema);
+		free(out);
+		return KNOT_ENOMEM;
+	}
+
 	// Open common read-only transaction.
 	ret = conf_refresh_txn(out);
 	if (ret != KNOT_EOK) {
+		acl_cache_free(out->acl_cache);
 		free(out->query_modules);
 		yp_schema_free(out->schema);
 		free(out);
@@ -454,6 +472,7 @@ void conf_free(
 	conf_deactivate_modules(conf->query_modules, &conf->query_plan);
 	free(conf->query_modules);
 	conf_mod_unload_shared(conf);
+	acl_cache_free(conf->acl_cache);
 
 	if (!conf->is_clone) {
 		if (conf->api != NULL) {
@@ -751,6 +770,15 @@ int conf_import(
 	// Update cached values.
 	init_cache(conf, reinit_cache);
 
+	// Drop ACL lists compiled from the previous contents.
+	acl_cache_t *acl_cache = acl_cache_new();
+	if (acl_cache == NULL) {
+		ret = KNOT_ENOMEM;
+		goto import_error;
+	}
+	acl_cache_free(conf->acl_cache);
+	conf->acl_cache = acl_cache;
+
 	// Reset the filename.
 	free(conf->filename);
 	conf->filename = NULL;
@@ -130,6 +130,8 @@ typedef struct {
 	list_t *query_modules;
 	/*! Default query modules plan. */
 	struct query_plan *query_plan;
+	/*! Compiled ACL lists. */
+	struct acl_cache *acl_cache;
 } conf_t;
 
 /*!
@@ -134,9 +134,25 @@ static const knot_lookup_t log_severities[] = {
 	{ 0, NULL }
 };
 
+static const knot_lookup_t journal_compressions[] = {
+	{ JOURNAL_COMPRESSION_NONE, "none" },
+#ifdef HAVE_ZSTD
+	{ JOURNAL_COMPRESSION_ZSTD, "zstd" },
+#endif
+	{ 0, NULL }
+};
+
 static const knot_lookup_t journal_modes[] = {
 	{ JOURNAL_MODE_ROBUST, "robust" },
 	{ JOURNAL_MODE_ASYNC,  "asynchronous" },
+	{ JOURNAL_MODE_GROUP,  "group-commit" },
+	{ 0, NULL }
+};
+
+static const knot_lookup_t cpu_placements[] = {
+	{ CPU_PLACEMENT_NONE,     "none" },
+	{ CPU_PLACEMENT_SIMPLE,   "simple" },
+	{ CPU_PLACEMENT_TOPOLOGY, "topology" },
 	{ 0, NULL }
 };
 
@@ -157,12 +173,18 @@ static const yp_item_t desc_server[] = {
 	{ C_UDP_WORKERS,          YP_TINT,  YP_VINT = { 1, 255, YP_NIL } },
 	{ C_TCP_WORKERS,          YP_TINT,  YP_VINT = { 1, 255, YP_NIL } },
 	{ C_BG_WORKERS,           YP_TINT,  YP_VINT = { 1, 255, YP_NIL } },
+	{ C_CPU_PLACEMENT,        YP_TOPT,  YP_VOPT = { cpu_placements, CPU_PLACEMENT_SIMPLE } },
 	{ C_ASYNC_START,          YP_TBOOL, YP_VNONE },
 	{ C_TCP_IDLE_TIMEOUT,     YP_TINT,  YP_VINT = { 1, INT32_MAX, 10, YP_STIME } },
 	{ C_TCP_IO_TIMEOUT,       YP_TINT,  YP_VINT = { 0, INT32_MAX, 500 } },
 	{ C_TCP_RMT_IO_TIMEOUT,   YP_TINT,  YP_VINT = { 0, INT32_MAX, 5000 } },
 	{ C_TCP_MAX_CLIENTS,      YP_TINT,  YP_VINT = { 0, INT32_MAX, YP_NIL } },
 	{ C_TCP_REUSEPORT,  	  YP_TBOOL, YP_VNONE },
+	{ C_RMT_POOL_LIMIT,       YP_TINT,  YP_VINT = { 0, INT32_MAX, 16 } },
+	{ C_RMT_POOL_TIMEOUT,     YP_TINT,  YP_VINT = { 1, INT32_MAX, 5, YP_STIME } },
+	{ C_REFRESH_LIMIT,        YP_TINT,  YP_VINT = { 0, INT32_MAX, 0 } },
+	{ C_REFRESH_RMT_LIMIT,    YP_TINT,  YP_VINT = { 0, INT32_MAX, 0 } },
+	{ C_REFRESH_JITTER,       YP_TINT,  YP_VINT = { 0, UINT16_MAX, 0, YP_STIME } },
 	{ C_UDP_MAX_PAYLOAD,      YP_TINT,  YP_VINT = { KNOT_EDNS_MIN_DNSSEC_PAYLOAD,
 	                                                KNOT_EDNS_MAX_UDP_PAYLOAD,
 	                                                1232, YP_SSIZE } },
@@ -172,7 +194,12 @@ static const yp_item_t desc_server[] = {
 	{ C_UDP_MAX_PAYLOAD_IPV6, YP_TINT,  YP_VINT = { KNOT_EDNS_MIN_DNSSEC_PAYLOAD,
 	                                                KNOT_EDNS_MAX_UDP_PAYLOAD,
 	                                                1232, YP_SSIZE } },
+	{ C_UDP_BATCH_SIZE,       YP_TINT,  YP_VINT = { 1, 1024, 10 } },
+	{ C_UDP_BUSY_POLL,        YP_TINT,  YP_VINT = { 0, 1000000, 0 } },
 	{ C_LISTEN,               YP_TADDR, YP_VADDR = { 53 }, YP_FMULTI },
+	{ C_LISTEN_TLS,           YP_TADDR, YP_VADDR = { 853 }, YP_FMULTI },
+	{ C_TLS_CERT,             YP_TSTR,  YP_VNONE },
+	{ C_TLS_KEY,              YP_TSTR,  YP_VNONE },
 	{ C_ECS,                  YP_TBOOL, YP_VNONE },
 	{ C_ANS_ROTATION,         YP_TBOOL, YP_VNONE },
 	{ C_COMMENT,              YP_TSTR,  YP_VNONE },
@@ -223,12 +250,14 @@ static const yp_item_t desc_database[] = {
 	{ C_JOURNAL_DB_MODE,     YP_TOPT,  YP_VOPT = { journal_modes, JOURNAL_MODE_ROBUST } },
 	{ C_JOURNAL_DB_MAX_SIZE, YP_TINT,  YP_VINT = { MEGA(1), VIRT_MEM_LIMIT(TERA(100)),
 	                                               VIRT_MEM_LIMIT(GIGA(20)), YP_SSIZE } },
+	{ C_JOURNAL_DB_SHARDS,   YP_TINT,  YP_VINT = { 1, 64, 1 } },
 	{ C_KASP_DB,             YP_TSTR,  YP_VSTR = { "keys" } },
 	{ C_KASP_DB_MAX_SIZE,    YP_TINT,  YP_VINT = { MEGA(5), VIRT_MEM_LIMIT(GIGA(100)),
 	                                               MEGA(500), YP_SSIZE } },
 	{ C_TIMER_DB,            YP_TSTR,  YP_VSTR = { "timers" } },
 	{ C_TIMER_DB_MAX_SIZE,   YP_TINT,  YP_VINT = { MEGA(1), VIRT_MEM_LIMIT(GIGA(100)),
 	                                               MEGA(100), YP_SSIZE } },
+	{ C_TIMER_DB_SHARDS,     YP_TINT,  YP_VINT = { 1, 64, 1 } },
 	{ NULL }
 };
 
@@ -338,17 +367,20 @@ static const yp_item_t desc_policy[] = {
 	{ C_STORAGE,             YP_TSTR,  YP_VSTR = { STORAGE_DIR }, FLAGS }, \
 	{ C_FILE,                YP_TSTR,  YP_VNONE, FLAGS }, \
 	{ C_MASTER,              YP_TREF,  YP_VREF = { C_RMT }, YP_FMULTI, { check_ref } }, \
+	{ C_MASTER_RACE,         YP_TBOOL, YP_VNONE }, \
 	{ C_DDNS_MASTER,         YP_TREF,  YP_VREF = { C_RMT }, YP_FNONE, { check_ref } }, \
 	{ C_NOTIFY,              YP_TREF,  YP_VREF = { C_RMT }, YP_FMULTI, { check_ref } }, \
 	{ C_ACL,                 YP_TREF,  YP_VREF = { C_ACL }, YP_FMULTI, { check_ref } }, \
 	{ C_SEM_CHECKS,          YP_TBOOL, YP_VNONE, FLAGS }, \
 	{ C_DISABLE_ANY,         YP_TBOOL, YP_VNONE }, \
+	{ C_AXFR_CACHE,          YP_TBOOL, YP_VNONE }, \
 	{ C_ZONEFILE_SYNC,       YP_TINT,  YP_VINT = { -1, INT32_MAX, 0, YP_STIME } }, \
 	{ C_JOURNAL_CONTENT,     YP_TOPT,  YP_VOPT = { journal_content, JOURNAL_CONTENT_CHANGES } }, \
 	{ C_ZONEFILE_LOAD,       YP_TOPT,  YP_VOPT = { zonefile_load, ZONEFILE_LOAD_WHOLE } }, \
 	{ C_ZONE_MAX_SIZE,       YP_TINT,  YP_VINT = { 0, SSIZE_MAX, SSIZE_MAX, YP_SSIZE }, FLAGS }, \
 	{ C_JOURNAL_MAX_USAGE,   YP_TINT,  YP_VINT = { KILO(40), SSIZE_MAX, MEGA(100), YP_SSIZE } }, \
 	{ C_JOURNAL_MAX_DEPTH,   YP_TINT,  YP_VINT = { 2, SSIZE_MAX, SSIZE_MAX } }, \
+	{ C_JOURNAL_COMPRESSION, YP_TOPT,  YP_VOPT = { journal_compressions, JOURNAL_COMPRESSION_NONE } }, \
 	{ C_DNSSEC_SIGNING,      YP_TBOOL, YP_VNONE, FLAGS }, \
 	{ C_DNSSEC_POLICY,       YP_TREF,  YP_VREF = { C_POLICY }, FLAGS, { check_ref_dflt } }, \
 	{ C_SERIAL_POLICY,       YP_TOPT,  YP_VOPT = { serial_policies, SERIAL_POLICY_INCREMENT } }, \
@@ -27,6 +27,7 @@
 #define C_ANY			"\x03""any"
 #define C_APPEND		"\x06""append"
 #define C_ASYNC_START		"\x0B""async-start"
+#define C_AXFR_CACHE		"\x0A""axfr-cache"
 #define C_BACKEND		"\x07""backend"
 #define C_BG_WORKERS		"\x12""background-workers"
 #define C_BLOCK_NOTIFY_XFR	"\x1B""block-notify-after-transfer"
@@ -34,6 +35,7 @@
 #define C_CHK_INTERVAL		"\x0E""check-interval"
 #define C_COMMENT		"\x07""comment"
 #define C_CONFIG		"\x06""config"
+#define C_CPU_PLACEMENT		"\x0D""cpu-placement"
 #define C_CTL			"\x07""control"
 #define C_DB			"\x08""database"
 #define C_DDNS_MASTER		"\x0B""ddns-master"
@@ -50,10 +52,12 @@
 #define C_ID			"\x02""id"
 #define C_IDENT			"\x08""identity"
 #define C_INCL			"\x07""include"
+#define C_JOURNAL_COMPRESSION	"\x13""journal-compression"
 #define C_JOURNAL_CONTENT	"\x0F""journal-content"
 #define C_JOURNAL_DB		"\x0A""journal-db"
 #define C_JOURNAL_DB_MAX_SIZE	"\x13""journal-db-max-size"
 #define C_JOURNAL_DB_MODE	"\x0F""journal-db-mode"
+#define C_JOURNAL_DB_SHARDS	"\x11""journal-db-shards"
 #define C_JOURNAL_MAX_DEPTH	"\x11""journal-max-depth"
 #define C_JOURNAL_MAX_USAGE	"\x11""journal-max-usage"
 #define C_KASP_DB		"\x07""kasp-db"
@@ -65,9 +69,11 @@
 #define C_KSK_SHARED		"\x0a""ksk-shared"
 #define C_KSK_SIZE		"\x08""ksk-size"
 #define C_LISTEN		"\x06""listen"
+#define C_LISTEN_TLS		"\x0A""listen-tls"
 #define C_LOG			"\x03""log"
 #define C_MANUAL		"\x06""manual"
 #define C_MASTER		"\x06""master"
+#define C_MASTER_RACE		"\x0B""master-race"
 #define C_MODULE		"\x06""module"
 #define C_NOTIFY		"\x06""notify"
 #define C_NSEC3			"\x05""nsec3"
@@ -81,9 +87,14 @@
 #define C_PIDFILE		"\x07""pidfile"
 #define C_POLICY		"\x06""policy"
 #define C_PROPAG_DELAY		"\x11""propagation-delay"
+#define C_REFRESH_JITTER	"\x0E""refresh-jitter"
+#define C_REFRESH_LIMIT		"\x0D""refresh-limit"
 #define C_REFRESH_MAX_INTERVAL	"\x14""refresh-max-interval"
 #define C_REFRESH_MIN_INTERVAL	"\x14""refresh-min-interval"
+#define C_REFRESH_RMT_LIMIT	"\x14""refresh-remote-limit"
 #define C_RMT			"\x06""remote"
+#define C_RMT_POOL_LIMIT	"\x11""remote-pool-limit"
+#define C_RMT_POOL_TIMEOUT	"\x13""remote-pool-timeout"
 #define C_RRSIG_LIFETIME	"\x0E""rrsig-lifetime"
 #define C_RRSIG_PREREFRESH	"\x11""rrsig-pre-refresh"
 #define C_RRSIG_REFRESH		"\x0D""rrsig-refresh"
@@ -109,7 +120,12 @@
 #define C_TIMER			"\x05""timer"
 #define C_TIMER_DB		"\x08""timer-db"
 #define C_TIMER_DB_MAX_SIZE	"\x11""timer-db-max-size"
+#define C_TIMER_DB_SHARDS	"\x0F""timer-db-shards"
+#define C_TLS_CERT		"\x08""tls-cert"
+#define C_TLS_KEY		"\x07""tls-key"
 #define C_TPL			"\x08""template"
+#define C_UDP_BATCH_SIZE	"\x0E""udp-batch-size"
+#define C_UDP_BUSY_POLL		"\x0D""udp-busy-poll"
 #define C_UDP_MAX_PAYLOAD	"\x0F""udp-max-payload"
 #define C_UDP_MAX_PAYLOAD_IPV4	"\x14""udp-max-payload-ipv4"
 #define C_UDP_MAX_PAYLOAD_IPV6	"\x14""udp-max-payload-ipv6"
@@ -170,9 +186,15 @@ enum {
 	JOURNAL_CONTENT_ALL     = 2,
 };
 
+enum {
+	JOURNAL_COMPRESSION_NONE = 0,
+	JOURNAL_COMPRESSION_ZSTD = 1,
+};
+
 enum {
 	JOURNAL_MODE_ROBUST = 0, // Robust journal DB disk synchronization.
 	JOURNAL_MODE_ASYNC  = 1, // Asynchronous journal DB disk synchronization.
+	JOURNAL_MODE_GROUP  = 2, // Journal DB disk synchronization shared by commits.
 };
 
 enum {
@@ -182,6 +204,12 @@ enum {
 	ZONEFILE_LOAD_DIFSE = 3,
 };
 
+enum {
+	CPU_PLACEMENT_NONE     = 0,
+	CPU_PLACEMENT_SIMPLE   = 1,
+	CPU_PLACEMENT_TOPOLOGY = 2,
+};
+
 extern const knot_lookup_t acl_actions[];
 
 extern const yp_item_t conf_schema[];
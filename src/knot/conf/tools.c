@@ -312,6 +312,18 @@ int check_server(
 	CHECK_LEGACY_NAME(C_SRV, C_MAX_IPV4_UDP_PAYLOAD, C_UDP_MAX_PAYLOAD_IPV4);
 	CHECK_LEGACY_NAME(C_SRV, C_MAX_IPV6_UDP_PAYLOAD, C_UDP_MAX_PAYLOAD_IPV6);
 
+	conf_val_t listen_tls = conf_get_txn(args->extra->conf, args->extra->txn,
+	                                     C_SRV, C_LISTEN_TLS);
+	conf_val_t cert = conf_get_txn(args->extra->conf, args->extra->txn,
+	                               C_SRV, C_TLS_CERT);
+	conf_val_t key = conf_get_txn(args->extra->conf, args->extra->txn,
+	                              C_SRV, C_TLS_KEY);
+	if (listen_tls.code == KNOT_EOK &&
+	    (cert.code != KNOT_EOK || key.code != KNOT_EOK)) {
+		args->err_str = "TLS listening requires 'tls-cert' and 'tls-key'";
+		return KNOT_EINVAL;
+	}
+
 	return KNOT_EOK;
 }
 
@@ -14,6 +14,7 @@
     along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <inttypes.h>
 #include <string.h>
 #include <unistd.h>
 #include <sys/time.h>
@@ -26,6 +27,7 @@
 #include "knot/dnssec/key-events.h"
 #include "knot/events/events.h"
 #include "knot/events/handlers.h"
+#include "knot/events/refresh_sched.h"
 #include "knot/journal/journal_metadata.h"
 #include "knot/nameserver/query_module.h"
 #include "knot/updates/zone-update.h"
@@ -36,6 +38,7 @@
 #include "contrib/macros.h"
 #include "contrib/mempattern.h"
 #include "contrib/string.h"
+#include "contrib/time.h"
 #include "contrib/ucw/lists.h"
 #include "libzscanner/scanner.h"
 #include "contrib/strtonum.h"
@@ -1048,7 +1051,7 @@ static bool zone_names_distinct(const knot_dname_t *zone, void *data)
 static int drop_journal_if_orphan(const knot_dname_t *for_zone, void *ctx)
 {
 	server_t *server = ctx;
-	zone_journal_t j = { &server->journaldb, for_zone };
+	zone_journal_t j = { knot_lmdb_shard(&server->journaldb, for_zone), for_zone };
 	if (!zone_exists(for_zone, server->zone_db)) {
 		(void)journal_scrape_with_md(j);
 	}
@@ -1103,7 +1106,8 @@ static int orphans_purge(ctl_args_t *args)
 
 				// Purge zone journal.
 				if (only_orphan || MATCH_AND_FILTER(args, CTL_FILTER_PURGE_JOURNAL)) {
-					zone_journal_t j = { &args->server->journaldb, zone_name };
+					zone_journal_t j = { knot_lmdb_shard(&args->server->journaldb, zone_name),
+					                      zone_name };
 					(void)journal_scrape_with_md(j);
 				}
 
@@ -1368,6 +1372,53 @@ static int ctl_zone(ctl_args_t *args, ctl_cmd_t cmd)
 	}
 }
 
+/*! \brief Print the placement and query rate of the query handling threads. */
+static int threads_status(server_t *server, char *buff, size_t size)
+{
+	static const char *names[] = { [IO_UDP] = "UDP", [IO_TCP] = "TCP" };
+
+	struct timespec now = time_now();
+	size_t len = 0;
+	for (int proto = IO_UDP; proto <= IO_TCP; proto++) {
+		for (unsigned i = 0; i < server->handlers[proto].size; i++) {
+			handler_thread_t *thr = &server->handlers[proto].handler.threads[i];
+			uint64_t queries = ATOMIC_GET(thr->queries);
+			double secs = time_diff_ms(&thr->last_report, &now) / 1000.0;
+			double qps = (secs > 0) ? (queries - thr->last_queries) / secs : 0;
+			thr->last_queries = queries;
+			thr->last_report = now;
+
+			char cpu[32] = "not bound";
+			if (thr->cpu >= 0) {
+				(void)snprintf(cpu, sizeof(cpu), "CPU %i, node %i",
+				               thr->cpu, thr->node);
+			}
+			int ret = snprintf(buff + len, size - len,
+			                   "%s%s thread %u: %s, queries %"PRIu64", %.1f qps",
+			                   (len > 0) ? "\n" : "", names[proto], i, cpu,
+			                   queries, qps);
+			if (ret <= 0 || ret >= size - len) {
+				return KNOT_ESPACE;
+			}
+			len += ret;
+		}
+	}
+
+	int ret = snprintf(buff + len, size - len, "%sbackground workers: %s",
+	                   (len > 0) ? "\n" : "",
+	                   (server->bg_cpu_count > 0) ? "CPU" : "not bound");
+	for (unsigned i = 0; i < server->bg_cpu_count && ret > 0 && ret < size - len; i++) {
+		len += ret;
+		ret = snprintf(buff + len, size - len, "%s%u",
+		               (i > 0) ? "," : " ", server->bg_cpus[i]);
+	}
+	if (ret <= 0 || ret >= size - len) {
+		return KNOT_ESPACE;
+	}
+
+	return KNOT_EOK;
+}
+
 static int server_status(ctl_args_t *args)
 {
 	const char *type = args->data[KNOT_CTL_IDX_TYPE];
@@ -1378,16 +1429,62 @@ static int server_status(ctl_args_t *args)
 
 	char buff[2048] = "";
 
+	if (strcasecmp(type, "threads") == 0) {
+		/* Up to 255 UDP and 255 TCP threads, one line each. */
+		size_t size = 96 * (args->server->handlers[IO_UDP].size +
+		                    args->server->handlers[IO_TCP].size) + sizeof(buff);
+		char *threads = malloc(size);
+		if (threads == NULL) {
+			return KNOT_ENOMEM;
+		}
+		int ret = threads_status(args->server, threads, size);
+		if (ret == KNOT_EOK) {
+			args->data[KNOT_CTL_IDX_DATA] = threads;
+			ret = knot_ctl_send(args->ctl, KNOT_CTL_TYPE_DATA, &args->data);
+			args->data[KNOT_CTL_IDX_DATA] = NULL;
+		}
+		free(threads);
+		return ret;
+	}
+
 	int ret;
 	if (strcasecmp(type, "version") == 0) {
 		ret = snprintf(buff, sizeof(buff), "Version: %s", PACKAGE_VERSION);
 	} else if (strcasecmp(type, "workers") == 0) {
 		int running_bkg_wrk, wrk_queue;
-		worker_pool_status(args->server->workers, &running_bkg_wrk, &wrk_queue);
+		worker_prio_stats_t stats[TASK_PRIO_COUNT];
+		worker_pool_status(args->server->workers, &running_bkg_wrk, &wrk_queue,
+		                   stats);
 		ret = snprintf(buff, sizeof(buff), "UDP workers: %zu, TCP workers %zu, "
 		               "background workers: %zu (running: %d, pending: %d)",
 		               conf()->cache.srv_udp_threads, conf()->cache.srv_tcp_threads,
 		               conf()->cache.srv_bg_threads, running_bkg_wrk, wrk_queue);
+		static const struct {
+			task_prio_t prio;
+			const char *name;
+		} classes[] = {
+			{ TASK_PRIO_HIGH,   "high" },
+			{ TASK_PRIO_NORMAL, "normal" },
+			{ TASK_PRIO_LOW,    "low" },
+		};
+		for (int i = 0; i < TASK_PRIO_COUNT && ret > 0 && ret < sizeof(buff); i++) {
+			worker_prio_stats_t *st = &stats[classes[i].prio];
+			uint64_t avg = (st->started > 0) ? st->wait_sum / st->started : 0;
+			ret += snprintf(buff + ret, sizeof(buff) - ret,
+			                "\n%s priority: pending %zu, started %"PRIu64", "
+			                "wait avg %"PRIu64" ms, wait max %"PRIu64" ms",
+			                classes[i].name, st->queued, st->started,
+			                avg, st->wait_max);
+		}
+	} else if (strcasecmp(type, "refresh") == 0) {
+		refresh_sched_stats_t stats;
+		refresh_sched_stats(global_refresh_sched, &stats);
+		ret = snprintf(buff, sizeof(buff), "running: %zu (limit: %zu, per remote: %zu), "
+		               "backlog: %zu zones (longest wait: %lld s), "
+		               "rate: %.2f refreshes/s, started: %"PRIu64", deferred: %"PRIu64,
+		               stats.running, stats.limit, stats.remote_limit,
+		               stats.backlog, (long long)stats.oldest_wait,
+		               stats.rate, stats.started, stats.deferred);
 	} else if (strcasecmp(type, "configure") == 0) {
 		ret = snprintf(buff, sizeof(buff), "%s", CONFIGURE_SUMMARY);
 	} else {
@@ -35,21 +35,22 @@ typedef struct event_info {
 	zone_event_type_t type;
 	const zone_event_cb callback;
 	const char *name;
+	task_prio_t prio;
 } event_info_t;
 
 static const event_info_t EVENT_INFO[] = {
-	{ ZONE_EVENT_LOAD,         event_load,        "load" },
-	{ ZONE_EVENT_REFRESH,      event_refresh,     "refresh" },
-	{ ZONE_EVENT_UPDATE,       event_update,      "update" },
-	{ ZONE_EVENT_EXPIRE,       event_expire,      "expiration" },
-	{ ZONE_EVENT_FLUSH,        event_flush,       "journal flush" },
-	{ ZONE_EVENT_NOTIFY,       event_notify,      "notify" },
-	{ ZONE_EVENT_DNSSEC,       event_dnssec,      "DNSSEC re-sign" },
-	{ ZONE_EVENT_UFREEZE,      event_ufreeze,     "update freeze" },
-	{ ZONE_EVENT_UTHAW,        event_uthaw,       "update thaw" },
-	{ ZONE_EVENT_NSEC3RESALT,  event_nsec3resalt, "NSEC3 resalt" },
-	{ ZONE_EVENT_DS_CHECK,     event_ds_check,    "DS check" },
-	{ ZONE_EVENT_DS_PUSH,      event_ds_push,     "DS push" },
+	{ ZONE_EVENT_LOAD,         event_load,        "load",           TASK_PRIO_LOW },
+	{ ZONE_EVENT_REFRESH,      event_refresh,     "refresh",        TASK_PRIO_NORMAL },
+	{ ZONE_EVENT_UPDATE,       event_update,      "update",         TASK_PRIO_HIGH },
+	{ ZONE_EVENT_EXPIRE,       event_expire,      "expiration",     TASK_PRIO_NORMAL },
+	{ ZONE_EVENT_FLUSH,        event_flush,       "journal flush",  TASK_PRIO_LOW },
+	{ ZONE_EVENT_NOTIFY,       event_notify,      "notify",         TASK_PRIO_HIGH },
+	{ ZONE_EVENT_DNSSEC,       event_dnssec,      "DNSSEC re-sign", TASK_PRIO_LOW },
+	{ ZONE_EVENT_UFREEZE,      event_ufreeze,     "update freeze",  TASK_PRIO_HIGH },
+	{ ZONE_EVENT_UTHAW,        event_uthaw,       "update thaw",    TASK_PRIO_HIGH },
+	{ ZONE_EVENT_NSEC3RESALT,  event_nsec3resalt, "NSEC3 resalt",   TASK_PRIO_LOW },
+	{ ZONE_EVENT_DS_CHECK,     event_ds_check,    "DS check",       TASK_PRIO_LOW },
+	{ ZONE_EVENT_DS_PUSH,      event_ds_push,     "DS push",        TASK_PRIO_LOW },
 	{ 0 }
 };
 
@@ -263,6 +264,9 @@ static void event_dispatch(event_t *event)
 	pthread_mutex_lock(&events->mx);
 	if (!events->running && !events->frozen) {
 		events->running = true;
+		zone_event_type_t type = get_next_event(events);
+		events->task.prio = valid_event(type) ? get_event_info(type)->prio :
+		                                        TASK_PRIO_NORMAL;
 		worker_pool_assign(events->pool, &events->task);
 	}
 	pthread_mutex_unlock(&events->mx);
@@ -416,6 +420,7 @@ void zone_events_enqueue(zone_t *zone, zone_event_type_t type)
 		events->running = true;
 		events->type = type;
 		event_set_time(events, type, ZONE_EVENT_IMMEDIATE);
+		events->task.prio = get_event_info(type)->prio;
 		worker_pool_assign(events->pool, &events->task);
 		pthread_mutex_unlock(&events->mx);
 		return;
@@ -15,12 +15,14 @@
  */
 
 #include <assert.h>
+#include <stdlib.h>
 
 #include "knot/common/log.h"
 #include "knot/conf/conf.h"
 #include "knot/query/query.h"
 #include "knot/query/requestor.h"
 #include "knot/zone/zone.h"
+#include "contrib/macros.h"
 #include "libknot/errcode.h"
 
 /*!
@@ -76,36 +78,51 @@ static const knot_layer_api_t NOTIFY_API = {
 	ns_log(priority, zone, LOG_OPERATION_NOTIFY, LOG_DIRECTION_OUT, remote, \
 	       fmt, ## __VA_ARGS__)
 
-static int send_notify(conf_t *conf, zone_t *zone, const knot_rrset_t *soa,
-                       const conf_remote_t *slave, int timeout)
-{
-	struct notify_data data = {
-		.zone = zone->name,
-		.soa = soa,
-		.remote = (struct sockaddr *)&slave->addr,
-	};
+/*! \brief NOTIFY to one remote address, executed along with the others. */
+struct notify_job {
+	struct notify_data data;
+	knot_requestor_t requestor;
+	size_t remote_idx;
+};
 
-	query_edns_data_init(&data.edns, conf, zone->name, slave->addr.ss_family);
+static int notify_job_init(conf_t *conf, zone_t *zone, const knot_rrset_t *soa,
+                           const conf_remote_t *slave, struct notify_job *job,
+                           knot_request_slot_t *slot)
+{
+	job->data.zone = zone->name;
+	job->data.soa = soa;
+	job->data.remote = (struct sockaddr *)&slave->addr;
 
-	knot_requestor_t requestor;
-	knot_requestor_init(&requestor, &NOTIFY_API, &data, NULL);
+	query_edns_data_init(&job->data.edns, conf, zone->name, slave->addr.ss_family);
 
 	knot_pkt_t *pkt = knot_pkt_new(NULL, KNOT_WIRE_MAX_PKTSIZE, NULL);
 	if (!pkt) {
-		knot_requestor_clear(&requestor);
 		return KNOT_ENOMEM;
 	}
 
 	const struct sockaddr_storage *dst = &slave->addr;
 	const struct sockaddr_storage *src = &slave->via;
-	knot_request_t *req = knot_request_make(NULL, dst, src, pkt, &slave->key, 0);
+	knot_request_t *req = knot_request_make(NULL, dst, src, pkt, &slave->key,
+	                                       KNOT_REQUEST_REUSE);
 	if (!req) {
-		knot_request_free(req, NULL);
-		knot_requestor_clear(&requestor);
+		knot_pkt_free(pkt);
 		return KNOT_ENOMEM;
 	}
 
-	int ret = knot_requestor_exec(&requestor, req, timeout);
+	knot_requestor_init(&job->requestor, &NOTIFY_API, &job->data, NULL);
+
+	slot->requestor = &job->requestor;
+	slot->request = req;
+
+	return KNOT_EOK;
+}
+
+static void notify_job_finish(zone_t *zone, const knot_rrset_t *soa,
+                              knot_request_slot_t *slot)
+{
+	knot_request_t *req = slot->request;
+	const struct sockaddr_storage *dst = &req->remote;
+	int ret = slot->ret;
 
 	if (ret == KNOT_EOK && knot_pkt_ext_rcode(req->resp) == 0) {
 		NOTIFY_OUT_LOG(LOG_INFO, zone->name, dst,
@@ -120,9 +137,50 @@ static int send_notify(conf_t *conf, zone_t *zone, const knot_rrset_t *soa,
 	}
 
 	knot_request_free(req, NULL);
-	knot_requestor_clear(&requestor);
+	knot_requestor_clear(slot->requestor);
+}
+
+/*! \brief Send NOTIFY to the i-th address of each remote not yet notified. */
+static void notify_round(conf_t *conf, zone_t *zone, const knot_rrset_t *soa,
+                           size_t addr_idx, bool *notified,
+                           struct notify_job *jobs, knot_request_slot_t *slots)
+{
+	int timeout = conf->cache.srv_tcp_remote_io_timeout;
+
+	size_t count = 0;
+	conf_val_t notify = conf_zone_get(conf, C_NOTIFY, zone->name);
+	for (size_t i = 0; notify.code == KNOT_EOK; i++, conf_val_next(&notify)) {
+		if (notified[i]) {
+			continue;
+		}
+
+		conf_val_t addr = conf_id_get(conf, C_RMT, C_ADDR, &notify);
+		if (addr_idx >= conf_val_count(&addr)) {
+			continue;
+		}
+
+		conf_remote_t slave = conf_remote(conf, &notify, addr_idx);
+		int ret = notify_job_init(conf, zone, soa, &slave, &jobs[count],
+		                          &slots[count]);
+		if (ret != KNOT_EOK) {
+			NOTIFY_OUT_LOG(LOG_WARNING, zone->name, &slave.addr,
+			               "failed (%s)", knot_strerror(ret));
+			continue;
+		}
+		jobs[count].remote_idx = i;
+		count++;
+	}
 
-	return ret;
+	int ret = knot_requestor_exec_many(slots, count, timeout);
+	for (size_t i = 0; i < count; i++) {
+		if (ret != KNOT_EOK) {
+			slots[i].ret = ret;
+		}
+		if (slots[i].ret == KNOT_EOK) {
+			notified[jobs[i].remote_idx] = true;
+		}
+		notify_job_finish(zone, soa, &slots[i]);
+	}
 }
 
 int event_notify(conf_t *conf, zone_t *zone)
@@ -134,25 +192,38 @@ int event_notify(conf_t *conf, zone_t *zone)
 	}
 
 	// NOTIFY content
-	int timeout = conf->cache.srv_tcp_remote_io_timeout;
 	knot_rrset_t soa = node_rrset(zone->contents->apex, KNOT_RRTYPE_SOA);
 
-	// send NOTIFY to each remote, use working address
+	size_t remotes = 0, max_addrs = 0;
 	conf_val_t notify = conf_zone_get(conf, C_NOTIFY, zone->name);
 	while (notify.code == KNOT_EOK) {
 		conf_val_t addr = conf_id_get(conf, C_RMT, C_ADDR, &notify);
-		size_t addr_count = conf_val_count(&addr);
-
-		for (int i = 0; i < addr_count; i++) {
-			conf_remote_t slave = conf_remote(conf, &notify, i);
-			int ret = send_notify(conf, zone, &soa, &slave, timeout);
-			if (ret == KNOT_EOK) {
-				break;
-			}
-		}
-
+		max_addrs = MAX(max_addrs, conf_val_count(&addr));
+		remotes++;
 		conf_val_next(&notify);
 	}
+	if (remotes == 0) {
+		return KNOT_EOK;
+	}
+
+	bool *notified = calloc(remotes, sizeof(*notified));
+	struct notify_job *jobs = calloc(remotes, sizeof(*jobs));
+	knot_request_slot_t *slots = calloc(remotes, sizeof(*slots));
+	if (notified == NULL || jobs == NULL || slots == NULL) {
+		free(notified);
+		free(jobs);
+		free(slots);
+		return KNOT_ENOMEM;
+	}
+
+	// send NOTIFY to all remotes at once, use next address of failed ones
+	for (size_t addr_idx = 0; addr_idx < max_addrs; addr_idx++) {
+		notify_round(conf, zone, &soa, addr_idx, notified, jobs, slots);
+	}
+
+	free(notified);
+	free(jobs);
+	free(slots);
 
 	return KNOT_EOK;
 }
@@ -16,13 +16,17 @@
 
 #include <assert.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "contrib/mempattern.h"
+#include "contrib/sockaddr.h"
 #include "libdnssec/random.h"
 #include "knot/common/log.h"
 #include "knot/conf/conf.h"
 #include "knot/dnssec/zone-events.h"
 #include "knot/events/handlers.h"
+#include "knot/events/refresh_poll.h"
+#include "knot/events/refresh_sched.h"
 #include "knot/events/replan.h"
 #include "knot/nameserver/ixfr.h"
 #include "knot/query/layer.h"
@@ -100,6 +104,7 @@ struct refresh_data {
 	const knot_rrset_t *soa;          //!< Local SOA (NULL for AXFR).
 	const size_t max_zone_size;       //!< Maximal zone size.
 	struct query_edns_data edns;      //!< EDNS data to be used in queries.
+	bool soa_known;                   //!< Remote SOA already queried, transfer directly.
 
 	// internal state, initialize with zeroes:
 
@@ -1033,7 +1038,7 @@ static int refresh_begin(knot_layer_t *layer, void *_data)
 	struct refresh_data *data = _data;
 
 	if (data->soa) {
-		data->state = STATE_SOA_QUERY;
+		data->state = data->soa_known ? STATE_TRANSFER : STATE_SOA_QUERY;
 		data->xfr_type = XFR_TYPE_IXFR;
 		data->initial_soa_copy = NULL;
 	} else {
@@ -1107,6 +1112,8 @@ static size_t max_zone_size(conf_t *conf, const knot_dname_t *zone)
 typedef struct {
 	bool force_axfr;
 	bool send_notify;
+	bool deferred;
+	struct sockaddr_storage soa_known; //!< Master with already queried SOA.
 } try_refresh_ctx_t;
 
 /*! \brief Which errors from IXFR are relevant reason to try AXFR. */
@@ -1133,6 +1140,14 @@ static int try_refresh(conf_t *conf, zone_t *zone, const conf_remote_t *master,
 
 	try_refresh_ctx_t *trctx = ctx;
 
+	int ret = refresh_sched_acquire(global_refresh_sched, zone->name, &master->addr);
+	if (ret == KNOT_EBUSY) {
+		trctx->deferred = true;
+		return ret;
+	} else if (ret != KNOT_EOK) {
+		return ret;
+	}
+
 	knot_rrset_t soa = { 0 };
 	if (zone->contents) {
 		soa = node_rrset(zone->contents->apex, KNOT_RRTYPE_SOA);
@@ -1144,6 +1159,8 @@ static int try_refresh(conf_t *conf, zone_t *zone, const conf_remote_t *master,
 		.remote = (struct sockaddr *)&master->addr,
 		.soa = zone->contents && !trctx->force_axfr ? &soa : NULL,
 		.max_zone_size = max_zone_size(conf, zone->name),
+		.soa_known = trctx->soa_known.ss_family != AF_UNSPEC &&
+		             sockaddr_cmp(&master->addr, &trctx->soa_known) == 0,
 	};
 
 	query_edns_data_init(&data.edns, conf, zone->name, master->addr.ss_family);
@@ -1154,22 +1171,23 @@ static int try_refresh(conf_t *conf, zone_t *zone, const conf_remote_t *master,
 	knot_pkt_t *pkt = knot_pkt_new(NULL, KNOT_WIRE_MAX_PKTSIZE, NULL);
 	if (!pkt) {
 		knot_requestor_clear(&requestor);
+		refresh_sched_release(global_refresh_sched, &master->addr);
 		return KNOT_ENOMEM;
 	}
 
 	const struct sockaddr_storage *dst = &master->addr;
 	const struct sockaddr_storage *src = &master->via;
-	knot_request_t *req = knot_request_make(NULL, dst, src, pkt, &master->key, 0);
+	knot_request_t *req = knot_request_make(NULL, dst, src, pkt, &master->key,
+	                                       KNOT_REQUEST_REUSE);
 	if (!req) {
 		knot_request_free(req, NULL);
 		knot_requestor_clear(&requestor);
+		refresh_sched_release(global_refresh_sched, &master->addr);
 		return KNOT_ENOMEM;
 	}
 
 	int timeout = conf->cache.srv_tcp_remote_io_timeout;
 
-	int ret;
-
 	// while loop runs 0x or 1x; IXFR to AXFR failover
 	while (ret = knot_requestor_exec(&requestor, req, timeout),
 	       ixfr_error_failover(ret) && data.xfr_type == XFR_TYPE_IXFR) {
@@ -1182,6 +1200,7 @@ static int try_refresh(conf_t *conf, zone_t *zone, const conf_remote_t *master,
 	}
 	knot_request_free(req, NULL);
 	knot_requestor_clear(&requestor);
+	refresh_sched_release(global_refresh_sched, &master->addr);
 
 	if (ret == KNOT_EOK) {
 		trctx->send_notify = data.updated && !master->block_notify_after_xfr;
@@ -1190,6 +1209,50 @@ static int try_refresh(conf_t *conf, zone_t *zone, const conf_remote_t *master,
 	return ret;
 }
 
+/*!
+ * \brief Evaluate the SOA of the masters polled by the shared poller.
+ *
+ * \retval KNOT_EOK     Zone is up-to-date.
+ * \retval KNOT_EAGAIN  Continue with a transfer from the polled master.
+ * \retval (error)      No master answered, local failure or the master is outdated.
+ */
+static int refresh_polled(conf_t *conf, zone_t *zone, try_refresh_ctx_t *trctx,
+                          const refresh_poll_result_t *polled)
+{
+	if (polled->ret == KNOT_EBUSY) {
+		trctx->deferred = true;
+	}
+	if (polled->ret != KNOT_EOK) {
+		return polled->ret;
+	}
+
+	uint32_t local_serial;
+	int ret = slave_zone_serial(zone, conf, &local_serial);
+	if (ret != KNOT_EOK) {
+		xfr_log_read_ms(zone->name, ret);
+		return ret;
+	}
+
+	const struct sockaddr *remote = (struct sockaddr *)&polled->remote;
+	bool current = serial_is_current(local_serial, polled->serial);
+	bool master_uptodate = serial_is_current(polled->serial, local_serial);
+
+	REFRESH_LOG(LOG_INFO, zone->name, remote,
+	            "remote serial %u, %s", polled->serial,
+	            current ? (master_uptodate ? "zone is up-to-date" :
+	            "master is outdated") : "zone is outdated");
+
+	if (!current) {
+		zone_set_preferred_master(zone, &polled->remote);
+		memcpy(&trctx->soa_known, &polled->remote, sizeof(trctx->soa_known));
+		return KNOT_EAGAIN;
+	} else if (!master_uptodate) {
+		return KNOT_EPROCESSING;
+	}
+
+	return KNOT_EOK;
+}
+
 static int64_t min_refresh_interval(conf_t *conf, const knot_dname_t *zone)
 {
 	conf_val_t val = conf_zone_get(conf, C_REFRESH_MIN_INTERVAL, zone);
@@ -1225,7 +1288,35 @@ int event_refresh(conf_t *conf, zone_t *zone)
 		zone->zonefile.retransfer = true;
 	}
 
-	int ret = zone_master_try(conf, zone, try_refresh, &trctx, "refresh");
+	// SOA of the masters is polled outside of the workers, continue once done
+	int ret = KNOT_EAGAIN;
+	refresh_poll_result_t polled;
+	if (refresh_poll_take(global_refresh_poll, zone->name, &polled) &&
+	    !trctx.force_axfr) {
+		ret = refresh_polled(conf, zone, &trctx, &polled);
+	} else if (zone->contents != NULL && !trctx.force_axfr &&
+	           refresh_poll_submit(global_refresh_poll, conf, zone) == KNOT_EOK) {
+		return KNOT_EOK;
+	}
+
+	if (ret == KNOT_EAGAIN) {
+		ret = zone_master_try(conf, zone, try_refresh, &trctx, "refresh");
+	}
+
+	// Retry shortly if the remotes are busy with other zones.
+	if (ret != KNOT_EOK && trctx.deferred) {
+		if (trctx.force_axfr) {
+			zone->flags |= ZONE_FORCE_AXFR;
+		}
+		time_t expires = 0;
+		if (zone->contents != NULL) {
+			expires = zone->timers.last_refresh + zone->timers.soa_expire;
+		}
+		time_t retry = refresh_sched_defer(global_refresh_sched, zone->name, expires);
+		zone_events_schedule_at(zone, ZONE_EVENT_REFRESH, retry);
+		return KNOT_EOK;
+	}
+
 	zone_clear_preferred_master(zone);
 	if (ret != KNOT_EOK) {
 		log_zone_error(zone->name, "refresh, failed (%s)", knot_strerror(ret));
@@ -0,0 +1,689 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <urcu.h>
+
+#include "knot/events/refresh_poll.h"
+#include "knot/events/refresh_sched.h"
+#include "knot/common/log.h"
+#include "knot/query/query.h"
+#include "knot/server/server.h"
+#include "knot/zone/serial.h"
+#include "libknot/errcode.h"
+#include "contrib/sockaddr.h"
+#include "contrib/time.h"
+
+/*! \brief Maximum of SOA queries in progress. */
+#define POLL_MAX_QUERIES	1024
+/*! \brief Interval of picking up newly queued zones (miliseconds). */
+#define POLL_WAIT_MS		100
+/*! \brief Time for the others once a master answered in the race (miliseconds). */
+#define POLL_GRACE_MS		200
+/*! \brief Unclaimed results are dropped after this time (seconds). */
+#define POLL_RESULT_STALE	300
+
+#define POLL_LOG(priority, zone, remote, msg...) \
+	ns_log(priority, zone, LOG_OPERATION_REFRESH, LOG_DIRECTION_NONE, remote, msg)
+
+refresh_poll_t *global_refresh_poll = NULL;
+
+/*! \brief Master address to be queried. */
+typedef struct {
+	conf_remote_t remote;        /*!< Address with an own copy of the TSIG key. */
+	struct query_edns_data edns;
+	char *name;                  /*!< Remote name for logging. */
+} poll_master_t;
+
+typedef enum {
+	POLL_QUEUED = 0,
+	POLL_RUNNING,
+	POLL_DONE,
+} poll_state_t;
+
+/*! \brief SOA polling of one zone. */
+typedef struct {
+	node_t n;                    /*!< Node in the queue. */
+	knot_dname_t *name;
+	poll_state_t state;
+	poll_master_t *masters;      /*!< Preferred master first. */
+	size_t count;
+	uint32_t local_serial;       /*!< Serial of the zone when submitted. */
+	int timeout;
+	bool race;                   /*!< Query all masters at once. */
+	bool race_conf;              /*!< Race configured for the zone. */
+	bool renew;                  /*!< Submitted again while running. */
+
+	size_t next;                 /*!< Next master to query one by one. */
+	list_t queries;              /*!< Queries in progress. */
+	bool busy;                   /*!< Some master over the refresh limits. */
+	poll_master_t *best;         /*!< Master with the winning answer. */
+	uint32_t serial;             /*!< Serial of the best master. */
+	refresh_poll_result_t result;
+	time_t done;                 /*!< Time of the result. */
+} poll_zone_t;
+
+/*! \brief SOA query to one master address. */
+typedef struct {
+	knot_request_slot_t slot;    /*!< Must be first, see query_done(). */
+	node_t n;                    /*!< Node in the zone queries. */
+	poll_zone_t *zone;
+	poll_master_t *master;
+	knot_requestor_t requestor;
+	uint32_t serial;
+} poll_query_t;
+
+static time_t poll_now(void)
+{
+	return time_now().tv_sec;
+}
+
+static int soa_poll_begin(knot_layer_t *layer, void *params)
+{
+	layer->data = params;
+
+	return KNOT_STATE_PRODUCE;
+}
+
+static int soa_poll_produce(knot_layer_t *layer, knot_pkt_t *pkt)
+{
+	poll_query_t *query = layer->data;
+
+	query_init_pkt(pkt);
+
+	int ret = knot_pkt_put_question(pkt, query->zone->name, KNOT_CLASS_IN,
+	                                KNOT_RRTYPE_SOA);
+	if (ret != KNOT_EOK) {
+		return KNOT_STATE_FAIL;
+	}
+
+	ret = query_put_edns(pkt, &query->master->edns);
+	if (ret != KNOT_EOK) {
+		return KNOT_STATE_FAIL;
+	}
+
+	return KNOT_STATE_CONSUME;
+}
+
+static int soa_poll_consume(knot_layer_t *layer, knot_pkt_t *pkt)
+{
+	poll_query_t *query = layer->data;
+	const struct sockaddr *remote = (struct sockaddr *)&query->master->remote.addr;
+
+	if (knot_pkt_ext_rcode(pkt) != KNOT_RCODE_NOERROR) {
+		POLL_LOG(LOG_WARNING, query->zone->name, remote,
+		         "server responded with error '%s'",
+		         knot_pkt_ext_rcode_name(pkt));
+		return KNOT_STATE_FAIL;
+	}
+
+	const knot_pktsection_t *answer = knot_pkt_section(pkt, KNOT_ANSWER);
+	const knot_rrset_t *rr = answer->count == 1 ? knot_pkt_rr(answer, 0) : NULL;
+	if (!rr || rr->type != KNOT_RRTYPE_SOA || rr->rrs.count != 1) {
+		POLL_LOG(LOG_WARNING, query->zone->name, remote, "malformed message");
+		return KNOT_STATE_FAIL;
+	}
+
+	query->serial = knot_soa_serial(rr->rrs.rdata);
+
+	return KNOT_STATE_DONE;
+}
+
+static const knot_layer_api_t SOA_POLL_API = {
+	.begin = soa_poll_begin,
+	.produce = soa_poll_produce,
+	.consume = soa_poll_consume,
+};
+
+static void masters_free(poll_zone_t *zone)
+{
+	for (size_t i = 0; i < zone->count; i++) {
+		knot_tsig_key_deinit(&zone->masters[i].remote.key);
+		free(zone->masters[i].name);
+	}
+	free(zone->masters);
+	zone->masters = NULL;
+	zone->count = 0;
+}
+
+/*! \brief Collect master addresses in the configuration order, preferred first. */
+static int masters_init(poll_zone_t *zone, conf_t *conf, zone_t *zone_ptr)
+{
+	size_t count = 0;
+	conf_val_t masters = conf_zone_get(conf, C_MASTER, zone_ptr->name);
+	while (masters.code == KNOT_EOK) {
+		conf_val_t addr = conf_id_get(conf, C_RMT, C_ADDR, &masters);
+		count += conf_val_count(&addr);
+		conf_val_next(&masters);
+	}
+	if (count == 0) {
+		return KNOT_ENOMASTER;
+	}
+
+	zone->masters = calloc(count, sizeof(*zone->masters));
+	if (zone->masters == NULL) {
+		return KNOT_ENOMEM;
+	}
+
+	struct sockaddr_storage preferred = { AF_UNSPEC };
+	pthread_mutex_lock(&zone_ptr->preferred_lock);
+	if (zone_ptr->preferred_master != NULL) {
+		preferred = *zone_ptr->preferred_master;
+	}
+	pthread_mutex_unlock(&zone_ptr->preferred_lock);
+
+	masters = conf_zone_get(conf, C_MASTER, zone_ptr->name);
+	while (masters.code == KNOT_EOK && zone->count < count) {
+		conf_val_t addr = conf_id_get(conf, C_RMT, C_ADDR, &masters);
+		size_t addr_count = conf_val_count(&addr);
+		for (size_t i = 0; i < addr_count && zone->count < count; i++) {
+			conf_remote_t remote = conf_remote(conf, &masters, i);
+			poll_master_t *master = &zone->masters[zone->count];
+			master->remote = remote;
+			memset(&master->remote.key, 0, sizeof(master->remote.key));
+			int ret = KNOT_EOK;
+			if (remote.key.name != NULL) {
+				ret = knot_tsig_key_copy(&master->remote.key, &remote.key);
+			}
+			master->name = strdup(conf_str(&masters));
+			if (ret != KNOT_EOK || master->name == NULL) {
+				knot_tsig_key_deinit(&master->remote.key);
+				free(master->name);
+				masters_free(zone);
+				return KNOT_ENOMEM;
+			}
+			query_edns_data_init(&master->edns, conf, zone_ptr->name,
+			                     remote.addr.ss_family);
+			zone->count++;
+
+			// move the preferred master to the front
+			if (preferred.ss_family != AF_UNSPEC &&
+			    sockaddr_net_match(&remote.addr, &preferred, -1)) {
+				preferred.ss_family = AF_UNSPEC;
+				poll_master_t tmp = *master;
+				memmove(zone->masters + 1, zone->masters,
+				        (zone->count - 1) * sizeof(*master));
+				zone->masters[0] = tmp;
+			}
+		}
+		conf_val_next(&masters);
+	}
+
+	return KNOT_EOK;
+}
+
+static void polled_reset(poll_zone_t *zone)
+{
+	zone->state = POLL_QUEUED;
+	zone->race = zone->race_conf;
+	zone->renew = false;
+	zone->next = 0;
+	zone->busy = false;
+	zone->best = NULL;
+	memset(&zone->result, 0, sizeof(zone->result));
+}
+
+static void polled_free(poll_zone_t *zone)
+{
+	masters_free(zone);
+	free(zone->name);
+	free(zone);
+}
+
+static void query_free(poll_query_t *query)
+{
+	knot_request_free(query->slot.request, NULL);
+	knot_requestor_clear(&query->requestor);
+	free(query);
+}
+
+static int query_start(refresh_poll_t *poll, poll_zone_t *zone,
+                       poll_master_t *master)
+{
+	poll_query_t *query = calloc(1, sizeof(*query));
+	if (query == NULL) {
+		return KNOT_ENOMEM;
+	}
+	query->zone = zone;
+	query->master = master;
+
+	knot_pkt_t *pkt = knot_pkt_new(NULL, KNOT_WIRE_MAX_PKTSIZE, NULL);
+	query->slot.request = knot_request_make(NULL, &master->remote.addr,
+	                                        &master->remote.via, pkt,
+	                                        &master->remote.key,
+	                                        KNOT_REQUEST_PIPELINE);
+	if (query->slot.request == NULL) {
+		knot_pkt_free(pkt);
+		free(query);
+		return KNOT_ENOMEM;
+	}
+	knot_requestor_init(&query->requestor, &SOA_POLL_API, query, NULL);
+	query->slot.requestor = &query->requestor;
+
+	int ret = knot_request_loop_add(poll->loop, &query->slot, zone->timeout);
+	if (ret != KNOT_EOK) {
+		query_free(query);
+		return ret;
+	}
+
+	add_tail(&zone->queries, &query->n);
+
+	return KNOT_EOK;
+}
+
+static void log_failed(poll_zone_t *zone, poll_master_t *master, int ret)
+{
+	char addr_str[SOCKADDR_STRLEN] = { 0 };
+	sockaddr_tostr(addr_str, sizeof(addr_str), &master->remote.addr);
+	log_zone_debug(zone->name, "refresh, remote %s, address %s, failed (%s)",
+	               master->name, addr_str, knot_strerror(ret));
+}
+
+/*! \brief Query the next master of the zone one by one. */
+static void polled_next(refresh_poll_t *poll, poll_zone_t *zone)
+{
+	while (zone->next < zone->count) {
+		poll_master_t *master = &zone->masters[zone->next++];
+		int ret = refresh_sched_acquire(global_refresh_sched, zone->name,
+		                                &master->remote.addr);
+		if (ret == KNOT_EBUSY) {
+			zone->busy = true;
+			continue;
+		} else if (ret == KNOT_EOK) {
+			ret = query_start(poll, zone, master);
+			if (ret == KNOT_EOK) {
+				return;
+			}
+			refresh_sched_release(global_refresh_sched, &master->remote.addr);
+		}
+		log_failed(zone, master, ret);
+	}
+}
+
+/*! \brief Query all masters of the zone at once, admitted all together. */
+static void polled_race(refresh_poll_t *poll, poll_zone_t *zone)
+{
+	for (size_t i = 0; i < zone->count; i++) {
+		int ret = refresh_sched_acquire(global_refresh_sched, zone->name,
+		                                &zone->masters[i].remote.addr);
+		if (ret != KNOT_EOK) {
+			while (i-- > 0) {
+				refresh_sched_release(global_refresh_sched,
+				                      &zone->masters[i].remote.addr);
+			}
+			zone->busy = (ret == KNOT_EBUSY);
+			return;
+		}
+	}
+
+	for (size_t i = 0; i < zone->count; i++) {
+		poll_master_t *master = &zone->masters[i];
+		int ret = query_start(poll, zone, master);
+		if (ret != KNOT_EOK) {
+			refresh_sched_release(global_refresh_sched, &master->remote.addr);
+			log_failed(zone, master, ret);
+		}
+	}
+}
+
+/*! \brief Warn about each remote none of whose addresses was usable. */
+static void log_unusable(poll_zone_t *zone)
+{
+	for (size_t i = 0; i < zone->count; i++) {
+		bool logged = false;
+		for (size_t j = 0; j < i && !logged; j++) {
+			logged = (strcmp(zone->masters[j].name, zone->masters[i].name) == 0);
+		}
+		if (!logged) {
+			log_zone_warning(zone->name, "refresh, remote %s not usable",
+			                 zone->masters[i].name);
+		}
+	}
+}
+
+static void polled_finish(refresh_poll_t *poll, poll_zone_t *zone)
+{
+	if (zone->renew) {
+		polled_reset(zone);
+		add_tail(&poll->queue, &zone->n);
+		return;
+	}
+
+	if (zone->best != NULL) {
+		zone->result.ret = KNOT_EOK;
+		zone->result.serial = zone->serial;
+		memcpy(&zone->result.remote, &zone->best->remote.addr,
+		       sizeof(zone->result.remote));
+	} else if (zone->busy) {
+		zone->result.ret = KNOT_EBUSY;
+	} else {
+		zone->result.ret = KNOT_ENOMASTER;
+		log_unusable(zone);
+	}
+	zone->state = POLL_DONE;
+	zone->done = poll_now();
+
+	// hand the result over to the refresh event
+	rcu_read_lock();
+	zone_t *zone_ptr = knot_zonedb_find(poll->server->zone_db, zone->name);
+	if (zone_ptr != NULL) {
+		zone_events_schedule_now(zone_ptr, ZONE_EVENT_REFRESH);
+	}
+	rcu_read_unlock();
+}
+
+static void polled_start(refresh_poll_t *poll, poll_zone_t *zone)
+{
+	zone->state = POLL_RUNNING;
+	if (zone->race) {
+		polled_race(poll, zone);
+	} else {
+		polled_next(poll, zone);
+	}
+
+	if (EMPTY_LIST(zone->queries)) {
+		polled_finish(poll, zone);
+	}
+}
+
+static void query_done(refresh_poll_t *poll, poll_query_t *query)
+{
+	poll_zone_t *zone = query->zone;
+	poll_master_t *master = query->master;
+	const struct sockaddr *remote = (struct sockaddr *)&master->remote.addr;
+
+	rem_node(&query->n);
+	refresh_sched_release(global_refresh_sched, &master->remote.addr);
+
+	if (query->slot.ret != KNOT_EOK) {
+		log_failed(zone, master, query->slot.ret);
+	} else if (zone->race) {
+		// the highest serial wins, the order of masters breaks ties
+		if (zone->best == NULL ||
+		    serial_compare(query->serial, zone->serial) == SERIAL_GREATER ||
+		    (query->serial == zone->serial && master < zone->best)) {
+			zone->best = master;
+			zone->serial = query->serial;
+		}
+		// give the others limited time
+		poll_query_t *other;
+		WALK_LIST(other, zone->queries) {
+			knot_request_loop_expire(poll->loop, &other->slot, POLL_GRACE_MS);
+		}
+	} else if (serial_compare(query->serial, zone->local_serial) & SERIAL_MASK_GEQ) {
+		zone->best = master;
+		zone->serial = query->serial;
+	} else {
+		POLL_LOG(LOG_INFO, zone->name, remote,
+		         "remote serial %u, master is outdated", query->serial);
+	}
+	query_free(query);
+
+	if (!EMPTY_LIST(zone->queries)) {
+		return;
+	}
+
+	if (zone->race && zone->best == NULL) {
+		// no usable answer, fall back to querying one by one
+		log_zone_debug(zone->name, "refresh, no master answered SOA query");
+		zone->race = false;
+		zone->next = 0;
+	}
+	if (!zone->race && zone->best == NULL) {
+		polled_next(poll, zone);
+	}
+	if (EMPTY_LIST(zone->queries)) {
+		polled_finish(poll, zone);
+	}
+}
+
+/*! \brief Drop results not taken by the refresh event, e.g. of a removed zone. */
+static void poll_sweep(refresh_poll_t *poll)
+{
+	time_t now = poll_now();
+	if (now - poll->swept < POLL_RESULT_STALE) {
+		return;
+	}
+	poll->swept = now;
+
+	list_t stale;
+	init_list(&stale);
+
+	trie_it_t *it = trie_it_begin(poll->zones);
+	for (; it != NULL && !trie_it_finished(it); trie_it_next(it)) {
+		poll_zone_t *zone = *trie_it_val(it);
+		if (zone->state == POLL_DONE && now - zone->done >= POLL_RESULT_STALE) {
+			add_tail(&stale, &zone->n);
+		}
+	}
+	trie_it_free(it);
+
+	poll_zone_t *zone, *next;
+	WALK_LIST_DELSAFE(zone, next, stale) {
+		trie_del(poll->zones, zone->name, knot_dname_size(zone->name), NULL);
+		polled_free(zone);
+	}
+}
+
+static void *poll_main(void *arg)
+{
+	refresh_poll_t *poll = arg;
+
+	rcu_register_thread();
+
+	pthread_mutex_lock(&poll->lock);
+	while (!poll->stop) {
+		// Start the queued zones within the limit of queries in progress.
+		while (!EMPTY_LIST(poll->queue) &&
+		       knot_request_loop_pending(poll->loop) < POLL_MAX_QUERIES) {
+			poll_zone_t *zone = HEAD(poll->queue);
+			rem_node(&zone->n);
+			polled_start(poll, zone);
+		}
+
+		poll_sweep(poll);
+
+		if (knot_request_loop_pending(poll->loop) == 0) {
+			if (EMPTY_LIST(poll->queue)) {
+				pthread_cond_wait(&poll->wake, &poll->lock);
+			}
+			continue;
+		}
+
+		// Submitting isn't blocked while waiting for the answers.
+		pthread_mutex_unlock(&poll->lock);
+		knot_request_slot_t *slot = knot_request_loop_next(poll->loop, POLL_WAIT_MS);
+		pthread_mutex_lock(&poll->lock);
+		while (slot != NULL) {
+			query_done(poll, (poll_query_t *)slot);
+			slot = knot_request_loop_next(poll->loop, 0);
+		}
+	}
+	pthread_mutex_unlock(&poll->lock);
+
+	rcu_unregister_thread();
+
+	return NULL;
+}
+
+static int free_zone(trie_val_t *val, void *ctx)
+{
+	poll_zone_t *zone = *val;
+
+	poll_query_t *query, *next;
+	WALK_LIST_DELSAFE(query, next, zone->queries) {
+		refresh_sched_release(global_refresh_sched, &query->master->remote.addr);
+		query_free(query);
+	}
+	polled_free(zone);
+
+	return KNOT_EOK;
+}
+
+refresh_poll_t *refresh_poll_init(struct server *server)
+{
+	if (server == NULL) {
+		return NULL;
+	}
+
+	refresh_poll_t *poll = calloc(1, sizeof(*poll));
+	if (poll == NULL) {
+		return NULL;
+	}
+
+	poll->server = server;
+	poll->swept = poll_now();
+	init_list(&poll->queue);
+	poll->zones = trie_create(NULL);
+	poll->loop = knot_request_loop_new();
+	if (poll->zones == NULL || poll->loop == NULL) {
+		trie_free(poll->zones);
+		knot_request_loop_free(poll->loop);
+		free(poll);
+		return NULL;
+	}
+
+	pthread_mutex_init(&poll->lock, NULL);
+	pthread_cond_init(&poll->wake, NULL);
+
+	if (pthread_create(&poll->thread, NULL, poll_main, poll) != 0) {
+		pthread_cond_destroy(&poll->wake);
+		pthread_mutex_destroy(&poll->lock);
+		trie_free(poll->zones);
+		knot_request_loop_free(poll->loop);
+		free(poll);
+		return NULL;
+	}
+
+	return poll;
+}
+
+void refresh_poll_deinit(refresh_poll_t *poll)
+{
+	if (poll == NULL) {
+		return;
+	}
+
+	pthread_mutex_lock(&poll->lock);
+	poll->stop = true;
+	pthread_cond_signal(&poll->wake);
+	pthread_mutex_unlock(&poll->lock);
+	pthread_join(poll->thread, NULL);
+
+	// The loop terminates the queries still in progress.
+	knot_request_loop_free(poll->loop);
+	trie_apply(poll->zones, free_zone, NULL);
+	trie_free(poll->zones);
+
+	pthread_cond_destroy(&poll->wake);
+	pthread_mutex_destroy(&poll->lock);
+	free(poll);
+}
+
+int refresh_poll_submit(refresh_poll_t *poll, conf_t *conf, zone_t *zone)
+{
+	if (poll == NULL || conf == NULL || zone == NULL) {
+		return KNOT_EINVAL;
+	}
+
+	uint32_t local_serial;
+	int ret = slave_zone_serial(zone, conf, &local_serial);
+	if (ret != KNOT_EOK) {
+		return ret;
+	}
+
+	pthread_mutex_lock(&poll->lock);
+
+	size_t name_len = knot_dname_size(zone->name);
+	trie_val_t *val = trie_get_ins(poll->zones, zone->name, name_len);
+	if (val == NULL) {
+		pthread_mutex_unlock(&poll->lock);
+		return KNOT_ENOMEM;
+	}
+
+	poll_zone_t *polled = *val;
+	if (polled != NULL && polled->state == POLL_QUEUED) {
+		pthread_mutex_unlock(&poll->lock);
+		return KNOT_EOK;
+	} else if (polled != NULL && polled->state == POLL_RUNNING) {
+		polled->renew = true;
+		pthread_mutex_unlock(&poll->lock);
+		return KNOT_EOK;
+	} else if (polled != NULL) {
+		// the unclaimed result is outdated
+		polled_free(polled);
+		*val = NULL;
+	}
+
+	polled = calloc(1, sizeof(*polled));
+	if (polled != NULL) {
+		polled->name = knot_dname_copy(zone->name, NULL);
+		ret = (polled->name != NULL) ? masters_init(polled, conf, zone) : KNOT_ENOMEM;
+	} else {
+		ret = KNOT_ENOMEM;
+	}
+	if (ret != KNOT_EOK) {
+		if (polled != NULL) {
+			free(polled->name);
+			free(polled);
+		}
+		trie_del(poll->zones, zone->name, name_len, NULL);
+		pthread_mutex_unlock(&poll->lock);
+		return ret;
+	}
+
+	conf_val_t race = conf_zone_get(conf, C_MASTER_RACE, zone->name);
+	polled->race_conf = conf_bool(&race) && polled->count > 1;
+	polled->local_serial = local_serial;
+	polled->timeout = conf->cache.srv_tcp_remote_io_timeout;
+	init_list(&polled->queries);
+	polled_reset(polled);
+
+	*val = polled;
+	add_tail(&poll->queue, &polled->n);
+	pthread_cond_signal(&poll->wake);
+
+	pthread_mutex_unlock(&poll->lock);
+
+	return KNOT_EOK;
+}
+
+bool refresh_poll_take(refresh_poll_t *poll, const knot_dname_t *zone,
+                       refresh_poll_result_t *result)
+{
+	if (poll == NULL || zone == NULL || result == NULL) {
+		return false;
+	}
+
+	pthread_mutex_lock(&poll->lock);
+
+	size_t name_len = knot_dname_size(zone);
+	trie_val_t *val = trie_get_try(poll->zones, zone, name_len);
+	poll_zone_t *polled = (val != NULL) ? *val : NULL;
+	if (polled == NULL || polled->state != POLL_DONE) {
+		pthread_mutex_unlock(&poll->lock);
+		return false;
+	}
+
+	*result = polled->result;
+	trie_del(poll->zones, zone, name_len, NULL);
+	polled_free(polled);
+
+	pthread_mutex_unlock(&poll->lock);
+
+	return true;
+}
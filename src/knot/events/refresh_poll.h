@@ -0,0 +1,105 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \brief SOA polling of zone masters.
+ *
+ * SOA queries of all refreshing zones are executed by one thread within
+ * a shared request loop, so that slow or unreachable masters don't occupy
+ * the worker threads. The queries to the same master are pipelined over
+ * one TCP connection. Once a zone is polled, its refresh event is planned
+ * again and picks the result up.
+ */
+
+#pragma once
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <sys/socket.h>
+
+#include "contrib/qp-trie/trie.h"
+#include "contrib/ucw/lists.h"
+#include "knot/conf/conf.h"
+#include "knot/query/requestor.h"
+#include "knot/zone/zone.h"
+
+struct server;
+
+typedef struct {
+	pthread_mutex_t lock;
+	pthread_cond_t wake;
+	pthread_t thread;
+	bool stop;
+
+	struct server *server;     /*!< Server with the polled zones. */
+	trie_t *zones;             /*!< Polled zones by name. */
+	list_t queue;              /*!< Zones waiting for the queries. */
+	knot_request_loop_t *loop; /*!< SOA queries in progress. */
+	time_t swept;              /*!< Last removal of unclaimed results. */
+} refresh_poll_t;
+
+typedef struct {
+	int ret;                          /*!< KNOT_EOK if a master answered. */
+	uint32_t serial;                  /*!< Serial of the master. */
+	struct sockaddr_storage remote;   /*!< Address of the master. */
+} refresh_poll_result_t;
+
+/*! \brief Server-wide SOA poller. */
+extern refresh_poll_t *global_refresh_poll;
+
+/*!
+ * \brief Create the SOA poller and start its thread.
+ *
+ * \param server  Server with the polled zones.
+ */
+refresh_poll_t *refresh_poll_init(struct server *server);
+
+/*!
+ * \brief Stop the SOA poller and free it, pending queries are dropped.
+ */
+void refresh_poll_deinit(refresh_poll_t *poll);
+
+/*!
+ * \brief Start polling masters of the zone.
+ *
+ * The preferred master is queried first. With master-race enabled, all
+ * masters are queried at once and the highest serial wins, if none of them
+ * answers, they are queried one by one. Otherwise the first master which
+ * answered with a serial not lower than the local one wins.
+ *
+ * Polling the zone again while its queries are in progress repeats them.
+ *
+ * \param poll  SOA poller.
+ * \param conf  Configuration.
+ * \param zone  Zone to be polled.
+ *
+ * \return KNOT_EOK if queued, or error
+ */
+int refresh_poll_submit(refresh_poll_t *poll, conf_t *conf, zone_t *zone);
+
+/*!
+ * \brief Take the polling result of the zone.
+ *
+ * \param poll    SOA poller.
+ * \param zone    Zone name.
+ * \param result  Polling result (output).
+ *
+ * \retval true   Result taken.
+ * \retval false  Zone not polled or polling not finished yet.
+ */
+bool refresh_poll_take(refresh_poll_t *poll, const knot_dname_t *zone,
+                       refresh_poll_result_t *result);
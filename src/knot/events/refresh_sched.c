@@ -0,0 +1,339 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "knot/events/refresh_sched.h"
+#include "libdnssec/random.h"
+#include "libknot/errcode.h"
+#include "contrib/macros.h"
+#include "contrib/sockaddr.h"
+#include "contrib/time.h"
+
+/*! \brief Minimal delay of a deferred refresh (seconds). */
+#define DEFER_MIN	1
+/*! \brief Maximal delay of a deferred refresh excluding jitter (seconds). */
+#define DEFER_MAX	30
+/*! \brief Time to expiration adding one second to the delay. */
+#define DEFER_SCALE	3600
+/*! \brief Deferred zones not retried within this time are forgotten. */
+#define BACKLOG_STALE	(4 * DEFER_MAX)
+/*! \brief Maximal length of the remote key (family, address, port). */
+#define REMOTE_KEY_MAX	(1 + 16 + 2)
+
+refresh_sched_t *global_refresh_sched = NULL;
+
+typedef struct {
+	time_t since;  /*!< First deferral of the zone. */
+	time_t last;   /*!< Last deferral of the zone. */
+} backlog_entry_t;
+
+static time_t sched_now(void)
+{
+	return time_now().tv_sec;
+}
+
+static size_t remote_key(const struct sockaddr_storage *remote,
+                         uint8_t key[REMOTE_KEY_MAX])
+{
+	size_t addr_len = 0;
+	const uint8_t *addr = sockaddr_raw(remote, &addr_len);
+	if (addr == NULL || addr_len > 16) {
+		addr_len = 0;
+	}
+
+	uint16_t port = sockaddr_port(remote);
+
+	key[0] = remote->ss_family;
+	if (addr_len > 0) {
+		memcpy(key + 1, addr, addr_len);
+	}
+	memcpy(key + 1 + addr_len, &port, sizeof(port));
+
+	return 1 + addr_len + sizeof(port);
+}
+
+/*! \brief Drop rate counters of the seconds passed since the last update. */
+static void rate_advance(refresh_sched_t *sched, time_t now)
+{
+	if (now - sched->rate_last >= REFRESH_RATE_WINDOW) {
+		memset(sched->rate, 0, sizeof(sched->rate));
+	} else {
+		for (time_t t = sched->rate_last + 1; t <= now; t++) {
+			sched->rate[t % REFRESH_RATE_WINDOW] = 0;
+		}
+	}
+	sched->rate_last = MAX(sched->rate_last, now);
+}
+
+static void backlog_remove(refresh_sched_t *sched, const knot_dname_t *zone)
+{
+	trie_val_t val = NULL;
+	if (trie_del(sched->backlog, zone, knot_dname_size(zone), &val) == KNOT_EOK) {
+		free(val);
+	}
+}
+
+/*! \brief Forget deferred zones which stopped retrying (e.g. removed). */
+static void backlog_sweep(refresh_sched_t *sched, time_t now)
+{
+	size_t stale_count = 0;
+	knot_dname_t **stale = NULL;
+
+	trie_it_t *it = trie_it_begin(sched->backlog);
+	for (; it != NULL && !trie_it_finished(it); trie_it_next(it)) {
+		backlog_entry_t *entry = *trie_it_val(it);
+		if (now - entry->last <= BACKLOG_STALE) {
+			continue;
+		}
+		if (stale_count % 64 == 0) {
+			void *tmp = realloc(stale, (stale_count + 64) * sizeof(*stale));
+			if (tmp == NULL) {
+				break;
+			}
+			stale = tmp;
+		}
+		size_t len = 0;
+		const knot_dname_t *name = (const knot_dname_t *)trie_it_key(it, &len);
+		stale[stale_count] = knot_dname_copy(name, NULL);
+		if (stale[stale_count] == NULL) {
+			break;
+		}
+		stale_count++;
+	}
+	trie_it_free(it);
+
+	for (size_t i = 0; i < stale_count; i++) {
+		backlog_remove(sched, stale[i]);
+		knot_dname_free(stale[i], NULL);
+	}
+	free(stale);
+}
+
+static int free_entry(trie_val_t *val, void *ctx)
+{
+	free(*val);
+	return KNOT_EOK;
+}
+
+refresh_sched_t *refresh_sched_init(void)
+{
+	refresh_sched_t *sched = calloc(1, sizeof(*sched));
+	if (sched == NULL) {
+		return NULL;
+	}
+
+	sched->remotes = trie_create(NULL);
+	sched->backlog = trie_create(NULL);
+	if (sched->remotes == NULL || sched->backlog == NULL ||
+	    pthread_mutex_init(&sched->lock, NULL) != 0) {
+		trie_free(sched->remotes);
+		trie_free(sched->backlog);
+		free(sched);
+		return NULL;
+	}
+
+	sched->rate_last = sched_now();
+
+	return sched;
+}
+
+void refresh_sched_deinit(refresh_sched_t *sched)
+{
+	if (sched == NULL) {
+		return;
+	}
+
+	trie_apply(sched->backlog, free_entry, NULL);
+	trie_free(sched->backlog);
+	trie_free(sched->remotes);
+	pthread_mutex_destroy(&sched->lock);
+	free(sched);
+}
+
+void refresh_sched_set(refresh_sched_t *sched, size_t limit,
+                       size_t remote_limit, unsigned jitter)
+{
+	if (sched == NULL) {
+		return;
+	}
+
+	pthread_mutex_lock(&sched->lock);
+	sched->limit = limit;
+	sched->remote_limit = remote_limit;
+	sched->jitter = jitter;
+	pthread_mutex_unlock(&sched->lock);
+}
+
+int refresh_sched_acquire(refresh_sched_t *sched, const knot_dname_t *zone,
+                          const struct sockaddr_storage *remote)
+{
+	if (sched == NULL) {
+		return KNOT_EOK;
+	}
+
+	uint8_t key[REMOTE_KEY_MAX];
+	size_t key_len = remote_key(remote, key);
+
+	pthread_mutex_lock(&sched->lock);
+
+	if (sched->limit > 0 && sched->running >= sched->limit) {
+		pthread_mutex_unlock(&sched->lock);
+		return KNOT_EBUSY;
+	}
+
+	trie_val_t *count = trie_get_ins(sched->remotes, key, key_len);
+	if (count == NULL) {
+		pthread_mutex_unlock(&sched->lock);
+		return KNOT_ENOMEM;
+	}
+	if (sched->remote_limit > 0 && (uintptr_t)*count >= sched->remote_limit) {
+		pthread_mutex_unlock(&sched->lock);
+		return KNOT_EBUSY;
+	}
+
+	*count = (trie_val_t)((uintptr_t)*count + 1);
+	sched->running++;
+	sched->started++;
+	backlog_remove(sched, zone);
+
+	pthread_mutex_unlock(&sched->lock);
+
+	return KNOT_EOK;
+}
+
+void refresh_sched_release(refresh_sched_t *sched,
+                           const struct sockaddr_storage *remote)
+{
+	if (sched == NULL) {
+		return;
+	}
+
+	uint8_t key[REMOTE_KEY_MAX];
+	size_t key_len = remote_key(remote, key);
+	time_t now = sched_now();
+
+	pthread_mutex_lock(&sched->lock);
+
+	trie_val_t *count = trie_get_try(sched->remotes, key, key_len);
+	if (count != NULL && (uintptr_t)*count > 1) {
+		*count = (trie_val_t)((uintptr_t)*count - 1);
+	} else if (count != NULL) {
+		trie_del(sched->remotes, key, key_len, NULL);
+	}
+	if (sched->running > 0) {
+		sched->running--;
+	}
+
+	rate_advance(sched, now);
+	sched->rate[now % REFRESH_RATE_WINDOW]++;
+
+	pthread_mutex_unlock(&sched->lock);
+}
+
+time_t refresh_sched_defer(refresh_sched_t *sched, const knot_dname_t *zone,
+                           time_t expires)
+{
+	time_t now = time(NULL);
+
+	if (sched != NULL) {
+		time_t mono = sched_now();
+
+		pthread_mutex_lock(&sched->lock);
+		sched->deferred++;
+		trie_val_t *val = trie_get_ins(sched->backlog, zone, knot_dname_size(zone));
+		if (val != NULL && *val == NULL) {
+			backlog_entry_t *entry = malloc(sizeof(*entry));
+			if (entry != NULL) {
+				entry->since = mono;
+				*val = entry;
+			} else {
+				trie_del(sched->backlog, zone, knot_dname_size(zone), NULL);
+				val = NULL;
+			}
+		}
+		if (val != NULL) {
+			((backlog_entry_t *)*val)->last = mono;
+		}
+		if (sched->deferred % 4096 == 0) {
+			backlog_sweep(sched, mono);
+		}
+		pthread_mutex_unlock(&sched->lock);
+	}
+
+	// zones closer to expiration (or not bootstrapped yet) retry sooner
+	time_t left = (expires > now) ? expires - now : 0;
+	time_t delay = DEFER_MIN + MIN(left / DEFER_SCALE, DEFER_MAX);
+	delay += dnssec_random_uint16_t() % (delay / 2 + 1);
+
+	return now + delay;
+}
+
+time_t refresh_sched_spread(refresh_sched_t *sched, time_t refresh)
+{
+	if (sched == NULL || refresh <= 0) {
+		return refresh;
+	}
+
+	pthread_mutex_lock(&sched->lock);
+	unsigned jitter = sched->jitter;
+	pthread_mutex_unlock(&sched->lock);
+
+	time_t now = time(NULL);
+	if (jitter == 0 || refresh > now) {
+		return refresh;
+	}
+
+	return now + dnssec_random_uint32_t() % (jitter + 1);
+}
+
+void refresh_sched_stats(refresh_sched_t *sched, refresh_sched_stats_t *stats)
+{
+	memset(stats, 0, sizeof(*stats));
+	if (sched == NULL) {
+		return;
+	}
+
+	time_t now = sched_now();
+
+	pthread_mutex_lock(&sched->lock);
+
+	backlog_sweep(sched, now);
+	rate_advance(sched, now);
+
+	stats->running = sched->running;
+	stats->limit = sched->limit;
+	stats->remote_limit = sched->remote_limit;
+	stats->backlog = trie_weight(sched->backlog);
+	stats->started = sched->started;
+	stats->deferred = sched->deferred;
+
+	trie_it_t *it = trie_it_begin(sched->backlog);
+	for (; it != NULL && !trie_it_finished(it); trie_it_next(it)) {
+		backlog_entry_t *entry = *trie_it_val(it);
+		stats->oldest_wait = MAX(stats->oldest_wait, now - entry->since);
+	}
+	trie_it_free(it);
+
+	uint64_t finished = 0;
+	for (int i = 0; i < REFRESH_RATE_WINDOW; i++) {
+		finished += sched->rate[i];
+	}
+	stats->rate = (double)finished / REFRESH_RATE_WINDOW;
+
+	pthread_mutex_unlock(&sched->lock);
+}
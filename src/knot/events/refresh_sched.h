@@ -0,0 +1,133 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \brief Admission control of zone refreshes.
+ *
+ * Limits the number of refreshes (SOA query and transfer) running at once,
+ * both globally and per remote server. Refreshes over the limit are deferred
+ * for a while, zones closer to expiration are retried sooner.
+ */
+
+#pragma once
+
+#include <pthread.h>
+#include <stdint.h>
+#include <sys/socket.h>
+#include <time.h>
+
+#include "contrib/qp-trie/trie.h"
+#include "libknot/dname.h"
+
+/*! \brief Length of the catch-up rate window (seconds). */
+#define REFRESH_RATE_WINDOW 60
+
+typedef struct {
+	pthread_mutex_t lock;
+	size_t limit;         /*!< Maximum of running refreshes (0 unlimited). */
+	size_t remote_limit;  /*!< Maximum per remote server (0 unlimited). */
+	unsigned jitter;      /*!< Spread of overdue refreshes (seconds). */
+
+	size_t running;       /*!< Number of running refreshes. */
+	trie_t *remotes;      /*!< Running refreshes per remote address. */
+	trie_t *backlog;      /*!< Deferred zones by name. */
+
+	uint64_t started;     /*!< Total of admitted refreshes. */
+	uint64_t deferred;    /*!< Total of deferrals. */
+	uint32_t rate[REFRESH_RATE_WINDOW]; /*!< Finished refreshes per second. */
+	time_t rate_last;     /*!< Second of the last rate update. */
+} refresh_sched_t;
+
+typedef struct {
+	size_t running;       /*!< Number of running refreshes. */
+	size_t limit;         /*!< Global limit. */
+	size_t remote_limit;  /*!< Per remote limit. */
+	size_t backlog;       /*!< Number of deferred zones waiting. */
+	time_t oldest_wait;   /*!< Longest wait of a deferred zone (seconds). */
+	uint64_t started;     /*!< Total of admitted refreshes. */
+	uint64_t deferred;    /*!< Total of deferrals. */
+	double rate;          /*!< Finished refreshes per second (recent). */
+} refresh_sched_stats_t;
+
+/*! \brief Server-wide refresh scheduler. */
+extern refresh_sched_t *global_refresh_sched;
+
+/*!
+ * \brief Create a refresh scheduler without limits.
+ */
+refresh_sched_t *refresh_sched_init(void);
+
+/*!
+ * \brief Free the refresh scheduler.
+ */
+void refresh_sched_deinit(refresh_sched_t *sched);
+
+/*!
+ * \brief Set refresh limits.
+ *
+ * \param sched         Refresh scheduler.
+ * \param limit         Maximum of running refreshes (0 for unlimited).
+ * \param remote_limit  Maximum of running refreshes per remote (0 for unlimited).
+ * \param jitter        Spread of overdue refreshes in seconds.
+ */
+void refresh_sched_set(refresh_sched_t *sched, size_t limit,
+                       size_t remote_limit, unsigned jitter);
+
+/*!
+ * \brief Try to start a refresh of the zone from the remote.
+ *
+ * \param sched   Refresh scheduler (NULL for no limits).
+ * \param zone    Zone name.
+ * \param remote  Remote address.
+ *
+ * \retval KNOT_EOK    Refresh admitted, must be finished by refresh_sched_release().
+ * \retval KNOT_EBUSY  Limit reached.
+ */
+int refresh_sched_acquire(refresh_sched_t *sched, const knot_dname_t *zone,
+                          const struct sockaddr_storage *remote);
+
+/*!
+ * \brief Finish a refresh admitted by refresh_sched_acquire().
+ */
+void refresh_sched_release(refresh_sched_t *sched,
+                           const struct sockaddr_storage *remote);
+
+/*!
+ * \brief Record a deferred zone refresh and get its retry time.
+ *
+ * \param sched    Refresh scheduler.
+ * \param zone     Zone name.
+ * \param expires  Zone expiration time (0 if not loaded or not expiring).
+ *
+ * \return Time of the next refresh attempt.
+ */
+time_t refresh_sched_defer(refresh_sched_t *sched, const knot_dname_t *zone,
+                           time_t expires);
+
+/*!
+ * \brief Spread an overdue refresh time over the configured jitter.
+ *
+ * \param sched    Refresh scheduler (NULL for no jitter).
+ * \param refresh  Planned refresh time.
+ *
+ * \return Adjusted refresh time.
+ */
+time_t refresh_sched_spread(refresh_sched_t *sched, time_t refresh);
+
+/*!
+ * \brief Get refresh scheduler statistics.
+ */
+void refresh_sched_stats(refresh_sched_t *sched, refresh_sched_stats_t *stats);
@@ -16,6 +16,7 @@
 
 #include <assert.h>
 
+#include "knot/events/refresh_sched.h"
 #include "knot/events/replan.h"
 
 #define TIME_CANCEL 0
@@ -96,6 +97,8 @@ void replan_from_timers(conf_t *conf, zone_t *zone)
 	if (zone_is_slave(conf, zone)) {
 		refresh = zone->timers.next_refresh;
 		assert(refresh > 0);
+		// spread overdue refreshes, e.g. after a restart
+		refresh = refresh_sched_spread(global_refresh_sched, refresh);
 	}
 
 	time_t expire_pre = TIME_IGNORE;
@@ -379,6 +379,7 @@ typedef enum {
 	KNOTD_QUERY_FLAG_LIMIT_ANY  = 1 << 2, /*!< Limit ANY QTYPE (respond with TC=1). */
 	KNOTD_QUERY_FLAG_LIMIT_SIZE = 1 << 3, /*!< Apply UDP size limit. */
 	KNOTD_QUERY_FLAG_COOKIE     = 1 << 4, /*!< Valid DNS Cookie indication. */
+	KNOTD_QUERY_FLAG_KEEPALIVE  = 1 << 5, /*!< Advertise EDNS TCP keepalive. */
 } knotd_query_flag_t;
 
 /*! Query processing data context parameters. */
@@ -388,11 +389,14 @@ typedef struct {
 	int socket;                            /*!< Current network socket. */
 	unsigned thread_id;                    /*!< Current thread id. */
 	void *server;                          /*!< Server object private item. */
+	uint16_t keepalive;                    /*!< TCP idle timeout to advertise (in 100 ms units). */
+	const void *prefetch;                  /*!< Prefetched lookups, server private item. */
+	void *batch;                           /*!< Batch hooks queue, server private item. */
 } knotd_qdata_params_t;
 
 /*! Query processing data context. */
 typedef struct {
-	knot_pkt_t *query;              /*!< Query to be solved. */
+	knot_pkt_t *query;              /*!< Query to be solved (see knot_pkt_parse_sections). */
 	knotd_query_type_t type;        /*!< Query packet type. */
 	const knot_dname_t *name;       /*!< Currently processed name. */
 	uint16_t rcode;                 /*!< Resulting RCODE (Whole extended RCODE). */
@@ -484,6 +488,23 @@ typedef knotd_state_t (*knotd_mod_hook_f)
 typedef knotd_in_state_t (*knotd_mod_in_hook_f)
 	(knotd_in_state_t state, knot_pkt_t *pkt, knotd_qdata_t *qdata, knotd_mod_t *mod);
 
+/*! Answered query passed to a batch processing hook. */
+typedef struct {
+	knotd_state_t state;  /*!< Final processing state. */
+	knot_pkt_t *pkt;      /*!< Response packet. */
+	knotd_qdata_t *qdata; /*!< Query data. */
+} knotd_batch_query_t;
+
+/*!
+ * Batch processing hook.
+ *
+ * \param[in] queries  Answered queries.
+ * \param[in] count    Number of the queries.
+ * \param[in] mod      Module context.
+ */
+typedef void (*knotd_mod_batch_hook_f)
+	(const knotd_batch_query_t *queries, unsigned count, knotd_mod_t *mod);
+
 /*!
  * Registers general processing module hook.
  *
@@ -506,6 +527,21 @@ int knotd_mod_hook(knotd_mod_t *mod, knotd_stage_t stage, knotd_mod_hook_f hook)
  */
 int knotd_mod_in_hook(knotd_mod_t *mod, knotd_stage_t stage, knotd_mod_in_hook_f hook);
 
+/*!
+ * Registers batch processing module hook.
+ *
+ * The hook is called after the KNOTD_STAGE_END stage once for all queries
+ * answered in one I/O batch (e.g. UDP recvmmsg), or for each query if not
+ * batched. The queries and responses must not be modified and the query
+ * processing extension (e.g. transfer state) is not available.
+ *
+ * \param[in] mod   Module context.
+ * \param[in] hook  Module hook.
+ *
+ * \return Error code, KNOT_EOK if success.
+ */
+int knotd_mod_batch_hook(knotd_mod_t *mod, knotd_mod_batch_hook_f hook);
+
 /*** DNSSEC API. ***/
 
 /*!
@@ -14,12 +14,18 @@
     along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+
 #include "knot/journal/journal_basic.h"
 
 #include "knot/conf/conf.h"
 #include "knot/journal/journal_metadata.h"
 #include "libknot/error.h"
 
+#define ZSTD_LEVEL 1
+
 MDB_val journal_changeset_id_to_key(bool zone_in_journal, uint32_t serial, const knot_dname_t *zone)
 {
 	if (zone_in_journal) {
@@ -38,11 +44,58 @@ MDB_val journal_changeset_to_chunk_key(const changeset_t *ch, uint32_t chunk_id)
 	}
 }
 
-void journal_make_header(void *chunk, uint32_t ch_serial_to)
+void journal_make_header(void *chunk, uint32_t ch_serial_to, uint32_t codec, uint32_t raw_size)
 {
-	knot_lmdb_make_key_part(chunk, JOURNAL_HEADER_SIZE, "IILLL", ch_serial_to,
+	knot_lmdb_make_key_part(chunk, JOURNAL_HEADER_SIZE, "IIIILL", ch_serial_to,
 	                        (uint32_t)0 /* we no longer care for # of chunks */,
-	                        (uint64_t)0, (uint64_t)0, (uint64_t)0);
+	                        codec, raw_size, (uint64_t)0, (uint64_t)0);
+}
+
+uint32_t journal_chunk_codec(const MDB_val *chunk, uint32_t *raw_size)
+{
+	const uint32_t *header = chunk->mv_data;
+	*raw_size = be32toh(header[3]);
+	return be32toh(header[2]);
+}
+
+size_t journal_compress(uint32_t codec, void *dst, size_t dst_size,
+                        const void *src, size_t src_size)
+{
+	switch (codec) {
+#ifdef HAVE_ZSTD
+	case JOURNAL_COMPRESSION_ZSTD:;
+		size_t ret = ZSTD_compress(dst, dst_size, src, src_size, ZSTD_LEVEL);
+		return ZSTD_isError(ret) ? 0 : ret;
+#endif
+	default:
+		return 0;
+	}
+}
+
+size_t journal_compress_bound(uint32_t codec, size_t src_size)
+{
+	switch (codec) {
+#ifdef HAVE_ZSTD
+	case JOURNAL_COMPRESSION_ZSTD:
+		return ZSTD_compressBound(src_size);
+#endif
+	default:
+		return src_size;
+	}
+}
+
+int journal_decompress(uint32_t codec, void *dst, size_t dst_size,
+                       const void *src, size_t src_size)
+{
+	switch (codec) {
+#ifdef HAVE_ZSTD
+	case JOURNAL_COMPRESSION_ZSTD:;
+		size_t ret = ZSTD_decompress(dst, dst_size, src, src_size);
+		return (ZSTD_isError(ret) || ret != dst_size) ? KNOT_EMALF : KNOT_EOK;
+#endif
+	default:
+		return KNOT_ENOTSUP;
+	}
 }
 
 uint32_t journal_next_serial(const MDB_val *chunk)
@@ -77,6 +130,12 @@ size_t journal_conf_max_usage(zone_journal_t j)
 	return conf_int(&val);
 }
 
+uint32_t journal_conf_compression(const knot_dname_t *zone)
+{
+	conf_val_t val = conf_zone_get(conf(), C_JOURNAL_COMPRESSION, zone);
+	return conf_opt(&val);
+}
+
 size_t journal_conf_max_changesets(zone_journal_t j)
 {
 	conf_val_t val = conf_zone_get(conf(), C_JOURNAL_MAX_DEPTH, j.zone);
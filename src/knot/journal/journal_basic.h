@@ -32,7 +32,14 @@ typedef struct {
 /*! \brief Convert journal_mode to LMDB environment flags. */
 inline static unsigned journal_env_flags(int journal_mode)
 {
-	return journal_mode == JOURNAL_MODE_ASYNC ? (MDB_WRITEMAP | MDB_MAPASYNC) : 0;
+	switch (journal_mode) {
+	case JOURNAL_MODE_ASYNC:
+		return MDB_WRITEMAP | MDB_MAPASYNC;
+	case JOURNAL_MODE_GROUP:
+		return MDB_NOSYNC;
+	default:
+		return 0;
+	}
 }
 
 /*!
@@ -59,10 +66,53 @@ MDB_val journal_changeset_to_chunk_key(const changeset_t *ch, uint32_t chunk_id)
 /*!
  * \brief Initialise chunk header.
  *
- * \param chunk   Pointer to the changeset chunk. It must be at least JOURNAL_HEADER_SIZE, perhaps more.
- * \param ch      Serial-to of the changeset being serialized.
+ * \param chunk      Pointer to the changeset chunk. It must be at least JOURNAL_HEADER_SIZE, perhaps more.
+ * \param ch         Serial-to of the changeset being serialized.
+ * \param codec      Compression of the chunk data (JOURNAL_COMPRESSION_*).
+ * \param raw_size   Size of the chunk data before compression.
  */
-void journal_make_header(void *chunk, uint32_t ch_serial_to);
+void journal_make_header(void *chunk, uint32_t ch_serial_to, uint32_t codec, uint32_t raw_size);
+
+/*!
+ * \brief Obtain compression of the chunk data.
+ *
+ * \param chunk      Any chunk of a serialized changeset.
+ * \param raw_size   Output: size of the chunk data before compression.
+ *
+ * \return JOURNAL_COMPRESSION_* of the chunk.
+ */
+uint32_t journal_chunk_codec(const MDB_val *chunk, uint32_t *raw_size);
+
+/*!
+ * \brief Compress chunk data.
+ *
+ * \param codec      Compression to be used (JOURNAL_COMPRESSION_*).
+ * \param dst        Output buffer of at least journal_compress_bound() size.
+ * \param dst_size   Output buffer size.
+ * \param src        Chunk data.
+ * \param src_size   Chunk data size.
+ *
+ * \return Compressed size, 0 if the data can't be compressed.
+ */
+size_t journal_compress(uint32_t codec, void *dst, size_t dst_size,
+                        const void *src, size_t src_size);
+
+/*! \brief Return output buffer size needed for compressing 'src_size' data. */
+size_t journal_compress_bound(uint32_t codec, size_t src_size);
+
+/*!
+ * \brief Decompress chunk data.
+ *
+ * \param codec      Compression of the chunk data (JOURNAL_COMPRESSION_*).
+ * \param dst        Output buffer.
+ * \param dst_size   Expected size of the decompressed data.
+ * \param src        Compressed chunk data.
+ * \param src_size   Compressed chunk data size.
+ *
+ * \return KNOT_E*
+ */
+int journal_decompress(uint32_t codec, void *dst, size_t dst_size,
+                       const void *src, size_t src_size);
 
 /*!
  * \brief Obtain serial-to of the serialized changeset.
@@ -101,3 +151,6 @@ size_t journal_conf_max_usage(zone_journal_t j);
 
 /*! \brief Return configured maximal depth of journal. */
 size_t journal_conf_max_changesets(zone_journal_t j);
+
+/*! \brief Return configured compression of journal chunks. */
+uint32_t journal_conf_compression(const knot_dname_t *zone);
@@ -357,7 +357,7 @@ int journal_info(zone_journal_t j, bool *exists, uint32_t *first_serial, bool *h
 	return txn.ret;
 }
 
-int journals_walk(knot_lmdb_db_t *db, journals_walk_cb_t cb, void *ctx)
+static int journals_walk_shard(knot_lmdb_db_t *db, journals_walk_cb_t cb, void *ctx)
 {
 	if (!knot_lmdb_exists(db)) {
 		return KNOT_EOK;
@@ -386,3 +386,12 @@ int journals_walk(knot_lmdb_db_t *db, journals_walk_cb_t cb, void *ctx)
 	knot_lmdb_abort(&txn);
 	return txn.ret;
 }
+
+int journals_walk(knot_lmdb_shards_t *dbs, journals_walk_cb_t cb, void *ctx)
+{
+	int ret = KNOT_EOK;
+	for (unsigned i = 0; i < dbs->count && ret == KNOT_EOK; i++) {
+		ret = journals_walk_shard(&dbs->shards[i], cb, ctx);
+	}
+	return ret;
+}
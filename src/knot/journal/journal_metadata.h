@@ -158,10 +158,10 @@ inline static bool journal_is_existing(zone_journal_t j) {
 /*!
  * \brief Call a function for each zone being in the journal DB.
  *
- * \param db    Journal database.
+ * \param dbs   Journal database shards.
  * \param cb    Callback to be called for each zone-name found.
  * \param ctx   Arbitrary context to be passed to the callback.
  *
  * \return An error code from either journal operations or from the callback.
  */
-int journals_walk(knot_lmdb_db_t *db, journals_walk_cb_t cb, void *ctx);
+int journals_walk(knot_lmdb_shards_t *dbs, journals_walk_cb_t cb, void *ctx);
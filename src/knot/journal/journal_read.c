@@ -32,6 +32,8 @@ struct journal_read {
 	const knot_dname_t *zone;
 	wire_ctx_t wire;
 	uint32_t next;
+	uint8_t *unpacked;       // decompressed data of current chunk
+	size_t unpacked_max;     // allocated size of 'unpacked'
 };
 
 int journal_read_get_error(const journal_read_t *ctx, int another_error)
@@ -39,10 +41,34 @@ int journal_read_get_error(const journal_read_t *ctx, int another_error)
 	return (ctx == NULL || ctx->txn.ret == KNOT_EOK ? another_error : ctx->txn.ret);
 }
 
-static void update_ctx_wire(journal_read_t *ctx)
+static bool update_ctx_wire(journal_read_t *ctx)
 {
-	ctx->wire = wire_ctx_init_const(ctx->txn.cur_val.mv_data, ctx->txn.cur_val.mv_size);
-	wire_ctx_skip(&ctx->wire, JOURNAL_HEADER_SIZE);
+	uint32_t raw_size = 0;
+	uint32_t codec = journal_chunk_codec(&ctx->txn.cur_val, &raw_size);
+	if (codec == JOURNAL_COMPRESSION_NONE) {
+		ctx->wire = wire_ctx_init_const(ctx->txn.cur_val.mv_data, ctx->txn.cur_val.mv_size);
+		wire_ctx_skip(&ctx->wire, JOURNAL_HEADER_SIZE);
+		return true;
+	}
+
+	if (raw_size > ctx->unpacked_max) {
+		free(ctx->unpacked);
+		ctx->unpacked = malloc(raw_size);
+		ctx->unpacked_max = (ctx->unpacked == NULL ? 0 : raw_size);
+		if (ctx->unpacked == NULL) {
+			ctx->txn.ret = KNOT_ENOMEM;
+			return false;
+		}
+	}
+
+	ctx->txn.ret = journal_decompress(codec, ctx->unpacked, raw_size,
+	                                  ctx->txn.cur_val.mv_data + JOURNAL_HEADER_SIZE,
+	                                  ctx->txn.cur_val.mv_size - JOURNAL_HEADER_SIZE);
+	if (ctx->txn.ret != KNOT_EOK) {
+		return false;
+	}
+	ctx->wire = wire_ctx_init_const(ctx->unpacked, raw_size);
+	return true;
 }
 
 static bool go_next_changeset(journal_read_t *ctx, bool go_zone, const knot_dname_t *zone)
@@ -57,8 +83,7 @@ static bool go_next_changeset(journal_read_t *ctx, bool go_zone, const knot_dnam
 		return false;
 	}
 	ctx->next = journal_next_serial(&ctx->txn.cur_val);
-	update_ctx_wire(ctx);
-	return true;
+	return update_ctx_wire(ctx);
 }
 
 int journal_read_begin(zone_journal_t j, bool read_zone, uint32_t serial_from, journal_read_t **ctx)
@@ -91,6 +116,7 @@ void journal_read_end(journal_read_t *ctx)
 {
 	if (ctx != NULL) {
 		free(ctx->key_prefix.mv_data);
+		free(ctx->unpacked);
 		knot_lmdb_abort(&ctx->txn);
 		free(ctx);
 	}
@@ -105,7 +131,7 @@ static bool make_data_available(journal_read_t *ctx)
 		if (!knot_lmdb_is_prefix_of(&ctx->key_prefix, &ctx->txn.cur_key)) {
 			return false;
 		}
-		update_ctx_wire(ctx);
+		return update_ctx_wire(ctx);
 	}
 	return true;
 }
@@ -26,21 +26,56 @@ static void journal_write_serialize(knot_lmdb_txn_t *txn, serialize_ctx_t *ser,
 {
 	MDB_val chunk;
 	uint32_t i = 0;
+
+	// with compression, each chunk is serialized aside and compressed into LMDB
+	uint32_t codec = journal_conf_compression(ch->add->apex->owner);
+	uint8_t *raw = NULL, *packed = NULL;
+	size_t packed_max = journal_compress_bound(codec, JOURNAL_CHUNK_MAX - JOURNAL_HEADER_SIZE);
+	if (codec != JOURNAL_COMPRESSION_NONE) {
+		raw = malloc(JOURNAL_CHUNK_MAX - JOURNAL_HEADER_SIZE);
+		packed = malloc(packed_max);
+		if (raw == NULL || packed == NULL) {
+			txn->ret = KNOT_ENOMEM;
+		}
+	}
+
 	while (serialize_unfinished(ser) && txn->ret == KNOT_EOK) {
-		serialize_prepare(ser, JOURNAL_CHUNK_MAX - JOURNAL_HEADER_SIZE, &chunk.mv_size);
-		if (chunk.mv_size == 0) {
+		size_t raw_size;
+		serialize_prepare(ser, JOURNAL_CHUNK_MAX - JOURNAL_HEADER_SIZE, &raw_size);
+		if (raw_size == 0) {
 			break; // beware! If this is ommited, it creates empty chunk => EMALF when reading.
 		}
-		chunk.mv_size += JOURNAL_HEADER_SIZE;
+
+		uint32_t chunk_codec = JOURNAL_COMPRESSION_NONE;
+		size_t packed_size = 0;
+		if (raw != NULL) {
+			serialize_chunk(ser, raw, raw_size);
+			packed_size = journal_compress(codec, packed, packed_max, raw, raw_size);
+			if (packed_size > 0 && packed_size < raw_size) {
+				chunk_codec = codec;
+			}
+		}
+
+		chunk.mv_size = JOURNAL_HEADER_SIZE +
+		                (chunk_codec == JOURNAL_COMPRESSION_NONE ? raw_size : packed_size);
 		chunk.mv_data = NULL;
 		MDB_val key = journal_changeset_to_chunk_key(ch, i);
 		if (knot_lmdb_insert(txn, &key, &chunk)) {
-			journal_make_header(chunk.mv_data, ch_serial_to);
-			serialize_chunk(ser, chunk.mv_data + JOURNAL_HEADER_SIZE, chunk.mv_size - JOURNAL_HEADER_SIZE);
+			journal_make_header(chunk.mv_data, ch_serial_to, chunk_codec, raw_size);
+			uint8_t *data = chunk.mv_data + JOURNAL_HEADER_SIZE;
+			if (chunk_codec != JOURNAL_COMPRESSION_NONE) {
+				memcpy(data, packed, packed_size);
+			} else if (raw != NULL) {
+				memcpy(data, raw, raw_size);
+			} else {
+				serialize_chunk(ser, data, raw_size);
+			}
 		}
 		free(key.mv_data);
 		i++;
 	}
+	free(raw);
+	free(packed);
 	serialize_deinit(ser);
 	// return value is in the txn
 }
@@ -16,12 +16,16 @@
 
 #include "knot/journal/knot_lmdb.h"
 
+#include <dirent.h>
 #include <stdarg.h>
 #include <stdio.h> // snprintf
 #include <stdlib.h>
 #include <sys/stat.h>
+#include <time.h>
 #include <unistd.h>
 
+#include "contrib/files.h"
+#include "contrib/tolower.h"
 #include "contrib/wire_ctx.h"
 #include "libknot/dname.h"
 #include "libknot/endian.h"
@@ -30,6 +34,8 @@
 #define LMDB_DIR_MODE   0770
 #define LMDB_FILE_MODE  0660
 
+#define LMDB_SYNC_WINDOW_MS 100
+
 static void err_to_knot(int *err)
 {
 	switch (*err) {
@@ -79,6 +85,7 @@ void knot_lmdb_init(knot_lmdb_db_t *db, const char *path, size_t mapsize, unsign
 	pthread_mutex_init(&db->opening_mutex, NULL);
 	db->maxdbs = 2;
 	db->maxreaders = 126/* = contrib/lmdb/mdb.c DEFAULT_READERS */;
+	db->syncer = NULL;
 }
 
 static bool lmdb_stat(const char *lmdb_path, struct stat *st)
@@ -113,6 +120,147 @@ static int fix_mapsize(knot_lmdb_db_t *db)
 	return KNOT_EOK;
 }
 
+struct knot_lmdb_syncer {
+	pthread_t thread;
+	pthread_mutex_t mutex;
+	pthread_cond_t wake;    // syncer: new commits, barrier request, stop
+	pthread_cond_t synced;  // barriers: durable generation increased
+	MDB_env *env;
+	uint64_t committed;     // generation of the last commit
+	uint64_t requested;     // generation requested by a barrier
+	uint64_t durable;       // generation synchronized to disk
+	int ret;                // result of the last synchronization
+	unsigned waiters;       // barriers waiting for synchronization
+	bool stop;
+};
+
+static void *syncer_run(void *arg)
+{
+	struct knot_lmdb_syncer *sync = arg;
+
+	pthread_mutex_lock(&sync->mutex);
+	while (!sync->stop) {
+		if (sync->durable == sync->committed) {
+			pthread_cond_wait(&sync->wake, &sync->mutex);
+			continue;
+		}
+		if (sync->requested <= sync->durable) {
+			// Gather more commits unless someone waits.
+			struct timespec deadline;
+			clock_gettime(CLOCK_REALTIME, &deadline);
+			deadline.tv_nsec += LMDB_SYNC_WINDOW_MS * 1000000L;
+			deadline.tv_sec += deadline.tv_nsec / 1000000000L;
+			deadline.tv_nsec %= 1000000000L;
+			(void)pthread_cond_timedwait(&sync->wake, &sync->mutex, &deadline);
+		}
+
+		uint64_t target = sync->committed;
+		pthread_mutex_unlock(&sync->mutex);
+		int ret = mdb_env_sync(sync->env, 1);
+		err_to_knot(&ret);
+		pthread_mutex_lock(&sync->mutex);
+
+		sync->durable = target;
+		sync->ret = ret;
+		pthread_cond_broadcast(&sync->synced);
+	}
+	pthread_mutex_unlock(&sync->mutex);
+
+	return NULL;
+}
+
+static int syncer_start(knot_lmdb_db_t *db)
+{
+	struct knot_lmdb_syncer *sync = calloc(1, sizeof(*sync));
+	if (sync == NULL) {
+		return KNOT_ENOMEM;
+	}
+	sync->env = db->env;
+	pthread_mutex_init(&sync->mutex, NULL);
+	pthread_cond_init(&sync->wake, NULL);
+	pthread_cond_init(&sync->synced, NULL);
+
+	if (pthread_create(&sync->thread, NULL, syncer_run, sync) != 0) {
+		pthread_cond_destroy(&sync->synced);
+		pthread_cond_destroy(&sync->wake);
+		pthread_mutex_destroy(&sync->mutex);
+		free(sync);
+		return KNOT_ENOMEM;
+	}
+	db->syncer = sync;
+	return KNOT_EOK;
+}
+
+static void syncer_stop(knot_lmdb_db_t *db)
+{
+	struct knot_lmdb_syncer *sync = db->syncer;
+	if (sync == NULL) {
+		return;
+	}
+
+	pthread_mutex_lock(&sync->mutex);
+	sync->stop = true;
+	pthread_cond_signal(&sync->wake);
+	pthread_cond_broadcast(&sync->synced);
+	pthread_mutex_unlock(&sync->mutex);
+	pthread_join(sync->thread, NULL);
+
+	// The barriers are leaving, the last one signals.
+	pthread_mutex_lock(&sync->mutex);
+	while (sync->waiters > 0) {
+		pthread_cond_wait(&sync->wake, &sync->mutex);
+	}
+	pthread_mutex_unlock(&sync->mutex);
+
+	(void)mdb_env_sync(db->env, 1);
+
+	pthread_cond_destroy(&sync->synced);
+	pthread_cond_destroy(&sync->wake);
+	pthread_mutex_destroy(&sync->mutex);
+	free(sync);
+	db->syncer = NULL;
+}
+
+static void syncer_committed(struct knot_lmdb_syncer *sync)
+{
+	pthread_mutex_lock(&sync->mutex);
+	if (sync->committed++ == sync->durable) {
+		pthread_cond_signal(&sync->wake);
+	}
+	pthread_mutex_unlock(&sync->mutex);
+}
+
+int knot_lmdb_sync(knot_lmdb_db_t *db)
+{
+	struct knot_lmdb_syncer *sync = db->syncer;
+	if (sync == NULL) {
+		return KNOT_EOK;
+	}
+
+	int ret = KNOT_EOK;
+	pthread_mutex_lock(&sync->mutex);
+	uint64_t gen = sync->committed;
+	if (sync->stop) {
+		ret = KNOT_EBUSY;
+	} else if (sync->durable < gen) {
+		if (sync->requested < gen) {
+			sync->requested = gen;
+			pthread_cond_signal(&sync->wake);
+		}
+		sync->waiters++;
+		while (sync->durable < gen && !sync->stop) {
+			pthread_cond_wait(&sync->synced, &sync->mutex);
+		}
+		ret = (sync->durable < gen) ? KNOT_EBUSY : sync->ret;
+		if (--sync->waiters == 0 && sync->stop) {
+			pthread_cond_signal(&sync->wake);
+		}
+	}
+	pthread_mutex_unlock(&sync->mutex);
+
+	return ret;
+}
+
 static int lmdb_open(knot_lmdb_db_t *db)
 {
 	MDB_txn *init_txn = NULL;
@@ -131,6 +279,13 @@ static int lmdb_open(knot_lmdb_db_t *db)
 	}
 
 	ret = mkdir(db->path, LMDB_DIR_MODE);
+	if (ret < 0 && errno == ENOENT) { // shard of a not yet existing DB
+		ret = make_path(db->path, LMDB_DIR_MODE);
+		if (ret != KNOT_EOK) {
+			return ret;
+		}
+		ret = mkdir(db->path, LMDB_DIR_MODE);
+	}
 	if (ret < 0 && errno != EEXIST) {
 		return -errno;
 	}
@@ -166,16 +321,20 @@ static int lmdb_open(knot_lmdb_db_t *db)
 	}
 	if (ret == MDB_SUCCESS) {
 		ret = mdb_txn_commit(init_txn);
+		init_txn = NULL;
+	}
+	err_to_knot(&ret);
+	if (ret == KNOT_EOK && (db->env_flags & MDB_NOSYNC) && !(db->env_flags & MDB_RDONLY)) {
+		ret = syncer_start(db);
 	}
 
-	if (ret != MDB_SUCCESS) {
+	if (ret != KNOT_EOK) {
 		if (init_txn != NULL) {
 			mdb_txn_abort(init_txn);
 		}
 		mdb_env_close(db->env);
 		db->env = NULL;
 	}
-	err_to_knot(&ret);
 	return ret;
 }
 
@@ -190,6 +349,7 @@ int knot_lmdb_open(knot_lmdb_db_t *db)
 static void lmdb_close(knot_lmdb_db_t *db)
 {
 	if (db->env != NULL) {
+		syncer_stop(db);
 		mdb_dbi_close(db->env, db->dbi);
 		mdb_env_close(db->env);
 		db->env = NULL;
@@ -251,6 +411,122 @@ void knot_lmdb_deinit(knot_lmdb_db_t *db)
 	free(db->path);
 }
 
+#define SHARD_FMT "shard-%u-of-%u"
+
+static char *shard_path(const char *path, unsigned idx, unsigned count)
+{
+	if (count == 1) {
+		return strdup(path);
+	}
+	size_t len = strlen(path) + sizeof(SHARD_FMT) + 20;
+	char *res = malloc(len);
+	if (res != NULL) {
+		(void)snprintf(res, len, "%s/" SHARD_FMT, path, idx, count);
+	}
+	return res;
+}
+
+int knot_lmdb_shards_init(knot_lmdb_shards_t *shards, unsigned count, const char *path,
+                          size_t mapsize, unsigned env_flags, const char *dbname)
+{
+	if (count == 0) {
+		return KNOT_EINVAL;
+	}
+	shards->shards = calloc(count, sizeof(*shards->shards));
+	if (shards->shards == NULL) {
+		return KNOT_ENOMEM;
+	}
+	for (unsigned i = 0; i < count; i++) {
+		char *spath = shard_path(path, i, count);
+		if (spath == NULL) {
+			shards->count = i;
+			knot_lmdb_shards_deinit(shards);
+			return KNOT_ENOMEM;
+		}
+		knot_lmdb_init(&shards->shards[i], spath, mapsize / count, env_flags, dbname);
+		free(spath);
+	}
+	shards->count = count;
+	return KNOT_EOK;
+}
+
+unsigned knot_lmdb_shards_detect(const char *path)
+{
+	struct stat unused;
+	unsigned res = lmdb_stat(path, &unused) ? 1 : 0, idx, count;
+
+	DIR *dir = opendir(path);
+	if (dir == NULL) {
+		return res;
+	}
+	struct dirent *ent;
+	while ((ent = readdir(dir)) != NULL) {
+		if (sscanf(ent->d_name, SHARD_FMT, &idx, &count) == 2 &&
+		    idx < count && count > res) {
+			res = count;
+		}
+	}
+	closedir(dir);
+	return res;
+}
+
+typedef int (*shard_reinit_f)(knot_lmdb_db_t *, const char *, size_t, unsigned);
+
+static int shards_reinit(knot_lmdb_shards_t *shards, unsigned count, const char *path,
+                         size_t mapsize, unsigned env_flags, shard_reinit_f reinit)
+{
+	if (count != shards->count) {
+		return KNOT_ENOTSUP;
+	}
+	int ret = KNOT_EOK;
+	for (unsigned i = 0; i < count && ret == KNOT_EOK; i++) {
+		char *spath = shard_path(path, i, count);
+		if (spath == NULL) {
+			return KNOT_ENOMEM;
+		}
+		ret = reinit(&shards->shards[i], spath, mapsize / count, env_flags);
+		free(spath);
+	}
+	return ret;
+}
+
+int knot_lmdb_shards_reinit(knot_lmdb_shards_t *shards, unsigned count, const char *path,
+                            size_t mapsize, unsigned env_flags)
+{
+	return shards_reinit(shards, count, path, mapsize, env_flags, knot_lmdb_reinit);
+}
+
+int knot_lmdb_shards_reconfigure(knot_lmdb_shards_t *shards, unsigned count, const char *path,
+                                 size_t mapsize, unsigned env_flags)
+{
+	return shards_reinit(shards, count, path, mapsize, env_flags, knot_lmdb_reconfigure);
+}
+
+void knot_lmdb_shards_deinit(knot_lmdb_shards_t *shards)
+{
+	for (unsigned i = 0; i < shards->count; i++) {
+		knot_lmdb_deinit(&shards->shards[i]);
+	}
+	free(shards->shards);
+	shards->shards = NULL;
+	shards->count = 0;
+}
+
+unsigned knot_lmdb_shard_idx(const knot_lmdb_shards_t *shards, const uint8_t *zone)
+{
+	if (shards->count <= 1) {
+		return 0;
+	}
+
+	// FNV-1a, stable across restarts and platforms.
+	uint32_t hash = 2166136261u;
+	for (size_t i = knot_dname_size(zone); i > 0; i--, zone++) {
+		hash ^= knot_tolower(*zone);
+		hash *= 16777619u;
+	}
+	return hash % shards->count;
+}
+
 void knot_lmdb_begin(knot_lmdb_db_t *db, knot_lmdb_txn_t *txn, bool rw)
 {
 	txn->ret = mdb_txn_begin(db->env, NULL, rw ? 0 : MDB_RDONLY, &txn->txn);
@@ -298,6 +574,9 @@ void knot_lmdb_commit(knot_lmdb_txn_t *txn)
 	txn->ret = mdb_txn_commit(txn->txn);
 	err_to_knot(&txn->ret);
 	txn->opened = false;
+	if (txn->ret == KNOT_EOK && txn->is_rw && txn->db->syncer != NULL) {
+		syncer_committed(txn->db->syncer);
+	}
 }
 
 // save the programmer's frequent checking for ENOMEM when creating search keys
@@ -37,8 +37,14 @@ typedef struct knot_lmdb_db {
 	unsigned env_flags; // MDB_NOTLS, MDB_RDONLY, MDB_WRITEMAP, MDB_DUPSORT, MDB_NOSYNC, MDB_MAPASYNC
 	const char *dbname;
 	char *path;
+	struct knot_lmdb_syncer *syncer; // group commit with MDB_NOSYNC
 } knot_lmdb_db_t;
 
+typedef struct {
+	knot_lmdb_db_t *shards;
+	unsigned count;
+} knot_lmdb_shards_t;
+
 typedef struct {
 	MDB_txn *txn;
 	MDB_cursor *cursor;
@@ -141,6 +147,93 @@ int knot_lmdb_reconfigure(knot_lmdb_db_t *db, const char *path, size_t mapsize,
  */
 void knot_lmdb_deinit(knot_lmdb_db_t *db);
 
+/*!
+ * \brief Wait until all transactions committed so far are durable.
+ *
+ * With MDB_NOSYNC, commits don't synchronize the DB to disk. Instead, all the
+ * commits from a short period are synchronized at once by a background thread,
+ * or as soon as possible when this barrier is requested. Concurrent requests
+ * share the same synchronization.
+ *
+ * \param db   The DB in question.
+ *
+ * \return KNOT_E*, KNOT_EBUSY if the DB is being closed.
+ */
+int knot_lmdb_sync(knot_lmdb_db_t *db);
+
+/*!
+ * \brief Initialise a set of DBs with records distributed by zone name.
+ *
+ * Each shard is an independent LMDB environment, so that write transactions
+ * for zones in different shards don't wait for each other. With one shard,
+ * the DB is located directly in \a path, otherwise in its subdirectories
+ * \a path/shard-<i>-of-<count>.
+ *
+ * \param shards      Shards handling structure.
+ * \param count       Number of shards.
+ * \param path        Path to the directory with the DB(s).
+ * \param mapsize     Maximum size of all the shards together.
+ * \param env_flags   LMDB environment flags (e.g. MDB_RDONLY)
+ * \param dbname      Optional: name of the sub-database.
+ *
+ * \return KNOT_E*
+ */
+int knot_lmdb_shards_init(knot_lmdb_shards_t *shards, unsigned count, const char *path,
+                          size_t mapsize, unsigned env_flags, const char *dbname);
+
+/*!
+ * \brief Detect the number of shards of an existing DB.
+ *
+ * \param path   Path to the directory with the DB(s).
+ *
+ * \return Number of shards found on the filesystem, 1 if the DB isn't sharded,
+ *         0 if there is no DB.
+ */
+unsigned knot_lmdb_shards_detect(const char *path);
+
+/*!
+ * \brief Re-initialise all shards with modified parameters.
+ *
+ * \note The number of shards can't be changed this way.
+ *
+ * \see knot_lmdb_reinit()
+ *
+ * \return KNOT_EOK on success, KNOT_ENOTSUP or KNOT_EISCONN if not possible.
+ */
+int knot_lmdb_shards_reinit(knot_lmdb_shards_t *shards, unsigned count, const char *path,
+                            size_t mapsize, unsigned env_flags);
+
+/*!
+ * \brief Re-open all shards with modified parameters.
+ *
+ * \note The number of shards can't be changed this way.
+ *
+ * \see knot_lmdb_reconfigure()
+ *
+ * \return KNOT_E*
+ */
+int knot_lmdb_shards_reconfigure(knot_lmdb_shards_t *shards, unsigned count, const char *path,
+                                 size_t mapsize, unsigned env_flags);
+
+/*!
+ * \brief Close and de-initialise all shards.
+ */
+void knot_lmdb_shards_deinit(knot_lmdb_shards_t *shards);
+
+/*!
+ * \brief Return the index of the shard holding records of the given zone.
+ */
+unsigned knot_lmdb_shard_idx(const knot_lmdb_shards_t *shards, const uint8_t *zone);
+
+/*!
+ * \brief Return the shard holding records of the given zone.
+ */
+inline static knot_lmdb_db_t *knot_lmdb_shard(const knot_lmdb_shards_t *shards,
+                                              const uint8_t *zone)
+{
+	return &shards->shards[knot_lmdb_shard_idx(shards, zone)];
+}
+
 /*!
  * \brief Return true if DB is open.
  */
@@ -15,6 +15,7 @@
  */
 
 #include "knot/include/module.h"
+#include "contrib/addr_trie.h"
 #include "contrib/sockaddr.h"
 
 #define MOD_ADDRESS	"\x07""address"
@@ -27,8 +28,8 @@ const yp_item_t queryacl_conf[] = {
 };
 
 typedef struct {
-	knotd_conf_t allow_addr;
-	knotd_conf_t allow_iface;
+	addr_trie_t *allow_addr;
+	addr_trie_t *allow_iface;
 } queryacl_ctx_t;
 
 static knotd_state_t queryacl_process(knotd_state_t state, knot_pkt_t *pkt,
@@ -43,23 +44,24 @@ static knotd_state_t queryacl_process(knotd_state_t state, knot_pkt_t *pkt,
 		return state;
 	}
 
-	// Get interface address.
-	struct sockaddr_storage iface;
-	socklen_t iface_len = sizeof(iface);
-	if (getsockname(qdata->params->socket, (struct sockaddr *)&iface, &iface_len) != 0) {
-		knotd_mod_log(mod, LOG_ERR, "failed to get interface address");
-		return KNOTD_STATE_FAIL;
-	}
-
-	if (ctx->allow_addr.count > 0) {
-		if (!knotd_conf_addr_range_match(&ctx->allow_addr, qdata->params->remote)) {
+	if (ctx->allow_addr != NULL) {
+		if (!addr_trie_contains(ctx->allow_addr, qdata->params->remote)) {
 			qdata->rcode = KNOT_RCODE_NOTAUTH;
 			return KNOTD_STATE_FAIL;
 		}
 	}
 
-	if (ctx->allow_iface.count > 0) {
-		if (!knotd_conf_addr_range_match(&ctx->allow_iface, &iface)) {
+	if (ctx->allow_iface != NULL) {
+		// Get interface address.
+		struct sockaddr_storage iface;
+		socklen_t iface_len = sizeof(iface);
+		if (getsockname(qdata->params->socket, (struct sockaddr *)&iface,
+		                &iface_len) != 0) {
+			knotd_mod_log(mod, LOG_ERR, "failed to get interface address");
+			return KNOTD_STATE_FAIL;
+		}
+
+		if (!addr_trie_contains(ctx->allow_iface, &iface)) {
 			qdata->rcode = KNOT_RCODE_NOTAUTH;
 			return KNOTD_STATE_FAIL;
 		}
@@ -68,6 +70,45 @@ static knotd_state_t queryacl_process(knotd_state_t state, knot_pkt_t *pkt,
 	return state;
 }
 
+/*!
+ * \brief Compile the configured address ranges into a prefix trie.
+ *
+ * Output is NULL if no range is configured.
+ */
+static int compile_ranges(knotd_mod_t *mod, const yp_name_t *item, addr_trie_t **out)
+{
+	knotd_conf_t conf = knotd_conf_mod(mod, item);
+	if (conf.count == 0) {
+		*out = NULL;
+		return KNOT_EOK;
+	}
+
+	addr_trie_t *trie = addr_trie_new();
+	if (trie == NULL) {
+		knotd_conf_free(&conf);
+		return KNOT_ENOMEM;
+	}
+
+	int ret = KNOT_EOK;
+	for (size_t i = 0; i < conf.count && ret == KNOT_EOK; i++) {
+		knotd_conf_val_t *val = &conf.multi[i];
+		if (val->addr_max.ss_family == AF_UNSPEC) {
+			ret = addr_trie_add_net(trie, &val->addr, val->addr_mask, 0);
+		} else {
+			ret = addr_trie_add_range(trie, &val->addr, &val->addr_max, 0);
+		}
+	}
+	knotd_conf_free(&conf);
+
+	if (ret != KNOT_EOK) {
+		addr_trie_free(trie);
+		return ret;
+	}
+
+	*out = trie;
+	return KNOT_EOK;
+}
+
 int queryacl_load(knotd_mod_t *mod)
 {
 	// Create module context.
@@ -76,8 +117,15 @@ int queryacl_load(knotd_mod_t *mod)
 		return KNOT_ENOMEM;
 	}
 
-	ctx->allow_addr = knotd_conf_mod(mod, MOD_ADDRESS);
-	ctx->allow_iface = knotd_conf_mod(mod, MOD_INTERFACE);
+	int ret = compile_ranges(mod, MOD_ADDRESS, &ctx->allow_addr);
+	if (ret == KNOT_EOK) {
+		ret = compile_ranges(mod, MOD_INTERFACE, &ctx->allow_iface);
+	}
+	if (ret != KNOT_EOK) {
+		addr_trie_free(ctx->allow_addr);
+		free(ctx);
+		return ret;
+	}
 
 	knotd_mod_ctx_set(mod, ctx);
 
@@ -88,8 +136,8 @@ void queryacl_unload(knotd_mod_t *mod)
 {
 	queryacl_ctx_t *ctx = knotd_mod_ctx(mod);
 	if (ctx != NULL) {
-		knotd_conf_free(&ctx->allow_addr);
-		knotd_conf_free(&ctx->allow_iface);
+		addr_trie_free(ctx->allow_addr);
+		addr_trie_free(ctx->allow_iface);
 	}
 	free(ctx);
 }
@@ -0,0 +1,44 @@
+/*  Copyright (C) 2018 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "knot/include/module.h"
+
+// Forward declarations of static modules (generated by configure).
+extern const knotd_mod_api_t knotd_mod_api_cookies;
+extern const knotd_mod_api_t knotd_mod_api_dnsproxy;
+extern const knotd_mod_api_t knotd_mod_api_geoip;
+extern const knotd_mod_api_t knotd_mod_api_noudp;
+extern const knotd_mod_api_t knotd_mod_api_onlinesign;
+extern const knotd_mod_api_t knotd_mod_api_queryacl;
+extern const knotd_mod_api_t knotd_mod_api_rrl;
+extern const knotd_mod_api_t knotd_mod_api_stats;
+extern const knotd_mod_api_t knotd_mod_api_synthrecord;
+extern const knotd_mod_api_t knotd_mod_api_whoami;
+
+// STATIC_MODULES initializator (generated by configure).
+#define STATIC_MODULES_INIT \
+	{ &knotd_mod_api_cookies },\
+	{ &knotd_mod_api_dnsproxy },\
+	{ &knotd_mod_api_geoip },\
+	{ &knotd_mod_api_noudp },\
+	{ &knotd_mod_api_onlinesign },\
+	{ &knotd_mod_api_queryacl },\
+	{ &knotd_mod_api_rrl },\
+	{ &knotd_mod_api_stats },\
+	{ &knotd_mod_api_synthrecord },\
+	{ &knotd_mod_api_whoami },
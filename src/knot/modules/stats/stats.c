@@ -82,6 +82,8 @@ typedef struct {
 	bool qtype;
 	bool qsize;
 	bool rsize;
+	uint32_t offsets[CTR_RSIZE + 1]; // Counter positions in the accumulator.
+	uint32_t total;                  // Accumulator size.
 } stats_t;
 
 typedef struct {
@@ -349,7 +351,50 @@ static const ctr_desc_t ctr_descs[] = {
 	{ NULL }
 };
 
-static void incr_edns_option(knotd_mod_t *mod, const knot_pkt_t *pkt, unsigned ctr_name)
+/*! \brief Number of all counter values, the batch accumulator limit. */
+#define CTR_VALUES_MAX	(PROTOCOL__COUNT + OPERATION__COUNT + REQ_BYTES__COUNT + \
+			 RESP_BYTES__COUNT + EDNS__COUNT + FLAG__COUNT + \
+			 (RCODE_OTHER + 1) + 2 * (EOPT_OTHER + 1) + NODATA__COUNT + \
+			 QTYPE__COUNT + (QSIZE_MAX_IDX + 1) + (RSIZE_MAX_IDX + 1))
+
+/*! \brief Counter updates, accumulated over a batch of queries if possible. */
+typedef struct {
+	knotd_mod_t *mod;
+	const stats_t *stats;
+	int64_t *values; // NULL for immediate updates.
+} ctr_acc_t;
+
+static void ctr_add(ctr_acc_t *acc, uint32_t ctr_id, uint32_t idx, int64_t val)
+{
+	if (acc->values != NULL) {
+		acc->values[acc->stats->offsets[ctr_id] + idx] += val;
+	} else if (val >= 0) {
+		knotd_mod_stats_incr(acc->mod, ctr_id, idx, val);
+	} else {
+		knotd_mod_stats_decr(acc->mod, ctr_id, idx, -val);
+	}
+}
+
+static void ctr_flush(ctr_acc_t *acc)
+{
+	for (uint32_t ctr_id = 0; ctr_id <= CTR_RSIZE; ctr_id++) {
+		const ctr_desc_t *desc = &ctr_descs[ctr_id];
+		if (!*(const bool *)((const uint8_t *)acc->stats + desc->conf_offset)) {
+			continue;
+		}
+
+		int64_t *values = acc->values + acc->stats->offsets[ctr_id];
+		for (uint32_t idx = 0; idx < desc->count; idx++) {
+			if (values[idx] > 0) {
+				knotd_mod_stats_incr(acc->mod, ctr_id, idx, values[idx]);
+			} else if (values[idx] < 0) {
+				knotd_mod_stats_decr(acc->mod, ctr_id, idx, -values[idx]);
+			}
+		}
+	}
+}
+
+static void incr_edns_option(ctr_acc_t *acc, const knot_pkt_t *pkt, unsigned ctr_name)
 {
 	if (!knot_pkt_has_edns(pkt)) {
 		return;
@@ -368,16 +413,16 @@ static void incr_edns_option(knotd_mod_t *mod, const knot_pkt_t *pkt, unsigned c
 		if (wire.error != KNOT_EOK) {
 			break;
 		}
-		knotd_mod_stats_incr(mod, ctr_name, MIN(opt_code, EOPT_OTHER), 1);
+		ctr_add(acc, ctr_name, MIN(opt_code, EOPT_OTHER), 1);
 	}
 }
 
-static knotd_state_t update_counters(knotd_state_t state, knot_pkt_t *pkt,
-                                     knotd_qdata_t *qdata, knotd_mod_t *mod)
+static void update_counters(ctr_acc_t *acc, knotd_state_t state,
+                            const knot_pkt_t *pkt, knotd_qdata_t *qdata)
 {
 	assert(pkt && qdata);
 
-	stats_t *stats = knotd_mod_ctx(mod);
+	const stats_t *stats = acc->stats;
 
 	uint16_t operation;
 	unsigned xfr_packets = 0;
@@ -414,16 +459,16 @@ static knotd_state_t update_counters(knotd_state_t state, knot_pkt_t *pkt,
 	if (stats->req_bytes) {
 		switch (operation) {
 		case OPERATION_QUERY:
-			knotd_mod_stats_incr(mod, CTR_REQ_BYTES, REQ_BYTES_QUERY,
+			ctr_add(acc, CTR_REQ_BYTES, REQ_BYTES_QUERY,
 			                     knot_pkt_size(qdata->query));
 			break;
 		case OPERATION_UPDATE:
-			knotd_mod_stats_incr(mod, CTR_REQ_BYTES, REQ_BYTES_UPDATE,
+			ctr_add(acc, CTR_REQ_BYTES, REQ_BYTES_UPDATE,
 			                     knot_pkt_size(qdata->query));
 			break;
 		default:
 			if (xfr_packets <= 1) {
-				knotd_mod_stats_incr(mod, CTR_REQ_BYTES, REQ_BYTES_OTHER,
+				ctr_add(acc, CTR_REQ_BYTES, REQ_BYTES_OTHER,
 				                     knot_pkt_size(qdata->query));
 			}
 			break;
@@ -434,16 +479,16 @@ static knotd_state_t update_counters(knotd_state_t state, knot_pkt_t *pkt,
 	if (stats->resp_bytes && state != KNOTD_STATE_NOOP) {
 		switch (operation) {
 		case OPERATION_QUERY:
-			knotd_mod_stats_incr(mod, CTR_RESP_BYTES, RESP_BYTES_REPLY,
+			ctr_add(acc, CTR_RESP_BYTES, RESP_BYTES_REPLY,
 			                     knot_pkt_size(pkt));
 			break;
 		case OPERATION_AXFR:
 		case OPERATION_IXFR:
-			knotd_mod_stats_incr(mod, CTR_RESP_BYTES, RESP_BYTES_TRANSFER,
+			ctr_add(acc, CTR_RESP_BYTES, RESP_BYTES_TRANSFER,
 			                     knot_pkt_size(pkt));
 			break;
 		default:
-			knotd_mod_stats_incr(mod, CTR_RESP_BYTES, RESP_BYTES_OTHER,
+			ctr_add(acc, CTR_RESP_BYTES, RESP_BYTES_OTHER,
 			                     knot_pkt_size(pkt));
 			break;
 		}
@@ -461,14 +506,13 @@ static knotd_state_t update_counters(knotd_state_t state, knot_pkt_t *pkt,
 			if (xfr_packets > 1) {
 				assert(rcode != KNOT_RCODE_NOERROR);
 				// Ignore the leading XFR message NOERROR.
-				knotd_mod_stats_decr(mod, CTR_RCODE,
-				                     KNOT_RCODE_NOERROR, 1);
+				ctr_add(acc, CTR_RCODE, KNOT_RCODE_NOERROR, -1);
 			}
 
 			if (qdata->rcode_tsig == KNOT_RCODE_BADSIG) {
-				knotd_mod_stats_incr(mod, CTR_RCODE, RCODE_BADSIG, 1);
+				ctr_add(acc, CTR_RCODE, RCODE_BADSIG, 1);
 			} else {
-				knotd_mod_stats_incr(mod, CTR_RCODE,
+				ctr_add(acc, CTR_RCODE,
 				                     MIN(rcode, RCODE_OTHER), 1);
 			}
 		}
@@ -476,30 +520,30 @@ static knotd_state_t update_counters(knotd_state_t state, knot_pkt_t *pkt,
 
 	// Return if non-first transfer message.
 	if (xfr_packets > 1) {
-		return state;
+		return;
 	}
 
 	// Count the server opearation.
 	if (stats->operation) {
-		knotd_mod_stats_incr(mod, CTR_OPERATION, operation, 1);
+		ctr_add(acc, CTR_OPERATION, operation, 1);
 	}
 
 	// Count the request protocol.
 	if (stats->protocol) {
 		if (qdata->params->remote->ss_family == AF_INET) {
 			if (qdata->params->flags & KNOTD_QUERY_FLAG_LIMIT_SIZE) {
-				knotd_mod_stats_incr(mod, CTR_PROTOCOL,
+				ctr_add(acc, CTR_PROTOCOL,
 				                     PROTOCOL_UDP4, 1);
 			} else {
-				knotd_mod_stats_incr(mod, CTR_PROTOCOL,
+				ctr_add(acc, CTR_PROTOCOL,
 				                     PROTOCOL_TCP4, 1);
 			}
 		} else {
 			if (qdata->params->flags & KNOTD_QUERY_FLAG_LIMIT_SIZE) {
-				knotd_mod_stats_incr(mod, CTR_PROTOCOL,
+				ctr_add(acc, CTR_PROTOCOL,
 				                     PROTOCOL_UDP6, 1);
 			} else {
-				knotd_mod_stats_incr(mod, CTR_PROTOCOL,
+				ctr_add(acc, CTR_PROTOCOL,
 				                     PROTOCOL_TCP6, 1);
 			}
 		}
@@ -508,34 +552,34 @@ static knotd_state_t update_counters(knotd_state_t state, knot_pkt_t *pkt,
 	// Count EDNS occurrences.
 	if (stats->edns) {
 		if (knot_pkt_has_edns(qdata->query)) {
-			knotd_mod_stats_incr(mod, CTR_EDNS, EDNS_REQ, 1);
+			ctr_add(acc, CTR_EDNS, EDNS_REQ, 1);
 		}
 		if (knot_pkt_has_edns(pkt) && state != KNOTD_STATE_NOOP) {
-			knotd_mod_stats_incr(mod, CTR_EDNS, EDNS_RESP, 1);
+			ctr_add(acc, CTR_EDNS, EDNS_RESP, 1);
 		}
 	}
 
 	// Count interesting message header flags.
 	if (stats->flag) {
 		if (state != KNOTD_STATE_NOOP && knot_wire_get_tc(pkt->wire)) {
-			knotd_mod_stats_incr(mod, CTR_FLAG, FLAG_TC, 1);
+			ctr_add(acc, CTR_FLAG, FLAG_TC, 1);
 		}
 		if (knot_pkt_has_dnssec(pkt)) {
-			knotd_mod_stats_incr(mod, CTR_FLAG, FLAG_DO, 1);
+			ctr_add(acc, CTR_FLAG, FLAG_DO, 1);
 		}
 	}
 
 	// Count EDNS options.
 	if (stats->req_eopt) {
-		incr_edns_option(mod, qdata->query, CTR_REQ_EOPT);
+		incr_edns_option(acc, qdata->query, CTR_REQ_EOPT);
 	}
 	if (stats->resp_eopt) {
-		incr_edns_option(mod, pkt, CTR_RESP_EOPT);
+		incr_edns_option(acc, pkt, CTR_RESP_EOPT);
 	}
 
 	// Return if not query operation.
 	if (operation != OPERATION_QUERY) {
-		return state;
+		return;
 	}
 
 	// Count NODATA reply (RFC 2308, Section 2.2).
@@ -545,13 +589,13 @@ static knotd_state_t update_counters(knotd_state_t state, knot_pkt_t *pkt,
 	     knot_pkt_rr(knot_pkt_section(pkt, KNOT_AUTHORITY), 0)->type == KNOT_RRTYPE_SOA)) {
 		switch (knot_pkt_qtype(qdata->query)) {
 		case KNOT_RRTYPE_A:
-			knotd_mod_stats_incr(mod, CTR_NODATA, NODATA_A, 1);
+			ctr_add(acc, CTR_NODATA, NODATA_A, 1);
 			break;
 		case KNOT_RRTYPE_AAAA:
-			knotd_mod_stats_incr(mod, CTR_NODATA, NODATA_AAAA, 1);
+			ctr_add(acc, CTR_NODATA, NODATA_AAAA, 1);
 			break;
 		default:
-			knotd_mod_stats_incr(mod, CTR_NODATA, NODATA_OTHER, 1);
+			ctr_add(acc, CTR_NODATA, NODATA_OTHER, 1);
 			break;
 		}
 	}
@@ -568,22 +612,45 @@ static knotd_state_t update_counters(knotd_state_t state, knot_pkt_t *pkt,
 		default:                        idx = QTYPE_OTHER; break;
 		}
 
-		knotd_mod_stats_incr(mod, CTR_QTYPE, idx, 1);
+		ctr_add(acc, CTR_QTYPE, idx, 1);
 	}
 
 	// Count the query size.
 	if (stats->qsize) {
 		uint64_t idx = knot_pkt_size(qdata->query) / BUCKET_SIZE;
-		knotd_mod_stats_incr(mod, CTR_QSIZE, MIN(idx, QSIZE_MAX_IDX), 1);
+		ctr_add(acc, CTR_QSIZE, MIN(idx, QSIZE_MAX_IDX), 1);
 	}
 
 	// Count the reply size.
 	if (stats->rsize && state != KNOTD_STATE_NOOP) {
 		uint64_t idx = knot_pkt_size(pkt) / BUCKET_SIZE;
-		knotd_mod_stats_incr(mod, CTR_RSIZE, MIN(idx, RSIZE_MAX_IDX), 1);
+		ctr_add(acc, CTR_RSIZE, MIN(idx, RSIZE_MAX_IDX), 1);
+	}
+
+}
+
+static void update_counters_batch(const knotd_batch_query_t *queries,
+                                  unsigned count, knotd_mod_t *mod)
+{
+	ctr_acc_t acc = {
+		.mod = mod,
+		.stats = knotd_mod_ctx(mod)
+	};
+
+	// Accumulate the counters to update each of them once.
+	int64_t values[CTR_VALUES_MAX];
+	if (count > 1) {
+		memset(values, 0, acc.stats->total * sizeof(*values));
+		acc.values = values;
 	}
 
-	return state;
+	for (unsigned i = 0; i < count; i++) {
+		update_counters(&acc, queries[i].state, queries[i].pkt, queries[i].qdata);
+	}
+
+	if (acc.values != NULL) {
+		ctr_flush(&acc);
+	}
 }
 
 int stats_load(knotd_mod_t *mod)
@@ -600,6 +667,11 @@ int stats_load(knotd_mod_t *mod)
 		// Initialize corresponding configuration item.
 		*(bool *)((uint8_t *)stats + desc->conf_offset) = enabled;
 
+		// Reserve the counter in the batch accumulator.
+		stats->offsets[desc - ctr_descs] = stats->total;
+		stats->total += enabled ? desc->count : 0;
+		assert(stats->total <= CTR_VALUES_MAX);
+
 		int ret = knotd_mod_stats_add(mod, enabled ? desc->conf_name + 1 : NULL,
 		                              enabled ? desc->count : 1, desc->fcn);
 		if (ret != KNOT_EOK) {
@@ -610,7 +682,7 @@ int stats_load(knotd_mod_t *mod)
 
 	knotd_mod_ctx_set(mod, stats);
 
-	return knotd_mod_hook(mod, KNOTD_STAGE_END, update_counters);
+	return knotd_mod_batch_hook(mod, update_counters_batch);
 }
 
 void stats_unload(knotd_mod_t *mod)
@@ -16,12 +16,14 @@
 
 #include <urcu.h>
 
+#include "contrib/macros.h"
 #include "contrib/mempattern.h"
 #include "contrib/sockaddr.h"
 #include "knot/nameserver/axfr.h"
 #include "knot/nameserver/internet.h"
 #include "knot/nameserver/log.h"
 #include "knot/nameserver/xfr.h"
+#include "knot/conf/conf.h"
 #include "libknot/libknot.h"
 
 #define ZONE_NAME(qdata) knot_pkt_qname((qdata)->query)
@@ -31,14 +33,128 @@
 	ns_log(priority, ZONE_NAME(qdata), LOG_OPERATION_AXFR, \
 	       LOG_DIRECTION_OUT, REMOTE(qdata), fmt)
 
+/*! \brief Size of the per-message record header in the AXFR cache. */
+#define CACHE_MSG_HDR (2 * sizeof(uint16_t))
+
+/*!
+ * \brief Pre-rendered AXFR answer for one zone contents version.
+ *
+ * Each message is stored as its answer section size, answer RR count and
+ * the answer section wire. Compression pointers in the stored wire are
+ * valid for any message having the same header and question size, which is
+ * the case for all AXFR responses of the zone.
+ */
+struct axfr_cache {
+	uint8_t *data;       //!< Message records.
+	size_t size;         //!< Used size of the data.
+	size_t capacity;     //!< Allocated size of the data.
+	size_t prefix;       //!< Header and question size of the rendered messages.
+	uint16_t max_msg;    //!< Largest stored answer section.
+};
+
 /* AXFR context. @note aliasing the generic xfr_proc */
 struct axfr_proc {
 	struct xfr_proc proc;
 	trie_it_t *i;
 	zone_tree_it_t it;
 	unsigned cur_rrset;
+	const struct axfr_cache *replay; //!< Cache being replayed (if any).
+	size_t replay_pos;               //!< Next record in the replayed cache.
+	struct axfr_cache *record;       //!< Cache being recorded (if any).
 };
 
+void axfr_cache_free(struct axfr_cache *cache)
+{
+	if (cache == NULL) {
+		return;
+	}
+
+	free(cache->data);
+	free(cache);
+}
+
+static int cache_append(struct axfr_cache *cache, const knot_pkt_t *pkt)
+{
+	size_t prefix = KNOT_WIRE_HEADER_SIZE + knot_pkt_question_size(pkt);
+	assert(pkt->size >= prefix);
+	size_t len = pkt->size - prefix;
+
+	if (cache->prefix == 0) {
+		cache->prefix = prefix;
+	} else if (cache->prefix != prefix) {
+		return KNOT_EINVAL;
+	}
+
+	if (cache->size + CACHE_MSG_HDR + len > cache->capacity) {
+		size_t capacity = MAX(2 * cache->capacity,
+		                      cache->size + CACHE_MSG_HDR + len);
+		uint8_t *data = realloc(cache->data, capacity);
+		if (data == NULL) {
+			return KNOT_ENOMEM;
+		}
+		cache->data = data;
+		cache->capacity = capacity;
+	}
+
+	uint8_t *pos = cache->data + cache->size;
+	knot_wire_write_u16(pos, len);
+	knot_wire_write_u16(pos + sizeof(uint16_t), knot_wire_get_ancount(pkt->wire));
+	memcpy(pos + CACHE_MSG_HDR, pkt->wire + prefix, len);
+	cache->size += CACHE_MSG_HDR + len;
+	cache->max_msg = MAX(cache->max_msg, len);
+
+	return KNOT_EOK;
+}
+
+static const struct axfr_cache *cache_get(const zone_contents_t *contents)
+{
+	return rcu_dereference(contents->axfr_cache);
+}
+
+static bool cache_fits(const struct axfr_cache *cache, const knot_pkt_t *pkt)
+{
+	/* The stored messages must fit into this response as they are. */
+	size_t prefix = KNOT_WIRE_HEADER_SIZE + knot_pkt_question_size(pkt);
+	return prefix == cache->prefix && pkt->size == prefix &&
+	       pkt->size + pkt->reserved + cache->max_msg <= pkt->max_size;
+}
+
+static void cache_publish(const zone_contents_t *contents, struct axfr_cache *cache)
+{
+	zone_contents_t *mutable = (zone_contents_t *)contents;
+
+	/* The first recorded cache is published, it's immutable from now on. */
+	if (!__sync_bool_compare_and_swap(&mutable->axfr_cache, NULL, cache)) {
+		/* Another transfer was faster. */
+		axfr_cache_free(cache);
+	}
+}
+
+static int axfr_replay(knot_pkt_t *pkt, struct axfr_proc *axfr,
+                       knotd_qdata_t *qdata)
+{
+	const struct axfr_cache *cache = axfr->replay;
+	assert(axfr->replay_pos < cache->size);
+
+	/* Check if the zone wasn't expired during multi-message transfer. */
+	if (qdata->extra->contents == NULL) {
+		return KNOT_ENOZONE;
+	}
+
+	const uint8_t *pos = cache->data + axfr->replay_pos;
+	uint16_t len = knot_wire_read_u16(pos);
+	uint16_t ancount = knot_wire_read_u16(pos + sizeof(uint16_t));
+
+	memcpy(pkt->wire + pkt->size, pos + CACHE_MSG_HDR, len);
+	pkt->size += len;
+	knot_wire_set_ancount(pkt->wire, ancount);
+	axfr->replay_pos += CACHE_MSG_HDR + len;
+
+	xfr_stats_add(&axfr->proc.stats, pkt->size + knot_rrset_size(&qdata->opt_rr));
+
+	return (axfr->replay_pos < cache->size) ? KNOT_ESPACE : KNOT_EOK;
+}
+
 static int axfr_put_rrsets(knot_pkt_t *pkt, zone_node_t *node,
                            struct axfr_proc *state)
 {
@@ -95,6 +211,7 @@ static void axfr_query_cleanup(knotd_qdata_t *qdata)
 
 	zone_tree_it_free(&axfr->it);
 	ptrlist_free(&axfr->proc.nodes, qdata->mm);
+	axfr_cache_free(axfr->record);
 	mm_free(qdata->mm, axfr);
 
 	/* Allow zone changes (finished). */
@@ -153,6 +270,45 @@ static int axfr_query_init(knotd_qdata_t *qdata)
 	return KNOT_EOK;
 }
 
+static void axfr_cache_setup(knot_pkt_t *pkt, struct axfr_proc *axfr,
+                             knotd_qdata_t *qdata)
+{
+	const zone_contents_t *contents = qdata->extra->contents;
+
+	conf_val_t val = conf_zone_get(conf(), C_AXFR_CACHE, qdata->extra->zone->name);
+	if (!conf_bool(&val)) {
+		return;
+	}
+
+	const struct axfr_cache *cache = cache_get(contents);
+	if (cache == NULL) {
+		axfr->record = calloc(1, sizeof(*axfr->record));
+	} else if (cache_fits(cache, pkt)) {
+		axfr->replay = cache;
+	}
+}
+
+static void axfr_cache_record(knot_pkt_t *pkt, struct axfr_proc *axfr,
+                              knotd_qdata_t *qdata, int state)
+{
+	if (axfr->record == NULL) {
+		return;
+	}
+
+	if ((state != KNOT_EOK && state != KNOT_ESPACE) ||
+	    cache_append(axfr->record, pkt) != KNOT_EOK) {
+		/* Give up recording, the transfer itself continues. */
+		axfr_cache_free(axfr->record);
+		axfr->record = NULL;
+		return;
+	}
+
+	if (state == KNOT_EOK) {
+		cache_publish(qdata->extra->contents, axfr->record);
+		axfr->record = NULL;
+	}
+}
+
 int axfr_process_query(knot_pkt_t *pkt, knotd_qdata_t *qdata)
 {
 	if (pkt == NULL || qdata == NULL) {
@@ -193,8 +349,18 @@ int axfr_process_query(knot_pkt_t *pkt, knotd_qdata_t *qdata)
 		return KNOT_STATE_FAIL;
 	}
 
+	/* Prefer the pre-rendered messages, or record them for others. */
+	if (axfr->proc.stats.messages == 0) {
+		axfr_cache_setup(pkt, axfr, qdata);
+	}
+
 	/* Answer current packet (or continue). */
-	ret = xfr_process_list(pkt, &axfr_process_node_tree, qdata);
+	if (axfr->replay != NULL) {
+		ret = axfr_replay(pkt, axfr, qdata);
+	} else {
+		ret = xfr_process_list(pkt, &axfr_process_node_tree, qdata);
+		axfr_cache_record(pkt, axfr, qdata, ret);
+	}
 	switch (ret) {
 	case KNOT_ESPACE: /* Couldn't write more, send packet and continue. */
 		return KNOT_STATE_PRODUCE; /* Check for more. */
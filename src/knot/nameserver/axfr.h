@@ -19,6 +19,15 @@
 #include "knot/nameserver/process_query.h"
 #include "libknot/packet/pkt.h"
 
+struct axfr_cache;
+
+/*!
+ * \brief Free pre-rendered AXFR messages of a zone contents.
+ *
+ * \note The cache is owned by the zone contents, see zone_contents_free().
+ */
+void axfr_cache_free(struct axfr_cache *cache);
+
 /*!
  * \brief Process an AXFR query message.
  *
@@ -18,6 +18,7 @@
 #include "knot/nameserver/internet.h"
 #include "knot/nameserver/nsec_proofs.h"
 #include "knot/nameserver/query_module.h"
+#include "knot/nameserver/query_prefetch.h"
 #include "knot/zone/serial.h"
 #include "contrib/mempattern.h"
 
@@ -316,8 +317,12 @@ static int follow_cname(knot_pkt_t *pkt, uint16_t rrtype, knotd_qdata_t *qdata)
 		}
 	}
 
-	/* Now follow the next CNAME TARGET. */
+	/* Now follow the next CNAME TARGET, its in-zone node may be linked. */
 	qdata->name = knot_cname_name(cname_rr.rrs.rdata);
+	const additional_t *target = cname_rr.additional;
+	if (rrtype == KNOT_RRTYPE_CNAME && target != NULL) {
+		qdata->extra->target = glue_node(&target->glues[0], cname_node);
+	}
 
 	return KNOTD_IN_STATE_FOLLOW;
 }
@@ -407,9 +412,29 @@ static int name_not_found(knot_pkt_t *pkt, knotd_qdata_t *qdata)
 
 static int solve_name(int state, knot_pkt_t *pkt, knotd_qdata_t *qdata)
 {
-	int ret = zone_contents_find_dname(qdata->extra->contents, qdata->name,
-	                                   &qdata->extra->node, &qdata->extra->encloser,
-	                                   &qdata->extra->previous);
+	/* Reuse the linked CNAME target or the lookup done for a batch of
+	 * queries if still applicable. */
+	const query_prefetch_t *prefetch = qdata->params->prefetch;
+	const zone_node_t *target = qdata->extra->target;
+	qdata->extra->target = NULL;
+	int ret;
+	if (target != NULL) {
+		qdata->extra->node = target;
+		qdata->extra->encloser = target;
+		qdata->extra->previous = node_prev(target);
+		ret = ZONE_NAME_FOUND;
+	} else if (qdata->name == knot_pkt_qname(qdata->query) &&
+	    query_prefetch_match(prefetch, qdata->query) &&
+	    prefetch->contents == qdata->extra->contents) {
+		qdata->extra->node = prefetch->node;
+		qdata->extra->encloser = prefetch->encloser;
+		qdata->extra->previous = prefetch->previous;
+		ret = prefetch->found;
+	} else {
+		ret = zone_contents_find_dname(qdata->extra->contents, qdata->name,
+		                               &qdata->extra->node, &qdata->extra->encloser,
+		                               &qdata->extra->previous);
+	}
 
 	switch (ret) {
 	case ZONE_NAME_FOUND:
@@ -21,6 +21,7 @@
 #include "knot/dnssec/rrset-sign.h"
 #include "knot/nameserver/process_query.h"
 #include "knot/nameserver/query_module.h"
+#include "knot/nameserver/query_prefetch.h"
 #include "knot/nameserver/chaos.h"
 #include "knot/nameserver/internet.h"
 #include "knot/nameserver/axfr.h"
@@ -53,13 +54,12 @@ static knotd_query_type_t query_type(const knot_pkt_t *pkt)
 }
 
 /*! \brief Reinitialize query data structure. */
-static void query_data_init(knot_layer_t *ctx, knotd_qdata_params_t *params,
-                            knotd_qdata_extra_t *extra)
+static void query_data_init(knotd_qdata_t *data, knotd_qdata_params_t *params,
+                            knotd_qdata_extra_t *extra, knot_mm_t *mm)
 {
 	/* Initialize persistent data. */
-	knotd_qdata_t *data = QUERY_DATA(ctx);
 	memset(data, 0, sizeof(*data));
-	data->mm = ctx->mm;
+	data->mm = mm;
 	data->params = params;
 	data->extra = extra;
 
@@ -69,6 +69,17 @@ static void query_data_init(knot_layer_t *ctx, knotd_qdata_params_t *params,
 	init_list(&extra->rrsigs);
 }
 
+/*! \brief Free data allocated during query processing. */
+static void query_data_clear(knotd_qdata_t *qdata)
+{
+	knot_rrset_clear(&qdata->opt_rr, qdata->mm);
+	ptrlist_free(&qdata->extra->wildcards, qdata->mm);
+	nsec_clear_rrsigs(qdata);
+	if (qdata->extra->ext_cleanup != NULL) {
+		qdata->extra->ext_cleanup(qdata);
+	}
+}
+
 static int process_query_begin(knot_layer_t *ctx, void *params)
 {
 	/* Initialize context. */
@@ -77,7 +88,7 @@ static int process_query_begin(knot_layer_t *ctx, void *params)
 	knotd_qdata_extra_t *extra = mm_alloc(ctx->mm, sizeof(*extra));
 
 	/* Initialize persistent data. */
-	query_data_init(ctx, params, extra);
+	query_data_init(QUERY_DATA(ctx), params, extra, ctx->mm);
 
 	/* Await packet. */
 	return KNOT_STATE_CONSUME;
@@ -93,15 +104,10 @@ static int process_query_reset(knot_layer_t *ctx)
 	knotd_qdata_extra_t *extra = qdata->extra;
 
 	/* Free allocated data. */
-	knot_rrset_clear(&qdata->opt_rr, qdata->mm);
-	ptrlist_free(&extra->wildcards, qdata->mm);
-	nsec_clear_rrsigs(qdata);
-	if (extra->ext_cleanup != NULL) {
-		extra->ext_cleanup(qdata);
-	}
+	query_data_clear(qdata);
 
 	/* Initialize persistent data. */
-	query_data_init(ctx, params, extra);
+	query_data_init(qdata, params, extra, ctx->mm);
 
 	/* Await packet. */
 	return KNOT_STATE_CONSUME;
@@ -291,6 +297,27 @@ static int answer_edns_init(const knot_pkt_t *query, knot_pkt_t *resp,
 		}
 	}
 
+	/* Advertise TCP idle timeout if requested over TCP (RFC 7828). */
+	uint8_t *keepalive_opt = knot_pkt_edns_option(query, KNOT_EDNS_OPTION_TCP_KEEPALIVE);
+	if (keepalive_opt != NULL &&
+	    (qdata->params->flags & KNOTD_QUERY_FLAG_KEEPALIVE)) {
+		/* Clients must not send the timeout. */
+		if (knot_edns_opt_get_length(keepalive_opt) != 0) {
+			qdata->rcode = KNOT_RCODE_FORMERR;
+			return KNOT_EMALF;
+		}
+
+		/* Zero timeout is valid in the response, write it explicitly. */
+		uint8_t timeout[sizeof(uint16_t)];
+		knot_wire_write_u16(timeout, qdata->params->keepalive);
+		ret = knot_edns_add_option(&qdata->opt_rr,
+		                           KNOT_EDNS_OPTION_TCP_KEEPALIVE,
+		                           sizeof(timeout), timeout, qdata->mm);
+		if (ret != KNOT_EOK) {
+			return ret;
+		}
+	}
+
 	/* Initialize EDNS Client Subnet if configured and present in query. */
 	if (conf()->cache.srv_ecs) {
 		uint8_t *ecs_opt = knot_pkt_edns_option(query, KNOT_EDNS_OPTION_CLIENT_SUBNET);
@@ -362,9 +389,8 @@ static int answer_edns_put(knot_pkt_t *resp, knotd_qdata_t *qdata)
 }
 
 /*! \brief Initialize response, sizes and find zone from which we're going to answer. */
-static int prepare_answer(knot_pkt_t *query, knot_pkt_t *resp, knot_layer_t *ctx)
+static int prepare_answer(knot_pkt_t *query, knot_pkt_t *resp, knotd_qdata_t *qdata)
 {
-	knotd_qdata_t *qdata = QUERY_DATA(ctx);
 	server_t *server = qdata->params->server;
 
 	/* Initialize response. */
@@ -417,8 +443,13 @@ static int prepare_answer(knot_pkt_t *query, knot_pkt_t *resp, knot_layer_t *ctx
 	memcpy(qdata->extra->orig_qname, qname, query->qname_size);
 	process_query_qname_case_lower(query);
 
-	/* Find zone for QNAME. */
-	qdata->extra->zone = answer_zone_find(query, server->zone_db);
+	/* Find zone for QNAME, unless already found for a batch of queries. */
+	const query_prefetch_t *prefetch = qdata->params->prefetch;
+	if (query_prefetch_match(prefetch, query)) {
+		qdata->extra->zone = prefetch->zone;
+	} else {
+		qdata->extra->zone = answer_zone_find(query, server->zone_db);
+	}
 	if (qdata->extra->zone != NULL && qdata->extra->contents == NULL) {
 		qdata->extra->contents = qdata->extra->zone->contents;
 	}
@@ -443,11 +474,9 @@ static void set_rcode_to_packet(knot_pkt_t *pkt, knotd_qdata_t *qdata)
 	knot_wire_set_rcode(pkt->wire, KNOT_EDNS_RCODE_LO(qdata->rcode));
 }
 
-static int process_query_err(knot_layer_t *ctx, knot_pkt_t *pkt)
+static int process_query_err(knotd_qdata_t *qdata, knot_pkt_t *pkt)
 {
-	assert(ctx && pkt);
-
-	knotd_qdata_t *qdata = QUERY_DATA(ctx);
+	assert(qdata && pkt);
 
 	/* Initialize response from query packet. */
 	knot_pkt_t *query = qdata->query;
@@ -488,6 +517,89 @@ static int process_query_err(knot_layer_t *ctx, knot_pkt_t *pkt)
 	return KNOT_STATE_DONE;
 }
 
+/*! \brief Restore QNAME case and put OPT and TSIG into the answer. */
+static int answer_postprocess(int state, knot_pkt_t *pkt, knotd_qdata_t *qdata)
+{
+	if (state != KNOT_STATE_DONE && state != KNOT_STATE_PRODUCE) {
+		return state;
+	}
+
+	/* Restore original QNAME. */
+	process_query_qname_case_restore(pkt, qdata);
+
+	/* Move to Additionals to add OPT and TSIG. */
+	if (pkt->current != KNOT_ADDITIONAL) {
+		(void)knot_pkt_begin(pkt, KNOT_ADDITIONAL);
+	}
+
+	/* Put OPT RR to the additional section. */
+	if (answer_edns_put(pkt, qdata) != KNOT_EOK) {
+		qdata->rcode = KNOT_RCODE_FORMERR;
+		return KNOT_STATE_FAIL;
+	}
+
+	/* Transaction security (if applicable). */
+	if (process_query_sign_response(pkt, qdata) != KNOT_EOK) {
+		return KNOT_STATE_FAIL;
+	}
+
+	return state;
+}
+
+/*! \brief Set final RCODE or create an error response. */
+static int answer_finish(int state, knot_pkt_t *pkt, knotd_qdata_t *qdata)
+{
+	switch (state) {
+	case KNOT_STATE_NOOP:
+		break;
+	case KNOT_STATE_FAIL:
+		/* Error processing. */
+		state = process_query_err(qdata, pkt);
+		break;
+	case KNOT_STATE_FINAL:
+		/* Just skipped postprocessing. */
+		state = KNOT_STATE_DONE;
+		break;
+	default:
+		set_rcode_to_packet(pkt, qdata);
+	}
+
+	return state;
+}
+
+/*! \brief Call the batch hooks, or queue the query for them if batched. */
+static void process_batch(int state, knot_pkt_t *pkt, knotd_qdata_t *qdata,
+                          struct query_plan *plan, struct query_plan *zone_plan)
+{
+	if (plan != NULL && EMPTY_LIST(plan->batch)) {
+		plan = NULL;
+	}
+	if (zone_plan != NULL && EMPTY_LIST(zone_plan->batch)) {
+		zone_plan = NULL;
+	}
+	if (plan == NULL && zone_plan == NULL) {
+		return;
+	}
+
+	query_batch_t *batch = qdata->params->batch;
+	if (batch != NULL &&
+	    query_batch_add(batch, state, pkt, qdata, plan, zone_plan) == KNOT_EOK) {
+		return;
+	}
+
+	knotd_batch_query_t query = {
+		.state = state,
+		.pkt = pkt,
+		.qdata = qdata
+	};
+	if (plan != NULL) {
+		query_plan_batch(plan, &query, 1);
+	}
+	if (zone_plan != NULL) {
+		query_plan_batch(zone_plan, &query, 1);
+	}
+}
+
 #define PROCESS_BEGIN(plan, step, next_state, qdata) \
 	if (plan != NULL) { \
 		WALK_LIST(step, plan->stage[KNOTD_STAGE_BEGIN]) { \
@@ -503,7 +615,7 @@ static int process_query_err(knot_layer_t *ctx, knot_pkt_t *pkt)
 		WALK_LIST(step, plan->stage[KNOTD_STAGE_END]) { \
 			next_state = step->process(next_state, pkt, qdata, step->ctx); \
 			if (next_state == KNOT_STATE_FAIL) { \
-				next_state = process_query_err(ctx, pkt); \
+				next_state = process_query_err(qdata, pkt); \
 			} \
 		} \
 	}
@@ -521,16 +633,18 @@ static int process_query_out(knot_layer_t *ctx, knot_pkt_t *pkt)
 
 	int next_state = KNOT_STATE_PRODUCE;
 
-	/* Check parse state. */
+	/* Check parse state, only normal queries can do without all sections. */
 	knot_pkt_t *query = qdata->query;
-	if (query->parsed < query->size) {
+	if (query->parsed < query->size ||
+	    (qdata->type != KNOTD_QUERY_TYPE_NORMAL &&
+	     knot_pkt_parse_sections(query, 0) != KNOT_EOK)) {
 		qdata->rcode = KNOT_RCODE_FORMERR;
 		next_state = KNOT_STATE_FAIL;
 		goto finish;
 	}
 
 	/* Preprocessing. */
-	if (prepare_answer(query, pkt, ctx) != KNOT_EOK) {
+	if (prepare_answer(query, pkt, qdata) != KNOT_EOK) {
 		next_state = KNOT_STATE_FAIL;
 		goto finish;
 	}
@@ -561,54 +675,83 @@ static int process_query_out(knot_layer_t *ctx, knot_pkt_t *pkt)
 	}
 
 	/* Postprocessing. */
-	if (next_state == KNOT_STATE_DONE || next_state == KNOT_STATE_PRODUCE) {
-		/* Restore original QNAME. */
-		process_query_qname_case_restore(pkt, qdata);
-
-		/* Move to Additionals to add OPT and TSIG. */
-		if (pkt->current != KNOT_ADDITIONAL) {
-			(void)knot_pkt_begin(pkt, KNOT_ADDITIONAL);
-		}
-
-		/* Put OPT RR to the additional section. */
-		if (answer_edns_put(pkt, qdata) != KNOT_EOK) {
-			qdata->rcode = KNOT_RCODE_FORMERR;
-			next_state = KNOT_STATE_FAIL;
-			goto finish;
-		}
-
-		/* Transaction security (if applicable). */
-		if (process_query_sign_response(pkt, qdata) != KNOT_EOK) {
-			next_state = KNOT_STATE_FAIL;
-			goto finish;
-		}
-	}
+	next_state = answer_postprocess(next_state, pkt, qdata);
 
 finish:
-	switch (next_state) {
-	case KNOT_STATE_NOOP:
-		break;
-	case KNOT_STATE_FAIL:
-		/* Error processing. */
-		next_state = process_query_err(ctx, pkt);
-		break;
-	case KNOT_STATE_FINAL:
-		/* Just skipped postprocessing. */
-		next_state = KNOT_STATE_DONE;
-		break;
-	default:
-		set_rcode_to_packet(pkt, qdata);
-	}
+	next_state = answer_finish(next_state, pkt, qdata);
 
 	/* After query processing code. */
 	PROCESS_END(plan, step, next_state, qdata);
 	PROCESS_END(zone_plan, step, next_state, qdata);
+	process_batch(next_state, pkt, qdata, plan, zone_plan);
 
 	rcu_read_unlock();
 
 	return next_state;
 }
 
+int process_query_fast(knot_pkt_t *query, knot_pkt_t *resp,
+                       knotd_qdata_params_t *params, knot_mm_t *mm)
+{
+	assert(query && resp && params && mm);
+
+	/* Only a single question with an optional OPT. */
+	const uint8_t *wire = query->wire;
+	if (query->size < KNOT_WIRE_HEADER_SIZE || knot_wire_get_qr(wire) ||
+	    knot_wire_get_opcode(wire) != KNOT_OPCODE_QUERY ||
+	    knot_wire_get_qdcount(wire) != 1 || knot_wire_get_ancount(wire) != 0 ||
+	    knot_wire_get_nscount(wire) != 0 || knot_wire_get_arcount(wire) > 1) {
+		return KNOT_ENOTSUP;
+	}
+
+	/* Just the question and the additional record are parsed. */
+	if (knot_pkt_parse(query, 0) != KNOT_EOK || query->tsig_rr != NULL ||
+	    knot_wire_get_arcount(wire) != (query->opt_rr != NULL) ||
+	    query_type(query) != KNOTD_QUERY_TYPE_NORMAL ||
+	    knot_pkt_qclass(query) != KNOT_CLASS_IN) {
+		return KNOT_ENOTSUP;
+	}
+
+	rcu_read_lock();
+
+	/* Global query modules. */
+	if (conf()->query_plan != NULL) {
+		rcu_read_unlock();
+		return KNOT_ENOTSUP;
+	}
+
+	knotd_qdata_t qdata;
+	knotd_qdata_extra_t extra;
+	query_data_init(&qdata, params, &extra, mm);
+	qdata.query = query;
+	qdata.type = KNOTD_QUERY_TYPE_NORMAL;
+
+	int state = KNOT_STATE_FAIL;
+	if (prepare_answer(query, resp, &qdata) == KNOT_EOK) {
+		/* Zone query modules, revert the QNAME case and fall back. */
+		if (extra.zone != NULL && extra.zone->query_plan != NULL) {
+			memcpy(query->wire + KNOT_WIRE_HEADER_SIZE, extra.orig_qname,
+			       query->qname_size);
+			query_data_clear(&qdata);
+			rcu_read_unlock();
+			return KNOT_ENOTSUP;
+		}
+
+		state = internet_process_query(resp, &qdata);
+		state = answer_postprocess(state, resp, &qdata);
+	}
+	state = answer_finish(state, resp, &qdata);
+
+	query_data_clear(&qdata);
+	rcu_read_unlock();
+
+	if (state != KNOT_STATE_DONE) {
+		resp->size = 0;
+	}
+
+	return KNOT_EOK;
+}
+
 bool process_query_acl_check(conf_t *conf, acl_action_t action,
                              knotd_qdata_t *qdata)
 {
@@ -34,6 +34,7 @@ typedef struct knotd_qdata_extra {
 
 	/* Currently processed nodes. */
 	const zone_node_t *node, *encloser, *previous;
+	const zone_node_t *target; /*!< Linked node of the followed CNAME target. */
 
 	/* Original QNAME case. */
 	knot_dname_storage_t orig_qname;
@@ -59,6 +60,25 @@ struct rrsig_info {
 	knot_rrinfo_t *rrinfo;    /* RR info. */
 };
 
+/*!
+ * \brief Answer a plain query directly, without the processing layer.
+ *
+ * Only a normal IN class query with a single question and an optional OPT
+ * is answered, if there are no query modules for it. The QNAME zone is
+ * looked up and the query is answered by internet_process_query() with the
+ * same result as the regular processing.
+ *
+ * \param query   Query packet (not parsed).
+ * \param resp    Response packet.
+ * \param params  Query processing parameters.
+ * \param mm      Memory context for the processing.
+ *
+ * \retval KNOT_EOK if answered, resp->size is zero if no response is sent.
+ * \retval KNOT_ENOTSUP if the query must be processed by the layer.
+ */
+int process_query_fast(knot_pkt_t *query, knot_pkt_t *resp,
+                       knotd_qdata_params_t *params, knot_mm_t *mm);
+
 /*!
  * \brief Check current query against ACL.
  *
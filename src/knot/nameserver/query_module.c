@@ -20,6 +20,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "contrib/mempattern.h"
 #include "contrib/sockaddr.h"
 #include "libknot/attribute.h"
 #include "knot/common/log.h"
@@ -57,6 +58,7 @@ struct query_plan *query_plan_create(void)
 	for (unsigned i = 0; i < KNOTD_STAGES; ++i) {
 		init_list(&plan->stage[i]);
 	}
+	init_list(&plan->batch);
 
 	return plan;
 }
@@ -74,6 +76,11 @@ void query_plan_free(struct query_plan *plan)
 		}
 	}
 
+	struct query_batch_step *step, *next;
+	WALK_LIST_DELSAFE(step, next, plan->batch) {
+		free(step);
+	}
+
 	free(plan);
 }
 
@@ -123,6 +130,134 @@ int knotd_mod_in_hook(knotd_mod_t *mod, knotd_stage_t stage, knotd_mod_in_hook_f
 	return query_plan_step(mod->plan, stage, hook, mod);
 }
 
+_public_
+int knotd_mod_batch_hook(knotd_mod_t *mod, knotd_mod_batch_hook_f hook)
+{
+	if (mod == NULL || hook == NULL) {
+		return KNOT_EINVAL;
+	}
+
+	struct query_batch_step *step = calloc(1, sizeof(*step));
+	if (step == NULL) {
+		return KNOT_ENOMEM;
+	}
+
+	step->mod = mod;
+	step->process = hook;
+	add_tail(&mod->plan->batch, &step->node);
+
+	return KNOT_EOK;
+}
+
+void query_plan_batch(struct query_plan *plan, const knotd_batch_query_t *queries,
+                      unsigned count)
+{
+	struct query_batch_step *step;
+	WALK_LIST(step, plan->batch) {
+		step->process(queries, count, step->mod);
+	}
+}
+
+int query_batch_init(query_batch_t *batch, unsigned max_count, knot_mm_t *mm)
+{
+	if (batch == NULL || max_count == 0 || mm == NULL) {
+		return KNOT_EINVAL;
+	}
+
+	memset(batch, 0, sizeof(*batch));
+	batch->queries = calloc(max_count, sizeof(*batch->queries));
+	batch->plans = calloc(2 * max_count, sizeof(*batch->plans));
+	batch->group = calloc(max_count, sizeof(*batch->group));
+	if (batch->queries == NULL || batch->plans == NULL || batch->group == NULL) {
+		query_batch_deinit(batch);
+		return KNOT_ENOMEM;
+	}
+	batch->max_count = max_count;
+	batch->mm = mm;
+
+	return KNOT_EOK;
+}
+
+void query_batch_deinit(query_batch_t *batch)
+{
+	if (batch == NULL) {
+		return;
+	}
+
+	free(batch->queries);
+	free(batch->plans);
+	free(batch->group);
+	memset(batch, 0, sizeof(*batch));
+}
+
+int query_batch_add(query_batch_t *batch, knotd_state_t state, knot_pkt_t *pkt,
+                    knotd_qdata_t *qdata, struct query_plan *plan,
+                    struct query_plan *zone_plan)
+{
+	if (batch == NULL || pkt == NULL || qdata == NULL) {
+		return KNOT_EINVAL;
+	}
+
+	if (batch->count == batch->max_count) {
+		query_batch_flush(batch);
+	}
+
+	/* The query data are reinitialized after each query. */
+	knotd_qdata_t *copy = mm_alloc(batch->mm, sizeof(*copy));
+	knotd_qdata_extra_t *extra = mm_alloc(batch->mm, sizeof(*extra));
+	knotd_qdata_params_t *params = mm_alloc(batch->mm, sizeof(*params));
+	if (copy == NULL || extra == NULL || params == NULL) {
+		return KNOT_ENOMEM;
+	}
+	*copy = *qdata;
+	*extra = *qdata->extra;
+	*params = *qdata->params;
+	copy->extra = extra;
+	copy->params = params;
+	knot_rrset_init_empty(&copy->opt_rr);
+	init_list(&extra->wildcards);
+	init_list(&extra->rrsigs);
+	extra->ext = NULL;
+	extra->ext_cleanup = NULL;
+
+	unsigned idx = batch->count++;
+	batch->queries[idx] = (knotd_batch_query_t) {
+		.state = state,
+		.pkt = pkt,
+		.qdata = copy
+	};
+	batch->plans[2 * idx] = plan;
+	batch->plans[2 * idx + 1] = zone_plan;
+
+	return KNOT_EOK;
+}
+
+void query_batch_flush(query_batch_t *batch)
+{
+	if (batch == NULL) {
+		return;
+	}
+
+	/* Each plan is called once with all its queries. */
+	for (unsigned i = 0; i < 2 * batch->count; i++) {
+		struct query_plan *plan = batch->plans[i];
+		if (plan == NULL) {
+			continue;
+		}
+
+		unsigned count = 0;
+		for (unsigned j = i; j < 2 * batch->count; j++) {
+			if (batch->plans[j] == plan) {
+				batch->group[count++] = batch->queries[j / 2];
+				batch->plans[j] = NULL;
+			}
+		}
+		query_plan_batch(plan, batch->group, count);
+	}
+
+	batch->count = 0;
+}
+
 knotd_mod_t *query_module_open(conf_t *conf, conf_mod_id_t *mod_id,
                                struct query_plan *plan, const knot_dname_t *zone)
 {
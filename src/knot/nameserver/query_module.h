@@ -41,12 +41,20 @@ struct query_step {
 	query_step_process_f process;
 };
 
+/*! \brief Batch processing step called after the last stage. */
+struct query_batch_step {
+	node_t node;
+	knotd_mod_t *mod;
+	knotd_mod_batch_hook_f process;
+};
+
 /*! Query plan represents a sequence of steps needed for query processing
  *  divided into several stages, where each stage represents a current response
  *  assembly phase, for example 'before processing', 'answer section' and so on.
  */
 struct query_plan {
 	list_t stage[KNOTD_STAGES];
+	list_t batch; /*!< Batch processing steps. */
 };
 
 /*! \brief Create an empty query plan. */
@@ -59,6 +67,42 @@ void query_plan_free(struct query_plan *plan);
 int query_plan_step(struct query_plan *plan, knotd_stage_t stage,
                     query_step_process_f process, void *ctx);
 
+/*! \brief Call the batch processing steps of the plan. */
+void query_plan_batch(struct query_plan *plan, const knotd_batch_query_t *queries,
+                      unsigned count);
+
+/*!
+ * \brief Answered queries waiting for the batch processing steps.
+ *
+ * The query data are copied, the packets must stay valid until flushed.
+ */
+typedef struct {
+	knotd_batch_query_t *queries; /*!< Collected queries. */
+	struct query_plan **plans;    /*!< Global and zone plan of each query. */
+	knotd_batch_query_t *group;   /*!< Queries of one plan. */
+	unsigned count;               /*!< Number of collected queries. */
+	unsigned max_count;           /*!< Capacity. */
+	knot_mm_t *mm;                /*!< Memory context for the copies. */
+} query_batch_t;
+
+/*! \brief Initialize the batch queue for up to 'max_count' queries. */
+int query_batch_init(query_batch_t *batch, unsigned max_count, knot_mm_t *mm);
+
+/*! \brief Free the batch queue. */
+void query_batch_deinit(query_batch_t *batch);
+
+/*!
+ * \brief Add an answered query for the batch steps of the given plans.
+ *
+ * The batch is flushed first if full.
+ */
+int query_batch_add(query_batch_t *batch, knotd_state_t state, knot_pkt_t *pkt,
+                    knotd_qdata_t *qdata, struct query_plan *plan,
+                    struct query_plan *zone_plan);
+
+/*! \brief Call the batch steps for all collected queries, grouped by plan. */
+void query_batch_flush(query_batch_t *batch);
+
 /*! \brief Open query module identified by name. */
 knotd_mod_t *query_module_open(conf_t *conf, conf_mod_id_t *mod_id,
                                struct query_plan *plan, const knot_dname_t *zone);
@@ -0,0 +1,141 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include "knot/nameserver/query_prefetch.h"
+#include "knot/zone/zone.h"
+#include "libknot/libknot.h"
+
+typedef char static_assert_batch_fits_zone_tree
+	[QUERY_PREFETCH_BATCH <= ZONE_TREE_BATCH ? 1 : -1];
+
+/*! \brief Extract the lowercased QNAME and QTYPE of a plain IN query. */
+static bool parse_question(const struct iovec *query, query_prefetch_t *out)
+{
+	const uint8_t *wire = query->iov_base;
+	const uint8_t *end = wire + query->iov_len;
+
+	if (query->iov_len < KNOT_WIRE_HEADER_SIZE || knot_wire_get_qr(wire) ||
+	    knot_wire_get_opcode(wire) != KNOT_OPCODE_QUERY ||
+	    knot_wire_get_qdcount(wire) != 1) {
+		return false;
+	}
+
+	const uint8_t *qname = wire + KNOT_WIRE_HEADER_SIZE;
+	int qname_size = knot_dname_wire_check(qname, end, NULL);
+	if (qname_size <= 0 || qname + qname_size + 2 * sizeof(uint16_t) > end) {
+		return false;
+	}
+
+	/* DS is answered from the parent zone, transfers are not answered here. */
+	uint16_t qtype = knot_wire_read_u16(qname + qname_size);
+	uint16_t qclass = knot_wire_read_u16(qname + qname_size + sizeof(uint16_t));
+	if (qclass != KNOT_CLASS_IN || qtype == 0 || qtype == KNOT_RRTYPE_DS ||
+	    qtype == KNOT_RRTYPE_AXFR || qtype == KNOT_RRTYPE_IXFR) {
+		return false;
+	}
+
+	memcpy(out->qname, qname, qname_size);
+	knot_dname_to_lower(out->qname);
+	out->qtype = qtype;
+
+	return true;
+}
+
+void query_prefetch(knot_zonedb_t *zonedb, const struct iovec *queries,
+                    unsigned count, query_prefetch_t *out)
+{
+	assert(count <= QUERY_PREFETCH_BATCH);
+
+	/* Stage 1: parse the questions, find the zones. */
+	for (unsigned i = 0; i < count; i++) {
+		out[i].zone = NULL;
+		if (!parse_question(&queries[i], &out[i])) {
+			continue;
+		}
+		zone_t *zone = knot_zonedb_find_suffix(zonedb, out[i].qname);
+		if (zone == NULL || zone->contents == NULL) {
+			continue;
+		}
+		out[i].zone = zone;
+		out[i].contents = zone->contents;
+		__builtin_prefetch(out[i].contents);
+	}
+
+	/* Stage 2: find the nodes in the zone trees, batched per zone. */
+	bool pending[QUERY_PREFETCH_BATCH];
+	for (unsigned i = 0; i < count; i++) {
+		pending[i] = (out[i].zone != NULL);
+	}
+	for (unsigned i = 0; i < count; i++) {
+		if (!pending[i]) {
+			continue;
+		}
+		const zone_contents_t *contents = out[i].contents;
+		const knot_dname_t *owners[QUERY_PREFETCH_BATCH];
+		zone_node_t *nodes[QUERY_PREFETCH_BATCH];
+		unsigned lanes[QUERY_PREFETCH_BATCH];
+		unsigned n = 0;
+		for (unsigned j = i; j < count; j++) {
+			if (pending[j] && out[j].contents == contents) {
+				pending[j] = false;
+				owners[n] = out[j].qname;
+				lanes[n++] = j;
+			}
+		}
+		zone_tree_get_batch(contents->nodes, owners, n, nodes);
+
+		for (unsigned k = 0; k < n; k++) {
+			query_prefetch_t *p = &out[lanes[k]];
+			if (nodes[k] != NULL) {
+				p->found = ZONE_NAME_FOUND;
+				p->node = p->encloser = nodes[k];
+				p->previous = node_prev(nodes[k]);
+				__builtin_prefetch(p->node);
+				continue;
+			}
+			/* Not found, the closest encloser is needed. */
+			p->found = zone_contents_find_dname(p->contents, p->qname, &p->node,
+			                                    &p->encloser, &p->previous);
+			if (p->found != ZONE_NAME_NOT_FOUND) {
+				p->zone = NULL; /* Error, leave it on the query. */
+			}
+		}
+	}
+
+	/* Stage 3: prefetch the RRSet headers of the nodes. */
+	for (unsigned i = 0; i < count; i++) {
+		if (out[i].zone != NULL && out[i].found == ZONE_NAME_FOUND) {
+			__builtin_prefetch(out[i].node->rrs);
+		}
+	}
+
+	/* Stage 4: prefetch the RDATA of the requested type. */
+	for (unsigned i = 0; i < count; i++) {
+		if (out[i].zone == NULL || out[i].found != ZONE_NAME_FOUND) {
+			continue;
+		}
+		const zone_node_t *node = out[i].node;
+		for (uint16_t j = 0; j < node->rrset_count; j++) {
+			if (node->rrs[j].type == out[i].qtype) {
+				__builtin_prefetch(node->rrs[j].rrs.rdata);
+				break;
+			}
+		}
+	}
+}
@@ -0,0 +1,80 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \brief Staged cache warm-up for batches of received queries.
+ */
+
+#pragma once
+
+#include <sys/uio.h>
+
+#include "knot/zone/zonedb.h"
+#include "libknot/packet/pkt.h"
+
+/*! \brief Maximum number of queries prefetched at once. */
+#define QUERY_PREFETCH_BATCH 16
+
+/*!
+ * \brief Lookup results of a prefetched query.
+ *
+ * The results are valid only in the RCU read-side critical section in which
+ * they were obtained.
+ */
+typedef struct query_prefetch {
+	const zone_t *zone;              /*!< Zone of the QNAME, NULL if not looked up. */
+	const zone_contents_t *contents; /*!< Zone contents the nodes belong to. */
+	const zone_node_t *node;         /*!< Matching node. */
+	const zone_node_t *encloser;     /*!< Closest encloser. */
+	const zone_node_t *previous;     /*!< Previous node in canonical order. */
+	int found;                       /*!< Result of zone_contents_find_dname(). */
+	uint16_t qtype;                  /*!< Query type. */
+	knot_dname_storage_t qname;      /*!< Lowercased query name. */
+} query_prefetch_t;
+
+/*!
+ * \brief Look up and prefetch the zone data for answering a batch of queries.
+ *
+ * The lookups are done in stages over the whole batch: parsing of the
+ * questions and zone lookup, node lookup, and prefetching of the node data.
+ * The memory accesses of each stage are independent across the queries,
+ * so the cache misses overlap instead of stalling each query one by one.
+ * The queries are then answered as usual, reusing the lookup results.
+ *
+ * Only plain IN class queries are looked up, other queries are skipped.
+ *
+ * \param zonedb   Zone database.
+ * \param queries  Received query messages.
+ * \param count    Number of queries, at most QUERY_PREFETCH_BATCH.
+ * \param out      Lookup results for each query.
+ *
+ * \note The caller must be in an RCU read-side critical section, which
+ *       lasts until the queries are answered.
+ */
+void query_prefetch(knot_zonedb_t *zonedb, const struct iovec *queries,
+                    unsigned count, query_prefetch_t *out);
+
+/*!
+ * \brief Check if the prefetched results belong to the (parsed) query.
+ */
+static inline bool query_prefetch_match(const query_prefetch_t *prefetch,
+                                        const knot_pkt_t *query)
+{
+	return prefetch != NULL && prefetch->zone != NULL &&
+	       knot_pkt_qclass(query) == KNOT_CLASS_IN &&
+	       knot_pkt_qtype(query) == prefetch->qtype &&
+	       knot_dname_is_equal(knot_pkt_qname(query), prefetch->qname);
+}
@@ -0,0 +1,237 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <poll.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "knot/query/conn_pool.h"
+#include "libknot/errcode.h"
+#include "contrib/sockaddr.h"
+#include "contrib/time.h"
+
+conn_pool_t *global_conn_pool = NULL;
+
+static time_t pool_now(void)
+{
+	return time_now().tv_sec;
+}
+
+static bool addr_match(const struct sockaddr_storage *a,
+                       const struct sockaddr_storage *b)
+{
+	bool a_any = (a == NULL || a->ss_family == AF_UNSPEC);
+	bool b_any = (b == NULL || b->ss_family == AF_UNSPEC);
+	if (a_any || b_any) {
+		return a_any && b_any;
+	}
+	return sockaddr_cmp(a, b) == 0;
+}
+
+static void addr_copy(struct sockaddr_storage *dst, const struct sockaddr_storage *src)
+{
+	if (src == NULL || src->ss_family == AF_UNSPEC) {
+		memset(dst, 0, sizeof(*dst));
+		dst->ss_family = AF_UNSPEC;
+	} else {
+		memcpy(dst, src, sockaddr_len(src));
+	}
+}
+
+/*! \brief Close i-th connection and fill its place with the last one. */
+static void pool_remove(conn_pool_t *pool, size_t i)
+{
+	close(pool->conns[i].fd);
+	pool->conns[i] = pool->conns[--pool->usage];
+}
+
+/*! \brief Find the least recently used connection. */
+static size_t pool_oldest(const conn_pool_t *pool)
+{
+	size_t oldest = 0;
+	for (size_t i = 1; i < pool->usage; i++) {
+		if (pool->conns[i].last_active < pool->conns[oldest].last_active) {
+			oldest = i;
+		}
+	}
+	return oldest;
+}
+
+static void pool_close_expired(conn_pool_t *pool, time_t now)
+{
+	for (size_t i = 0; i < pool->usage; ) {
+		if (now - pool->conns[i].last_active >= pool->timeout) {
+			pool_remove(pool, i);
+		} else {
+			i++;
+		}
+	}
+}
+
+/*! \brief Check if the remote closed the connection or sent unexpected data. */
+static bool conn_is_idle(int fd)
+{
+	struct pollfd pfd = { .fd = fd, .events = POLLIN };
+	return poll(&pfd, 1, 0) == 0;
+}
+
+conn_pool_t *conn_pool_init(size_t capacity, time_t timeout)
+{
+	conn_pool_t *pool = calloc(1, sizeof(*pool));
+	if (pool == NULL) {
+		return NULL;
+	}
+
+	if (pthread_mutex_init(&pool->mutex, NULL) != 0) {
+		free(pool);
+		return NULL;
+	}
+
+	if (conn_pool_set(pool, capacity, timeout) != KNOT_EOK) {
+		pthread_mutex_destroy(&pool->mutex);
+		free(pool);
+		return NULL;
+	}
+
+	return pool;
+}
+
+void conn_pool_deinit(conn_pool_t *pool)
+{
+	if (pool == NULL) {
+		return;
+	}
+
+	while (pool->usage > 0) {
+		pool_remove(pool, 0);
+	}
+
+	pthread_mutex_destroy(&pool->mutex);
+	free(pool->conns);
+	free(pool);
+}
+
+int conn_pool_set(conn_pool_t *pool, size_t capacity, time_t timeout)
+{
+	if (pool == NULL) {
+		return KNOT_EINVAL;
+	}
+
+	pthread_mutex_lock(&pool->mutex);
+
+	/* Keep the most recently used connections. */
+	while (pool->usage > capacity) {
+		pool_remove(pool, pool_oldest(pool));
+	}
+
+	if (capacity != pool->capacity) {
+		conn_pool_memb_t *conns = NULL;
+		if (capacity > 0) {
+			conns = realloc(pool->conns, capacity * sizeof(*conns));
+			if (conns == NULL) {
+				pthread_mutex_unlock(&pool->mutex);
+				return KNOT_ENOMEM;
+			}
+		} else {
+			free(pool->conns);
+		}
+		pool->conns = conns;
+		pool->capacity = capacity;
+	}
+	pool->timeout = timeout;
+
+	pthread_mutex_unlock(&pool->mutex);
+
+	return KNOT_EOK;
+}
+
+int conn_pool_get(conn_pool_t *pool, const struct sockaddr_storage *src,
+                  const struct sockaddr_storage *dst)
+{
+	if (pool == NULL || dst == NULL) {
+		return -1;
+	}
+
+	int fd = -1;
+
+	pthread_mutex_lock(&pool->mutex);
+
+	pool_close_expired(pool, pool_now());
+
+	while (fd < 0) {
+		/* Prefer the most recently used connection. */
+		size_t found = pool->usage;
+		for (size_t i = 0; i < pool->usage; i++) {
+			conn_pool_memb_t *conn = &pool->conns[i];
+			if (addr_match(&conn->dst, dst) && addr_match(&conn->src, src) &&
+			    (found == pool->usage ||
+			     conn->last_active > pool->conns[found].last_active)) {
+				found = i;
+			}
+		}
+		if (found == pool->usage) {
+			break;
+		}
+
+		if (conn_is_idle(pool->conns[found].fd)) {
+			fd = pool->conns[found].fd;
+			pool->conns[found] = pool->conns[--pool->usage];
+		} else {
+			pool_remove(pool, found);
+		}
+	}
+
+	pthread_mutex_unlock(&pool->mutex);
+
+	return fd;
+}
+
+void conn_pool_put(conn_pool_t *pool, const struct sockaddr_storage *src,
+                   const struct sockaddr_storage *dst, int fd)
+{
+	if (fd < 0) {
+		return;
+	}
+	if (pool == NULL || dst == NULL) {
+		close(fd);
+		return;
+	}
+
+	pthread_mutex_lock(&pool->mutex);
+
+	time_t now = pool_now();
+	pool_close_expired(pool, now);
+
+	if (pool->capacity == 0 || pool->timeout == 0) {
+		pthread_mutex_unlock(&pool->mutex);
+		close(fd);
+		return;
+	}
+
+	/* Replace the least recently used connection if full. */
+	if (pool->usage == pool->capacity) {
+		pool_remove(pool, pool_oldest(pool));
+	}
+
+	conn_pool_memb_t *conn = &pool->conns[pool->usage++];
+	addr_copy(&conn->src, src);
+	addr_copy(&conn->dst, dst);
+	conn->fd = fd;
+	conn->last_active = now;
+
+	pthread_mutex_unlock(&pool->mutex);
+}
@@ -0,0 +1,97 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <sys/socket.h>
+#include <time.h>
+
+/*! \brief Idle outgoing TCP connection. */
+typedef struct {
+	struct sockaddr_storage src; /*!< Local address (AF_UNSPEC if any). */
+	struct sockaddr_storage dst; /*!< Remote address. */
+	int fd;                      /*!< Connected socket. */
+	time_t last_active;          /*!< Monotonic time of the last use. */
+} conn_pool_memb_t;
+
+/*!
+ * \brief Pool of idle outgoing TCP connections.
+ *
+ * Connections are keyed by the local and remote address. Connections idle
+ * for longer than the timeout are closed, the least recently used one is
+ * closed if the pool is full.
+ */
+typedef struct {
+	size_t capacity;         /*!< Maximum number of kept connections. */
+	size_t usage;            /*!< Number of kept connections. */
+	time_t timeout;          /*!< Idle timeout (seconds). */
+	pthread_mutex_t mutex;   /*!< Pool lock. */
+	conn_pool_memb_t *conns; /*!< Kept connections. */
+} conn_pool_t;
+
+/*! \brief Server-wide pool of connections to remote servers. */
+extern conn_pool_t *global_conn_pool;
+
+/*!
+ * \brief Create a connection pool.
+ *
+ * \param capacity  Maximum number of kept connections (0 disables pooling).
+ * \param timeout   Idle timeout in seconds.
+ *
+ * \return Connection pool or NULL if error.
+ */
+conn_pool_t *conn_pool_init(size_t capacity, time_t timeout);
+
+/*!
+ * \brief Close all kept connections and free the pool.
+ */
+void conn_pool_deinit(conn_pool_t *pool);
+
+/*!
+ * \brief Change pool limits, close connections above the new capacity.
+ *
+ * \return KNOT_EOK, KNOT_ENOMEM
+ */
+int conn_pool_set(conn_pool_t *pool, size_t capacity, time_t timeout);
+
+/*!
+ * \brief Take a kept connection to the remote.
+ *
+ * Connections which were closed by the remote meanwhile are discarded.
+ *
+ * \param pool  Connection pool (can be NULL).
+ * \param src   Local address (AF_UNSPEC or NULL if any).
+ * \param dst   Remote address.
+ *
+ * \return Connected socket or -1 if none.
+ */
+int conn_pool_get(conn_pool_t *pool, const struct sockaddr_storage *src,
+                  const struct sockaddr_storage *dst);
+
+/*!
+ * \brief Return a connection for later use.
+ *
+ * The pool takes ownership of the socket, it's closed if it can't be kept.
+ *
+ * \param pool  Connection pool (can be NULL).
+ * \param src   Local address (AF_UNSPEC or NULL if any).
+ * \param dst   Remote address.
+ * \param fd    Connected socket with no pending messages.
+ */
+void conn_pool_put(conn_pool_t *pool, const struct sockaddr_storage *src,
+                   const struct sockaddr_storage *dst, int fd);
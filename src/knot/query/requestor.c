@@ -15,13 +15,32 @@
  */
 
 #include <assert.h>
+#include <errno.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 
+#include "libdnssec/random.h"
 #include "libknot/attribute.h"
+#include "knot/query/conn_pool.h"
 #include "knot/query/requestor.h"
 #include "libknot/errcode.h"
+#include "libknot/wire.h"
+#include "contrib/macros.h"
 #include "contrib/mempattern.h"
 #include "contrib/net.h"
+#include "contrib/qp-trie/trie.h"
 #include "contrib/sockaddr.h"
+#include "contrib/time.h"
+#include "contrib/ucw/lists.h"
+
+/*
+ * OS X doesn't support MSG_NOSIGNAL, the sockets use SO_NOSIGPIPE instead.
+ */
+#ifndef MSG_NOSIGNAL
+#  define MSG_NOSIGNAL 0
+#endif
 
 static bool use_tcp(knot_request_t *request)
 {
@@ -33,13 +52,31 @@ static bool is_answer_to_query(const knot_pkt_t *query, const knot_pkt_t *answer
 	return knot_wire_get_id(query->wire) == knot_wire_get_id(answer->wire);
 }
 
-/*! \brief Ensure a socket is connected. */
-static int request_ensure_connected(knot_request_t *request)
+static bool use_pool(knot_request_t *request)
+{
+	return use_tcp(request) && (request->flags & KNOT_REQUEST_REUSE);
+}
+
+/*!
+ * \brief Ensure a socket is connected.
+ *
+ * \param reused  Set if a pooled connection was taken (NULL to avoid the pool).
+ */
+static int request_ensure_connected(knot_request_t *request, bool *reused)
 {
 	if (request->fd >= 0) {
 		return KNOT_EOK;
 	}
 
+	if (reused != NULL && use_pool(request)) {
+		request->fd = conn_pool_get(global_conn_pool, &request->source,
+		                            &request->remote);
+		if (request->fd >= 0) {
+			*reused = true;
+			return KNOT_EOK;
+		}
+	}
+
 	int sock_type = use_tcp(request) ? SOCK_STREAM : SOCK_DGRAM;
 	request->fd = net_connected_socket(sock_type,
 	                                   &request->remote,
@@ -51,61 +88,6 @@ static int request_ensure_connected(knot_request_t *request)
 	return KNOT_EOK;
 }
 
-static int request_send(knot_request_t *request, int timeout_ms)
-{
-	/* Initiate non-blocking connect if not connected. */
-	int ret = request_ensure_connected(request);
-	if (ret != KNOT_EOK) {
-		return ret;
-	}
-
-	/* Send query, construct if not exists. */
-	knot_pkt_t *query = request->query;
-	uint8_t *wire = query->wire;
-	size_t wire_len = query->size;
-
-	/* Send query. */
-	if (use_tcp(request)) {
-		ret = net_dns_tcp_send(request->fd, wire, wire_len, timeout_ms);
-	} else {
-		ret = net_dgram_send(request->fd, wire, wire_len, NULL);
-	}
-	if (ret != wire_len) {
-		return KNOT_ECONN;
-	}
-
-	return KNOT_EOK;
-}
-
-static int request_recv(knot_request_t *request, int timeout_ms)
-{
-	knot_pkt_t *resp = request->resp;
-	knot_pkt_clear(resp);
-
-	/* Wait for readability */
-	int ret = request_ensure_connected(request);
-	if (ret != KNOT_EOK) {
-		return ret;
-	}
-
-	/* Receive it */
-	if (use_tcp(request)) {
-		ret = net_dns_tcp_recv(request->fd, resp->wire, resp->max_size, timeout_ms);
-	} else {
-		ret = net_dgram_recv(request->fd, resp->wire, resp->max_size, timeout_ms);
-	}
-	if (ret <= 0) {
-		resp->size = 0;
-		if (ret == 0) {
-			return KNOT_ECONN;
-		}
-		return ret;
-	}
-
-	resp->size = ret;
-	return ret;
-}
-
 knot_request_t *knot_request_make(knot_mm_t *mm,
                                   const struct sockaddr_storage *remote,
                                   const struct sockaddr_storage *source,
@@ -152,7 +134,11 @@ void knot_request_free(knot_request_t *request, knot_mm_t *mm)
 		return;
 	}
 
-	if (request->fd >= 0) {
+	/* The connection is clean, failed exchanges close it. */
+	if (request->fd >= 0 && use_pool(request)) {
+		conn_pool_put(global_conn_pool, &request->source, &request->remote,
+		              request->fd);
+	} else if (request->fd >= 0) {
 		close(request->fd);
 	}
 	knot_pkt_free(request->query);
@@ -190,6 +176,63 @@ void knot_requestor_clear(knot_requestor_t *requestor)
 	memset(requestor, 0, sizeof(*requestor));
 }
 
+/*!
+ * \brief I/O phase of a request driven by the multiplexed loop.
+ *
+ * The processing layer is stepped synchronously until it needs the network;
+ * the request then waits in the send or receive phase until its socket is
+ * ready, so a slow remote never blocks the other requests.
+ */
+enum request_phase {
+	PHASE_STEP = 0, /*!< Drive the processing layer. */
+	PHASE_SEND,     /*!< Query is being written. */
+	PHASE_RECV,     /*!< Response is being read. */
+	PHASE_DONE,     /*!< Request finished, result is set. */
+};
+
+/*! \brief Progress of a request within the multiplexed loop. */
+struct request_io {
+	enum request_phase phase;
+	size_t done;       /*!< Bytes transferred in the current phase. */
+	uint8_t len[2];    /*!< DNS over TCP message length prefix. */
+	int64_t deadline;  /*!< Deadline of the current phase (-1 for none). */
+	bool reused;       /*!< Pooled connection, not yet proven alive. */
+};
+
+/*! \brief Header size of a DNS over TCP message. */
+#define TCP_LEN_SIZE 2
+
+static int64_t now_ms(void)
+{
+	struct timespec now = time_now();
+	return (int64_t)now.tv_sec * 1000 + now.tv_nsec / 1000000;
+}
+
+static void phase_start(struct request_io *io, enum request_phase phase,
+                        int timeout_ms)
+{
+	io->phase = phase;
+	io->done = 0;
+	io->deadline = (timeout_ms < 0) ? -1 : now_ms() + timeout_ms;
+}
+
+/*! \brief Check if a failed non-blocking operation should be retried. */
+static bool io_again(int error)
+{
+	if (error == EAGAIN || error == EWOULDBLOCK || error == EINTR) {
+		return true;
+	}
+
+#ifndef __linux__
+	/* FreeBSD: connection in progress */
+	if (error == ENOTCONN) {
+		return true;
+	}
+#endif
+
+	return false;
+}
+
 static int request_reset(knot_requestor_t *req, knot_request_t *last)
 {
 	knot_layer_reset(&req->layer);
@@ -211,7 +254,7 @@ static int request_reset(knot_requestor_t *req, knot_request_t *last)
 }
 
 static int request_produce(knot_requestor_t *req, knot_request_t *last,
-                           int timeout_ms)
+                           struct request_io *io, int timeout_ms)
 {
 	knot_layer_produce(&req->layer, last->query);
 
@@ -222,21 +265,24 @@ static int request_produce(knot_requestor_t *req, knot_request_t *last,
 
 	// TODO: verify condition
 	if (req->layer.state == KNOT_STATE_CONSUME) {
-		ret = request_send(last, timeout_ms);
+		/* Initiate non-blocking connect if not connected. */
+		ret = request_ensure_connected(last, &io->reused);
+		if (ret != KNOT_EOK) {
+			return ret;
+		}
+		if (last->query->size > UINT16_MAX) {
+			return KNOT_ESPACE;
+		}
+		knot_wire_write_u16(io->len, last->query->size);
+		phase_start(io, PHASE_SEND, timeout_ms);
 	}
 
-	return ret;
+	return KNOT_EOK;
 }
 
-static int request_consume(knot_requestor_t *req, knot_request_t *last,
-                           int timeout_ms)
+static int request_consume(knot_requestor_t *req, knot_request_t *last)
 {
-	int ret = request_recv(last, timeout_ms);
-	if (ret < 0) {
-		return ret;
-	}
-
-	ret = knot_pkt_parse(last->resp, 0);
+	int ret = knot_pkt_parse(last->resp, 0);
 	if (ret != KNOT_EOK) {
 		return ret;
 	}
@@ -271,53 +317,1107 @@ static bool layer_active(knot_layer_state_t state)
 	}
 }
 
-static int request_io(knot_requestor_t *req, knot_request_t *last,
-                      int timeout_ms)
+/*! \brief Write as much of the pending query as the socket accepts. */
+static int request_io_send(knot_request_t *request, struct request_io *io)
 {
-	switch (req->layer.state) {
-	case KNOT_STATE_CONSUME:
-		return request_consume(req, last, timeout_ms);
-	case KNOT_STATE_PRODUCE:
-		return request_produce(req, last, timeout_ms);
-	case KNOT_STATE_RESET:
-		return request_reset(req, last);
-	default:
-		return KNOT_EINVAL;
+	knot_pkt_t *query = request->query;
+	size_t prefix = use_tcp(request) ? TCP_LEN_SIZE : 0;
+	size_t total = prefix + query->size;
+
+	while (io->done < total) {
+		struct iovec iov[2];
+		int iovcnt = 0;
+		if (io->done < prefix) {
+			iov[iovcnt].iov_base = io->len + io->done;
+			iov[iovcnt].iov_len = prefix - io->done;
+			iovcnt++;
+		}
+		size_t offset = (io->done > prefix) ? io->done - prefix : 0;
+		iov[iovcnt].iov_base = query->wire + offset;
+		iov[iovcnt].iov_len = query->size - offset;
+		iovcnt++;
+
+		struct msghdr msg = {
+			.msg_iov = iov,
+			.msg_iovlen = iovcnt
+		};
+		ssize_t ret = sendmsg(request->fd, &msg, MSG_NOSIGNAL);
+		if (ret < 0) {
+			return io_again(errno) ? KNOT_EAGAIN : KNOT_ECONN;
+		}
+		if (!use_tcp(request) && ret != total) {
+			return KNOT_ECONN;
+		}
+		io->done += ret;
 	}
+
+	return KNOT_EOK;
 }
 
-int knot_requestor_exec(knot_requestor_t *requestor, knot_request_t *request,
-                        int timeout_ms)
+/*! \brief Read as much of the pending response as is available. */
+static int request_io_recv(knot_request_t *request, struct request_io *io)
 {
-	if (requestor == NULL || request == NULL) {
-		return KNOT_EINVAL;
+	knot_pkt_t *resp = request->resp;
+
+	if (!use_tcp(request)) {
+		ssize_t ret = recv(request->fd, resp->wire, resp->max_size, 0);
+		if (ret < 0) {
+			return io_again(errno) ? KNOT_EAGAIN : knot_map_errno();
+		} else if (ret == 0) {
+			return KNOT_ECONN;
+		}
+		resp->size = ret;
+		return KNOT_EOK;
+	}
+
+	while (true) {
+		uint8_t *dst;
+		size_t want;
+		if (io->done < TCP_LEN_SIZE) {
+			dst = io->len + io->done;
+			want = TCP_LEN_SIZE - io->done;
+		} else {
+			size_t msg_len = knot_wire_read_u16(io->len);
+			if (msg_len > resp->max_size) {
+				return KNOT_ESPACE;
+			}
+			size_t have = io->done - TCP_LEN_SIZE;
+			if (have == msg_len) {
+				resp->size = msg_len;
+				return KNOT_EOK;
+			}
+			dst = resp->wire + have;
+			want = msg_len - have;
+		}
+
+		ssize_t ret = recv(request->fd, dst, want, 0);
+		if (ret < 0) {
+			return io_again(errno) ? KNOT_EAGAIN : knot_map_errno();
+		} else if (ret == 0) {
+			return KNOT_ECONN;
+		}
+		io->done += ret;
+	}
+}
+
+/*!
+ * \brief Resend the query over a new connection.
+ *
+ * A pooled connection may have been closed by the remote in the meantime,
+ * which is only detected when used.
+ */
+static int request_reconnect(knot_request_t *last, struct request_io *io,
+                             int timeout_ms)
+{
+	close(last->fd);
+	last->fd = -1;
+	io->reused = false;
+
+	int ret = request_ensure_connected(last, NULL);
+	if (ret != KNOT_EOK) {
+		return ret;
 	}
 
+	phase_start(io, PHASE_SEND, timeout_ms);
+
+	return KNOT_EOK;
+}
+
+/*!
+ * \brief Advance the request as far as possible without blocking.
+ *
+ * \return KNOT_EAGAIN if waiting for the socket, otherwise the result.
+ */
+static int request_step(knot_requestor_t *req, knot_request_t *last,
+                        struct request_io *io, int timeout_ms)
+{
 	int ret = KNOT_EOK;
 
-	requestor->layer.tsig = &request->tsig;
+	while (true) {
+		switch (io->phase) {
+		case PHASE_SEND:
+			ret = request_io_send(last, io);
+			if (ret != KNOT_EOK && ret != KNOT_EAGAIN && io->reused) {
+				ret = request_reconnect(last, io, timeout_ms);
+				if (ret == KNOT_EOK) {
+					continue;
+				}
+			}
+			if (ret != KNOT_EOK) {
+				return ret;
+			}
+			io->phase = PHASE_STEP;
+			continue;
+		case PHASE_RECV:
+			ret = request_io_recv(last, io);
+			if (ret != KNOT_EOK && ret != KNOT_EAGAIN && io->reused &&
+			    io->done == 0) {
+				ret = request_reconnect(last, io, timeout_ms);
+				if (ret == KNOT_EOK) {
+					continue;
+				}
+			}
+			if (ret != KNOT_EOK) {
+				return ret;
+			}
+			io->phase = PHASE_STEP;
+			io->reused = false;
+			ret = request_consume(req, last);
+			if (ret != KNOT_EOK) {
+				return ret;
+			}
+			continue;
+		default:
+			break;
+		}
+
+		if (!layer_active(req->layer.state)) {
+			return KNOT_EOK;
+		}
 
-	/* Do I/O until the processing is satisifed or fails. */
-	while (layer_active(requestor->layer.state)) {
-		ret = request_io(requestor, request, timeout_ms);
+		switch (req->layer.state) {
+		case KNOT_STATE_CONSUME:
+			knot_pkt_clear(last->resp);
+			phase_start(io, PHASE_RECV, timeout_ms);
+			break;
+		case KNOT_STATE_PRODUCE:
+			ret = request_produce(req, last, io, timeout_ms);
+			break;
+		default:
+			ret = request_reset(req, last);
+			break;
+		}
 		if (ret != KNOT_EOK) {
-			knot_layer_finish(&requestor->layer);
 			return ret;
 		}
 	}
+}
+
+/*! \brief Close a failed TCP connection, the stream state is unknown. */
+static void request_disconnect(knot_request_t *last)
+{
+	if (last->fd >= 0 && use_tcp(last)) {
+		close(last->fd);
+		last->fd = -1;
+	}
+}
+
+/*! \brief Evaluate and finish a request which left the processing loop. */
+static int request_complete(knot_requestor_t *req, knot_request_t *last,
+                            struct request_io *io, int ret)
+{
+	if (ret != KNOT_EOK) {
+		/* Don't leave a partially received response behind. */
+		if (io->phase == PHASE_RECV) {
+			knot_pkt_clear(last->resp);
+			last->resp->size = 0;
+		}
+		io->phase = PHASE_DONE;
+		request_disconnect(last);
+		knot_layer_finish(&req->layer);
+		return ret;
+	}
+
+	io->phase = PHASE_DONE;
 
 	/* Expect complete request. */
-	if (requestor->layer.state != KNOT_STATE_DONE) {
+	if (req->layer.state != KNOT_STATE_DONE) {
 		ret = KNOT_EPROCESSING;
 	}
 
 	/* Verify last TSIG */
-	if (tsig_unsigned_count(&request->tsig) != 0) {
+	if (tsig_unsigned_count(&last->tsig) != 0) {
 		ret = KNOT_TSIG_EBADSIG;
 	}
 
 	/* Finish current query processing. */
-	knot_layer_finish(&requestor->layer);
+	knot_layer_finish(&req->layer);
+
+	if (ret != KNOT_EOK) {
+		request_disconnect(last);
+	}
 
 	return ret;
 }
+
+/*! \brief Maximum of pipelined queries awaiting response on a connection. */
+#define PIPE_MAX_INFLIGHT 100
+
+/*! \brief Size of the message ID, the key of the pipelined queries. */
+#define PIPE_ID_SIZE sizeof(uint16_t)
+
+struct request_pipe;
+
+/*! \brief Request within a loop. */
+struct request_entry {
+	node_t n;                  /*!< Node in the pipe send queue. */
+	knot_request_slot_t *slot;
+	struct request_io io;
+	int timeout_ms;            /*!< Timeout of each operation. */
+	int64_t expire;            /*!< Time limit of the whole request (-1 for none). */
+	struct request_pipe *pipe; /*!< Shared connection if pipelined. */
+	bool queued;               /*!< Waiting in the pipe send queue. */
+};
+
+/*!
+ * \brief TCP connection shared by pipelined requests to the same remote.
+ *
+ * Queries are written back to back without waiting for the responses,
+ * which are matched to the requests by the message ID in any order.
+ */
+struct request_pipe {
+	node_t n;                  /*!< Node in the loop pipes. */
+	int fd;
+	struct sockaddr_storage remote, source;
+	bool reused;               /*!< Pooled connection, not yet proven alive. */
+	bool answered;             /*!< Any response received. */
+	size_t orphans;            /*!< Queries sent for already finished requests. */
+	trie_t *inflight;          /*!< Requests awaiting response by message ID. */
+	list_t queue;              /*!< Requests waiting for their query to be sent. */
+	uint8_t *out;              /*!< Queries being written. */
+	size_t out_size;
+	size_t out_done;
+	size_t out_max;
+	size_t in_done;            /*!< Bytes of the response being read. */
+	uint8_t in[TCP_LEN_SIZE + KNOT_WIRE_MAX_PKTSIZE];
+};
+
+struct knot_request_loop {
+	struct request_entry **entries; /*!< Requests in progress or finished. */
+	size_t count;                   /*!< Number of entries. */
+	size_t capacity;                /*!< Allocated entries. */
+	size_t pending;                 /*!< Requests in progress. */
+	struct pollfd *pfd;             /*!< Poll set, entries followed by pipes. */
+	size_t pfd_capacity;            /*!< Allocated poll set items. */
+	list_t pipes;                   /*!< Shared connections. */
+	size_t pipe_count;              /*!< Number of shared connections. */
+	int grace_ms;                   /*!< Limit the others after a success. */
+
+	/* A single request (the common case) doesn't need the heap. */
+	struct request_entry one_entry;
+	struct request_entry *one_ptr;
+	struct pollfd one_pfd;
+	bool one_used;
+};
+
+static bool use_pipeline(knot_request_t *request)
+{
+	return use_tcp(request) && (request->flags & KNOT_REQUEST_PIPELINE);
+}
+
+static const trie_key_t *query_id_key(knot_request_t *request)
+{
+	return (const trie_key_t *)request->query->wire;
+}
+
+static bool pipe_idle(const struct request_pipe *pipe)
+{
+	return trie_weight(pipe->inflight) == 0 && EMPTY_LIST(pipe->queue);
+}
+
+static struct request_pipe *pipe_new(knot_request_t *request)
+{
+	struct request_pipe *pipe = calloc(1, sizeof(*pipe));
+	if (pipe == NULL) {
+		return NULL;
+	}
+
+	pipe->inflight = trie_create(NULL);
+	if (pipe->inflight == NULL) {
+		free(pipe);
+		return NULL;
+	}
+	init_list(&pipe->queue);
+	memcpy(&pipe->remote, &request->remote, sizeof(pipe->remote));
+	memcpy(&pipe->source, &request->source, sizeof(pipe->source));
+
+	pipe->fd = conn_pool_get(global_conn_pool, &pipe->source, &pipe->remote);
+	pipe->reused = (pipe->fd >= 0);
+	if (pipe->fd < 0) {
+		pipe->fd = net_connected_socket(SOCK_STREAM, &pipe->remote,
+		                                &pipe->source);
+	}
+	if (pipe->fd < 0) {
+		trie_free(pipe->inflight);
+		free(pipe);
+		return NULL;
+	}
+
+	return pipe;
+}
+
+static void pipe_free(struct request_pipe *pipe)
+{
+	assert(pipe_idle(pipe));
+
+	/* Keep the connection only if no more responses can arrive. */
+	if (pipe->orphans == 0 && pipe->in_done == 0) {
+		conn_pool_put(global_conn_pool, &pipe->source, &pipe->remote,
+		              pipe->fd);
+	} else if (pipe->fd >= 0) {
+		close(pipe->fd);
+	}
+
+	trie_free(pipe->inflight);
+	free(pipe->out);
+	free(pipe);
+}
+
+/*! \brief Append a query to the data being written. */
+static int pipe_append(struct request_pipe *pipe, const knot_pkt_t *query)
+{
+	size_t need = pipe->out_size + TCP_LEN_SIZE + query->size;
+	if (need > pipe->out_max) {
+		size_t max = MAX(need, 2 * pipe->out_max);
+		uint8_t *out = realloc(pipe->out, max);
+		if (out == NULL) {
+			return KNOT_ENOMEM;
+		}
+		pipe->out = out;
+		pipe->out_max = max;
+	}
+
+	knot_wire_write_u16(pipe->out + pipe->out_size, query->size);
+	memcpy(pipe->out + pipe->out_size + TCP_LEN_SIZE, query->wire, query->size);
+	pipe->out_size = need;
+
+	return KNOT_EOK;
+}
+
+static void pipe_enqueue(struct request_pipe *pipe, struct request_entry *e)
+{
+	e->pipe = pipe;
+	e->queued = true;
+	e->io.phase = PHASE_SEND;
+	e->io.deadline = -1;
+	add_tail(&pipe->queue, &e->n);
+}
+
+/*! \brief Remove an unfinished request from its shared connection. */
+static void pipe_detach(struct request_entry *e)
+{
+	struct request_pipe *pipe = e->pipe;
+
+	if (e->queued) {
+		rem_node(&e->n);
+		e->queued = false;
+	} else if (trie_del(pipe->inflight, query_id_key(e->slot->request),
+	                    PIPE_ID_SIZE, NULL) == KNOT_EOK) {
+		pipe->orphans++;
+	}
+	e->pipe = NULL;
+}
+
+/*!
+ * \brief Produce the query of a pipelined request and append it for writing.
+ *
+ * \return KNOT_EAGAIN if awaiting response, otherwise the result.
+ */
+static int pipe_produce(struct request_pipe *pipe, struct request_entry *e)
+{
+	knot_requestor_t *req = e->slot->requestor;
+	knot_request_t *last = e->slot->request;
+
+	knot_layer_produce(&req->layer, last->query);
+	if (req->layer.state != KNOT_STATE_CONSUME) {
+		return (req->layer.state == KNOT_STATE_PRODUCE) ?
+		       KNOT_EPROCESSING : KNOT_EOK;
+	}
+
+	/* The message ID must be unique among the queries in flight. */
+	while (trie_get_try(pipe->inflight, query_id_key(last), PIPE_ID_SIZE) != NULL) {
+		knot_wire_set_id(last->query->wire, dnssec_random_uint16_t());
+	}
+
+	int ret = tsig_sign_packet(&last->tsig, last->query);
+	if (ret != KNOT_EOK) {
+		return ret;
+	}
+	if (last->query->size > UINT16_MAX) {
+		return KNOT_ESPACE;
+	}
+
+	trie_val_t *val = trie_get_ins(pipe->inflight, query_id_key(last),
+	                               PIPE_ID_SIZE);
+	if (val == NULL) {
+		return KNOT_ENOMEM;
+	}
+	ret = pipe_append(pipe, last->query);
+	if (ret != KNOT_EOK) {
+		trie_del(pipe->inflight, query_id_key(last), PIPE_ID_SIZE, NULL);
+		return ret;
+	}
+	*val = e;
+
+	knot_pkt_clear(last->resp);
+	phase_start(&e->io, PHASE_RECV, e->timeout_ms);
+
+	return KNOT_EAGAIN;
+}
+
+/*! \brief Write as much of the pending queries as the socket accepts. */
+static int pipe_send(struct request_pipe *pipe)
+{
+	while (pipe->out_done < pipe->out_size) {
+		ssize_t ret = send(pipe->fd, pipe->out + pipe->out_done,
+		                   pipe->out_size - pipe->out_done, MSG_NOSIGNAL);
+		if (ret < 0) {
+			return io_again(errno) ? KNOT_EOK : KNOT_ECONN;
+		}
+		pipe->out_done += ret;
+	}
+
+	pipe->out_size = 0;
+	pipe->out_done = 0;
+
+	return KNOT_EOK;
+}
+
+static void loop_complete(knot_request_loop_t *loop, struct request_entry *e,
+                          int ret);
+
+/*! \brief Pass a received response to the request awaiting it. */
+static void pipe_dispatch(knot_request_loop_t *loop, struct request_pipe *pipe,
+                          const uint8_t *wire, size_t size)
+{
+	trie_val_t *val = NULL;
+	if (size >= KNOT_WIRE_HEADER_SIZE) {
+		val = trie_get_try(pipe->inflight, (const trie_key_t *)wire,
+		                   PIPE_ID_SIZE);
+	}
+	if (val == NULL) {
+		/* Late response for a finished request. */
+		if (pipe->orphans > 0) {
+			pipe->orphans--;
+		}
+		return;
+	}
+
+	struct request_entry *e = *val;
+	knot_requestor_t *req = e->slot->requestor;
+	knot_request_t *last = e->slot->request;
+
+	memcpy(last->resp->wire, wire, size);
+	last->resp->size = size;
+
+	int ret = request_consume(req, last);
+	if (ret == KNOT_EOK && req->layer.state == KNOT_STATE_CONSUME) {
+		/* Another message of the response follows. */
+		knot_pkt_clear(last->resp);
+		phase_start(&e->io, PHASE_RECV, e->timeout_ms);
+		return;
+	}
+
+	trie_del(pipe->inflight, query_id_key(last), PIPE_ID_SIZE, NULL);
+	e->pipe = NULL;
+
+	if (ret == KNOT_EOK && req->layer.state == KNOT_STATE_RESET) {
+		ret = request_reset(req, last);
+	}
+	if (ret == KNOT_EOK && req->layer.state == KNOT_STATE_PRODUCE) {
+		pipe_enqueue(pipe, e);
+		return;
+	}
+
+	e->io.phase = PHASE_STEP;
+	loop_complete(loop, e, ret);
+}
+
+/*! \brief Read and dispatch the available responses. */
+static int pipe_recv(knot_request_loop_t *loop, struct request_pipe *pipe)
+{
+	while (true) {
+		size_t total = TCP_LEN_SIZE;
+		if (pipe->in_done >= TCP_LEN_SIZE) {
+			total += knot_wire_read_u16(pipe->in);
+			if (pipe->in_done == total) {
+				pipe->in_done = 0;
+				pipe->answered = true;
+				pipe_dispatch(loop, pipe, pipe->in + TCP_LEN_SIZE,
+				              total - TCP_LEN_SIZE);
+				continue;
+			}
+		}
+
+		ssize_t ret = recv(pipe->fd, pipe->in + pipe->in_done,
+		                   total - pipe->in_done, 0);
+		if (ret < 0) {
+			return io_again(errno) ? KNOT_EOK : knot_map_errno();
+		} else if (ret == 0) {
+			return KNOT_ECONN;
+		}
+		pipe->in_done += ret;
+	}
+}
+
+/*! \brief Resend the queries in flight over a new connection. */
+static int pipe_reconnect(struct request_pipe *pipe)
+{
+	pipe->reused = false;
+	pipe->fd = net_connected_socket(SOCK_STREAM, &pipe->remote, &pipe->source);
+	if (pipe->fd < 0) {
+		return KNOT_ECONN;
+	}
+
+	int ret = KNOT_EOK;
+	trie_it_t *it = trie_it_begin(pipe->inflight);
+	for (; ret == KNOT_EOK && !trie_it_finished(it); trie_it_next(it)) {
+		struct request_entry *e = *trie_it_val(it);
+		ret = pipe_append(pipe, e->slot->request->query);
+		phase_start(&e->io, PHASE_RECV, e->timeout_ms);
+	}
+	trie_it_free(it);
+
+	return ret;
+}
+
+/*!
+ * \brief Handle a broken shared connection.
+ *
+ * A pooled connection may have been closed by the remote in the meantime,
+ * then the queries are resent over a new one. Otherwise all requests
+ * sharing the connection fail.
+ */
+static void pipe_fail(knot_request_loop_t *loop, struct request_pipe *pipe,
+                      int ret)
+{
+	close(pipe->fd);
+	pipe->fd = -1;
+	pipe->out_size = 0;
+	pipe->out_done = 0;
+	pipe->in_done = 0;
+	pipe->orphans = 0;
+
+	if (pipe->reused && !pipe->answered) {
+		if (pipe_reconnect(pipe) == KNOT_EOK) {
+			return;
+		}
+		ret = KNOT_ECONN;
+	}
+
+	list_t failed;
+	init_list(&failed);
+	trie_it_t *it = trie_it_begin(pipe->inflight);
+	for (; !trie_it_finished(it); trie_it_next(it)) {
+		struct request_entry *e = *trie_it_val(it);
+		add_tail(&failed, &e->n);
+	}
+	trie_it_free(it);
+	trie_clear(pipe->inflight);
+	if (!EMPTY_LIST(pipe->queue)) {
+		add_tail_list(&failed, &pipe->queue);
+		init_list(&pipe->queue);
+	}
+
+	struct request_entry *e, *nxt;
+	WALK_LIST_DELSAFE(e, nxt, failed) {
+		e->pipe = NULL;
+		e->queued = false;
+		loop_complete(loop, e, ret);
+	}
+}
+
+static void pipe_event(knot_request_loop_t *loop, struct request_pipe *pipe,
+                       short revents)
+{
+	int ret = KNOT_EOK;
+	if (revents & (POLLIN | POLLERR | POLLHUP | POLLNVAL)) {
+		ret = pipe_recv(loop, pipe);
+	}
+	if (ret == KNOT_EOK && (revents & POLLOUT)) {
+		ret = pipe_send(pipe);
+	}
+	if (ret != KNOT_EOK) {
+		pipe_fail(loop, pipe, ret);
+	}
+}
+
+/*! \brief Find or open the connection shared with the request. */
+static struct request_pipe *loop_pipe(knot_request_loop_t *loop,
+                                      knot_request_t *request)
+{
+	struct request_pipe *pipe;
+	WALK_LIST(pipe, loop->pipes) {
+		if (sockaddr_cmp(&pipe->remote, &request->remote) == 0 &&
+		    sockaddr_cmp(&pipe->source, &request->source) == 0) {
+			return pipe;
+		}
+	}
+
+	pipe = pipe_new(request);
+	if (pipe != NULL) {
+		add_tail(&loop->pipes, &pipe->n);
+		loop->pipe_count++;
+	}
+
+	return pipe;
+}
+
+/*! \brief Send the queued queries if possible, close the unused connections. */
+static void loop_update_pipes(knot_request_loop_t *loop)
+{
+	struct request_pipe *pipe, *nxt;
+	WALK_LIST_DELSAFE(pipe, nxt, loop->pipes) {
+		while (!EMPTY_LIST(pipe->queue) &&
+		       trie_weight(pipe->inflight) < PIPE_MAX_INFLIGHT) {
+			struct request_entry *e = HEAD(pipe->queue);
+			rem_node(&e->n);
+			e->queued = false;
+			int ret = pipe_produce(pipe, e);
+			if (ret != KNOT_EAGAIN) {
+				e->pipe = NULL;
+				loop_complete(loop, e, ret);
+			}
+		}
+
+		if (pipe_idle(pipe)) {
+			rem_node(&pipe->n);
+			loop->pipe_count--;
+			pipe_free(pipe);
+		}
+	}
+}
+
+static void loop_init(knot_request_loop_t *loop)
+{
+	memset(loop, 0, sizeof(*loop));
+	loop->entries = &loop->one_ptr;
+	loop->capacity = 1;
+	loop->pfd = &loop->one_pfd;
+	loop->pfd_capacity = 1;
+	init_list(&loop->pipes);
+	loop->grace_ms = -1;
+}
+
+static struct request_entry *entry_new(knot_request_loop_t *loop)
+{
+	struct request_entry *e;
+	if (!loop->one_used) {
+		loop->one_used = true;
+		e = &loop->one_entry;
+	} else {
+		e = malloc(sizeof(*e));
+		if (e == NULL) {
+			return NULL;
+		}
+	}
+
+	memset(e, 0, sizeof(*e));
+
+	return e;
+}
+
+static void entry_free(knot_request_loop_t *loop, struct request_entry *e)
+{
+	if (e == &loop->one_entry) {
+		loop->one_used = false;
+	} else {
+		free(e);
+	}
+}
+
+static void loop_deinit(knot_request_loop_t *loop)
+{
+	for (size_t i = 0; i < loop->count; i++) {
+		struct request_entry *e = loop->entries[i];
+		if (e->io.phase != PHASE_DONE) {
+			loop_complete(loop, e, KNOT_ETIMEOUT);
+		}
+	}
+	loop_update_pipes(loop);
+	assert(loop->pipe_count == 0);
+
+	for (size_t i = 0; i < loop->count; i++) {
+		entry_free(loop, loop->entries[i]);
+	}
+	if (loop->entries != &loop->one_ptr) {
+		free(loop->entries);
+	}
+	if (loop->pfd != &loop->one_pfd) {
+		free(loop->pfd);
+	}
+}
+
+static int loop_reserve(knot_request_loop_t *loop)
+{
+	if (loop->count < loop->capacity) {
+		return KNOT_EOK;
+	}
+
+	size_t capacity = 2 * loop->capacity;
+	struct request_entry **entries = malloc(capacity * sizeof(*entries));
+	if (entries == NULL) {
+		return KNOT_ENOMEM;
+	}
+
+	memcpy(entries, loop->entries, loop->count * sizeof(*entries));
+	if (loop->entries != &loop->one_ptr) {
+		free(loop->entries);
+	}
+	loop->entries = entries;
+	loop->capacity = capacity;
+
+	return KNOT_EOK;
+}
+
+static int loop_reserve_pfd(knot_request_loop_t *loop, size_t count)
+{
+	if (count <= loop->pfd_capacity) {
+		return KNOT_EOK;
+	}
+
+	size_t capacity = MAX(count, 2 * loop->pfd_capacity);
+	struct pollfd *pfd = malloc(capacity * sizeof(*pfd));
+	if (pfd == NULL) {
+		return KNOT_ENOMEM;
+	}
+
+	if (loop->pfd != &loop->one_pfd) {
+		free(loop->pfd);
+	}
+	loop->pfd = pfd;
+	loop->pfd_capacity = capacity;
+
+	return KNOT_EOK;
+}
+
+static void loop_expire_all(knot_request_loop_t *loop, int64_t expire)
+{
+	for (size_t i = 0; i < loop->count; i++) {
+		struct request_entry *e = loop->entries[i];
+		if (e->expire < 0 || e->expire > expire) {
+			e->expire = expire;
+		}
+	}
+}
+
+/*! \brief Evaluate a request which left the processing, keep it to report. */
+static void loop_complete(knot_request_loop_t *loop, struct request_entry *e,
+                          int ret)
+{
+	if (e->pipe != NULL) {
+		pipe_detach(e);
+	}
+
+	knot_request_slot_t *slot = e->slot;
+	slot->ret = request_complete(slot->requestor, slot->request, &e->io, ret);
+	loop->pending--;
+
+	/* Give the others limited time once a request succeeded. */
+	if (slot->ret == KNOT_EOK && loop->grace_ms >= 0) {
+		loop_expire_all(loop, now_ms() + loop->grace_ms);
+		loop->grace_ms = -1;
+	}
+}
+
+static void loop_fail_all(knot_request_loop_t *loop, int ret)
+{
+	for (size_t i = 0; i < loop->count; i++) {
+		struct request_entry *e = loop->entries[i];
+		if (e->io.phase != PHASE_DONE) {
+			loop_complete(loop, e, ret);
+		}
+	}
+	loop_update_pipes(loop);
+}
+
+/*! \brief Remove a finished request from the loop. */
+static knot_request_slot_t *loop_take_done(knot_request_loop_t *loop)
+{
+	for (size_t i = 0; i < loop->count; i++) {
+		struct request_entry *e = loop->entries[i];
+		if (e->io.phase != PHASE_DONE) {
+			continue;
+		}
+		knot_request_slot_t *slot = e->slot;
+		loop->count--;
+		loop->entries[i] = loop->entries[loop->count];
+		entry_free(loop, e);
+		return slot;
+	}
+
+	return NULL;
+}
+
+/*! \brief Wait for any socket to become ready and advance its requests. */
+static void loop_poll(knot_request_loop_t *loop, int wait_ms)
+{
+	if (loop_reserve_pfd(loop, loop->count + loop->pipe_count) != KNOT_EOK) {
+		loop_fail_all(loop, KNOT_ENOMEM);
+		return;
+	}
+
+	int64_t now = now_ms();
+	for (size_t i = 0; i < loop->count; i++) {
+		struct request_entry *e = loop->entries[i];
+		struct pollfd *pfd = &loop->pfd[i];
+		pfd->fd = -1;
+		pfd->revents = 0;
+		if (e->io.phase == PHASE_DONE) {
+			continue;
+		}
+		if (e->expire >= 0 &&
+		    (e->io.deadline < 0 || e->io.deadline > e->expire)) {
+			e->io.deadline = e->expire;
+		}
+		if (e->io.deadline >= 0) {
+			int64_t left = e->io.deadline - now;
+			left = (left < 0) ? 0 : left;
+			if (wait_ms < 0 || left < wait_ms) {
+				wait_ms = left;
+			}
+		}
+		if (e->pipe == NULL) {
+			pfd->fd = e->slot->request->fd;
+			pfd->events = (e->io.phase == PHASE_SEND) ? POLLOUT : POLLIN;
+		}
+	}
+	struct pollfd *pipe_pfd = loop->pfd + loop->count;
+	struct request_pipe *pipe;
+	WALK_LIST(pipe, loop->pipes) {
+		pipe_pfd->fd = pipe->fd;
+		pipe_pfd->events = POLLIN;
+		if (pipe->out_done < pipe->out_size) {
+			pipe_pfd->events |= POLLOUT;
+		}
+		pipe_pfd->revents = 0;
+		pipe_pfd++;
+	}
+
+	int ret = poll(loop->pfd, loop->count + loop->pipe_count, wait_ms);
+	if (ret < 0 && errno != EINTR) {
+		loop_fail_all(loop, knot_map_errno());
+		return;
+	}
+
+	/* Responses on the shared connections may finish their requests. */
+	pipe_pfd = loop->pfd + loop->count;
+	WALK_LIST(pipe, loop->pipes) {
+		if (ret > 0 && pipe_pfd->revents != 0) {
+			pipe_event(loop, pipe, pipe_pfd->revents);
+		}
+		pipe_pfd++;
+	}
+
+	now = now_ms();
+	for (size_t i = 0; i < loop->count; i++) {
+		struct request_entry *e = loop->entries[i];
+		knot_request_slot_t *slot = e->slot;
+		if (e->io.phase == PHASE_DONE) {
+			continue;
+		}
+		int step;
+		if (ret > 0 && loop->pfd[i].revents != 0) {
+			step = request_step(slot->requestor, slot->request, &e->io,
+			                    e->timeout_ms);
+		} else if (e->io.deadline >= 0 && e->io.deadline <= now) {
+			step = KNOT_ETIMEOUT;
+		} else {
+			continue;
+		}
+		if (step != KNOT_EAGAIN) {
+			/* Don't wait for each query on a never answering remote. */
+			pipe = e->pipe;
+			if (pipe != NULL && !pipe->answered && !e->queued) {
+				pipe->reused = false;
+				pipe_fail(loop, pipe, step);
+			} else {
+				loop_complete(loop, e, step);
+			}
+		}
+	}
+
+	loop_update_pipes(loop);
+}
+
+knot_request_loop_t *knot_request_loop_new(void)
+{
+	knot_request_loop_t *loop = malloc(sizeof(*loop));
+	if (loop == NULL) {
+		return NULL;
+	}
+
+	loop_init(loop);
+
+	return loop;
+}
+
+void knot_request_loop_free(knot_request_loop_t *loop)
+{
+	if (loop == NULL) {
+		return;
+	}
+
+	loop_deinit(loop);
+	free(loop);
+}
+
+int knot_request_loop_add(knot_request_loop_t *loop, knot_request_slot_t *slot,
+                          int timeout_ms)
+{
+	if (loop == NULL || slot == NULL) {
+		return KNOT_EINVAL;
+	}
+
+	int ret = loop_reserve(loop);
+	if (ret != KNOT_EOK) {
+		return ret;
+	}
+	struct request_entry *e = entry_new(loop);
+	if (e == NULL) {
+		return KNOT_ENOMEM;
+	}
+
+	e->slot = slot;
+	e->timeout_ms = timeout_ms;
+	e->expire = -1;
+	loop->entries[loop->count++] = e;
+
+	if (slot->requestor == NULL || slot->request == NULL) {
+		slot->ret = KNOT_EINVAL;
+		e->io.phase = PHASE_DONE;
+		return KNOT_EOK;
+	}
+
+	loop->pending++;
+	slot->requestor->layer.tsig = &slot->request->tsig;
+
+	/* Share a connection with the other queries to the remote. */
+	if (use_pipeline(slot->request) &&
+	    slot->requestor->layer.state == KNOT_STATE_PRODUCE) {
+		struct request_pipe *pipe = loop_pipe(loop, slot->request);
+		if (pipe == NULL) {
+			loop_complete(loop, e, KNOT_ECONN);
+			return KNOT_EOK;
+		}
+		pipe_enqueue(pipe, e);
+		loop_update_pipes(loop);
+		return KNOT_EOK;
+	}
+
+	/* Drive the request until it needs the network. */
+	ret = request_step(slot->requestor, slot->request, &e->io, timeout_ms);
+	if (ret != KNOT_EAGAIN) {
+		loop_complete(loop, e, ret);
+	}
+
+	return KNOT_EOK;
+}
+
+int knot_request_loop_expire(knot_request_loop_t *loop,
+                             const knot_request_slot_t *slot, int timeout_ms)
+{
+	if (loop == NULL || slot == NULL || timeout_ms < 0) {
+		return KNOT_EINVAL;
+	}
+
+	for (size_t i = 0; i < loop->count; i++) {
+		struct request_entry *e = loop->entries[i];
+		if (e->slot != slot) {
+			continue;
+		}
+		int64_t expire = now_ms() + timeout_ms;
+		if (e->expire < 0 || e->expire > expire) {
+			e->expire = expire;
+		}
+		return KNOT_EOK;
+	}
+
+	return KNOT_ENOENT;
+}
+
+size_t knot_request_loop_pending(const knot_request_loop_t *loop)
+{
+	return (loop != NULL) ? loop->count : 0;
+}
+
+knot_request_slot_t *knot_request_loop_next(knot_request_loop_t *loop,
+                                            int wait_ms)
+{
+	if (loop == NULL) {
+		return NULL;
+	}
+
+	int64_t end = (wait_ms < 0) ? -1 : now_ms() + wait_ms;
+	while (true) {
+		knot_request_slot_t *slot = loop_take_done(loop);
+		if (slot != NULL || loop->pending == 0) {
+			return slot;
+		}
+
+		int64_t left = -1;
+		if (end >= 0) {
+			left = end - now_ms();
+			left = (left < 0) ? 0 : left;
+		}
+		loop_poll(loop, left);
+
+		if (end >= 0 && now_ms() >= end) {
+			return loop_take_done(loop);
+		}
+	}
+}
+
+/*!
+ * \brief Execute requests concurrently.
+ *
+ * \param grace_ms  Time to wait for the other requests once one succeeds
+ *                  (-1 to wait for all).
+ */
+static int requestor_exec(knot_request_slot_t *slots, size_t count,
+                          int timeout_ms, int grace_ms)
+{
+	if (slots == NULL && count > 0) {
+		return KNOT_EINVAL;
+	}
+
+	knot_request_loop_t loop;
+	loop_init(&loop);
+	loop.grace_ms = grace_ms;
+
+	for (size_t i = 0; i < count; i++) {
+		int ret = knot_request_loop_add(&loop, &slots[i], timeout_ms);
+		if (ret != KNOT_EOK) {
+			loop_deinit(&loop);
+			return ret;
+		}
+	}
+
+	while (knot_request_loop_next(&loop, -1) != NULL);
+
+	loop_deinit(&loop);
+
+	return KNOT_EOK;
+}
+
+int knot_requestor_exec_many(knot_request_slot_t *slots, size_t count,
+                             int timeout_ms)
+{
+	return requestor_exec(slots, count, timeout_ms, -1);
+}
+
+int knot_requestor_exec_race(knot_request_slot_t *slots, size_t count,
+                             int timeout_ms, int grace_ms)
+{
+	return requestor_exec(slots, count, timeout_ms, grace_ms);
+}
+
+int knot_requestor_exec(knot_requestor_t *requestor, knot_request_t *request,
+                        int timeout_ms)
+{
+	if (requestor == NULL || request == NULL) {
+		return KNOT_EINVAL;
+	}
+
+	knot_request_slot_t slot = {
+		.requestor = requestor,
+		.request = request,
+	};
+
+	int ret = knot_requestor_exec_many(&slot, 1, timeout_ms);
+	if (ret != KNOT_EOK) {
+		return ret;
+	}
+
+	return slot.ret;
+}
@@ -25,7 +25,12 @@
 #include "libknot/rrtype/tsig.h"
 
 typedef enum {
-	KNOT_REQUEST_UDP = 1 << 0  /*!< Use UDP for requests. */
+	KNOT_REQUEST_UDP   = 1 << 0, /*!< Use UDP for requests. */
+	KNOT_REQUEST_REUSE = 1 << 1, /*!< Use pooled TCP connection if available
+	                                  and keep the connection afterwards. */
+	KNOT_REQUEST_PIPELINE = 1 << 2, /*!< Within a request loop, share one TCP
+	                                     connection with the other pipelined
+	                                     requests to the same remote. */
 } knot_request_flag_t;
 
 typedef enum {
@@ -53,6 +58,13 @@ typedef struct {
 	knot_sign_context_t sign; /*!< Required for async. DDNS processing. */
 } knot_request_t;
 
+/*! \brief Request with its processing, executed along with other requests. */
+typedef struct {
+	knot_requestor_t *requestor; /*!< Response processing. */
+	knot_request_t *request;     /*!< Request to be executed. */
+	int ret;                     /*!< Result of the request (output). */
+} knot_request_slot_t;
+
 /*!
  * \brief Make request out of endpoints and query.
  *
@@ -113,3 +125,115 @@ void knot_requestor_clear(knot_requestor_t *requestor);
 int knot_requestor_exec(knot_requestor_t *requestor,
                         knot_request_t *request,
                         int timeout_ms);
+
+/*!
+ * \brief Execute multiple independent requests concurrently.
+ *
+ * All requests are driven by a single poll loop, each one is advanced
+ * whenever its socket is ready. The result of each request is stored
+ * in its slot.
+ *
+ * \note Each slot must use its own requestor and request.
+ *
+ * \param slots      Requests to execute.
+ * \param count      Number of requests.
+ * \param timeout_ms Timeout of each operation in miliseconds (-1 for infinity).
+ *
+ * \return KNOT_EOK if executed (see slot results), or error
+ */
+int knot_requestor_exec_many(knot_request_slot_t *slots, size_t count,
+                             int timeout_ms);
+
+/*!
+ * \brief Execute multiple independent requests, prefer the fast ones.
+ *
+ * Same as \ref knot_requestor_exec_many, but once a request succeeds,
+ * the other requests have at most the grace period to finish, otherwise
+ * they fail with KNOT_ETIMEOUT.
+ *
+ * \param slots      Requests to execute.
+ * \param count      Number of requests.
+ * \param timeout_ms Timeout of each operation in miliseconds (-1 for infinity).
+ * \param grace_ms   Grace period after the first success in miliseconds.
+ *
+ * \return KNOT_EOK if executed (see slot results), or error
+ */
+int knot_requestor_exec_race(knot_request_slot_t *slots, size_t count,
+                             int timeout_ms, int grace_ms);
+
+/*!
+ * \brief Loop of independent requests executed concurrently.
+ *
+ * Unlike \ref knot_requestor_exec_many, requests can be added while others
+ * are in progress and each finished request is reported separately.
+ *
+ * Requests with KNOT_REQUEST_PIPELINE to the same remote (and from the same
+ * source) are sent over one TCP connection without waiting for the previous
+ * responses, which are matched to the requests by the message ID. The ID
+ * of a query is changed if it collides with a query in flight. The
+ * connection is taken from and returned to the connection pool.
+ */
+typedef struct knot_request_loop knot_request_loop_t;
+
+/*!
+ * \brief Create an empty request loop.
+ *
+ * \return Request loop or NULL in case of error.
+ */
+knot_request_loop_t *knot_request_loop_new(void);
+
+/*!
+ * \brief Free the loop, requests in progress fail with KNOT_ETIMEOUT.
+ *
+ * \note The requests themselves are owned by the caller.
+ *
+ * \param loop  Request loop.
+ */
+void knot_request_loop_free(knot_request_loop_t *loop);
+
+/*!
+ * \brief Start a request in the loop.
+ *
+ * The request is advanced until it needs the network, it may finish
+ * immediately. The slot must remain valid until the request is reported
+ * by \ref knot_request_loop_next.
+ *
+ * \param loop        Request loop.
+ * \param slot        Request to execute, with its own requestor.
+ * \param timeout_ms  Timeout of each operation in miliseconds (-1 for infinity).
+ *
+ * \return KNOT_EOK if started (see the slot result once reported), or error
+ */
+int knot_request_loop_add(knot_request_loop_t *loop, knot_request_slot_t *slot,
+                          int timeout_ms);
+
+/*!
+ * \brief Limit the time left for a request in the loop.
+ *
+ * The request fails with KNOT_ETIMEOUT unless it finishes in time.
+ *
+ * \param loop        Request loop.
+ * \param slot        Request in the loop.
+ * \param timeout_ms  Time left in miliseconds.
+ *
+ * \return KNOT_EOK, KNOT_ENOENT if not in the loop, or error
+ */
+int knot_request_loop_expire(knot_request_loop_t *loop,
+                             const knot_request_slot_t *slot, int timeout_ms);
+
+/*!
+ * \brief Get the number of requests in the loop not reported yet.
+ */
+size_t knot_request_loop_pending(const knot_request_loop_t *loop);
+
+/*!
+ * \brief Wait for a request to finish.
+ *
+ * \param loop     Request loop.
+ * \param wait_ms  Maximum time to wait in miliseconds (-1 for infinity).
+ *
+ * \return Finished request (removed from the loop), or NULL if none finished
+ *         in time or the loop is empty.
+ */
+knot_request_slot_t *knot_request_loop_next(knot_request_loop_t *loop,
+                                            int wait_ms);
@@ -27,16 +27,23 @@
 #include "knot/conf/confio.h"
 #include "knot/conf/migration.h"
 #include "knot/conf/module.h"
+#include "knot/events/refresh_poll.h"
+#include "knot/events/refresh_sched.h"
 #include "knot/dnssec/kasp/kasp_db.h"
 #include "knot/journal/journal_basic.h"
+#include "knot/query/conn_pool.h"
 #include "knot/server/server.h"
 #include "knot/server/udp-handler.h"
 #include "knot/server/tcp-handler.h"
+#include "knot/server/tls.h"
+#include "knot/server/topology.h"
 #include "knot/zone/timers.h"
 #include "knot/zone/zonedb-load.h"
 #include "knot/worker/pool.h"
+#include "contrib/macros.h"
 #include "contrib/net.h"
 #include "contrib/sockaddr.h"
+#include "contrib/time.h"
 #include "contrib/trim.h"
 
 /*! \brief Minimal send/receive buffer sizes. */
@@ -188,22 +195,41 @@ static int enable_fastopen(int sock, int backlog)
 	return KNOT_EOK;
 }
 
+/*!
+ * \brief Enable busy polling of the device queue on blocking receive.
+ */
+static int enable_busy_poll(int sock, int usecs)
+{
+#if defined(SO_BUSY_POLL)
+	if (setsockopt(sock, SOL_SOCKET, SO_BUSY_POLL, &usecs, sizeof(usecs)) != 0) {
+		return knot_map_errno();
+	}
+	return KNOT_EOK;
+#else
+	return KNOT_ENOTSUP;
+#endif
+}
+
 /*!
  * \brief Create and initialize new interface.
  *
- * Both TCP and UDP sockets will be created for the interface.
+ * Both TCP and UDP sockets will be created for the interface, only TCP ones
+ * for a TLS interface.
  *
  * \param addr              Socket address.
  * \param udp_thread_count  Number of created UDP workers.
  * \param tcp_thread_count  Number of created TCP workers.
  * \param tcp_reuseport     Indication if reuseport on TCP is enabled.
+ * \param udp_busy_poll     Busy polling time for UDP sockets (microseconds).
+ * \param tls               Indication if the interface is for DNS over TLS.
  *
  * \retval Pointer to a new initialized inteface.
  * \retval NULL if error.
  */
 static iface_t *server_init_iface(struct sockaddr_storage *addr,
                                   int udp_thread_count, int tcp_thread_count,
-                                  bool tcp_reuseport)
+                                  bool tcp_reuseport, int udp_busy_poll,
+                                  bool tls)
 {
 	iface_t *new_if = calloc(1, sizeof(*new_if));
 	if (new_if == NULL) {
@@ -211,18 +237,19 @@ static iface_t *server_init_iface(struct sockaddr_storage *addr,
 		return NULL;
 	}
 	memcpy(&new_if->addr, addr, sizeof(*addr));
+	new_if->tls = tls;
 
 	/* Convert to string address format. */
 	char addr_str[SOCKADDR_STRLEN] = { 0 };
 	sockaddr_tostr(addr_str, sizeof(addr_str), addr);
 
-	int udp_socket_count = 1;
+	int udp_socket_count = tls ? 0 : 1;
 	int udp_bind_flags = 0;
 	int tcp_socket_count = 1;
 	int tcp_bind_flags = 0;
 
 #ifdef ENABLE_REUSEPORT
-	udp_socket_count = udp_thread_count;
+	udp_socket_count = tls ? 0 : udp_thread_count;
 	udp_bind_flags |= NET_BIND_MULTIPLE;
 
 	if (tcp_reuseport) {
@@ -231,7 +258,7 @@ static iface_t *server_init_iface(struct sockaddr_storage *addr,
 	}
 #endif
 
-	new_if->fd_udp = malloc(udp_socket_count * sizeof(int));
+	new_if->fd_udp = malloc(MAX(udp_socket_count, 1) * sizeof(int));
 	new_if->fd_tcp = malloc(tcp_socket_count * sizeof(int));
 	if (new_if->fd_udp == NULL || new_if->fd_tcp == NULL) {
 		log_error("failed to initialize interface");
@@ -282,6 +309,15 @@ static iface_t *server_init_iface(struct sockaddr_storage *addr,
 			warn_flag_misc = false;
 		}
 
+		if (udp_busy_poll > 0) {
+			ret = enable_busy_poll(sock, udp_busy_poll);
+			if (ret != KNOT_EOK && warn_flag_misc) {
+				log_warning("failed to enable busy polling for UDP (%s)",
+				            knot_strerror(ret));
+				warn_flag_misc = false;
+			}
+		}
+
 		new_if->fd_udp[new_if->fd_udp_count] = sock;
 		new_if->fd_udp_count += 1;
 	}
@@ -357,6 +393,9 @@ static int configure_sockets(conf_t *conf, server_t *s)
 	log_info("using reuseport for UDP%s", conf->cache.srv_tcp_reuseport ? " and TCP" : "");
 #endif
 
+	conf_val_t busy_poll_val = conf_get(conf, C_SRV, C_UDP_BUSY_POLL);
+	int udp_busy_poll = conf_int(&busy_poll_val);
+
 	/* Update bound interfaces. */
 	conf_val_t listen_val = conf_get(conf, C_SRV, C_LISTEN);
 	conf_val_t rundir_val = conf_get(conf, C_SRV, C_RUNDIR);
@@ -372,7 +411,42 @@ static int configure_sockets(conf_t *conf, server_t *s)
 		unsigned size_udp = s->handlers[IO_UDP].handler.unit->size;
 		unsigned size_tcp = s->handlers[IO_TCP].handler.unit->size;
 		bool tcp_reuseport = conf->cache.srv_tcp_reuseport;
-		iface_t *new_if = server_init_iface(&addr, size_udp, size_tcp, tcp_reuseport);
+		iface_t *new_if = server_init_iface(&addr, size_udp, size_tcp,
+		                                    tcp_reuseport, udp_busy_poll, false);
+		if (new_if != NULL) {
+			add_tail(newlist, &new_if->n);
+		}
+
+		conf_val_next(&listen_val);
+	}
+
+	/* Bind DNS over TLS interfaces if the credentials can be loaded. */
+	listen_val = conf_get(conf, C_SRV, C_LISTEN_TLS);
+	if (listen_val.code == KNOT_EOK) {
+		conf_val_t cert_val = conf_get(conf, C_SRV, C_TLS_CERT);
+		conf_val_t key_val = conf_get(conf, C_SRV, C_TLS_KEY);
+		char *cert = conf_abs_path(&cert_val, CONFIG_DIR);
+		char *key = conf_abs_path(&key_val, CONFIG_DIR);
+		int ret = tls_ctx_init(&s->tls, cert, key);
+		if (ret != KNOT_EOK) {
+			log_error("failed to load TLS certificate '%s' and key '%s' (%s)",
+			          cert, key, knot_strerror(ret));
+			listen_val.code = KNOT_ENOENT;
+		}
+		free(cert);
+		free(key);
+	}
+	while (listen_val.code == KNOT_EOK) {
+		struct sockaddr_storage addr = conf_addr(&listen_val, rundir);
+		char addr_str[SOCKADDR_STRLEN] = { 0 };
+		sockaddr_tostr(addr_str, sizeof(addr_str), &addr);
+		log_info("binding to TLS interface %s", addr_str);
+
+		unsigned size_udp = s->handlers[IO_UDP].handler.unit->size;
+		unsigned size_tcp = s->handlers[IO_TCP].handler.unit->size;
+		bool tcp_reuseport = conf->cache.srv_tcp_reuseport;
+		iface_t *new_if = server_init_iface(&addr, size_udp, size_tcp,
+		                                    tcp_reuseport, 0, true);
 		if (new_if != NULL) {
 			add_tail(newlist, &new_if->n);
 		}
@@ -396,6 +470,16 @@ static int configure_sockets(conf_t *conf, server_t *s)
 	return KNOT_EOK;
 }
 
+static void warn_shards_mismatch(knot_lmdb_shards_t *shards, const char *path,
+                                 const char *name)
+{
+	unsigned found = knot_lmdb_shards_detect(path);
+	if (found != 0 && found != shards->count) {
+		log_warning("%s DB in '%s' has %u shards, configured %u, "
+		            "existing contents not used", name, path, found, shards->count);
+	}
+}
+
 int server_init(server_t *server, int bg_workers)
 {
 	if (server == NULL) {
@@ -419,8 +503,16 @@ int server_init(server_t *server, int bg_workers)
 	char *journal_dir = conf_db(conf(), C_JOURNAL_DB);
 	conf_val_t journal_size = conf_db_param(conf(), C_JOURNAL_DB_MAX_SIZE, C_MAX_JOURNAL_DB_SIZE);
 	conf_val_t journal_mode = conf_db_param(conf(), C_JOURNAL_DB_MODE, C_JOURNAL_DB_MODE);
-	knot_lmdb_init(&server->journaldb, journal_dir, conf_int(&journal_size), journal_env_flags(conf_opt(&journal_mode)), NULL);
+	conf_val_t journal_shards = conf_get(conf(), C_DB, C_JOURNAL_DB_SHARDS);
+	int ret = knot_lmdb_shards_init(&server->journaldb, conf_int(&journal_shards), journal_dir,
+	                                conf_int(&journal_size), journal_env_flags(conf_opt(&journal_mode)), NULL);
+	warn_shards_mismatch(&server->journaldb, journal_dir, "journal");
 	free(journal_dir);
+	if (ret != KNOT_EOK) {
+		worker_pool_destroy(server->workers);
+		evsched_deinit(&server->sched);
+		return ret;
+	}
 
 	char *kasp_dir = conf_db(conf(), C_KASP_DB);
 	conf_val_t kasp_size = conf_db_param(conf(), C_KASP_DB_MAX_SIZE, C_MAX_KASP_DB_SIZE);
@@ -429,8 +521,18 @@ int server_init(server_t *server, int bg_workers)
 
 	char *timer_dir = conf_db(conf(), C_TIMER_DB);
 	conf_val_t timer_size = conf_db_param(conf(), C_TIMER_DB_MAX_SIZE, C_MAX_TIMER_DB_SIZE);
-	knot_lmdb_init(&server->timerdb, timer_dir, conf_int(&timer_size), 0, NULL);
+	conf_val_t timer_shards = conf_get(conf(), C_DB, C_TIMER_DB_SHARDS);
+	ret = knot_lmdb_shards_init(&server->timerdb, conf_int(&timer_shards), timer_dir,
+	                            conf_int(&timer_size), 0, NULL);
+	warn_shards_mismatch(&server->timerdb, timer_dir, "timer");
 	free(timer_dir);
+	if (ret != KNOT_EOK) {
+		knot_lmdb_deinit(&server->kaspdb);
+		knot_lmdb_shards_deinit(&server->journaldb);
+		worker_pool_destroy(server->workers);
+		evsched_deinit(&server->sched);
+		return ret;
+	}
 
 	return KNOT_EOK;
 }
@@ -453,9 +555,15 @@ void server_deinit(server_t *server)
 
 	/* Free remaining interfaces. */
 	server_deinit_iface_list(server->ifaces);
+	tls_ctx_deinit(server->tls);
+
+	/* Stop polling SOA of the masters. */
+	refresh_poll_deinit(global_refresh_poll);
+	global_refresh_poll = NULL;
 
 	/* Free threads and event handlers. */
 	worker_pool_destroy(server->workers);
+	free(server->bg_cpus);
 
 	/* Free zone database. */
 	knot_zonedb_deep_free(&server->zone_db, true);
@@ -464,13 +572,21 @@ void server_deinit(server_t *server)
 	evsched_deinit(&server->sched);
 
 	/* Close persistent timers DB. */
-	knot_lmdb_deinit(&server->timerdb);
+	knot_lmdb_shards_deinit(&server->timerdb);
 
 	/* Close kasp_db. */
 	knot_lmdb_deinit(&server->kaspdb);
 
 	/* Close journal database if open. */
-	knot_lmdb_deinit(&server->journaldb);
+	knot_lmdb_shards_deinit(&server->journaldb);
+
+	/* Close kept connections to remotes. */
+	conn_pool_deinit(global_conn_pool);
+	global_conn_pool = NULL;
+
+	/* Free refresh scheduler. */
+	refresh_sched_deinit(global_refresh_sched);
+	global_refresh_sched = NULL;
 }
 
 static int server_init_handler(server_t *server, int index, int thread_count,
@@ -498,6 +614,22 @@ static int server_init_handler(server_t *server, int index, int thread_count,
 		return KNOT_ENOMEM;
 	}
 
+	if (posix_memalign((void **)&h->threads, sizeof(handler_thread_t),
+	                   thread_count * sizeof(handler_thread_t)) != 0) {
+		free(h->thread_id);
+		free(h->thread_state);
+		dt_delete(&h->unit);
+		return KNOT_ENOMEM;
+	}
+	struct timespec now = time_now();
+	for (int i = 0; i < thread_count; i++) {
+		h->threads[i] = (handler_thread_t) {
+			.last_report = now,
+			.cpu = -1,
+			.node = -1
+		};
+	}
+
 	return KNOT_EOK;
 }
 
@@ -517,6 +649,7 @@ static void server_free_handler(iohandler_t *h)
 	dt_delete(&h->unit);
 	free(h->thread_state);
 	free(h->thread_id);
+	free(h->threads);
 }
 
 int server_start(server_t *server, bool async)
@@ -525,6 +658,12 @@ int server_start(server_t *server, bool async)
 		return KNOT_EINVAL;
 	}
 
+	/* Start polling SOA of the masters. */
+	global_refresh_poll = refresh_poll_init(server);
+	if (global_refresh_poll == NULL) {
+		log_warning("failed to start SOA polling, refreshing in workers");
+	}
+
 	/* Start workers. */
 	worker_pool_start(server->workers);
 
@@ -625,7 +764,8 @@ static bool listen_changed(conf_t *conf, server_t *server)
 	assert(server->ifaces);
 
 	conf_val_t listen_val = conf_get(conf, C_SRV, C_LISTEN);
-	size_t new_count = conf_val_count(&listen_val);
+	conf_val_t listen_tls_val = conf_get(conf, C_SRV, C_LISTEN_TLS);
+	size_t new_count = conf_val_count(&listen_val) + conf_val_count(&listen_tls_val);
 	size_t old_count = list_size(server->ifaces);
 	if (new_count != old_count) {
 		return true;
@@ -636,22 +776,26 @@ static bool listen_changed(conf_t *conf, server_t *server)
 	size_t matches = 0;
 
 	/* Find matching interfaces. */
-	while (listen_val.code == KNOT_EOK) {
-		struct sockaddr_storage addr = conf_addr(&listen_val, rundir);
-		bool found = false;
-		iface_t *iface;
-		WALK_LIST(iface, *server->ifaces) {
-			if (sockaddr_cmp(&addr, &iface->addr) == 0) {
-				matches++;
-				found = true;
-				break;
+	for (int tls = 0; tls <= 1; tls++) {
+		conf_val_t *val = tls ? &listen_tls_val : &listen_val;
+		while (val->code == KNOT_EOK) {
+			struct sockaddr_storage addr = conf_addr(val, rundir);
+			bool found = false;
+			iface_t *iface;
+			WALK_LIST(iface, *server->ifaces) {
+				if (iface->tls == tls &&
+				    sockaddr_cmp(&addr, &iface->addr) == 0) {
+					matches++;
+					found = true;
+					break;
+				}
 			}
-		}
 
-		if (!found) {
-			break;
+			if (!found) {
+				break;
+			}
+			conf_val_next(val);
 		}
-		conf_val_next(&listen_val);
 	}
 
 	free(rundir);
@@ -809,13 +953,94 @@ static int configure_threads(conf_t *conf, server_t *server)
 	return set_handler(server, IO_TCP, conf->cache.srv_tcp_threads, tcp_master);
 }
 
+static void set_thread_cpu(const topology_t *topo, handler_thread_t *thread, int cpu)
+{
+	thread->cpu = cpu;
+	thread->node = (cpu >= 0) ? topology_cpu_node(topo, cpu) : -1;
+}
+
+/*! \brief Plan the CPU placement of the query handling and background threads. */
+static int configure_placement(conf_t *conf, server_t *server)
+{
+	conf_val_t val = conf_get(conf, C_SRV, C_CPU_PLACEMENT);
+	unsigned mode = conf_opt(&val);
+	if (mode == CPU_PLACEMENT_NONE) {
+		return KNOT_EOK;
+	}
+
+	topology_t topo;
+	int ret = topology_load(&topo);
+	if (ret != KNOT_EOK) {
+		return ret;
+	}
+
+	handler_thread_t *udp = server->handlers[IO_UDP].handler.threads;
+	handler_thread_t *tcp = server->handlers[IO_TCP].handler.threads;
+	unsigned udp_count = server->handlers[IO_UDP].size;
+	unsigned tcp_count = server->handlers[IO_TCP].size;
+
+	/* Only UDP threads are spread over the CPUs. */
+	if (mode == CPU_PLACEMENT_SIMPLE) {
+		for (unsigned i = 0; i < udp_count && topo.count > 1; i++) {
+			set_thread_cpu(&topo, &udp[i], topo.cpus[i % topo.count].id);
+		}
+		topology_free(&topo);
+		return KNOT_EOK;
+	}
+
+	/* Prefer the NUMA node of the first interface with a known one. */
+	int node = -1;
+	if (server->ifaces != NULL) {
+		iface_t *iface;
+		WALK_LIST(iface, *server->ifaces) {
+			node = topology_addr_node(&iface->addr);
+			if (node >= 0) {
+				break;
+			}
+		}
+	}
+
+	placement_t place;
+	ret = topology_place(&topo, node, udp_count, tcp_count, &place);
+	if (ret != KNOT_EOK) {
+		topology_free(&topo);
+		return ret;
+	}
+
+	for (unsigned i = 0; i < udp_count; i++) {
+		set_thread_cpu(&topo, &udp[i], place.udp[i]);
+	}
+	for (unsigned i = 0; i < tcp_count; i++) {
+		set_thread_cpu(&topo, &tcp[i], place.tcp[i]);
+	}
+
+	free(server->bg_cpus);
+	server->bg_cpus = place.bg;
+	server->bg_cpu_count = place.bg_count;
+	place.bg = NULL;
+	worker_pool_set_affinity(server->workers, server->bg_cpus, server->bg_cpu_count);
+
+	if (node >= 0) {
+		log_info("placing query handling threads on NUMA node %i", node);
+	}
+	log_info("placing %u UDP and %u TCP threads on %u CPUs, "
+	         "%u CPUs reserved for background workers",
+	         udp_count, tcp_count, topo.count, server->bg_cpu_count);
+
+	placement_free(&place);
+	topology_free(&topo);
+
+	return KNOT_EOK;
+}
+
 static int reconfigure_journal_db(conf_t *conf, server_t *server)
 {
 	char *journal_dir = conf_db(conf, C_JOURNAL_DB);
 	conf_val_t journal_size = conf_db_param(conf, C_JOURNAL_DB_MAX_SIZE, C_MAX_JOURNAL_DB_SIZE);
 	conf_val_t journal_mode = conf_db_param(conf, C_JOURNAL_DB_MODE, C_JOURNAL_DB_MODE);
-	int ret = knot_lmdb_reinit(&server->journaldb, journal_dir, conf_int(&journal_size),
-	                           journal_env_flags(conf_opt(&journal_mode)));
+	conf_val_t journal_shards = conf_get(conf, C_DB, C_JOURNAL_DB_SHARDS);
+	int ret = knot_lmdb_shards_reinit(&server->journaldb, conf_int(&journal_shards), journal_dir,
+	                                  conf_int(&journal_size), journal_env_flags(conf_opt(&journal_mode)));
 	if (ret != KNOT_EOK) {
 		log_warning("ignored reconfiguration of journal DB (%s)", knot_strerror(ret));
 	}
@@ -841,11 +1066,49 @@ static int reconfigure_timer_db(conf_t *conf, server_t *server)
 {
 	char *timer_dir = conf_db(conf, C_TIMER_DB);
 	conf_val_t timer_size = conf_db_param(conf, C_TIMER_DB_MAX_SIZE, C_MAX_TIMER_DB_SIZE);
-	int ret = knot_lmdb_reconfigure(&server->timerdb, timer_dir, conf_int(&timer_size), 0);
+	conf_val_t timer_shards = conf_get(conf, C_DB, C_TIMER_DB_SHARDS);
+	int ret = knot_lmdb_shards_reconfigure(&server->timerdb, conf_int(&timer_shards), timer_dir,
+	                                       conf_int(&timer_size), 0);
 	free(timer_dir);
 	return ret;
 }
 
+static int reconfigure_remote_pool(conf_t *conf)
+{
+	conf_val_t val = conf_get(conf, C_SRV, C_RMT_POOL_LIMIT);
+	size_t limit = conf_int(&val);
+	val = conf_get(conf, C_SRV, C_RMT_POOL_TIMEOUT);
+	time_t timeout = conf_int(&val);
+
+	if (global_conn_pool == NULL) {
+		global_conn_pool = conn_pool_init(limit, timeout);
+		return (global_conn_pool != NULL) ? KNOT_EOK : KNOT_ENOMEM;
+	}
+
+	return conn_pool_set(global_conn_pool, limit, timeout);
+}
+
+static int reconfigure_refresh_sched(conf_t *conf)
+{
+	if (global_refresh_sched == NULL) {
+		global_refresh_sched = refresh_sched_init();
+		if (global_refresh_sched == NULL) {
+			return KNOT_ENOMEM;
+		}
+	}
+
+	conf_val_t val = conf_get(conf, C_SRV, C_REFRESH_LIMIT);
+	size_t limit = conf_int(&val);
+	val = conf_get(conf, C_SRV, C_REFRESH_RMT_LIMIT);
+	size_t remote_limit = conf_int(&val);
+	val = conf_get(conf, C_SRV, C_REFRESH_JITTER);
+	unsigned jitter = conf_int(&val);
+
+	refresh_sched_set(global_refresh_sched, limit, remote_limit, jitter);
+
+	return KNOT_EOK;
+}
+
 void server_reconfigure(conf_t *conf, server_t *server)
 {
 	if (conf == NULL || server == NULL) {
@@ -877,6 +1140,12 @@ void server_reconfigure(conf_t *conf, server_t *server)
 			log_error("failed to configure server sockets (%s)",
 			          knot_strerror(ret));
 		}
+
+		/* Configure thread placement. */
+		if ((ret = configure_placement(conf, server)) != KNOT_EOK) {
+			log_warning("failed to configure thread placement (%s)",
+			            knot_strerror(ret));
+		}
 	}
 
 	/* Reconfigure journal DB. */
@@ -896,6 +1165,18 @@ void server_reconfigure(conf_t *conf, server_t *server)
 		log_error("failed to reconfigure Timer DB (%s)",
 		          knot_strerror(ret));
 	}
+
+	/* Reconfigure connection pool. */
+	if ((ret = reconfigure_remote_pool(conf)) != KNOT_EOK) {
+		log_error("failed to reconfigure connection pool (%s)",
+		          knot_strerror(ret));
+	}
+
+	/* Reconfigure refresh scheduler. */
+	if ((ret = reconfigure_refresh_sched(conf)) != KNOT_EOK) {
+		log_error("failed to reconfigure refresh scheduler (%s)",
+		          knot_strerror(ret));
+	}
 }
 
 void server_update_zones(conf_t *conf, server_t *server)
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <stdint.h>
+#include <time.h>
 #include "sys/socket.h"
 
 #include "knot/conf/conf.h"
@@ -30,6 +32,19 @@
 /* Forwad declarations. */
 struct server;
 
+/*! \brief Placement and statistics of a query handling thread.
+ *
+ * Each item is cache line aligned, the counter is written by the owning
+ * thread only.
+ */
+typedef struct {
+	uint64_t queries;             /*!< Number of handled queries. */
+	uint64_t last_queries;        /*!< Number of queries at the last report. */
+	struct timespec last_report;  /*!< Time of the last report. */
+	int cpu;                      /*!< Bound CPU, -1 if not bound. */
+	int node;                     /*!< NUMA node of the CPU, -1 if not bound. */
+} __attribute__((aligned(64))) handler_thread_t;
+
 /*! \brief I/O handler structure.
   */
 typedef struct iohandler {
@@ -38,8 +53,19 @@ typedef struct iohandler {
 	dt_unit_t          *unit;   /*!< Threading unit */
 	unsigned           *thread_state; /*!< Thread state */
 	unsigned           *thread_id; /*!< Thread identifier. */
+	handler_thread_t   *threads; /*!< Thread placement and statistics. */
 } iohandler_t;
 
+/*! \brief Count a handled query. */
+static inline void handler_thread_count(handler_thread_t *thread)
+{
+#ifdef HAVE_ATOMIC
+	__atomic_store_n(&thread->queries, thread->queries + 1, __ATOMIC_RELAXED);
+#else
+	thread->queries++;
+#endif
+}
+
 /*! \brief Server state flags.
  */
 typedef enum {
@@ -56,6 +82,7 @@ typedef struct iface {
 	int fd_udp_count;
 	int *fd_tcp;
 	int fd_tcp_count;
+	bool tls;
 	struct sockaddr_storage addr;
 } iface_t;
 
@@ -77,8 +104,8 @@ typedef struct server {
 
 	/*! \brief Zone database. */
 	knot_zonedb_t *zone_db;
-	knot_lmdb_db_t timerdb;
-	knot_lmdb_db_t journaldb;
+	knot_lmdb_shards_t timerdb;
+	knot_lmdb_shards_t journaldb;
 	knot_lmdb_db_t kaspdb;
 
 	/*! \brief I/O handlers. */
@@ -90,12 +117,19 @@ typedef struct server {
 	/*! \brief Background jobs. */
 	worker_pool_t *workers;
 
+	/*! \brief CPUs of the background workers, none if not restricted. */
+	unsigned *bg_cpus;
+	unsigned bg_cpu_count;
+
 	/*! \brief Event scheduler. */
 	evsched_t sched;
 
 	/*! \brief List of interfaces. */
 	list_t *ifaces;
 
+	/*! \brief DNS over TLS context, if configured. */
+	struct tls_ctx *tls;
+
 } server_t;
 
 /*!
@@ -31,6 +31,7 @@
 
 #include "knot/server/server.h"
 #include "knot/server/tcp-handler.h"
+#include "knot/server/tls.h"
 #include "knot/common/log.h"
 #include "knot/nameserver/process_query.h"
 #include "knot/query/layer.h"
@@ -51,6 +52,7 @@ typedef struct tcp_context {
 	bool is_throttled;               /*!< TCP connections throttling switch. */
 	fdset_t set;                     /*!< Set of server/client sockets. */
 	unsigned thread_id;              /*!< Thread identifier. */
+	handler_thread_t *stats;         /*!< Thread statistics. */
 	unsigned max_worker_fds;         /*!< Max TCP clients per worker configuration + no. of ifaces. */
 	int idle_timeout;                /*!< [s] TCP idle timeout configuration. */
 	int io_timeout;                  /*!< [ms] TCP send/recv timeout configuration. */
@@ -74,6 +76,28 @@ static void update_tcp_conf(tcp_context_t *tcp)
 	rcu_read_unlock();
 }
 
+/*!
+ * \brief Get the idle timeout for client connections.
+ *
+ * The configured timeout applies while at most half of the client slots are
+ * used, then it's lowered linearly so that the last free slot gets none.
+ *
+ * \return Idle timeout in seconds.
+ */
+static int tcp_idle_timeout(const tcp_context_t *tcp)
+{
+	unsigned capacity = tcp->max_worker_fds - tcp->client_threshold;
+	unsigned clients = tcp->set.n - tcp->client_threshold;
+	unsigned free_slots = (clients < capacity) ? capacity - clients : 0;
+	unsigned half = MAX(capacity / 2, 1);
+
+	if (free_slots >= half) {
+		return tcp->idle_timeout;
+	}
+
+	return tcp->idle_timeout * free_slots / half;
+}
+
 /*! \brief Sweep TCP connection. */
 static enum fdset_sweep_state tcp_sweep(fdset_t *set, int i, void *data)
 {
@@ -90,6 +114,7 @@ static enum fdset_sweep_state tcp_sweep(fdset_t *set, int i, void *data)
 		log_notice("TCP, terminated inactive client, address %s", addr_str);
 	}
 
+	tls_conn_free(set->ctx[i]);
 	close(fd);
 
 	return FDSET_SWEEP;
@@ -118,38 +143,41 @@ static void tcp_log_error(struct sockaddr_storage *ss, const char *operation, in
 /*!
  * \brief Make a TCP fdset from current interfaces list.
  *
- * \param  ifaces    Interface list.
+ * \param  server    Server with the interface list.
  * \param  fds       File descriptor set.
  * \param  thread_id Thread ID used for geting an ID.
  *
  * \return Number of watched descriptors.
  */
-static unsigned tcp_set_ifaces(const list_t *ifaces, fdset_t *fds, int thread_id)
+static unsigned tcp_set_ifaces(const server_t *server, fdset_t *fds, int thread_id)
 {
-	if (ifaces == NULL) {
+	if (server->ifaces == NULL) {
 		return 0;
 	}
 
 	fdset_clear(fds);
 	iface_t *i;
-	WALK_LIST(i, *ifaces) {
+	WALK_LIST(i, *server->ifaces) {
 		int tcp_id = 0;
 #ifdef ENABLE_REUSEPORT
 		if (conf()->cache.srv_tcp_reuseport) {
 			/* Note: thread_ids start with UDP threads, TCP threads follow. */
-			assert((i->fd_udp_count <= thread_id) &&
-			       (thread_id < i->fd_tcp_count + i->fd_udp_count));
+			int udp_threads = server->handlers[IO_UDP].size;
+			assert((udp_threads <= thread_id) &&
+			       (thread_id < i->fd_tcp_count + udp_threads));
 
-			tcp_id = thread_id - i->fd_udp_count;
+			tcp_id = thread_id - udp_threads;
 		}
 #endif
-		fdset_add(fds, i->fd_tcp[tcp_id], POLLIN, NULL);
+		/* TLS listeners carry the context for new connections. */
+		fdset_add(fds, i->fd_tcp[tcp_id], POLLIN, i->tls ? server->tls : NULL);
 	}
 
 	return fds->n;
 }
 
-static int tcp_handle(tcp_context_t *tcp, int fd, struct iovec *rx, struct iovec *tx)
+static int tcp_handle(tcp_context_t *tcp, int fd, tls_conn_t *tls,
+                      struct iovec *rx, struct iovec *tx)
 {
 	/* Get peer name. */
 	struct sockaddr_storage ss;
@@ -162,15 +190,19 @@ static int tcp_handle(tcp_context_t *tcp, int fd, struct iovec *rx, struct iovec
 	knotd_qdata_params_t params = {
 		.remote = &ss,
 		.socket = fd,
+		.flags = KNOTD_QUERY_FLAG_KEEPALIVE,
 		.server = tcp->server,
-		.thread_id = tcp->thread_id
+		.thread_id = tcp->thread_id,
+		.keepalive = MIN(tcp_idle_timeout(tcp) * 10, UINT16_MAX)
 	};
 
 	rx->iov_len = KNOT_WIRE_MAX_PKTSIZE;
 	tx->iov_len = KNOT_WIRE_MAX_PKTSIZE;
 
 	/* Receive data. */
-	int recv = net_dns_tcp_recv(fd, rx->iov_base, rx->iov_len, tcp->io_timeout);
+	int recv = (tls != NULL) ?
+	           tls_recv_dns(tls, rx->iov_base, rx->iov_len, tcp->io_timeout) :
+	           net_dns_tcp_recv(fd, rx->iov_base, rx->iov_len, tcp->io_timeout);
 	if (recv > 0) {
 		rx->iov_len = recv;
 	} else {
@@ -180,13 +212,14 @@ static int tcp_handle(tcp_context_t *tcp, int fd, struct iovec *rx, struct iovec
 
 	/* Initialize processing layer. */
 	knot_layer_begin(&tcp->layer, &params);
+	handler_thread_count(tcp->stats);
 
 	/* Create packets. */
 	knot_pkt_t *ans = knot_pkt_new(tx->iov_base, tx->iov_len, tcp->layer.mm);
 	knot_pkt_t *query = knot_pkt_new(rx->iov_base, rx->iov_len, tcp->layer.mm);
 
 	/* Input packet. */
-	(void) knot_pkt_parse(query, 0);
+	(void) knot_pkt_parse(query, KNOT_PF_LAZY);
 	knot_layer_consume(&tcp->layer, query);
 
 	int ret = KNOT_EOK;
@@ -196,7 +229,9 @@ static int tcp_handle(tcp_context_t *tcp, int fd, struct iovec *rx, struct iovec
 		knot_layer_produce(&tcp->layer, ans);
 		/* Send, if response generation passed and wasn't ignored. */
 		if (ans->size > 0 && tcp_send_state(tcp->layer.state)) {
-			int sent = net_dns_tcp_send(fd, ans->wire, ans->size, tcp->io_timeout);
+			int sent = (tls != NULL) ?
+			           tls_send_dns(tls, ans->wire, ans->size, tcp->io_timeout) :
+			           net_dns_tcp_send(fd, ans->wire, ans->size, tcp->io_timeout);
 			if (sent != ans->size) {
 				tcp_log_error(&ss, "send", sent);
 				ret = KNOT_EOF;
@@ -220,25 +255,52 @@ static void tcp_event_accept(tcp_context_t *tcp, unsigned i)
 	int fd = tcp->set.pfd[i].fd;
 	int client = net_accept(fd, NULL);
 	if (client >= 0) {
+		/* Prepare TLS state if accepted on a TLS interface. */
+		tls_conn_t *tls = NULL;
+		if (tcp->set.ctx[i] != NULL) {
+			tls = tls_conn_new(tcp->set.ctx[i], client);
+			if (tls == NULL) {
+				close(client);
+				return;
+			}
+		}
+
 		/* Assign to fdset. */
-		int next_id = fdset_add(&tcp->set, client, POLLIN, NULL);
+		int next_id = fdset_add(&tcp->set, client, POLLIN, tls);
 		if (next_id < 0) {
+			tls_conn_free(tls);
 			close(client);
 			return;
 		}
 
 		/* Update watchdog timer. */
-		fdset_set_watchdog(&tcp->set, next_id, tcp->idle_timeout);
+		fdset_set_watchdog(&tcp->set, next_id, tcp_idle_timeout(tcp));
 	}
 }
 
 static int tcp_event_serve(tcp_context_t *tcp, unsigned i)
 {
 	int fd = tcp->set.pfd[i].fd;
-	int ret = tcp_handle(tcp, fd, &tcp->iov[0], &tcp->iov[1]);
+	tls_conn_t *tls = tcp->set.ctx[i];
+
+	/* Continue the TLS handshake, the watchdog limits its duration. */
+	if (tls != NULL && !tls->established) {
+		int ret = tls_conn_handshake(tls);
+		if (ret != KNOT_EOK) {
+			return (ret == KNOT_EAGAIN) ? KNOT_EOK : ret;
+		} else if (!tls_conn_pending(tls)) {
+			return KNOT_EOK;
+		}
+	}
+
+	/* Already decrypted queries don't wake up the poll. */
+	int ret;
+	do {
+		ret = tcp_handle(tcp, fd, tls, &tcp->iov[0], &tcp->iov[1]);
+	} while (ret == KNOT_EOK && tls != NULL && tls_conn_pending(tls));
 	if (ret == KNOT_EOK) {
-		/* Update socket activity timer. */
-		fdset_set_watchdog(&tcp->set, i, tcp->idle_timeout);
+		/* Update socket activity timer, keep the advertised timeout. */
+		fdset_set_watchdog(&tcp->set, i, tcp_idle_timeout(tcp));
 	}
 
 	return ret;
@@ -284,6 +346,7 @@ static void tcp_wait_for_events(tcp_context_t *tcp)
 
 		/* Evaluate. */
 		if (should_close) {
+			tls_conn_free(set->ctx[i]);
 			close(set->pfd[i].fd);
 			fdset_remove(set, i);
 		} else {
@@ -299,9 +362,16 @@ int tcp_master(dthread_t *thread)
 	}
 
 	iohandler_t *handler = (iohandler_t *)thread->data;
+	handler_thread_t *stats = &handler->threads[dt_get_id(thread)];
 
 	int ret = KNOT_EOK;
 
+	/* Bind to the planned CPU first, so that the buffers are node-local. */
+	if (stats->cpu >= 0) {
+		unsigned cpu = stats->cpu;
+		dt_setaffinity(thread, &cpu, 1);
+	}
+
 	/* Create big enough memory cushion. */
 	knot_mm_t mm;
 	mm_ctx_mempool(&mm, 16 * MM_DEFAULT_BLKSIZE);
@@ -310,7 +380,8 @@ int tcp_master(dthread_t *thread)
 	tcp_context_t tcp = {
 		.server = handler->server,
 		.is_throttled = false,
-		.thread_id = handler->thread_id[dt_get_id(thread)]
+		.thread_id = handler->thread_id[dt_get_id(thread)],
+		.stats = stats
 	};
 	knot_layer_init(&tcp.layer, &mm, process_query_layer());
 
@@ -333,7 +404,7 @@ int tcp_master(dthread_t *thread)
 	update_tcp_conf(&tcp);
 
 	/* Set descriptors for the configured interfaces. */
-	tcp.client_threshold = tcp_set_ifaces(handler->server->ifaces, &tcp.set, tcp.thread_id);
+	tcp.client_threshold = tcp_set_ifaces(handler->server, &tcp.set, tcp.thread_id);
 	if (tcp.client_threshold == 0) {
 		goto finish; /* Terminate on zero interfaces. */
 	}
@@ -356,6 +427,9 @@ int tcp_master(dthread_t *thread)
 	}
 
 finish:
+	for (unsigned i = tcp.client_threshold; i < tcp.set.n; i++) {
+		tls_conn_free(tcp.set.ctx[i]);
+	}
 	free(tcp.iov[0].iov_base);
 	free(tcp.iov[1].iov_base);
 	mp_delete(mm.ctx);
@@ -0,0 +1,282 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef HAVE_GNUTLS_KTLS
+#include <gnutls/socket.h>
+#endif
+
+#include "knot/server/tls.h"
+#include "libknot/errcode.h"
+#include "libknot/wire.h"
+#include "contrib/macros.h"
+#include "contrib/net.h"
+#include "contrib/string.h"
+#include "contrib/time.h"
+
+/*! \brief ALPN identifier of DNS over TLS. */
+static const gnutls_datum_t tls_alpn = {
+	.data = (unsigned char *)"dot",
+	.size = 3
+};
+
+int tls_ctx_init(tls_ctx_t **ctx, const char *cert_file, const char *key_file)
+{
+	if (ctx == NULL || cert_file == NULL || key_file == NULL) {
+		return KNOT_EINVAL;
+	}
+
+	tls_ctx_t *new_ctx = calloc(1, sizeof(*new_ctx));
+	if (new_ctx == NULL) {
+		return KNOT_ENOMEM;
+	}
+
+	int ret = gnutls_certificate_allocate_credentials(&new_ctx->creds);
+	if (ret != GNUTLS_E_SUCCESS) {
+		free(new_ctx);
+		return KNOT_ENOMEM;
+	}
+
+	ret = gnutls_certificate_set_x509_key_file(new_ctx->creds, cert_file,
+	                                           key_file, GNUTLS_X509_FMT_PEM);
+	if (ret != GNUTLS_E_SUCCESS) {
+		tls_ctx_deinit(new_ctx);
+		return KNOT_EFILE;
+	}
+
+	ret = gnutls_priority_init2(&new_ctx->priority, "%SERVER_PRECEDENCE",
+	                            NULL, GNUTLS_PRIORITY_INIT_DEF_APPEND);
+	if (ret != GNUTLS_E_SUCCESS) {
+		tls_ctx_deinit(new_ctx);
+		return KNOT_EINVAL;
+	}
+
+	/* Common key so that a ticket is valid on any thread. */
+	ret = gnutls_session_ticket_key_generate(&new_ctx->ticket_key);
+	if (ret != GNUTLS_E_SUCCESS) {
+		tls_ctx_deinit(new_ctx);
+		return KNOT_ENOMEM;
+	}
+
+	*ctx = new_ctx;
+
+	return KNOT_EOK;
+}
+
+void tls_ctx_deinit(tls_ctx_t *ctx)
+{
+	if (ctx == NULL) {
+		return;
+	}
+
+	if (ctx->ticket_key.data != NULL) {
+		memzero(ctx->ticket_key.data, ctx->ticket_key.size);
+		gnutls_free(ctx->ticket_key.data);
+	}
+	if (ctx->priority != NULL) {
+		gnutls_priority_deinit(ctx->priority);
+	}
+	if (ctx->creds != NULL) {
+		gnutls_certificate_free_credentials(ctx->creds);
+	}
+	free(ctx);
+}
+
+tls_conn_t *tls_conn_new(tls_ctx_t *ctx, int fd)
+{
+	assert(ctx);
+
+	tls_conn_t *conn = calloc(1, sizeof(*conn));
+	if (conn == NULL) {
+		return NULL;
+	}
+
+	if (gnutls_init(&conn->session, GNUTLS_SERVER | GNUTLS_NONBLOCK |
+	                                GNUTLS_NO_SIGNAL) != GNUTLS_E_SUCCESS) {
+		free(conn);
+		return NULL;
+	}
+
+	if (gnutls_priority_set(conn->session, ctx->priority) != GNUTLS_E_SUCCESS ||
+	    gnutls_credentials_set(conn->session, GNUTLS_CRD_CERTIFICATE,
+	                           ctx->creds) != GNUTLS_E_SUCCESS ||
+	    gnutls_session_ticket_enable_server(conn->session,
+	                                        &ctx->ticket_key) != GNUTLS_E_SUCCESS ||
+	    gnutls_alpn_set_protocols(conn->session, &tls_alpn, 1, 0) != GNUTLS_E_SUCCESS) {
+		tls_conn_free(conn);
+		return NULL;
+	}
+
+	gnutls_transport_set_int(conn->session, fd);
+	conn->fd = fd;
+
+	return conn;
+}
+
+void tls_conn_free(tls_conn_t *conn)
+{
+	if (conn == NULL) {
+		return;
+	}
+
+	if (conn->established) {
+		(void)gnutls_bye(conn->session, GNUTLS_SHUT_WR);
+	}
+	gnutls_deinit(conn->session);
+	free(conn);
+}
+
+int tls_conn_handshake(tls_conn_t *conn)
+{
+	assert(conn);
+
+	if (conn->established) {
+		return KNOT_EOK;
+	}
+
+	int ret = gnutls_handshake(conn->session);
+	if (ret == GNUTLS_E_AGAIN || ret == GNUTLS_E_INTERRUPTED) {
+		return KNOT_EAGAIN;
+	} else if (ret != GNUTLS_E_SUCCESS) {
+		return KNOT_ECONN;
+	}
+
+	conn->established = true;
+#ifdef HAVE_GNUTLS_KTLS
+	conn->ktls_send = gnutls_transport_is_ktls_enabled(conn->session) &
+	                  GNUTLS_KTLS_SEND;
+#endif
+
+	return KNOT_EOK;
+}
+
+bool tls_conn_pending(tls_conn_t *conn)
+{
+	return conn->established && gnutls_record_check_pending(conn->session) > 0;
+}
+
+/*! \brief Wait for the socket, the remaining time is updated. */
+static int tls_wait(tls_conn_t *conn, short events, int *timeout_ms)
+{
+	struct pollfd pfd = {
+		.fd = conn->fd,
+		.events = events
+	};
+
+	struct timespec begin = time_now();
+	int ret = poll(&pfd, 1, *timeout_ms);
+	if (ret == 0) {
+		return KNOT_ETIMEOUT;
+	} else if (ret < 0 && errno != EINTR) {
+		return knot_map_errno();
+	}
+
+	if (*timeout_ms > 0) {
+		struct timespec end = time_now();
+		int elapsed = time_diff_ms(&begin, &end);
+		*timeout_ms = MAX(*timeout_ms - elapsed, 0);
+	}
+
+	return KNOT_EOK;
+}
+
+/*! \brief Receive exactly the requested amount of data. */
+static int tls_recv_all(tls_conn_t *conn, uint8_t *buf, size_t len, int *timeout_ms)
+{
+	size_t done = 0;
+	while (done < len) {
+		ssize_t ret = gnutls_record_recv(conn->session, buf + done, len - done);
+		if (ret > 0) {
+			done += ret;
+		} else if (ret == 0) {
+			return KNOT_ECONN;
+		} else if (ret == GNUTLS_E_AGAIN || ret == GNUTLS_E_INTERRUPTED) {
+			int wait = tls_wait(conn, POLLIN, timeout_ms);
+			if (wait != KNOT_EOK) {
+				return wait;
+			}
+		} else {
+			return KNOT_NET_ERECV;
+		}
+	}
+
+	return KNOT_EOK;
+}
+
+int tls_recv_dns(tls_conn_t *conn, uint8_t *buf, size_t size, int timeout_ms)
+{
+	if (conn == NULL || buf == NULL || !conn->established) {
+		return KNOT_EINVAL;
+	}
+
+	uint8_t prefix[sizeof(uint16_t)];
+	int ret = tls_recv_all(conn, prefix, sizeof(prefix), &timeout_ms);
+	if (ret != KNOT_EOK) {
+		return ret;
+	}
+
+	size_t len = knot_wire_read_u16(prefix);
+	if (len > size) {
+		return KNOT_ESPACE;
+	}
+
+	ret = tls_recv_all(conn, buf, len, &timeout_ms);
+	if (ret != KNOT_EOK) {
+		return ret;
+	}
+
+	return len;
+}
+
+int tls_send_dns(tls_conn_t *conn, const uint8_t *msg, size_t len, int timeout_ms)
+{
+	if (conn == NULL || msg == NULL || len > UINT16_MAX || !conn->established) {
+		return KNOT_EINVAL;
+	}
+
+	/* The kernel does the encryption, skip the record layer copy. */
+	if (conn->ktls_send) {
+		return net_dns_tcp_send(conn->fd, msg, len, timeout_ms);
+	}
+
+	/* Prefix and message in one record. */
+	gnutls_record_cork(conn->session);
+	uint8_t prefix[sizeof(uint16_t)];
+	knot_wire_write_u16(prefix, len);
+	if (gnutls_record_send(conn->session, prefix, sizeof(prefix)) < 0 ||
+	    gnutls_record_send(conn->session, msg, len) < 0) {
+		return KNOT_NET_ESEND;
+	}
+
+	while (true) {
+		int ret = gnutls_record_uncork(conn->session, 0);
+		if (ret >= 0) {
+			break;
+		} else if (ret != GNUTLS_E_AGAIN && ret != GNUTLS_E_INTERRUPTED) {
+			return KNOT_NET_ESEND;
+		}
+		ret = tls_wait(conn, POLLOUT, &timeout_ms);
+		if (ret != KNOT_EOK) {
+			return ret;
+		}
+	}
+
+	return len;
+}
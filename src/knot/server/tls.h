@@ -0,0 +1,102 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \brief DNS over TLS (RFC 7858) support for the TCP handler.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <gnutls/gnutls.h>
+
+#define TLS_DEFAULT_PORT 853 /*!< DNS over TLS port. */
+
+/*! \brief Server-wide TLS context, shared by the TCP threads. */
+typedef struct tls_ctx {
+	gnutls_certificate_credentials_t creds; /*!< Server certificate and key. */
+	gnutls_priority_t priority;             /*!< Cipher suite priorities. */
+	gnutls_datum_t ticket_key;              /*!< Session ticket encryption key. */
+} tls_ctx_t;
+
+/*! \brief TLS state of a client connection. */
+typedef struct {
+	gnutls_session_t session;
+	int fd;                  /*!< Connection socket. */
+	bool established;        /*!< Handshake completed. */
+	bool ktls_send;          /*!< Kernel encrypts sent records. */
+} tls_conn_t;
+
+/*!
+ * \brief Create the server TLS context.
+ *
+ * \param ctx        Output context.
+ * \param cert_file  PEM certificate (chain) file.
+ * \param key_file   PEM private key file.
+ *
+ * \return Error code, KNOT_EOK if successful.
+ */
+int tls_ctx_init(tls_ctx_t **ctx, const char *cert_file, const char *key_file);
+
+/*!
+ * \brief Free the server TLS context.
+ */
+void tls_ctx_deinit(tls_ctx_t *ctx);
+
+/*!
+ * \brief Create TLS state for an accepted (non-blocking) client socket.
+ *
+ * \return New connection state or NULL.
+ */
+tls_conn_t *tls_conn_new(tls_ctx_t *ctx, int fd);
+
+/*!
+ * \brief Free connection TLS state (doesn't close the socket).
+ */
+void tls_conn_free(tls_conn_t *conn);
+
+/*!
+ * \brief Advance the handshake without blocking.
+ *
+ * \retval KNOT_EOK     Handshake completed.
+ * \retval KNOT_EAGAIN  More data needed, wait for the socket.
+ * \retval (error)      Handshake failed.
+ */
+int tls_conn_handshake(tls_conn_t *conn);
+
+/*!
+ * \brief Check if there is a decrypted message already waiting in the session.
+ */
+bool tls_conn_pending(tls_conn_t *conn);
+
+/*!
+ * \brief Receive one DNS message (with the two-byte length prefix).
+ *
+ * \return Message length, or error.
+ */
+int tls_recv_dns(tls_conn_t *conn, uint8_t *buf, size_t size, int timeout_ms);
+
+/*!
+ * \brief Send one DNS message (with the two-byte length prefix).
+ *
+ * If the kernel encrypts the records (kTLS), the message is sent with a plain
+ * sendmsg() on the socket.
+ *
+ * \return Message length, or error.
+ */
+int tls_send_dns(tls_conn_t *conn, const uint8_t *msg, size_t len, int timeout_ms);
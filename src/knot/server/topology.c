@@ -0,0 +1,345 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <dirent.h>
+#include <ifaddrs.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "knot/server/topology.h"
+#include "knot/server/dthreads.h"
+#include "libknot/errcode.h"
+#include "contrib/sockaddr.h"
+
+#define SYSFS_CPU  "/sys/devices/system/cpu"
+#define SYSFS_NODE "/sys/devices/system/node"
+#define SYSFS_NET  "/sys/class/net"
+
+/*! \brief Read the first line of a sysfs file. */
+static bool read_line(const char *path, char *buf, size_t size)
+{
+	FILE *file = fopen(path, "r");
+	if (file == NULL) {
+		return false;
+	}
+
+	bool ok = (fgets(buf, size, file) != NULL);
+	fclose(file);
+
+	return ok;
+}
+
+/*!
+ * \brief Parse a CPU list (e.g. "0-3,8,10-11").
+ *
+ * \param cb  Callback for each listed CPU.
+ */
+static void parse_cpulist(const char *list, void (*cb)(unsigned, void *), void *data)
+{
+	const char *pos = list;
+	while (*pos != '\0' && *pos != '\n') {
+		char *end;
+		unsigned long first = strtoul(pos, &end, 10);
+		if (end == pos) {
+			return;
+		}
+		unsigned long last = first;
+		if (*end == '-') {
+			pos = end + 1;
+			last = strtoul(pos, &end, 10);
+			if (end == pos || last < first) {
+				return;
+			}
+		}
+		for (unsigned long cpu = first; cpu <= last; cpu++) {
+			cb(cpu, data);
+		}
+		pos = (*end == ',') ? end + 1 : end;
+	}
+}
+
+static void add_cpu(unsigned cpu, void *data)
+{
+	topology_t *topo = data;
+	topo_cpu_t *cpus = realloc(topo->cpus, (topo->count + 1) * sizeof(*cpus));
+	if (cpus == NULL) {
+		return;
+	}
+	topo->cpus = cpus;
+	topo->cpus[topo->count++] = (topo_cpu_t) {
+		.id = cpu,
+		.node = 0,
+		.core = cpu
+	};
+}
+
+static topo_cpu_t *find_cpu(const topology_t *topo, unsigned cpu)
+{
+	for (unsigned i = 0; i < topo->count; i++) {
+		if (topo->cpus[i].id == cpu) {
+			return &topo->cpus[i];
+		}
+	}
+
+	return NULL;
+}
+
+struct node_ctx {
+	topology_t *topo;
+	int node;
+};
+
+static void set_node(unsigned cpu, void *data)
+{
+	struct node_ctx *ctx = data;
+	topo_cpu_t *found = find_cpu(ctx->topo, cpu);
+	if (found != NULL) {
+		found->node = ctx->node;
+	}
+}
+
+static void load_nodes(topology_t *topo)
+{
+	DIR *dir = opendir(SYSFS_NODE);
+	if (dir == NULL) {
+		return;
+	}
+
+	struct dirent *entry;
+	while ((entry = readdir(dir)) != NULL) {
+		int node;
+		if (sscanf(entry->d_name, "node%d", &node) != 1) {
+			continue;
+		}
+
+		char path[64], list[1024];
+		(void)snprintf(path, sizeof(path), SYSFS_NODE "/node%d/cpulist", node);
+		if (read_line(path, list, sizeof(list))) {
+			struct node_ctx ctx = { topo, node };
+			parse_cpulist(list, set_node, &ctx);
+		}
+	}
+
+	closedir(dir);
+}
+
+static void lowest_cpu(unsigned cpu, void *data)
+{
+	unsigned *lowest = data;
+	if (cpu < *lowest) {
+		*lowest = cpu;
+	}
+}
+
+static void load_cores(topology_t *topo)
+{
+	for (unsigned i = 0; i < topo->count; i++) {
+		char path[96], list[1024];
+		(void)snprintf(path, sizeof(path),
+		               SYSFS_CPU "/cpu%u/topology/thread_siblings_list",
+		               topo->cpus[i].id);
+		if (read_line(path, list, sizeof(list))) {
+			unsigned core = topo->cpus[i].id;
+			parse_cpulist(list, lowest_cpu, &core);
+			topo->cpus[i].core = core;
+		}
+	}
+}
+
+int topology_load(topology_t *topo)
+{
+	if (topo == NULL) {
+		return KNOT_EINVAL;
+	}
+
+	memset(topo, 0, sizeof(*topo));
+
+	char list[1024];
+	if (read_line(SYSFS_CPU "/online", list, sizeof(list))) {
+		parse_cpulist(list, add_cpu, topo);
+	}
+
+	if (topo->count > 0) {
+		load_nodes(topo);
+		load_cores(topo);
+	} else {
+		/* Flat topology fallback. */
+		int count = dt_online_cpus();
+		for (int cpu = 0; cpu < count; cpu++) {
+			add_cpu(cpu, topo);
+		}
+	}
+
+	return (topo->count > 0) ? KNOT_EOK : KNOT_ENOTSUP;
+}
+
+void topology_free(topology_t *topo)
+{
+	if (topo == NULL) {
+		return;
+	}
+
+	free(topo->cpus);
+	memset(topo, 0, sizeof(*topo));
+}
+
+int topology_cpu_node(const topology_t *topo, unsigned cpu)
+{
+	topo_cpu_t *found = find_cpu(topo, cpu);
+
+	return (found != NULL) ? found->node : -1;
+}
+
+int topology_addr_node(const struct sockaddr_storage *addr)
+{
+	if (addr == NULL || sockaddr_is_any(addr)) {
+		return -1;
+	}
+
+	struct ifaddrs *ifaddrs;
+	if (getifaddrs(&ifaddrs) != 0) {
+		return -1;
+	}
+
+	int node = -1;
+	for (struct ifaddrs *ifa = ifaddrs; ifa != NULL; ifa = ifa->ifa_next) {
+		if (ifa->ifa_addr == NULL || ifa->ifa_addr->sa_family != addr->ss_family) {
+			continue;
+		}
+
+		struct sockaddr_storage ifa_ss = { 0 };
+		memcpy(&ifa_ss, ifa->ifa_addr, sockaddr_len((struct sockaddr_storage *)ifa->ifa_addr));
+		if (!sockaddr_net_match(&ifa_ss, addr, UINT_MAX)) {
+			continue;
+		}
+
+		char path[128], value[16];
+		(void)snprintf(path, sizeof(path), SYSFS_NET "/%s/device/numa_node",
+		               ifa->ifa_name);
+		if (read_line(path, value, sizeof(value))) {
+			node = atoi(value);
+		}
+		break;
+	}
+
+	freeifaddrs(ifaddrs);
+
+	return (node >= 0) ? node : -1;
+}
+
+/*! \brief Sort key: primary SMT threads, preferred node, CPU number. */
+static uint64_t place_key(const topo_cpu_t *cpu, int node)
+{
+	uint64_t secondary = (cpu->id != cpu->core) ? 1 : 0;
+	uint64_t rank = (node >= 0 && cpu->node == node) ? 0 : 1 + (unsigned)cpu->node;
+
+	return secondary << 48 | rank << 24 | cpu->id;
+}
+
+static int cmp_key(const void *a, const void *b)
+{
+	uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+int topology_place(const topology_t *topo, int node, unsigned udp_count,
+                   unsigned tcp_count, placement_t *place)
+{
+	if (topo == NULL || topo->count == 0 || place == NULL) {
+		return KNOT_EINVAL;
+	}
+
+	memset(place, 0, sizeof(*place));
+
+	unsigned count = topo->count;
+	uint64_t *order = malloc(count * sizeof(*order));
+	bool *serving = calloc(count, sizeof(*serving));
+	bool *serving_core = calloc(count, sizeof(*serving_core));
+	place->udp = malloc((udp_count + 1) * sizeof(int));
+	place->tcp = malloc((tcp_count + 1) * sizeof(int));
+	place->bg = malloc(count * sizeof(unsigned));
+	if (order == NULL || serving == NULL || serving_core == NULL ||
+	    place->udp == NULL || place->tcp == NULL || place->bg == NULL) {
+		free(order);
+		free(serving);
+		free(serving_core);
+		placement_free(place);
+		return KNOT_ENOMEM;
+	}
+
+	/* The CPU index is kept in the lowest bits of the sorted keys. */
+	for (unsigned i = 0; i < count; i++) {
+		order[i] = (place_key(&topo->cpus[i], node) & ~0xFFFFFFULL) | i;
+	}
+	qsort(order, count, sizeof(*order), cmp_key);
+
+	/* Query handling threads, wrap around if more threads than CPUs. */
+	for (unsigned i = 0; i < udp_count + tcp_count; i++) {
+		unsigned idx = order[i % count] & 0xFFFFFF;
+		const topo_cpu_t *cpu = &topo->cpus[idx];
+		if (i < udp_count) {
+			place->udp[i] = cpu->id;
+		} else {
+			place->tcp[i - udp_count] = cpu->id;
+		}
+		serving[idx] = true;
+		for (unsigned j = 0; j < count; j++) {
+			if (topo->cpus[j].core == cpu->core) {
+				serving_core[j] = true;
+			}
+		}
+	}
+
+	/* Background workers avoid the query handling cores, or CPUs at least. */
+	for (unsigned i = 0; i < count; i++) {
+		if (!serving_core[i]) {
+			place->bg[place->bg_count++] = topo->cpus[i].id;
+		}
+	}
+	if (place->bg_count == 0) {
+		for (unsigned i = 0; i < count; i++) {
+			if (!serving[i]) {
+				place->bg[place->bg_count++] = topo->cpus[i].id;
+			}
+		}
+	}
+	/* Otherwise the background CPU set would be the same as all CPUs. */
+	if (place->bg_count == count) {
+		place->bg_count = 0;
+	}
+
+	free(order);
+	free(serving);
+	free(serving_core);
+
+	return KNOT_EOK;
+}
+
+void placement_free(placement_t *place)
+{
+	if (place == NULL) {
+		return;
+	}
+
+	free(place->udp);
+	free(place->tcp);
+	free(place->bg);
+	memset(place, 0, sizeof(*place));
+}
@@ -0,0 +1,98 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \brief CPU topology and placement of the server threads.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <sys/socket.h>
+
+/*! \brief Online CPU description. */
+typedef struct {
+	unsigned id;    /*!< CPU number. */
+	int node;       /*!< NUMA node, 0 if unknown. */
+	unsigned core;  /*!< Physical core, the lowest CPU number of its SMT siblings. */
+} topo_cpu_t;
+
+/*! \brief Online CPUs of the system. */
+typedef struct {
+	topo_cpu_t *cpus;  /*!< CPUs ordered by number. */
+	unsigned count;    /*!< Number of CPUs. */
+} topology_t;
+
+/*! \brief Assignment of CPUs to the server threads. */
+typedef struct {
+	int *udp;           /*!< CPU of each UDP thread, -1 if not bound. */
+	int *tcp;           /*!< CPU of each TCP thread, -1 if not bound. */
+	unsigned *bg;       /*!< CPUs for the background workers. */
+	unsigned bg_count;  /*!< Number of background CPUs, 0 if not restricted. */
+} placement_t;
+
+/*!
+ * \brief Detect the online CPUs, their NUMA nodes and SMT siblings.
+ *
+ * If the details are not available (non-Linux systems), a flat topology
+ * with one node and no SMT is assumed.
+ *
+ * \return Error code, KNOT_EOK if successful.
+ */
+int topology_load(topology_t *topo);
+
+/*!
+ * \brief Free the topology.
+ */
+void topology_free(topology_t *topo);
+
+/*!
+ * \brief Get the NUMA node of a CPU.
+ *
+ * \return NUMA node, -1 if not an online CPU.
+ */
+int topology_cpu_node(const topology_t *topo, unsigned cpu);
+
+/*!
+ * \brief Get the NUMA node of the network device with the given address.
+ *
+ * \return NUMA node, -1 if unknown (e.g. wildcard address).
+ */
+int topology_addr_node(const struct sockaddr_storage *addr);
+
+/*!
+ * \brief Plan the placement of the query handling and background threads.
+ *
+ * The query handling threads (UDP first, then TCP) get one physical core
+ * each, preferring the given NUMA node, before SMT siblings are used.
+ * The background workers get the cores not used for query handling, or at
+ * least the CPUs not used, if there are any.
+ *
+ * \param topo       CPU topology.
+ * \param node       Preferred NUMA node, -1 for none.
+ * \param udp_count  Number of UDP threads.
+ * \param tcp_count  Number of TCP threads.
+ * \param place      Output placement.
+ *
+ * \return Error code, KNOT_EOK if successful.
+ */
+int topology_place(const topology_t *topo, int node, unsigned udp_count,
+                   unsigned tcp_count, placement_t *place);
+
+/*!
+ * \brief Free the placement.
+ */
+void placement_free(placement_t *place);
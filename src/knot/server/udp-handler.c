@@ -26,6 +26,7 @@
 #include <string.h>
 #include <assert.h>
 #include <sys/param.h>
+#include <urcu.h>
 #ifdef HAVE_SYS_UIO_H	// struct iovec (OpenBSD)
 #include <sys/uio.h>
 #endif /* HAVE_SYS_UIO_H */
@@ -33,8 +34,11 @@
 #include "contrib/macros.h"
 #include "contrib/mempattern.h"
 #include "contrib/sockaddr.h"
+#include "contrib/time.h"
 #include "contrib/ucw/mempool.h"
 #include "knot/nameserver/process_query.h"
+#include "knot/nameserver/query_module.h"
+#include "knot/nameserver/query_prefetch.h"
 #include "knot/query/layer.h"
 #include "knot/server/server.h"
 #include "knot/server/udp-handler.h"
@@ -51,6 +55,10 @@ typedef struct {
 	knot_layer_t layer; /*!< Query processing layer. */
 	server_t *server;   /*!< Name server structure. */
 	unsigned thread_id; /*!< Thread identifier. */
+	handler_thread_t *stats; /*!< Thread statistics. */
+	knot_pkt_t *query;  /*!< Reusable query packet for the fast path. */
+	knot_pkt_t *ans;    /*!< Reusable answer packet for the fast path. */
+	query_batch_t batch; /*!< Queries waiting for the module batch hooks. */
 } udp_context_t;
 
 static bool udp_state_active(int state)
@@ -58,8 +66,28 @@ static bool udp_state_active(int state)
 	return (state == KNOT_STATE_PRODUCE || state == KNOT_STATE_FAIL);
 }
 
+/*! \brief Answer a plain query directly, return false if not possible. */
+static bool udp_handle_fast(udp_context_t *udp, knotd_qdata_params_t *params,
+                            struct iovec *rx, struct iovec *tx)
+{
+	if (udp->query == NULL || udp->ans == NULL ||
+	    knot_pkt_reset(udp->query, rx->iov_base, rx->iov_len) != KNOT_EOK ||
+	    knot_pkt_reset(udp->ans, tx->iov_base, tx->iov_len) != KNOT_EOK) {
+		return false;
+	}
+
+	int ret = process_query_fast(udp->query, udp->ans, params, udp->layer.mm);
+	if (ret != KNOT_EOK) {
+		return false;
+	}
+	tx->iov_len = udp->ans->size;
+
+	return true;
+}
+
 static void udp_handle(udp_context_t *udp, int fd, struct sockaddr_storage *ss,
-                       struct iovec *rx, struct iovec *tx)
+                       struct iovec *rx, struct iovec *tx,
+                       const query_prefetch_t *prefetch, query_batch_t *batch)
 {
 	/* Create query processing parameter. */
 	knotd_qdata_params_t params = {
@@ -69,9 +97,18 @@ static void udp_handle(udp_context_t *udp, int fd, struct sockaddr_storage *ss,
 		         KNOTD_QUERY_FLAG_LIMIT_ANY,  /* Limit ANY over UDP (depends on zone as well). */
 		.socket = fd,
 		.server = udp->server,
-		.thread_id = udp->thread_id
+		.thread_id = udp->thread_id,
+		.prefetch = prefetch,
+		.batch = batch
 	};
 
+	handler_thread_count(udp->stats);
+
+	/* Skip the processing layer for plain queries if possible. */
+	if (udp_handle_fast(udp, &params, rx, tx)) {
+		goto flush;
+	}
+
 	/* Start query processing. */
 	knot_layer_begin(&udp->layer, &params);
 
@@ -80,7 +117,7 @@ static void udp_handle(udp_context_t *udp, int fd, struct sockaddr_storage *ss,
 	knot_pkt_t *ans = knot_pkt_new(tx->iov_base, tx->iov_len, udp->layer.mm);
 
 	/* Input packet. */
-	(void) knot_pkt_parse(query, 0);
+	(void) knot_pkt_parse(query, KNOT_PF_LAZY);
 	knot_layer_consume(&udp->layer, query);
 
 	/* Process answer. */
@@ -98,12 +135,15 @@ static void udp_handle(udp_context_t *udp, int fd, struct sockaddr_storage *ss,
 	/* Reset after processing. */
 	knot_layer_finish(&udp->layer);
 
-	/* Flush per-query memory (including query and answer packets). */
-	mp_flush(udp->layer.mm->ctx);
+flush:
+	/* Flush per-query memory, unless referenced by the queued queries. */
+	if (batch == NULL || batch->count == 0) {
+		mp_flush(udp->layer.mm->ctx);
+	}
 }
 
 /*! \brief Pointer to selected UDP master implementation. */
-static void* (*_udp_init)(void) = 0;
+static void* (*_udp_init)(unsigned) = 0;
 static void (*_udp_deinit)(void *) = 0;
 static int (*_udp_recv)(int, void *) = 0;
 static int (*_udp_handle)(udp_context_t *, void *) = 0;
@@ -153,8 +193,10 @@ struct udp_recvfrom {
 	cmsg_pktinfo_t pktinfo;
 };
 
-static void *udp_recvfrom_init(void)
+static void *udp_recvfrom_init(unsigned max_depth)
 {
+	UNUSED(max_depth);
+
 	struct udp_recvfrom *rq = malloc(sizeof(struct udp_recvfrom));
 	if (rq == NULL) {
 		return NULL;
@@ -209,7 +251,7 @@ static int udp_recvfrom_handle(udp_context_t *ctx, void *d)
 	udp_pktinfo_handle(&rq->msg[RX], &rq->msg[TX]);
 
 	/* Process received pkt. */
-	udp_handle(ctx, rq->fd, &rq->addr, &rq->iov[RX], &rq->iov[TX]);
+	udp_handle(ctx, rq->fd, &rq->addr, &rq->iov[RX], &rq->iov[TX], NULL, NULL);
 
 	return KNOT_EOK;
 }
@@ -235,33 +277,96 @@ static int udp_recvfrom_send(void *d)
 /* UDP recvmmsg() request struct. */
 struct udp_recvmmsg {
 	int fd;
-	struct sockaddr_storage addrs[RECVMMSG_BATCHLEN];
+	struct sockaddr_storage *addrs;
 	char *iobuf[NBUFS];
 	struct iovec *iov[NBUFS];
 	struct mmsghdr *msgs[NBUFS];
+	cmsg_pktinfo_t *pktinfo;
 	unsigned rcvd;
-	knot_mm_t mm;
-	cmsg_pktinfo_t pktinfo[RECVMMSG_BATCHLEN];
+	unsigned depth;      /*!< Current batch depth. */
+	unsigned max_depth;  /*!< Configured maximum batch depth. */
+	size_t buf_size;     /*!< Size of each RX and TX buffer. */
+	size_t conf_size;    /*!< Buffer size required by the configuration. */
 };
 
-static void *udp_recvmmsg_init(void)
+/*!
+ * \brief Get the buffer size fitting the largest accepted UDP message.
+ *
+ * Neither queries nor answers over UDP may exceed the configured maximum
+ * UDP payload, so there is no need for 64 KiB buffers.
+ *
+ * \note Must be called within an RCU read-side critical section.
+ */
+static size_t udp_buf_size(void)
 {
-	knot_mm_t mm;
-	mm_ctx_mempool(&mm, sizeof(struct udp_recvmmsg));
+	size_t size = MAX(conf()->cache.srv_udp_max_payload_ipv4,
+	                  conf()->cache.srv_udp_max_payload_ipv6);
 
-	struct udp_recvmmsg *rq = mm_alloc(&mm, sizeof(struct udp_recvmmsg));
-	memset(rq, 0, sizeof(*rq));
-	memcpy(&rq->mm, &mm, sizeof(knot_mm_t));
+	return MAX(size, KNOT_WIRE_MIN_PKTSIZE);
+}
 
-	/* Initialize buffers. */
+/*! \brief Reallocate the RX and TX buffers to a new size. */
+static int udp_recvmmsg_resize(struct udp_recvmmsg *rq, size_t size)
+{
 	for (unsigned i = 0; i < NBUFS; ++i) {
-		rq->iobuf[i] = mm_alloc(&mm, KNOT_WIRE_MAX_PKTSIZE * RECVMMSG_BATCHLEN);
-		rq->iov[i] = mm_alloc(&mm, sizeof(struct iovec) * RECVMMSG_BATCHLEN);
-		rq->msgs[i] = mm_alloc(&mm, sizeof(struct mmsghdr) * RECVMMSG_BATCHLEN);
-		memset(rq->msgs[i], 0, sizeof(struct mmsghdr) * RECVMMSG_BATCHLEN);
-		for (unsigned k = 0; k < RECVMMSG_BATCHLEN; ++k) {
-			rq->iov[i][k].iov_base = rq->iobuf[i] + k * KNOT_WIRE_MAX_PKTSIZE;
-			rq->iov[i][k].iov_len = KNOT_WIRE_MAX_PKTSIZE;
+		char *iobuf = malloc(size * rq->max_depth);
+		if (iobuf == NULL) {
+			return KNOT_ENOMEM;
+		}
+		free(rq->iobuf[i]);
+		rq->iobuf[i] = iobuf;
+		for (unsigned k = 0; k < rq->max_depth; ++k) {
+			rq->iov[i][k].iov_base = iobuf + k * size;
+			rq->iov[i][k].iov_len = size;
+		}
+	}
+	rq->buf_size = size;
+
+	return KNOT_EOK;
+}
+
+static void udp_recvmmsg_deinit(void *d)
+{
+	struct udp_recvmmsg *rq = (struct udp_recvmmsg *)d;
+	if (rq == NULL) {
+		return;
+	}
+
+	for (unsigned i = 0; i < NBUFS; ++i) {
+		free(rq->iobuf[i]);
+		free(rq->iov[i]);
+		free(rq->msgs[i]);
+	}
+	free(rq->addrs);
+	free(rq->pktinfo);
+	free(rq);
+}
+
+static void *udp_recvmmsg_init(unsigned max_depth)
+{
+	struct udp_recvmmsg *rq = calloc(1, sizeof(struct udp_recvmmsg));
+	if (rq == NULL) {
+		return NULL;
+	}
+	rq->max_depth = MAX(max_depth, 1);
+	rq->depth = 1;
+
+	rq->addrs = calloc(rq->max_depth, sizeof(struct sockaddr_storage));
+	rq->pktinfo = calloc(rq->max_depth, sizeof(cmsg_pktinfo_t));
+	if (rq->addrs == NULL || rq->pktinfo == NULL) {
+		udp_recvmmsg_deinit(rq);
+		return NULL;
+	}
+
+	/* Initialize headers. */
+	for (unsigned i = 0; i < NBUFS; ++i) {
+		rq->iov[i] = calloc(rq->max_depth, sizeof(struct iovec));
+		rq->msgs[i] = calloc(rq->max_depth, sizeof(struct mmsghdr));
+		if (rq->iov[i] == NULL || rq->msgs[i] == NULL) {
+			udp_recvmmsg_deinit(rq);
+			return NULL;
+		}
+		for (unsigned k = 0; k < rq->max_depth; ++k) {
 			rq->msgs[i][k].msg_hdr.msg_iov = rq->iov[i] + k;
 			rq->msgs[i][k].msg_hdr.msg_iovlen = 1;
 			rq->msgs[i][k].msg_hdr.msg_name = rq->addrs + k;
@@ -271,14 +376,33 @@ static void *udp_recvmmsg_init(void)
 		}
 	}
 
+	/* Initialize buffers. */
+	rcu_read_lock();
+	rq->conf_size = udp_buf_size();
+	rcu_read_unlock();
+	if (udp_recvmmsg_resize(rq, rq->conf_size) != KNOT_EOK) {
+		udp_recvmmsg_deinit(rq);
+		return NULL;
+	}
+
 	return rq;
 }
 
-static void udp_recvmmsg_deinit(void *d)
+/*!
+ * \brief Adapt the batch depth to the socket queue occupancy.
+ *
+ * A full batch indicates more queued datagrams, so the depth is doubled.
+ * A mostly empty batch halves the depth, so that the answers aren't delayed
+ * by processing of long batches under light load.
+ */
+static unsigned udp_batch_adapt(unsigned depth, unsigned max_depth, unsigned rcvd)
 {
-	struct udp_recvmmsg *rq = (struct udp_recvmmsg *)d;
-	if (rq != NULL) {
-		mp_delete(rq->mm.ctx);
+	if (rcvd >= depth) {
+		return MIN(2 * depth, max_depth);
+	} else if (rcvd <= depth / 4) {
+		return MAX(depth / 2, 1);
+	} else {
+		return depth;
 	}
 }
 
@@ -286,27 +410,93 @@ static int udp_recvmmsg_recv(int fd, void *d)
 {
 	struct udp_recvmmsg *rq = (struct udp_recvmmsg *)d;
 
-	int n = recvmmsg(fd, rq->msgs[RX], RECVMMSG_BATCHLEN, MSG_DONTWAIT, NULL);
+	/* Grow the buffers if the maximum UDP payload was raised. */
+	if (rq->conf_size > rq->buf_size) {
+		(void)udp_recvmmsg_resize(rq, rq->conf_size);
+	}
+
+	int n = recvmmsg(fd, rq->msgs[RX], rq->depth, MSG_DONTWAIT, NULL);
 	if (n > 0) {
 		rq->fd = fd;
 		rq->rcvd = n;
+		rq->depth = udp_batch_adapt(rq->depth, rq->max_depth, n);
 	}
 	return n;
 }
 
+/*!
+ * \brief Answer a query not fitting the buffer with TC flag set.
+ *
+ * The client is expected to retry over TCP. The question is kept if it
+ * was received completely.
+ */
+static void udp_truncated_handle(udp_context_t *udp, struct iovec *rx, struct iovec *tx)
+{
+	const uint8_t *query = rx->iov_base;
+	uint8_t *answer = tx->iov_base;
+	size_t size = KNOT_WIRE_HEADER_SIZE;
+
+	tx->iov_len = 0;
+	if (rx->iov_len < KNOT_WIRE_HEADER_SIZE || knot_wire_get_qr(query)) {
+		return;
+	}
+
+	handler_thread_count(udp->stats);
+
+	uint16_t qdcount = 0;
+	if (knot_wire_get_qdcount(query) == 1) {
+		int qname = knot_dname_wire_check(query + size, query + rx->iov_len, NULL);
+		if (qname > 0 && size + qname + 2 * sizeof(uint16_t) <= rx->iov_len) {
+			size += qname + 2 * sizeof(uint16_t);
+			qdcount = 1;
+		}
+	}
+
+	memcpy(answer, query, size);
+	knot_wire_set_qr(answer);
+	knot_wire_set_tc(answer);
+	knot_wire_clear_aa(answer);
+	knot_wire_clear_ad(answer);
+	knot_wire_set_rcode(answer, KNOT_RCODE_NOERROR);
+	knot_wire_set_qdcount(answer, qdcount);
+	knot_wire_set_ancount(answer, 0);
+	knot_wire_set_nscount(answer, 0);
+	knot_wire_set_arcount(answer, 0);
+	tx->iov_len = size;
+}
+
 static int udp_recvmmsg_handle(udp_context_t *ctx, void *d)
 {
 	struct udp_recvmmsg *rq = (struct udp_recvmmsg *)d;
 
-	/* Handle each received msg. */
+	for (unsigned i = 0; i < rq->rcvd; ++i) {
+		rq->iov[RX][i].iov_len = rq->msgs[RX][i].msg_len; /* Received bytes. */
+	}
+
+	/* The lookups and the queued queries are valid until the batch end. */
+	rcu_read_lock();
+	query_batch_t *batch = (ctx->batch.max_count > 0) ? &ctx->batch : NULL;
+
+	/* Handle each received msg, look up the data in chunks first. */
+	query_prefetch_t prefetch[QUERY_PREFETCH_BATCH];
 	for (unsigned i = 0; i < rq->rcvd; ++i) {
 		struct iovec *rx = rq->msgs[RX][i].msg_hdr.msg_iov;
 		struct iovec *tx = rq->msgs[TX][i].msg_hdr.msg_iov;
-		rx->iov_len = rq->msgs[RX][i].msg_len; /* Received bytes. */
+
+		unsigned slot = i % QUERY_PREFETCH_BATCH;
+		if (slot == 0) {
+			query_prefetch(ctx->server->zone_db, rx,
+			               MIN(rq->rcvd - i, QUERY_PREFETCH_BATCH), prefetch);
+		}
 
 		udp_pktinfo_handle(&rq->msgs[RX][i].msg_hdr, &rq->msgs[TX][i].msg_hdr);
 
-		udp_handle(ctx, rq->fd, rq->addrs + i, rx, tx);
+		if (rq->msgs[RX][i].msg_hdr.msg_flags & MSG_TRUNC) {
+			udp_truncated_handle(ctx, rx, tx);
+		} else {
+			udp_handle(ctx, rq->fd, rq->addrs + i, rx, tx, &prefetch[slot],
+			           batch);
+		}
 		rq->msgs[TX][i].msg_len = tx->iov_len;
 		rq->msgs[TX][i].msg_hdr.msg_namelen = 0;
 		if (tx->iov_len > 0) {
@@ -315,6 +505,17 @@ static int udp_recvmmsg_handle(udp_context_t *ctx, void *d)
 		}
 	}
 
+	/* Pass the answered queries to the module batch hooks. */
+	if (batch != NULL && batch->count > 0) {
+		query_batch_flush(batch);
+		mp_flush(ctx->layer.mm->ctx);
+	}
+
+	/* Applied before the next receive, the configuration may be reloaded. */
+	rq->conf_size = udp_buf_size();
+
+	rcu_read_unlock();
+
 	return KNOT_EOK;
 }
 
@@ -326,8 +527,8 @@ static int udp_recvmmsg_send(void *d)
 		/* Reset buffer size and address len. */
 		struct iovec *rx = rq->msgs[RX][i].msg_hdr.msg_iov;
 		struct iovec *tx = rq->msgs[TX][i].msg_hdr.msg_iov;
-		rx->iov_len = KNOT_WIRE_MAX_PKTSIZE; /* Reset RX buflen */
-		tx->iov_len = KNOT_WIRE_MAX_PKTSIZE;
+		rx->iov_len = rq->buf_size; /* Reset RX buflen */
+		tx->iov_len = rq->buf_size;
 
 		memset(rq->addrs + i, 0, sizeof(struct sockaddr_storage));
 		rq->msgs[RX][i].msg_hdr.msg_namelen = sizeof(struct sockaddr_storage);
@@ -385,15 +586,23 @@ static unsigned udp_set_ifaces(const list_t *ifaces, struct pollfd **fds_ptr,
 		return 0;
 	}
 
-	unsigned nfds = list_size(ifaces);
-	struct pollfd *fds = calloc(nfds, sizeof(*fds));
+	/* TLS interfaces have no UDP sockets. */
+	unsigned nfds = 0;
+	iface_t *iface;
+	WALK_LIST(iface, *ifaces) {
+		nfds += (iface->fd_udp_count > 0) ? 1 : 0;
+	}
+
+	struct pollfd *fds = calloc(MAX(nfds, 1), sizeof(*fds));
 	if (fds == NULL) {
 		return 0;
 	}
 
-	iface_t *iface;
 	int i = 0;
 	WALK_LIST(iface, *ifaces) {
+		if (iface->fd_udp_count == 0) {
+			continue;
+		}
 		fds[i].fd = iface_udp_fd(iface, thread_id);
 		fds[i].events = POLLIN;
 		fds[i].revents = 0;
@@ -405,22 +614,56 @@ static unsigned udp_set_ifaces(const list_t *ifaces, struct pollfd **fds_ptr,
 	return nfds;
 }
 
+/*!
+ * \brief Wait for incoming datagrams.
+ *
+ * If busy polling is enabled, the sockets are polled without sleeping for
+ * the given time first, which saves the wakeup latency under steady load.
+ *
+ * \param busy_poll  Busy polling time in microseconds, 0 to disable.
+ */
+static int udp_poll(struct pollfd *fds, nfds_t nfds, unsigned busy_poll)
+{
+	if (busy_poll > 0) {
+		struct timespec begin = time_now();
+		struct timespec now;
+		do {
+			int events = poll(fds, nfds, 0);
+			if (events != 0) {
+				return events;
+			}
+			now = time_now();
+		} while (time_diff_ms(&begin, &now) * 1000 < busy_poll);
+	}
+
+	return poll(fds, nfds, -1);
+}
+
 int udp_master(dthread_t *thread)
 {
 	if (thread == NULL || thread->data == NULL) {
 		return KNOT_EINVAL;
 	}
 
-	unsigned cpu = dt_online_cpus();
-	if (cpu > 1) {
-		unsigned cpu_mask = (dt_get_id(thread) % cpu);
-		dt_setaffinity(thread, &cpu_mask, 1);
+	/* Bind to the planned CPU first, so that the buffers are node-local. */
+	unsigned thr_id = dt_get_id(thread);
+	iohandler_t *handler = (iohandler_t *)thread->data;
+	handler_thread_t *stats = &handler->threads[thr_id];
+	if (stats->cpu >= 0) {
+		unsigned cpu = stats->cpu;
+		dt_setaffinity(thread, &cpu, 1);
 	}
 
+	/* Load the batching configuration, changes require restart. */
+	rcu_read_lock();
+	conf_val_t val = conf_get(conf(), C_SRV, C_UDP_BATCH_SIZE);
+	unsigned batch_size = conf_int(&val);
+	val = conf_get(conf(), C_SRV, C_UDP_BUSY_POLL);
+	unsigned busy_poll = conf_int(&val);
+	rcu_read_unlock();
+
 	/* Prepare structures for bound sockets. */
-	unsigned thr_id = dt_get_id(thread);
-	iohandler_t *handler = (iohandler_t *)thread->data;
-	void *rq = _udp_init();
+	void *rq = _udp_init(batch_size);
 
 	/* Create big enough memory cushion. */
 	knot_mm_t mm;
@@ -429,10 +672,19 @@ int udp_master(dthread_t *thread)
 	/* Create UDP answering context. */
 	udp_context_t udp = {
 		.server = handler->server,
-		.thread_id = handler->thread_id[thr_id]
+		.thread_id = handler->thread_id[thr_id],
+		.stats = stats
 	};
 	knot_layer_init(&udp.layer, &mm, process_query_layer());
 
+	/* Reusable packets, bound to the received messages later. */
+	uint8_t empty[KNOT_WIRE_HEADER_SIZE] = { 0 };
+	udp.query = knot_pkt_new(empty, sizeof(empty), NULL);
+	udp.ans = knot_pkt_new(empty, sizeof(empty), NULL);
+
+	/* Queue for the module batch hooks, per-query calls if failed. */
+	(void)query_batch_init(&udp.batch, batch_size, &mm);
+
 	/* Event source. */
 	struct pollfd *fds = NULL;
 
@@ -450,7 +702,7 @@ int udp_master(dthread_t *thread)
 		}
 
 		/* Wait for events. */
-		int events = poll(fds, nfds, -1);
+		int events = udp_poll(fds, nfds, busy_poll);
 		if (events <= 0) {
 			if (errno == EINTR || errno == EAGAIN) {
 				continue;
@@ -474,6 +726,9 @@ int udp_master(dthread_t *thread)
 finish:
 	_udp_deinit(rq);
 	free(fds);
+	knot_pkt_free(udp.query);
+	knot_pkt_free(udp.ans);
+	query_batch_deinit(&udp.batch);
 	mp_delete(mm.ctx);
 
 	return KNOT_EOK;
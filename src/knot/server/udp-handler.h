@@ -26,8 +26,6 @@
 
 #include "knot/server/dthreads.h"
 
-#define RECVMMSG_BATCHLEN 10 /*!< Default recvmmsg() batch size. */
-
 /*!
  * \brief UDP handler thread runnable.
  *
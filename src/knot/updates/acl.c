@@ -14,21 +14,372 @@
     along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <pthread.h>
+#include <stdlib.h>
+
 #include "knot/updates/acl.h"
+#include "contrib/addr_trie.h"
+#include "contrib/mempattern.h"
+#include "contrib/qp-trie/trie.h"
+#include "contrib/ucw/mempool.h"
 #include "contrib/wire_ctx.h"
 
-static bool match_type(uint16_t type, conf_val_t *types)
+/*! \brief Compiled TSIG key of an ACL rule. */
+typedef struct {
+	knot_dname_t *name;
+	dnssec_tsig_algorithm_t algorithm;
+	dnssec_binary_t secret;
+} acl_key_t;
+
+/*! \brief Compiled update owner name (possibly relative to the zone). */
+typedef struct {
+	uint8_t *data;
+	size_t len;
+} acl_name_t;
+
+/*! \brief Compiled ACL rule. */
+typedef struct {
+	bool deny;
+	uint8_t actions;          /*!< Bitmap of allowed actions (1 << action). */
+	size_t keys_count;
+	acl_key_t *keys;
+	size_t types_count;
+	uint16_t *types;
+	acl_update_owner_t owner;
+	acl_update_owner_match_t match;
+	size_t names_count;
+	acl_name_t *names;
+} acl_rule_t;
+
+/*!
+ * \brief ACL list compiled into an address prefix trie.
+ *
+ * Rules are identified by their positions in the list. Rules with addresses
+ * are indexed in the trie, rules without addresses match any address.
+ */
+typedef struct {
+	knot_mm_t mm;
+	size_t count;
+	acl_rule_t *rules;
+	addr_trie_t *addrs;
+	size_t any_addr_count;
+	uint32_t *any_addr;
+} acl_compiled_t;
+
+struct acl_cache {
+	pthread_rwlock_t lock;
+	trie_t *lists; /*!< ACL lists (raw conf values) to compiled ACLs. */
+};
+
+/*! \brief Result of a single ACL rule evaluation. */
+typedef enum {
+	RULE_NEXT,
+	RULE_ALLOW,
+	RULE_DENY,
+} rule_result_t;
+
+static void *mm_memdup(knot_mm_t *mm, const void *data, size_t len)
+{
+	void *out = mm_alloc(mm, len);
+	if (out != NULL) {
+		memcpy(out, data, len);
+	}
+	return out;
+}
+
+static int compile_addrs(conf_t *conf, conf_val_t *id, acl_compiled_t *acl,
+                         uint32_t idx, bool *any)
+{
+	conf_val_t val = conf_id_get(conf, C_ACL, C_ADDR, id);
+	*any = (val.code == KNOT_ENOENT);
+
+	while (val.code == KNOT_EOK) {
+		struct sockaddr_storage min, max;
+		int mask, ret;
+
+		min = conf_addr_range(&val, &max, &mask);
+		if (max.ss_family == AF_UNSPEC) {
+			ret = addr_trie_add_net(acl->addrs, &min, mask, idx);
+		} else {
+			ret = addr_trie_add_range(acl->addrs, &min, &max, idx);
+		}
+		if (ret != KNOT_EOK) {
+			return ret;
+		}
+
+		conf_val_next(&val);
+	}
+
+	return KNOT_EOK;
+}
+
+static int compile_keys(conf_t *conf, conf_val_t *id, knot_mm_t *mm, acl_rule_t *rule)
+{
+	conf_val_t val = conf_id_get(conf, C_ACL, C_KEY, id);
+	rule->keys_count = conf_val_count(&val);
+	if (rule->keys_count == 0) {
+		return KNOT_EOK;
+	}
+
+	rule->keys = mm_alloc(mm, rule->keys_count * sizeof(*rule->keys));
+	if (rule->keys == NULL) {
+		return KNOT_ENOMEM;
+	}
+
+	for (acl_key_t *key = rule->keys; val.code == KNOT_EOK; key++) {
+		const knot_dname_t *name = conf_dname(&val);
+		key->name = mm_memdup(mm, name, knot_dname_size(name));
+
+		conf_val_t alg_val = conf_id_get(conf, C_KEY, C_ALG, &val);
+		key->algorithm = conf_opt(&alg_val);
+
+		size_t secret_len;
+		conf_val_t secret_val = conf_id_get(conf, C_KEY, C_SECRET, &val);
+		const uint8_t *secret = conf_bin(&secret_val, &secret_len);
+		key->secret.data = mm_memdup(mm, secret, secret_len);
+		key->secret.size = secret_len;
+
+		if (key->name == NULL || (secret_len > 0 && key->secret.data == NULL)) {
+			return KNOT_ENOMEM;
+		}
+
+		conf_val_next(&val);
+	}
+
+	return KNOT_EOK;
+}
+
+static int compile_update(conf_t *conf, conf_val_t *id, knot_mm_t *mm, acl_rule_t *rule)
 {
-	if (types == NULL) {
+	conf_val_t val = conf_id_get(conf, C_ACL, C_UPDATE_TYPE, id);
+	rule->types_count = conf_val_count(&val);
+	if (rule->types_count > 0) {
+		rule->types = mm_alloc(mm, rule->types_count * sizeof(*rule->types));
+		if (rule->types == NULL) {
+			return KNOT_ENOMEM;
+		}
+		for (size_t i = 0; val.code == KNOT_EOK; i++) {
+			rule->types[i] = knot_wire_read_u64(val.data);
+			conf_val_next(&val);
+		}
+	}
+
+	val = conf_id_get(conf, C_ACL, C_UPDATE_OWNER, id);
+	rule->owner = conf_opt(&val);
+
+	rule->match = ACL_UPDATE_MATCH_SUBEQ;
+	if (rule->owner != ACL_UPDATE_OWNER_NONE) {
+		val = conf_id_get(conf, C_ACL, C_UPDATE_OWNER_MATCH, id);
+		rule->match = conf_opt(&val);
+	}
+
+	if (rule->owner != ACL_UPDATE_OWNER_NAME) {
+		return KNOT_EOK;
+	}
+
+	val = conf_id_get(conf, C_ACL, C_UPDATE_OWNER_NAME, id);
+	rule->names_count = conf_val_count(&val);
+	if (rule->names_count > 0) {
+		rule->names = mm_alloc(mm, rule->names_count * sizeof(*rule->names));
+		if (rule->names == NULL) {
+			return KNOT_ENOMEM;
+		}
+		for (acl_name_t *name = rule->names; val.code == KNOT_EOK; name++) {
+			const uint8_t *data = conf_data(&val, &name->len);
+			name->data = mm_memdup(mm, data, name->len);
+			if (name->data == NULL) {
+				return KNOT_ENOMEM;
+			}
+			conf_val_next(&val);
+		}
+	}
+
+	return KNOT_EOK;
+}
+
+static int compile_rule(conf_t *conf, conf_val_t *id, acl_compiled_t *acl,
+                        uint32_t idx)
+{
+	acl_rule_t *rule = &acl->rules[idx];
+
+	bool any_addr;
+	int ret = compile_addrs(conf, id, acl, idx, &any_addr);
+	if (ret != KNOT_EOK) {
+		return ret;
+	}
+	if (any_addr) {
+		acl->any_addr[acl->any_addr_count++] = idx;
+	}
+
+	ret = compile_keys(conf, id, &acl->mm, rule);
+	if (ret != KNOT_EOK) {
+		return ret;
+	}
+
+	conf_val_t val = conf_id_get(conf, C_ACL, C_ACTION, id);
+	while (val.code == KNOT_EOK) {
+		rule->actions |= 1 << conf_opt(&val);
+		conf_val_next(&val);
+	}
+
+	val = conf_id_get(conf, C_ACL, C_DENY, id);
+	rule->deny = conf_bool(&val);
+
+	return compile_update(conf, id, &acl->mm, rule);
+}
+
+static void acl_compiled_free(acl_compiled_t *acl)
+{
+	if (acl == NULL) {
+		return;
+	}
+
+	addr_trie_free(acl->addrs);
+	mp_delete(acl->mm.ctx);
+}
+
+static acl_compiled_t *acl_compile(conf_t *conf, conf_val_t *acl_val)
+{
+	knot_mm_t mm;
+	mm_ctx_mempool(&mm, MM_DEFAULT_BLKSIZE);
+
+	acl_compiled_t *acl = mm_alloc(&mm, sizeof(*acl));
+	if (acl == NULL) {
+		mp_delete(mm.ctx);
+		return NULL;
+	}
+	memset(acl, 0, sizeof(*acl));
+	acl->mm = mm;
+
+	conf_val_t id = *acl_val;
+	conf_val_reset(&id);
+	acl->count = conf_val_count(&id);
+	acl->rules = mm_alloc(&mm, acl->count * sizeof(*acl->rules));
+	acl->any_addr = mm_alloc(&mm, acl->count * sizeof(*acl->any_addr));
+	acl->addrs = addr_trie_new();
+	if (acl->rules == NULL || acl->any_addr == NULL || acl->addrs == NULL) {
+		acl_compiled_free(acl);
+		return NULL;
+	}
+	memset(acl->rules, 0, acl->count * sizeof(*acl->rules));
+
+	for (uint32_t idx = 0; id.code == KNOT_EOK; idx++) {
+		if (compile_rule(conf, &id, acl, idx) != KNOT_EOK) {
+			acl_compiled_free(acl);
+			return NULL;
+		}
+		conf_val_next(&id);
+	}
+
+	return acl;
+}
+
+acl_cache_t *acl_cache_new(void)
+{
+	acl_cache_t *cache = calloc(1, sizeof(*cache));
+	if (cache == NULL) {
+		return NULL;
+	}
+
+	cache->lists = trie_create(NULL);
+	if (cache->lists == NULL) {
+		free(cache);
+		return NULL;
+	}
+	pthread_rwlock_init(&cache->lock, NULL);
+
+	return cache;
+}
+
+static int free_compiled(trie_val_t *val, void *ctx)
+{
+	acl_compiled_free(*val);
+	return KNOT_EOK;
+}
+
+void acl_cache_free(acl_cache_t *cache)
+{
+	if (cache == NULL) {
+		return;
+	}
+
+	trie_apply(cache->lists, free_compiled, NULL);
+	trie_free(cache->lists);
+	pthread_rwlock_destroy(&cache->lock);
+	free(cache);
+}
+
+/*!
+ * \brief Get the compiled form of the ACL list, compile it if not cached yet.
+ *
+ * Lists are keyed by their raw configuration values, so the zones sharing
+ * the same list (typically from a template) share one compiled ACL.
+ */
+static const acl_compiled_t *acl_cache_get(conf_t *conf, conf_val_t *acl_val)
+{
+	acl_cache_t *cache = conf->acl_cache;
+	if (cache == NULL) {
+		return NULL;
+	}
+
+	conf_val(acl_val);
+	const trie_key_t *key = (const trie_key_t *)acl_val->blob;
+	uint32_t key_len = acl_val->blob_len;
+
+	pthread_rwlock_rdlock(&cache->lock);
+	trie_val_t *val = trie_get_try(cache->lists, key, key_len);
+	acl_compiled_t *acl = (val != NULL) ? *val : NULL;
+	pthread_rwlock_unlock(&cache->lock);
+	if (acl != NULL) {
+		return acl;
+	}
+
+	acl_compiled_t *compiled = acl_compile(conf, acl_val);
+	if (compiled == NULL) {
+		return NULL;
+	}
+
+	pthread_rwlock_wrlock(&cache->lock);
+	val = trie_get_ins(cache->lists, key, key_len);
+	if (val == NULL) {
+		acl_compiled_free(compiled);
+	} else if (*val != NULL) {
+		// Compiled concurrently by another thread.
+		acl_compiled_free(compiled);
+		acl = *val;
+	} else {
+		*val = compiled;
+		acl = compiled;
+	}
+	pthread_rwlock_unlock(&cache->lock);
+
+	return acl;
+}
+
+int acl_cache_warm(conf_t *conf, const knot_dname_t *zone_name)
+{
+	if (conf == NULL || zone_name == NULL) {
+		return KNOT_EINVAL;
+	}
+
+	conf_val_t acl = conf_zone_get(conf, C_ACL, zone_name);
+	if (acl.code != KNOT_EOK) {
+		return KNOT_EOK;
+	}
+
+	return (acl_cache_get(conf, &acl) != NULL) ? KNOT_EOK : KNOT_ENOMEM;
+}
+
+static bool match_type(uint16_t type, const acl_rule_t *rule)
+{
+	if (rule->types_count == 0) {
 		return true;
 	}
 
-	conf_val_reset(types);
-	while (types->code == KNOT_EOK) {
-		if (type == knot_wire_read_u64(types->data)) {
+	for (size_t i = 0; i < rule->types_count; i++) {
+		if (type == rule->types[i]) {
 			return true;
 		}
-		conf_val_next(types);
 	}
 
 	return false;
@@ -55,17 +406,16 @@ static bool match_name(const knot_dname_t *rr_owner, const knot_dname_t *name,
 }
 
 static bool match_names(const knot_dname_t *rr_owner, const knot_dname_t *zone_name,
-                        conf_val_t *names, acl_update_owner_match_t match)
+                        const acl_rule_t *rule)
 {
-	if (names == NULL) {
+	if (rule->names_count == 0) {
 		return true;
 	}
 
-	conf_val_reset(names);
-	while (names->code == KNOT_EOK) {
+	for (size_t i = 0; i < rule->names_count; i++) {
 		knot_dname_storage_t full_name;
-		size_t len;
-		const uint8_t *name = conf_data(names, &len);
+		const uint8_t *name = rule->names[i].data;
+		size_t len = rule->names[i].len;
 		if (name[len - 1] != '\0') {
 			// Append zone name if non-FQDN.
 			wire_ctx_t ctx = wire_ctx_init(full_name, sizeof(full_name));
@@ -76,48 +426,26 @@ static bool match_names(const knot_dname_t *rr_owner, const knot_dname_t *zone_n
 			}
 			name = full_name;
 		}
-		if (match_name(rr_owner, name, match)) {
+		if (match_name(rr_owner, name, rule->match)) {
 			return true;
 		}
-		conf_val_next(names);
 	}
 
 	return false;
 }
 
-static bool update_match(conf_t *conf, conf_val_t *acl, knot_dname_t *key_name,
+static bool update_match(const acl_rule_t *rule, knot_dname_t *key_name,
                          const knot_dname_t *zone_name, knot_pkt_t *query)
 {
 	if (query == NULL) {
 		return true;
 	}
 
-	conf_val_t val_types = conf_id_get(conf, C_ACL, C_UPDATE_TYPE, acl);
-	conf_val_t *types = (conf_val_count(&val_types) > 0) ? &val_types : NULL;
-
-	conf_val_t val = conf_id_get(conf, C_ACL, C_UPDATE_OWNER, acl);
-	acl_update_owner_t owner = conf_opt(&val);
-
 	/* Return if no specific requirements configured. */
-	if (types == NULL && owner == ACL_UPDATE_OWNER_NONE) {
+	if (rule->types_count == 0 && rule->owner == ACL_UPDATE_OWNER_NONE) {
 		return true;
 	}
 
-	acl_update_owner_match_t match = ACL_UPDATE_MATCH_SUBEQ;
-	if (owner != ACL_UPDATE_OWNER_NONE) {
-		val = conf_id_get(conf, C_ACL, C_UPDATE_OWNER_MATCH, acl);
-		match = conf_opt(&val);
-	}
-
-	conf_val_t *names = NULL;
-	conf_val_t val_names;
-	if (owner == ACL_UPDATE_OWNER_NAME) {
-		val_names = conf_id_get(conf, C_ACL, C_UPDATE_OWNER_NAME, acl);
-		if (conf_val_count(&val_names) > 0) {
-			names = &val_names;
-		}
-	}
-
 	/* Updated RRs are contained in the Authority section of the query
 	 * (RFC 2136 Section 2.2)
 	 */
@@ -126,23 +454,23 @@ static bool update_match(conf_t *conf, conf_val_t *acl, knot_dname_t *key_name,
 
 	for (int i = pos; i < pos + count; i++) {
 		knot_rrset_t *rr = &query->rr[i];
-		if (!match_type(rr->type, types)) {
+		if (!match_type(rr->type, rule)) {
 			return false;
 		}
 
-		switch (owner) {
+		switch (rule->owner) {
 		case ACL_UPDATE_OWNER_NAME:
-			if (!match_names(rr->owner, zone_name, names, match)) {
+			if (!match_names(rr->owner, zone_name, rule)) {
 				return false;
 			}
 			break;
 		case ACL_UPDATE_OWNER_KEY:
-			if (!match_name(rr->owner, key_name, match)) {
+			if (!match_name(rr->owner, key_name, rule->match)) {
 				return false;
 			}
 			break;
 		case ACL_UPDATE_OWNER_ZONE:
-			if (!match_name(rr->owner, zone_name, match)) {
+			if (!match_name(rr->owner, zone_name, rule->match)) {
 				return false;
 			}
 			break;
@@ -154,96 +482,136 @@ static bool update_match(conf_t *conf, conf_val_t *acl, knot_dname_t *key_name,
 	return true;
 }
 
-bool acl_allowed(conf_t *conf, conf_val_t *acl, acl_action_t action,
-                 const struct sockaddr_storage *addr, knot_tsig_key_t *tsig,
-                 const knot_dname_t *zone_name, knot_pkt_t *query)
+static rule_result_t rule_eval(const acl_rule_t *rule, acl_action_t action,
+                               knot_tsig_key_t *tsig, const knot_dname_t *zone_name,
+                               knot_pkt_t *query)
 {
-	if (acl == NULL || addr == NULL || tsig == NULL) {
-		return false;
+	/* Check if the key matches the current rule key list. */
+	const acl_key_t *key = NULL;
+	if (tsig->name != NULL) {
+		for (size_t i = 0; i < rule->keys_count; i++) {
+			/* Compare key names (both in lower-case) and algorithms. */
+			if (knot_dname_is_equal(rule->keys[i].name, tsig->name) &&
+			    rule->keys[i].algorithm == tsig->algorithm) {
+				key = &rule->keys[i];
+				break;
+			}
+		}
+		if (key == NULL) {
+			return RULE_NEXT;
+		}
+	} else if (rule->keys_count > 0) {
+		/* No key provided, but required. */
+		return RULE_NEXT;
 	}
 
-	while (acl->code == KNOT_EOK) {
-		/* Check if the address matches the current acl address list. */
-		conf_val_t val = conf_id_get(conf, C_ACL, C_ADDR, acl);
-		if (val.code != KNOT_ENOENT && !conf_addr_range_match(&val, addr)) {
-			goto next_acl;
+	/* Check if the action is allowed. */
+	if (action != ACL_ACTION_NONE) {
+		if (rule->actions == 0) {
+			/* Empty action list allowed with deny only. */
+			return RULE_DENY;
 		}
+		if (!(rule->actions & (1 << action))) {
+			return RULE_NEXT;
+		}
+	}
 
-		/* Check if the key matches the current acl key list. */
-		conf_val_t key_val = conf_id_get(conf, C_ACL, C_KEY, acl);
-		while (key_val.code == KNOT_EOK) {
-			/* No key provided, but required. */
-			if (tsig->name == NULL) {
-				conf_val_next(&key_val);
-				continue;
-			}
+	/* If the action is update, check for update rule match. */
+	if (action == ACL_ACTION_UPDATE &&
+	    !update_match(rule, tsig->name, zone_name, query)) {
+		return RULE_NEXT;
+	}
 
-			/* Compare key names (both in lower-case). */
-			const knot_dname_t *key_name = conf_dname(&key_val);
-			if (!knot_dname_is_equal(key_name, tsig->name)) {
-				conf_val_next(&key_val);
-				continue;
-			}
+	/* Check if denied. */
+	if (rule->deny) {
+		return RULE_DENY;
+	}
 
-			/* Compare key algorithms. */
-			conf_val_t alg_val = conf_id_get(conf, C_KEY, C_ALG,
-			                                 &key_val);
-			if (conf_opt(&alg_val) != tsig->algorithm) {
-				conf_val_next(&key_val);
-				continue;
-			}
+	/* Fill the output with tsig secret if provided. */
+	if (key != NULL) {
+		tsig->secret = key->secret;
+	}
 
-			break;
+	return RULE_ALLOW;
+}
+
+/*! \brief Set of candidate rules, evaluated in the configuration order. */
+typedef struct {
+	uint32_t *ids;
+	size_t count;
+	size_t max;
+	uint32_t local[32];
+} candidates_t;
+
+static bool add_candidate(uint32_t id, void *ctx)
+{
+	candidates_t *cand = ctx;
+	if (cand->count == cand->max) {
+		size_t max = 2 * cand->max;
+		uint32_t *ids = malloc(max * sizeof(*ids));
+		if (ids == NULL) {
+			return true;
 		}
-		/* Check for key match or empty list without key provided. */
-		if (key_val.code != KNOT_EOK &&
-		    !(key_val.code == KNOT_ENOENT && tsig->name == NULL)) {
-			goto next_acl;
+		memcpy(ids, cand->ids, cand->count * sizeof(*ids));
+		if (cand->ids != cand->local) {
+			free(cand->ids);
 		}
+		cand->ids = ids;
+		cand->max = max;
+	}
 
-		/* Check if the action is allowed. */
-		if (action != ACL_ACTION_NONE) {
-			val = conf_id_get(conf, C_ACL, C_ACTION, acl);
-			while (val.code == KNOT_EOK) {
-				if (conf_opt(&val) != action) {
-					conf_val_next(&val);
-					continue;
-				}
+	cand->ids[cand->count++] = id;
+	return false;
+}
 
-				break;
-			}
-			switch (val.code) {
-			case KNOT_EOK: /* Check for action match. */
-				break;
-			case KNOT_ENOENT: /* Empty action list allowed with deny only. */
-				return false;
-			default: /* No match. */
-				goto next_acl;
-			}
-		}
+static int id_cmp(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+	return (x > y) - (x < y);
+}
 
-		/* If the action is update, check for update rule match. */
-		if (action == ACL_ACTION_UPDATE &&
-		    !update_match(conf, acl, tsig->name, zone_name, query)) {
-			goto next_acl;
-		}
+bool acl_allowed(conf_t *conf, conf_val_t *acl, acl_action_t action,
+                 const struct sockaddr_storage *addr, knot_tsig_key_t *tsig,
+                 const knot_dname_t *zone_name, knot_pkt_t *query)
+{
+	if (acl == NULL || addr == NULL || tsig == NULL || acl->code != KNOT_EOK) {
+		return false;
+	}
 
-		/* Check if denied. */
-		val = conf_id_get(conf, C_ACL, C_DENY, acl);
-		if (conf_bool(&val)) {
-			return false;
+	const acl_compiled_t *compiled = acl_cache_get(conf, acl);
+	if (compiled == NULL) {
+		return false;
+	}
+
+	/* Collect the rules matching the address. */
+	candidates_t cand = { .max = sizeof(cand.local) / sizeof(cand.local[0]) };
+	cand.ids = cand.local;
+	bool failed = addr_trie_match(compiled->addrs, addr, add_candidate, &cand);
+	for (size_t i = 0; !failed && i < compiled->any_addr_count; i++) {
+		failed = add_candidate(compiled->any_addr[i], &cand);
+	}
+	if (failed) {
+		if (cand.ids != cand.local) {
+			free(cand.ids);
 		}
+		return false;
+	}
+
+	qsort(cand.ids, cand.count, sizeof(*cand.ids), id_cmp);
 
-		/* Fill the output with tsig secret if provided. */
-		if (tsig->name != NULL) {
-			val = conf_id_get(conf, C_KEY, C_SECRET, &key_val);
-			tsig->secret.data = (uint8_t *)conf_bin(&val, &tsig->secret.size);
+	/* The first rule matching also the key and action decides. */
+	rule_result_t result = RULE_NEXT;
+	for (size_t i = 0; i < cand.count && result == RULE_NEXT; i++) {
+		if (i > 0 && cand.ids[i] == cand.ids[i - 1]) {
+			continue;
 		}
+		result = rule_eval(&compiled->rules[cand.ids[i]], action, tsig,
+		                   zone_name, query);
+	}
 
-		return true;
-next_acl:
-		conf_val_next(acl);
+	if (cand.ids != cand.local) {
+		free(cand.ids);
 	}
 
-	return false;
+	return (result == RULE_ALLOW);
 }
@@ -45,9 +45,41 @@ typedef enum {
 	ACL_UPDATE_MATCH_SUB   = 2,
 } acl_update_owner_match_t;
 
+/*!
+ * \brief Cache of compiled ACL lists, bound to a configuration instance.
+ */
+struct acl_cache;
+typedef struct acl_cache acl_cache_t;
+
+/*!
+ * \brief Creates an empty cache of compiled ACL lists.
+ *
+ * \return Cache or NULL if no memory.
+ */
+acl_cache_t *acl_cache_new(void);
+
+/*!
+ * \brief Frees the cache including all compiled ACL lists.
+ */
+void acl_cache_free(acl_cache_t *cache);
+
+/*!
+ * \brief Compiles the zone ACL list in advance if not already cached.
+ *
+ * \param conf       Configuration.
+ * \param zone_name  Zone name.
+ *
+ * \return KNOT_E*
+ */
+int acl_cache_warm(conf_t *conf, const knot_dname_t *zone_name);
+
 /*!
  * \brief Checks if the address and/or tsig key matches given ACL list.
  *
+ * The ACL list is compiled into an address prefix trie on the first use and
+ * cached in the configuration, so the check doesn't depend on the number of
+ * the rules with non-matching addresses.
+ *
  * If a proper ACL rule is found and tsig.name is not empty, tsig.secret is filled.
  *
  * \param conf       Configuration.
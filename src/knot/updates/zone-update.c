@@ -805,6 +805,14 @@ int zone_update_commit(conf_t *conf, zone_update_t *update)
 		}
 	}
 
+	/* Don't publish changes which aren't durable in the journal yet. */
+	if (update->zone->journaldb != NULL) {
+		ret = knot_lmdb_sync(update->zone->journaldb);
+		if (ret != KNOT_EOK) {
+			return ret;
+		}
+	}
+
 	/* Switch zone contents. */
 	zone_contents_t *old_contents;
 	old_contents = zone_switch_contents(update->zone, update->new_cont);
@@ -23,26 +23,179 @@
 #include "libknot/libknot.h"
 #include "knot/server/dthreads.h"
 #include "knot/worker/pool.h"
+#include "contrib/time.h"
+
+#ifdef HAVE_ATOMIC
+#define ATOMIC_LOAD(src)        __atomic_load_n(&(src), __ATOMIC_SEQ_CST)
+#define ATOMIC_STORE(dst, val)  __atomic_store_n(&(dst), (val), __ATOMIC_SEQ_CST)
+#define ATOMIC_ADD(dst, val)    __atomic_add_fetch(&(dst), (val), __ATOMIC_SEQ_CST)
+#else
+#define ATOMIC_LOAD(src)        __sync_fetch_and_add(&(src), 0)
+#define ATOMIC_STORE(dst, val)  do { (void)__sync_lock_test_and_set(&(dst), (val)); \
+                                     __sync_synchronize(); } while (0)
+#define ATOMIC_ADD(dst, val)    __sync_add_and_fetch(&(dst), (val))
+#endif
+
+/*!
+ * \brief Task queues of one worker, one per priority class.
+ *
+ * The lock protects the queues, the statistics, and the sleeping worker.
+ */
+typedef struct {
+	pthread_mutex_t lock;
+	pthread_cond_t wake;
+	int idle;		/*!< Is the worker waiting for a task? */
+	int count[TASK_PRIO_COUNT]; /*!< Queue lengths, readable unlocked. */
+	worker_queue_t tasks[TASK_PRIO_COUNT];
+	worker_prio_stats_t stats[TASK_PRIO_COUNT];
+} worker_slot_t;
 
 /*!
  * \brief Worker pool state.
+ *
+ * Each worker has its own set of task queues with its own lock. New tasks
+ * are distributed among the workers in a round-robin fashion and only
+ * the lock of the target queue is taken. A worker takes tasks from its
+ * own queues and steals from the others only if it has nothing of the
+ * same priority. If the target worker is busy, an idle worker is woken up
+ * to steal the task. Tasks of a higher priority class are always taken
+ * first, no matter which queue they are in.
+ *
+ * The counters and flags are accessed atomically. The pool lock is used
+ * only for waiting until all the tasks are finished.
  */
 struct worker_pool {
 	dt_unit_t *threads;
 
 	pthread_mutex_t lock;
-	pthread_cond_t wake;
+	pthread_cond_t done;
 
-	bool terminating;	/*!< Is the pool terminating? .*/
-	bool suspended;		/*!< Is execution temporarily suspended? .*/
+	int terminating;	/*!< Is the pool terminating? .*/
+	int suspended;		/*!< Is execution temporarily suspended? .*/
 	int running;		/*!< Number of running threads. */
-	worker_queue_t tasks;
+	int queued;		/*!< Number of tasks waiting for a worker. */
+	int pending[TASK_PRIO_COUNT]; /*!< Waiting tasks per priority class. */
+	unsigned next_slot;	/*!< Slot for the next assigned task. */
+
+	unsigned *cpus;		/*!< CPUs the workers are bound to. */
+	unsigned ncpus;		/*!< Number of CPUs, 0 if not bound. */
+
+	unsigned nslots;
+	worker_slot_t *slots;
 };
 
+/*! \brief Order in which the priority classes are served. */
+static const task_prio_t prio_order[] = {
+	TASK_PRIO_HIGH, TASK_PRIO_NORMAL, TASK_PRIO_LOW
+};
+
+static unsigned worker_slot_index(worker_pool_t *pool, dthread_t *thread)
+{
+	for (unsigned i = 0; i < pool->nslots; i++) {
+		if (pool->threads->threads[i] == thread) {
+			return i;
+		}
+	}
+
+	return 0;
+}
+
+static task_t *slot_dequeue(worker_pool_t *pool, worker_slot_t *slot, task_prio_t prio)
+{
+	pthread_mutex_lock(&slot->lock);
+	// Checked under the lock, see worker_pool_suspend().
+	task_t *task = NULL;
+	if (!ATOMIC_LOAD(pool->suspended)) {
+		task = worker_queue_dequeue(&slot->tasks[prio]);
+	}
+	if (task != NULL) {
+		ATOMIC_ADD(slot->count[prio], -1);
+		// Running before dequeued, so that worker_pool_wait() can't miss it.
+		ATOMIC_ADD(pool->running, 1);
+		ATOMIC_ADD(pool->queued, -1);
+		ATOMIC_ADD(pool->pending[prio], -1);
+	}
+	pthread_mutex_unlock(&slot->lock);
+
+	return task;
+}
+
+/*!
+ * \brief Take the most urgent pending task, preferring the own queues.
+ */
+static task_t *take_task(worker_pool_t *pool, unsigned own)
+{
+	for (int p = 0; p < TASK_PRIO_COUNT; p++) {
+		task_prio_t prio = prio_order[p];
+		if (ATOMIC_LOAD(pool->pending[prio]) <= 0) {
+			continue;
+		}
+
+		task_t *task = slot_dequeue(pool, &pool->slots[own], prio);
+		if (task != NULL) {
+			return task;
+		}
+
+		// Steal from the others.
+		for (unsigned i = 1; i < pool->nslots; i++) {
+			worker_slot_t *slot = &pool->slots[(own + i) % pool->nslots];
+			if (ATOMIC_LOAD(slot->count[prio]) <= 0) {
+				continue;
+			}
+			task = slot_dequeue(pool, slot, prio);
+			if (task != NULL) {
+				return task;
+			}
+		}
+	}
+
+	return NULL;
+}
+
+/*! \brief Wake up the worker if it's idle, the slot must be locked. */
+static bool slot_wake(worker_slot_t *slot)
+{
+	if (ATOMIC_LOAD(slot->idle)) {
+		pthread_cond_signal(&slot->wake);
+		return true;
+	}
+
+	return false;
+}
+
+/*! \brief Wake up all the workers. */
+static void wake_all(worker_pool_t *pool)
+{
+	for (unsigned i = 0; i < pool->nslots; i++) {
+		pthread_mutex_lock(&pool->slots[i].lock);
+		pthread_cond_signal(&pool->slots[i].wake);
+		pthread_mutex_unlock(&pool->slots[i].lock);
+	}
+}
+
+/*! \brief Notify worker_pool_wait() if there is nothing to do. */
+static void check_done(worker_pool_t *pool)
+{
+	if (ATOMIC_LOAD(pool->queued) == 0 && ATOMIC_LOAD(pool->running) == 0) {
+		pthread_mutex_lock(&pool->lock);
+		pthread_cond_broadcast(&pool->done);
+		pthread_mutex_unlock(&pool->lock);
+	}
+}
+
+static void update_stats(worker_prio_stats_t *stats, uint64_t wait)
+{
+	stats->started += 1;
+	stats->wait_sum += wait;
+	if (wait > stats->wait_max) {
+		stats->wait_max = wait;
+	}
+}
+
 /*!
  * \brief Worker thread.
  *
- * The thread takes a task from the tasks queue and runs it, while checking
+ * The thread takes a task from the task queues and runs it, while checking
  * if the dispatching of new tasks is allowed by the thread pool.
  *
  * An execution of a running thread cannot be enforced.
@@ -53,36 +206,47 @@ static int worker_main(dthread_t *thread)
 	assert(thread);
 
 	worker_pool_t *pool = thread->data;
+	unsigned own = worker_slot_index(pool, thread);
+	worker_slot_t *slot = &pool->slots[own];
 
-	pthread_mutex_lock(&pool->lock);
-
-	for (;;) {
-		if (pool->terminating) {
-			break;
-		}
+	if (pool->ncpus > 0) {
+		(void)dt_setaffinity(thread, pool->cpus, pool->ncpus);
+	}
 
+	while (!ATOMIC_LOAD(pool->terminating)) {
 		task_t *task = NULL;
-		if (!pool->suspended) {
-			task = worker_queue_dequeue(&pool->tasks);
+		if (!ATOMIC_LOAD(pool->suspended)) {
+			task = take_task(pool, own);
 		}
 
 		if (task == NULL) {
-			pthread_cond_wait(&pool->wake, &pool->lock);
+			// The idle flag is set before the recheck, an assignment
+			// either sees it and wakes us up, or is seen here.
+			pthread_mutex_lock(&slot->lock);
+			ATOMIC_STORE(slot->idle, 1);
+			if (!ATOMIC_LOAD(pool->terminating) &&
+			    (ATOMIC_LOAD(pool->suspended) || ATOMIC_LOAD(pool->queued) <= 0)) {
+				pthread_cond_wait(&slot->wake, &slot->lock);
+			}
+			ATOMIC_STORE(slot->idle, 0);
+			pthread_mutex_unlock(&slot->lock);
 			continue;
 		}
 
 		assert(task->run);
-		pool->running += 1;
-
-		pthread_mutex_unlock(&pool->lock);
+		assert(task->prio < TASK_PRIO_COUNT);
+		task_prio_t prio = task->prio;
+		struct timespec now = time_now();
+		uint64_t wait = time_diff_ms(&task->queued, &now);
 		task->run(task);
-		pthread_mutex_lock(&pool->lock);
 
-		pool->running -= 1;
-		pthread_cond_broadcast(&pool->wake);
-	}
+		pthread_mutex_lock(&slot->lock);
+		update_stats(&slot->stats[prio], wait);
+		pthread_mutex_unlock(&slot->lock);
 
-	pthread_mutex_unlock(&pool->lock);
+		ATOMIC_ADD(pool->running, -1);
+		check_done(pool);
+	}
 
 	return KNOT_EOK;
 }
@@ -102,20 +266,32 @@ worker_pool_t *worker_pool_create(unsigned threads)
 		goto fail;
 	}
 
-	if (pthread_mutex_init(&pool->lock, NULL) != 0) {
+	pool->nslots = threads;
+	pool->slots = calloc(threads, sizeof(*pool->slots));
+	if (pool->slots == NULL) {
 		goto fail;
 	}
+	for (unsigned i = 0; i < threads; i++) {
+		pthread_mutex_init(&pool->slots[i].lock, NULL);
+		pthread_cond_init(&pool->slots[i].wake, NULL);
+		for (int p = 0; p < TASK_PRIO_COUNT; p++) {
+			worker_queue_init(&pool->slots[i].tasks[p]);
+		}
+	}
 
-	if (pthread_cond_init(&pool->wake, NULL) != 0) {
+	if (pthread_mutex_init(&pool->lock, NULL) != 0) {
 		goto fail;
 	}
 
-	worker_queue_init(&pool->tasks);
+	if (pthread_cond_init(&pool->done, NULL) != 0) {
+		goto fail;
+	}
 
 	return pool;
 
 fail:
 	dt_delete(&pool->threads);
+	free(pool->slots);
 	free(pool);
 	return NULL;
 }
@@ -129,13 +305,43 @@ void worker_pool_destroy(worker_pool_t *pool)
 	dt_delete(&pool->threads);
 
 	pthread_mutex_destroy(&pool->lock);
-	pthread_cond_destroy(&pool->wake);
+	pthread_cond_destroy(&pool->done);
 
-	worker_queue_deinit(&pool->tasks);
+	for (unsigned i = 0; i < pool->nslots; i++) {
+		pthread_mutex_destroy(&pool->slots[i].lock);
+		pthread_cond_destroy(&pool->slots[i].wake);
+		for (int p = 0; p < TASK_PRIO_COUNT; p++) {
+			worker_queue_deinit(&pool->slots[i].tasks[p]);
+		}
+	}
+	free(pool->slots);
+	free(pool->cpus);
 
 	free(pool);
 }
 
+int worker_pool_set_affinity(worker_pool_t *pool, const unsigned *cpus, unsigned count)
+{
+	if (!pool || (count > 0 && !cpus)) {
+		return KNOT_EINVAL;
+	}
+
+	unsigned *copy = NULL;
+	if (count > 0) {
+		copy = malloc(count * sizeof(*copy));
+		if (copy == NULL) {
+			return KNOT_ENOMEM;
+		}
+		memcpy(copy, cpus, count * sizeof(*copy));
+	}
+
+	free(pool->cpus);
+	pool->cpus = copy;
+	pool->ncpus = count;
+
+	return KNOT_EOK;
+}
+
 void worker_pool_start(worker_pool_t *pool)
 {
 	if (!pool) {
@@ -151,10 +357,8 @@ void worker_pool_stop(worker_pool_t *pool)
 		return;
 	}
 
-	pthread_mutex_lock(&pool->lock);
-	pool->terminating = true;
-	pthread_cond_broadcast(&pool->wake);
-	pthread_mutex_unlock(&pool->lock);
+	ATOMIC_STORE(pool->terminating, 1);
+	wake_all(pool);
 
 	dt_stop(pool->threads);
 }
@@ -165,9 +369,13 @@ void worker_pool_suspend(worker_pool_t *pool)
 		return;
 	}
 
-	pthread_mutex_lock(&pool->lock);
-	pool->suspended = true;
-	pthread_mutex_unlock(&pool->lock);
+	ATOMIC_STORE(pool->suspended, 1);
+
+	// Wait for the dequeues which haven't seen the suspension.
+	for (unsigned i = 0; i < pool->nslots; i++) {
+		pthread_mutex_lock(&pool->slots[i].lock);
+		pthread_mutex_unlock(&pool->slots[i].lock);
+	}
 }
 
 void worker_pool_resume(worker_pool_t *pool)
@@ -176,10 +384,8 @@ void worker_pool_resume(worker_pool_t *pool)
 		return;
 	}
 
-	pthread_mutex_lock(&pool->lock);
-	pool->suspended = false;
-	pthread_cond_broadcast(&pool->wake);
-	pthread_mutex_unlock(&pool->lock);
+	ATOMIC_STORE(pool->suspended, 0);
+	wake_all(pool);
 }
 
 void worker_pool_join(worker_pool_t *pool)
@@ -198,22 +404,39 @@ void worker_pool_wait(worker_pool_t *pool)
 	}
 
 	pthread_mutex_lock(&pool->lock);
-	while (!EMPTY_LIST(pool->tasks.list) || pool->running > 0) {
-		pthread_cond_wait(&pool->wake, &pool->lock);
+	while (ATOMIC_LOAD(pool->queued) > 0 || ATOMIC_LOAD(pool->running) > 0) {
+		pthread_cond_wait(&pool->done, &pool->lock);
 	}
 	pthread_mutex_unlock(&pool->lock);
 }
 
 void worker_pool_assign(worker_pool_t *pool, struct task *task)
 {
-	if (!pool || !task) {
+	if (!pool || !task || task->prio >= TASK_PRIO_COUNT) {
 		return;
 	}
 
-	pthread_mutex_lock(&pool->lock);
-	worker_queue_enqueue(&pool->tasks, task);
-	pthread_cond_signal(&pool->wake);
-	pthread_mutex_unlock(&pool->lock);
+	task->queued = time_now();
+
+	unsigned target = ATOMIC_ADD(pool->next_slot, 1) % pool->nslots;
+	worker_slot_t *slot = &pool->slots[target];
+	pthread_mutex_lock(&slot->lock);
+	worker_queue_enqueue(&slot->tasks[task->prio], task);
+	ATOMIC_ADD(slot->count[task->prio], 1);
+	ATOMIC_ADD(pool->pending[task->prio], 1);
+	ATOMIC_ADD(pool->queued, 1);
+	bool woken = slot_wake(slot);
+	pthread_mutex_unlock(&slot->lock);
+
+	// The target worker is busy, let an idle one steal the task.
+	for (unsigned i = 1; !woken && i < pool->nslots; i++) {
+		worker_slot_t *other = &pool->slots[(target + i) % pool->nslots];
+		if (ATOMIC_LOAD(other->idle)) {
+			pthread_mutex_lock(&other->lock);
+			woken = slot_wake(other);
+			pthread_mutex_unlock(&other->lock);
+		}
+	}
 }
 
 void worker_pool_clear(worker_pool_t *pool)
@@ -222,21 +445,53 @@ void worker_pool_clear(worker_pool_t *pool)
 		return;
 	}
 
-	pthread_mutex_lock(&pool->lock);
-	worker_queue_deinit(&pool->tasks);
-	worker_queue_init(&pool->tasks);
-	pthread_mutex_unlock(&pool->lock);
+	for (unsigned i = 0; i < pool->nslots; i++) {
+		worker_slot_t *slot = &pool->slots[i];
+		pthread_mutex_lock(&slot->lock);
+		for (int p = 0; p < TASK_PRIO_COUNT; p++) {
+			int count = slot->count[p];
+			worker_queue_deinit(&slot->tasks[p]);
+			worker_queue_init(&slot->tasks[p]);
+			ATOMIC_STORE(slot->count[p], 0);
+			ATOMIC_ADD(pool->pending[p], -count);
+			ATOMIC_ADD(pool->queued, -count);
+		}
+		pthread_mutex_unlock(&slot->lock);
+	}
+
+	check_done(pool);
 }
 
-void worker_pool_status(worker_pool_t *pool, int *running, int *queued)
+void worker_pool_status(worker_pool_t *pool, int *running, int *queued,
+                        worker_prio_stats_t *stats)
 {
 	if (!pool) {
 		*running = *queued = 0;
+		if (stats != NULL) {
+			memset(stats, 0, TASK_PRIO_COUNT * sizeof(*stats));
+		}
 		return;
 	}
 
-	pthread_mutex_lock(&pool->lock);
-	*running = pool->running;
-	*queued = worker_queue_length(&pool->tasks);
-	pthread_mutex_unlock(&pool->lock);
+	*running = ATOMIC_LOAD(pool->running);
+	*queued = ATOMIC_LOAD(pool->queued);
+	if (stats != NULL) {
+		memset(stats, 0, TASK_PRIO_COUNT * sizeof(*stats));
+		for (unsigned i = 0; i < pool->nslots; i++) {
+			worker_slot_t *slot = &pool->slots[i];
+			pthread_mutex_lock(&slot->lock);
+			for (int p = 0; p < TASK_PRIO_COUNT; p++) {
+				const worker_prio_stats_t *s = &slot->stats[p];
+				stats[p].started += s->started;
+				stats[p].wait_sum += s->wait_sum;
+				if (s->wait_max > stats[p].wait_max) {
+					stats[p].wait_max = s->wait_max;
+				}
+			}
+			pthread_mutex_unlock(&slot->lock);
+		}
+		for (int p = 0; p < TASK_PRIO_COUNT; p++) {
+			stats[p].queued = ATOMIC_LOAD(pool->pending[p]);
+		}
+	}
 }
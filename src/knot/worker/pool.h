@@ -16,11 +16,24 @@
 
 #pragma once
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include "knot/worker/queue.h"
 
 struct worker_pool;
 typedef struct worker_pool worker_pool_t;
 
+/*!
+ * \brief Statistics of one task priority class.
+ */
+typedef struct {
+	size_t queued;      /*!< Number of pending tasks. */
+	uint64_t started;   /*!< Number of tasks started so far. */
+	uint64_t wait_sum;  /*!< Total time the started tasks waited (ms). */
+	uint64_t wait_max;  /*!< Longest time a started task waited (ms). */
+} worker_prio_stats_t;
+
 /*!
  * \brief Initialize worker pool.
  *
@@ -45,6 +58,19 @@ void worker_pool_start(worker_pool_t *pool);
  */
 void worker_pool_stop(worker_pool_t *pool);
 
+/*!
+ * \brief Restrict the workers to the given CPUs.
+ *
+ * Takes effect when the workers are started.
+ *
+ * \param pool   Worker pool.
+ * \param cpus   CPU numbers.
+ * \param count  Number of CPUs, 0 for no restriction.
+ *
+ * \return Error code, KNOT_EOK if successful.
+ */
+int worker_pool_set_affinity(worker_pool_t *pool, const unsigned *cpus, unsigned count);
+
 /*!
  * \brief Temporarily suspend the execution of worker pool.
  */
@@ -68,6 +94,9 @@ void worker_pool_wait(worker_pool_t *pool);
 
 /*!
  * \brief Assign a task to be performed by a worker in the pool.
+ *
+ * Tasks are distributed among per-worker queues, idle workers steal tasks
+ * from the others. The task priority class is taken from task->prio.
  */
 void worker_pool_assign(worker_pool_t *pool, struct task *task);
 
@@ -78,5 +107,12 @@ void worker_pool_clear(worker_pool_t *pool);
 
 /*!
  * \brief Obtain info regarding how the pool is busy.
+ *
+ * \param pool     Worker pool.
+ * \param running  Output: number of running tasks.
+ * \param queued   Output: number of pending tasks.
+ * \param stats    Optional output: statistics per task priority class
+ *                 (array of TASK_PRIO_COUNT items).
  */
-void worker_pool_status(worker_pool_t *pool, int *running, int *queued);
+void worker_pool_status(worker_pool_t *pool, int *running, int *queued,
+                        worker_prio_stats_t *stats);
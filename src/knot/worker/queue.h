@@ -16,17 +16,33 @@
 
 #pragma once
 
+#include <time.h>
+
 #include "contrib/ucw/lists.h"
 
 struct task;
 typedef void (*task_cb)(struct task *);
 
+/*!
+ * \brief Task priority classes.
+ *
+ * Pending tasks of higher priority are always started first.
+ */
+typedef enum {
+	TASK_PRIO_NORMAL = 0, /*!< Default priority. */
+	TASK_PRIO_HIGH,       /*!< Urgent tasks, e.g. DDNS processing. */
+	TASK_PRIO_LOW,        /*!< Bulk tasks, e.g. zone loading or signing. */
+	TASK_PRIO_COUNT
+} task_prio_t;
+
 /*!
  * \brief Task executable by a worker.
  */
 typedef struct task {
 	void *ctx;
 	task_cb run;
+	task_prio_t prio;       /*!< Priority class. */
+	struct timespec queued; /*!< Time of assignment, for statistics. */
 } task_t;
 
 /*!
@@ -54,7 +54,7 @@ int zone_node_additionals_foreach(const zone_node_t *node, const knot_dname_t *z
 	int ret = KNOT_EOK;
 	for (int i = 0; ret == KNOT_EOK && i < node->rrset_count; i++) {
 		struct rr_data *rr_data = &node->rrs[i];
-		if (!knot_rrtype_additional_needed(rr_data->type)) {
+		if (!additional_linked(rr_data->type)) {
 			continue;
 		}
 		knot_rdata_t *rdata = knot_rdataset_at(&rr_data->rrs, 0);
@@ -156,6 +156,20 @@ int adjust_cb_nsec3_pointer(zone_node_t *node, adjust_ctx_t *ctx)
 	return ret;
 }
 
+/*! \brief Find additional node, CNAME target must match exactly. */
+static const zone_node_t *additional_node(const zone_contents_t *zone,
+                                          const knot_dname_t *name, uint16_t type)
+{
+	const zone_node_t *node = NULL;
+	if (type == KNOT_RRTYPE_CNAME) {
+		node = zone_contents_find_node(zone, name);
+	} else {
+		(void)zone_contents_find_node_or_wildcard(zone, name, &node);
+	}
+
+	return node;
+}
+
 /*! \brief Link pointers to additional nodes for this RRSet. */
 static int discover_additionals(zone_node_t *adjn, uint16_t rr_at,
                                 adjust_ctx_t *ctx)
@@ -175,9 +189,8 @@ static int discover_additionals(zone_node_t *adjn, uint16_t rr_at,
 	/* Scan new additional nodes. */
 	for (uint16_t i = 0; i < rdcount; i++) {
 		const knot_dname_t *dname = knot_rdata_name(rdata, rr_data->type);
-		const zone_node_t *node = NULL;
-
-		if (!zone_contents_find_node_or_wildcard(ctx->zone, dname, &node)) {
+		const zone_node_t *node = additional_node(ctx->zone, dname, rr_data->type);
+		if (node == NULL) {
 			rdata = knot_rdataset_next(rdata);
 			continue;
 		}
@@ -250,7 +263,7 @@ int adjust_cb_additionals(zone_node_t *node, adjust_ctx_t *ctx)
 	/* Lookup additional records for specific nodes. */
 	for(uint16_t i = 0; i < node->rrset_count; ++i) {
 		struct rr_data *rr_data = &node->rrs[i];
-		if (knot_rrtype_additional_needed(rr_data->type)) {
+		if (additional_linked(rr_data->type)) {
 			int ret = discover_additionals(node, i, ctx);
 			if (ret != KNOT_EOK) {
 				return ret;
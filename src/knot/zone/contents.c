@@ -22,6 +22,7 @@
 #include "knot/zone/contents.h"
 #include "knot/common/log.h"
 #include "knot/dnssec/zone-nsec.h"
+#include "knot/nameserver/axfr.h"
 #include "libknot/libknot.h"
 #include "contrib/qp-trie/trie.h"
 #include "contrib/macros.h"
@@ -515,6 +516,7 @@ void zone_contents_free(zone_contents_t *contents)
 
 	dnssec_nsec3_params_free(&contents->nsec3_params);
 	additionals_tree_free(contents->adds_tree);
+	axfr_cache_free(contents->axfr_cache);
 
 	free(contents);
 }
@@ -34,6 +34,8 @@ typedef struct zone_contents {
 
 	trie_t *adds_tree; // "additionals tree" for reverse lookup of nodes affected by additionals
 
+	struct axfr_cache *axfr_cache; // pre-rendered AXFR messages of this version
+
 	dnssec_nsec3_params_t nsec3_params;
 	size_t size;
 	uint32_t max_ttl;
@@ -238,7 +238,7 @@ bool binode_additionals_unchanged(zone_node_t *node, zone_node_t *counterpart)
 	}
 	for (int i = 0; i < node->rrset_count; i++) {
 		struct rr_data *rr = &node->rrs[i];
-		if (knot_rrtype_additional_needed(rr->type)) {
+		if (additional_linked(rr->type)) {
 			knot_rdataset_t *counterr = node_rdataset(counterpart, rr->type);
 			if (counterr == NULL || counterr->rdata != rr->rrs.rdata) {
 				return false;
@@ -247,7 +247,7 @@ bool binode_additionals_unchanged(zone_node_t *node, zone_node_t *counterpart)
 	}
 	for (int i = 0; i < counterpart->rrset_count; i++) {
 		struct rr_data *rr = &counterpart->rrs[i];
-		if (knot_rrtype_additional_needed(rr->type)) {
+		if (additional_linked(rr->type)) {
 			knot_rdataset_t *counterr = node_rdataset(node, rr->type);
 			if (counterr == NULL || counterr->rdata != rr->rrs.rdata) {
 				return false;
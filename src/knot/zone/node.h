@@ -115,6 +115,17 @@ void additional_clear(additional_t *additional);
  */
 bool additional_equal(additional_t *a, additional_t *b);
 
+/*!
+ * \brief Checks whether RRs of given type link nodes in the additional structure.
+ *
+ * Besides the types needing additional records, CNAME links its in-zone
+ * target node so that the chain can be followed without lookups.
+ */
+inline static bool additional_linked(uint16_t type)
+{
+	return knot_rrtype_additional_needed(type) || type == KNOT_RRTYPE_CNAME;
+}
+
 /*!
  * \brief Creates and initializes new node structure.
  *
@@ -14,6 +14,8 @@
     along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <string.h>
+
 #include "knot/zone/timers.h"
 
 #include "contrib/wire_ctx.h"
@@ -139,9 +141,10 @@ void zone_timers_close(knot_db_t *db)
 	knot_db_lmdb_api()->deinit(db);
 }
 
-int zone_timers_read(knot_lmdb_db_t *db, const knot_dname_t *zone,
+int zone_timers_read(knot_lmdb_shards_t *dbs, const knot_dname_t *zone,
                      zone_timers_t *timers)
 {
+	knot_lmdb_db_t *db = knot_lmdb_shard(dbs, zone);
 	if (!knot_lmdb_exists(db)) {
 		return KNOT_ENOENT;
 	}
@@ -159,9 +162,14 @@ int zone_timers_read(knot_lmdb_db_t *db, const knot_dname_t *zone,
 	return txn.ret;
 }
 
-int zone_timers_write(knot_lmdb_db_t *db, const knot_dname_t *zone,
+int zone_timers_write(knot_lmdb_shards_t *dbs, const knot_dname_t *zone,
                       const zone_timers_t *timers)
 {
+	knot_lmdb_db_t *db = knot_lmdb_shard(dbs, zone);
+	int ret = knot_lmdb_open(db);
+	if (ret != KNOT_EOK) {
+		return ret;
+	}
 	knot_lmdb_txn_t txn = { 0 };
 	knot_lmdb_begin(db, &txn, true);
 	txn_write_timers(&txn, zone, timers);
@@ -169,25 +177,43 @@ int zone_timers_write(knot_lmdb_db_t *db, const knot_dname_t *zone,
 	return txn.ret;
 }
 
-static void txn_zone_write(zone_t *z, knot_lmdb_txn_t *txn)
+typedef struct {
+	knot_lmdb_shards_t *dbs;
+	knot_lmdb_txn_t *txns;
+} write_all_ctx_t;
+
+static void txn_zone_write(zone_t *z, write_all_ctx_t *ctx)
 {
+	knot_lmdb_txn_t *txn = &ctx->txns[knot_lmdb_shard_idx(ctx->dbs, z->name)];
 	txn_write_timers(txn, z->name, &z->timers);
 }
 
-int zone_timers_write_all(knot_lmdb_db_t *db, knot_zonedb_t *zonedb)
+int zone_timers_write_all(knot_lmdb_shards_t *dbs, knot_zonedb_t *zonedb)
 {
-	int ret = knot_lmdb_open(db);
-	if (ret != KNOT_EOK) {
-		return ret;
+	knot_lmdb_txn_t txns[dbs->count];
+	memset(txns, 0, sizeof(txns));
+
+	for (unsigned i = 0; i < dbs->count; i++) {
+		txns[i].ret = knot_lmdb_open(&dbs->shards[i]);
+		if (txns[i].ret == KNOT_EOK) {
+			knot_lmdb_begin(&dbs->shards[i], &txns[i], true);
+		}
 	}
-	knot_lmdb_txn_t txn = { 0 };
-	knot_lmdb_begin(db, &txn, true);
-	knot_zonedb_foreach(zonedb, txn_zone_write, &txn);
-	knot_lmdb_commit(&txn);
-	return txn.ret;
+
+	write_all_ctx_t ctx = { dbs, txns };
+	knot_zonedb_foreach(zonedb, txn_zone_write, &ctx);
+
+	int ret = KNOT_EOK;
+	for (unsigned i = 0; i < dbs->count; i++) {
+		knot_lmdb_commit(&txns[i]);
+		if (ret == KNOT_EOK) {
+			ret = txns[i].ret;
+		}
+	}
+	return ret;
 }
 
-int zone_timers_sweep(knot_lmdb_db_t *db, sweep_cb keep_zone, void *cb_data)
+static int timers_sweep(knot_lmdb_db_t *db, sweep_cb keep_zone, void *cb_data)
 {
 	if (!knot_lmdb_exists(db)) {
 		return KNOT_EOK;
@@ -208,3 +234,12 @@ int zone_timers_sweep(knot_lmdb_db_t *db, sweep_cb keep_zone, void *cb_data)
 	knot_lmdb_commit(&txn);
 	return txn.ret;
 }
+
+int zone_timers_sweep(knot_lmdb_shards_t *dbs, sweep_cb keep_zone, void *cb_data)
+{
+	int ret = KNOT_EOK;
+	for (unsigned i = 0; i < dbs->count && ret == KNOT_EOK; i++) {
+		ret = timers_sweep(&dbs->shards[i], keep_zone, cb_data);
+	}
+	return ret;
+}
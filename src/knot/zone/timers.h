@@ -45,45 +45,47 @@ typedef struct knot_zonedb knot_zonedb_t;
 /*!
  * \brief Load timers for one zone.
  *
- * \param[in]  db      Timer database.
+ * \param[in]  dbs     Timer database shards.
  * \param[in]  zone    Zone name.
  * \param[out] timers  Loaded timers
  *
  * \return KNOT_E*
  * \retval KNOT_ENOENT  Zone not found in the database.
  */
-int zone_timers_read(knot_lmdb_db_t *db, const knot_dname_t *zone,
+int zone_timers_read(knot_lmdb_shards_t *dbs, const knot_dname_t *zone,
                      zone_timers_t *timers);
 
 /*!
  * \brief Write timers for one zone.
  *
- * \param db      Timer database.
+ * \param dbs     Timer database shards.
  * \param zone    Zone name.
  * \param timers  Loaded timers
  *
  * \return KNOT_E*
  */
-int zone_timers_write(knot_lmdb_db_t *db, const knot_dname_t *zone,
+int zone_timers_write(knot_lmdb_shards_t *dbs, const knot_dname_t *zone,
                       const zone_timers_t *timers);
 
 /*!
  * \brief Write timers for all zones.
  *
- * \param db      Timer databse.
+ * \note Zones are written in one transaction per shard.
+ *
+ * \param dbs     Timer database shards.
  * \param zonedb  Zones database.
  *
  * \return KNOT_E*
  */
-int zone_timers_write_all(knot_lmdb_db_t *db, knot_zonedb_t *zonedb);
+int zone_timers_write_all(knot_lmdb_shards_t *dbs, knot_zonedb_t *zonedb);
 
 /*!
  * \brief Selectively delete zones from the database.
  *
- * \param db         Timer dababase.
+ * \param dbs        Timer database shards.
  * \param keep_zone  Filtering callback.
  * \param cb_data    Data passed to callback function.
  *
  * \return KNOT_E*
  */
-int zone_timers_sweep(knot_lmdb_db_t *db, sweep_cb keep_zone, void *cb_data);
+int zone_timers_sweep(knot_lmdb_shards_t *dbs, sweep_cb keep_zone, void *cb_data);
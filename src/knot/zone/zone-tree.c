@@ -124,6 +124,34 @@ zone_node_t *zone_tree_get(zone_tree_t *tree, const knot_dname_t *owner)
 	return zone_tree_fix_get(*val, tree);
 }
 
+void zone_tree_get_batch(zone_tree_t *tree, const knot_dname_t **owners,
+                         unsigned count, zone_node_t **nodes)
+{
+	assert(count <= ZONE_TREE_BATCH);
+
+	if (zone_tree_is_empty(tree)) {
+		memset(nodes, 0, count * sizeof(*nodes));
+		return;
+	}
+
+	knot_dname_storage_t lf_storage[ZONE_TREE_BATCH];
+	const trie_key_t *keys[ZONE_TREE_BATCH];
+	uint32_t lens[ZONE_TREE_BATCH];
+	for (unsigned i = 0; i < count; i++) {
+		uint8_t *lf = knot_dname_lf(owners[i], lf_storage[i]);
+		assert(lf);
+		keys[i] = lf + 1;
+		lens[i] = *lf;
+	}
+
+	trie_val_t *vals[ZONE_TREE_BATCH];
+	trie_get_try_batch(tree->trie, keys, lens, count, vals);
+
+	for (unsigned i = 0; i < count; i++) {
+		nodes[i] = (vals[i] != NULL) ? zone_tree_fix_get(*vals[i], tree) : NULL;
+	}
+}
+
 int zone_tree_get_less_or_equal(zone_tree_t *tree,
                                 const knot_dname_t *owner,
                                 zone_node_t **found,
@@ -141,6 +141,23 @@ int zone_tree_insert_with_parents(zone_tree_t *tree, zone_node_t *node, bool wit
  */
 zone_node_t *zone_tree_get(zone_tree_t *tree, const knot_dname_t *owner);
 
+/*! \brief Maximum number of nodes looked up by zone_tree_get_batch(). */
+#define ZONE_TREE_BATCH 16
+
+/*!
+ * \brief Finds nodes with the given owners in the zone tree.
+ *
+ * Equivalent to zone_tree_get() for each owner, but the lookups are
+ * interleaved to overlap their cache misses.
+ *
+ * \param tree    Zone tree to search in.
+ * \param owners  Owners of the nodes to find.
+ * \param count   Number of owners, at most ZONE_TREE_BATCH.
+ * \param nodes   Found nodes, NULL if not found.
+ */
+void zone_tree_get_batch(zone_tree_t *tree, const knot_dname_t **owners,
+                         unsigned count, zone_node_t **nodes);
+
 /*!
  * \brief Tries to find the given domain name in the zone tree and returns the
  *        associated node and previous node in canonical order.
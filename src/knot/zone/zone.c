@@ -423,7 +423,10 @@ int zone_master_try(conf_t *conf, zone_t *zone, zone_master_cb callback,
 			return ret;
 		}
 
-		log_try_addr_error(zone, NULL, &preferred.addr, err_str, ret);
+		// Busy remote isn't an error, the callback will retry later.
+		if (ret != KNOT_EBUSY) {
+			log_try_addr_error(zone, NULL, &preferred.addr, err_str, ret);
+		}
 	}
 
 	/* Try all the other servers. */
@@ -434,6 +437,7 @@ int zone_master_try(conf_t *conf, zone_t *zone, zone_master_cb callback,
 	while (masters.code == KNOT_EOK) {
 		conf_val_t addr = conf_id_get(conf, C_RMT, C_ADDR, &masters);
 		size_t addr_count = conf_val_count(&addr);
+		bool busy = false;
 
 		for (size_t i = 0; i < addr_count; i++) {
 			conf_remote_t master = conf_remote(conf, &masters, i);
@@ -447,13 +451,16 @@ int zone_master_try(conf_t *conf, zone_t *zone, zone_master_cb callback,
 			if (ret == KNOT_EOK) {
 				success = true;
 				break;
+			} else if (ret == KNOT_EBUSY) {
+				busy = true;
+				continue;
 			}
 
 			log_try_addr_error(zone, conf_str(&masters), &master.addr,
 			                   err_str, ret);
 		}
 
-		if (!success) {
+		if (!success && !busy) {
 			log_zone_warning(zone->name, "%s, remote %s not usable",
 			                 err_str, conf_str(&masters));
 		}
@@ -160,7 +160,8 @@ typedef int (*zone_master_cb)(conf_t *conf, zone_t *zone, const conf_remote_t *r
  *
  * The function iterates over available masters. For each master, the callback
  * function is called. If the callback function succeeds (\ref KNOT_EOK is
- * returned), the iteration is terminated.
+ * returned), the iteration is terminated. A master for which the callback
+ * returns \ref KNOT_EBUSY is skipped silently.
  *
  * \return Error code from the last callback.
  */
@@ -20,6 +20,7 @@
 #include "knot/common/log.h"
 #include "knot/conf/module.h"
 #include "knot/events/replan.h"
+#include "knot/updates/acl.h"
 #include "knot/zone/timers.h"
 #include "knot/zone/zone-load.h"
 #include "knot/zone/zone.h"
@@ -52,7 +53,7 @@ static zone_t *create_zone_from(const knot_dname_t *name, server_t *server)
 		return NULL;
 	}
 
-	zone->journaldb = &server->journaldb;
+	zone->journaldb = knot_lmdb_shard(&server->journaldb, zone->name);
 	zone->kaspdb = &server->kaspdb;
 
 	int result = zone_events_setup(zone, server->workers, &server->sched);
@@ -244,6 +245,9 @@ static knot_zonedb_t *create_zonedb(conf_t *conf, server_t *server)
 		conf_val_t id = conf_iter_id(conf, &iter);
 		const knot_dname_t *name = conf_dname(&id);
 
+		/* Compile the zone ACL before serving with the new configuration. */
+		(void)acl_cache_warm(conf, name);
+
 		zone_t *old_zone = knot_zonedb_find(db_old, name);
 		if (old_zone != NULL && !full) {
 			/* Reuse unchanged zone. */
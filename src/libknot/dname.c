@@ -25,9 +25,16 @@
 #include "libknot/errcode.h"
 #include "libknot/packet/wire.h"
 #include "contrib/ctype.h"
+#include "contrib/macros.h"
 #include "contrib/mempattern.h"
 #include "contrib/tolower.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 static int label_is_equal(const uint8_t *lb1, const uint8_t *lb2)
 {
 	return (*lb1 == *lb2) && memcmp(lb1 + 1, lb2 + 1, *lb1) == 0;
@@ -57,6 +64,83 @@ static int dname_align(const uint8_t **d1, uint8_t d1_labels,
 	return (d1_labels < d2_labels) ? d1_labels : d2_labels;
 }
 
+/*! \brief Size of an uncompressed name, scanning label lengths only. */
+static size_t dname_wire_size(const uint8_t *name)
+{
+	const uint8_t *it = name;
+	while (*it != '\0') {
+		it += *it + 1;
+	}
+
+	return it - name + 1;
+}
+
+/*!
+ * \brief Convert 8 bytes to lowercase at once.
+ *
+ * Label lengths are never uppercase letters, so the whole name wire can
+ * be converted regardless of the label boundaries.
+ */
+static uint64_t lower_word(uint64_t word)
+{
+	const uint64_t ones = 0x0101010101010101ULL;
+	const uint64_t low7 = word & (0x7F * ones);
+	const uint64_t ge_a = low7 + (0x80 - 'A') * ones;
+	const uint64_t gt_z = low7 + (0x7F - 'Z') * ones;
+	const uint64_t upper = ~word & (ge_a ^ gt_z) & (0x80 * ones);
+
+	return word | (upper >> 2);
+}
+
+/*!
+ * \brief Convert a block of bytes to lowercase.
+ *
+ * The vector and word steps never access outside the block, the remainder
+ * is handled by an overlapping step as the conversion is idempotent.
+ */
+static void lower_block(uint8_t *data, size_t len)
+{
+	size_t i = 0;
+#if defined(__SSE2__)
+	const __m128i shift = _mm_set1_epi8(0x80 - 'A');
+	const __m128i limit = _mm_set1_epi8(-0x80 + 26);
+	const __m128i bit = _mm_set1_epi8(0x20);
+	for (; len >= 16; i = MIN(i + 16, len - 16)) {
+		__m128i *ptr = (__m128i *)(data + i);
+		__m128i chars = _mm_loadu_si128(ptr);
+		__m128i upper = _mm_cmplt_epi8(_mm_add_epi8(chars, shift), limit);
+		_mm_storeu_si128(ptr, _mm_or_si128(chars, _mm_and_si128(upper, bit)));
+		if (i + 16 == len) {
+			return;
+		}
+	}
+#elif defined(__ARM_NEON)
+	const uint8x16_t first = vdupq_n_u8('A');
+	const uint8x16_t range = vdupq_n_u8(25);
+	const uint8x16_t bit = vdupq_n_u8(0x20);
+	for (; len >= 16; i = MIN(i + 16, len - 16)) {
+		uint8x16_t chars = vld1q_u8(data + i);
+		uint8x16_t upper = vcleq_u8(vsubq_u8(chars, first), range);
+		vst1q_u8(data + i, vorrq_u8(chars, vandq_u8(upper, bit)));
+		if (i + 16 == len) {
+			return;
+		}
+	}
+#endif
+	for (; len >= 8; i = MIN(i + 8, len - 8)) {
+		uint64_t word;
+		memcpy(&word, data + i, sizeof(word));
+		word = lower_word(word);
+		memcpy(data + i, &word, sizeof(word));
+		if (i + 8 == len) {
+			return;
+		}
+	}
+	for (; i < len; i++) {
+		data[i] = knot_tolower(data[i]);
+	}
+}
+
 _public_
 int knot_dname_wire_check(const uint8_t *name, const uint8_t *endp,
                           const uint8_t *pkt)
@@ -463,13 +547,7 @@ void knot_dname_to_lower(knot_dname_t *name)
 		return;
 	}
 
-	while (*name != '\0') {
-		uint8_t len = *name;
-		for (uint8_t i = 1; i <= len; ++i) {
-			name[i] = knot_tolower(name[i]);
-		}
-		name += 1 + len;
-	}
+	lower_block(name, dname_wire_size(name));
 }
 
 _public_
@@ -27,6 +27,7 @@
 
 #include <stdint.h>
 
+#include "libknot/mm_ctx.h"
 #include "libknot/packet/wire.h"
 
 /*! \brief Compression hint type. */
@@ -63,6 +64,29 @@ typedef struct {
 	uint16_t compress_ptr[KNOT_COMPR_HINT_COUNT]; /* Array of compr. ptr hints. */
 } knot_rrinfo_t;
 
+/*!
+ * \brief Packets larger than this use the suffix dictionary.
+ *
+ * Typical UDP answers are compressed well by the cheaper suffix heuristics.
+ */
+#define KNOT_COMPR_DICT_MINSIZE 4096
+
+/*!
+ * \brief Dictionary of name suffixes written to the packet.
+ *
+ * Open addressing hash table mapping hashes of lower-cased name suffixes
+ * to their positions in the wire. Each written name is then compressed
+ * to its longest previously written suffix, wherever it was written.
+ */
+typedef struct {
+	knot_mm_t *mm;       /* Memory context, NULL if the dictionary is disabled. */
+	uint32_t *hashes;    /* Suffix hashes, start of the allocated memory. */
+	uint16_t *positions; /* Suffix positions, 0 for an empty slot. */
+	uint16_t *log;       /* Occupied slots in the order of insertion. */
+	uint16_t count;      /* Number of stored suffixes. */
+	uint16_t size;       /* Number of slots (power of two). */
+} knot_compr_dict_t;
+
 /*!
  * \brief Name compression context.
  */
@@ -73,6 +97,7 @@ typedef struct knot_compr {
 		uint16_t pos;   /* Position of current suffix. */
 		uint8_t labels; /* Label count of the suffix. */
 	} suffix;
+	knot_compr_dict_t dict; /* Suffix dictionary, replaces the suffix heuristics. */
 } knot_compr_t;
 
 /*!
@@ -178,6 +178,27 @@ static void compr_clear(knot_compr_t *compr)
 	compr->suffix.labels = 0;
 }
 
+/*! \brief Remove suffixes stored after the dictionary had \a count of them. */
+static void compr_dict_rollback(knot_compr_dict_t *dict, uint16_t count)
+{
+	while (dict->count > count) {
+		dict->positions[dict->log[--dict->count]] = 0;
+	}
+}
+
+/*! \brief Empty and disable the dictionary, keep the memory for reuse. */
+static void compr_dict_clear(knot_compr_dict_t *dict)
+{
+	compr_dict_rollback(dict, 0);
+	dict->mm = NULL;
+}
+
+static void compr_dict_free(knot_compr_dict_t *dict, knot_mm_t *mm)
+{
+	mm_free(mm, dict->hashes);
+	memset(dict, 0, sizeof(*dict));
+}
+
 /*! \brief Clear the packet and switch wireformat pointers (possibly allocate new). */
 static int pkt_init(knot_pkt_t *pkt, void *wire, uint16_t len, knot_mm_t *mm)
 {
@@ -287,6 +308,7 @@ int knot_pkt_copy(knot_pkt_t *dst, const knot_pkt_t *src)
 	/* Invalidate arrays. */
 	dst->rr = NULL;
 	dst->rr_info = NULL;
+	compr_dict_clear(&dst->compr.dict);
 	dst->rrset_count = 0;
 	dst->rrset_allocd = 0;
 
@@ -308,6 +330,9 @@ static void payload_clear(knot_pkt_t *pkt)
 	/* Reset sections. */
 	sections_reset(pkt);
 
+	/* Written names are no longer valid. */
+	compr_dict_clear(&pkt->compr.dict);
+
 	/* Reset special types. */
 	pkt->opt_rr = NULL;
 	pkt->tsig_rr = NULL;
@@ -315,6 +340,9 @@ static void payload_clear(knot_pkt_t *pkt)
 	/* Reset TSIG wire reference. */
 	pkt->tsig_wire.pos = NULL;
 	pkt->tsig_wire.len = 0;
+
+	/* No sections left to parse. */
+	pkt->flags &= ~KNOT_PF_LAZY;
 }
 
 _public_
@@ -375,6 +403,34 @@ void knot_pkt_clear(knot_pkt_t *pkt)
 	compr_clear(&pkt->compr);
 }
 
+_public_
+int knot_pkt_reset(knot_pkt_t *pkt, void *wire, uint16_t len)
+{
+	if (pkt == NULL || wire == NULL || (pkt->flags & KNOT_PF_FREE)) {
+		return KNOT_EINVAL;
+	}
+
+	/* Free temporary data, keep the RR arrays. */
+	pkt_free_data(pkt);
+
+	/* Switch wire and reset the state. */
+	pkt_wire_set(pkt, wire, len);
+	pkt->reserved = 0;
+	pkt->qname_size = 0;
+	pkt->opt_rr = NULL;
+	pkt->tsig_rr = NULL;
+	pkt->tsig_wire.pos = NULL;
+	pkt->tsig_wire.len = 0;
+	pkt->flags &= ~KNOT_PF_LAZY;
+	sections_reset(pkt);
+
+	compr_clear(&pkt->compr);
+	compr_dict_clear(&pkt->compr.dict);
+	pkt->compr.wire = pkt->wire;
+
+	return KNOT_EOK;
+}
+
 _public_
 void knot_pkt_free(knot_pkt_t *pkt)
 {
@@ -389,6 +445,9 @@ void knot_pkt_free(knot_pkt_t *pkt)
 	mm_free(&pkt->mm, pkt->rr);
 	mm_free(&pkt->mm, pkt->rr_info);
 
+	/* Free compression dictionary. */
+	compr_dict_free(&pkt->compr.dict, &pkt->mm);
+
 	/* Free the space for wireformat. */
 	if (pkt->flags & KNOT_PF_FREE) {
 		mm_free(&pkt->mm, pkt->wire);
@@ -523,15 +582,26 @@ int knot_pkt_put_rotate(knot_pkt_t *pkt, uint16_t compr_hint, const knot_rrset_t
 				                  pkt->compr.wire);
 		}
 
+		/* Compress to any written name in larger packets. */
+		if (pkt->max_size > KNOT_COMPR_DICT_MINSIZE) {
+			pkt->compr.dict.mm = &pkt->mm;
+		}
+
 		compr = &pkt->compr;
 	}
 
+	/* Remember the dictionary state for rollback. */
+	uint16_t dict_count = pkt->compr.dict.count;
+
 	uint8_t *pos = pkt->wire + pkt->size;
 	size_t maxlen = pkt_remaining(pkt);
 
 	/* Write RRSet to wireformat. */
 	ret = knot_rrset_to_wire_extra(rr, pos, maxlen, rotate, compr, flags);
 	if (ret < 0) {
+		/* Forget names of the discarded RRs. */
+		compr_dict_rollback(&pkt->compr.dict, dict_count);
+
 		/* Truncate packet if required. */
 		if (ret == KNOT_ESPACE && !(flags & KNOT_PF_NOTRUNC)) {
 			knot_wire_set_tc(pkt->wire);
@@ -700,6 +770,60 @@ static int parse_section(knot_pkt_t *pkt, unsigned flags)
 	return KNOT_EOK;
 }
 
+/*! \brief Skip RR in the wire, checking only its boundaries and type. */
+static int skip_rr(knot_pkt_t *pkt)
+{
+	assert(pkt);
+
+	if (pkt->parsed >= pkt->size) {
+		return KNOT_EFEWDATA;
+	}
+
+	wire_ctx_t wire = wire_ctx_init_const(pkt->wire, pkt->size);
+	wire_ctx_set_offset(&wire, pkt->parsed);
+
+	int owner_size = knot_dname_wire_check(wire.position, wire.wire + wire.size,
+	                                       pkt->wire);
+	if (owner_size <= 0) {
+		return KNOT_EMALF;
+	}
+	wire_ctx_skip(&wire, owner_size);
+
+	uint16_t type = wire_ctx_read_u16(&wire);
+	wire_ctx_skip(&wire, sizeof(uint16_t) + sizeof(uint32_t)); /* CLASS + TTL */
+	uint16_t rdlength = wire_ctx_read_u16(&wire);
+	wire_ctx_skip(&wire, rdlength);
+	if (wire.error != KNOT_EOK) {
+		return KNOT_EMALF;
+	}
+
+	/* OPT and TSIG are allowed in the additional section only. */
+	if (type == KNOT_RRTYPE_OPT || type == KNOT_RRTYPE_TSIG) {
+		return KNOT_EMALF;
+	}
+
+	pkt->parsed = wire_ctx_offset(&wire);
+
+	return KNOT_EOK;
+}
+
+static int skip_section(knot_pkt_t *pkt)
+{
+	assert(pkt);
+
+	uint16_t rr_count = pkt_rr_wirecount(pkt, pkt->current);
+
+	/* Skip all RRs belonging to the section. */
+	for (uint16_t rr_skipped = 0; rr_skipped < rr_count; ++rr_skipped) {
+		int ret = skip_rr(pkt);
+		if (ret != KNOT_EOK) {
+			return ret;
+		}
+	}
+
+	return KNOT_EOK;
+}
+
 static int parse_payload(knot_pkt_t *pkt, unsigned flags)
 {
 	assert(pkt);
@@ -707,15 +831,16 @@ static int parse_payload(knot_pkt_t *pkt, unsigned flags)
 	assert(pkt->size > 0);
 
 	/* Reserve memory in advance to avoid resizing. */
-	size_t rr_count = knot_wire_get_ancount(pkt->wire) +
-	                  knot_wire_get_nscount(pkt->wire) +
-	                  knot_wire_get_arcount(pkt->wire);
+	size_t skipped = knot_wire_get_ancount(pkt->wire) +
+	                 knot_wire_get_nscount(pkt->wire);
+	size_t rr_count = skipped + knot_wire_get_arcount(pkt->wire);
 
 	if (rr_count > pkt->size / KNOT_WIRE_RR_MIN_SIZE) {
 		return KNOT_EMALF;
 	}
 
-	int ret = pkt_rr_array_alloc(pkt, rr_count);
+	bool lazy = (flags & KNOT_PF_LAZY) && skipped > 0;
+	int ret = pkt_rr_array_alloc(pkt, lazy ? rr_count - skipped : rr_count);
 	if (ret != KNOT_EOK) {
 		return ret;
 	}
@@ -725,12 +850,21 @@ static int parse_payload(knot_pkt_t *pkt, unsigned flags)
 		if (ret != KNOT_EOK) {
 			return ret;
 		}
-		ret = parse_section(pkt, flags);
+		if (lazy && i != KNOT_ADDITIONAL) {
+			ret = skip_section(pkt);
+		} else {
+			ret = parse_section(pkt, flags);
+		}
 		if (ret != KNOT_EOK) {
 			return ret;
 		}
 	}
 
+	/* Remember the skipped sections. */
+	if (lazy) {
+		pkt->flags |= KNOT_PF_LAZY;
+	}
+
 	/* TSIG must be last record of AR if present. */
 	const knot_pktsection_t *ar = knot_pkt_section(pkt, KNOT_ADDITIONAL);
 	if (pkt->tsig_rr != NULL) {
@@ -757,6 +891,7 @@ int knot_pkt_parse(knot_pkt_t *pkt, unsigned flags)
 
 	/* Reset parse state. */
 	sections_reset(pkt);
+	pkt->flags &= ~KNOT_PF_LAZY;
 
 	int ret = knot_pkt_parse_question(pkt);
 	if (ret == KNOT_EOK) {
@@ -766,6 +901,88 @@ int knot_pkt_parse(knot_pkt_t *pkt, unsigned flags)
 	return ret;
 }
 
+/*! \brief Move the additional section within the RR arrays. */
+static void additional_move(knot_pkt_t *pkt, uint16_t to)
+{
+	knot_pktsection_t *ar = &pkt->sections[KNOT_ADDITIONAL];
+	memmove(pkt->rr + to, pkt->rr + ar->pos, ar->count * sizeof(*pkt->rr));
+	memmove(pkt->rr_info + to, pkt->rr_info + ar->pos,
+	        ar->count * sizeof(*pkt->rr_info));
+
+	/* OPT and TSIG RRs are always in the additional section. */
+	if (pkt->opt_rr != NULL) {
+		pkt->opt_rr = pkt->rr + to + (pkt->opt_rr - (pkt->rr + ar->pos));
+	}
+	if (pkt->tsig_rr != NULL) {
+		pkt->tsig_rr = pkt->rr + to + (pkt->tsig_rr - (pkt->rr + ar->pos));
+	}
+
+	ar->pos = to;
+}
+
+_public_
+int knot_pkt_parse_sections(knot_pkt_t *pkt, unsigned flags)
+{
+	if (pkt == NULL) {
+		return KNOT_EINVAL;
+	}
+
+	if (!(pkt->flags & KNOT_PF_LAZY)) {
+		return KNOT_EOK;
+	}
+
+	/* Keep the parsed OPT and TSIG, they may be referenced already. */
+	uint16_t skipped = knot_wire_get_ancount(pkt->wire) +
+	                   knot_wire_get_nscount(pkt->wire);
+	knot_pktsection_t *ar = &pkt->sections[KNOT_ADDITIONAL];
+	assert(ar->pos == 0 && ar->count == pkt->rrset_count);
+
+	/* Make room for the skipped RRs in front of the additional section. */
+	size_t opt_idx = (pkt->opt_rr != NULL) ? pkt->opt_rr - pkt->rr : 0;
+	size_t tsig_idx = (pkt->tsig_rr != NULL) ? pkt->tsig_rr - pkt->rr : 0;
+	int ret = pkt_rr_array_alloc(pkt, skipped + ar->count);
+	if (ret != KNOT_EOK) {
+		return ret;
+	}
+	pkt->opt_rr = (pkt->opt_rr != NULL) ? pkt->rr + opt_idx : NULL;
+	pkt->tsig_rr = (pkt->tsig_rr != NULL) ? pkt->rr + tsig_idx : NULL;
+	additional_move(pkt, skipped);
+
+	/* Parse the skipped sections again, the wire is already checked. */
+	size_t parsed = pkt->parsed;
+	knot_section_t current = pkt->current;
+	pkt->parsed = KNOT_WIRE_HEADER_SIZE + knot_pkt_question_size(pkt);
+	pkt->rrset_count = 0;
+	for (knot_section_t i = KNOT_ANSWER; i < KNOT_ADDITIONAL; ++i) {
+		pkt->current = i;
+		pkt->sections[i].pos = pkt->rrset_count;
+		pkt->sections[i].count = 0;
+		ret = parse_section(pkt, flags);
+		if (ret != KNOT_EOK) {
+			break;
+		}
+	}
+
+	if (ret == KNOT_EOK) {
+		assert(pkt->rrset_count == skipped);
+		pkt->rrset_count += ar->count;
+	} else {
+		/* Drop the partially parsed sections. */
+		for (uint16_t i = 0; i < pkt->rrset_count; ++i) {
+			knot_rrset_clear(&pkt->rr[i], &pkt->mm);
+		}
+		memset(pkt->sections, 0, KNOT_ADDITIONAL * sizeof(*pkt->sections));
+		additional_move(pkt, 0);
+		pkt->rrset_count = ar->count;
+	}
+
+	pkt->parsed = parsed;
+	pkt->current = current;
+	pkt->flags &= ~KNOT_PF_LAZY;
+
+	return ret;
+}
+
 _public_
 uint16_t knot_pkt_ext_rcode(const knot_pkt_t *pkt)
 {
@@ -51,6 +51,7 @@ enum {
 	KNOT_PF_KEEPWIRE  = 1 << 4, /*!< Keep wireformat untouched when parsing. */
 	KNOT_PF_NOCANON   = 1 << 5, /*!< Don't canonicalize rrsets during parsing. */
 	KNOT_PF_ORIGTTL   = 1 << 6, /*!< Write RRSIGs with their original TTL. */
+	KNOT_PF_LAZY      = 1 << 7, /*!< Skip answer and authority when parsing. */
 };
 
 typedef struct knot_pkt knot_pkt_t;
@@ -144,6 +145,19 @@ int knot_pkt_init_response(knot_pkt_t *pkt, const knot_pkt_t *query);
 /*! \brief Reinitialize packet for another use. */
 void knot_pkt_clear(knot_pkt_t *pkt);
 
+/*!
+ * \brief Reinitialize packet over another existing memory.
+ *
+ * The memory context and the allocated RR arrays are kept, so the packet
+ * can be reused for many messages without allocations.
+ *
+ * \param pkt   Given packet (its wire must not be owned by the packet).
+ * \param wire  Wire format of the new message.
+ * \param len   Wire format length.
+ * \return KNOT_EOK, KNOT_EINVAL
+ */
+int knot_pkt_reset(knot_pkt_t *pkt, void *wire, uint16_t len);
+
 /*! \brief Begone you foul creature of the underworld. */
 void knot_pkt_free(knot_pkt_t *pkt);
 
@@ -297,8 +311,13 @@ static inline uint16_t knot_pkt_rr_offset(const knot_pktsection_t *section,
  * \note If KNOT_PF_KEEPWIRE is set, TSIG RR is not stripped from the wire
  *       and is processed as any other RR.
  *
+ * \note If KNOT_PF_LAZY is set, RRs in the ANSWER and AUTHORITY sections are
+ *       only checked for boundaries and these sections remain empty until
+ *       knot_pkt_parse_sections() is called.
+ *
  * \param  pkt Given packet.
- * \param  flags Parsing flags (allowed KNOT_PF_KEEPWIRE)
+ * \param  flags Parsing flags (allowed KNOT_PF_KEEPWIRE, KNOT_PF_NOCANON,
+ *               KNOT_PF_LAZY)
  *
  * \retval KNOT_EOK if success.
  * \retval KNOT_ETRAIL if success but with some trailing data.
@@ -306,6 +325,20 @@ static inline uint16_t knot_pkt_rr_offset(const knot_pktsection_t *section,
  */
 int knot_pkt_parse(knot_pkt_t *pkt, unsigned flags);
 
+/*!
+ * \brief Parse ANSWER and AUTHORITY sections skipped by lazy parsing.
+ *
+ * Does nothing if the packet wasn't parsed with KNOT_PF_LAZY or if there
+ * were no RRs to skip. Parsed OPT and TSIG RRs are kept.
+ *
+ * \param  pkt Given packet.
+ * \param  flags Parsing flags (allowed KNOT_PF_NOCANON)
+ *
+ * \retval KNOT_EOK if success.
+ * \retval KNOT_EMALF and other errors, the sections stay empty.
+ */
+int knot_pkt_parse_sections(knot_pkt_t *pkt, unsigned flags);
+
 /*!
  * \brief Parse packet header and a QUESTION section.
  */
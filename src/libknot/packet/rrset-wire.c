@@ -156,6 +156,262 @@ static int write_rdata_naptr_header(const uint8_t **src, size_t *src_avail,
 	return write_rdata_fixed(src, src_avail, dst, dst_avail, ret);
 }
 
+/*! \brief Initial number of slots of the suffix dictionary. */
+#define DICT_INIT_SIZE 128
+
+/*!
+ * \brief Hash of a name suffix, extended with a preceding label.
+ *
+ * Setting bit 0x20 maps upper-case letters to lower-case ones (and makes some
+ * other characters collide) without a table lookup.
+ */
+static uint32_t dict_hash(uint32_t hash, const uint8_t *label)
+{
+	// Length byte is hashed with the label, in 32-bit chunks.
+	unsigned len = *label + 1;
+	for (; len >= sizeof(uint32_t); len -= sizeof(uint32_t)) {
+		uint32_t chunk;
+		memcpy(&chunk, label, sizeof(chunk));
+		hash = (hash ^ (chunk | 0x20202020)) * 0x9E3779B1;
+		label += sizeof(uint32_t);
+	}
+	uint32_t tail = 0;
+	switch (len) {
+	case 3:
+		tail |= (uint32_t)label[2] << 16;
+		// FALLTHROUGH
+	case 2:
+		tail |= (uint32_t)label[1] << 8;
+		// FALLTHROUGH
+	case 1:
+		tail |= label[0];
+		hash = (hash ^ (tail | 0x20202020)) * 0x9E3779B1;
+	}
+
+	// Final mix (MurmurHash3), the slots are selected by the lowest bits.
+	hash ^= hash >> 16;
+	hash *= 0x85EBCA6B;
+	hash ^= hash >> 13;
+	hash *= 0xC2B2AE35;
+	return hash ^ (hash >> 16);
+}
+
+/*!
+ * \brief Get labels of an uncompressed name and hashes of all its suffixes.
+ *
+ * \return Number of labels.
+ */
+static unsigned dict_name_hashes(const knot_dname_t *dname, const uint8_t **labels,
+                                 uint32_t *hashes)
+{
+	unsigned count = 0;
+	while (*dname != '\0') {
+		labels[count++] = dname;
+		dname += *dname + 1;
+	}
+
+	uint32_t hash = 0;
+	for (unsigned i = count; i > 0; i--) {
+		hash = dict_hash(hash, labels[i - 1]);
+		hashes[i - 1] = hash;
+	}
+
+	return count;
+}
+
+/*!
+ * \brief Case insensitive comparison of an uncompressed name with a name
+ *        (possibly compressed) in the wire.
+ */
+static bool dict_name_equal(const knot_dname_t *dname, const uint8_t *pos,
+                            const uint8_t *wire)
+{
+	pos = knot_wire_seek_label(pos, wire);
+	while (*dname != '\0') {
+		if (*dname != *pos) {
+			return false;
+		}
+		for (uint8_t i = 1; i <= *dname; i++) {
+			if (dname[i] != pos[i] &&
+			    knot_tolower(dname[i]) != knot_tolower(pos[i])) {
+				return false;
+			}
+		}
+		dname = knot_wire_next_label(dname, NULL);
+		pos = knot_wire_next_label(pos, wire);
+	}
+
+	return *pos == '\0';
+}
+
+static void dict_slot_set(knot_compr_dict_t *dict, uint32_t hash, uint16_t pos)
+{
+	uint16_t mask = dict->size - 1;
+	uint16_t slot = hash & mask;
+	while (dict->positions[slot] != 0) {
+		slot = (slot + 1) & mask;
+	}
+
+	dict->hashes[slot] = hash;
+	dict->positions[slot] = pos;
+	dict->log[dict->count++] = slot;
+}
+
+static int dict_grow(knot_compr_dict_t *dict)
+{
+	// All arrays in one block, the log holds at most half of the slots.
+	uint16_t size = (dict->size == 0) ? DICT_INIT_SIZE : 2 * dict->size;
+	size_t mem_size = size * (sizeof(uint32_t) + sizeof(uint16_t) + sizeof(uint16_t) / 2);
+	uint8_t *mem = mm_alloc(dict->mm, mem_size);
+	if (mem == NULL) {
+		return KNOT_ENOMEM;
+	}
+
+	// Rehash in the order of insertion, which keeps the rollback possible.
+	knot_compr_dict_t old = *dict;
+	dict->hashes = (uint32_t *)mem;
+	dict->positions = (uint16_t *)(mem + size * sizeof(uint32_t));
+	dict->log = dict->positions + size;
+	dict->size = size;
+	dict->count = 0;
+	memset(dict->positions, 0, size * sizeof(uint16_t));
+	for (uint16_t i = 0; i < old.count; i++) {
+		dict_slot_set(dict, old.hashes[old.log[i]], old.positions[old.log[i]]);
+	}
+
+	mm_free(dict->mm, old.hashes);
+
+	return KNOT_EOK;
+}
+
+/*!
+ * \brief Store suffixes of an uncompressed name written at given position.
+ *
+ * \param compr   Compression context.
+ * \param labels  Labels of the name, only the first \a count are stored.
+ * \param hashes  Hashes of the suffixes.
+ * \param count   Number of suffixes to store.
+ * \param pos     Position of the name in the wire.
+ */
+static void dict_add(knot_compr_t *compr, const uint8_t **labels,
+                     const uint32_t *hashes, unsigned count, const uint8_t *pos)
+{
+	knot_compr_dict_t *dict = &compr->dict;
+	assert(pos >= compr->wire);
+
+	for (unsigned i = 0; i < count; i++) {
+		size_t offset = pos - compr->wire + (labels[i] - labels[0]);
+		if (offset >= KNOT_WIRE_PTR_MAX) {
+			break;
+		}
+		// Keep load factor at most 1/2, the dictionary is an optimization only.
+		if (2 * (dict->count + 1) > dict->size && dict_grow(dict) != KNOT_EOK) {
+			break;
+		}
+		dict_slot_set(dict, hashes[i], offset);
+	}
+}
+
+/*! \brief Find position of a previously written suffix, 0 if not found. */
+static uint16_t dict_find(const knot_compr_t *compr, const knot_dname_t *suffix,
+                          uint32_t hash)
+{
+	const knot_compr_dict_t *dict = &compr->dict;
+	if (dict->count == 0) {
+		return 0;
+	}
+
+	uint16_t mask = dict->size - 1;
+	for (uint16_t slot = hash & mask; dict->positions[slot] != 0;
+	     slot = (slot + 1) & mask) {
+		uint16_t pos = dict->positions[slot];
+		if (dict->hashes[slot] == hash &&
+		    dict_name_equal(suffix, compr->wire + pos, compr->wire)) {
+			return pos;
+		}
+	}
+
+	return 0;
+}
+
+/*!
+ * \brief Find the longest previously written suffix of a name.
+ *
+ * \param compr   Compression context.
+ * \param labels  Labels of the name.
+ * \param hashes  Hashes of the suffixes.
+ * \param count   Number of labels.
+ * \param ptr     Output position of the suffix, 0 if not found.
+ *
+ * \return Index of the first label of the suffix (\a count if not found).
+ */
+static unsigned dict_match(const knot_compr_t *compr, const uint8_t **labels,
+                           const uint32_t *hashes, unsigned count, uint16_t *ptr)
+{
+	*ptr = 0;
+	unsigned match = 0;
+	while (match < count &&
+	       (*ptr = dict_find(compr, labels[match], hashes[match])) == 0) {
+		match++;
+	}
+
+	return match;
+}
+
+/*! \brief Store new suffixes of an uncompressed name written to the wire. */
+static void dict_add_name(knot_compr_t *compr, const knot_dname_t *dname)
+{
+	const uint8_t *labels[KNOT_DNAME_MAXLABELS];
+	uint32_t hashes[KNOT_DNAME_MAXLABELS];
+	uint16_t ptr;
+	unsigned count = dict_name_hashes(dname, labels, hashes);
+	unsigned match = dict_match(compr, labels, hashes, count, &ptr);
+	dict_add(compr, labels, hashes, match, dname);
+}
+
+/*!
+ * \brief Write domain name compressed to its longest suffix in the dictionary.
+ *
+ * \param dname  Name to be written (not a zero label name).
+ * \param dst    Destination wire.
+ * \param max    Maximum number of bytes available.
+ * \param compr  Compression context with enabled dictionary.
+ * \return Number of written bytes or an error.
+ */
+static int dict_put_dname(const knot_dname_t *dname, uint8_t *dst, uint16_t max,
+                          knot_compr_t *compr)
+{
+	// The QNAME is the first name in the packet.
+	if (compr->dict.count == 0) {
+		dict_add_name(compr, compr->wire + KNOT_WIRE_HEADER_SIZE);
+	}
+
+	const uint8_t *labels[KNOT_DNAME_MAXLABELS + 1];
+	uint32_t hashes[KNOT_DNAME_MAXLABELS];
+	unsigned count = dict_name_hashes(dname, labels, hashes);
+	labels[count] = dname + knot_dname_size(dname) - 1;
+
+	uint16_t ptr;
+	unsigned match = dict_match(compr, labels, hashes, count, &ptr);
+
+	// Unmatched labels, followed by a pointer or the root label.
+	uint16_t written = labels[match] - dname;
+	uint16_t size = written + ((ptr != 0) ? sizeof(uint16_t) : 1);
+	if (size > max) {
+		return KNOT_ESPACE;
+	}
+	memcpy(dst, dname, written);
+	if (ptr != 0) {
+		knot_wire_put_pointer(dst + written, ptr);
+	} else {
+		dst[written] = '\0';
+	}
+
+	dict_add(compr, labels, hashes, match, dst);
+
+	return size;
+}
+
 /*! \brief Helper for \ref compr_put_dname, writes label(s) with size checks. */
 #define WRITE_LABEL(dst, written, label, max, len) \
 	if ((written) + (len) > (max)) { \
@@ -184,6 +440,10 @@ static int compr_put_dname(const knot_dname_t *dname, uint8_t *dst, uint16_t max
 		return knot_dname_to_wire(dst, dname, max);
 	}
 
+	if (compr->dict.mm != NULL) {
+		return dict_put_dname(dname, dst, max, compr);
+	}
+
 	// Get number of labels (should not be a zero label dname).
 	size_t name_labels = knot_dname_labels(dname, NULL);
 	assert(name_labels > 0);
@@ -282,7 +542,8 @@ static int write_owner(const knot_rrset_t *rrset, uint8_t **dst, size_t *dst_ava
 		knot_wire_put_pointer(*dst, owner_pointer);
 		WRITE_OWNER_INCR(dst, dst_avail, sizeof(uint16_t));
 	// Check for coincidence with previous RR set.
-	} else if (compr != NULL && compr->suffix.pos != 0 && *rrset->owner != '\0' &&
+	} else if (compr != NULL && compr->dict.mm == NULL &&
+	           compr->suffix.pos != 0 && *rrset->owner != '\0' &&
 	           dname_equal_wire(rrset->owner, compr->wire + compr->suffix.pos,
 	                            compr->wire)) {
 		WRITE_OWNER_CHECK(sizeof(uint16_t), dst_avail);
@@ -292,7 +553,7 @@ static int write_owner(const knot_rrset_t *rrset, uint8_t **dst, size_t *dst_ava
 		              knot_dname_size(rrset->owner));
 		WRITE_OWNER_INCR(dst, dst_avail, sizeof(uint16_t));
 	} else {
-		if (compr != NULL) {
+		if (compr != NULL && compr->dict.mm == NULL) {
 			compr->suffix.pos = KNOT_WIRE_HEADER_SIZE;
 			compr->suffix.labels =
 				knot_dname_labels(compr->wire + compr->suffix.pos,
@@ -365,6 +626,12 @@ static int compress_rdata_dname(const uint8_t **src, size_t *src_avail,
 		return written;
 	}
 
+	// Names which must not be compressed can still be pointed to.
+	if (put_compr == NULL && compr != NULL && compr->dict.mm != NULL &&
+	    *dname != '\0') {
+		dict_add_name(compr, *dst);
+	}
+
 	// Update compression hints.
 	if (compr_get_ptr(compr, hint) == 0) {
 		compr_set_ptr(compr, hint, *dst, written);
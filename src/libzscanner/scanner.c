@@ -0,0 +1,8950 @@
+
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <libgen.h>
+#include <math.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include "libzscanner/scanner.h"
+#include "libzscanner/functions.h"
+#include "libknot/descriptor.h"
+
+/*! \brief Maximal length of rdata item. */
+#define MAX_ITEM_LENGTH		255
+
+/*! \brief Latitude value for equator (2^31). */
+#define LOC_LAT_ZERO	(uint32_t)2147483648
+/*! \brief Longitude value for meridian (2^31). */
+#define LOC_LONG_ZERO	(uint32_t)2147483648
+/*! \brief Zero level altitude value. */
+#define LOC_ALT_ZERO	(uint32_t)10000000
+
+/*! \brief Shorthand for setting warning data. */
+#define WARN(err_code) { s->error.code = err_code; }
+/*! \brief Shorthand for setting error data. */
+#define ERR(err_code) { WARN(err_code); s->error.fatal = true; }
+/*! \brief Shorthand for error reset. */
+#define NOERR { WARN(ZS_OK); s->error.fatal = false; }
+
+/*!
+ * \brief Writes record type number to r_data.
+ *
+ * \param type		Type number.
+ * \param rdata_tail	Position where to write type number to.
+ */
+static inline void type_num(const uint16_t type, uint8_t **rdata_tail)
+{
+	*((uint16_t *)*rdata_tail) = htons(type);
+	*rdata_tail += 2;
+}
+
+/*!
+ * \brief Sets bit to bitmap window.
+ *
+ * \param type		Type number.
+ * \param s		Scanner context.
+ */
+static inline void window_add_bit(const uint16_t type, zs_scanner_t *s) {
+	uint8_t win      = type / 256;
+	uint8_t bit_pos  = type % 256;
+	uint8_t byte_pos = bit_pos / 8;
+
+	((s->windows[win]).bitmap)[byte_pos] |= 128 >> (bit_pos % 8);
+
+	if ((s->windows[win]).length < byte_pos + 1) {
+		(s->windows[win]).length = byte_pos + 1;
+	}
+
+	if (s->last_window < win) {
+		s->last_window = win;
+	}
+}
+
+// Include scanner file (in Ragel).
+
+static const short _zone_scanner_actions[] = {
+	0, 1, 0, 1, 1, 1, 2, 1,
+	3, 1, 4, 1, 5, 1, 7, 1,
+	8, 1, 10, 1, 12, 1, 13, 1,
+	14, 1, 16, 1, 17, 1, 22, 1,
+	23, 1, 25, 1, 26, 1, 28, 1,
+	30, 1, 32, 1, 33, 1, 42, 1,
+	43, 1, 44, 1, 46, 1, 48, 1,
+	49, 1, 50, 1, 51, 1, 55, 1,
+	56, 1, 58, 1, 60, 1, 62, 1,
+	63, 1, 65, 1, 69, 1, 70, 1,
+	73, 1, 74, 1, 77, 1, 80, 1,
+	82, 1, 83, 1, 84, 1, 85, 1,
+	86, 1, 87, 1, 88, 1, 89, 1,
+	91, 1, 93, 1, 95, 1, 99, 1,
+	100, 1, 104, 1, 105, 1, 109, 1,
+	110, 1, 111, 1, 112, 1, 113, 1,
+	114, 1, 115, 1, 116, 1, 117, 1,
+	118, 1, 119, 1, 120, 1, 121, 1,
+	122, 1, 124, 1, 125, 1, 126, 1,
+	127, 1, 154, 1, 155, 1, 156, 1,
+	157, 1, 158, 1, 159, 1, 160, 1,
+	161, 1, 162, 1, 163, 1, 164, 1,
+	165, 1, 166, 1, 167, 1, 168, 1,
+	169, 1, 170, 1, 171, 1, 172, 1,
+	173, 1, 174, 1, 175, 1, 176, 1,
+	177, 1, 178, 1, 179, 1, 180, 1,
+	181, 1, 182, 1, 183, 1, 184, 1,
+	185, 1, 186, 1, 187, 1, 188, 1,
+	189, 1, 190, 1, 191, 1, 192, 1,
+	193, 1, 194, 1, 195, 1, 196, 1,
+	197, 1, 198, 1, 199, 1, 200, 1,
+	201, 1, 202, 1, 203, 1, 204, 1,
+	205, 1, 206, 1, 207, 1, 208, 1,
+	209, 1, 210, 1, 211, 1, 212, 1,
+	213, 1, 214, 1, 215, 1, 216, 1,
+	217, 1, 218, 1, 219, 1, 220, 1,
+	221, 1, 222, 1, 223, 1, 224, 1,
+	225, 1, 226, 1, 227, 1, 228, 1,
+	229, 1, 230, 1, 231, 1, 232, 1,
+	233, 1, 234, 1, 235, 1, 236, 1,
+	237, 1, 238, 1, 239, 1, 240, 1,
+	241, 1, 242, 1, 243, 1, 244, 1,
+	245, 1, 246, 1, 247, 1, 249, 1,
+	251, 1, 252, 1, 253, 1, 254, 1,
+	261, 1, 262, 1, 267, 1, 269, 1,
+	274, 1, 277, 1, 278, 1, 279, 1,
+	280, 1, 282, 1, 283, 1, 284, 1,
+	285, 1, 287, 2, 0, 46, 2, 1,
+	0, 2, 1, 283, 2, 1, 334, 2,
+	2, 5, 2, 2, 7, 2, 3, 5,
+	2, 3, 7, 2, 4, 0, 2, 4,
+	5, 2, 4, 7, 2, 4, 283, 2,
+	5, 2, 2, 5, 3, 2, 5, 4,
+	2, 5, 7, 2, 6, 1, 2, 7,
+	1, 2, 7, 2, 2, 7, 3, 2,
+	7, 4, 2, 7, 5, 2, 7, 29,
+	2, 8, 69, 2, 8, 73, 2, 9,
+	10, 2, 11, 1, 2, 12, 13, 2,
+	15, 16, 2, 17, 13, 2, 17, 14,
+	2, 18, 23, 2, 18, 73, 2, 18,
+	80, 2, 19, 0, 2, 19, 7, 2,
+	21, 0, 2, 22, 12, 2, 25, 65,
+	2, 25, 104, 2, 25, 115, 2, 26,
+	0, 2, 26, 1, 2, 26, 2, 2,
+	26, 3, 2, 26, 4, 2, 26, 250,
+	2, 27, 24, 2, 28, 1, 2, 28,
+	2, 2, 28, 3, 2, 28, 4, 2,
+	28, 7, 2, 28, 89, 2, 29, 7,
+	2, 30, 8, 2, 30, 282, 2, 30,
+	287, 2, 31, 24, 2, 32, 0, 2,
+	32, 1, 2, 32, 2, 2, 32, 3,
+	2, 32, 4, 2, 32, 250, 2, 33,
+	38, 2, 34, 33, 2, 35, 69, 2,
+	35, 267, 2, 35, 282, 2, 35, 287,
+	2, 39, 255, 2, 39, 256, 2, 39,
+	257, 2, 39, 258, 2, 39, 259, 2,
+	39, 260, 2, 42, 0, 2, 42, 1,
+	2, 42, 2, 2, 42, 3, 2, 42,
+	4, 2, 43, 0, 2, 43, 1, 2,
+	43, 2, 2, 43, 3, 2, 43, 4,
+	2, 43, 250, 2, 44, 0, 2, 44,
+	1, 2, 44, 2, 2, 44, 3, 2,
+	44, 4, 2, 45, 281, 2, 46, 1,
+	2, 46, 2, 2, 46, 3, 2, 46,
+	4, 2, 53, 7, 2, 53, 44, 2,
+	53, 89, 2, 54, 55, 2, 56, 1,
+	2, 56, 2, 2, 56, 3, 2, 56,
+	4, 2, 57, 282, 2, 58, 0, 2,
+	59, 60, 2, 61, 62, 2, 63, 0,
+	2, 63, 58, 2, 67, 0, 2, 67,
+	282, 2, 71, 22, 2, 75, 65, 2,
+	76, 7, 2, 77, 8, 2, 78, 22,
+	2, 80, 8, 2, 86, 87, 2, 88,
+	1, 2, 88, 2, 2, 88, 3, 2,
+	88, 4, 2, 89, 1, 2, 89, 2,
+	2, 89, 3, 2, 89, 4, 2, 89,
+	7, 2, 90, 91, 2, 92, 282, 2,
+	93, 94, 2, 95, 96, 2, 97, 98,
+	2, 97, 99, 2, 97, 100, 2, 101,
+	102, 2, 103, 282, 2, 106, 282, 2,
+	107, 0, 2, 123, 282, 2, 125, 0,
+	2, 126, 0, 2, 127, 0, 2, 128,
+	0, 2, 129, 0, 2, 130, 0, 2,
+	131, 0, 2, 132, 0, 2, 133, 0,
+	2, 134, 0, 2, 135, 0, 2, 136,
+	0, 2, 137, 0, 2, 138, 0, 2,
+	139, 0, 2, 140, 0, 2, 141, 0,
+	2, 142, 0, 2, 143, 0, 2, 144,
+	0, 2, 145, 0, 2, 146, 0, 2,
+	147, 0, 2, 148, 0, 2, 149, 0,
+	2, 150, 0, 2, 151, 282, 2, 152,
+	282, 2, 153, 282, 2, 154, 1, 2,
+	154, 2, 2, 154, 3, 2, 154, 4,
+	2, 155, 1, 2, 155, 2, 2, 155,
+	3, 2, 155, 4, 2, 156, 1, 2,
+	156, 2, 2, 156, 3, 2, 156, 4,
+	2, 157, 1, 2, 157, 2, 2, 157,
+	3, 2, 157, 4, 2, 158, 1, 2,
+	158, 2, 2, 158, 3, 2, 158, 4,
+	2, 159, 1, 2, 159, 2, 2, 159,
+	3, 2, 159, 4, 2, 160, 1, 2,
+	160, 2, 2, 160, 3, 2, 160, 4,
+	2, 161, 1, 2, 161, 2, 2, 161,
+	3, 2, 161, 4, 2, 162, 1, 2,
+	162, 2, 2, 162, 3, 2, 162, 4,
+	2, 163, 1, 2, 163, 2, 2, 163,
+	3, 2, 163, 4, 2, 164, 1, 2,
+	164, 2, 2, 164, 3, 2, 164, 4,
+	2, 165, 1, 2, 165, 2, 2, 165,
+	3, 2, 165, 4, 2, 166, 1, 2,
+	166, 2, 2, 166, 3, 2, 166, 4,
+	2, 167, 1, 2, 167, 2, 2, 167,
+	3, 2, 167, 4, 2, 168, 1, 2,
+	168, 2, 2, 168, 3, 2, 168, 4,
+	2, 169, 1, 2, 169, 2, 2, 169,
+	3, 2, 169, 4, 2, 170, 1, 2,
+	170, 2, 2, 170, 3, 2, 170, 4,
+	2, 171, 1, 2, 171, 2, 2, 171,
+	3, 2, 171, 4, 2, 172, 1, 2,
+	172, 2, 2, 172, 3, 2, 172, 4,
+	2, 173, 1, 2, 173, 2, 2, 173,
+	3, 2, 173, 4, 2, 174, 1, 2,
+	174, 2, 2, 174, 3, 2, 174, 4,
+	2, 175, 1, 2, 175, 2, 2, 175,
+	3, 2, 175, 4, 2, 176, 1, 2,
+	176, 2, 2, 176, 3, 2, 176, 4,
+	2, 177, 1, 2, 177, 2, 2, 177,
+	3, 2, 177, 4, 2, 178, 1, 2,
+	178, 2, 2, 178, 3, 2, 178, 4,
+	2, 179, 1, 2, 179, 2, 2, 179,
+	3, 2, 179, 4, 2, 180, 1, 2,
+	180, 2, 2, 180, 3, 2, 180, 4,
+	2, 181, 1, 2, 181, 2, 2, 181,
+	3, 2, 181, 4, 2, 182, 1, 2,
+	182, 2, 2, 182, 3, 2, 182, 4,
+	2, 183, 1, 2, 183, 2, 2, 183,
+	3, 2, 183, 4, 2, 184, 1, 2,
+	184, 2, 2, 184, 3, 2, 184, 4,
+	2, 185, 1, 2, 185, 2, 2, 185,
+	3, 2, 185, 4, 2, 186, 1, 2,
+	186, 2, 2, 186, 3, 2, 186, 4,
+	2, 187, 1, 2, 187, 2, 2, 187,
+	3, 2, 187, 4, 2, 188, 1, 2,
+	188, 2, 2, 188, 3, 2, 188, 4,
+	2, 189, 1, 2, 189, 2, 2, 189,
+	3, 2, 189, 4, 2, 190, 1, 2,
+	190, 2, 2, 190, 3, 2, 190, 4,
+	2, 191, 1, 2, 191, 2, 2, 191,
+	3, 2, 191, 4, 2, 192, 1, 2,
+	192, 2, 2, 192, 3, 2, 192, 4,
+	2, 193, 1, 2, 193, 2, 2, 193,
+	3, 2, 193, 4, 2, 194, 1, 2,
+	194, 2, 2, 194, 3, 2, 194, 4,
+	2, 195, 1, 2, 195, 2, 2, 195,
+	3, 2, 195, 4, 2, 196, 1, 2,
+	196, 2, 2, 196, 3, 2, 196, 4,
+	2, 197, 1, 2, 197, 2, 2, 197,
+	3, 2, 197, 4, 2, 198, 1, 2,
+	198, 2, 2, 198, 3, 2, 198, 4,
+	2, 199, 1, 2, 199, 2, 2, 199,
+	3, 2, 199, 4, 2, 200, 1, 2,
+	200, 2, 2, 200, 3, 2, 200, 4,
+	2, 201, 1, 2, 201, 2, 2, 201,
+	3, 2, 201, 4, 2, 202, 1, 2,
+	202, 2, 2, 202, 3, 2, 202, 4,
+	2, 203, 1, 2, 203, 2, 2, 203,
+	3, 2, 203, 4, 2, 204, 1, 2,
+	204, 2, 2, 204, 3, 2, 204, 4,
+	2, 205, 1, 2, 205, 2, 2, 205,
+	3, 2, 205, 4, 2, 206, 1, 2,
+	206, 2, 2, 206, 3, 2, 206, 4,
+	2, 207, 1, 2, 207, 2, 2, 207,
+	3, 2, 207, 4, 2, 208, 1, 2,
+	208, 2, 2, 208, 3, 2, 208, 4,
+	2, 209, 1, 2, 209, 2, 2, 209,
+	3, 2, 209, 4, 2, 210, 1, 2,
+	210, 2, 2, 210, 3, 2, 210, 4,
+	2, 211, 1, 2, 211, 2, 2, 211,
+	3, 2, 211, 4, 2, 212, 1, 2,
+	212, 2, 2, 212, 3, 2, 212, 4,
+	2, 213, 1, 2, 213, 2, 2, 213,
+	3, 2, 213, 4, 2, 214, 1, 2,
+	214, 2, 2, 214, 3, 2, 214, 4,
+	2, 215, 1, 2, 215, 2, 2, 215,
+	3, 2, 215, 4, 2, 216, 1, 2,
+	216, 2, 2, 216, 3, 2, 216, 4,
+	2, 217, 1, 2, 217, 2, 2, 217,
+	3, 2, 217, 4, 2, 218, 1, 2,
+	218, 2, 2, 218, 3, 2, 218, 4,
+	2, 219, 1, 2, 219, 2, 2, 219,
+	3, 2, 219, 4, 2, 220, 1, 2,
+	220, 2, 2, 220, 3, 2, 220, 4,
+	2, 221, 1, 2, 221, 2, 2, 221,
+	3, 2, 221, 4, 2, 222, 1, 2,
+	222, 2, 2, 222, 3, 2, 222, 4,
+	2, 223, 1, 2, 223, 2, 2, 223,
+	3, 2, 223, 4, 2, 224, 1, 2,
+	224, 2, 2, 224, 3, 2, 224, 4,
+	2, 225, 1, 2, 225, 2, 2, 225,
+	3, 2, 225, 4, 2, 226, 1, 2,
+	226, 2, 2, 226, 3, 2, 226, 4,
+	2, 227, 1, 2, 227, 2, 2, 227,
+	3, 2, 227, 4, 2, 228, 1, 2,
+	228, 2, 2, 228, 3, 2, 228, 4,
+	2, 229, 1, 2, 229, 2, 2, 229,
+	3, 2, 229, 4, 2, 230, 1, 2,
+	230, 2, 2, 230, 3, 2, 230, 4,
+	2, 231, 1, 2, 231, 2, 2, 231,
+	3, 2, 231, 4, 2, 232, 1, 2,
+	232, 2, 2, 232, 3, 2, 232, 4,
+	2, 233, 1, 2, 233, 2, 2, 233,
+	3, 2, 233, 4, 2, 234, 1, 2,
+	234, 2, 2, 234, 3, 2, 234, 4,
+	2, 235, 1, 2, 235, 2, 2, 235,
+	3, 2, 235, 4, 2, 236, 1, 2,
+	236, 2, 2, 236, 3, 2, 236, 4,
+	2, 237, 1, 2, 237, 2, 2, 237,
+	3, 2, 237, 4, 2, 238, 1, 2,
+	238, 2, 2, 238, 3, 2, 238, 4,
+	2, 239, 1, 2, 239, 2, 2, 239,
+	3, 2, 239, 4, 2, 240, 1, 2,
+	240, 2, 2, 240, 3, 2, 240, 4,
+	2, 241, 1, 2, 241, 2, 2, 241,
+	3, 2, 241, 4, 2, 242, 1, 2,
+	242, 2, 2, 242, 3, 2, 242, 4,
+	2, 243, 1, 2, 243, 2, 2, 243,
+	3, 2, 243, 4, 2, 244, 1, 2,
+	244, 2, 2, 244, 3, 2, 244, 4,
+	2, 245, 1, 2, 245, 2, 2, 245,
+	3, 2, 245, 4, 2, 246, 1, 2,
+	246, 2, 2, 246, 3, 2, 246, 4,
+	2, 247, 1, 2, 247, 2, 2, 247,
+	3, 2, 247, 4, 2, 248, 0, 2,
+	251, 1, 2, 251, 2, 2, 251, 3,
+	2, 251, 4, 2, 252, 1, 2, 252,
+	2, 2, 252, 3, 2, 252, 4, 2,
+	253, 1, 2, 253, 2, 2, 253, 3,
+	2, 253, 4, 2, 254, 1, 2, 254,
+	2, 2, 254, 3, 2, 254, 4, 2,
+	261, 1, 2, 261, 2, 2, 261, 3,
+	2, 261, 4, 2, 262, 1, 2, 262,
+	2, 2, 262, 3, 2, 262, 4, 2,
+	265, 0, 2, 266, 282, 2, 268, 104,
+	2, 273, 104, 2, 282, 8, 2, 283,
+	1, 2, 283, 4, 2, 286, 283, 2,
+	287, 8, 2, 287, 282, 2, 288, 281,
+	2, 289, 281, 2, 290, 281, 2, 291,
+	281, 2, 292, 281, 2, 293, 281, 2,
+	294, 281, 2, 295, 281, 2, 296, 281,
+	2, 297, 281, 2, 298, 281, 2, 299,
+	281, 2, 300, 281, 2, 301, 281, 2,
+	302, 281, 2, 303, 281, 2, 304, 281,
+	2, 305, 281, 2, 306, 281, 2, 307,
+	281, 2, 308, 281, 2, 309, 281, 2,
+	310, 281, 2, 311, 281, 2, 312, 281,
+	2, 313, 281, 2, 314, 281, 2, 315,
+	281, 2, 316, 281, 2, 317, 281, 2,
+	318, 281, 2, 319, 281, 2, 320, 281,
+	2, 321, 281, 2, 322, 281, 2, 323,
+	281, 2, 324, 281, 2, 325, 281, 2,
+	326, 281, 2, 327, 281, 2, 328, 281,
+	2, 329, 281, 2, 330, 281, 2, 331,
+	281, 2, 332, 281, 2, 333, 281, 2,
+	334, 1, 3, 0, 46, 1, 3, 0,
+	46, 2, 3, 0, 46, 3, 3, 0,
+	46, 4, 3, 1, 7, 334, 3, 1,
+	29, 7, 3, 1, 67, 0, 3, 1,
+	107, 0, 3, 1, 248, 0, 3, 1,
+	265, 0, 3, 1, 283, 334, 3, 2,
+	7, 29, 3, 2, 29, 7, 3, 3,
+	7, 29, 3, 3, 29, 7, 3, 4,
+	7, 29, 3, 4, 29, 7, 3, 4,
+	67, 0, 3, 4, 107, 0, 3, 4,
+	248, 0, 3, 4, 265, 0, 3, 4,
+	283, 7, 3, 5, 7, 2, 3, 5,
+	7, 3, 3, 5, 7, 4, 3, 6,
+	1, 334, 3, 6, 334, 1, 3, 7,
+	2, 5, 3, 7, 2, 29, 3, 7,
+	3, 5, 3, 7, 3, 29, 3, 7,
+	4, 5, 3, 7, 4, 29, 3, 7,
+	334, 1, 3, 9, 11, 1, 3, 14,
+	20, 0, 3, 19, 7, 2, 3, 19,
+	7, 3, 3, 19, 7, 4, 3, 19,
+	79, 7, 3, 22, 12, 13, 3, 26,
+	67, 0, 3, 28, 1, 89, 3, 28,
+	2, 7, 3, 28, 2, 89, 3, 28,
+	3, 7, 3, 28, 3, 89, 3, 28,
+	4, 7, 3, 28, 4, 89, 3, 28,
+	89, 7, 3, 28, 286, 283, 3, 28,
+	288, 281, 3, 29, 1, 7, 3, 29,
+	2, 7, 3, 29, 3, 7, 3, 29,
+	4, 7, 3, 30, 85, 8, 3, 30,
+	282, 8, 3, 30, 287, 8, 3, 30,
+	287, 282, 3, 32, 1, 0, 3, 32,
+	4, 0, 3, 34, 33, 283, 3, 35,
+	151, 282, 3, 35, 153, 282, 3, 35,
+	287, 8, 3, 35, 287, 282, 3, 37,
+	39, 255, 3, 37, 39, 256, 3, 37,
+	39, 257, 3, 37, 39, 258, 3, 37,
+	39, 259, 3, 37, 39, 260, 3, 39,
+	255, 1, 3, 39, 255, 2, 3, 39,
+	255, 3, 3, 39, 255, 4, 3, 39,
+	256, 1, 3, 39, 256, 2, 3, 39,
+	256, 3, 3, 39, 256, 4, 3, 39,
+	257, 1, 3, 39, 257, 2, 3, 39,
+	257, 3, 3, 39, 257, 4, 3, 39,
+	258, 1, 3, 39, 258, 2, 3, 39,
+	258, 3, 3, 39, 258, 4, 3, 39,
+	259, 1, 3, 39, 259, 2, 3, 39,
+	259, 3, 3, 39, 259, 4, 3, 39,
+	260, 1, 3, 39, 260, 2, 3, 39,
+	260, 3, 3, 39, 260, 4, 3, 45,
+	281, 1, 3, 45, 281, 2, 3, 45,
+	281, 3, 3, 45, 281, 4, 3, 45,
+	281, 283, 3, 47, 35, 69, 3, 47,
+	35, 282, 3, 47, 35, 287, 3, 52,
+	34, 33, 3, 53, 7, 2, 3, 53,
+	7, 3, 3, 53, 7, 4, 3, 53,
+	44, 0, 3, 53, 44, 1, 3, 53,
+	44, 2, 3, 53, 44, 3, 3, 53,
+	44, 4, 3, 53, 89, 1, 3, 53,
+	89, 2, 3, 53, 89, 3, 3, 53,
+	89, 4, 3, 63, 58, 0, 3, 64,
+	59, 60, 3, 66, 25, 65, 3, 68,
+	0, 1, 3, 71, 22, 12, 3, 72,
+	0, 1, 3, 76, 2, 7, 3, 76,
+	3, 7, 3, 76, 4, 7, 3, 76,
+	7, 4, 3, 78, 22, 12, 3, 81,
+	0, 1, 3, 84, 7, 1, 3, 84,
+	7, 4, 3, 84, 27, 24, 3, 84,
+	29, 7, 3, 86, 27, 24, 3, 86,
+	87, 283, 3, 89, 2, 7, 3, 89,
+	3, 7, 3, 89, 4, 7, 3, 92,
+	103, 282, 3, 92, 151, 282, 3, 93,
+	94, 0, 3, 93, 94, 1, 3, 93,
+	94, 2, 3, 93, 94, 3, 3, 93,
+	94, 4, 3, 95, 96, 0, 3, 95,
+	96, 1, 3, 95, 96, 2, 3, 95,
+	96, 3, 3, 95, 96, 4, 3, 101,
+	102, 0, 3, 101, 102, 1, 3, 101,
+	102, 2, 3, 101, 102, 3, 3, 101,
+	102, 4, 3, 106, 108, 267, 3, 106,
+	276, 282, 3, 151, 152, 282, 3, 200,
+	248, 0, 3, 201, 248, 0, 3, 202,
+	248, 0, 3, 203, 248, 0, 3, 204,
+	248, 0, 3, 205, 248, 0, 3, 206,
+	248, 0, 3, 207, 248, 0, 3, 208,
+	248, 0, 3, 209, 248, 0, 3, 210,
+	248, 0, 3, 211, 248, 0, 3, 212,
+	248, 0, 3, 213, 248, 0, 3, 214,
+	248, 0, 3, 215, 248, 0, 3, 216,
+	248, 0, 3, 217, 248, 0, 3, 218,
+	248, 0, 3, 219, 248, 0, 3, 220,
+	248, 0, 3, 221, 248, 0, 3, 222,
+	248, 0, 3, 223, 248, 0, 3, 224,
+	248, 0, 3, 225, 248, 0, 3, 226,
+	248, 0, 3, 227, 248, 0, 3, 228,
+	248, 0, 3, 229, 248, 0, 3, 230,
+	248, 0, 3, 231, 248, 0, 3, 232,
+	248, 0, 3, 233, 248, 0, 3, 234,
+	248, 0, 3, 235, 248, 0, 3, 236,
+	248, 0, 3, 237, 248, 0, 3, 238,
+	248, 0, 3, 239, 248, 0, 3, 240,
+	248, 0, 3, 241, 248, 0, 3, 242,
+	248, 0, 3, 243, 248, 0, 3, 244,
+	248, 0, 3, 245, 248, 0, 3, 246,
+	248, 0, 3, 247, 248, 0, 3, 264,
+	34, 33, 3, 269, 270, 0, 3, 269,
+	271, 0, 3, 272, 106, 282, 3, 274,
+	275, 0, 3, 276, 106, 282, 3, 282,
+	8, 85, 3, 283, 7, 1, 3, 283,
+	7, 4, 3, 283, 27, 24, 3, 283,
+	334, 1, 3, 285, 27, 24, 3, 287,
+	282, 8, 3, 288, 281, 1, 3, 288,
+	281, 2, 3, 288, 281, 3, 3, 288,
+	281, 4, 3, 288, 281, 7, 3, 288,
+	281, 283, 3, 289, 281, 1, 3, 289,
+	281, 2, 3, 289, 281, 3, 3, 289,
+	281, 4, 3, 289, 281, 283, 3, 290,
+	281, 1, 3, 290, 281, 2, 3, 290,
+	281, 3, 3, 290, 281, 4, 3, 290,
+	281, 283, 3, 291, 281, 1, 3, 291,
+	281, 2, 3, 291, 281, 3, 3, 291,
+	281, 4, 3, 291, 281, 283, 3, 292,
+	281, 1, 3, 292, 281, 2, 3, 292,
+	281, 3, 3, 292, 281, 4, 3, 292,
+	281, 283, 3, 293, 281, 1, 3, 293,
+	281, 2, 3, 293, 281, 3, 3, 293,
+	281, 4, 3, 293, 281, 283, 3, 294,
+	281, 1, 3, 294, 281, 2, 3, 294,
+	281, 3, 3, 294, 281, 4, 3, 294,
+	281, 283, 3, 295, 281, 1, 3, 295,
+	281, 2, 3, 295, 281, 3, 3, 295,
+	281, 4, 3, 295, 281, 283, 3, 296,
+	281, 1, 3, 296, 281, 2, 3, 296,
+	281, 3, 3, 296, 281, 4, 3, 296,
+	281, 283, 3, 297, 281, 1, 3, 297,
+	281, 2, 3, 297, 281, 3, 3, 297,
+	281, 4, 3, 297, 281, 283, 3, 298,
+	281, 1, 3, 298, 281, 2, 3, 298,
+	281, 3, 3, 298, 281, 4, 3, 298,
+	281, 283, 3, 299, 281, 1, 3, 299,
+	281, 2, 3, 299, 281, 3, 3, 299,
+	281, 4, 3, 299, 281, 283, 3, 300,
+	281, 1, 3, 300, 281, 2, 3, 300,
+	281, 3, 3, 300, 281, 4, 3, 300,
+	281, 283, 3, 301, 281, 1, 3, 301,
+	281, 2, 3, 301, 281, 3, 3, 301,
+	281, 4, 3, 301, 281, 283, 3, 302,
+	281, 1, 3, 302, 281, 2, 3, 302,
+	281, 3, 3, 302, 281, 4, 3, 302,
+	281, 283, 3, 303, 281, 1, 3, 303,
+	281, 2, 3, 303, 281, 3, 3, 303,
+	281, 4, 3, 303, 281, 283, 3, 304,
+	281, 1, 3, 304, 281, 2, 3, 304,
+	281, 3, 3, 304, 281, 4, 3, 304,
+	281, 283, 3, 305, 281, 1, 3, 305,
+	281, 2, 3, 305, 281, 3, 3, 305,
+	281, 4, 3, 305, 281, 283, 3, 306,
+	281, 1, 3, 306, 281, 2, 3, 306,
+	281, 3, 3, 306, 281, 4, 3, 306,
+	281, 283, 3, 307, 281, 1, 3, 307,
+	281, 2, 3, 307, 281, 3, 3, 307,
+	281, 4, 3, 307, 281, 283, 3, 308,
+	281, 1, 3, 308, 281, 2, 3, 308,
+	281, 3, 3, 308, 281, 4, 3, 308,
+	281, 283, 3, 309, 281, 1, 3, 309,
+	281, 2, 3, 309, 281, 3, 3, 309,
+	281, 4, 3, 309, 281, 283, 3, 310,
+	281, 1, 3, 310, 281, 2, 3, 310,
+	281, 3, 3, 310, 281, 4, 3, 310,
+	281, 283, 3, 311, 281, 1, 3, 311,
+	281, 2, 3, 311, 281, 3, 3, 311,
+	281, 4, 3, 311, 281, 283, 3, 312,
+	281, 1, 3, 312, 281, 2, 3, 312,
+	281, 3, 3, 312, 281, 4, 3, 312,
+	281, 283, 3, 313, 281, 1, 3, 313,
+	281, 2, 3, 313, 281, 3, 3, 313,
+	281, 4, 3, 313, 281, 283, 3, 314,
+	281, 1, 3, 314, 281, 2, 3, 314,
+	281, 3, 3, 314, 281, 4, 3, 314,
+	281, 283, 3, 315, 281, 1, 3, 315,
+	281, 2, 3, 315, 281, 3, 3, 315,
+	281, 4, 3, 315, 281, 283, 3, 316,
+	281, 1, 3, 316, 281, 2, 3, 316,
+	281, 3, 3, 316, 281, 4, 3, 316,
+	281, 283, 3, 317, 281, 1, 3, 317,
+	281, 2, 3, 317, 281, 3, 3, 317,
+	281, 4, 3, 317, 281, 283, 3, 318,
+	281, 1, 3, 318, 281, 2, 3, 318,
+	281, 3, 3, 318, 281, 4, 3, 318,
+	281, 283, 3, 319, 281, 1, 3, 319,
+	281, 2, 3, 319, 281, 3, 3, 319,
+	281, 4, 3, 319, 281, 283, 3, 320,
+	281, 1, 3, 320, 281, 2, 3, 320,
+	281, 3, 3, 320, 281, 4, 3, 320,
+	281, 283, 3, 321, 281, 1, 3, 321,
+	281, 2, 3, 321, 281, 3, 3, 321,
+	281, 4, 3, 321, 281, 283, 3, 322,
+	281, 1, 3, 322, 281, 2, 3, 322,
+	281, 3, 3, 322, 281, 4, 3, 322,
+	281, 283, 3, 323, 281, 1, 3, 323,
+	281, 2, 3, 323, 281, 3, 3, 323,
+	281, 4, 3, 323, 281, 283, 3, 324,
+	281, 1, 3, 324, 281, 2, 3, 324,
+	281, 3, 3, 324, 281, 4, 3, 324,
+	281, 283, 3, 325, 281, 1, 3, 325,
+	281, 2, 3, 325, 281, 3, 3, 325,
+	281, 4, 3, 325, 281, 283, 3, 326,
+	281, 1, 3, 326, 281, 2, 3, 326,
+	281, 3, 3, 326, 281, 4, 3, 326,
+	281, 283, 3, 327, 281, 1, 3, 327,
+	281, 2, 3, 327, 281, 3, 3, 327,
+	281, 4, 3, 327, 281, 283, 3, 328,
+	281, 1, 3, 328, 281, 2, 3, 328,
+	281, 3, 3, 328, 281, 4, 3, 328,
+	281, 283, 3, 329, 281, 1, 3, 329,
+	281, 2, 3, 329, 281, 3, 3, 329,
+	281, 4, 3, 329, 281, 283, 3, 330,
+	281, 1, 3, 330, 281, 2, 3, 330,
+	281, 3, 3, 330, 281, 4, 3, 330,
+	281, 283, 3, 331, 281, 1, 3, 331,
+	281, 2, 3, 331, 281, 3, 3, 331,
+	281, 4, 3, 331, 281, 283, 3, 332,
+	281, 1, 3, 332, 281, 2, 3, 332,
+	281, 3, 3, 332, 281, 4, 3, 332,
+	281, 283, 3, 333, 281, 1, 3, 333,
+	281, 2, 3, 333, 281, 3, 3, 333,
+	281, 4, 3, 333, 281, 283, 3, 334,
+	1, 6, 4, 1, 7, 334, 29, 4,
+	1, 283, 29, 7, 4, 4, 283, 7,
+	29, 4, 4, 283, 29, 7, 4, 6,
+	1, 7, 334, 4, 6, 1, 81, 0,
+	4, 6, 68, 0, 1, 4, 6, 72,
+	0, 1, 4, 6, 81, 0, 1, 4,
+	7, 6, 334, 1, 4, 7, 68, 0,
+	1, 4, 7, 334, 1, 6, 4, 7,
+	334, 1, 29, 4, 17, 14, 20, 0,
+	4, 19, 79, 7, 2, 4, 19, 79,
+	7, 3, 4, 19, 79, 7, 4, 4,
+	26, 1, 67, 0, 4, 26, 4, 67,
+	0, 4, 28, 1, 7, 334, 4, 28,
+	1, 286, 283, 4, 28, 1, 288, 281,
+	4, 28, 2, 89, 7, 4, 28, 2,
+	286, 283, 4, 28, 2, 288, 281, 4,
+	28, 3, 89, 7, 4, 28, 3, 286,
+	283, 4, 28, 3, 288, 281, 4, 28,
+	4, 89, 7, 4, 28, 4, 286, 283,
+	4, 28, 4, 288, 281, 4, 28, 288,
+	281, 7, 4, 30, 35, 287, 8, 4,
+	30, 47, 35, 287, 4, 30, 287, 282,
+	8, 4, 34, 33, 27, 24, 4, 35,
+	287, 282, 8, 4, 37, 34, 33, 38,
+	4, 37, 39, 255, 1, 4, 37, 39,
+	255, 2, 4, 37, 39, 255, 3, 4,
+	37, 39, 255, 4, 4, 37, 39, 256,
+	1, 4, 37, 39, 256, 2, 4, 37,
+	39, 256, 3, 4, 37, 39, 256, 4,
+	4, 37, 39, 257, 1, 4, 37, 39,
+	257, 2, 4, 37, 39, 257, 3, 4,
+	37, 39, 257, 4, 4, 37, 39, 258,
+	1, 4, 37, 39, 258, 2, 4, 37,
+	39, 258, 3, 4, 37, 39, 258, 4,
+	4, 37, 39, 259, 1, 4, 37, 39,
+	259, 2, 4, 37, 39, 259, 3, 4,
+	37, 39, 259, 4, 4, 37, 39, 260,
+	1, 4, 37, 39, 260, 2, 4, 37,
+	39, 260, 3, 4, 37, 39, 260, 4,
+	4, 39, 257, 265, 0, 4, 39, 258,
+	265, 0, 4, 39, 259, 265, 0, 4,
+	39, 260, 265, 0, 4, 40, 36, 34,
+	33, 4, 41, 36, 34, 33, 4, 45,
+	281, 1, 283, 4, 45, 281, 4, 283,
+	4, 47, 35, 8, 69, 4, 53, 52,
+	34, 33, 4, 71, 22, 12, 13, 4,
+	78, 22, 12, 13, 4, 84, 29, 1,
+	7, 4, 84, 29, 2, 7, 4, 84,
+	29, 3, 7, 4, 84, 29, 4, 7,
+	4, 86, 87, 27, 24, 4, 89, 1,
+	7, 334, 4, 92, 151, 152, 282, 4,
+	93, 94, 1, 0, 4, 93, 94, 4,
+	0, 4, 95, 96, 1, 0, 4, 95,
+	96, 4, 0, 4, 101, 102, 1, 0,
+	4, 101, 102, 4, 0, 4, 200, 1,
+	248, 0, 4, 200, 4, 248, 0, 4,
+	201, 1, 248, 0, 4, 201, 4, 248,
+	0, 4, 202, 1, 248, 0, 4, 202,
+	4, 248, 0, 4, 203, 1, 248, 0,
+	4, 203, 4, 248, 0, 4, 204, 1,
+	248, 0, 4, 204, 4, 248, 0, 4,
+	205, 1, 248, 0, 4, 205, 4, 248,
+	0, 4, 206, 1, 248, 0, 4, 206,
+	4, 248, 0, 4, 207, 1, 248, 0,
+	4, 207, 4, 248, 0, 4, 208, 1,
+	248, 0, 4, 208, 4, 248, 0, 4,
+	209, 1, 248, 0, 4, 209, 4, 248,
+	0, 4, 210, 1, 248, 0, 4, 210,
+	4, 248, 0, 4, 211, 1, 248, 0,
+	4, 211, 4, 248, 0, 4, 212, 1,
+	248, 0, 4, 212, 4, 248, 0, 4,
+	213, 1, 248, 0, 4, 213, 4, 248,
+	0, 4, 214, 1, 248, 0, 4, 214,
+	4, 248, 0, 4, 215, 1, 248, 0,
+	4, 215, 4, 248, 0, 4, 216, 1,
+	248, 0, 4, 216, 4, 248, 0, 4,
+	217, 1, 248, 0, 4, 217, 4, 248,
+	0, 4, 218, 1, 248, 0, 4, 218,
+	4, 248, 0, 4, 219, 1, 248, 0,
+	4, 219, 4, 248, 0, 4, 220, 1,
+	248, 0, 4, 220, 4, 248, 0, 4,
+	221, 1, 248, 0, 4, 221, 4, 248,
+	0, 4, 222, 1, 248, 0, 4, 222,
+	4, 248, 0, 4, 223, 1, 248, 0,
+	4, 223, 4, 248, 0, 4, 224, 1,
+	248, 0, 4, 224, 4, 248, 0, 4,
+	225, 1, 248, 0, 4, 225, 4, 248,
+	0, 4, 226, 1, 248, 0, 4, 226,
+	4, 248, 0, 4, 227, 1, 248, 0,
+	4, 227, 4, 248, 0, 4, 228, 1,
+	248, 0, 4, 228, 4, 248, 0, 4,
+	229, 1, 248, 0, 4, 229, 4, 248,
+	0, 4, 230, 1, 248, 0, 4, 230,
+	4, 248, 0, 4, 231, 1, 248, 0,
+	4, 231, 4, 248, 0, 4, 232, 1,
+	248, 0, 4, 232, 4, 248, 0, 4,
+	233, 1, 248, 0, 4, 233, 4, 248,
+	0, 4, 234, 1, 248, 0, 4, 234,
+	4, 248, 0, 4, 235, 1, 248, 0,
+	4, 235, 4, 248, 0, 4, 236, 1,
+	248, 0, 4, 236, 4, 248, 0, 4,
+	237, 1, 248, 0, 4, 237, 4, 248,
+	0, 4, 238, 1, 248, 0, 4, 238,
+	4, 248, 0, 4, 239, 1, 248, 0,
+	4, 239, 4, 248, 0, 4, 240, 1,
+	248, 0, 4, 240, 4, 248, 0, 4,
+	241, 1, 248, 0, 4, 241, 4, 248,
+	0, 4, 242, 1, 248, 0, 4, 242,
+	4, 248, 0, 4, 243, 1, 248, 0,
+	4, 243, 4, 248, 0, 4, 244, 1,
+	248, 0, 4, 244, 4, 248, 0, 4,
+	245, 1, 248, 0, 4, 245, 4, 248,
+	0, 4, 246, 1, 248, 0, 4, 246,
+	4, 248, 0, 4, 247, 1, 248, 0,
+	4, 247, 4, 248, 0, 4, 283, 7,
+	334, 1, 4, 288, 281, 1, 283, 4,
+	288, 281, 2, 7, 4, 288, 281, 3,
+	7, 4, 288, 281, 4, 7, 4, 288,
+	281, 4, 283, 4, 289, 281, 1, 283,
+	4, 289, 281, 4, 283, 4, 290, 281,
+	1, 283, 4, 290, 281, 4, 283, 4,
+	291, 281, 1, 283, 4, 291, 281, 4,
+	283, 4, 292, 281, 1, 283, 4, 292,
+	281, 4, 283, 4, 293, 281, 1, 283,
+	4, 293, 281, 4, 283, 4, 294, 281,
+	1, 283, 4, 294, 281, 4, 283, 4,
+	295, 281, 1, 283, 4, 295, 281, 4,
+	283, 4, 296, 281, 1, 283, 4, 296,
+	281, 4, 283, 4, 297, 281, 1, 283,
+	4, 297, 281, 4, 283, 4, 298, 281,
+	1, 283, 4, 298, 281, 4, 283, 4,
+	299, 281, 1, 283, 4, 299, 281, 4,
+	283, 4, 300, 281, 1, 283, 4, 300,
+	281, 4, 283, 4, 301, 281, 1, 283,
+	4, 301, 281, 4, 283, 4, 302, 281,
+	1, 283, 4, 302, 281, 4, 283, 4,
+	303, 281, 1, 283, 4, 303, 281, 4,
+	283, 4, 304, 281, 1, 283, 4, 304,
+	281, 4, 283, 4, 305, 281, 1, 283,
+	4, 305, 281, 4, 283, 4, 306, 281,
+	1, 283, 4, 306, 281, 4, 283, 4,
+	307, 281, 1, 283, 4, 307, 281, 4,
+	283, 4, 308, 281, 1, 283, 4, 308,
+	281, 4, 283, 4, 309, 281, 1, 283,
+	4, 309, 281, 4, 283, 4, 310, 281,
+	1, 283, 4, 310, 281, 4, 283, 4,
+	311, 281, 1, 283, 4, 311, 281, 4,
+	283, 4, 312, 281, 1, 283, 4, 312,
+	281, 4, 283, 4, 313, 281, 1, 283,
+	4, 313, 281, 4, 283, 4, 314, 281,
+	1, 283, 4, 314, 281, 4, 283, 4,
+	315, 281, 1, 283, 4, 315, 281, 4,
+	283, 4, 316, 281, 1, 283, 4, 316,
+	281, 4, 283, 4, 317, 281, 1, 283,
+	4, 317, 281, 4, 283, 4, 318, 281,
+	1, 283, 4, 318, 281, 4, 283, 4,
+	319, 281, 1, 283, 4, 319, 281, 4,
+	283, 4, 320, 281, 1, 283, 4, 320,
+	281, 4, 283, 4, 321, 281, 1, 283,
+	4, 321, 281, 4, 283, 4, 322, 281,
+	1, 283, 4, 322, 281, 4, 283, 4,
+	323, 281, 1, 283, 4, 323, 281, 4,
+	283, 4, 324, 281, 1, 283, 4, 324,
+	281, 4, 283, 4, 325, 281, 1, 283,
+	4, 325, 281, 4, 283, 4, 326, 281,
+	1, 283, 4, 326, 281, 4, 283, 4,
+	327, 281, 1, 283, 4, 327, 281, 4,
+	283, 4, 328, 281, 1, 283, 4, 328,
+	281, 4, 283, 4, 329, 281, 1, 283,
+	4, 329, 281, 4, 283, 4, 330, 281,
+	1, 283, 4, 330, 281, 4, 283, 4,
+	331, 281, 1, 283, 4, 331, 281, 4,
+	283, 4, 332, 281, 1, 283, 4, 332,
+	281, 4, 283, 4, 333, 281, 1, 283,
+	4, 333, 281, 4, 283, 5, 19, 7,
+	72, 0, 1, 5, 28, 1, 89, 7,
+	334, 5, 28, 1, 288, 281, 283, 5,
+	28, 2, 288, 281, 7, 5, 28, 3,
+	288, 281, 7, 5, 28, 4, 288, 281,
+	7, 5, 28, 4, 288, 281, 283, 5,
+	30, 35, 287, 282, 8, 5, 34, 33,
+	283, 27, 24, 5, 37, 39, 257, 265,
+	0, 5, 37, 39, 258, 265, 0, 5,
+	37, 39, 259, 265, 0, 5, 37, 39,
+	260, 265, 0, 5, 39, 257, 1, 265,
+	0, 5, 39, 257, 4, 265, 0, 5,
+	39, 258, 1, 265, 0, 5, 39, 258,
+	4, 265, 0, 5, 39, 259, 1, 265,
+	0, 5, 39, 259, 4, 265, 0, 5,
+	39, 260, 1, 265, 0, 5, 39, 260,
+	4, 265, 0, 5, 47, 35, 287, 282,
+	8, 5, 53, 7, 68, 0, 1, 5,
+	76, 7, 81, 0, 1, 5, 86, 87,
+	283, 27, 24, 5, 263, 40, 36, 34,
+	33, 5, 288, 281, 1, 7, 334, 5,
+	288, 281, 4, 283, 7, 5, 288, 281,
+	283, 7, 4, 6, 19, 79, 7, 81,
+	0, 1, 6, 28, 1, 288, 281, 7,
+	334, 6, 28, 4, 288, 281, 283, 7,
+	6, 30, 47, 35, 287, 282, 8, 6,
+	37, 39, 257, 1, 265, 0, 6, 37,
+	39, 257, 4, 265, 0, 6, 37, 39,
+	258, 1, 265, 0, 6, 37, 39, 258,
+	4, 265, 0, 6, 37, 39, 259, 1,
+	265, 0, 6, 37, 39, 259, 4, 265,
+	0, 6, 37, 39, 260, 1, 265, 0,
+	6, 37, 39, 260, 4, 265, 0, 6,
+	288, 281, 1, 283, 7, 334, 6, 288,
+	281, 283, 7, 334, 1, 7, 28, 1,
+	288, 281, 283, 7, 334
+};
+
+static const short _zone_scanner_cond_offsets[] = {
+	0, 0, 2, 4, 6, 8, 10, 12,
+	14, 14, 14, 17, 19, 21, 24, 26,
+	28, 30, 30, 30, 32, 37, 42, 42,
+	42, 42, 42, 42, 44, 46, 46, 46,
+	48, 48, 48, 48, 50, 50, 50, 50,
+	52, 52, 52, 52, 52, 54, 54, 54,
+	54, 56, 56, 56, 56, 58, 60, 60,
+	60, 60, 60, 62, 62, 64, 64, 64,
+	64, 64, 66, 66, 68, 70, 70, 70,
+	70, 70, 70, 70, 70, 72, 72, 72,
+	74, 76, 76, 76, 78, 78, 80, 80,
+	82, 84, 84, 84, 84, 84, 86, 88,
+	88, 88, 88, 88, 90, 90, 92, 94,
+	94, 96, 98, 98, 98, 98, 98, 100,
+	100, 100, 100, 100, 100, 100, 100, 100,
+	100, 102, 102, 102, 104, 104, 106, 106,
+	106, 106, 108, 110, 110, 110, 110, 110,
+	110, 112, 112, 114, 114, 116, 116, 118,
+	118, 118, 118, 120, 120, 120, 120, 122,
+	122, 124, 124, 124, 124, 126, 126, 126,
+	128, 128, 128, 128, 128, 128, 130, 133,
+	135, 135, 137, 139, 141, 143, 143, 145,
+	148, 148, 148, 148, 148, 148, 148, 148,
+	148, 148, 150, 152, 155, 157, 159, 162,
+	164, 164, 166, 169, 171, 173, 175, 177,
+	179, 182, 184, 186, 188, 190, 192, 194,
+	196, 198, 200, 202, 204, 206, 208, 210,
+	212, 214, 216, 218, 220, 223, 225, 225,
+	225, 225, 225, 225, 225, 225, 225, 225,
+	227, 229, 231, 234, 236, 238, 240, 242,
+	244, 246, 248, 250, 252, 254, 256, 258,
+	260, 262, 264, 266, 268, 270, 272, 274,
+	279, 284, 289, 294, 294, 294, 296, 296,
+	296, 296, 298, 298, 300, 303, 305, 307,
+	312, 317, 322, 327, 330, 332, 337, 342,
+	344, 346, 348, 350, 352, 354, 356, 358,
+	360, 362, 364, 366, 368, 370, 372, 374,
+	377, 380, 382, 385, 385, 385, 385, 385,
+	385, 385, 385, 385, 385, 385, 385, 385,
+	385, 385, 385, 385, 385, 386, 386, 386,
+	386, 386, 387, 389, 391, 393, 395, 395,
+	397, 397, 399, 402, 404, 406, 406, 408,
+	410, 410, 410, 410, 410, 410, 412, 415,
+	417, 419, 421, 423, 423, 425, 427, 427,
+	427, 427, 427, 427, 429, 432, 434, 437,
+	440, 440, 440, 440, 440, 442, 445, 445,
+	447, 449, 451, 451, 451, 453, 456, 456,
+	456, 458, 458, 458, 458, 458, 458, 460,
+	462, 462, 462, 464, 464, 464, 464, 466,
+	466, 466, 466, 468, 468, 468, 468, 468,
+	470, 470, 470, 470, 472, 472, 472, 472,
+	474, 476, 476, 476, 476, 476, 478, 478,
+	480, 480, 480, 480, 480, 482, 482, 482,
+	482, 482, 482, 482, 482, 484, 484, 484,
+	486, 488, 488, 488, 490, 490, 492, 492,
+	494, 496, 496, 496, 496, 496, 498, 500,
+	500, 500, 500, 500, 502, 502, 504, 506,
+	506, 508, 510, 510, 510, 510, 510, 512,
+	512, 512, 512, 512, 512, 512, 512, 512,
+	512, 514, 514, 514, 516, 516, 518, 518,
+	518, 518, 520, 522, 522, 522, 522, 522,
+	522, 524, 524, 526, 526, 528, 528, 530,
+	530, 530, 530, 532, 532, 532, 532, 534,
+	534, 536, 536, 536, 536, 538, 538, 538,
+	540, 540, 540, 540, 540, 540, 542, 542,
+	542, 542, 544, 544, 546, 548, 550, 552,
+	554, 554, 556, 559, 562, 565, 567, 569,
+	571, 573, 573, 575, 578, 581, 583, 586,
+	586, 586, 586, 586, 586, 586, 586, 586,
+	586, 586, 586, 586, 586, 586, 586, 586,
+	586, 586, 586, 586, 586, 586, 586, 586,
+	586, 586, 586, 586, 586, 586, 586, 586,
+	586, 586, 586, 586, 586, 586, 586, 586,
+	586, 586, 586, 586, 586, 586, 586, 586,
+	586, 586, 586, 586, 586, 586, 586, 586,
+	586, 586, 586, 586, 586, 586, 586, 586,
+	586, 586, 586, 586, 586, 586, 586, 586,
+	586, 586, 586, 586, 586, 586, 586, 586,
+	586, 586, 586, 586, 586, 586, 586, 586,
+	586, 586, 586, 586, 586, 586, 586, 586,
+	586, 586, 586, 586, 586, 586, 586, 586,
+	586, 586, 586, 586, 586, 586, 586, 586,
+	586, 586, 586, 586, 586, 586, 586, 586,
+	586, 586, 586, 586, 586, 586, 586, 586,
+	586, 586, 586, 586, 586, 586, 586, 586,
+	586, 586, 586, 586, 586, 586, 586, 586,
+	586, 586, 586, 586, 586, 586, 588, 590,
+	592, 594, 596, 598, 600, 602, 604, 606,
+	608, 610, 610, 610, 610, 610, 613, 615,
+	615, 617, 620, 622, 622, 624, 627, 629,
+	629, 631, 634, 637, 640, 640, 642, 644,
+	644, 647, 647, 649, 651, 651, 654, 654,
+	656, 658, 658, 661, 661, 663, 665, 668,
+	668, 668, 668, 670, 672, 674, 676, 678,
+	680, 682, 684, 686, 688, 690, 692, 694,
+	696, 698, 700, 700, 702, 704, 706, 708,
+	710, 712, 714, 716, 719, 721, 723, 726,
+	728, 730, 732, 735, 737, 739, 741, 744,
+	746, 748, 750, 753, 755, 758, 760, 762,
+	765, 768, 771, 773, 776, 778, 780, 783,
+	786, 786, 788, 790, 792, 794, 796, 798,
+	798, 801, 804, 807, 807, 809, 811, 813,
+	815, 817, 819, 821, 823, 825, 827, 827,
+	830, 833, 836, 839, 842, 842, 844, 846,
+	848, 850, 852, 854, 856, 859, 862, 865,
+	867, 867, 867, 867, 867, 867, 869, 872,
+	872, 872, 872, 872, 874, 876, 878, 880,
+	882, 884, 884, 886, 889, 892, 895, 898,
+	898, 900, 902, 904, 906, 906, 908, 911,
+	914, 917, 917, 919, 921, 923, 925, 927,
+	929, 935, 946, 948, 951, 957, 960, 971,
+	974, 977, 980, 982, 984, 986, 988, 994,
+	997, 1000, 1002, 1004, 1006, 1008, 1014, 1017,
+	1020, 1022, 1024, 1026, 1028, 1034, 1037, 1040,
+	1043, 1043, 1045, 1047, 1049, 1051, 1053, 1055,
+	1057, 1059, 1061, 1063, 1065, 1067, 1069, 1071,
+	1073, 1075, 1077, 1080, 1083, 1086, 1089, 1092,
+	1095, 1098, 1101, 1101, 1101, 1103, 1103, 1103,
+	1103, 1105, 1105, 1107, 1107, 1107, 1109, 1109,
+	1109, 1109, 1109, 1109, 1111, 1113, 1113, 1113,
+	1115, 1115, 1115, 1115, 1117, 1117, 1117, 1117,
+	1119, 1119, 1119, 1119, 1119, 1121, 1121, 1121,
+	1121, 1123, 1123, 1123, 1123, 1125, 1127, 1127,
+	1127, 1127, 1127, 1129, 1129, 1131, 1131, 1131,
+	1131, 1131, 1133, 1133, 1133, 1133, 1133, 1133,
+	1133, 1133, 1135, 1135, 1135, 1137, 1139, 1139,
+	1139, 1141, 1141, 1143, 1143, 1145, 1147, 1147,
+	1147, 1147, 1147, 1149, 1151, 1151, 1151, 1151,
+	1151, 1153, 1153, 1155, 1157, 1157, 1159, 1161,
+	1161, 1161, 1161, 1161, 1163, 1163, 1163, 1163,
+	1163, 1163, 1163, 1163, 1163, 1163, 1165, 1165,
+	1165, 1167, 1167, 1169, 1169, 1169, 1169, 1171,
+	1173, 1173, 1173, 1173, 1173, 1173, 1175, 1175,
+	1177, 1177, 1179, 1179, 1181, 1181, 1181, 1181,
+	1183, 1183, 1183, 1183, 1185, 1185, 1187, 1187,
+	1187, 1187, 1189, 1189, 1189, 1191, 1191, 1191,
+	1191, 1191, 1191, 1193, 1193, 1193, 1193, 1193,
+	1195, 1197, 1199, 1201, 1203, 1205, 1207, 1210,
+	1213, 1216, 1216, 1218, 1218, 1220, 1222, 1224,
+	1226, 1228, 1230, 1232, 1234, 1234, 1234, 1234,
+	1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234,
+	1234, 1234, 1234, 1237, 1237, 1239, 1242, 1245,
+	1248, 1248, 1250, 1252, 1254, 1256, 1258, 1260,
+	1260, 1260, 1260, 1263, 1266, 1269, 1269, 1271,
+	1273, 1275, 1277, 1279, 1281, 1281, 1283, 1286,
+	1289, 1292, 1295, 1295, 1297, 1299, 1299, 1299,
+	1302, 1302, 1304, 1306, 1308, 1310, 1312, 1314,
+	1314, 1316, 1319, 1322, 1325, 1328, 1328, 1330,
+	1332, 1332, 1335, 1335, 1337, 1339, 1339, 1339,
+	1339, 1339, 1339, 1339, 1339, 1339, 1339, 1342,
+	1342, 1342, 1342, 1342, 1342, 1342, 1342, 1342,
+	1342, 1342, 1342, 1342, 1342, 1344, 1346, 1348,
+	1350, 1350, 1353, 1356, 1356, 1358, 1360, 1362,
+	1364, 1364, 1367, 1370, 1372, 1374, 1376, 1378,
+	1380, 1382, 1384, 1386, 1388, 1390, 1390, 1390,
+	1390, 1390, 1390, 1390, 1390, 1392, 1392, 1394,
+	1397, 1397, 1399, 1402, 1402, 1404, 1407, 1409,
+	1409, 1411, 1414, 1417, 1417, 1417, 1417, 1417,
+	1417, 1417, 1417, 1417, 1417, 1419, 1422, 1422,
+	1422, 1424, 1427, 1429, 1432, 1434, 1437, 1439,
+	1442, 1442, 1442, 1442, 1442, 1444, 1447, 1447,
+	1449, 1452, 1452, 1454, 1457, 1457, 1463, 1466,
+	1477, 1480, 1491, 1494, 1494, 1494, 1494, 1494,
+	1494, 1494, 1494, 1496, 1499, 1499, 1499, 1501,
+	1504, 1504, 1504, 1504, 1504, 1504
+};
+
+static const char _zone_scanner_cond_lengths[] = {
+	0, 2, 2, 2, 2, 2, 2, 2,
+	0, 0, 3, 2, 2, 3, 2, 2,
+	2, 0, 0, 2, 5, 5, 0, 0,
+	0, 0, 0, 2, 2, 0, 0, 2,
+	0, 0, 0, 2, 0, 0, 0, 2,
+	0, 0, 0, 0, 2, 0, 0, 0,
+	2, 0, 0, 0, 2, 2, 0, 0,
+	0, 0, 2, 0, 2, 0, 0, 0,
+	0, 2, 0, 2, 2, 0, 0, 0,
+	0, 0, 0, 0, 2, 0, 0, 2,
+	2, 0, 0, 2, 0, 2, 0, 2,
+	2, 0, 0, 0, 0, 2, 2, 0,
+	0, 0, 0, 2, 0, 2, 2, 0,
+	2, 2, 0, 0, 0, 0, 2, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	2, 0, 0, 2, 0, 2, 0, 0,
+	0, 2, 2, 0, 0, 0, 0, 0,
+	2, 0, 2, 0, 2, 0, 2, 0,
+	0, 0, 2, 0, 0, 0, 2, 0,
+	2, 0, 0, 0, 2, 0, 0, 2,
+	0, 0, 0, 0, 0, 2, 3, 2,
+	0, 2, 2, 2, 2, 0, 2, 3,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 2, 2, 3, 2, 2, 3, 2,
+	0, 2, 3, 2, 2, 2, 2, 2,
+	3, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 3, 2, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 2,
+	2, 2, 3, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 5,
+	5, 5, 5, 0, 0, 2, 0, 0,
+	0, 2, 0, 2, 3, 2, 2, 5,
+	5, 5, 5, 3, 2, 5, 5, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 3,
+	3, 2, 3, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 0, 0, 0,
+	0, 1, 2, 2, 2, 2, 0, 2,
+	0, 2, 3, 2, 2, 0, 2, 2,
+	0, 0, 0, 0, 0, 2, 3, 2,
+	2, 2, 2, 0, 2, 2, 0, 0,
+	0, 0, 0, 2, 3, 2, 3, 3,
+	0, 0, 0, 0, 2, 3, 0, 2,
+	2, 2, 0, 0, 2, 3, 0, 0,
+	2, 0, 0, 0, 0, 0, 2, 2,
+	0, 0, 2, 0, 0, 0, 2, 0,
+	0, 0, 2, 0, 0, 0, 0, 2,
+	0, 0, 0, 2, 0, 0, 0, 2,
+	2, 0, 0, 0, 0, 2, 0, 2,
+	0, 0, 0, 0, 2, 0, 0, 0,
+	0, 0, 0, 0, 2, 0, 0, 2,
+	2, 0, 0, 2, 0, 2, 0, 2,
+	2, 0, 0, 0, 0, 2, 2, 0,
+	0, 0, 0, 2, 0, 2, 2, 0,
+	2, 2, 0, 0, 0, 0, 2, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	2, 0, 0, 2, 0, 2, 0, 0,
+	0, 2, 2, 0, 0, 0, 0, 0,
+	2, 0, 2, 0, 2, 0, 2, 0,
+	0, 0, 2, 0, 0, 0, 2, 0,
+	2, 0, 0, 0, 2, 0, 0, 2,
+	0, 0, 0, 0, 0, 2, 0, 0,
+	0, 2, 0, 2, 2, 2, 2, 2,
+	0, 2, 3, 3, 3, 2, 2, 2,
+	2, 0, 2, 3, 3, 2, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 0, 0, 0, 0, 3, 2, 0,
+	2, 3, 2, 0, 2, 3, 2, 0,
+	2, 3, 3, 3, 0, 2, 2, 0,
+	3, 0, 2, 2, 0, 3, 0, 2,
+	2, 0, 3, 0, 2, 2, 3, 0,
+	0, 0, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 0, 2, 2, 2, 2, 2,
+	2, 2, 2, 3, 2, 2, 3, 2,
+	2, 2, 3, 2, 2, 2, 3, 2,
+	2, 2, 3, 2, 3, 2, 2, 3,
+	3, 3, 2, 3, 2, 2, 3, 3,
+	0, 2, 2, 2, 2, 2, 2, 0,
+	3, 3, 3, 0, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 0, 3,
+	3, 3, 3, 3, 0, 2, 2, 2,
+	2, 2, 2, 2, 3, 3, 3, 2,
+	0, 0, 0, 0, 0, 2, 3, 0,
+	0, 0, 0, 2, 2, 2, 2, 2,
+	2, 0, 2, 3, 3, 3, 3, 0,
+	2, 2, 2, 2, 0, 2, 3, 3,
+	3, 0, 2, 2, 2, 2, 2, 2,
+	6, 11, 2, 3, 6, 3, 11, 3,
+	3, 3, 2, 2, 2, 2, 6, 3,
+	3, 2, 2, 2, 2, 6, 3, 3,
+	2, 2, 2, 2, 6, 3, 3, 3,
+	0, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 3, 3, 3, 3, 3, 3,
+	3, 3, 0, 0, 2, 0, 0, 0,
+	2, 0, 2, 0, 0, 2, 0, 0,
+	0, 0, 0, 2, 2, 0, 0, 2,
+	0, 0, 0, 2, 0, 0, 0, 2,
+	0, 0, 0, 0, 2, 0, 0, 0,
+	2, 0, 0, 0, 2, 2, 0, 0,
+	0, 0, 2, 0, 2, 0, 0, 0,
+	0, 2, 0, 0, 0, 0, 0, 0,
+	0, 2, 0, 0, 2, 2, 0, 0,
+	2, 0, 2, 0, 2, 2, 0, 0,
+	0, 0, 2, 2, 0, 0, 0, 0,
+	2, 0, 2, 2, 0, 2, 2, 0,
+	0, 0, 0, 2, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 2, 0, 0,
+	2, 0, 2, 0, 0, 0, 2, 2,
+	0, 0, 0, 0, 0, 2, 0, 2,
+	0, 2, 0, 2, 0, 0, 0, 2,
+	0, 0, 0, 2, 0, 2, 0, 0,
+	0, 2, 0, 0, 2, 0, 0, 0,
+	0, 0, 2, 0, 0, 0, 0, 2,
+	2, 2, 2, 2, 2, 2, 3, 3,
+	3, 0, 2, 0, 2, 2, 2, 2,
+	2, 2, 2, 2, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 0, 2, 3, 3, 3,
+	0, 2, 2, 2, 2, 2, 2, 0,
+	0, 0, 3, 3, 3, 0, 2, 2,
+	2, 2, 2, 2, 0, 2, 3, 3,
+	3, 3, 0, 2, 2, 0, 0, 3,
+	0, 2, 2, 2, 2, 2, 2, 0,
+	2, 3, 3, 3, 3, 0, 2, 2,
+	0, 3, 0, 2, 2, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2, 2, 2, 2,
+	0, 3, 3, 0, 2, 2, 2, 2,
+	0, 3, 3, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 0, 0, 0,
+	0, 0, 0, 0, 2, 0, 2, 3,
+	0, 2, 3, 0, 2, 3, 2, 0,
+	2, 3, 3, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2, 3, 0, 0,
+	2, 3, 2, 3, 2, 3, 2, 3,
+	0, 0, 0, 0, 2, 3, 0, 2,
+	3, 0, 2, 3, 0, 6, 3, 11,
+	3, 11, 3, 0, 0, 0, 0, 0,
+	0, 0, 2, 3, 0, 0, 2, 3,
+	0, 0, 0, 0, 0, 0
+};
+
+static const short _zone_scanner_cond_keys[] = {
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, -128, 9, 10, 10,
+	11, 127, 10, 10, 59, 59, 10, 10,
+	59, 59, -128, 9, 10, 10, 11, 127,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	-128, 9, 10, 10, 11, 58, 59, 59,
+	60, 127, -128, 9, 10, 10, 11, 58,
+	59, 59, 60, 127, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, -128, 9, 10, 10,
+	11, 127, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, -128, 9, 10, 10, 11, 127,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	-128, 9, 10, 10, 11, 127, 10, 10,
+	59, 59, 10, 10, 59, 59, -128, 9,
+	10, 10, 11, 127, 10, 10, 59, 59,
+	10, 10, 59, 59, -128, 9, 10, 10,
+	11, 127, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, -128, 9,
+	10, 10, 11, 127, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	-128, 9, 10, 10, 11, 127, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, -128, 9,
+	10, 10, 11, 127, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, -128, 9, 10, 10,
+	11, 58, 59, 59, 60, 127, -128, 9,
+	10, 10, 11, 58, 59, 59, 60, 127,
+	-128, 9, 10, 10, 11, 58, 59, 59,
+	60, 127, -128, 9, 10, 10, 11, 58,
+	59, 59, 60, 127, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	-128, 9, 10, 10, 11, 127, 10, 10,
+	59, 59, 10, 10, 59, 59, -128, 9,
+	10, 10, 11, 58, 59, 59, 60, 127,
+	-128, 9, 10, 10, 11, 58, 59, 59,
+	60, 127, -128, 9, 10, 10, 11, 58,
+	59, 59, 60, 127, -128, 9, 10, 10,
+	11, 58, 59, 59, 60, 127, -128, 9,
+	10, 10, 11, 127, 10, 10, 59, 59,
+	-128, 9, 10, 10, 11, 58, 59, 59,
+	60, 127, -128, 9, 10, 10, 11, 58,
+	59, 59, 60, 127, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, -128, 9, 10, 10,
+	11, 127, -128, 9, 10, 10, 11, 127,
+	10, 10, 59, 59, -128, 9, 10, 10,
+	11, 127, 10, 10, 10, 10, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, -128, 9,
+	10, 10, 11, 127, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	-128, 9, 10, 10, 11, 127, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, -128, 9, 10, 10, 11, 127,
+	10, 10, 59, 59, -128, 9, 10, 10,
+	11, 127, -128, 9, 10, 10, 11, 127,
+	10, 10, 59, 59, -128, 9, 10, 10,
+	11, 127, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, -128, 9, 10, 10, 11, 127,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	-128, 9, 10, 10, 11, 127, -128, 9,
+	10, 10, 11, 127, -128, 9, 10, 10,
+	11, 127, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, -128, 9,
+	10, 10, 11, 127, -128, 9, 10, 10,
+	11, 127, 10, 10, 59, 59, -128, 9,
+	10, 10, 11, 127, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, -128, 9, 10, 10,
+	11, 127, 10, 10, 59, 59, 10, 10,
+	59, 59, -128, 9, 10, 10, 11, 127,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	-128, 9, 10, 10, 11, 127, 10, 10,
+	59, 59, 10, 10, 59, 59, -128, 9,
+	10, 10, 11, 127, -128, 9, 10, 10,
+	11, 127, -128, 9, 10, 10, 11, 127,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	-128, 9, 10, 10, 11, 127, 10, 10,
+	59, 59, 10, 10, 59, 59, -128, 9,
+	10, 10, 11, 127, 10, 10, 59, 59,
+	10, 10, 59, 59, -128, 9, 10, 10,
+	11, 127, 10, 10, 59, 59, 10, 10,
+	59, 59, -128, 9, 10, 10, 11, 127,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	-128, 9, 10, 10, 11, 127, 10, 10,
+	59, 59, 10, 10, 59, 59, -128, 9,
+	10, 10, 11, 127, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	-128, 9, 10, 10, 11, 127, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, -128, 9, 10, 10, 11, 127,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, -128, 9, 10, 10,
+	11, 127, 10, 10, 59, 59, -128, 9,
+	10, 10, 11, 127, 10, 10, 59, 59,
+	10, 10, 59, 59, -128, 9, 10, 10,
+	11, 127, -128, 9, 10, 10, 11, 127,
+	-128, 9, 10, 10, 11, 127, 10, 10,
+	59, 59, -128, 9, 10, 10, 11, 127,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	-128, 9, 10, 10, 11, 127, -128, 9,
+	10, 10, 11, 127, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, -128, 9, 10, 10,
+	11, 127, -128, 9, 10, 10, 11, 127,
+	-128, 9, 10, 10, 11, 127, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, -128, 9,
+	10, 10, 11, 127, -128, 9, 10, 10,
+	11, 127, -128, 9, 10, 10, 11, 127,
+	-128, 9, 10, 10, 11, 127, -128, 9,
+	10, 10, 11, 127, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	-128, 9, 10, 10, 11, 127, -128, 9,
+	10, 10, 11, 127, -128, 9, 10, 10,
+	11, 127, 10, 10, 59, 59, 10, 10,
+	59, 59, -128, 9, 10, 10, 11, 127,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, -128, 9, 10, 10,
+	11, 127, -128, 9, 10, 10, 11, 127,
+	-128, 9, 10, 10, 11, 127, -128, 9,
+	10, 10, 11, 127, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	-128, 9, 10, 10, 11, 127, -128, 9,
+	10, 10, 11, 127, -128, 9, 10, 10,
+	11, 127, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 9, 9, 10, 10, 32, 32,
+	40, 40, 41, 41, 59, 59, 9, 9,
+	10, 10, 32, 32, 40, 40, 41, 41,
+	43, 43, 47, 47, 48, 57, 59, 59,
+	65, 90, 97, 122, 10, 10, 59, 59,
+	-128, 9, 10, 10, 11, 127, 9, 9,
+	10, 10, 32, 32, 40, 40, 41, 41,
+	59, 59, -128, 9, 10, 10, 11, 127,
+	9, 9, 10, 10, 32, 32, 40, 40,
+	41, 41, 43, 43, 47, 47, 48, 57,
+	59, 59, 65, 90, 97, 122, -128, 9,
+	10, 10, 11, 127, -128, 9, 10, 10,
+	11, 127, -128, 9, 10, 10, 11, 127,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	9, 9, 10, 10, 32, 32, 40, 40,
+	41, 41, 59, 59, -128, 9, 10, 10,
+	11, 127, -128, 9, 10, 10, 11, 127,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	9, 9, 10, 10, 32, 32, 40, 40,
+	41, 41, 59, 59, -128, 9, 10, 10,
+	11, 127, -128, 9, 10, 10, 11, 127,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	9, 9, 10, 10, 32, 32, 40, 40,
+	41, 41, 59, 59, -128, 9, 10, 10,
+	11, 127, -128, 9, 10, 10, 11, 127,
+	-128, 9, 10, 10, 11, 127, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, -128, 9, 10, 10, 11, 127,
+	-128, 9, 10, 10, 11, 127, -128, 9,
+	10, 10, 11, 127, -128, 9, 10, 10,
+	11, 127, -128, 9, 10, 10, 11, 127,
+	-128, 9, 10, 10, 11, 127, -128, 9,
+	10, 10, 11, 127, -128, 9, 10, 10,
+	11, 127, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, -128, 9,
+	10, 10, 11, 127, -128, 9, 10, 10,
+	11, 127, -128, 9, 10, 10, 11, 127,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, -128, 9, 10, 10,
+	11, 127, 10, 10, 59, 59, -128, 9,
+	10, 10, 11, 127, -128, 9, 10, 10,
+	11, 127, -128, 9, 10, 10, 11, 127,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	-128, 9, 10, 10, 11, 127, -128, 9,
+	10, 10, 11, 127, -128, 9, 10, 10,
+	11, 127, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, 10, 10,
+	59, 59, 10, 10, 59, 59, -128, 9,
+	10, 10, 11, 127, -128, 9, 10, 10,
+	11, 127, -128, 9, 10, 10, 11, 127,
+	-128, 9, 10, 10, 11, 127, 10, 10,
+	59, 59, 10, 10, 59, 59, -128, 9,
+	10, 10, 11, 127, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	-128, 9, 10, 10, 11, 127, -128, 9,
+	10, 10, 11, 127, -128, 9, 10, 10,
+	11, 127, -128, 9, 10, 10, 11, 127,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	-128, 9, 10, 10, 11, 127, 10, 10,
+	59, 59, 10, 10, 59, 59, -128, 9,
+	10, 10, 11, 127, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, -128, 9, 10, 10,
+	11, 127, -128, 9, 10, 10, 11, 127,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	-128, 9, 10, 10, 11, 127, -128, 9,
+	10, 10, 11, 127, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, 10, 10, 59, 59,
+	10, 10, 59, 59, -128, 9, 10, 10,
+	11, 127, 10, 10, 59, 59, -128, 9,
+	10, 10, 11, 127, 10, 10, 59, 59,
+	-128, 9, 10, 10, 11, 127, 10, 10,
+	59, 59, 10, 10, 59, 59, -128, 9,
+	10, 10, 11, 127, -128, 9, 10, 10,
+	11, 127, 10, 10, 59, 59, -128, 9,
+	10, 10, 11, 127, 10, 10, 59, 59,
+	-128, 9, 10, 10, 11, 127, 10, 10,
+	59, 59, -128, 9, 10, 10, 11, 127,
+	10, 10, 59, 59, -128, 9, 10, 10,
+	11, 127, 10, 10, 59, 59, -128, 9,
+	10, 10, 11, 127, 10, 10, 59, 59,
+	-128, 9, 10, 10, 11, 127, 10, 10,
+	59, 59, -128, 9, 10, 10, 11, 127,
+	10, 10, 59, 59, -128, 9, 10, 10,
+	11, 127, 9, 9, 10, 10, 32, 32,
+	40, 40, 41, 41, 59, 59, -128, 9,
+	10, 10, 11, 127, 9, 9, 10, 10,
+	32, 32, 40, 40, 41, 41, 43, 43,
+	47, 47, 48, 57, 59, 59, 65, 90,
+	97, 122, -128, 9, 10, 10, 11, 127,
+	9, 9, 10, 10, 32, 32, 40, 40,
+	41, 41, 43, 43, 47, 47, 48, 57,
+	59, 59, 65, 90, 97, 122, -128, 9,
+	10, 10, 11, 127, 10, 10, 59, 59,
+	-128, 9, 10, 10, 11, 127, 10, 10,
+	59, 59, -128, 9, 10, 10, 11, 127,
+	0
+};
+
+static const char _zone_scanner_cond_spaces[] = {
+	0, 0, 0, 0, 0, 0, 5, 5,
+	5, 5, 0, 0, 0, 0, 0, 0,
+	0, 5, 5, 5, 5, 0, 0, 0,
+	5, 5, 0, 0, 0, 0, 5, 5,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 0, 0, 0, 0, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 5, 5, 5, 5, 5, 5, 5,
+	5, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 5, 5, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 5, 5, 5, 5, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 5, 5,
+	5, 5, 5, 5, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 5, 5, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 2, 2, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	5, 5, 0, 0, 0, 5, 5, 5,
+	5, 5, 5, 5, 5, 0, 0, 0,
+	5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 0, 0, 0, 0, 0, 0,
+	0, 0, 5, 5, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 5, 5, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 5, 5, 5,
+	5, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 0, 0, 0, 5,
+	5, 5, 5, 0, 0, 0, 5, 5,
+	5, 5, 5, 5, 0, 0, 0, 5,
+	5, 5, 5, 5, 5, 0, 0, 0,
+	5, 5, 5, 5, 5, 5, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 5, 5, 5, 5, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 5, 5, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 5, 5, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 8, 11, 8, 8, 8, 11, 3,
+	6, 3, 3, 3, 3, 3, 3, 6,
+	3, 3, 1, 1, 6, 6, 6, 4,
+	9, 4, 4, 4, 9, 7, 7, 7,
+	8, 11, 8, 8, 8, 3, 3, 3,
+	11, 3, 3, 10, 10, 10, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 8, 11, 8, 8,
+	8, 11, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	8, 11, 8, 8, 8, 11, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 8, 11, 8, 8,
+	8, 11, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 1, 1, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 5, 5, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 5, 5, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 5, 5, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	5, 5, 5, 5, 5, 5, 0, 0,
+	5, 5, 0, 0, 0, 5, 5, 0,
+	0, 0, 5, 5, 0, 0, 0, 0,
+	0, 5, 5, 0, 0, 0, 0, 0,
+	0, 5, 5, 0, 0, 0, 5, 5,
+	0, 0, 0, 5, 5, 0, 0, 0,
+	5, 5, 0, 0, 0, 5, 5, 0,
+	0, 0, 5, 5, 0, 0, 0, 5,
+	5, 0, 0, 0, 5, 5, 0, 0,
+	0, 4, 9, 4, 4, 4, 9, 7,
+	7, 7, 3, 6, 3, 3, 3, 3,
+	3, 3, 6, 3, 3, 6, 6, 6,
+	8, 11, 8, 8, 8, 3, 3, 3,
+	11, 3, 3, 10, 10, 10, 5, 5,
+	0, 0, 0, 5, 5, 0, 0, 0,
+	0
+};
+
+static const short _zone_scanner_key_offsets[] = {
+	0, 0, 44, 62, 102, 118, 135, 143,
+	151, 152, 153, 156, 175, 194, 200, 256,
+	276, 318, 328, 330, 340, 354, 368, 372,
+	374, 376, 378, 380, 390, 400, 402, 404,
+	414, 416, 418, 420, 430, 432, 434, 436,
+	446, 452, 454, 456, 458, 468, 472, 474,
+	476, 486, 488, 490, 492, 502, 512, 514,
+	516, 518, 519, 529, 530, 540, 542, 544,
+	546, 548, 558, 562, 568, 608, 610, 612,
+	614, 616, 618, 620, 622, 632, 636, 638,
+	648, 658, 664, 665, 675, 676, 686, 688,
+	698, 708, 712, 714, 716, 718, 728, 738,
+	744, 746, 748, 750, 760, 762, 772, 784,
+	786, 797, 809, 811, 813, 815, 817, 827,
+	829, 831, 833, 835, 837, 839, 841, 843,
+	845, 855, 857, 859, 869, 875, 885, 887,
+	889, 891, 901, 911, 921, 923, 925, 927,
+	929, 939, 941, 951, 953, 963, 965, 975,
+	977, 979, 981, 991, 997, 999, 1001, 1011,
+	1013, 1023, 1025, 1027, 1029, 1041, 1043, 1045,
+	1055, 1057, 1059, 1061, 1063, 1065, 1075, 1078,
+	1122, 1126, 1132, 1174, 1192, 1200, 1212, 1220,
+	1223, 1224, 1230, 1232, 1234, 1236, 1238, 1240,
+	1242, 1248, 1254, 1296, 1299, 1317, 1359, 1362,
+	1370, 1382, 1390, 1393, 1409, 1463, 1481, 1500,
+	1544, 1550, 1564, 1578, 1634, 1652, 1666, 1676,
+	1686, 1698, 1710, 1724, 1736, 1750, 1760, 1770,
+	1784, 1802, 1816, 1826, 1836, 1842, 1856, 1858,
+	1860, 1862, 1864, 1866, 1872, 1874, 1876, 1882,
+	1890, 1910, 1954, 1960, 1978, 2034, 2052, 2066,
+	2076, 2086, 2098, 2110, 2124, 2136, 2150, 2160,
+	2170, 2184, 2202, 2216, 2226, 2236, 2251, 2295,
+	2309, 2323, 2339, 2355, 2357, 2359, 2369, 2371,
+	2373, 2375, 2385, 2387, 2397, 2403, 2417, 2431,
+	2447, 2463, 2479, 2495, 2498, 2554, 2568, 2582,
+	2598, 2610, 2618, 2626, 2636, 2646, 2658, 2668,
+	2680, 2688, 2696, 2708, 2724, 2736, 2744, 2752,
+	2758, 2764, 2774, 2780, 2781, 2782, 2793, 2809,
+	2825, 2827, 2829, 2831, 2847, 2853, 2859, 2865,
+	2877, 2883, 2885, 2887, 2899, 2905, 2911, 2917,
+	2919, 2921, 2927, 2933, 2941, 2961, 2969, 2970,
+	2980, 2992, 3002, 3005, 3011, 3027, 3037, 3055,
+	3063, 3064, 3066, 3068, 3070, 3080, 3088, 3091,
+	3097, 3109, 3117, 3135, 3145, 3163, 3171, 3172,
+	3174, 3176, 3178, 3188, 3196, 3202, 3218, 3221,
+	3224, 3231, 3238, 3246, 3254, 3271, 3274, 3275,
+	3285, 3329, 3345, 3347, 3349, 3359, 3362, 3372,
+	3374, 3384, 3388, 3390, 3392, 3394, 3396, 3406,
+	3416, 3418, 3420, 3430, 3432, 3434, 3436, 3446,
+	3448, 3450, 3452, 3462, 3468, 3470, 3472, 3474,
+	3484, 3488, 3490, 3492, 3502, 3504, 3506, 3508,
+	3518, 3528, 3530, 3532, 3534, 3535, 3545, 3546,
+	3556, 3558, 3560, 3562, 3564, 3574, 3576, 3578,
+	3580, 3582, 3584, 3586, 3588, 3598, 3602, 3604,
+	3614, 3624, 3630, 3631, 3641, 3642, 3652, 3654,
+	3664, 3674, 3678, 3680, 3682, 3684, 3694, 3704,
+	3710, 3712, 3714, 3716, 3726, 3728, 3738, 3750,
+	3752, 3763, 3775, 3777, 3779, 3781, 3783, 3793,
+	3795, 3797, 3799, 3801, 3803, 3805, 3807, 3809,
+	3811, 3821, 3823, 3825, 3835, 3841, 3851, 3853,
+	3855, 3857, 3867, 3877, 3887, 3889, 3891, 3893,
+	3895, 3905, 3907, 3917, 3919, 3929, 3931, 3941,
+	3943, 3945, 3947, 3957, 3963, 3965, 3967, 3977,
+	3979, 3989, 3991, 3993, 3995, 4007, 4009, 4011,
+	4021, 4023, 4025, 4027, 4029, 4031, 4041, 4043,
+	4045, 4047, 4057, 4059, 4069, 4075, 4083, 4091,
+	4103, 4109, 4125, 4128, 4131, 4134, 4140, 4149,
+	4159, 4171, 4177, 4193, 4196, 4199, 4207, 4210,
+	4222, 4230, 4234, 4240, 4242, 4249, 4251, 4253,
+	4255, 4257, 4258, 4259, 4261, 4263, 4265, 4266,
+	4272, 4276, 4280, 4281, 4283, 4285, 4287, 4289,
+	4295, 4297, 4299, 4301, 4303, 4304, 4305, 4307,
+	4309, 4311, 4312, 4313, 4314, 4320, 4321, 4322,
+	4324, 4326, 4328, 4329, 4330, 4331, 4337, 4339,
+	4340, 4341, 4342, 4343, 4349, 4350, 4351, 4357,
+	4359, 4361, 4363, 4365, 4367, 4369, 4371, 4377,
+	4379, 4381, 4383, 4385, 4387, 4389, 4393, 4395,
+	4397, 4403, 4405, 4407, 4413, 4415, 4417, 4421,
+	4423, 4424, 4430, 4432, 4434, 4437, 4444, 4446,
+	4448, 4450, 4452, 4453, 4454, 4456, 4458, 4460,
+	4461, 4467, 4468, 4469, 4475, 4476, 4477, 4483,
+	4497, 4505, 4507, 4509, 4511, 4513, 4515, 4521,
+	4527, 4529, 4531, 4533, 4535, 4537, 4543, 4547,
+	4549, 4555, 4557, 4559, 4565, 4567, 4569, 4571,
+	4577, 4579, 4581, 4587, 4591, 4593, 4599, 4601,
+	4603, 4609, 4611, 4613, 4615, 4621, 4623, 4625,
+	4631, 4634, 4643, 4652, 4658, 4667, 4673, 4688,
+	4694, 4702, 4710, 4718, 4736, 4744, 4762, 4770,
+	4788, 4796, 4814, 4822, 4834, 4842, 4845, 4853,
+	4865, 4873, 4876, 4884, 4896, 4904, 4907, 4915,
+	4927, 4935, 4938, 4941, 4944, 4950, 4956, 4968,
+	4974, 4977, 4986, 4992, 5007, 5013, 5016, 5018,
+	5026, 5041, 5047, 5050, 5056, 5066, 5082, 5085,
+	5092, 5105, 5107, 5115, 5125, 5133, 5143, 5152,
+	5160, 5166, 5174, 5182, 5192, 5200, 5210, 5219,
+	5227, 5233, 5242, 5244, 5258, 5270, 5284, 5296,
+	5310, 5322, 5336, 5346, 5349, 5362, 5375, 5378,
+	5391, 5404, 5414, 5417, 5430, 5443, 5453, 5456,
+	5469, 5482, 5492, 5495, 5501, 5504, 5512, 5520,
+	5523, 5526, 5529, 5535, 5538, 5546, 5554, 5557,
+	5560, 5562, 5570, 5578, 5586, 5594, 5602, 5617,
+	5623, 5626, 5629, 5632, 5634, 5642, 5650, 5658,
+	5670, 5676, 5688, 5694, 5706, 5712, 5727, 5733,
+	5736, 5739, 5742, 5745, 5748, 5754, 5760, 5768,
+	5776, 5788, 5794, 5807, 5809, 5812, 5815, 5818,
+	5831, 5833, 5834, 5837, 5840, 5842, 5854, 5857,
+	5858, 5865, 5872, 5874, 5882, 5894, 5900, 5908,
+	5916, 5928, 5934, 5950, 5953, 5956, 5959, 5962,
+	5964, 5972, 5980, 5988, 6000, 6006, 6022, 6025,
+	6028, 6031, 6033, 6041, 6051, 6057, 6065, 6073,
+	6080, 6114, 6127, 6129, 6132, 6146, 6149, 6190,
+	6199, 6202, 6205, 6211, 6219, 6227, 6236, 6273,
+	6276, 6279, 6285, 6293, 6301, 6314, 6355, 6358,
+	6361, 6367, 6375, 6383, 6398, 6432, 6435, 6438,
+	6441, 6475, 6487, 6499, 6505, 6513, 6521, 6529,
+	6537, 6545, 6553, 6561, 6569, 6577, 6585, 6600,
+	6606, 6619, 6621, 6624, 6627, 6630, 6633, 6636,
+	6639, 6642, 6645, 6647, 6649, 6655, 6657, 6659,
+	6661, 6667, 6669, 6675, 6685, 6687, 6693, 6697,
+	6699, 6701, 6703, 6705, 6711, 6717, 6719, 6721,
+	6727, 6729, 6731, 6733, 6739, 6741, 6743, 6745,
+	6751, 6757, 6759, 6761, 6763, 6769, 6773, 6775,
+	6777, 6783, 6785, 6787, 6789, 6795, 6801, 6803,
+	6805, 6807, 6808, 6814, 6815, 6821, 6823, 6825,
+	6827, 6829, 6835, 6837, 6839, 6841, 6843, 6845,
+	6847, 6849, 6855, 6859, 6861, 6867, 6873, 6879,
+	6880, 6886, 6887, 6893, 6895, 6901, 6907, 6911,
+	6913, 6915, 6917, 6923, 6929, 6935, 6937, 6939,
+	6941, 6947, 6949, 6955, 6963, 6965, 6972, 6980,
+	6982, 6984, 6986, 6988, 6994, 6996, 6998, 7000,
+	7002, 7004, 7006, 7008, 7010, 7012, 7018, 7020,
+	7022, 7028, 7034, 7040, 7042, 7044, 7046, 7052,
+	7058, 7068, 7070, 7072, 7074, 7076, 7082, 7084,
+	7090, 7092, 7098, 7100, 7106, 7108, 7110, 7112,
+	7118, 7124, 7126, 7128, 7134, 7136, 7142, 7144,
+	7146, 7148, 7156, 7158, 7160, 7166, 7168, 7170,
+	7172, 7174, 7176, 7182, 7191, 7197, 7203, 7205,
+	7213, 7221, 7229, 7241, 7247, 7260, 7262, 7265,
+	7268, 7271, 7278, 7280, 7282, 7290, 7298, 7306,
+	7314, 7322, 7335, 7341, 7353, 7359, 7366, 7372,
+	7379, 7386, 7392, 7399, 7411, 7417, 7418, 7419,
+	7420, 7421, 7422, 7425, 7431, 7443, 7446, 7449,
+	7452, 7454, 7462, 7470, 7478, 7486, 7494, 7507,
+	7513, 7519, 7531, 7534, 7537, 7540, 7542, 7550,
+	7558, 7566, 7574, 7582, 7594, 7600, 7616, 7619,
+	7622, 7625, 7628, 7630, 7638, 7646, 7654, 7660,
+	7663, 7665, 7673, 7681, 7689, 7697, 7705, 7717,
+	7723, 7739, 7742, 7745, 7748, 7751, 7753, 7761,
+	7770, 7779, 7782, 7784, 7792, 7804, 7810, 7816,
+	7822, 7823, 7829, 7835, 7841, 7847, 7854, 7857,
+	7863, 7869, 7870, 7876, 7882, 7889, 7895, 7901,
+	7902, 7908, 7914, 7921, 7923, 7931, 7939, 7947,
+	7959, 7965, 7968, 7971, 7973, 7981, 7993, 7999,
+	8011, 8017, 8020, 8023, 8041, 8074, 8126, 8180,
+	8198, 8252, 8270, 8303, 8372, 8441, 8441, 8441,
+	8441, 8453, 8453, 8453, 8453, 8469, 8469, 8486,
+	8489, 8489, 8533, 8536, 8536, 8552, 8555, 8567,
+	8567, 8583, 8586, 8589, 8589, 8589, 8589, 8589,
+	8589, 8589, 8589, 8589, 8589, 8605, 8608, 8608,
+	8608, 8618, 8621, 8633, 8636, 8648, 8651, 8663,
+	8666, 8666, 8666, 8666, 8666, 8679, 8682, 8682,
+	8698, 8701, 8701, 8717, 8720, 8720, 8734, 8737,
+	8750, 8753, 8794, 8803, 8803, 8803, 8803, 8803,
+	8803, 8803, 8803, 8819, 8822, 8822, 8822, 8838,
+	8841, 8841, 8841, 8841, 8841, 8841
+};
+
+static const short _zone_scanner_trans_keys[] = {
+	9, 32, 40, 41, 65, 67, 68, 69,
+	72, 73, 75, 76, 77, 78, 79, 80,
+	82, 83, 84, 85, 90, 97, 99, 100,
+	101, 104, 105, 107, 108, 109, 110, 111,
+	112, 114, 115, 116, 117, 122, 778, 827,
+	1034, 1083, 48, 57, 9, 32, 40, 41,
+	68, 72, 77, 83, 87, 100, 104, 109,
+	115, 119, 1034, 1083, 48, 57, 9, 32,
+	40, 41, 65, 67, 68, 69, 72, 73,
+	75, 76, 77, 78, 79, 80, 82, 83,
+	84, 85, 90, 97, 99, 100, 101, 104,
+	105, 107, 108, 109, 110, 111, 112, 114,
+	115, 116, 117, 122, 1034, 1083, 9, 32,
+	40, 41, 65, 70, 80, 97, 102, 112,
+	2058, 2107, 2314, 2363, 2570, 2619, 9, 32,
+	40, 41, 92, 2058, 2107, 2314, 2363, 2570,
+	2619, -128, 8, 11, 58, 60, 127, 9,
+	32, 40, 41, 778, 827, 1034, 1083, 9,
+	32, 40, 41, 778, 827, 1034, 1083, 10,
+	35, 1034, 896, 1151, 9, 32, 40, 41,
+	92, 1802, 1851, 2058, 2107, 2314, 2363, 2570,
+	2619, -128, 8, 11, 58, 60, 127, 9,
+	32, 40, 41, 92, 1802, 1851, 2058, 2107,
+	2314, 2363, 2570, 2619, -128, 8, 11, 58,
+	60, 127, 778, 1034, 640, 895, 896, 1151,
+	9, 32, 40, 41, 58, 65, 67, 68,
+	69, 72, 73, 75, 76, 77, 78, 79,
+	80, 82, 83, 84, 85, 90, 92, 97,
+	99, 100, 101, 104, 105, 107, 108, 109,
+	110, 111, 112, 114, 115, 116, 117, 122,
+	1802, 1851, 2058, 2107, 2314, 2363, 2570, 2619,
+	-128, 8, 11, 47, 48, 57, 60, 127,
+	9, 32, 40, 41, 68, 72, 77, 83,
+	87, 100, 104, 109, 115, 119, 778, 827,
+	1034, 1083, 48, 57, 9, 32, 40, 41,
+	65, 67, 68, 69, 72, 73, 75, 76,
+	77, 78, 79, 80, 82, 83, 84, 85,
+	90, 97, 99, 100, 101, 104, 105, 107,
+	108, 109, 110, 111, 112, 114, 115, 116,
+	117, 122, 778, 827, 1034, 1083, 65, 68,
+	69, 78, 83, 97, 100, 101, 110, 115,
+	65, 97, 9, 32, 40, 41, 2058, 2107,
+	2314, 2363, 2570, 2619, 777, 778, 800, 808,
+	809, 827, 1033, 1034, 1056, 1064, 1065, 1083,
+	896, 1151, 777, 778, 800, 808, 809, 827,
+	1033, 1034, 1056, 1064, 1065, 1083, 896, 1151,
+	78, 83, 110, 115, 83, 115, 75, 107,
+	69, 101, 89, 121, 9, 32, 40, 41,
+	2058, 2107, 2314, 2363, 2570, 2619, 9, 32,
+	40, 41, 2058, 2107, 2314, 2363, 2570, 2619,
+	82, 114, 84, 116, 9, 32, 40, 41,
+	2058, 2107, 2314, 2363, 2570, 2619, 65, 97,
+	77, 109, 69, 101, 9, 32, 40, 41,
+	2058, 2107, 2314, 2363, 2570, 2619, 89, 121,
+	78, 110, 67, 99, 9, 32, 40, 41,
+	2058, 2107, 2314, 2363, 2570, 2619, 72, 78,
+	83, 104, 110, 115, 67, 99, 73, 105,
+	68, 100, 9, 32, 40, 41, 2058, 2107,
+	2314, 2363, 2570, 2619, 65, 83, 97, 115,
+	77, 109, 69, 101, 9, 32, 40, 41,
+	2058, 2107, 2314, 2363, 2570, 2619, 75, 107,
+	69, 101, 89, 121, 9, 32, 40, 41,
+	2058, 2107, 2314, 2363, 2570, 2619, 9, 32,
+	40, 41, 2058, 2107, 2314, 2363, 2570, 2619,
+	85, 117, 73, 105, 52, 54, 56, 9,
+	32, 40, 41, 2058, 2107, 2314, 2363, 2570,
+	2619, 52, 9, 32, 40, 41, 2058, 2107,
+	2314, 2363, 2570, 2619, 73, 105, 78, 110,
+	70, 102, 79, 111, 9, 32, 40, 41,
+	2058, 2107, 2314, 2363, 2570, 2619, 78, 80,
+	110, 112, 9, 32, 40, 41, 1034, 1083,
+	9, 32, 40, 41, 65, 67, 68, 69,
+	72, 73, 75, 76, 77, 78, 79, 80,
+	82, 83, 84, 85, 90, 97, 99, 100,
+	101, 104, 105, 107, 108, 109, 110, 111,
+	112, 114, 115, 116, 117, 122, 1034, 1083,
+	80, 112, 83, 115, 69, 101, 67, 99,
+	75, 107, 69, 101, 89, 121, 9, 32,
+	40, 41, 2058, 2107, 2314, 2363, 2570, 2619,
+	69, 88, 101, 120, 89, 121, 9, 32,
+	40, 41, 2058, 2107, 2314, 2363, 2570, 2619,
+	9, 32, 40, 41, 2058, 2107, 2314, 2363,
+	2570, 2619, 51, 54, 79, 80, 111, 112,
+	50, 9, 32, 40, 41, 2058, 2107, 2314,
+	2363, 2570, 2619, 52, 9, 32, 40, 41,
+	2058, 2107, 2314, 2363, 2570, 2619, 67, 99,
+	9, 32, 40, 41, 2058, 2107, 2314, 2363,
+	2570, 2619, 9, 32, 40, 41, 2058, 2107,
+	2314, 2363, 2570, 2619, 73, 88, 105, 120,
+	78, 110, 70, 102, 79, 111, 9, 32,
+	40, 41, 2058, 2107, 2314, 2363, 2570, 2619,
+	9, 32, 40, 41, 2058, 2107, 2314, 2363,
+	2570, 2619, 65, 73, 83, 97, 105, 115,
+	80, 112, 84, 116, 82, 114, 9, 32,
+	40, 41, 2058, 2107, 2314, 2363, 2570, 2619,
+	68, 100, 9, 32, 40, 41, 2058, 2107,
+	2314, 2363, 2570, 2619, 9, 32, 40, 41,
+	69, 101, 2058, 2107, 2314, 2363, 2570, 2619,
+	67, 99, 9, 32, 40, 41, 51, 2058,
+	2107, 2314, 2363, 2570, 2619, 9, 32, 40,
+	41, 80, 112, 2058, 2107, 2314, 2363, 2570,
+	2619, 65, 97, 82, 114, 65, 97, 77,
+	109, 9, 32, 40, 41, 2058, 2107, 2314,
+	2363, 2570, 2619, 80, 112, 69, 101, 78,
+	110, 80, 112, 71, 103, 80, 112, 75,
+	107, 69, 101, 89, 121, 9, 32, 40,
+	41, 2058, 2107, 2314, 2363, 2570, 2619, 84,
+	116, 82, 114, 9, 32, 40, 41, 2058,
+	2107, 2314, 2363, 2570, 2619, 80, 82, 84,
+	112, 114, 116, 9, 32, 40, 41, 2058,
+	2107, 2314, 2363, 2570, 2619, 83, 115, 73,
+	105, 71, 103, 9, 32, 40, 41, 2058,
+	2107, 2314, 2363, 2570, 2619, 9, 32, 40,
+	41, 2058, 2107, 2314, 2363, 2570, 2619, 77,
+	79, 80, 82, 83, 109, 111, 112, 114,
+	115, 73, 105, 77, 109, 69, 101, 65,
+	97, 9, 32, 40, 41, 2058, 2107, 2314,
+	2363, 2570, 2619, 65, 97, 9, 32, 40,
+	41, 2058, 2107, 2314, 2363, 2570, 2619, 70,
+	102, 9, 32, 40, 41, 2058, 2107, 2314,
+	2363, 2570, 2619, 86, 118, 9, 32, 40,
+	41, 2058, 2107, 2314, 2363, 2570, 2619, 72,
+	104, 70, 102, 80, 112, 9, 32, 40,
+	41, 2058, 2107, 2314, 2363, 2570, 2619, 76,
+	88, 89, 108, 120, 121, 83, 115, 65,
+	97, 9, 32, 40, 41, 2058, 2107, 2314,
+	2363, 2570, 2619, 84, 116, 9, 32, 40,
+	41, 2058, 2107, 2314, 2363, 2570, 2619, 80,
+	112, 69, 101, 48, 57, 9, 32, 40,
+	41, 2058, 2107, 2314, 2363, 2570, 2619, 48,
+	57, 82, 114, 73, 105, 9, 32, 40,
+	41, 2058, 2107, 2314, 2363, 2570, 2619, 79,
+	111, 78, 110, 69, 101, 77, 109, 68,
+	100, 9, 32, 40, 41, 2058, 2107, 2314,
+	2363, 2570, 2619, 1034, 896, 1151, 9, 32,
+	40, 41, 65, 67, 68, 69, 72, 73,
+	75, 76, 77, 78, 79, 80, 82, 83,
+	84, 85, 90, 97, 99, 100, 101, 104,
+	105, 107, 108, 109, 110, 111, 112, 114,
+	115, 116, 117, 122, 778, 827, 1034, 1083,
+	48, 57, 78, 80, 110, 112, 9, 32,
+	40, 41, 1034, 1083, 9, 32, 40, 41,
+	65, 67, 68, 69, 72, 73, 75, 76,
+	77, 78, 79, 80, 82, 83, 84, 85,
+	90, 97, 99, 100, 101, 104, 105, 107,
+	108, 109, 110, 111, 112, 114, 115, 116,
+	117, 122, 1034, 1083, 48, 57, 9, 32,
+	40, 41, 68, 72, 77, 83, 87, 100,
+	104, 109, 115, 119, 1034, 1083, 48, 57,
+	9, 32, 40, 41, 1034, 1083, 48, 57,
+	68, 72, 77, 83, 87, 100, 104, 109,
+	115, 119, 48, 57, 9, 32, 40, 41,
+	1034, 1083, 48, 57, 1034, 896, 1151, 10,
+	73, 79, 84, 105, 111, 116, 78, 110,
+	67, 99, 76, 108, 85, 117, 68, 100,
+	69, 101, 32, 59, 9, 10, 40, 41,
+	9, 32, 40, 41, 1034, 1083, 9, 32,
+	40, 41, 65, 67, 68, 69, 72, 73,
+	75, 76, 77, 78, 79, 80, 82, 83,
+	84, 85, 90, 97, 99, 100, 101, 104,
+	105, 107, 108, 109, 110, 111, 112, 114,
+	115, 116, 117, 122, 1034, 1083, 48, 57,
+	1034, 896, 1151, 9, 32, 40, 41, 68,
+	72, 77, 83, 87, 100, 104, 109, 115,
+	119, 1034, 1083, 48, 57, 9, 32, 40,
+	41, 65, 67, 68, 69, 72, 73, 75,
+	76, 77, 78, 79, 80, 82, 83, 84,
+	85, 90, 97, 99, 100, 101, 104, 105,
+	107, 108, 109, 110, 111, 112, 114, 115,
+	116, 117, 122, 1034, 1083, 48, 57, 1034,
+	896, 1151, 9, 32, 40, 41, 1034, 1083,
+	48, 57, 68, 72, 77, 83, 87, 100,
+	104, 109, 115, 119, 48, 57, 9, 32,
+	40, 41, 1034, 1083, 48, 57, 1034, 896,
+	1151, 9, 32, 40, 41, 65, 70, 80,
+	97, 102, 112, 2058, 2107, 2314, 2363, 2570,
+	2619, 9, 32, 40, 41, 58, 65, 67,
+	68, 69, 72, 73, 75, 76, 77, 78,
+	79, 80, 82, 83, 84, 85, 90, 92,
+	97, 99, 100, 101, 104, 105, 107, 108,
+	109, 110, 111, 112, 114, 115, 116, 117,
+	122, 2058, 2107, 2314, 2363, 2570, 2619, -128,
+	8, 11, 47, 48, 57, 60, 127, 9,
+	32, 40, 41, 65, 70, 80, 97, 102,
+	112, 1802, 1851, 2058, 2107, 2314, 2363, 2570,
+	2619, 9, 32, 40, 41, 92, 1802, 1851,
+	2058, 2107, 2314, 2363, 2570, 2619, -128, 8,
+	11, 58, 60, 127, 9, 32, 40, 41,
+	65, 67, 68, 69, 72, 73, 75, 76,
+	77, 78, 79, 80, 82, 83, 84, 85,
+	90, 97, 99, 100, 101, 104, 105, 107,
+	108, 109, 110, 111, 112, 114, 115, 116,
+	117, 122, 778, 827, 1034, 1083, 48, 57,
+	778, 1034, 640, 895, 896, 1151, 9, 32,
+	40, 41, 778, 827, 1034, 1083, -128, 8,
+	11, 58, 60, 127, 9, 32, 40, 41,
+	778, 827, 1034, 1083, -128, 8, 11, 58,
+	60, 127, 9, 32, 40, 41, 58, 65,
+	67, 68, 69, 72, 73, 75, 76, 77,
+	78, 79, 80, 82, 83, 84, 85, 90,
+	92, 97, 99, 100, 101, 104, 105, 107,
+	108, 109, 110, 111, 112, 114, 115, 116,
+	117, 122, 1802, 1851, 2058, 2107, 2314, 2363,
+	2570, 2619, -128, 8, 11, 47, 48, 57,
+	60, 127, 9, 32, 40, 41, 65, 68,
+	69, 78, 83, 97, 100, 101, 110, 115,
+	778, 827, 1034, 1083, 9, 32, 40, 41,
+	72, 78, 83, 104, 110, 115, 778, 827,
+	1034, 1083, 9, 32, 40, 41, 85, 117,
+	778, 827, 1034, 1083, 9, 32, 40, 41,
+	73, 105, 778, 827, 1034, 1083, 9, 32,
+	40, 41, 78, 80, 110, 112, 778, 827,
+	1034, 1083, 9, 32, 40, 41, 69, 88,
+	101, 120, 778, 827, 1034, 1083, 9, 32,
+	40, 41, 51, 54, 79, 80, 111, 112,
+	778, 827, 1034, 1083, 9, 32, 40, 41,
+	73, 88, 105, 120, 778, 827, 1034, 1083,
+	9, 32, 40, 41, 65, 73, 83, 97,
+	105, 115, 778, 827, 1034, 1083, 9, 32,
+	40, 41, 80, 112, 778, 827, 1034, 1083,
+	9, 32, 40, 41, 84, 116, 778, 827,
+	1034, 1083, 9, 32, 40, 41, 80, 82,
+	84, 112, 114, 116, 778, 827, 1034, 1083,
+	9, 32, 40, 41, 77, 79, 80, 82,
+	83, 109, 111, 112, 114, 115, 778, 827,
+	1034, 1083, 9, 32, 40, 41, 76, 88,
+	89, 108, 120, 121, 778, 827, 1034, 1083,
+	9, 32, 40, 41, 82, 114, 778, 827,
+	1034, 1083, 9, 32, 40, 41, 79, 111,
+	778, 827, 1034, 1083, 778, 1034, 640, 895,
+	896, 1151, 9, 32, 40, 41, 73, 79,
+	84, 105, 111, 116, 778, 827, 1034, 1083,
+	82, 114, 73, 105, 71, 103, 73, 105,
+	78, 110, 32, 59, 9, 10, 40, 41,
+	84, 116, 76, 108, 32, 59, 9, 10,
+	40, 41, 9, 32, 40, 41, 778, 827,
+	1034, 1083, 9, 32, 40, 41, 68, 72,
+	77, 83, 87, 100, 104, 109, 115, 119,
+	778, 827, 1034, 1083, 48, 57, 9, 32,
+	40, 41, 65, 67, 68, 69, 72, 73,
+	75, 76, 77, 78, 79, 80, 82, 83,
+	84, 85, 90, 97, 99, 100, 101, 104,
+	105, 107, 108, 109, 110, 111, 112, 114,
+	115, 116, 117, 122, 778, 827, 1034, 1083,
+	48, 57, 778, 1034, 640, 895, 896, 1151,
+	9, 32, 40, 41, 65, 70, 80, 97,
+	102, 112, 1802, 1851, 2058, 2107, 2314, 2363,
+	2570, 2619, 9, 32, 40, 41, 58, 65,
+	67, 68, 69, 72, 73, 75, 76, 77,
+	78, 79, 80, 82, 83, 84, 85, 90,
+	92, 97, 99, 100, 101, 104, 105, 107,
+	108, 109, 110, 111, 112, 114, 115, 116,
+	117, 122, 1802, 1851, 2058, 2107, 2314, 2363,
+	2570, 2619, -128, 8, 11, 47, 48, 57,
+	60, 127, 9, 32, 40, 41, 65, 68,
+	69, 78, 83, 97, 100, 101, 110, 115,
+	778, 827, 1034, 1083, 9, 32, 40, 41,
+	72, 78, 83, 104, 110, 115, 778, 827,
+	1034, 1083, 9, 32, 40, 41, 85, 117,
+	778, 827, 1034, 1083, 9, 32, 40, 41,
+	73, 105, 778, 827, 1034, 1083, 9, 32,
+	40, 41, 78, 80, 110, 112, 778, 827,
+	1034, 1083, 9, 32, 40, 41, 69, 88,
+	101, 120, 778, 827, 1034, 1083, 9, 32,
+	40, 41, 51, 54, 79, 80, 111, 112,
+	778, 827, 1034, 1083, 9, 32, 40, 41,
+	73, 88, 105, 120, 778, 827, 1034, 1083,
+	9, 32, 40, 41, 65, 73, 83, 97,
+	105, 115, 778, 827, 1034, 1083, 9, 32,
+	40, 41, 80, 112, 778, 827, 1034, 1083,
+	9, 32, 40, 41, 84, 116, 778, 827,
+	1034, 1083, 9, 32, 40, 41, 80, 82,
+	84, 112, 114, 116, 778, 827, 1034, 1083,
+	9, 32, 40, 41, 77, 79, 80, 82,
+	83, 109, 111, 112, 114, 115, 778, 827,
+	1034, 1083, 9, 32, 40, 41, 76, 88,
+	89, 108, 120, 121, 778, 827, 1034, 1083,
+	9, 32, 40, 41, 82, 114, 778, 827,
+	1034, 1083, 9, 32, 40, 41, 79, 111,
+	778, 827, 1034, 1083, 9, 32, 35, 40,
+	41, 778, 827, 1034, 1083, -128, 8, 11,
+	58, 60, 127, 9, 32, 40, 41, 65,
+	67, 68, 69, 72, 73, 75, 76, 77,
+	78, 79, 80, 82, 83, 84, 85, 90,
+	97, 99, 100, 101, 104, 105, 107, 108,
+	109, 110, 111, 112, 114, 115, 116, 117,
+	122, 778, 827, 1034, 1083, 48, 57, 777,
+	778, 800, 808, 809, 827, 1033, 1034, 1056,
+	1064, 1065, 1083, 896, 1151, 777, 778, 800,
+	808, 809, 827, 1033, 1034, 1056, 1064, 1065,
+	1083, 896, 1151, 777, 778, 800, 808, 809,
+	827, 1033, 1034, 1056, 1064, 1065, 1083, 640,
+	895, 896, 1151, 777, 778, 800, 808, 809,
+	827, 1033, 1034, 1056, 1064, 1065, 1083, 640,
+	895, 896, 1151, 65, 97, 65, 97, 9,
+	32, 40, 41, 2058, 2107, 2314, 2363, 2570,
+	2619, 83, 115, 68, 100, 66, 98, 9,
+	32, 40, 41, 2058, 2107, 2314, 2363, 2570,
+	2619, 76, 108, 9, 32, 40, 41, 2058,
+	2107, 2314, 2363, 2570, 2619, 778, 1034, 640,
+	895, 896, 1151, 9, 32, 40, 41, 778,
+	827, 1034, 1083, -128, 8, 11, 58, 60,
+	127, 9, 32, 40, 41, 778, 827, 1034,
+	1083, -128, 8, 11, 58, 60, 127, 777,
+	778, 800, 808, 809, 827, 1033, 1034, 1056,
+	1064, 1065, 1083, 640, 895, 896, 1151, 777,
+	778, 800, 808, 809, 827, 1033, 1034, 1056,
+	1064, 1065, 1083, 640, 895, 896, 1151, 777,
+	778, 800, 808, 809, 827, 1033, 1034, 1056,
+	1064, 1065, 1083, 640, 895, 896, 1151, 777,
+	778, 800, 808, 809, 827, 1033, 1034, 1056,
+	1064, 1065, 1083, 640, 895, 896, 1151, 1034,
+	896, 1151, 9, 32, 40, 41, 58, 65,
+	67, 68, 69, 72, 73, 75, 76, 77,
+	78, 79, 80, 82, 83, 84, 85, 90,
+	92, 97, 99, 100, 101, 104, 105, 107,
+	108, 109, 110, 111, 112, 114, 115, 116,
+	117, 122, 1802, 1851, 2058, 2107, 2314, 2363,
+	2570, 2619, -128, 8, 11, 47, 48, 57,
+	60, 127, 777, 778, 800, 808, 809, 827,
+	1033, 1034, 1056, 1064, 1065, 1083, 896, 1151,
+	777, 778, 800, 808, 809, 827, 1033, 1034,
+	1056, 1064, 1065, 1083, 896, 1151, 9, 32,
+	40, 41, 65, 68, 69, 78, 83, 97,
+	100, 101, 110, 115, 1034, 1083, 9, 32,
+	40, 41, 72, 78, 83, 104, 110, 115,
+	1034, 1083, 9, 32, 40, 41, 85, 117,
+	1034, 1083, 9, 32, 40, 41, 73, 105,
+	1034, 1083, 9, 32, 40, 41, 78, 80,
+	110, 112, 1034, 1083, 9, 32, 40, 41,
+	69, 88, 101, 120, 1034, 1083, 9, 32,
+	40, 41, 51, 54, 79, 80, 111, 112,
+	1034, 1083, 9, 32, 40, 41, 73, 88,
+	105, 120, 1034, 1083, 9, 32, 40, 41,
+	65, 73, 83, 97, 105, 115, 1034, 1083,
+	9, 32, 40, 41, 80, 112, 1034, 1083,
+	9, 32, 40, 41, 84, 116, 1034, 1083,
+	9, 32, 40, 41, 80, 82, 84, 112,
+	114, 116, 1034, 1083, 9, 32, 40, 41,
+	77, 79, 80, 82, 83, 109, 111, 112,
+	114, 115, 1034, 1083, 9, 32, 40, 41,
+	76, 88, 89, 108, 120, 121, 1034, 1083,
+	9, 32, 40, 41, 82, 114, 1034, 1083,
+	9, 32, 40, 41, 79, 111, 1034, 1083,
+	778, 1034, 640, 895, 896, 1151, 778, 1034,
+	640, 895, 896, 1151, 9, 32, 40, 41,
+	78, 80, 110, 112, 1034, 1083, 778, 1034,
+	640, 895, 896, 1151, 10, 10, 42, 46,
+	64, 92, 95, 45, 57, 65, 90, 97,
+	122, 32, 42, 46, 59, 92, 95, 9,
+	10, 40, 41, 45, 57, 65, 90, 97,
+	122, 32, 42, 45, 59, 92, 95, 9,
+	10, 40, 41, 47, 57, 65, 90, 97,
+	122, 48, 57, 48, 57, 48, 57, 32,
+	42, 46, 59, 92, 95, 9, 10, 40,
+	41, 45, 57, 65, 90, 97, 122, 32,
+	59, 9, 10, 40, 41, 32, 59, 9,
+	10, 40, 41, 34, 92, 33, 58, 60,
+	126, 32, 33, 59, 92, 9, 10, 35,
+	39, 40, 41, 42, 126, 32, 47, 48,
+	57, 58, 126, 48, 57, 48, 57, 32,
+	33, 59, 92, 9, 10, 35, 39, 40,
+	41, 42, 126, 9, 34, 92, 522, 32,
+	126, 32, 59, 9, 10, 40, 41, 32,
+	47, 48, 57, 58, 126, 48, 57, 48,
+	57, 9, 34, 92, 522, 32, 126, 9,
+	32, 40, 41, 1034, 1083, 9, 32, 40,
+	41, 1034, 1083, 48, 57, 9, 32, 40,
+	41, 68, 72, 77, 83, 87, 100, 104,
+	109, 115, 119, 778, 827, 1034, 1083, 48,
+	57, 9, 32, 40, 41, 778, 827, 1034,
+	1083, 10, 9, 32, 40, 41, 778, 827,
+	1034, 1083, 48, 57, 68, 72, 77, 83,
+	87, 100, 104, 109, 115, 119, 48, 57,
+	9, 32, 40, 41, 778, 827, 1034, 1083,
+	48, 57, 1034, 896, 1151, 9, 32, 40,
+	41, 1034, 1083, 9, 32, 40, 41, 42,
+	46, 92, 95, 1034, 1083, 45, 57, 65,
+	90, 97, 122, 42, 46, 92, 95, 45,
+	57, 65, 90, 97, 122, 9, 32, 40,
+	41, 42, 45, 92, 95, 778, 827, 1034,
+	1083, 47, 57, 65, 90, 97, 122, 9,
+	32, 40, 41, 778, 827, 1034, 1083, 10,
+	48, 57, 48, 57, 48, 57, 42, 46,
+	92, 95, 45, 57, 65, 90, 97, 122,
+	9, 32, 40, 41, 778, 827, 1034, 1083,
+	1034, 896, 1151, 9, 32, 40, 41, 1034,
+	1083, 9, 32, 40, 41, 1034, 1083, -128,
+	8, 11, 58, 60, 127, 9, 32, 40,
+	41, 778, 827, 1034, 1083, 9, 32, 40,
+	41, 42, 46, 92, 95, 778, 827, 1034,
+	1083, 45, 57, 65, 90, 97, 122, 42,
+	46, 92, 95, 45, 57, 65, 90, 97,
+	122, 9, 32, 40, 41, 42, 45, 92,
+	95, 778, 827, 1034, 1083, 47, 57, 65,
+	90, 97, 122, 9, 32, 40, 41, 778,
+	827, 1034, 1083, 10, 48, 57, 48, 57,
+	48, 57, 42, 46, 92, 95, 45, 57,
+	65, 90, 97, 122, 9, 32, 40, 41,
+	778, 827, 1034, 1083, 778, 1034, 640, 895,
+	896, 1151, 9, 32, 40, 41, 42, 46,
+	92, 95, 1034, 1083, 45, 57, 65, 90,
+	97, 122, 1034, 896, 1151, 1034, 896, 1151,
+	43, 47, 57, 65, 90, 97, 122, 43,
+	47, 57, 65, 90, 97, 122, 43, 61,
+	47, 57, 65, 90, 97, 122, 43, 61,
+	47, 57, 65, 90, 97, 122, 9, 32,
+	40, 41, 43, 2058, 2107, 2314, 2363, 2570,
+	2619, 47, 57, 65, 90, 97, 122, 1034,
+	896, 1151, 61, 9, 32, 40, 41, 2058,
+	2107, 2314, 2363, 2570, 2619, 9, 32, 40,
+	41, 65, 67, 68, 69, 72, 73, 75,
+	76, 77, 78, 79, 80, 82, 83, 84,
+	85, 90, 97, 99, 100, 101, 104, 105,
+	107, 108, 109, 110, 111, 112, 114, 115,
+	116, 117, 122, 2058, 2107, 2314, 2363, 2570,
+	2619, 9, 32, 40, 41, 65, 70, 80,
+	97, 102, 112, 2058, 2107, 2314, 2363, 2570,
+	2619, 65, 97, 65, 97, 9, 32, 40,
+	41, 2058, 2107, 2314, 2363, 2570, 2619, 1034,
+	896, 1151, 65, 68, 69, 78, 83, 97,
+	100, 101, 110, 115, 65, 97, 9, 32,
+	40, 41, 2058, 2107, 2314, 2363, 2570, 2619,
+	78, 83, 110, 115, 83, 115, 75, 107,
+	69, 101, 89, 121, 9, 32, 40, 41,
+	2058, 2107, 2314, 2363, 2570, 2619, 9, 32,
+	40, 41, 2058, 2107, 2314, 2363, 2570, 2619,
+	82, 114, 84, 116, 9, 32, 40, 41,
+	2058, 2107, 2314, 2363, 2570, 2619, 65, 97,
+	77, 109, 69, 101, 9, 32, 40, 41,
+	2058, 2107, 2314, 2363, 2570, 2619, 89, 121,
+	78, 110, 67, 99, 9, 32, 40, 41,
+	2058, 2107, 2314, 2363, 2570, 2619, 72, 78,
+	83, 104, 110, 115, 67, 99, 73, 105,
+	68, 100, 9, 32, 40, 41, 2058, 2107,
+	2314, 2363, 2570, 2619, 65, 83, 97, 115,
+	77, 109, 69, 101, 9, 32, 40, 41,
+	2058, 2107, 2314, 2363, 2570, 2619, 75, 107,
+	69, 101, 89, 121, 9, 32, 40, 41,
+	2058, 2107, 2314, 2363, 2570, 2619, 9, 32,
+	40, 41, 2058, 2107, 2314, 2363, 2570, 2619,
+	85, 117, 73, 105, 52, 54, 56, 9,
+	32, 40, 41, 2058, 2107, 2314, 2363, 2570,
+	2619, 52, 9, 32, 40, 41, 2058, 2107,
+	2314, 2363, 2570, 2619, 73, 105, 78, 110,
+	70, 102, 79, 111, 9, 32, 40, 41,
+	2058, 2107, 2314, 2363, 2570, 2619, 80, 112,
+	83, 115, 69, 101, 67, 99, 75, 107,
+	69, 101, 89, 121, 9, 32, 40, 41,
+	2058, 2107, 2314, 2363, 2570, 2619, 69, 88,
+	101, 120, 89, 121, 9, 32, 40, 41,
+	2058, 2107, 2314, 2363, 2570, 2619, 9, 32,
+	40, 41, 2058, 2107, 2314, 2363, 2570, 2619,
+	51, 54, 79, 80, 111, 112, 50, 9,
+	32, 40, 41, 2058, 2107, 2314, 2363, 2570,
+	2619, 52, 9, 32, 40, 41, 2058, 2107,
+	2314, 2363, 2570, 2619, 67, 99, 9, 32,
+	40, 41, 2058, 2107, 2314, 2363, 2570, 2619,
+	9, 32, 40, 41, 2058, 2107, 2314, 2363,
+	2570, 2619, 73, 88, 105, 120, 78, 110,
+	70, 102, 79, 111, 9, 32, 40, 41,
+	2058, 2107, 2314, 2363, 2570, 2619, 9, 32,
+	40, 41, 2058, 2107, 2314, 2363, 2570, 2619,
+	65, 73, 83, 97, 105, 115, 80, 112,
+	84, 116, 82, 114, 9, 32, 40, 41,
+	2058, 2107, 2314, 2363, 2570, 2619, 68, 100,
+	9, 32, 40, 41, 2058, 2107, 2314, 2363,
+	2570, 2619, 9, 32, 40, 41, 69, 101,
+	2058, 2107, 2314, 2363, 2570, 2619, 67, 99,
+	9, 32, 40, 41, 51, 2058, 2107, 2314,
+	2363, 2570, 2619, 9, 32, 40, 41, 80,
+	112, 2058, 2107, 2314, 2363, 2570, 2619, 65,
+	97, 82, 114, 65, 97, 77, 109, 9,
+	32, 40, 41, 2058, 2107, 2314, 2363, 2570,
+	2619, 80, 112, 69, 101, 78, 110, 80,
+	112, 71, 103, 80, 112, 75, 107, 69,
+	101, 89, 121, 9, 32, 40, 41, 2058,
+	2107, 2314, 2363, 2570, 2619, 84, 116, 82,
+	114, 9, 32, 40, 41, 2058, 2107, 2314,
+	2363, 2570, 2619, 80, 82, 84, 112, 114,
+	116, 9, 32, 40, 41, 2058, 2107, 2314,
+	2363, 2570, 2619, 83, 115, 73, 105, 71,
+	103, 9, 32, 40, 41, 2058, 2107, 2314,
+	2363, 2570, 2619, 9, 32, 40, 41, 2058,
+	2107, 2314, 2363, 2570, 2619, 77, 79, 80,
+	82, 83, 109, 111, 112, 114, 115, 73,
+	105, 77, 109, 69, 101, 65, 97, 9,
+	32, 40, 41, 2058, 2107, 2314, 2363, 2570,
+	2619, 65, 97, 9, 32, 40, 41, 2058,
+	2107, 2314, 2363, 2570, 2619, 70, 102, 9,
+	32, 40, 41, 2058, 2107, 2314, 2363, 2570,
+	2619, 86, 118, 9, 32, 40, 41, 2058,
+	2107, 2314, 2363, 2570, 2619, 72, 104, 70,
+	102, 80, 112, 9, 32, 40, 41, 2058,
+	2107, 2314, 2363, 2570, 2619, 76, 88, 89,
+	108, 120, 121, 83, 115, 65, 97, 9,
+	32, 40, 41, 2058, 2107, 2314, 2363, 2570,
+	2619, 84, 116, 9, 32, 40, 41, 2058,
+	2107, 2314, 2363, 2570, 2619, 80, 112, 69,
+	101, 48, 57, 9, 32, 40, 41, 2058,
+	2107, 2314, 2363, 2570, 2619, 48, 57, 82,
+	114, 73, 105, 9, 32, 40, 41, 2058,
+	2107, 2314, 2363, 2570, 2619, 79, 111, 78,
+	110, 69, 101, 77, 109, 68, 100, 9,
+	32, 40, 41, 2058, 2107, 2314, 2363, 2570,
+	2619, 83, 115, 68, 100, 66, 98, 9,
+	32, 40, 41, 2058, 2107, 2314, 2363, 2570,
+	2619, 76, 108, 9, 32, 40, 41, 2058,
+	2107, 2314, 2363, 2570, 2619, 9, 32, 40,
+	41, 1034, 1083, 9, 32, 40, 41, 1034,
+	1083, 48, 57, 9, 32, 40, 41, 1034,
+	1083, 48, 57, 9, 32, 40, 41, 1034,
+	1083, 48, 57, 65, 70, 97, 102, 48,
+	57, 65, 70, 97, 102, 9, 32, 40,
+	41, 2058, 2107, 2314, 2363, 2570, 2619, 48,
+	57, 65, 70, 97, 102, 1034, 896, 1151,
+	1034, 896, 1151, 1034, 896, 1151, 9, 32,
+	40, 41, 1034, 1083, 9, 32, 40, 41,
+	48, 1034, 1083, 49, 57, 9, 32, 40,
+	41, 778, 827, 1034, 1083, 48, 57, 9,
+	32, 40, 41, 1034, 1083, 48, 57, 65,
+	70, 97, 102, 48, 57, 65, 70, 97,
+	102, 9, 32, 40, 41, 2058, 2107, 2314,
+	2363, 2570, 2619, 48, 57, 65, 70, 97,
+	102, 1034, 896, 1151, 1034, 896, 1151, 9,
+	32, 40, 41, 1034, 1083, 48, 57, 1034,
+	896, 1151, 68, 69, 73, 80, 82, 100,
+	101, 105, 112, 114, 48, 57, 32, 59,
+	9, 10, 40, 41, 48, 57, 72, 83,
+	104, 115, 32, 59, 9, 10, 40, 41,
+	65, 97, 32, 45, 59, 9, 10, 40,
+	41, 78, 110, 83, 115, 69, 101, 67,
+	99, 51, 45, 83, 115, 72, 104, 65,
+	97, 49, 32, 59, 9, 10, 40, 41,
+	67, 68, 99, 100, 67, 68, 99, 100,
+	45, 71, 103, 79, 111, 83, 115, 84,
+	116, 32, 59, 9, 10, 40, 41, 83,
+	115, 65, 97, 80, 112, 50, 51, 53,
+	54, 83, 115, 72, 104, 65, 97, 50,
+	53, 54, 32, 59, 9, 10, 40, 41,
+	56, 52, 83, 115, 72, 104, 65, 97,
+	51, 56, 52, 32, 59, 9, 10, 40,
+	41, 50, 52, 53, 53, 49, 57, 32,
+	59, 9, 10, 40, 41, 52, 56, 32,
+	59, 9, 10, 40, 41, 78, 110, 68,
+	100, 73, 105, 82, 114, 69, 101, 67,
+	99, 84, 116, 32, 59, 9, 10, 40,
+	41, 82, 114, 73, 105, 86, 118, 65,
+	97, 84, 116, 69, 101, 68, 79, 100,
+	111, 78, 110, 83, 115, 32, 59, 9,
+	10, 40, 41, 73, 105, 68, 100, 32,
+	59, 9, 10, 40, 41, 83, 115, 65,
+	97, 77, 83, 109, 115, 68, 100, 53,
+	32, 59, 9, 10, 40, 41, 72, 104,
+	65, 97, 49, 50, 53, 32, 45, 59,
+	9, 10, 40, 41, 78, 110, 83, 115,
+	69, 101, 67, 99, 51, 45, 83, 115,
+	72, 104, 65, 97, 49, 32, 59, 9,
+	10, 40, 41, 53, 54, 32, 59, 9,
+	10, 40, 41, 49, 50, 32, 59, 9,
+	10, 40, 41, 65, 73, 79, 80, 83,
+	85, 97, 105, 111, 112, 115, 117, 48,
+	57, 32, 59, 9, 10, 40, 41, 48,
+	57, 67, 99, 80, 112, 75, 107, 73,
+	105, 88, 120, 32, 59, 9, 10, 40,
+	41, 65, 80, 83, 97, 112, 115, 67,
+	99, 80, 112, 75, 107, 73, 105, 88,
+	120, 32, 59, 9, 10, 40, 41, 71,
+	75, 103, 107, 80, 112, 32, 59, 9,
+	10, 40, 41, 73, 105, 88, 120, 32,
+	59, 9, 10, 40, 41, 80, 112, 75,
+	107, 73, 105, 32, 59, 9, 10, 40,
+	41, 73, 105, 68, 100, 32, 59, 9,
+	10, 40, 41, 71, 75, 103, 107, 80,
+	112, 32, 59, 9, 10, 40, 41, 73,
+	105, 88, 120, 32, 59, 9, 10, 40,
+	41, 80, 112, 75, 107, 73, 105, 32,
+	59, 9, 10, 40, 41, 82, 114, 73,
+	105, 32, 59, 9, 10, 40, 41, 46,
+	48, 57, 32, 46, 59, 9, 10, 40,
+	41, 48, 57, 42, 92, 95, 45, 57,
+	64, 90, 97, 122, 32, 59, 9, 10,
+	40, 41, 42, 92, 95, 45, 57, 64,
+	90, 97, 122, 9, 32, 40, 41, 1034,
+	1083, 9, 32, 40, 41, 42, 92, 95,
+	1034, 1083, 45, 57, 64, 90, 97, 122,
+	9, 32, 40, 41, 1034, 1083, 9, 32,
+	40, 41, 1034, 1083, 48, 57, 9, 32,
+	40, 41, 1034, 1083, 48, 57, 9, 32,
+	40, 41, 1034, 1083, 48, 57, 9, 32,
+	40, 41, 68, 72, 77, 83, 87, 100,
+	104, 109, 115, 119, 1034, 1083, 48, 57,
+	9, 32, 40, 41, 1034, 1083, 48, 57,
+	9, 32, 40, 41, 68, 72, 77, 83,
+	87, 100, 104, 109, 115, 119, 1034, 1083,
+	48, 57, 9, 32, 40, 41, 1034, 1083,
+	48, 57, 9, 32, 40, 41, 68, 72,
+	77, 83, 87, 100, 104, 109, 115, 119,
+	1034, 1083, 48, 57, 9, 32, 40, 41,
+	1034, 1083, 48, 57, 32, 59, 68, 72,
+	77, 83, 87, 100, 104, 109, 115, 119,
+	9, 10, 40, 41, 48, 57, 32, 59,
+	9, 10, 40, 41, 48, 57, 68, 72,
+	77, 83, 87, 100, 104, 109, 115, 119,
+	48, 57, 32, 59, 9, 10, 40, 41,
+	48, 57, 1034, 896, 1151, 9, 32, 40,
+	41, 1034, 1083, 48, 57, 68, 72, 77,
+	83, 87, 100, 104, 109, 115, 119, 48,
+	57, 9, 32, 40, 41, 1034, 1083, 48,
+	57, 1034, 896, 1151, 9, 32, 40, 41,
+	1034, 1083, 48, 57, 68, 72, 77, 83,
+	87, 100, 104, 109, 115, 119, 48, 57,
+	9, 32, 40, 41, 1034, 1083, 48, 57,
+	1034, 896, 1151, 9, 32, 40, 41, 1034,
+	1083, 48, 57, 68, 72, 77, 83, 87,
+	100, 104, 109, 115, 119, 48, 57, 9,
+	32, 40, 41, 1034, 1083, 48, 57, 1034,
+	896, 1151, 1034, 896, 1151, 1034, 896, 1151,
+	32, 59, 9, 10, 40, 41, 9, 32,
+	40, 41, 1034, 1083, 9, 32, 40, 41,
+	1034, 1083, -128, 8, 11, 58, 60, 127,
+	32, 59, 9, 10, 40, 41, 1034, 896,
+	1151, 42, 92, 95, 45, 57, 64, 90,
+	97, 122, 9, 32, 40, 41, 1034, 1083,
+	9, 32, 40, 41, 42, 92, 95, 1034,
+	1083, 45, 57, 64, 90, 97, 122, 32,
+	59, 9, 10, 40, 41, 1034, 896, 1151,
+	48, 57, 9, 32, 40, 41, 1034, 1083,
+	48, 57, 9, 32, 40, 41, 42, 92,
+	95, 1034, 1083, 45, 57, 64, 90, 97,
+	122, 32, 59, 9, 10, 40, 41, 1034,
+	896, 1151, 32, 59, 9, 10, 40, 41,
+	9, 32, 40, 41, 2058, 2107, 2314, 2363,
+	2570, 2619, 9, 32, 40, 41, 2058, 2107,
+	2314, 2363, 2570, 2619, -128, 8, 11, 58,
+	60, 127, 1034, 896, 1151, 46, 48, 58,
+	65, 70, 97, 102, 32, 46, 59, 9,
+	10, 40, 41, 48, 58, 65, 70, 97,
+	102, 48, 57, 9, 32, 40, 41, 1034,
+	1083, 48, 57, 9, 32, 40, 41, 78,
+	83, 1034, 1083, 48, 57, 9, 32, 40,
+	41, 1034, 1083, 48, 57, 9, 32, 40,
+	41, 78, 83, 1034, 1083, 48, 57, 9,
+	32, 40, 41, 46, 1034, 1083, 48, 57,
+	9, 32, 40, 41, 78, 83, 1034, 1083,
+	9, 32, 40, 41, 1034, 1083, 9, 32,
+	40, 41, 1034, 1083, 48, 57, 9, 32,
+	40, 41, 1034, 1083, 48, 57, 9, 32,
+	40, 41, 69, 87, 1034, 1083, 48, 57,
+	9, 32, 40, 41, 1034, 1083, 48, 57,
+	9, 32, 40, 41, 69, 87, 1034, 1083,
+	48, 57, 9, 32, 40, 41, 46, 1034,
+	1083, 48, 57, 9, 32, 40, 41, 69,
+	87, 1034, 1083, 9, 32, 40, 41, 1034,
+	1083, 9, 32, 40, 41, 45, 1034, 1083,
+	48, 57, 48, 57, 9, 32, 40, 41,
+	46, 109, 2058, 2107, 2314, 2363, 2570, 2619,
+	48, 57, 9, 32, 40, 41, 2058, 2107,
+	2314, 2363, 2570, 2619, 48, 57, 9, 32,
+	40, 41, 46, 109, 2058, 2107, 2314, 2363,
+	2570, 2619, 48, 57, 9, 32, 40, 41,
+	2058, 2107, 2314, 2363, 2570, 2619, 48, 57,
+	9, 32, 40, 41, 46, 109, 2058, 2107,
+	2314, 2363, 2570, 2619, 48, 57, 9, 32,
+	40, 41, 2058, 2107, 2314, 2363, 2570, 2619,
+	48, 57, 9, 32, 40, 41, 46, 109,
+	2058, 2107, 2314, 2363, 2570, 2619, 48, 57,
+	9, 32, 40, 41, 2058, 2107, 2314, 2363,
+	2570, 2619, 1034, 896, 1151, 9, 32, 40,
+	41, 109, 2058, 2107, 2314, 2363, 2570, 2619,
+	48, 57, 9, 32, 40, 41, 109, 2058,
+	2107, 2314, 2363, 2570, 2619, 48, 57, 1034,
+	896, 1151, 9, 32, 40, 41, 109, 2058,
+	2107, 2314, 2363, 2570, 2619, 48, 57, 9,
+	32, 40, 41, 109, 2058, 2107, 2314, 2363,
+	2570, 2619, 48, 57, 9, 32, 40, 41,
+	2058, 2107, 2314, 2363, 2570, 2619, 1034, 896,
+	1151, 9, 32, 40, 41, 109, 2058, 2107,
+	2314, 2363, 2570, 2619, 48, 57, 9, 32,
+	40, 41, 109, 2058, 2107, 2314, 2363, 2570,
+	2619, 48, 57, 9, 32, 40, 41, 2058,
+	2107, 2314, 2363, 2570, 2619, 1034, 896, 1151,
+	9, 32, 40, 41, 109, 2058, 2107, 2314,
+	2363, 2570, 2619, 48, 57, 9, 32, 40,
+	41, 109, 2058, 2107, 2314, 2363, 2570, 2619,
+	48, 57, 9, 32, 40, 41, 2058, 2107,
+	2314, 2363, 2570, 2619, 1034, 896, 1151, 9,
+	32, 40, 41, 1034, 1083, 1034, 896, 1151,
+	9, 32, 40, 41, 1034, 1083, 48, 57,
+	9, 32, 40, 41, 1034, 1083, 48, 57,
+	1034, 896, 1151, 1034, 896, 1151, 1034, 896,
+	1151, 9, 32, 40, 41, 1034, 1083, 1034,
+	896, 1151, 9, 32, 40, 41, 1034, 1083,
+	48, 57, 9, 32, 40, 41, 1034, 1083,
+	48, 57, 1034, 896, 1151, 1034, 896, 1151,
+	48, 57, 9, 32, 40, 41, 1034, 1083,
+	48, 57, 9, 32, 40, 41, 1034, 1083,
+	48, 57, 9, 32, 40, 41, 1034, 1083,
+	48, 57, 9, 32, 40, 41, 1034, 1083,
+	48, 57, 9, 32, 40, 41, 1034, 1083,
+	48, 57, 9, 32, 40, 41, 42, 92,
+	95, 1034, 1083, 45, 57, 64, 90, 97,
+	122, 32, 59, 9, 10, 40, 41, 1034,
+	896, 1151, 1034, 896, 1151, 1034, 896, 1151,
+	48, 57, 9, 32, 40, 41, 1034, 1083,
+	48, 57, 9, 32, 40, 41, 1034, 1083,
+	48, 57, 9, 32, 40, 41, 1034, 1083,
+	48, 57, 9, 32, 40, 41, 1034, 1083,
+	-128, 8, 11, 58, 60, 127, 9, 32,
+	40, 41, 1034, 1083, 9, 32, 40, 41,
+	1034, 1083, -128, 8, 11, 58, 60, 127,
+	9, 32, 40, 41, 1034, 1083, 9, 32,
+	40, 41, 1034, 1083, -128, 8, 11, 58,
+	60, 127, 9, 32, 40, 41, 1034, 1083,
+	9, 32, 40, 41, 42, 92, 95, 1034,
+	1083, 45, 57, 64, 90, 97, 122, 32,
+	59, 9, 10, 40, 41, 1034, 896, 1151,
+	1034, 896, 1151, 1034, 896, 1151, 1034, 896,
+	1151, 1034, 896, 1151, 48, 57, 65, 90,
+	97, 122, 9, 32, 40, 41, 1034, 1083,
+	9, 32, 40, 41, 1034, 1083, 48, 57,
+	9, 32, 40, 41, 1034, 1083, 48, 57,
+	9, 32, 40, 41, 1034, 1083, 48, 57,
+	65, 90, 97, 122, 9, 32, 40, 41,
+	1034, 1083, 9, 32, 40, 41, 43, 1034,
+	1083, 47, 57, 65, 90, 97, 122, 1546,
+	1595, 1034, 896, 1151, 1034, 896, 1151, 1034,
+	896, 1151, 9, 32, 33, 40, 41, 49,
+	50, 2058, 2107, 2314, 2363, 2570, 2619, 49,
+	50, 58, 46, 48, 57, 47, 46, 57,
+	48, 57, 9, 32, 40, 41, 2058, 2107,
+	2314, 2363, 2570, 2619, 48, 57, 1034, 896,
+	1151, 58, 46, 48, 58, 65, 70, 97,
+	102, 47, 46, 58, 65, 70, 97, 102,
+	48, 57, 9, 32, 40, 41, 1034, 1083,
+	48, 57, 9, 32, 40, 41, 1034, 1083,
+	48, 57, 65, 90, 97, 122, 9, 32,
+	40, 41, 1034, 1083, 9, 32, 40, 41,
+	1034, 1083, 48, 57, 9, 32, 40, 41,
+	1034, 1083, 48, 57, 9, 32, 40, 41,
+	1034, 1083, 48, 57, 65, 70, 97, 102,
+	48, 57, 65, 70, 97, 102, 9, 32,
+	40, 41, 2058, 2107, 2314, 2363, 2570, 2619,
+	48, 57, 65, 70, 97, 102, 1034, 896,
+	1151, 1034, 896, 1151, 1034, 896, 1151, 1034,
+	896, 1151, 48, 57, 9, 32, 40, 41,
+	1034, 1083, 48, 57, 9, 32, 40, 41,
+	1034, 1083, 48, 57, 9, 32, 40, 41,
+	1034, 1083, 48, 57, 9, 32, 40, 41,
+	1034, 1083, 48, 57, 65, 70, 97, 102,
+	48, 57, 65, 70, 97, 102, 9, 32,
+	40, 41, 2058, 2107, 2314, 2363, 2570, 2619,
+	48, 57, 65, 70, 97, 102, 1034, 896,
+	1151, 1034, 896, 1151, 1034, 896, 1151, 48,
+	57, 9, 32, 40, 41, 1034, 1083, 48,
+	57, 9, 32, 40, 41, 48, 49, 50,
+	51, 1034, 1083, 9, 32, 40, 41, 1034,
+	1083, 9, 32, 40, 41, 1034, 1083, 48,
+	57, 9, 32, 40, 41, 1034, 1083, 48,
+	57, 9, 32, 40, 41, 46, 1034, 1083,
+	6153, 6176, 6184, 6185, 6409, 6432, 6440, 6441,
+	6665, 6688, 6696, 6697, 9482, 9531, 9738, 9787,
+	10250, 10299, 10506, 10555, 10762, 10811, 11274, 11323,
+	11530, 11579, 11786, 11835, 12298, 12347, 12554, 12603,
+	12810, 12859, 3081, 3104, 3112, 3113, 3115, 4106,
+	4155, 3119, 3129, 3137, 3162, 3169, 3194, 1546,
+	1595, 4106, 3968, 4223, 4617, 4640, 4648, 4649,
+	13578, 13627, 13834, 13883, 14346, 14395, 14602, 14651,
+	14858, 14907, 5642, 5504, 5759, 3115, 6153, 6176,
+	6184, 6185, 6409, 6432, 6440, 6441, 6665, 6688,
+	6696, 6697, 9482, 9531, 9738, 9787, 10250, 10299,
+	10506, 10555, 10762, 10811, 11274, 11323, 11530, 11579,
+	11786, 11835, 12298, 12347, 12554, 12603, 12810, 12859,
+	3119, 3129, 3137, 3162, 3169, 3194, 7690, 8202,
+	8714, 7552, 7807, 8064, 8319, 8576, 8831, 1034,
+	896, 1151, 1034, 896, 1151, 9, 32, 40,
+	41, 1034, 1083, 9, 32, 40, 41, 1034,
+	1083, 48, 57, 9, 32, 40, 41, 1034,
+	1083, 48, 57, 9, 32, 40, 41, 46,
+	1034, 1083, 48, 57, 46, 6153, 6176, 6184,
+	6185, 6409, 6432, 6440, 6441, 6665, 6688, 6696,
+	6697, 9482, 9531, 9738, 9787, 10250, 10299, 10506,
+	10555, 10762, 10811, 11274, 11323, 11530, 11579, 11786,
+	11835, 12298, 12347, 12554, 12603, 12810, 12859, 48,
+	57, 1034, 896, 1151, 1034, 896, 1151, 9,
+	32, 40, 41, 1034, 1083, 9, 32, 40,
+	41, 1034, 1083, 48, 57, 9, 32, 40,
+	41, 1034, 1083, 48, 57, 9, 32, 40,
+	41, 46, 1034, 1083, 48, 58, 65, 70,
+	97, 102, 46, 6153, 6176, 6184, 6185, 6409,
+	6432, 6440, 6441, 6665, 6688, 6696, 6697, 9482,
+	9531, 9738, 9787, 10250, 10299, 10506, 10555, 10762,
+	10811, 11274, 11323, 11530, 11579, 11786, 11835, 12298,
+	12347, 12554, 12603, 12810, 12859, 48, 58, 65,
+	70, 97, 102, 1034, 896, 1151, 1034, 896,
+	1151, 9, 32, 40, 41, 1034, 1083, 9,
+	32, 40, 41, 1034, 1083, 48, 57, 9,
+	32, 40, 41, 1034, 1083, 48, 57, 9,
+	32, 40, 41, 42, 92, 95, 1034, 1083,
+	45, 57, 64, 90, 97, 122, 6153, 6176,
+	6184, 6185, 6409, 6432, 6440, 6441, 6665, 6688,
+	6696, 6697, 9482, 9531, 9738, 9787, 10250, 10299,
+	10506, 10555, 10762, 10811, 11274, 11323, 11530, 11579,
+	11786, 11835, 12298, 12347, 12554, 12603, 12810, 12859,
+	1034, 896, 1151, 1034, 896, 1151, 1034, 896,
+	1151, 65, 67, 68, 69, 72, 73, 75,
+	76, 77, 78, 79, 80, 82, 83, 84,
+	85, 90, 97, 99, 100, 101, 104, 105,
+	107, 108, 109, 110, 111, 112, 114, 115,
+	116, 117, 122, 9, 32, 40, 41, 65,
+	70, 80, 97, 102, 112, 1034, 1083, 9,
+	32, 40, 41, 1034, 1083, 48, 57, 65,
+	90, 97, 122, 9, 32, 40, 41, 1034,
+	1083, 9, 32, 40, 41, 1034, 1083, 48,
+	57, 9, 32, 40, 41, 1034, 1083, 48,
+	57, 9, 32, 40, 41, 1034, 1083, 48,
+	57, 9, 32, 40, 41, 1034, 1083, 48,
+	57, 9, 32, 40, 41, 1034, 1083, 48,
+	57, 9, 32, 40, 41, 1034, 1083, 48,
+	57, 9, 32, 40, 41, 1034, 1083, 48,
+	57, 9, 32, 40, 41, 1034, 1083, 48,
+	57, 9, 32, 40, 41, 1034, 1083, 48,
+	57, 9, 32, 40, 41, 1034, 1083, 48,
+	57, 9, 32, 40, 41, 42, 92, 95,
+	1034, 1083, 45, 57, 64, 90, 97, 122,
+	9, 32, 40, 41, 1034, 1083, 9, 32,
+	40, 41, 43, 1034, 1083, 47, 57, 65,
+	90, 97, 122, 1546, 1595, 1034, 896, 1151,
+	1034, 896, 1151, 1034, 896, 1151, 1034, 896,
+	1151, 1034, 896, 1151, 1034, 896, 1151, 1034,
+	896, 1151, 1034, 896, 1151, 65, 97, 65,
+	97, 9, 32, 40, 41, 1034, 1083, 83,
+	115, 68, 100, 66, 98, 9, 32, 40,
+	41, 1034, 1083, 76, 108, 9, 32, 40,
+	41, 1034, 1083, 65, 68, 69, 78, 83,
+	97, 100, 101, 110, 115, 65, 97, 9,
+	32, 40, 41, 1034, 1083, 78, 83, 110,
+	115, 83, 115, 75, 107, 69, 101, 89,
+	121, 9, 32, 40, 41, 1034, 1083, 9,
+	32, 40, 41, 1034, 1083, 82, 114, 84,
+	116, 9, 32, 40, 41, 1034, 1083, 65,
+	97, 77, 109, 69, 101, 9, 32, 40,
+	41, 1034, 1083, 89, 121, 78, 110, 67,
+	99, 9, 32, 40, 41, 1034, 1083, 72,
+	78, 83, 104, 110, 115, 67, 99, 73,
+	105, 68, 100, 9, 32, 40, 41, 1034,
+	1083, 65, 83, 97, 115, 77, 109, 69,
+	101, 9, 32, 40, 41, 1034, 1083, 75,
+	107, 69, 101, 89, 121, 9, 32, 40,
+	41, 1034, 1083, 9, 32, 40, 41, 1034,
+	1083, 85, 117, 73, 105, 52, 54, 56,
+	9, 32, 40, 41, 1034, 1083, 52, 9,
+	32, 40, 41, 1034, 1083, 73, 105, 78,
+	110, 70, 102, 79, 111, 9, 32, 40,
+	41, 1034, 1083, 80, 112, 83, 115, 69,
+	101, 67, 99, 75, 107, 69, 101, 89,
+	121, 9, 32, 40, 41, 1034, 1083, 69,
+	88, 101, 120, 89, 121, 9, 32, 40,
+	41, 1034, 1083, 9, 32, 40, 41, 1034,
+	1083, 51, 54, 79, 80, 111, 112, 50,
+	9, 32, 40, 41, 1034, 1083, 52, 9,
+	32, 40, 41, 1034, 1083, 67, 99, 9,
+	32, 40, 41, 1034, 1083, 9, 32, 40,
+	41, 1034, 1083, 73, 88, 105, 120, 78,
+	110, 70, 102, 79, 111, 9, 32, 40,
+	41, 1034, 1083, 9, 32, 40, 41, 1034,
+	1083, 65, 73, 83, 97, 105, 115, 80,
+	112, 84, 116, 82, 114, 9, 32, 40,
+	41, 1034, 1083, 68, 100, 9, 32, 40,
+	41, 1034, 1083, 9, 32, 40, 41, 69,
+	101, 1034, 1083, 67, 99, 9, 32, 40,
+	41, 51, 1034, 1083, 9, 32, 40, 41,
+	80, 112, 1034, 1083, 65, 97, 82, 114,
+	65, 97, 77, 109, 9, 32, 40, 41,
+	1034, 1083, 80, 112, 69, 101, 78, 110,
+	80, 112, 71, 103, 80, 112, 75, 107,
+	69, 101, 89, 121, 9, 32, 40, 41,
+	1034, 1083, 84, 116, 82, 114, 9, 32,
+	40, 41, 1034, 1083, 80, 82, 84, 112,
+	114, 116, 9, 32, 40, 41, 1034, 1083,
+	83, 115, 73, 105, 71, 103, 9, 32,
+	40, 41, 1034, 1083, 9, 32, 40, 41,
+	1034, 1083, 77, 79, 80, 82, 83, 109,
+	111, 112, 114, 115, 73, 105, 77, 109,
+	69, 101, 65, 97, 9, 32, 40, 41,
+	1034, 1083, 65, 97, 9, 32, 40, 41,
+	1034, 1083, 70, 102, 9, 32, 40, 41,
+	1034, 1083, 86, 118, 9, 32, 40, 41,
+	1034, 1083, 72, 104, 70, 102, 80, 112,
+	9, 32, 40, 41, 1034, 1083, 76, 88,
+	89, 108, 120, 121, 83, 115, 65, 97,
+	9, 32, 40, 41, 1034, 1083, 84, 116,
+	9, 32, 40, 41, 1034, 1083, 80, 112,
+	69, 101, 48, 57, 9, 32, 40, 41,
+	1034, 1083, 48, 57, 82, 114, 73, 105,
+	9, 32, 40, 41, 1034, 1083, 79, 111,
+	78, 110, 69, 101, 77, 109, 68, 100,
+	9, 32, 40, 41, 1034, 1083, 42, 92,
+	95, 45, 57, 64, 90, 97, 122, 32,
+	59, 9, 10, 40, 41, 32, 59, 9,
+	10, 40, 41, 48, 57, 9, 32, 40,
+	41, 1034, 1083, 48, 57, 9, 32, 40,
+	41, 1034, 1083, 48, 57, 9, 32, 40,
+	41, 1034, 1083, 48, 57, 9, 32, 40,
+	41, 1034, 1083, 48, 57, 65, 90, 97,
+	122, 9, 32, 40, 41, 1034, 1083, 9,
+	32, 40, 41, 43, 1034, 1083, 47, 57,
+	65, 90, 97, 122, 1546, 1595, 1034, 896,
+	1151, 1034, 896, 1151, 1034, 896, 1151, 43,
+	47, 57, 65, 90, 97, 122, 1546, 1595,
+	48, 57, 9, 32, 40, 41, 1034, 1083,
+	48, 57, 9, 32, 40, 41, 1034, 1083,
+	48, 57, 9, 32, 40, 41, 1034, 1083,
+	48, 57, 9, 32, 40, 41, 1034, 1083,
+	48, 57, 9, 32, 40, 41, 1034, 1083,
+	48, 57, 9, 32, 40, 41, 45, 1034,
+	1083, 48, 57, 65, 70, 97, 102, 9,
+	32, 40, 41, 1034, 1083, 9, 32, 40,
+	41, 1034, 1083, 48, 57, 65, 86, 97,
+	118, 48, 57, 65, 86, 97, 118, 61,
+	48, 57, 65, 86, 97, 118, 48, 57,
+	65, 86, 97, 118, 61, 48, 57, 65,
+	86, 97, 118, 61, 48, 57, 65, 86,
+	97, 118, 48, 57, 65, 86, 97, 118,
+	61, 48, 57, 65, 86, 97, 118, 32,
+	59, 9, 10, 40, 41, 48, 57, 65,
+	86, 97, 118, 32, 59, 9, 10, 40,
+	41, 61, 61, 61, 61, 61, 1034, 896,
+	1151, 48, 57, 65, 70, 97, 102, 9,
+	32, 40, 41, 1034, 1083, 48, 57, 65,
+	70, 97, 102, 1034, 896, 1151, 1034, 896,
+	1151, 1034, 896, 1151, 48, 57, 9, 32,
+	40, 41, 1034, 1083, 48, 57, 9, 32,
+	40, 41, 1034, 1083, 48, 57, 9, 32,
+	40, 41, 1034, 1083, 48, 57, 9, 32,
+	40, 41, 1034, 1083, 48, 57, 9, 32,
+	40, 41, 1034, 1083, 48, 57, 9, 32,
+	40, 41, 45, 1034, 1083, 48, 57, 65,
+	70, 97, 102, 32, 59, 9, 10, 40,
+	41, 48, 57, 65, 70, 97, 102, 32,
+	59, 9, 10, 40, 41, 48, 57, 65,
+	70, 97, 102, 1034, 896, 1151, 1034, 896,
+	1151, 1034, 896, 1151, 48, 57, 9, 32,
+	40, 41, 1034, 1083, 48, 57, 9, 32,
+	40, 41, 1034, 1083, 48, 57, 9, 32,
+	40, 41, 1034, 1083, 48, 57, 9, 32,
+	40, 41, 1034, 1083, 48, 57, 9, 32,
+	40, 41, 1034, 1083, 48, 57, 9, 32,
+	40, 41, 1034, 1083, 48, 57, 65, 70,
+	97, 102, 48, 57, 65, 70, 97, 102,
+	9, 32, 40, 41, 2058, 2107, 2314, 2363,
+	2570, 2619, 48, 57, 65, 70, 97, 102,
+	1034, 896, 1151, 1034, 896, 1151, 1034, 896,
+	1151, 1034, 896, 1151, 48, 57, 9, 32,
+	40, 41, 1034, 1083, 48, 57, 9, 32,
+	40, 41, 1034, 1083, 48, 57, 32, 59,
+	9, 10, 40, 41, 48, 57, 32, 59,
+	9, 10, 40, 41, 1034, 896, 1151, 48,
+	57, 9, 32, 40, 41, 1034, 1083, 48,
+	57, 9, 32, 40, 41, 1034, 1083, 48,
+	57, 9, 32, 40, 41, 1034, 1083, 48,
+	57, 9, 32, 40, 41, 1034, 1083, 48,
+	57, 9, 32, 40, 41, 1034, 1083, 48,
+	57, 9, 32, 40, 41, 1034, 1083, 48,
+	57, 65, 70, 97, 102, 48, 57, 65,
+	70, 97, 102, 9, 32, 40, 41, 2058,
+	2107, 2314, 2363, 2570, 2619, 48, 57, 65,
+	70, 97, 102, 1034, 896, 1151, 1034, 896,
+	1151, 1034, 896, 1151, 1034, 896, 1151, 48,
+	57, 9, 32, 40, 41, 1034, 1083, 48,
+	57, 9, 32, 40, 41, 46, 1034, 1083,
+	48, 57, 32, 46, 59, 9, 10, 40,
+	41, 48, 57, 1034, 896, 1151, 48, 57,
+	9, 32, 40, 41, 1034, 1083, 48, 57,
+	9, 32, 40, 41, 1034, 1083, 48, 57,
+	65, 70, 97, 102, 48, 57, 65, 70,
+	97, 102, 48, 57, 65, 70, 97, 102,
+	48, 57, 65, 70, 97, 102, 58, 48,
+	57, 65, 70, 97, 102, 48, 57, 65,
+	70, 97, 102, 48, 57, 65, 70, 97,
+	102, 48, 57, 65, 70, 97, 102, 32,
+	58, 59, 9, 10, 40, 41, 1034, 896,
+	1151, 48, 57, 65, 70, 97, 102, 48,
+	57, 65, 70, 97, 102, 45, 48, 57,
+	65, 70, 97, 102, 48, 57, 65, 70,
+	97, 102, 32, 45, 59, 9, 10, 40,
+	41, 48, 57, 65, 70, 97, 102, 48,
+	57, 65, 70, 97, 102, 45, 48, 57,
+	65, 70, 97, 102, 48, 57, 65, 70,
+	97, 102, 32, 45, 59, 9, 10, 40,
+	41, 48, 57, 9, 32, 40, 41, 1034,
+	1083, 48, 57, 9, 32, 40, 41, 1034,
+	1083, 48, 57, 9, 32, 40, 41, 1034,
+	1083, 48, 57, 9, 32, 40, 41, 1034,
+	1083, -128, 8, 11, 58, 60, 127, 32,
+	59, 9, 10, 40, 41, 1034, 896, 1151,
+	1034, 896, 1151, 48, 57, 9, 32, 40,
+	41, 1034, 1083, 48, 57, 9, 32, 40,
+	41, 1034, 1083, -128, 8, 11, 58, 60,
+	127, 9, 32, 40, 41, 1034, 1083, 9,
+	32, 40, 41, 1034, 1083, -128, 8, 11,
+	58, 60, 127, 32, 59, 9, 10, 40,
+	41, 1034, 896, 1151, 1034, 896, 1151, 9,
+	32, 36, 40, 41, 42, 92, 95, 778,
+	827, 1034, 1083, 45, 57, 64, 90, 97,
+	122, 9, 32, 36, 40, 41, 42, 58,
+	92, 95, 1802, 1851, 2058, 2107, 2314, 2363,
+	2570, 2619, -128, 8, 11, 44, 45, 57,
+	60, 63, 64, 90, 91, 96, 97, 122,
+	123, 127, 9, 32, 36, 40, 41, 42,
+	65, 67, 68, 69, 72, 73, 75, 76,
+	77, 78, 79, 80, 82, 83, 84, 85,
+	90, 92, 95, 97, 99, 100, 101, 104,
+	105, 107, 108, 109, 110, 111, 112, 114,
+	115, 116, 117, 122, 778, 827, 1034, 1083,
+	45, 57, 64, 89, 98, 121, 9, 32,
+	36, 40, 41, 42, 65, 67, 68, 69,
+	72, 73, 75, 76, 77, 78, 79, 80,
+	82, 83, 84, 85, 90, 92, 95, 97,
+	99, 100, 101, 104, 105, 107, 108, 109,
+	110, 111, 112, 114, 115, 116, 117, 122,
+	778, 827, 1034, 1083, 45, 47, 48, 57,
+	64, 89, 98, 121, 9, 32, 36, 40,
+	41, 42, 92, 95, 778, 827, 1034, 1083,
+	45, 57, 64, 90, 97, 122, 9, 32,
+	36, 40, 41, 42, 65, 67, 68, 69,
+	72, 73, 75, 76, 77, 78, 79, 80,
+	82, 83, 84, 85, 90, 92, 95, 97,
+	99, 100, 101, 104, 105, 107, 108, 109,
+	110, 111, 112, 114, 115, 116, 117, 122,
+	778, 827, 1034, 1083, 45, 47, 48, 57,
+	64, 89, 98, 121, 9, 32, 36, 40,
+	41, 42, 92, 95, 778, 827, 1034, 1083,
+	45, 57, 64, 90, 97, 122, 9, 32,
+	36, 40, 41, 42, 58, 92, 95, 1802,
+	1851, 2058, 2107, 2314, 2363, 2570, 2619, -128,
+	8, 11, 44, 45, 57, 60, 63, 64,
+	90, 91, 96, 97, 122, 123, 127, 9,
+	32, 36, 40, 41, 42, 58, 65, 67,
+	68, 69, 72, 73, 75, 76, 77, 78,
+	79, 80, 82, 83, 84, 85, 90, 92,
+	95, 97, 99, 100, 101, 104, 105, 107,
+	108, 109, 110, 111, 112, 114, 115, 116,
+	117, 122, 1802, 1851, 2058, 2107, 2314, 2363,
+	2570, 2619, -128, 8, 11, 44, 45, 47,
+	48, 57, 60, 63, 64, 89, 91, 96,
+	98, 121, 123, 127, 9, 32, 36, 40,
+	41, 42, 58, 65, 67, 68, 69, 72,
+	73, 75, 76, 77, 78, 79, 80, 82,
+	83, 84, 85, 90, 92, 95, 97, 99,
+	100, 101, 104, 105, 107, 108, 109, 110,
+	111, 112, 114, 115, 116, 117, 122, 1802,
+	1851, 2058, 2107, 2314, 2363, 2570, 2619, -128,
+	8, 11, 44, 45, 47, 48, 57, 60,
+	63, 64, 89, 91, 96, 98, 121, 123,
+	127, 32, 33, 59, 92, 9, 10, 35,
+	39, 40, 41, 42, 126, 9, 32, 40,
+	41, 42, 46, 92, 95, 1034, 1083, 45,
+	57, 65, 90, 97, 122, 9, 32, 40,
+	41, 43, 2058, 2107, 2314, 2363, 2570, 2619,
+	47, 57, 65, 90, 97, 122, 1034, 896,
+	1151, 9, 32, 40, 41, 65, 67, 68,
+	69, 72, 73, 75, 76, 77, 78, 79,
+	80, 82, 83, 84, 85, 90, 97, 99,
+	100, 101, 104, 105, 107, 108, 109, 110,
+	111, 112, 114, 115, 116, 117, 122, 2058,
+	2107, 2314, 2363, 2570, 2619, 1034, 896, 1151,
+	9, 32, 40, 41, 2058, 2107, 2314, 2363,
+	2570, 2619, 48, 57, 65, 70, 97, 102,
+	1034, 896, 1151, 9, 32, 40, 41, 1034,
+	1083, 48, 57, 65, 70, 97, 102, 9,
+	32, 40, 41, 2058, 2107, 2314, 2363, 2570,
+	2619, 48, 57, 65, 70, 97, 102, 1034,
+	896, 1151, 1034, 896, 1151, 9, 32, 40,
+	41, 2058, 2107, 2314, 2363, 2570, 2619, -128,
+	8, 11, 58, 60, 127, 1034, 896, 1151,
+	9, 32, 40, 41, 2058, 2107, 2314, 2363,
+	2570, 2619, 1034, 896, 1151, 9, 32, 40,
+	41, 2058, 2107, 2314, 2363, 2570, 2619, 48,
+	57, 1034, 896, 1151, 9, 32, 40, 41,
+	2058, 2107, 2314, 2363, 2570, 2619, 48, 57,
+	1034, 896, 1151, 9, 32, 40, 41, 2058,
+	2107, 2314, 2363, 2570, 2619, 48, 57, 1034,
+	896, 1151, 9, 32, 33, 40, 41, 49,
+	50, 2058, 2107, 2314, 2363, 2570, 2619, 1034,
+	896, 1151, 9, 32, 40, 41, 2058, 2107,
+	2314, 2363, 2570, 2619, 48, 57, 65, 70,
+	97, 102, 1034, 896, 1151, 9, 32, 40,
+	41, 2058, 2107, 2314, 2363, 2570, 2619, 48,
+	57, 65, 70, 97, 102, 1034, 896, 1151,
+	4617, 4640, 4648, 4649, 13578, 13627, 13834, 13883,
+	14346, 14395, 14602, 14651, 14858, 14907, 5642, 5504,
+	5759, 3081, 3104, 3112, 3113, 3115, 4106, 4155,
+	3119, 3129, 3137, 3162, 3169, 3194, 4106, 3968,
+	4223, 3115, 6153, 6176, 6184, 6185, 6409, 6432,
+	6440, 6441, 6665, 6688, 6696, 6697, 9482, 9531,
+	9738, 9787, 10250, 10299, 10506, 10555, 10762, 10811,
+	11274, 11323, 11530, 11579, 11786, 11835, 12298, 12347,
+	12554, 12603, 12810, 12859, 3119, 3129, 3137, 3162,
+	3169, 3194, 7690, 8202, 8714, 7552, 7807, 8064,
+	8319, 8576, 8831, 9, 32, 40, 41, 2058,
+	2107, 2314, 2363, 2570, 2619, 48, 57, 65,
+	70, 97, 102, 1034, 896, 1151, 9, 32,
+	40, 41, 2058, 2107, 2314, 2363, 2570, 2619,
+	48, 57, 65, 70, 97, 102, 1034, 896,
+	1151, 0
+};
+
+static const char _zone_scanner_single_lengths[] = {
+	0, 42, 16, 40, 16, 11, 8, 8,
+	1, 1, 1, 13, 13, 2, 48, 18,
+	42, 10, 2, 10, 12, 12, 4, 2,
+	2, 2, 2, 10, 10, 2, 2, 10,
+	2, 2, 2, 10, 2, 2, 2, 10,
+	6, 2, 2, 2, 10, 4, 2, 2,
+	10, 2, 2, 2, 10, 10, 2, 2,
+	2, 1, 10, 1, 10, 2, 2, 2,
+	2, 10, 4, 6, 40, 2, 2, 2,
+	2, 2, 2, 2, 10, 4, 2, 10,
+	10, 6, 1, 10, 1, 10, 2, 10,
+	10, 4, 2, 2, 2, 10, 10, 6,
+	2, 2, 2, 10, 2, 10, 12, 2,
+	11, 12, 2, 2, 2, 2, 10, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	10, 2, 2, 10, 6, 10, 2, 2,
+	2, 10, 10, 10, 2, 2, 2, 2,
+	10, 2, 10, 2, 10, 2, 10, 2,
+	2, 2, 10, 6, 2, 2, 10, 2,
+	10, 2, 2, 0, 10, 2, 2, 10,
+	2, 2, 2, 2, 2, 10, 1, 42,
+	4, 6, 40, 16, 6, 10, 6, 1,
+	1, 6, 2, 2, 2, 2, 2, 2,
+	2, 6, 40, 1, 16, 40, 1, 6,
+	10, 6, 1, 16, 46, 18, 13, 42,
+	2, 8, 8, 48, 18, 14, 10, 10,
+	12, 12, 14, 12, 14, 10, 10, 14,
+	18, 14, 10, 10, 2, 14, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 8,
+	18, 42, 2, 18, 48, 18, 14, 10,
+	10, 12, 12, 14, 12, 14, 10, 10,
+	14, 18, 14, 10, 10, 9, 42, 12,
+	12, 12, 12, 2, 2, 10, 2, 2,
+	2, 10, 2, 10, 2, 8, 8, 12,
+	12, 12, 12, 1, 48, 12, 12, 16,
+	12, 8, 8, 10, 10, 12, 10, 12,
+	8, 8, 12, 16, 12, 8, 8, 2,
+	2, 10, 2, 1, 1, 5, 6, 6,
+	0, 0, 0, 6, 2, 2, 2, 4,
+	0, 0, 0, 4, 4, 2, 0, 0,
+	0, 4, 6, 6, 18, 8, 1, 8,
+	10, 8, 1, 6, 10, 4, 12, 8,
+	1, 0, 0, 0, 4, 8, 1, 6,
+	6, 8, 12, 4, 12, 8, 1, 0,
+	0, 0, 4, 8, 2, 10, 1, 1,
+	1, 1, 2, 2, 11, 1, 1, 10,
+	44, 16, 2, 2, 10, 1, 10, 2,
+	10, 4, 2, 2, 2, 2, 10, 10,
+	2, 2, 10, 2, 2, 2, 10, 2,
+	2, 2, 10, 6, 2, 2, 2, 10,
+	4, 2, 2, 10, 2, 2, 2, 10,
+	10, 2, 2, 2, 1, 10, 1, 10,
+	2, 2, 2, 2, 10, 2, 2, 2,
+	2, 2, 2, 2, 10, 4, 2, 10,
+	10, 6, 1, 10, 1, 10, 2, 10,
+	10, 4, 2, 2, 2, 10, 10, 6,
+	2, 2, 2, 10, 2, 10, 12, 2,
+	11, 12, 2, 2, 2, 2, 10, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	10, 2, 2, 10, 6, 10, 2, 2,
+	2, 10, 10, 10, 2, 2, 2, 2,
+	10, 2, 10, 2, 10, 2, 10, 2,
+	2, 2, 10, 6, 2, 2, 10, 2,
+	10, 2, 2, 0, 10, 2, 2, 10,
+	2, 2, 2, 2, 2, 10, 2, 2,
+	2, 10, 2, 10, 6, 6, 6, 6,
+	0, 10, 1, 1, 1, 6, 7, 8,
+	6, 0, 10, 1, 1, 6, 1, 10,
+	2, 4, 2, 2, 3, 2, 2, 2,
+	2, 1, 1, 2, 2, 2, 1, 2,
+	4, 4, 1, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 1, 1, 2, 2,
+	2, 1, 1, 1, 2, 1, 1, 2,
+	2, 2, 1, 1, 1, 2, 2, 1,
+	1, 1, 1, 2, 1, 1, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 4, 2, 2,
+	2, 2, 2, 2, 2, 2, 4, 2,
+	1, 2, 2, 2, 3, 3, 2, 2,
+	2, 2, 1, 1, 2, 2, 2, 1,
+	2, 1, 1, 2, 1, 1, 2, 12,
+	2, 2, 2, 2, 2, 2, 2, 6,
+	2, 2, 2, 2, 2, 2, 4, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 4, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	1, 3, 3, 2, 3, 6, 9, 6,
+	6, 6, 6, 16, 6, 16, 6, 16,
+	6, 12, 2, 10, 2, 1, 6, 10,
+	6, 1, 6, 10, 6, 1, 6, 10,
+	6, 1, 1, 1, 2, 6, 6, 2,
+	1, 3, 6, 9, 2, 1, 0, 6,
+	9, 2, 1, 2, 10, 10, 1, 1,
+	3, 0, 6, 8, 6, 8, 7, 8,
+	6, 6, 6, 8, 6, 8, 7, 8,
+	6, 7, 0, 12, 10, 12, 10, 12,
+	10, 12, 10, 1, 11, 11, 1, 11,
+	11, 10, 1, 11, 11, 10, 1, 11,
+	11, 10, 1, 6, 1, 6, 6, 1,
+	1, 1, 6, 1, 6, 6, 1, 1,
+	0, 6, 6, 6, 6, 6, 9, 2,
+	1, 1, 1, 0, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 9, 2, 1,
+	1, 1, 1, 1, 0, 6, 6, 6,
+	6, 6, 7, 2, 1, 1, 1, 13,
+	2, 1, 1, 1, 0, 10, 1, 1,
+	1, 1, 0, 6, 6, 6, 6, 6,
+	6, 0, 10, 1, 1, 1, 1, 0,
+	6, 6, 6, 6, 0, 10, 1, 1,
+	1, 0, 6, 10, 6, 6, 6, 7,
+	34, 7, 2, 1, 14, 1, 35, 3,
+	1, 1, 6, 6, 6, 7, 35, 1,
+	1, 6, 6, 6, 7, 35, 1, 1,
+	6, 6, 6, 9, 34, 1, 1, 1,
+	34, 12, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 9, 6,
+	7, 2, 1, 1, 1, 1, 1, 1,
+	1, 1, 2, 2, 6, 2, 2, 2,
+	6, 2, 6, 10, 2, 6, 4, 2,
+	2, 2, 2, 6, 6, 2, 2, 6,
+	2, 2, 2, 6, 2, 2, 2, 6,
+	6, 2, 2, 2, 6, 4, 2, 2,
+	6, 2, 2, 2, 6, 6, 2, 2,
+	2, 1, 6, 1, 6, 2, 2, 2,
+	2, 6, 2, 2, 2, 2, 2, 2,
+	2, 6, 4, 2, 6, 6, 6, 1,
+	6, 1, 6, 2, 6, 6, 4, 2,
+	2, 2, 6, 6, 6, 2, 2, 2,
+	6, 2, 6, 8, 2, 7, 8, 2,
+	2, 2, 2, 6, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 6, 2, 2,
+	6, 6, 6, 2, 2, 2, 6, 6,
+	10, 2, 2, 2, 2, 6, 2, 6,
+	2, 6, 2, 6, 2, 2, 2, 6,
+	6, 2, 2, 6, 2, 6, 2, 2,
+	0, 6, 2, 2, 6, 2, 2, 2,
+	2, 2, 6, 3, 2, 2, 0, 6,
+	6, 6, 6, 6, 7, 2, 1, 1,
+	1, 1, 2, 0, 6, 6, 6, 6,
+	6, 7, 6, 6, 0, 1, 0, 1,
+	1, 0, 1, 2, 2, 1, 1, 1,
+	1, 1, 1, 0, 6, 1, 1, 1,
+	0, 6, 6, 6, 6, 6, 7, 2,
+	0, 2, 1, 1, 1, 0, 6, 6,
+	6, 6, 6, 6, 0, 10, 1, 1,
+	1, 1, 0, 6, 6, 2, 2, 1,
+	0, 6, 6, 6, 6, 6, 6, 0,
+	10, 1, 1, 1, 1, 0, 6, 7,
+	3, 1, 0, 6, 6, 0, 0, 0,
+	1, 0, 0, 0, 0, 3, 1, 0,
+	0, 1, 0, 0, 3, 0, 0, 1,
+	0, 0, 3, 0, 6, 6, 6, 6,
+	2, 1, 1, 0, 6, 6, 6, 6,
+	2, 1, 1, 12, 17, 46, 46, 12,
+	46, 12, 17, 51, 51, 0, 0, 0,
+	4, 0, 0, 0, 10, 0, 11, 1,
+	0, 44, 1, 0, 10, 1, 6, 0,
+	10, 1, 1, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 10, 1, 0, 0,
+	10, 1, 10, 1, 10, 1, 10, 1,
+	0, 0, 0, 0, 13, 1, 0, 10,
+	1, 0, 10, 1, 0, 14, 1, 7,
+	1, 35, 3, 0, 0, 0, 0, 0,
+	0, 0, 10, 1, 0, 0, 10, 1,
+	0, 0, 0, 0, 0, 0
+};
+
+static const char _zone_scanner_range_lengths[] = {
+	0, 1, 1, 0, 0, 3, 0, 0,
+	0, 0, 1, 3, 3, 2, 4, 1,
+	0, 0, 0, 0, 1, 1, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1, 1,
+	0, 0, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	2, 0, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 0, 4, 0, 3, 1,
+	2, 3, 3, 4, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2, 0, 0, 0,
+	0, 0, 0, 2, 0, 0, 2, 0,
+	1, 1, 2, 0, 4, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3, 1, 1,
+	1, 2, 2, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2, 3, 3, 2,
+	2, 2, 2, 1, 4, 1, 1, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 2,
+	2, 0, 2, 0, 0, 3, 5, 5,
+	1, 1, 1, 5, 2, 2, 2, 4,
+	3, 1, 1, 4, 1, 2, 3, 1,
+	1, 1, 0, 1, 1, 0, 0, 1,
+	1, 1, 1, 0, 3, 3, 3, 0,
+	0, 1, 1, 1, 3, 0, 1, 0,
+	3, 0, 3, 3, 3, 0, 0, 1,
+	1, 1, 3, 0, 2, 3, 1, 1,
+	3, 3, 3, 3, 3, 1, 0, 0,
+	0, 0, 0, 0, 0, 1, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 1, 1, 3,
+	3, 3, 1, 1, 1, 0, 1, 1,
+	3, 3, 3, 1, 1, 1, 1, 1,
+	3, 0, 2, 0, 2, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 2,
+	0, 0, 0, 0, 0, 0, 0, 2,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2, 0, 0, 0,
+	0, 0, 0, 0, 0, 2, 0, 0,
+	0, 0, 0, 2, 0, 0, 2, 0,
+	0, 0, 0, 0, 0, 0, 2, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	2, 0, 0, 2, 0, 0, 0, 0,
+	0, 2, 0, 0, 0, 2, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	2, 0, 0, 2, 0, 0, 2, 1,
+	3, 0, 0, 0, 0, 0, 2, 0,
+	0, 0, 0, 0, 0, 2, 0, 0,
+	2, 0, 0, 2, 0, 0, 0, 2,
+	0, 0, 2, 0, 0, 2, 0, 0,
+	2, 0, 0, 0, 2, 0, 0, 2,
+	1, 3, 3, 2, 3, 0, 3, 0,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 3, 3, 1, 3, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 2, 0, 3, 2,
+	1, 3, 0, 3, 2, 1, 1, 1,
+	3, 2, 1, 2, 0, 3, 1, 3,
+	5, 1, 1, 1, 1, 1, 1, 0,
+	0, 1, 1, 1, 1, 1, 1, 0,
+	0, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 0, 1, 1, 1, 1, 1,
+	1, 0, 1, 1, 1, 0, 1, 1,
+	1, 0, 1, 0, 1, 1, 1, 1,
+	1, 1, 0, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 3, 2,
+	1, 1, 1, 1, 1, 1, 1, 3,
+	0, 3, 0, 3, 0, 3, 2, 1,
+	1, 1, 1, 1, 3, 0, 1, 1,
+	3, 0, 3, 0, 1, 1, 1, 0,
+	0, 0, 1, 1, 1, 1, 1, 0,
+	3, 3, 1, 1, 3, 0, 1, 1,
+	3, 3, 3, 1, 1, 1, 1, 1,
+	1, 1, 1, 3, 3, 3, 1, 1,
+	1, 1, 1, 0, 0, 1, 1, 0,
+	0, 3, 0, 1, 0, 1, 3, 3,
+	1, 1, 0, 1, 1, 1, 1, 1,
+	1, 0, 1, 1, 3, 3, 1, 1,
+	0, 1, 1, 3, 0, 1, 1, 1,
+	0, 0, 3, 0, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 3, 0,
+	3, 0, 1, 1, 1, 1, 1, 1,
+	1, 1, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3, 2, 2, 1, 1,
+	1, 1, 3, 0, 3, 0, 1, 1,
+	1, 3, 0, 1, 1, 1, 1, 1,
+	1, 3, 0, 3, 3, 3, 3, 3,
+	3, 3, 3, 5, 2, 0, 0, 0,
+	0, 0, 1, 3, 3, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 3, 2,
+	3, 5, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 3, 3, 3, 1, 1,
+	1, 1, 1, 1, 1, 3, 2, 1,
+	1, 1, 1, 1, 1, 1, 3, 3,
+	3, 1, 1, 1, 1, 1, 1, 1,
+	3, 1, 1, 1, 3, 3, 3, 3,
+	0, 3, 3, 3, 3, 2, 1, 3,
+	3, 0, 3, 3, 2, 3, 3, 0,
+	3, 3, 2, 1, 1, 1, 1, 3,
+	2, 1, 1, 1, 1, 3, 0, 3,
+	2, 1, 1, 3, 8, 3, 4, 3,
+	4, 3, 8, 9, 9, 0, 0, 0,
+	4, 0, 0, 0, 3, 0, 3, 1,
+	0, 0, 1, 0, 3, 1, 3, 0,
+	3, 1, 1, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 1, 0, 0,
+	0, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 1, 0, 3,
+	1, 0, 3, 1, 0, 0, 1, 3,
+	1, 3, 3, 0, 0, 0, 0, 0,
+	0, 0, 3, 1, 0, 0, 3, 1,
+	0, 0, 0, 0, 0, 0
+};
+
+static const short _zone_scanner_index_offsets[] = {
+	0, 0, 44, 62, 103, 120, 135, 144,
+	153, 155, 157, 160, 177, 194, 199, 252,
+	272, 315, 326, 329, 340, 354, 368, 373,
+	376, 379, 382, 385, 396, 407, 410, 413,
+	424, 427, 430, 433, 444, 447, 450, 453,
+	464, 471, 474, 477, 480, 491, 496, 499,
+	502, 513, 516, 519, 522, 533, 544, 547,
+	550, 553, 555, 566, 568, 579, 582, 585,
+	588, 591, 602, 607, 614, 655, 658, 661,
+	664, 667, 670, 673, 676, 687, 692, 695,
+	706, 717, 724, 726, 737, 739, 750, 753,
+	764, 775, 780, 783, 786, 789, 800, 811,
+	818, 821, 824, 827, 838, 841, 852, 865,
+	868, 880, 893, 896, 899, 902, 905, 916,
+	919, 922, 925, 928, 931, 934, 937, 940,
+	943, 954, 957, 960, 971, 978, 989, 992,
+	995, 998, 1009, 1020, 1031, 1034, 1037, 1040,
+	1043, 1054, 1057, 1068, 1071, 1082, 1085, 1096,
+	1099, 1102, 1105, 1116, 1123, 1126, 1129, 1140,
+	1143, 1154, 1157, 1160, 1162, 1174, 1177, 1180,
+	1191, 1194, 1197, 1200, 1203, 1206, 1217, 1220,
+	1264, 1269, 1276, 1318, 1336, 1344, 1356, 1364,
+	1367, 1369, 1376, 1379, 1382, 1385, 1388, 1391,
+	1394, 1399, 1406, 1448, 1451, 1469, 1511, 1514,
+	1522, 1534, 1542, 1545, 1562, 1613, 1632, 1649,
+	1693, 1698, 1710, 1722, 1775, 1794, 1809, 1820,
+	1831, 1844, 1857, 1872, 1885, 1900, 1911, 1922,
+	1937, 1956, 1971, 1982, 1993, 1998, 2013, 2016,
+	2019, 2022, 2025, 2028, 2033, 2036, 2039, 2044,
+	2053, 2073, 2117, 2122, 2141, 2194, 2213, 2228,
+	2239, 2250, 2263, 2276, 2291, 2304, 2319, 2330,
+	2341, 2356, 2375, 2390, 2401, 2412, 2425, 2469,
+	2483, 2497, 2512, 2527, 2530, 2533, 2544, 2547,
+	2550, 2553, 2564, 2567, 2578, 2583, 2595, 2607,
+	2622, 2637, 2652, 2667, 2670, 2723, 2737, 2751,
+	2768, 2781, 2790, 2799, 2810, 2821, 2834, 2845,
+	2858, 2867, 2876, 2889, 2906, 2919, 2928, 2937,
+	2942, 2947, 2958, 2963, 2965, 2967, 2976, 2988,
+	3000, 3002, 3004, 3006, 3018, 3023, 3028, 3033,
+	3042, 3046, 3048, 3050, 3059, 3065, 3070, 3074,
+	3076, 3078, 3084, 3091, 3099, 3119, 3128, 3130,
+	3140, 3152, 3162, 3165, 3172, 3186, 3194, 3210,
+	3219, 3221, 3223, 3225, 3227, 3235, 3244, 3247,
+	3254, 3264, 3273, 3289, 3297, 3313, 3322, 3324,
+	3326, 3328, 3330, 3338, 3347, 3352, 3366, 3369,
+	3372, 3377, 3382, 3388, 3394, 3409, 3412, 3414,
+	3425, 3470, 3487, 3490, 3493, 3504, 3507, 3518,
+	3521, 3532, 3537, 3540, 3543, 3546, 3549, 3560,
+	3571, 3574, 3577, 3588, 3591, 3594, 3597, 3608,
+	3611, 3614, 3617, 3628, 3635, 3638, 3641, 3644,
+	3655, 3660, 3663, 3666, 3677, 3680, 3683, 3686,
+	3697, 3708, 3711, 3714, 3717, 3719, 3730, 3732,
+	3743, 3746, 3749, 3752, 3755, 3766, 3769, 3772,
+	3775, 3778, 3781, 3784, 3787, 3798, 3803, 3806,
+	3817, 3828, 3835, 3837, 3848, 3850, 3861, 3864,
+	3875, 3886, 3891, 3894, 3897, 3900, 3911, 3922,
+	3929, 3932, 3935, 3938, 3949, 3952, 3963, 3976,
+	3979, 3991, 4004, 4007, 4010, 4013, 4016, 4027,
+	4030, 4033, 4036, 4039, 4042, 4045, 4048, 4051,
+	4054, 4065, 4068, 4071, 4082, 4089, 4100, 4103,
+	4106, 4109, 4120, 4131, 4142, 4145, 4148, 4151,
+	4154, 4165, 4168, 4179, 4182, 4193, 4196, 4207,
+	4210, 4213, 4216, 4227, 4234, 4237, 4240, 4251,
+	4254, 4265, 4268, 4271, 4273, 4285, 4288, 4291,
+	4302, 4305, 4308, 4311, 4314, 4317, 4328, 4331,
+	4334, 4337, 4348, 4351, 4362, 4369, 4377, 4385,
+	4395, 4399, 4413, 4416, 4419, 4422, 4429, 4438,
+	4448, 4458, 4462, 4476, 4479, 4482, 4490, 4493,
+	4505, 4511, 4516, 4521, 4524, 4530, 4533, 4536,
+	4539, 4542, 4544, 4546, 4549, 4552, 4555, 4557,
+	4562, 4567, 4572, 4574, 4577, 4580, 4583, 4586,
+	4591, 4594, 4597, 4600, 4603, 4605, 4607, 4610,
+	4613, 4616, 4618, 4620, 4622, 4627, 4629, 4631,
+	4634, 4637, 4640, 4642, 4644, 4646, 4651, 4654,
+	4656, 4658, 4660, 4662, 4667, 4669, 4671, 4676,
+	4679, 4682, 4685, 4688, 4691, 4694, 4697, 4702,
+	4705, 4708, 4711, 4714, 4717, 4720, 4725, 4728,
+	4731, 4736, 4739, 4742, 4747, 4750, 4753, 4758,
+	4761, 4763, 4768, 4771, 4774, 4778, 4784, 4787,
+	4790, 4793, 4796, 4798, 4800, 4803, 4806, 4809,
+	4811, 4816, 4818, 4820, 4825, 4827, 4829, 4834,
+	4848, 4854, 4857, 4860, 4863, 4866, 4869, 4874,
+	4881, 4884, 4887, 4890, 4893, 4896, 4901, 4906,
+	4909, 4914, 4917, 4920, 4925, 4928, 4931, 4934,
+	4939, 4942, 4945, 4950, 4955, 4958, 4963, 4966,
+	4969, 4974, 4977, 4980, 4983, 4988, 4991, 4994,
+	4999, 5002, 5009, 5016, 5021, 5028, 5035, 5048,
+	5055, 5063, 5071, 5079, 5097, 5105, 5123, 5131,
+	5149, 5157, 5173, 5179, 5191, 5197, 5200, 5208,
+	5220, 5228, 5231, 5239, 5251, 5259, 5262, 5270,
+	5282, 5290, 5293, 5296, 5299, 5304, 5311, 5321,
+	5326, 5329, 5336, 5343, 5356, 5361, 5364, 5366,
+	5374, 5387, 5392, 5395, 5400, 5411, 5425, 5428,
+	5433, 5442, 5444, 5452, 5462, 5470, 5480, 5489,
+	5498, 5505, 5513, 5521, 5531, 5539, 5549, 5558,
+	5567, 5574, 5583, 5585, 5599, 5611, 5625, 5637,
+	5651, 5663, 5677, 5688, 5691, 5704, 5717, 5720,
+	5733, 5746, 5757, 5760, 5773, 5786, 5797, 5800,
+	5813, 5826, 5837, 5840, 5847, 5850, 5858, 5866,
+	5869, 5872, 5875, 5882, 5885, 5893, 5901, 5904,
+	5907, 5909, 5917, 5925, 5933, 5941, 5949, 5962,
+	5967, 5970, 5973, 5976, 5978, 5986, 5994, 6002,
+	6012, 6019, 6029, 6036, 6046, 6053, 6066, 6071,
+	6074, 6077, 6080, 6083, 6086, 6090, 6097, 6105,
+	6113, 6123, 6130, 6141, 6144, 6147, 6150, 6153,
+	6167, 6170, 6172, 6175, 6178, 6180, 6192, 6195,
+	6197, 6202, 6207, 6209, 6217, 6227, 6234, 6242,
+	6250, 6260, 6264, 6278, 6281, 6284, 6287, 6290,
+	6292, 6300, 6308, 6316, 6326, 6330, 6344, 6347,
+	6350, 6353, 6355, 6363, 6374, 6381, 6389, 6397,
+	6405, 6440, 6451, 6454, 6457, 6472, 6475, 6514,
+	6521, 6524, 6527, 6534, 6542, 6550, 6559, 6596,
+	6599, 6602, 6609, 6617, 6625, 6636, 6675, 6678,
+	6681, 6688, 6696, 6704, 6717, 6752, 6755, 6758,
+	6761, 6796, 6809, 6819, 6826, 6834, 6842, 6850,
+	6858, 6866, 6874, 6882, 6890, 6898, 6906, 6919,
+	6926, 6937, 6940, 6943, 6946, 6949, 6952, 6955,
+	6958, 6961, 6964, 6967, 6970, 6977, 6980, 6983,
+	6986, 6993, 6996, 7003, 7014, 7017, 7024, 7029,
+	7032, 7035, 7038, 7041, 7048, 7055, 7058, 7061,
+	7068, 7071, 7074, 7077, 7084, 7087, 7090, 7093,
+	7100, 7107, 7110, 7113, 7116, 7123, 7128, 7131,
+	7134, 7141, 7144, 7147, 7150, 7157, 7164, 7167,
+	7170, 7173, 7175, 7182, 7184, 7191, 7194, 7197,
+	7200, 7203, 7210, 7213, 7216, 7219, 7222, 7225,
+	7228, 7231, 7238, 7243, 7246, 7253, 7260, 7267,
+	7269, 7276, 7278, 7285, 7288, 7295, 7302, 7307,
+	7310, 7313, 7316, 7323, 7330, 7337, 7340, 7343,
+	7346, 7353, 7356, 7363, 7372, 7375, 7383, 7392,
+	7395, 7398, 7401, 7404, 7411, 7414, 7417, 7420,
+	7423, 7426, 7429, 7432, 7435, 7438, 7445, 7448,
+	7451, 7458, 7465, 7472, 7475, 7478, 7481, 7488,
+	7495, 7506, 7509, 7512, 7515, 7518, 7525, 7528,
+	7535, 7538, 7545, 7548, 7555, 7558, 7561, 7564,
+	7571, 7578, 7581, 7584, 7591, 7594, 7601, 7604,
+	7607, 7609, 7617, 7620, 7623, 7630, 7633, 7636,
+	7639, 7642, 7645, 7652, 7659, 7664, 7669, 7671,
+	7679, 7687, 7695, 7705, 7712, 7723, 7726, 7729,
+	7732, 7735, 7740, 7743, 7745, 7753, 7761, 7769,
+	7777, 7785, 7796, 7803, 7813, 7817, 7822, 7826,
+	7831, 7836, 7840, 7845, 7853, 7858, 7860, 7862,
+	7864, 7866, 7868, 7871, 7875, 7885, 7888, 7891,
+	7894, 7896, 7904, 7912, 7920, 7928, 7936, 7947,
+	7952, 7956, 7964, 7967, 7970, 7973, 7975, 7983,
+	7991, 7999, 8007, 8015, 8025, 8029, 8043, 8046,
+	8049, 8052, 8055, 8057, 8065, 8073, 8079, 8084,
+	8087, 8089, 8097, 8105, 8113, 8121, 8129, 8139,
+	8143, 8157, 8160, 8163, 8166, 8169, 8171, 8179,
+	8188, 8195, 8198, 8200, 8208, 8218, 8222, 8226,
+	8230, 8232, 8236, 8240, 8244, 8248, 8254, 8257,
+	8261, 8265, 8267, 8271, 8275, 8281, 8285, 8289,
+	8291, 8295, 8299, 8305, 8307, 8315, 8323, 8331,
+	8341, 8346, 8349, 8352, 8354, 8362, 8372, 8379,
+	8389, 8394, 8397, 8400, 8416, 8442, 8492, 8543,
+	8559, 8610, 8626, 8652, 8713, 8774, 8775, 8776,
+	8777, 8786, 8787, 8788, 8789, 8803, 8804, 8819,
+	8822, 8823, 8868, 8871, 8872, 8886, 8889, 8899,
+	8900, 8914, 8917, 8920, 8921, 8922, 8923, 8924,
+	8925, 8926, 8927, 8928, 8929, 8943, 8946, 8947,
+	8948, 8959, 8962, 8974, 8977, 8989, 8992, 9004,
+	9007, 9008, 9009, 9010, 9011, 9025, 9028, 9029,
+	9043, 9046, 9047, 9061, 9064, 9065, 9080, 9083,
+	9094, 9097, 9136, 9143, 9144, 9145, 9146, 9147,
+	9148, 9149, 9150, 9164, 9167, 9168, 9169, 9183,
+	9186, 9187, 9188, 9189, 9190, 9191
+};
+
+static const short _zone_scanner_indicies[] = {
+	1, 1, 2, 3, 5, 6, 7, 8,
+	9, 10, 11, 12, 13, 14, 15, 16,
+	17, 18, 19, 20, 21, 5, 6, 7,
+	8, 9, 10, 11, 12, 13, 14, 15,
+	16, 17, 18, 19, 20, 21, 22, 23,
+	24, 25, 4, 0, 27, 27, 28, 29,
+	31, 32, 33, 34, 35, 31, 32, 33,
+	34, 35, 36, 37, 30, 26, 39, 39,
+	40, 41, 42, 43, 44, 45, 46, 47,
+	48, 49, 50, 51, 52, 53, 54, 55,
+	56, 57, 58, 42, 43, 44, 45, 46,
+	47, 48, 49, 50, 51, 52, 53, 54,
+	55, 56, 57, 58, 59, 60, 38, 62,
+	62, 63, 64, 65, 66, 67, 65, 66,
+	67, 68, 69, 70, 70, 71, 72, 61,
+	74, 74, 76, 77, 78, 79, 80, 73,
+	73, 81, 82, 73, 73, 73, 75, 84,
+	84, 85, 86, 87, 88, 87, 88, 83,
+	90, 90, 91, 92, 93, 94, 93, 94,
+	89, 96, 95, 98, 97, 100, 99, 75,
+	101, 101, 102, 103, 78, 87, 88, 87,
+	104, 105, 106, 87, 107, 73, 73, 73,
+	83, 108, 108, 109, 110, 78, 93, 94,
+	93, 111, 112, 113, 93, 114, 73, 73,
+	73, 83, 96, 116, 95, 115, 83, 117,
+	117, 119, 120, 73, 122, 123, 124, 125,
+	126, 127, 128, 129, 130, 131, 132, 133,
+	134, 135, 136, 137, 138, 78, 122, 123,
+	124, 125, 126, 127, 128, 129, 130, 131,
+	132, 133, 134, 135, 136, 137, 138, 22,
+	23, 139, 140, 141, 142, 143, 144, 73,
+	73, 121, 73, 118, 146, 146, 147, 148,
+	31, 32, 33, 34, 35, 31, 32, 33,
+	34, 35, 87, 88, 149, 150, 30, 145,
+	152, 152, 153, 154, 42, 43, 44, 45,
+	46, 47, 48, 49, 50, 51, 52, 53,
+	54, 55, 56, 57, 58, 42, 43, 44,
+	45, 46, 47, 48, 49, 50, 51, 52,
+	53, 54, 55, 56, 57, 58, 93, 94,
+	155, 156, 151, 157, 158, 159, 160, 161,
+	157, 158, 159, 160, 161, 38, 162, 162,
+	38, 163, 163, 164, 165, 166, 167, 168,
+	168, 169, 170, 61, 84, 87, 84, 85,
+	86, 88, 171, 87, 171, 172, 173, 174,
+	99, 83, 90, 93, 90, 91, 92, 94,
+	175, 93, 175, 176, 177, 178, 99, 83,
+	179, 180, 179, 180, 38, 181, 181, 38,
+	182, 182, 38, 183, 183, 38, 184, 184,
+	38, 185, 185, 186, 187, 188, 189, 190,
+	190, 191, 192, 61, 193, 193, 194, 195,
+	196, 197, 198, 198, 199, 200, 61, 201,
+	201, 38, 202, 202, 38, 203, 203, 204,
+	205, 206, 207, 208, 208, 209, 210, 61,
+	211, 211, 38, 212, 212, 38, 213, 213,
+	38, 214, 214, 215, 216, 217, 218, 219,
+	219, 220, 221, 61, 222, 222, 38, 223,
+	223, 38, 224, 224, 38, 225, 225, 226,
+	227, 228, 229, 230, 230, 231, 232, 61,
+	233, 234, 235, 233, 234, 235, 38, 236,
+	236, 38, 237, 237, 38, 238, 238, 38,
+	239, 239, 240, 241, 242, 243, 244, 244,
+	245, 246, 61, 247, 248, 247, 248, 38,
+	249, 249, 38, 250, 250, 38, 251, 251,
+	252, 253, 254, 255, 256, 256, 257, 258,
+	61, 259, 259, 38, 260, 260, 38, 261,
+	261, 38, 262, 262, 263, 264, 265, 266,
+	267, 267, 268, 269, 61, 270, 270, 271,
+	272, 273, 274, 275, 275, 276, 277, 61,
+	278, 278, 38, 279, 279, 38, 280, 281,
+	38, 282, 38, 283, 283, 284, 285, 286,
+	287, 288, 288, 289, 290, 61, 291, 38,
+	292, 292, 293, 294, 295, 296, 297, 297,
+	298, 299, 61, 300, 300, 38, 301, 301,
+	38, 302, 302, 38, 303, 303, 38, 304,
+	304, 305, 306, 307, 308, 309, 309, 310,
+	311, 61, 312, 313, 312, 313, 38, 314,
+	314, 315, 316, 317, 318, 38, 319, 319,
+	320, 321, 322, 323, 324, 325, 326, 327,
+	328, 329, 330, 331, 332, 333, 334, 335,
+	336, 337, 338, 322, 323, 324, 325, 326,
+	327, 328, 329, 330, 331, 332, 333, 334,
+	335, 336, 337, 338, 339, 340, 38, 313,
+	313, 38, 341, 341, 38, 342, 342, 38,
+	343, 343, 38, 344, 344, 38, 345, 345,
+	38, 346, 346, 38, 347, 347, 348, 349,
+	350, 351, 352, 352, 353, 354, 61, 355,
+	356, 355, 356, 38, 357, 357, 38, 358,
+	358, 359, 360, 361, 362, 363, 363, 364,
+	365, 61, 366, 366, 367, 368, 369, 370,
+	371, 371, 372, 373, 61, 374, 375, 376,
+	377, 376, 377, 38, 378, 38, 379, 379,
+	380, 381, 382, 383, 384, 384, 385, 386,
+	61, 387, 38, 388, 388, 389, 390, 391,
+	392, 393, 393, 394, 395, 61, 396, 396,
+	38, 397, 397, 398, 399, 400, 401, 402,
+	402, 403, 404, 61, 405, 405, 406, 407,
+	408, 409, 410, 410, 411, 412, 61, 413,
+	414, 413, 414, 38, 415, 415, 38, 416,
+	416, 38, 417, 417, 38, 418, 418, 419,
+	420, 421, 422, 423, 423, 424, 425, 61,
+	426, 426, 427, 428, 429, 430, 431, 431,
+	432, 433, 61, 434, 435, 436, 434, 435,
+	436, 38, 437, 437, 38, 438, 438, 38,
+	439, 439, 38, 440, 440, 441, 442, 443,
+	444, 445, 445, 446, 447, 61, 448, 448,
+	38, 449, 449, 450, 451, 452, 453, 454,
+	454, 455, 456, 61, 457, 457, 458, 459,
+	460, 460, 461, 462, 463, 463, 464, 465,
+	61, 466, 466, 38, 467, 467, 468, 469,
+	470, 471, 472, 473, 473, 474, 475, 61,
+	476, 476, 477, 478, 479, 479, 480, 481,
+	482, 482, 483, 484, 61, 485, 485, 38,
+	486, 486, 38, 487, 487, 38, 488, 488,
+	38, 489, 489, 490, 491, 492, 493, 494,
+	494, 495, 496, 61, 497, 497, 38, 498,
+	498, 38, 499, 499, 38, 500, 500, 38,
+	501, 501, 38, 502, 502, 38, 503, 503,
+	38, 504, 504, 38, 505, 505, 38, 506,
+	506, 507, 508, 509, 510, 511, 511, 512,
+	513, 61, 514, 514, 38, 515, 515, 38,
+	516, 516, 517, 518, 519, 520, 521, 521,
+	522, 523, 61, 524, 525, 526, 524, 525,
+	526, 38, 527, 527, 528, 529, 530, 531,
+	532, 532, 533, 534, 61, 535, 535, 38,
+	536, 536, 38, 537, 537, 38, 538, 538,
+	539, 540, 541, 542, 543, 543, 544, 545,
+	61, 546, 546, 547, 548, 549, 550, 551,
+	551, 552, 553, 61, 554, 555, 556, 557,
+	558, 554, 555, 556, 557, 558, 38, 559,
+	559, 38, 560, 560, 38, 561, 561, 38,
+	562, 562, 38, 563, 563, 564, 565, 566,
+	567, 568, 568, 569, 570, 61, 571, 571,
+	38, 572, 572, 573, 574, 575, 576, 577,
+	577, 578, 579, 61, 580, 580, 38, 581,
+	581, 582, 583, 584, 585, 586, 586, 587,
+	588, 61, 589, 589, 38, 590, 590, 591,
+	592, 593, 594, 595, 595, 596, 597, 61,
+	598, 598, 38, 599, 599, 38, 600, 600,
+	38, 601, 601, 602, 603, 604, 605, 606,
+	606, 607, 608, 61, 609, 610, 611, 609,
+	610, 611, 38, 612, 612, 38, 613, 613,
+	38, 614, 614, 615, 616, 617, 618, 619,
+	619, 620, 621, 61, 622, 622, 38, 623,
+	623, 624, 625, 626, 627, 628, 628, 629,
+	630, 61, 631, 631, 38, 632, 632, 38,
+	634, 633, 636, 636, 637, 638, 640, 641,
+	642, 642, 643, 644, 639, 635, 645, 645,
+	38, 646, 646, 38, 647, 647, 648, 649,
+	650, 651, 652, 652, 653, 654, 61, 655,
+	655, 38, 656, 656, 38, 657, 657, 38,
+	658, 658, 38, 659, 659, 38, 660, 660,
+	661, 662, 663, 664, 665, 665, 666, 667,
+	61, 669, 668, 38, 670, 670, 671, 672,
+	5, 6, 7, 8, 9, 10, 11, 12,
+	13, 14, 15, 16, 17, 18, 19, 20,
+	21, 5, 6, 7, 8, 9, 10, 11,
+	12, 13, 14, 15, 16, 17, 18, 19,
+	20, 21, 22, 23, 673, 674, 4, 0,
+	675, 313, 675, 313, 38, 676, 676, 677,
+	678, 679, 680, 38, 681, 681, 682, 683,
+	685, 686, 687, 688, 689, 690, 691, 692,
+	693, 694, 695, 696, 697, 698, 699, 700,
+	701, 685, 686, 687, 688, 689, 690, 691,
+	692, 693, 694, 695, 696, 697, 698, 699,
+	700, 701, 702, 703, 684, 633, 704, 704,
+	705, 706, 708, 709, 710, 711, 712, 708,
+	709, 710, 711, 712, 713, 714, 707, 26,
+	704, 704, 705, 706, 713, 714, 715, 26,
+	717, 718, 719, 720, 721, 717, 718, 719,
+	720, 721, 716, 26, 722, 722, 723, 724,
+	726, 727, 725, 26, 729, 728, 38, 731,
+	730, 733, 734, 735, 733, 734, 735, 732,
+	736, 736, 732, 737, 737, 732, 738, 738,
+	732, 739, 739, 732, 740, 740, 732, 741,
+	741, 732, 742, 742, 742, 742, 732, 744,
+	744, 745, 746, 747, 748, 743, 749, 749,
+	750, 751, 5, 6, 7, 8, 9, 10,
+	11, 12, 13, 14, 15, 16, 17, 18,
+	19, 20, 21, 5, 6, 7, 8, 9,
+	10, 11, 12, 13, 14, 15, 16, 17,
+	18, 19, 20, 21, 752, 753, 4, 633,
+	756, 754, 755, 758, 758, 759, 760, 31,
+	32, 33, 34, 35, 31, 32, 33, 34,
+	35, 761, 762, 30, 757, 763, 763, 764,
+	765, 5, 6, 7, 8, 9, 10, 11,
+	12, 13, 14, 15, 16, 17, 18, 19,
+	20, 21, 5, 6, 7, 8, 9, 10,
+	11, 12, 13, 14, 15, 16, 17, 18,
+	19, 20, 21, 766, 767, 4, 633, 769,
+	768, 38, 27, 27, 28, 29, 36, 37,
+	770, 26, 772, 773, 774, 775, 776, 772,
+	773, 774, 775, 776, 771, 26, 777, 777,
+	778, 779, 781, 782, 780, 26, 784, 783,
+	38, 786, 786, 787, 788, 65, 66, 67,
+	65, 66, 67, 789, 790, 70, 70, 791,
+	792, 785, 793, 793, 794, 795, 73, 122,
+	123, 124, 125, 126, 127, 128, 129, 130,
+	131, 132, 133, 134, 135, 136, 137, 138,
+	78, 122, 123, 124, 125, 126, 127, 128,
+	129, 130, 131, 132, 133, 134, 135, 136,
+	137, 138, 796, 797, 73, 73, 798, 799,
+	73, 73, 121, 73, 635, 801, 801, 802,
+	803, 65, 66, 67, 65, 66, 67, 87,
+	88, 804, 805, 806, 807, 808, 809, 800,
+	810, 810, 811, 812, 78, 93, 94, 813,
+	111, 112, 113, 814, 114, 73, 73, 73,
+	83, 815, 815, 816, 817, 5, 6, 7,
+	8, 9, 10, 11, 12, 13, 14, 15,
+	16, 17, 18, 19, 20, 21, 5, 6,
+	7, 8, 9, 10, 11, 12, 13, 14,
+	15, 16, 17, 18, 19, 20, 21, 93,
+	94, 818, 819, 4, 0, 96, 821, 95,
+	820, 89, 822, 822, 823, 824, 825, 826,
+	825, 826, 95, 95, 95, 83, 827, 827,
+	828, 829, 96, 830, 96, 830, 95, 95,
+	95, 89, 831, 831, 832, 833, 73, 122,
+	123, 124, 125, 126, 127, 128, 129, 130,
+	131, 132, 133, 134, 135, 136, 137, 138,
+	78, 122, 123, 124, 125, 126, 127, 128,
+	129, 130, 131, 132, 133, 134, 135, 136,
+	137, 138, 93, 94, 818, 834, 112, 113,
+	818, 835, 73, 73, 121, 73, 118, 84,
+	84, 85, 86, 157, 158, 159, 160, 161,
+	157, 158, 159, 160, 161, 87, 88, 87,
+	88, 800, 84, 84, 85, 86, 233, 234,
+	235, 233, 234, 235, 87, 88, 87, 88,
+	800, 84, 84, 85, 86, 278, 278, 87,
+	88, 87, 88, 800, 84, 84, 85, 86,
+	300, 300, 87, 88, 87, 88, 800, 84,
+	84, 85, 86, 675, 313, 675, 313, 87,
+	88, 87, 88, 800, 84, 84, 85, 86,
+	355, 356, 355, 356, 87, 88, 87, 88,
+	800, 84, 84, 85, 86, 374, 375, 376,
+	377, 376, 377, 87, 88, 87, 88, 800,
+	84, 84, 85, 86, 413, 414, 413, 414,
+	87, 88, 87, 88, 800, 84, 84, 85,
+	86, 434, 435, 436, 434, 435, 436, 87,
+	88, 87, 88, 800, 84, 84, 85, 86,
+	497, 497, 87, 88, 87, 88, 800, 84,
+	84, 85, 86, 514, 514, 87, 88, 87,
+	88, 800, 84, 84, 85, 86, 524, 525,
+	526, 524, 525, 526, 87, 88, 87, 88,
+	800, 84, 84, 85, 86, 554, 555, 556,
+	557, 558, 554, 555, 556, 557, 558, 87,
+	88, 87, 88, 800, 84, 84, 85, 86,
+	609, 610, 611, 609, 610, 611, 87, 88,
+	87, 88, 800, 84, 84, 85, 86, 645,
+	645, 87, 88, 87, 88, 800, 84, 84,
+	85, 86, 655, 655, 87, 88, 87, 88,
+	800, 96, 837, 95, 836, 83, 84, 84,
+	85, 86, 733, 734, 735, 733, 734, 735,
+	87, 88, 87, 88, 838, 839, 839, 732,
+	840, 840, 732, 841, 841, 732, 842, 842,
+	732, 843, 843, 732, 844, 844, 844, 844,
+	732, 845, 845, 732, 846, 846, 732, 847,
+	847, 847, 847, 732, 849, 849, 850, 851,
+	87, 88, 852, 853, 848, 855, 855, 856,
+	857, 31, 32, 33, 34, 35, 31, 32,
+	33, 34, 35, 87, 88, 858, 859, 30,
+	854, 860, 860, 861, 862, 5, 6, 7,
+	8, 9, 10, 11, 12, 13, 14, 15,
+	16, 17, 18, 19, 20, 21, 5, 6,
+	7, 8, 9, 10, 11, 12, 13, 14,
+	15, 16, 17, 18, 19, 20, 21, 93,
+	94, 863, 864, 4, 0, 96, 866, 95,
+	865, 151, 868, 868, 869, 870, 65, 66,
+	67, 65, 66, 67, 87, 88, 871, 872,
+	806, 807, 873, 874, 867, 875, 875, 876,
+	877, 73, 122, 123, 124, 125, 126, 127,
+	128, 129, 130, 131, 132, 133, 134, 135,
+	136, 137, 138, 78, 122, 123, 124, 125,
+	126, 127, 128, 129, 130, 131, 132, 133,
+	134, 135, 136, 137, 138, 93, 94, 878,
+	834, 112, 113, 879, 835, 73, 73, 121,
+	73, 118, 849, 849, 850, 851, 157, 158,
+	159, 160, 161, 157, 158, 159, 160, 161,
+	87, 88, 852, 853, 867, 849, 849, 850,
+	851, 233, 234, 235, 233, 234, 235, 87,
+	88, 852, 853, 867, 849, 849, 850, 851,
+	278, 278, 87, 88, 852, 853, 867, 849,
+	849, 850, 851, 300, 300, 87, 88, 852,
+	853, 867, 849, 849, 850, 851, 675, 313,
+	675, 313, 87, 88, 852, 853, 867, 849,
+	849, 850, 851, 355, 356, 355, 356, 87,
+	88, 852, 853, 867, 849, 849, 850, 851,
+	374, 375, 376, 377, 376, 377, 87, 88,
+	852, 853, 867, 849, 849, 850, 851, 413,
+	414, 413, 414, 87, 88, 852, 853, 867,
+	849, 849, 850, 851, 434, 435, 436, 434,
+	435, 436, 87, 88, 852, 853, 867, 849,
+	849, 850, 851, 497, 497, 87, 88, 852,
+	853, 867, 849, 849, 850, 851, 514, 514,
+	87, 88, 852, 853, 867, 849, 849, 850,
+	851, 524, 525, 526, 524, 525, 526, 87,
+	88, 852, 853, 867, 849, 849, 850, 851,
+	554, 555, 556, 557, 558, 554, 555, 556,
+	557, 558, 87, 88, 852, 853, 867, 849,
+	849, 850, 851, 609, 610, 611, 609, 610,
+	611, 87, 88, 852, 853, 867, 849, 849,
+	850, 851, 645, 645, 87, 88, 852, 853,
+	867, 849, 849, 850, 851, 655, 655, 87,
+	88, 852, 853, 867, 880, 880, 98, 882,
+	883, 97, 97, 884, 885, 97, 97, 97,
+	881, 886, 886, 887, 888, 5, 6, 7,
+	8, 9, 10, 11, 12, 13, 14, 15,
+	16, 17, 18, 19, 20, 21, 5, 6,
+	7, 8, 9, 10, 11, 12, 13, 14,
+	15, 16, 17, 18, 19, 20, 21, 87,
+	88, 889, 890, 4, 118, 84, 87, 84,
+	85, 86, 88, 891, 892, 891, 893, 894,
+	895, 754, 83, 90, 93, 90, 91, 92,
+	94, 896, 821, 896, 897, 898, 899, 754,
+	89, 822, 825, 822, 823, 824, 826, 900,
+	892, 900, 901, 902, 903, 95, 836, 83,
+	827, 96, 827, 828, 829, 830, 904, 821,
+	904, 905, 906, 907, 95, 836, 83, 908,
+	908, 38, 909, 909, 38, 910, 910, 911,
+	912, 913, 914, 915, 915, 916, 917, 61,
+	918, 918, 38, 919, 919, 38, 920, 920,
+	38, 921, 921, 922, 923, 924, 925, 926,
+	926, 927, 928, 61, 929, 929, 38, 930,
+	930, 931, 932, 933, 934, 935, 935, 936,
+	937, 61, 731, 939, 730, 938, 83, 940,
+	940, 941, 942, 943, 826, 943, 826, 730,
+	730, 730, 83, 944, 944, 945, 946, 947,
+	830, 947, 830, 730, 730, 730, 89, 940,
+	943, 940, 941, 942, 826, 948, 892, 948,
+	949, 950, 903, 730, 938, 83, 944, 947,
+	944, 945, 946, 830, 951, 821, 951, 952,
+	953, 907, 730, 938, 83, 822, 825, 822,
+	823, 824, 826, 954, 825, 954, 955, 956,
+	174, 95, 115, 83, 827, 96, 827, 828,
+	829, 830, 957, 96, 957, 958, 959, 178,
+	95, 115, 83, 961, 960, 75, 962, 962,
+	963, 964, 73, 122, 123, 124, 125, 126,
+	127, 128, 129, 130, 131, 132, 133, 134,
+	135, 136, 137, 138, 78, 122, 123, 124,
+	125, 126, 127, 128, 129, 130, 131, 132,
+	133, 134, 135, 136, 137, 138, 87, 88,
+	889, 965, 105, 106, 889, 966, 73, 73,
+	121, 73, 118, 84, 87, 84, 85, 86,
+	88, 967, 892, 967, 968, 969, 903, 960,
+	83, 90, 93, 90, 91, 92, 94, 970,
+	821, 970, 971, 972, 907, 960, 83, 744,
+	744, 745, 746, 157, 158, 159, 160, 161,
+	157, 158, 159, 160, 161, 747, 748, 973,
+	744, 744, 745, 746, 233, 234, 235, 233,
+	234, 235, 747, 748, 973, 744, 744, 745,
+	746, 278, 278, 747, 748, 973, 744, 744,
+	745, 746, 300, 300, 747, 748, 973, 744,
+	744, 745, 746, 675, 313, 675, 313, 747,
+	748, 973, 744, 744, 745, 746, 355, 356,
+	355, 356, 747, 748, 973, 744, 744, 745,
+	746, 374, 375, 376, 377, 376, 377, 747,
+	748, 973, 744, 744, 745, 746, 413, 414,
+	413, 414, 747, 748, 973, 744, 744, 745,
+	746, 434, 435, 436, 434, 435, 436, 747,
+	748, 973, 744, 744, 745, 746, 497, 497,
+	747, 748, 973, 744, 744, 745, 746, 514,
+	514, 747, 748, 973, 744, 744, 745, 746,
+	524, 525, 526, 524, 525, 526, 747, 748,
+	973, 744, 744, 745, 746, 554, 555, 556,
+	557, 558, 554, 555, 556, 557, 558, 747,
+	748, 973, 744, 744, 745, 746, 609, 610,
+	611, 609, 610, 611, 747, 748, 973, 744,
+	744, 745, 746, 645, 645, 747, 748, 973,
+	744, 744, 745, 746, 655, 655, 747, 748,
+	973, 731, 975, 730, 974, 89, 731, 977,
+	730, 976, 151, 744, 744, 745, 746, 312,
+	313, 312, 313, 747, 748, 973, 96, 979,
+	95, 978, 151, 981, 980, 983, 982, 985,
+	986, 987, 988, 985, 985, 985, 985, 984,
+	989, 990, 991, 989, 992, 990, 989, 989,
+	990, 990, 990, 984, 993, 994, 994, 993,
+	995, 994, 993, 993, 994, 994, 994, 984,
+	996, 990, 998, 997, 999, 997, 1000, 1001,
+	1002, 1000, 1003, 1001, 1000, 1000, 1001, 1001,
+	1001, 997, 993, 993, 993, 993, 984, 1004,
+	1004, 1004, 1004, 984, 1007, 1008, 1006, 1006,
+	1005, 1009, 1006, 1009, 1008, 1009, 1006, 1010,
+	1006, 1005, 1006, 1012, 1006, 1011, 1013, 1011,
+	1014, 1011, 1015, 1016, 1015, 1018, 1015, 1016,
+	1017, 1016, 1011, 1019, 1020, 1021, 1019, 1019,
+	1005, 1009, 1009, 1009, 1009, 1022, 1019, 1023,
+	1019, 1011, 1024, 1011, 1025, 1011, 1026, 1027,
+	1028, 1026, 1026, 1011, 1030, 1030, 1031, 1032,
+	1033, 1034, 1029, 1030, 1030, 1031, 1032, 1033,
+	1034, 1036, 1035, 1038, 1038, 1039, 1040, 1042,
+	1043, 1044, 1045, 1046, 1042, 1043, 1044, 1045,
+	1046, 1047, 1048, 1047, 1048, 1041, 1037, 1050,
+	1050, 1051, 1052, 1053, 1054, 1053, 1054, 1049,
+	1056, 1055, 1038, 1038, 1039, 1040, 1047, 1048,
+	1047, 1048, 1057, 1037, 1060, 1061, 1062, 1063,
+	1064, 1060, 1061, 1062, 1063, 1064, 1059, 1058,
+	1065, 1065, 1066, 1067, 1069, 1070, 1069, 1070,
+	1068, 1037, 1072, 1071, 1029, 1074, 1074, 1075,
+	1076, 1077, 1078, 1073, 1074, 1074, 1075, 1076,
+	1079, 1080, 1081, 1079, 1077, 1078, 1079, 1079,
+	1079, 1073, 1082, 1083, 1084, 1082, 1082, 1082,
+	1082, 1073, 1086, 1086, 1087, 1088, 1089, 1089,
+	1090, 1089, 1091, 1092, 1091, 1092, 1089, 1089,
+	1089, 1085, 1093, 1093, 1094, 1095, 1096, 1097,
+	1096, 1097, 1085, 1099, 1098, 1100, 1082, 1102,
+	1101, 1103, 1101, 1104, 1105, 1106, 1104, 1104,
+	1104, 1104, 1101, 1086, 1086, 1087, 1088, 1091,
+	1092, 1091, 1092, 1085, 1108, 1107, 1073, 1109,
+	1109, 1110, 1111, 1112, 1113, 755, 1109, 1109,
+	1110, 1111, 1112, 1113, 1114, 1114, 1114, 1115,
+	1117, 1117, 1118, 1119, 1120, 1121, 1120, 1122,
+	1116, 1124, 1124, 1125, 1126, 1127, 1128, 1129,
+	1127, 1130, 1131, 1130, 1132, 1127, 1127, 1127,
+	1123, 1134, 1135, 1136, 1134, 1134, 1134, 1134,
+	1133, 1137, 1137, 1138, 1139, 1140, 1140, 1141,
+	1140, 1142, 1143, 1142, 1143, 1140, 1140, 1140,
+	1123, 1144, 1144, 1145, 1146, 1130, 1131, 1130,
+	1131, 89, 1148, 1147, 1149, 1134, 1151, 1150,
+	1152, 1150, 1153, 1154, 1155, 1153, 1153, 1153,
+	1153, 1150, 1137, 1137, 1138, 1139, 1142, 1143,
+	1142, 1143, 1123, 1148, 1157, 1147, 1156, 89,
+	1158, 1158, 1159, 1160, 1127, 1128, 1129, 1127,
+	1161, 1162, 1127, 1127, 1127, 1133, 1164, 1163,
+	755, 1166, 1165, 755, 1168, 1168, 1168, 1168,
+	1167, 1169, 1169, 1169, 1169, 1167, 1170, 1171,
+	1170, 1170, 1170, 1167, 1172, 1173, 1172, 1172,
+	1172, 1167, 1173, 1173, 1174, 1175, 1168, 1176,
+	1177, 1178, 1178, 1179, 1180, 1168, 1168, 1168,
+	1167, 1182, 1181, 1167, 1173, 1167, 1184, 1184,
+	1185, 1186, 1187, 1188, 1189, 1189, 1190, 1191,
+	1183, 1192, 1192, 1193, 1194, 1195, 1196, 1197,
+	1198, 1199, 1200, 1201, 1202, 1203, 1204, 1205,
+	1206, 1207, 1208, 1209, 1210, 1211, 1195, 1196,
+	1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204,
+	1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212,
+	1213, 1214, 1214, 1215, 1216, 1183, 1217, 1217,
+	1218, 1219, 1220, 1221, 1222, 1220, 1221, 1222,
+	1223, 1224, 1225, 1225, 1226, 1227, 1183, 1228,
+	1228, 1183, 1229, 1229, 1183, 1230, 1230, 1231,
+	1232, 1233, 1234, 1235, 1235, 1236, 1237, 1183,
+	1239, 1238, 1183, 1240, 1241, 1242, 1243, 1244,
+	1240, 1241, 1242, 1243, 1244, 1183, 1245, 1245,
+	1183, 1246, 1246, 1247, 1248, 1249, 1250, 1251,
+	1251, 1252, 1253, 1183, 1254, 1255, 1254, 1255,
+	1183, 1256, 1256, 1183, 1257, 1257, 1183, 1258,
+	1258, 1183, 1259, 1259, 1183, 1260, 1260, 1261,
+	1262, 1263, 1264, 1265, 1265, 1266, 1267, 1183,
+	1268, 1268, 1269, 1270, 1271, 1272, 1273, 1273,
+	1274, 1275, 1183, 1276, 1276, 1183, 1277, 1277,
+	1183, 1278, 1278, 1279, 1280, 1281, 1282, 1283,
+	1283, 1284, 1285, 1183, 1286, 1286, 1183, 1287,
+	1287, 1183, 1288, 1288, 1183, 1289, 1289, 1290,
+	1291, 1292, 1293, 1294, 1294, 1295, 1296, 1183,
+	1297, 1297, 1183, 1298, 1298, 1183, 1299, 1299,
+	1183, 1300, 1300, 1301, 1302, 1303, 1304, 1305,
+	1305, 1306, 1307, 1183, 1308, 1309, 1310, 1308,
+	1309, 1310, 1183, 1311, 1311, 1183, 1312, 1312,
+	1183, 1313, 1313, 1183, 1314, 1314, 1315, 1316,
+	1317, 1318, 1319, 1319, 1320, 1321, 1183, 1322,
+	1323, 1322, 1323, 1183, 1324, 1324, 1183, 1325,
+	1325, 1183, 1326, 1326, 1327, 1328, 1329, 1330,
+	1331, 1331, 1332, 1333, 1183, 1334, 1334, 1183,
+	1335, 1335, 1183, 1336, 1336, 1183, 1337, 1337,
+	1338, 1339, 1340, 1341, 1342, 1342, 1343, 1344,
+	1183, 1345, 1345, 1346, 1347, 1348, 1349, 1350,
+	1350, 1351, 1352, 1183, 1353, 1353, 1183, 1354,
+	1354, 1183, 1355, 1356, 1183, 1357, 1183, 1358,
+	1358, 1359, 1360, 1361, 1362, 1363, 1363, 1364,
+	1365, 1183, 1366, 1183, 1367, 1367, 1368, 1369,
+	1370, 1371, 1372, 1372, 1373, 1374, 1183, 1375,
+	1375, 1183, 1376, 1376, 1183, 1377, 1377, 1183,
+	1378, 1378, 1183, 1379, 1379, 1380, 1381, 1382,
+	1383, 1384, 1384, 1385, 1386, 1183, 1387, 1387,
+	1183, 1388, 1388, 1183, 1389, 1389, 1183, 1390,
+	1390, 1183, 1391, 1391, 1183, 1392, 1392, 1183,
+	1393, 1393, 1183, 1394, 1394, 1395, 1396, 1397,
+	1398, 1399, 1399, 1400, 1401, 1183, 1402, 1403,
+	1402, 1403, 1183, 1404, 1404, 1183, 1405, 1405,
+	1406, 1407, 1408, 1409, 1410, 1410, 1411, 1412,
+	1183, 1413, 1413, 1414, 1415, 1416, 1417, 1418,
+	1418, 1419, 1420, 1183, 1421, 1422, 1423, 1424,
+	1423, 1424, 1183, 1425, 1183, 1426, 1426, 1427,
+	1428, 1429, 1430, 1431, 1431, 1432, 1433, 1183,
+	1434, 1183, 1435, 1435, 1436, 1437, 1438, 1439,
+	1440, 1440, 1441, 1442, 1183, 1443, 1443, 1183,
+	1444, 1444, 1445, 1446, 1447, 1448, 1449, 1449,
+	1450, 1451, 1183, 1452, 1452, 1453, 1454, 1455,
+	1456, 1457, 1457, 1458, 1459, 1183, 1460, 1461,
+	1460, 1461, 1183, 1462, 1462, 1183, 1463, 1463,
+	1183, 1464, 1464, 1183, 1465, 1465, 1466, 1467,
+	1468, 1469, 1470, 1470, 1471, 1472, 1183, 1473,
+	1473, 1474, 1475, 1476, 1477, 1478, 1478, 1479,
+	1480, 1183, 1481, 1482, 1483, 1481, 1482, 1483,
+	1183, 1484, 1484, 1183, 1485, 1485, 1183, 1486,
+	1486, 1183, 1487, 1487, 1488, 1489, 1490, 1491,
+	1492, 1492, 1493, 1494, 1183, 1495, 1495, 1183,
+	1496, 1496, 1497, 1498, 1499, 1500, 1501, 1501,
+	1502, 1503, 1183, 1504, 1504, 1505, 1506, 1507,
+	1507, 1508, 1509, 1510, 1510, 1511, 1512, 1183,
+	1513, 1513, 1183, 1514, 1514, 1515, 1516, 1517,
+	1518, 1519, 1520, 1520, 1521, 1522, 1183, 1523,
+	1523, 1524, 1525, 1526, 1526, 1527, 1528, 1529,
+	1529, 1530, 1531, 1183, 1532, 1532, 1183, 1533,
+	1533, 1183, 1534, 1534, 1183, 1535, 1535, 1183,
+	1536, 1536, 1537, 1538, 1539, 1540, 1541, 1541,
+	1542, 1543, 1183, 1544, 1544, 1183, 1545, 1545,
+	1183, 1546, 1546, 1183, 1547, 1547, 1183, 1548,
+	1548, 1183, 1549, 1549, 1183, 1550, 1550, 1183,
+	1551, 1551, 1183, 1552, 1552, 1183, 1553, 1553,
+	1554, 1555, 1556, 1557, 1558, 1558, 1559, 1560,
+	1183, 1561, 1561, 1183, 1562, 1562, 1183, 1563,
+	1563, 1564, 1565, 1566, 1567, 1568, 1568, 1569,
+	1570, 1183, 1571, 1572, 1573, 1571, 1572, 1573,
+	1183, 1574, 1574, 1575, 1576, 1577, 1578, 1579,
+	1579, 1580, 1581, 1183, 1582, 1582, 1183, 1583,
+	1583, 1183, 1584, 1584, 1183, 1585, 1585, 1586,
+	1587, 1588, 1589, 1590, 1590, 1591, 1592, 1183,
+	1593, 1593, 1594, 1595, 1596, 1597, 1598, 1598,
+	1599, 1600, 1183, 1601, 1602, 1603, 1604, 1605,
+	1601, 1602, 1603, 1604, 1605, 1183, 1606, 1606,
+	1183, 1607, 1607, 1183, 1608, 1608, 1183, 1609,
+	1609, 1183, 1610, 1610, 1611, 1612, 1613, 1614,
+	1615, 1615, 1616, 1617, 1183, 1618, 1618, 1183,
+	1619, 1619, 1620, 1621, 1622, 1623, 1624, 1624,
+	1625, 1626, 1183, 1627, 1627, 1183, 1628, 1628,
+	1629, 1630, 1631, 1632, 1633, 1633, 1634, 1635,
+	1183, 1636, 1636, 1183, 1637, 1637, 1638, 1639,
+	1640, 1641, 1642, 1642, 1643, 1644, 1183, 1645,
+	1645, 1183, 1646, 1646, 1183, 1647, 1647, 1183,
+	1648, 1648, 1649, 1650, 1651, 1652, 1653, 1653,
+	1654, 1655, 1183, 1656, 1657, 1658, 1656, 1657,
+	1658, 1183, 1659, 1659, 1183, 1660, 1660, 1183,
+	1661, 1661, 1662, 1663, 1664, 1665, 1666, 1666,
+	1667, 1668, 1183, 1669, 1669, 1183, 1670, 1670,
+	1671, 1672, 1673, 1674, 1675, 1675, 1676, 1677,
+	1183, 1678, 1678, 1183, 1679, 1679, 1183, 1680,
+	1183, 1681, 1681, 1682, 1683, 1685, 1686, 1687,
+	1687, 1688, 1689, 1684, 1183, 1690, 1690, 1183,
+	1691, 1691, 1183, 1692, 1692, 1693, 1694, 1695,
+	1696, 1697, 1697, 1698, 1699, 1183, 1700, 1700,
+	1183, 1701, 1701, 1183, 1702, 1702, 1183, 1703,
+	1703, 1183, 1704, 1704, 1183, 1705, 1705, 1706,
+	1707, 1708, 1709, 1710, 1710, 1711, 1712, 1183,
+	1713, 1713, 1183, 1714, 1714, 1183, 1715, 1715,
+	1183, 1716, 1716, 1717, 1718, 1719, 1720, 1721,
+	1721, 1722, 1723, 1183, 1724, 1724, 1183, 1725,
+	1725, 1726, 1727, 1728, 1729, 1730, 1730, 1731,
+	1732, 1183, 1734, 1734, 1735, 1736, 1737, 1738,
+	1733, 1734, 1734, 1735, 1736, 1737, 1738, 1740,
+	1739, 1741, 1741, 1742, 1743, 1745, 1746, 1744,
+	1739, 1748, 1748, 1749, 1750, 1752, 1753, 1751,
+	1751, 1751, 1747, 1754, 1754, 1754, 1747, 1755,
+	1755, 1756, 1757, 1758, 1759, 1760, 1760, 1761,
+	1762, 1751, 1751, 1751, 1747, 1764, 1763, 1747,
+	1766, 1765, 1733, 1768, 1767, 1733, 1769, 1769,
+	1770, 1771, 1772, 1773, 1733, 1769, 1769, 1770,
+	1771, 1774, 1772, 1773, 1775, 1739, 1776, 1776,
+	1777, 1778, 1780, 1780, 1781, 1782, 1779, 1739,
+	1783, 1783, 1784, 1785, 1787, 1788, 1786, 1786,
+	1786, 1747, 1789, 1789, 1789, 1747, 1790, 1790,
+	1791, 1792, 1793, 1794, 1795, 1795, 1796, 1797,
+	1786, 1786, 1786, 1747, 1799, 1798, 1747, 1801,
+	1800, 1733, 1802, 1802, 1803, 1804, 1805, 1806,
+	1779, 1739, 1808, 1807, 1733, 1811, 1812, 1813,
+	1814, 1815, 1811, 1812, 1813, 1814, 1815, 1810,
+	1809, 1816, 1816, 1816, 1816, 1817, 1809, 1818,
+	1819, 1818, 1819, 1809, 1820, 1820, 1820, 1820,
+	1809, 1821, 1821, 1809, 1822, 1823, 1822, 1822,
+	1822, 1809, 1824, 1824, 1809, 1825, 1825, 1809,
+	1826, 1826, 1809, 1827, 1827, 1809, 1828, 1809,
+	1829, 1809, 1830, 1830, 1809, 1831, 1831, 1809,
+	1832, 1832, 1809, 1833, 1809, 1834, 1834, 1834,
+	1834, 1809, 1835, 1836, 1835, 1836, 1809, 1837,
+	1838, 1837, 1838, 1809, 1839, 1809, 1840, 1840,
+	1809, 1841, 1841, 1809, 1842, 1842, 1809, 1843,
+	1843, 1809, 1844, 1844, 1844, 1844, 1809, 1845,
+	1845, 1809, 1846, 1846, 1809, 1847, 1847, 1809,
+	1848, 1849, 1809, 1850, 1809, 1851, 1809, 1852,
+	1852, 1809, 1853, 1853, 1809, 1854, 1854, 1809,
+	1855, 1809, 1856, 1809, 1857, 1809, 1858, 1858,
+	1858, 1858, 1809, 1859, 1809, 1860, 1809, 1861,
+	1861, 1809, 1862, 1862, 1809, 1863, 1863, 1809,
+	1864, 1809, 1865, 1809, 1866, 1809, 1867, 1867,
+	1867, 1867, 1809, 1868, 1869, 1809, 1870, 1809,
+	1871, 1809, 1872, 1809, 1873, 1809, 1874, 1874,
+	1874, 1874, 1809, 1875, 1809, 1876, 1809, 1877,
+	1877, 1877, 1877, 1809, 1878, 1878, 1809, 1879,
+	1879, 1809, 1880, 1880, 1809, 1881, 1881, 1809,
+	1882, 1882, 1809, 1883, 1883, 1809, 1884, 1884,
+	1809, 1885, 1885, 1885, 1885, 1809, 1886, 1886,
+	1809, 1887, 1887, 1809, 1888, 1888, 1809, 1889,
+	1889, 1809, 1890, 1890, 1809, 1891, 1891, 1809,
+	1892, 1893, 1892, 1893, 1809, 1894, 1894, 1809,
+	1895, 1895, 1809, 1896, 1896, 1896, 1896, 1809,
+	1897, 1897, 1809, 1898, 1898, 1809, 1899, 1899,
+	1899, 1899, 1809, 1900, 1900, 1809, 1901, 1901,
+	1809, 1902, 1903, 1902, 1903, 1809, 1904, 1904,
+	1809, 1905, 1809, 1906, 1906, 1906, 1906, 1809,
+	1907, 1907, 1809, 1908, 1908, 1809, 1909, 1910,
+	1911, 1809, 1912, 1913, 1912, 1912, 1912, 1809,
+	1914, 1914, 1809, 1915, 1915, 1809, 1916, 1916,
+	1809, 1917, 1917, 1809, 1918, 1809, 1919, 1809,
+	1920, 1920, 1809, 1921, 1921, 1809, 1922, 1922,
+	1809, 1923, 1809, 1924, 1924, 1924, 1924, 1809,
+	1925, 1809, 1926, 1809, 1927, 1927, 1927, 1927,
+	1809, 1928, 1809, 1929, 1809, 1930, 1930, 1930,
+	1930, 1809, 1933, 1934, 1935, 1936, 1937, 1938,
+	1933, 1934, 1935, 1936, 1937, 1938, 1932, 1931,
+	1939, 1939, 1939, 1939, 1940, 1931, 1941, 1941,
+	1931, 1942, 1942, 1931, 1943, 1943, 1931, 1944,
+	1944, 1931, 1945, 1945, 1931, 1946, 1946, 1946,
+	1946, 1931, 1947, 1948, 1949, 1947, 1948, 1949,
+	1931, 1950, 1950, 1931, 1951, 1951, 1931, 1952,
+	1952, 1931, 1953, 1953, 1931, 1954, 1954, 1931,
+	1955, 1955, 1955, 1955, 1931, 1956, 1957, 1956,
+	1957, 1931, 1958, 1958, 1931, 1959, 1959, 1959,
+	1959, 1931, 1960, 1960, 1931, 1961, 1961, 1931,
+	1962, 1962, 1962, 1962, 1931, 1963, 1963, 1931,
+	1964, 1964, 1931, 1965, 1965, 1931, 1966, 1966,
+	1966, 1966, 1931, 1967, 1967, 1931, 1968, 1968,
+	1931, 1969, 1969, 1969, 1969, 1931, 1970, 1971,
+	1970, 1971, 1931, 1972, 1972, 1931, 1973, 1973,
+	1973, 1973, 1931, 1974, 1974, 1931, 1975, 1975,
+	1931, 1976, 1976, 1976, 1976, 1931, 1977, 1977,
+	1931, 1978, 1978, 1931, 1979, 1979, 1931, 1980,
+	1980, 1980, 1980, 1931, 1981, 1981, 1931, 1982,
+	1982, 1931, 1983, 1983, 1983, 1983, 1931, 1985,
+	1985, 1984, 1986, 1987, 1986, 1986, 1986, 1987,
+	1984, 1988, 1988, 1988, 1988, 1988, 1988, 75,
+	1989, 1989, 1989, 1989, 75, 1990, 1990, 1990,
+	1990, 1990, 1990, 75, 1991, 1991, 1992, 1993,
+	1994, 1995, 75, 1996, 1996, 1997, 1998, 1999,
+	1999, 1999, 2000, 2001, 1999, 1999, 1999, 75,
+	2002, 2002, 2003, 2004, 2005, 2006, 75, 2008,
+	2008, 2009, 2010, 2012, 2013, 2011, 2007, 2014,
+	2014, 2015, 2016, 2018, 2019, 2017, 2007, 2020,
+	2020, 2021, 2022, 2024, 2025, 2023, 2007, 2027,
+	2027, 2028, 2029, 2031, 2032, 2033, 2034, 2035,
+	2031, 2032, 2033, 2034, 2035, 2036, 2037, 2030,
+	2026, 2038, 2038, 2039, 2040, 2042, 2043, 2041,
+	2007, 2044, 2044, 2045, 2046, 2048, 2049, 2050,
+	2051, 2052, 2048, 2049, 2050, 2051, 2052, 2053,
+	2054, 2047, 2026, 2055, 2055, 2056, 2057, 2059,
+	2060, 2058, 2007, 2061, 2061, 2062, 2063, 2065,
+	2066, 2067, 2068, 2069, 2065, 2066, 2067, 2068,
+	2069, 2070, 2071, 2064, 2026, 2072, 2072, 2073,
+	2074, 2076, 2077, 2075, 2007, 2078, 2078, 2080,
+	2081, 2082, 2083, 2084, 2080, 2081, 2082, 2083,
+	2084, 2078, 2078, 2079, 2026, 2078, 2078, 2078,
+	2078, 2085, 2026, 2087, 2088, 2089, 2090, 2091,
+	2087, 2088, 2089, 2090, 2091, 2086, 2026, 2092,
+	2092, 2092, 2092, 2093, 2026, 2095, 2094, 75,
+	2061, 2061, 2062, 2063, 2070, 2071, 2096, 2026,
+	2098, 2099, 2100, 2101, 2102, 2098, 2099, 2100,
+	2101, 2102, 2097, 2026, 2103, 2103, 2104, 2105,
+	2107, 2108, 2106, 2026, 2110, 2109, 75, 2044,
+	2044, 2045, 2046, 2053, 2054, 2111, 2026, 2113,
+	2114, 2115, 2116, 2117, 2113, 2114, 2115, 2116,
+	2117, 2112, 2026, 2118, 2118, 2119, 2120, 2122,
+	2123, 2121, 2026, 2125, 2124, 75, 2027, 2027,
+	2028, 2029, 2036, 2037, 2126, 2026, 2128, 2129,
+	2130, 2131, 2132, 2128, 2129, 2130, 2131, 2132,
+	2127, 2026, 2133, 2133, 2134, 2135, 2137, 2138,
+	2136, 2026, 2140, 2139, 75, 2142, 2141, 75,
+	2144, 2143, 75, 75, 75, 75, 75, 2145,
+	2146, 2146, 2147, 2148, 2149, 2150, 75, 2152,
+	2152, 2153, 2154, 2155, 2156, 2151, 2151, 2151,
+	75, 2157, 2157, 2157, 2157, 75, 2159, 2158,
+	75, 2160, 2160, 2160, 2160, 2160, 2160, 75,
+	2161, 2161, 2162, 2163, 2164, 2165, 75, 2166,
+	2166, 2167, 2168, 2169, 2169, 2169, 2170, 2171,
+	2169, 2169, 2169, 75, 2172, 2172, 2172, 2172,
+	75, 2174, 2173, 75, 2175, 2007, 2176, 2176,
+	2177, 2178, 2180, 2181, 2179, 2007, 2182, 2182,
+	2183, 2184, 2185, 2185, 2185, 2186, 2187, 2185,
+	2185, 2185, 75, 2188, 2188, 2188, 2188, 75,
+	2190, 2189, 75, 2192, 2192, 2192, 2192, 2191,
+	2193, 2193, 2194, 2195, 2196, 2197, 2198, 2198,
+	2199, 2200, 2192, 2202, 2202, 2203, 2204, 2205,
+	2206, 2207, 2207, 2208, 2209, 2201, 2201, 2201,
+	2192, 2211, 2210, 2192, 2212, 2212, 2212, 2212,
+	1984, 2213, 2214, 2213, 2213, 2213, 2214, 2214,
+	2214, 1984, 2216, 2215, 2217, 2217, 2218, 2219,
+	2221, 2222, 2220, 2215, 2223, 2223, 2224, 2225,
+	2227, 2228, 2229, 2230, 2226, 2215, 2231, 2231,
+	2232, 2233, 2235, 2236, 2234, 2215, 2237, 2237,
+	2238, 2239, 2227, 2228, 2241, 2242, 2240, 2215,
+	2243, 2243, 2244, 2245, 2246, 2248, 2249, 2247,
+	2215, 2250, 2250, 2251, 2252, 2227, 2228, 2253,
+	2254, 2215, 2255, 2255, 2256, 2257, 2258, 2259,
+	2215, 2255, 2255, 2256, 2257, 2258, 2259, 2260,
+	2215, 2261, 2261, 2262, 2263, 2265, 2266, 2264,
+	2215, 2267, 2267, 2268, 2269, 2271, 2272, 2273,
+	2274, 2270, 2215, 2275, 2275, 2276, 2277, 2279,
+	2280, 2278, 2215, 2281, 2281, 2282, 2283, 2271,
+	2272, 2285, 2286, 2284, 2215, 2287, 2287, 2288,
+	2289, 2290, 2292, 2293, 2291, 2215, 2294, 2294,
+	2295, 2296, 2271, 2272, 2297, 2298, 2215, 2299,
+	2299, 2300, 2301, 2302, 2303, 2215, 2299, 2299,
+	2300, 2301, 2304, 2302, 2303, 2305, 2215, 2306,
+	2215, 2307, 2307, 2308, 2309, 2310, 2312, 2313,
+	2314, 2315, 2315, 2316, 2317, 2311, 2215, 2318,
+	2318, 2319, 2320, 2322, 2323, 2324, 2324, 2325,
+	2326, 2321, 2215, 2327, 2327, 2328, 2329, 2330,
+	2332, 2333, 2334, 2335, 2335, 2336, 2337, 2331,
+	2215, 2338, 2338, 2339, 2340, 2342, 2343, 2324,
+	2324, 2344, 2345, 2341, 2215, 2346, 2346, 2347,
+	2348, 2349, 2351, 2352, 2353, 2354, 2354, 2355,
+	2356, 2350, 2215, 2357, 2357, 2358, 2359, 2361,
+	2362, 2324, 2324, 2363, 2364, 2360, 2215, 2365,
+	2365, 2366, 2367, 2368, 2365, 2370, 2371, 2372,
+	2372, 2373, 2374, 2369, 2215, 2375, 2375, 2376,
+	2377, 2378, 2379, 2324, 2324, 2380, 2381, 2215,
+	2383, 2382, 2215, 2384, 2384, 2385, 2386, 2384,
+	2388, 2389, 2390, 2390, 2391, 2392, 2387, 2215,
+	2365, 2365, 2366, 2367, 2365, 2370, 2371, 2372,
+	2372, 2373, 2374, 2393, 2215, 2395, 2394, 2215,
+	2396, 2396, 2397, 2398, 2400, 2401, 2402, 2403,
+	2403, 2404, 2405, 2399, 2215, 2346, 2346, 2347,
+	2348, 2351, 2352, 2353, 2354, 2354, 2355, 2356,
+	2406, 2215, 2357, 2357, 2358, 2359, 2361, 2362,
+	2324, 2324, 2363, 2364, 2215, 2408, 2407, 2215,
+	2409, 2409, 2410, 2411, 2413, 2414, 2415, 2416,
+	2416, 2417, 2418, 2412, 2215, 2327, 2327, 2328,
+	2329, 2332, 2333, 2334, 2335, 2335, 2336, 2337,
+	2419, 2215, 2338, 2338, 2339, 2340, 2342, 2343,
+	2324, 2324, 2344, 2345, 2215, 2421, 2420, 2215,
+	2422, 2422, 2423, 2424, 2426, 2427, 2428, 2429,
+	2429, 2430, 2431, 2425, 2215, 2307, 2307, 2308,
+	2309, 2312, 2313, 2314, 2315, 2315, 2316, 2317,
+	2432, 2215, 2318, 2318, 2319, 2320, 2322, 2323,
+	2324, 2324, 2325, 2326, 2215, 2434, 2433, 2215,
+	2435, 2435, 2436, 2437, 2438, 2439, 2215, 2441,
+	2440, 2215, 2442, 2442, 2443, 2444, 2446, 2447,
+	2445, 2215, 2287, 2287, 2288, 2289, 2292, 2293,
+	2448, 2215, 2450, 2449, 2215, 2452, 2451, 2215,
+	2454, 2453, 2215, 2455, 2455, 2456, 2457, 2458,
+	2459, 2215, 2461, 2460, 2215, 2462, 2462, 2463,
+	2464, 2466, 2467, 2465, 2215, 2243, 2243, 2244,
+	2245, 2248, 2249, 2468, 2215, 2470, 2469, 2215,
+	2472, 2471, 2215, 2473, 2007, 2474, 2474, 2475,
+	2476, 2478, 2479, 2477, 2007, 2480, 2480, 2481,
+	2482, 2484, 2485, 2483, 2007, 2486, 2486, 2487,
+	2488, 2490, 2491, 2489, 2007, 2492, 2492, 2493,
+	2494, 2496, 2497, 2495, 2007, 2498, 2498, 2499,
+	2500, 2502, 2503, 2501, 2007, 2504, 2504, 2505,
+	2506, 2507, 2507, 2507, 2508, 2509, 2507, 2507,
+	2507, 75, 2510, 2510, 2510, 2510, 75, 2512,
+	2511, 75, 2514, 2513, 75, 2516, 2515, 75,
+	2517, 2007, 2518, 2518, 2519, 2520, 2522, 2523,
+	2521, 2007, 2524, 2524, 2525, 2526, 2528, 2529,
+	2527, 2007, 2530, 2530, 2531, 2532, 2534, 2535,
+	2533, 2007, 2537, 2537, 2538, 2539, 2540, 2541,
+	2536, 2536, 2536, 75, 2542, 2542, 2543, 2544,
+	2545, 2546, 75, 2548, 2548, 2549, 2550, 2551,
+	2552, 2547, 2547, 2547, 75, 2553, 2553, 2554,
+	2555, 2556, 2557, 75, 2559, 2559, 2560, 2561,
+	2562, 2563, 2558, 2558, 2558, 75, 2564, 2564,
+	2565, 2566, 2567, 2568, 75, 2569, 2569, 2570,
+	2571, 2572, 2572, 2572, 2573, 2574, 2572, 2572,
+	2572, 75, 2575, 2575, 2575, 2575, 75, 2577,
+	2576, 75, 2579, 2578, 75, 2581, 2580, 75,
+	2583, 2582, 75, 2585, 2584, 75, 2586, 2586,
+	2586, 75, 2587, 2587, 2588, 2589, 2590, 2591,
+	75, 2587, 2587, 2588, 2589, 2590, 2591, 2592,
+	2007, 2593, 2593, 2594, 2595, 2597, 2598, 2596,
+	2007, 2599, 2599, 2600, 2601, 2603, 2604, 2602,
+	2602, 2602, 75, 2605, 2605, 2606, 2607, 2608,
+	2609, 75, 2605, 2605, 2606, 2607, 2610, 2608,
+	2609, 2610, 2610, 2610, 75, 2611, 2611, 75,
+	2613, 2612, 75, 2615, 2614, 75, 2617, 2616,
+	75, 2619, 2619, 2620, 2621, 2622, 2623, 2624,
+	2625, 2626, 2627, 2627, 2628, 2629, 2618, 2630,
+	2631, 2618, 2632, 2618, 2634, 2634, 2633, 2636,
+	2635, 2633, 2637, 2618, 2638, 2638, 2639, 2640,
+	2642, 2643, 2644, 2644, 2645, 2646, 2641, 2618,
+	2648, 2647, 75, 2649, 2618, 2650, 2650, 2650,
+	2650, 2633, 2652, 2651, 2651, 2651, 2633, 2653,
+	2007, 2654, 2654, 2655, 2656, 2658, 2659, 2657,
+	2007, 2660, 2660, 2661, 2662, 2664, 2665, 2663,
+	2663, 2663, 75, 2666, 2666, 2667, 2668, 2669,
+	2670, 75, 2666, 2666, 2667, 2668, 2669, 2670,
+	2671, 2007, 2672, 2672, 2673, 2674, 2676, 2677,
+	2675, 2007, 2679, 2679, 2680, 2681, 2683, 2684,
+	2682, 2682, 2682, 2678, 2685, 2685, 2685, 2678,
+	2686, 2686, 2687, 2688, 2689, 2690, 2691, 2691,
+	2692, 2693, 2682, 2682, 2682, 2678, 2695, 2694,
+	2678, 2697, 2696, 75, 2699, 2698, 75, 2701,
+	2700, 75, 2702, 2007, 2703, 2703, 2704, 2705,
+	2707, 2708, 2706, 2007, 2709, 2709, 2710, 2711,
+	2713, 2714, 2712, 2007, 2715, 2715, 2716, 2717,
+	2719, 2720, 2718, 2007, 2721, 2721, 2722, 2723,
+	2725, 2726, 2724, 2724, 2724, 2678, 2727, 2727,
+	2727, 2678, 2728, 2728, 2729, 2730, 2731, 2732,
+	2733, 2733, 2734, 2735, 2724, 2724, 2724, 2678,
+	2737, 2736, 2678, 2739, 2738, 75, 2741, 2740,
+	75, 2742, 2007, 2743, 2743, 2744, 2745, 2747,
+	2748, 2746, 2007, 2750, 2750, 2751, 2752, 2753,
+	2754, 2755, 2756, 2757, 2758, 2749, 2759, 2759,
+	2760, 2761, 2762, 2763, 2749, 2759, 2759, 2760,
+	2761, 2762, 2763, 2765, 2764, 2766, 2766, 2767,
+	2768, 2770, 2771, 2769, 2764, 2772, 2772, 2773,
+	2774, 2775, 2776, 2777, 2749, 2779, 2779, 2780,
+	2781, 2782, 2782, 2783, 2784, 2785, 2785, 2786,
+	2787, 2788, 2788, 2788, 2788, 2789, 2790, 2788,
+	2788, 2791, 2792, 2793, 2794, 2788, 2788, 2795,
+	2796, 2797, 2798, 2788, 2788, 2799, 2800, 2778,
+	2779, 2779, 2780, 2781, 2802, 2789, 2790, 2802,
+	2802, 2802, 2801, 2788, 2788, 2801, 2804, 2803,
+	2801, 2782, 2782, 2783, 2784, 2788, 2788, 2788,
+	2788, 2793, 2794, 2788, 2788, 2795, 2796, 2801,
+	2806, 2805, 2801, 2802, 2779, 2779, 2780, 2781,
+	2782, 2782, 2783, 2784, 2785, 2785, 2786, 2787,
+	2788, 2788, 2788, 2788, 2789, 2790, 2788, 2788,
+	2791, 2792, 2793, 2794, 2788, 2788, 2795, 2796,
+	2797, 2798, 2788, 2788, 2799, 2800, 2802, 2802,
+	2802, 2801, 2804, 2806, 2808, 2803, 2805, 2807,
+	2801, 2810, 2809, 2749, 2812, 2811, 2749, 2813,
+	2813, 2814, 2815, 2816, 2817, 2749, 2813, 2813,
+	2814, 2815, 2816, 2817, 2818, 2764, 2819, 2819,
+	2820, 2821, 2823, 2824, 2822, 2764, 2826, 2826,
+	2827, 2828, 2829, 2830, 2831, 2829, 2825, 2833,
+	2834, 2834, 2835, 2836, 2837, 2837, 2838, 2839,
+	2840, 2840, 2841, 2842, 2843, 2843, 2843, 2843,
+	2844, 2845, 2843, 2843, 2846, 2847, 2848, 2849,
+	2843, 2843, 2850, 2851, 2852, 2853, 2843, 2843,
+	2854, 2855, 2833, 2832, 2857, 2856, 2749, 2859,
+	2858, 2749, 2860, 2860, 2861, 2862, 2863, 2864,
+	2749, 2860, 2860, 2861, 2862, 2863, 2864, 2865,
+	2764, 2866, 2866, 2867, 2868, 2870, 2871, 2869,
+	2764, 2872, 2872, 2873, 2874, 2875, 2876, 2877,
+	2875, 2875, 2875, 2825, 2878, 2879, 2879, 2880,
+	2881, 2882, 2882, 2883, 2884, 2885, 2885, 2886,
+	2887, 2888, 2888, 2888, 2888, 2889, 2890, 2888,
+	2888, 2891, 2892, 2893, 2894, 2888, 2888, 2895,
+	2896, 2897, 2898, 2888, 2888, 2899, 2900, 2878,
+	2878, 2878, 2832, 2902, 2901, 2749, 2904, 2903,
+	2749, 2905, 2905, 2906, 2907, 2908, 2909, 2749,
+	2905, 2905, 2906, 2907, 2908, 2909, 2910, 2764,
+	2911, 2911, 2912, 2913, 2915, 2916, 2914, 2764,
+	2917, 2917, 2918, 2919, 2920, 2920, 2920, 2921,
+	2922, 2920, 2920, 2920, 2749, 2923, 2923, 2924,
+	2925, 2926, 2926, 2927, 2928, 2929, 2929, 2930,
+	2931, 2932, 2932, 2932, 2932, 2933, 2934, 2932,
+	2932, 2935, 2936, 2937, 2938, 2932, 2932, 2939,
+	2940, 2941, 2942, 2932, 2932, 2943, 2944, 2778,
+	2946, 2945, 2749, 2948, 2947, 2749, 2950, 2949,
+	75, 2952, 2953, 2954, 2955, 2956, 2957, 2958,
+	2959, 2960, 2961, 2962, 2963, 2964, 2965, 2966,
+	2967, 2968, 2952, 2953, 2954, 2955, 2956, 2957,
+	2958, 2959, 2960, 2961, 2962, 2963, 2964, 2965,
+	2966, 2967, 2968, 2951, 2969, 2969, 2970, 2971,
+	2972, 2973, 2974, 2972, 2973, 2974, 2975, 2976,
+	2951, 2977, 2977, 2978, 2979, 2981, 2982, 2980,
+	2980, 2980, 75, 2983, 2983, 2984, 2985, 2986,
+	2987, 75, 2983, 2983, 2984, 2985, 2986, 2987,
+	2988, 2007, 2989, 2989, 2990, 2991, 2993, 2994,
+	2992, 2007, 2995, 2995, 2996, 2997, 2999, 3000,
+	2998, 2007, 3001, 3001, 3002, 3003, 3005, 3006,
+	3004, 2007, 3008, 3008, 3009, 3010, 3012, 3013,
+	3011, 3007, 3014, 3014, 3015, 3016, 3018, 3019,
+	3017, 3007, 3020, 3020, 3021, 3022, 3024, 3025,
+	3023, 3007, 3026, 3026, 3027, 3028, 3030, 3031,
+	3029, 3007, 3032, 3032, 3033, 3034, 3036, 3037,
+	3035, 2007, 3038, 3038, 3039, 3040, 3042, 3043,
+	3041, 2007, 3044, 3044, 3045, 3046, 3047, 3047,
+	3047, 3048, 3049, 3047, 3047, 3047, 75, 3050,
+	3050, 3051, 3052, 3053, 3054, 75, 3055, 3055,
+	3056, 3057, 3058, 3059, 3060, 3058, 3058, 3058,
+	75, 3061, 3061, 75, 3063, 3062, 75, 3065,
+	3064, 75, 3067, 3066, 75, 3069, 3068, 75,
+	3071, 3070, 75, 3073, 3072, 75, 3075, 3074,
+	75, 3077, 3076, 75, 3078, 3078, 2951, 3079,
+	3079, 2951, 3080, 3080, 3081, 3082, 3083, 3084,
+	2951, 3085, 3085, 2951, 3086, 3086, 2951, 3087,
+	3087, 2951, 3088, 3088, 3089, 3090, 3091, 3092,
+	2951, 3093, 3093, 2951, 3094, 3094, 3095, 3096,
+	3097, 3098, 2951, 3099, 3100, 3101, 3102, 3103,
+	3099, 3100, 3101, 3102, 3103, 2951, 3104, 3104,
+	2951, 3105, 3105, 3106, 3107, 3108, 3109, 2951,
+	3110, 3111, 3110, 3111, 2951, 3112, 3112, 2951,
+	3113, 3113, 2951, 3114, 3114, 2951, 3115, 3115,
+	2951, 3116, 3116, 3117, 3118, 3119, 3120, 2951,
+	3121, 3121, 3122, 3123, 3124, 3125, 2951, 3126,
+	3126, 2951, 3127, 3127, 2951, 3128, 3128, 3129,
+	3130, 3131, 3132, 2951, 3133, 3133, 2951, 3134,
+	3134, 2951, 3135, 3135, 2951, 3136, 3136, 3137,
+	3138, 3139, 3140, 2951, 3141, 3141, 2951, 3142,
+	3142, 2951, 3143, 3143, 2951, 3144, 3144, 3145,
+	3146, 3147, 3148, 2951, 3149, 3150, 3151, 3149,
+	3150, 3151, 2951, 3152, 3152, 2951, 3153, 3153,
+	2951, 3154, 3154, 2951, 3155, 3155, 3156, 3157,
+	3158, 3159, 2951, 3160, 3161, 3160, 3161, 2951,
+	3162, 3162, 2951, 3163, 3163, 2951, 3164, 3164,
+	3165, 3166, 3167, 3168, 2951, 3169, 3169, 2951,
+	3170, 3170, 2951, 3171, 3171, 2951, 3172, 3172,
+	3173, 3174, 3175, 3176, 2951, 3177, 3177, 3178,
+	3179, 3180, 3181, 2951, 3182, 3182, 2951, 3183,
+	3183, 2951, 3184, 3185, 2951, 3186, 2951, 3187,
+	3187, 3188, 3189, 3190, 3191, 2951, 3192, 2951,
+	3193, 3193, 3194, 3195, 3196, 3197, 2951, 3198,
+	3198, 2951, 3199, 3199, 2951, 3200, 3200, 2951,
+	3201, 3201, 2951, 3202, 3202, 3203, 3204, 3205,
+	3206, 2951, 3207, 3207, 2951, 3208, 3208, 2951,
+	3209, 3209, 2951, 3210, 3210, 2951, 3211, 3211,
+	2951, 3212, 3212, 2951, 3213, 3213, 2951, 3214,
+	3214, 3215, 3216, 3217, 3218, 2951, 3219, 3220,
+	3219, 3220, 2951, 3221, 3221, 2951, 3222, 3222,
+	3223, 3224, 3225, 3226, 2951, 3227, 3227, 3228,
+	3229, 3230, 3231, 2951, 3232, 3233, 3234, 3235,
+	3234, 3235, 2951, 3236, 2951, 3237, 3237, 3238,
+	3239, 3240, 3241, 2951, 3242, 2951, 3243, 3243,
+	3244, 3245, 3246, 3247, 2951, 3248, 3248, 2951,
+	3249, 3249, 3250, 3251, 3252, 3253, 2951, 3254,
+	3254, 3255, 3256, 3257, 3258, 2951, 3259, 3260,
+	3259, 3260, 2951, 3261, 3261, 2951, 3262, 3262,
+	2951, 3263, 3263, 2951, 3264, 3264, 3265, 3266,
+	3267, 3268, 2951, 3269, 3269, 3270, 3271, 3272,
+	3273, 2951, 3274, 3275, 3276, 3274, 3275, 3276,
+	2951, 3277, 3277, 2951, 3278, 3278, 2951, 3279,
+	3279, 2951, 3280, 3280, 3281, 3282, 3283, 3284,
+	2951, 3285, 3285, 2951, 3286, 3286, 3287, 3288,
+	3289, 3290, 2951, 3291, 3291, 3292, 3293, 3294,
+	3294, 3295, 3296, 2951, 3297, 3297, 2951, 3298,
+	3298, 3299, 3300, 3301, 3302, 3303, 2951, 3304,
+	3304, 3305, 3306, 3307, 3307, 3308, 3309, 2951,
+	3310, 3310, 2951, 3311, 3311, 2951, 3312, 3312,
+	2951, 3313, 3313, 2951, 3314, 3314, 3315, 3316,
+	3317, 3318, 2951, 3319, 3319, 2951, 3320, 3320,
+	2951, 3321, 3321, 2951, 3322, 3322, 2951, 3323,
+	3323, 2951, 3324, 3324, 2951, 3325, 3325, 2951,
+	3326, 3326, 2951, 3327, 3327, 2951, 3328, 3328,
+	3329, 3330, 3331, 3332, 2951, 3333, 3333, 2951,
+	3334, 3334, 2951, 3335, 3335, 3336, 3337, 3338,
+	3339, 2951, 3340, 3341, 3342, 3340, 3341, 3342,
+	2951, 3343, 3343, 3344, 3345, 3346, 3347, 2951,
+	3348, 3348, 2951, 3349, 3349, 2951, 3350, 3350,
+	2951, 3351, 3351, 3352, 3353, 3354, 3355, 2951,
+	3356, 3356, 3357, 3358, 3359, 3360, 2951, 3361,
+	3362, 3363, 3364, 3365, 3361, 3362, 3363, 3364,
+	3365, 2951, 3366, 3366, 2951, 3367, 3367, 2951,
+	3368, 3368, 2951, 3369, 3369, 2951, 3370, 3370,
+	3371, 3372, 3373, 3374, 2951, 3375, 3375, 2951,
+	3376, 3376, 3377, 3378, 3379, 3380, 2951, 3381,
+	3381, 2951, 3382, 3382, 3383, 3384, 3385, 3386,
+	2951, 3387, 3387, 2951, 3388, 3388, 3389, 3390,
+	3391, 3392, 2951, 3393, 3393, 2951, 3394, 3394,
+	2951, 3395, 3395, 2951, 3396, 3396, 3397, 3398,
+	3399, 3400, 2951, 3401, 3402, 3403, 3401, 3402,
+	3403, 2951, 3404, 3404, 2951, 3405, 3405, 2951,
+	3406, 3406, 3407, 3408, 3409, 3410, 2951, 3411,
+	3411, 2951, 3412, 3412, 3413, 3414, 3415, 3416,
+	2951, 3417, 3417, 2951, 3418, 3418, 2951, 3420,
+	3419, 3421, 3421, 3422, 3423, 3425, 3426, 3424,
+	3419, 3427, 3427, 2951, 3428, 3428, 2951, 3429,
+	3429, 3430, 3431, 3432, 3433, 2951, 3434, 3434,
+	2951, 3435, 3435, 2951, 3436, 3436, 2951, 3437,
+	3437, 2951, 3438, 3438, 2951, 3439, 3439, 3440,
+	3441, 3442, 3443, 2951, 3444, 3444, 3444, 3444,
+	3444, 3444, 75, 3445, 3445, 3445, 3445, 75,
+	3446, 3446, 3446, 3446, 75, 3447, 2007, 3448,
+	3448, 3449, 3450, 3452, 3453, 3451, 2007, 3454,
+	3454, 3455, 3456, 3458, 3459, 3457, 2007, 3460,
+	3460, 3461, 3462, 3464, 3465, 3463, 2007, 3466,
+	3466, 3467, 3468, 3470, 3471, 3469, 3469, 3469,
+	75, 3472, 3472, 3473, 3474, 3475, 3476, 75,
+	3472, 3472, 3473, 3474, 3477, 3475, 3476, 3477,
+	3477, 3477, 75, 3478, 3478, 75, 3480, 3479,
+	75, 3482, 3481, 75, 3484, 3483, 75, 3485,
+	3485, 3485, 3485, 75, 3486, 3486, 75, 3487,
+	2007, 3488, 3488, 3489, 3490, 3492, 3493, 3491,
+	2007, 3494, 3494, 3495, 3496, 3498, 3499, 3497,
+	2007, 3500, 3500, 3501, 3502, 3504, 3505, 3503,
+	2007, 3506, 3506, 3507, 3508, 3510, 3511, 3509,
+	2007, 3512, 3512, 3513, 3514, 3516, 3517, 3515,
+	2007, 3518, 3518, 3519, 3520, 3521, 3523, 3524,
+	3522, 3522, 3522, 2678, 3525, 3525, 3526, 3527,
+	3528, 3529, 2678, 3531, 3531, 3532, 3533, 3535,
+	3536, 3534, 3534, 3534, 3530, 3537, 3537, 3537,
+	3530, 3539, 3538, 3538, 3538, 3530, 3540, 3540,
+	3540, 3530, 3542, 3541, 3541, 3541, 3530, 3544,
+	3543, 3543, 3543, 3530, 3545, 3545, 3545, 3530,
+	3547, 3546, 3546, 3546, 3530, 3548, 3548, 3548,
+	3548, 3549, 3549, 3549, 3530, 3550, 3550, 3550,
+	3550, 75, 3551, 3530, 3547, 3530, 3544, 3530,
+	3552, 3530, 3542, 3530, 3554, 3553, 75, 3555,
+	3555, 3555, 2678, 3525, 3525, 3526, 3527, 3528,
+	3529, 3556, 3556, 3556, 2678, 3558, 3557, 75,
+	3560, 3559, 75, 3562, 3561, 75, 3563, 2007,
+	3564, 3564, 3565, 3566, 3568, 3569, 3567, 2007,
+	3570, 3570, 3571, 3572, 3574, 3575, 3573, 2007,
+	3576, 3576, 3577, 3578, 3580, 3581, 3579, 2007,
+	3582, 3582, 3583, 3584, 3586, 3587, 3585, 2007,
+	3588, 3588, 3589, 3590, 3592, 3593, 3591, 2007,
+	3594, 3594, 3595, 3596, 3597, 3599, 3600, 3598,
+	3598, 3598, 2678, 3601, 3601, 3601, 3601, 2678,
+	3602, 3602, 3602, 2678, 3601, 3601, 3601, 3601,
+	3603, 3603, 3603, 2678, 3605, 3604, 75, 3607,
+	3606, 75, 3609, 3608, 75, 3610, 2007, 3611,
+	3611, 3612, 3613, 3615, 3616, 3614, 2007, 3617,
+	3617, 3618, 3619, 3621, 3622, 3620, 2007, 3623,
+	3623, 3624, 3625, 3627, 3628, 3626, 2007, 3629,
+	3629, 3630, 3631, 3633, 3634, 3632, 2007, 3635,
+	3635, 3636, 3637, 3639, 3640, 3638, 2007, 3641,
+	3641, 3642, 3643, 3645, 3646, 3644, 3644, 3644,
+	2678, 3647, 3647, 3647, 2678, 3648, 3648, 3649,
+	3650, 3651, 3652, 3653, 3653, 3654, 3655, 3644,
+	3644, 3644, 2678, 3657, 3656, 2678, 3659, 3658,
+	75, 3661, 3660, 75, 3663, 3662, 75, 3664,
+	2007, 3665, 3665, 3666, 3667, 3669, 3670, 3668,
+	2007, 3671, 3671, 3672, 3673, 3675, 3676, 3674,
+	2007, 3677, 3677, 3677, 3677, 3678, 2007, 3679,
+	3679, 3679, 3679, 75, 3681, 3680, 75, 3682,
+	2007, 3683, 3683, 3684, 3685, 3687, 3688, 3686,
+	2007, 3689, 3689, 3690, 3691, 3693, 3694, 3692,
+	2007, 3695, 3695, 3696, 3697, 3699, 3700, 3698,
+	2007, 3701, 3701, 3702, 3703, 3705, 3706, 3704,
+	2007, 3707, 3707, 3708, 3709, 3711, 3712, 3710,
+	2007, 3713, 3713, 3714, 3715, 3717, 3718, 3716,
+	3716, 3716, 2678, 3719, 3719, 3719, 2678, 3720,
+	3720, 3721, 3722, 3723, 3724, 3725, 3725, 3726,
+	3727, 3716, 3716, 3716, 2678, 3729, 3728, 2678,
+	3731, 3730, 75, 3733, 3732, 75, 3735, 3734,
+	75, 3736, 2007, 3737, 3737, 3738, 3739, 3741,
+	3742, 3740, 2007, 3743, 3743, 3744, 3745, 3746,
+	3747, 3748, 3746, 1984, 3749, 3750, 3749, 3749,
+	3749, 3750, 1984, 3752, 3751, 75, 3753, 2007,
+	3754, 3754, 3755, 3756, 3758, 3759, 3757, 2007,
+	3760, 3760, 3761, 3762, 3764, 3765, 3763, 3763,
+	3763, 2678, 3766, 3766, 3766, 2678, 3767, 3767,
+	3767, 2678, 3768, 3768, 3768, 2678, 3770, 3769,
+	3771, 3771, 3771, 2678, 3772, 3772, 3772, 2678,
+	3773, 3773, 3773, 2678, 3774, 3774, 3774, 2678,
+	3776, 3770, 3776, 3776, 3776, 3775, 3778, 3777,
+	75, 3779, 3779, 3779, 2678, 3780, 3780, 3780,
+	2678, 3782, 3781, 3783, 3783, 3783, 2678, 3784,
+	3784, 3784, 2678, 3785, 3782, 3785, 3785, 3785,
+	3781, 3786, 3786, 3786, 2678, 3787, 3787, 3787,
+	2678, 3788, 3781, 3789, 3789, 3789, 2678, 3790,
+	3790, 3790, 2678, 3791, 3788, 3791, 3791, 3791,
+	3781, 3792, 2007, 3793, 3793, 3794, 3795, 3797,
+	3798, 3796, 2007, 3799, 3799, 3800, 3801, 3803,
+	3804, 3802, 2007, 3805, 3805, 3806, 3807, 3809,
+	3810, 3808, 2007, 3812, 3812, 3813, 3814, 3815,
+	3816, 3811, 3811, 3811, 75, 3817, 3817, 3817,
+	3817, 75, 3819, 3818, 75, 3821, 3820, 75,
+	3822, 2007, 3823, 3823, 3824, 3825, 3827, 3828,
+	3826, 2007, 3830, 3830, 3831, 3832, 3833, 3834,
+	3829, 3829, 3829, 75, 3835, 3835, 3836, 3837,
+	3838, 3839, 75, 3841, 3841, 3842, 3843, 3844,
+	3845, 3840, 3840, 3840, 75, 3846, 3846, 3846,
+	3846, 75, 3848, 3847, 75, 3850, 3849, 75,
+	3852, 3852, 3853, 3854, 3855, 3856, 3856, 3856,
+	3857, 3858, 3859, 3860, 3856, 3856, 3856, 3851,
+	3861, 3861, 3862, 3863, 3864, 3865, 73, 3866,
+	3865, 3857, 3858, 3867, 3868, 3869, 3870, 3871,
+	3872, 73, 73, 3865, 73, 3865, 73, 3865,
+	73, 848, 3874, 3874, 3853, 3875, 3876, 3856,
+	3877, 3878, 3879, 3880, 3881, 3882, 3883, 3884,
+	3885, 3886, 3887, 3888, 3889, 3890, 3891, 3892,
+	3893, 3856, 3856, 3877, 3878, 3879, 3880, 3881,
+	3882, 3883, 3884, 3885, 3886, 3887, 3888, 3889,
+	3890, 3891, 3892, 3893, 3857, 3858, 3894, 3895,
+	3856, 3856, 3856, 3873, 3874, 3874, 3853, 3875,
+	3876, 3856, 3898, 3899, 3900, 3901, 3902, 3903,
+	3904, 3905, 3906, 3907, 3908, 3909, 3910, 3911,
+	3912, 3913, 3914, 3856, 3856, 3898, 3899, 3900,
+	3901, 3902, 3903, 3904, 3905, 3906, 3907, 3908,
+	3909, 3910, 3911, 3912, 3913, 3914, 3857, 3858,
+	3894, 3895, 3856, 3897, 3856, 3856, 3896, 3916,
+	3916, 3917, 3918, 3919, 3920, 3920, 3920, 3921,
+	3922, 3923, 3924, 3920, 3920, 3920, 3915, 3852,
+	3852, 3853, 3925, 3926, 3856, 3898, 3899, 3900,
+	3901, 3902, 3903, 3904, 3905, 3906, 3907, 3908,
+	3909, 3910, 3911, 3912, 3913, 3914, 3856, 3856,
+	3898, 3899, 3900, 3901, 3902, 3903, 3904, 3905,
+	3906, 3907, 3908, 3909, 3910, 3911, 3912, 3913,
+	3914, 3857, 3858, 3927, 3928, 3856, 3897, 3856,
+	3856, 3896, 3929, 3929, 3853, 3930, 3931, 3856,
+	3856, 3856, 87, 88, 3932, 3933, 3856, 3856,
+	3856, 848, 3934, 3934, 3862, 3935, 3936, 3865,
+	73, 3866, 3865, 87, 88, 3932, 3937, 105,
+	106, 3932, 3938, 73, 73, 3865, 73, 3865,
+	73, 3865, 73, 848, 3861, 3861, 3862, 3863,
+	3864, 3865, 73, 3941, 3942, 3943, 3944, 3945,
+	3946, 3947, 3948, 3949, 3950, 3951, 3952, 3953,
+	3954, 3955, 3956, 3957, 3866, 3865, 3941, 3942,
+	3943, 3944, 3945, 3946, 3947, 3948, 3949, 3950,
+	3951, 3952, 3953, 3954, 3955, 3956, 3957, 3857,
+	3858, 3867, 3868, 3869, 3870, 3871, 3872, 73,
+	73, 3865, 3940, 73, 3865, 73, 3865, 73,
+	3939, 3934, 3934, 3862, 3935, 3936, 3865, 73,
+	3941, 3942, 3943, 3944, 3945, 3946, 3947, 3948,
+	3949, 3950, 3951, 3952, 3953, 3954, 3955, 3956,
+	3957, 3866, 3865, 3941, 3942, 3943, 3944, 3945,
+	3946, 3947, 3948, 3949, 3950, 3951, 3952, 3953,
+	3954, 3955, 3956, 3957, 87, 88, 3958, 3937,
+	105, 106, 3958, 3938, 73, 73, 3865, 3940,
+	73, 3865, 73, 3865, 73, 3939, 755, 755,
+	755, 1009, 1006, 1009, 1008, 1009, 1006, 1010,
+	1006, 1005, 755, 755, 755, 1158, 1158, 1159,
+	1160, 1127, 1128, 1129, 1127, 1161, 1162, 1127,
+	1127, 1127, 1133, 755, 1173, 1173, 1174, 1175,
+	1168, 1176, 1177, 1178, 1178, 1179, 1180, 1168,
+	1168, 1168, 1167, 1182, 1181, 1167, 755, 1192,
+	1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199,
+	1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207,
+	1208, 1209, 1210, 1211, 1195, 1196, 1197, 1198,
+	1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206,
+	1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214,
+	1214, 1215, 1216, 1183, 1239, 1238, 1183, 755,
+	1755, 1755, 1756, 1757, 1758, 1759, 1760, 1760,
+	1761, 1762, 1751, 1751, 1751, 1747, 1764, 1763,
+	1747, 1783, 1783, 1784, 1785, 1787, 1788, 1786,
+	1786, 1786, 1747, 1733, 1790, 1790, 1791, 1792,
+	1793, 1794, 1795, 1795, 1796, 1797, 1786, 1786,
+	1786, 1747, 1799, 1798, 1747, 1801, 1800, 1733,
+	755, 755, 755, 755, 755, 755, 755, 755,
+	755, 2202, 2202, 2203, 2204, 2205, 2206, 2207,
+	2207, 2208, 2209, 2201, 2201, 2201, 2192, 2211,
+	2210, 2192, 755, 755, 2375, 2375, 2376, 2377,
+	2378, 2379, 2324, 2324, 2380, 2381, 2215, 2383,
+	2382, 2215, 2357, 2357, 2358, 2359, 2361, 2362,
+	2324, 2324, 2363, 2364, 2360, 2215, 2395, 2394,
+	2215, 2338, 2338, 2339, 2340, 2342, 2343, 2324,
+	2324, 2344, 2345, 2341, 2215, 2408, 2407, 2215,
+	2318, 2318, 2319, 2320, 2322, 2323, 2324, 2324,
+	2325, 2326, 2321, 2215, 2421, 2420, 2215, 755,
+	755, 755, 755, 2619, 2619, 2620, 2621, 2622,
+	2623, 2624, 2625, 2626, 2627, 2627, 2628, 2629,
+	2618, 2648, 2647, 75, 755, 2686, 2686, 2687,
+	2688, 2689, 2690, 2691, 2691, 2692, 2693, 2682,
+	2682, 2682, 2678, 2695, 2694, 2678, 755, 2728,
+	2728, 2729, 2730, 2731, 2732, 2733, 2733, 2734,
+	2735, 2724, 2724, 2724, 2678, 2737, 2736, 2678,
+	755, 2782, 2782, 2783, 2784, 2788, 2788, 2788,
+	2788, 2793, 2794, 2788, 2788, 2795, 2796, 2801,
+	2806, 2805, 2801, 2779, 2779, 2780, 2781, 2802,
+	2789, 2790, 2802, 2802, 2802, 2801, 2804, 2803,
+	2801, 2802, 2779, 2779, 2780, 2781, 2782, 2782,
+	2783, 2784, 2785, 2785, 2786, 2787, 2788, 2788,
+	2788, 2788, 2789, 2790, 2788, 2788, 2791, 2792,
+	2793, 2794, 2788, 2788, 2795, 2796, 2797, 2798,
+	2788, 2788, 2799, 2800, 2802, 2802, 2802, 2801,
+	2804, 2806, 2808, 2803, 2805, 2807, 2801, 755,
+	755, 755, 755, 755, 755, 755, 3648, 3648,
+	3649, 3650, 3651, 3652, 3653, 3653, 3654, 3655,
+	3644, 3644, 3644, 2678, 3657, 3656, 2678, 755,
+	755, 3720, 3720, 3721, 3722, 3723, 3724, 3725,
+	3725, 3726, 3727, 3716, 3716, 3716, 2678, 3729,
+	3728, 2678, 755, 755, 755, 755, 755, 755,
+	0
+};
+
+static const short _zone_scanner_trans_targs[] = {
+	0, 1, 1, 1, 2, 4, 17, 40,
+	54, 61, 168, 77, 81, 89, 95, 111,
+	121, 124, 131, 147, 157, 160, 1227, 176,
+	1232, 295, 0, 3, 3, 3, 2, 191,
+	191, 191, 191, 191, 3, 194, 0, 3,
+	3, 3, 4, 17, 40, 54, 61, 66,
+	77, 81, 89, 95, 111, 121, 124, 131,
+	147, 157, 160, 3, 194, 0, 5, 5,
+	5, 259, 262, 266, 5, 10, 6, 11,
+	20, 6, 5, 0, 5, 5, 9, 5,
+	10, 11, 20, 0, 7, 7, 7, 1227,
+	8, 0, 7, 7, 7, 1227, 8, 8,
+	1227, 6, 6, 10, 5, 12, 12, 12,
+	13, 1233, 201, 273, 12, 12, 12, 13,
+	1233, 201, 273, 13, 1228, 14, 0, 14,
+	14, 15, 197, 204, 205, 206, 207, 208,
+	209, 210, 211, 212, 213, 214, 215, 216,
+	217, 218, 219, 1235, 268, 1233, 269, 1236,
+	271, 0, 16, 16, 16, 1229, 298, 0,
+	16, 16, 16, 1229, 298, 18, 22, 29,
+	32, 36, 19, 5, 5, 5, 5, 10,
+	6, 11, 20, 21, 21, 21, 13, 21,
+	21, 21, 13, 23, 28, 24, 25, 26,
+	27, 5, 5, 5, 5, 10, 6, 11,
+	20, 5, 5, 5, 5, 10, 6, 11,
+	20, 30, 31, 5, 5, 5, 5, 10,
+	6, 11, 20, 33, 34, 35, 5, 5,
+	5, 5, 10, 6, 11, 20, 37, 38,
+	39, 5, 5, 5, 5, 10, 6, 11,
+	20, 41, 45, 53, 42, 43, 44, 5,
+	5, 5, 5, 10, 6, 11, 20, 46,
+	49, 47, 48, 5, 5, 5, 5, 10,
+	6, 11, 20, 50, 51, 52, 5, 5,
+	5, 5, 10, 6, 11, 20, 5, 5,
+	5, 5, 10, 6, 11, 20, 55, 56,
+	57, 59, 58, 5, 5, 5, 5, 10,
+	6, 11, 20, 60, 5, 5, 5, 5,
+	10, 6, 11, 20, 62, 63, 64, 65,
+	5, 5, 5, 5, 10, 6, 11, 20,
+	67, 70, 68, 68, 68, 68, 166, 68,
+	68, 68, 4, 17, 40, 54, 61, 69,
+	77, 81, 89, 95, 111, 121, 124, 131,
+	147, 157, 160, 68, 166, 71, 72, 73,
+	74, 75, 76, 5, 5, 5, 5, 10,
+	6, 11, 20, 78, 80, 79, 5, 5,
+	5, 5, 10, 6, 11, 20, 5, 5,
+	5, 5, 10, 6, 11, 20, 82, 84,
+	86, 88, 83, 5, 5, 5, 5, 10,
+	6, 11, 20, 85, 5, 5, 5, 5,
+	10, 6, 11, 20, 87, 5, 5, 5,
+	5, 10, 6, 11, 20, 5, 5, 5,
+	5, 10, 6, 11, 20, 90, 94, 91,
+	92, 93, 5, 5, 5, 5, 10, 6,
+	11, 20, 5, 5, 5, 5, 10, 6,
+	11, 20, 96, 100, 102, 97, 98, 99,
+	5, 5, 5, 5, 10, 6, 11, 20,
+	101, 5, 5, 5, 5, 10, 6, 11,
+	20, 5, 5, 5, 103, 5, 10, 6,
+	11, 20, 104, 5, 5, 5, 105, 5,
+	10, 6, 11, 20, 5, 5, 5, 106,
+	5, 10, 6, 11, 20, 107, 108, 109,
+	110, 5, 5, 5, 5, 10, 6, 11,
+	20, 112, 113, 114, 115, 116, 117, 118,
+	119, 120, 5, 5, 5, 5, 10, 6,
+	11, 20, 122, 123, 5, 5, 5, 5,
+	10, 6, 11, 20, 125, 126, 130, 5,
+	5, 5, 5, 10, 6, 11, 20, 127,
+	128, 129, 5, 5, 5, 5, 10, 6,
+	11, 20, 5, 5, 5, 5, 10, 6,
+	11, 20, 132, 137, 139, 141, 143, 133,
+	134, 135, 136, 5, 5, 5, 5, 10,
+	6, 11, 20, 138, 5, 5, 5, 5,
+	10, 6, 11, 20, 140, 5, 5, 5,
+	5, 10, 6, 11, 20, 142, 5, 5,
+	5, 5, 10, 6, 11, 20, 144, 145,
+	146, 5, 5, 5, 5, 10, 6, 11,
+	20, 148, 151, 153, 149, 150, 5, 5,
+	5, 5, 10, 6, 11, 20, 152, 5,
+	5, 5, 5, 10, 6, 11, 20, 154,
+	155, 0, 156, 0, 5, 5, 5, 156,
+	5, 10, 6, 11, 20, 158, 159, 5,
+	5, 5, 5, 10, 6, 11, 20, 161,
+	162, 163, 164, 165, 5, 5, 5, 5,
+	10, 6, 11, 20, 166, 68, 167, 167,
+	167, 1230, 296, 169, 170, 170, 170, 170,
+	175, 170, 170, 170, 171, 4, 17, 40,
+	54, 61, 69, 77, 81, 89, 95, 111,
+	121, 124, 131, 147, 157, 160, 170, 175,
+	68, 68, 68, 171, 172, 172, 172, 172,
+	172, 68, 166, 173, 173, 174, 174, 174,
+	174, 174, 68, 68, 68, 173, 68, 166,
+	175, 170, 176, 1227, 0, 178, 222, 228,
+	179, 180, 181, 182, 183, 184, 1231, 0,
+	186, 186, 186, 186, 187, 186, 186, 186,
+	186, 187, 187, 0, 186, 0, 189, 189,
+	189, 189, 190, 189, 189, 189, 189, 190,
+	190, 189, 192, 192, 193, 193, 193, 193,
+	193, 3, 3, 3, 192, 3, 194, 194,
+	3, 0, 196, 196, 196, 196, 275, 276,
+	277, 196, 196, 196, 196, 275, 276, 277,
+	0, 198, 198, 198, 1228, 13, 1233, 201,
+	1234, 273, 198, 198, 198, 1228, 1234, 199,
+	199, 199, 1232, 200, 200, 1232, 202, 202,
+	202, 1227, 8, 202, 202, 202, 8, 203,
+	203, 203, 220, 257, 220, 1235, 0, 223,
+	224, 225, 226, 227, 1231, 229, 230, 1231,
+	0, 199, 199, 199, 1232, 200, 0, 233,
+	233, 233, 1230, 234, 233, 233, 233, 1230,
+	234, 234, 1230, 0, 236, 236, 236, 1235,
+	220, 1236, 257, 236, 236, 236, 1235, 1236,
+	254, 0, 254, 254, 254, 255, 199, 199,
+	199, 1232, 200, 256, 1232, 256, 256, 200,
+	256, 256, 256, 200, 258, 258, 258, 220,
+	258, 258, 258, 220, 260, 261, 5, 5,
+	5, 5, 10, 6, 11, 20, 263, 264,
+	265, 5, 5, 5, 5, 10, 6, 11,
+	20, 267, 5, 5, 5, 5, 10, 6,
+	11, 20, 268, 1235, 270, 270, 270, 1227,
+	270, 270, 270, 1227, 272, 272, 272, 272,
+	272, 272, 274, 274, 274, 274, 274, 274,
+	275, 196, 203, 203, 203, 220, 257, 278,
+	278, 278, 278, 278, 278, 0, 295, 1232,
+	296, 1230, 298, 1229, 300, 1237, 300, 1237,
+	0, 302, 308, 309, 304, 1238, 302, 303,
+	304, 1238, 302, 304, 305, 0, 306, 307,
+	1238, 302, 303, 304, 1238, 0, 311, 316,
+	312, 1239, 1240, 0, 313, 314, 315, 1239,
+	311, 1240, 312, 316, 317, 318, 0, 319,
+	320, 321, 316, 317, 318, 0, 323, 323,
+	323, 323, 330, 0, 324, 0, 325, 325,
+	325, 324, 327, 327, 327, 327, 327, 1241,
+	326, 0, 325, 325, 325, 1241, 326, 326,
+	1241, 328, 0, 328, 329, 329, 329, 329,
+	329, 325, 325, 325, 328, 1241, 326, 330,
+	323, 0, 332, 332, 332, 332, 342, 333,
+	341, 337, 333, 334, 337, 0, 335, 335,
+	335, 333, 337, 1242, 336, 335, 335, 335,
+	1242, 336, 336, 1242, 338, 0, 339, 340,
+	333, 334, 337, 342, 332, 344, 344, 344,
+	344, 359, 345, 0, 0, 346, 346, 346,
+	1243, 350, 356, 0, 346, 346, 346, 347,
+	355, 351, 1243, 350, 356, 0, 347, 348,
+	351, 349, 349, 349, 347, 351, 1243, 350,
+	349, 349, 349, 350, 1243, 352, 0, 353,
+	354, 347, 348, 351, 356, 1244, 357, 357,
+	357, 357, 358, 358, 357, 359, 344, 0,
+	361, 362, 363, 366, 364, 364, 364, 364,
+	364, 365, 1245, 1246, 1247, 365, 364, 0,
+	368, 368, 368, 368, 373, 1248, 1249, 1250,
+	368, 368, 368, 369, 374, 395, 409, 416,
+	421, 429, 433, 441, 447, 463, 473, 476,
+	483, 499, 509, 512, 368, 373, 1248, 1249,
+	1250, 368, 368, 368, 370, 518, 522, 368,
+	373, 1248, 1249, 1250, 371, 372, 368, 368,
+	368, 368, 373, 1248, 1249, 1250, 373, 368,
+	375, 377, 384, 387, 391, 376, 368, 368,
+	368, 368, 373, 1248, 1249, 1250, 378, 383,
+	379, 380, 381, 382, 368, 368, 368, 368,
+	373, 1248, 1249, 1250, 368, 368, 368, 368,
+	373, 1248, 1249, 1250, 385, 386, 368, 368,
+	368, 368, 373, 1248, 1249, 1250, 388, 389,
+	390, 368, 368, 368, 368, 373, 1248, 1249,
+	1250, 392, 393, 394, 368, 368, 368, 368,
+	373, 1248, 1249, 1250, 396, 400, 408, 397,
+	398, 399, 368, 368, 368, 368, 373, 1248,
+	1249, 1250, 401, 404, 402, 403, 368, 368,
+	368, 368, 373, 1248, 1249, 1250, 405, 406,
+	407, 368, 368, 368, 368, 373, 1248, 1249,
+	1250, 368, 368, 368, 368, 373, 1248, 1249,
+	1250, 410, 411, 412, 414, 413, 368, 368,
+	368, 368, 373, 1248, 1249, 1250, 415, 368,
+	368, 368, 368, 373, 1248, 1249, 1250, 417,
+	418, 419, 420, 368, 368, 368, 368, 373,
+	1248, 1249, 1250, 422, 423, 424, 425, 426,
+	427, 428, 368, 368, 368, 368, 373, 1248,
+	1249, 1250, 430, 432, 431, 368, 368, 368,
+	368, 373, 1248, 1249, 1250, 368, 368, 368,
+	368, 373, 1248, 1249, 1250, 434, 436, 438,
+	440, 435, 368, 368, 368, 368, 373, 1248,
+	1249, 1250, 437, 368, 368, 368, 368, 373,
+	1248, 1249, 1250, 439, 368, 368, 368, 368,
+	373, 1248, 1249, 1250, 368, 368, 368, 368,
+	373, 1248, 1249, 1250, 442, 446, 443, 444,
+	445, 368, 368, 368, 368, 373, 1248, 1249,
+	1250, 368, 368, 368, 368, 373, 1248, 1249,
+	1250, 448, 452, 454, 449, 450, 451, 368,
+	368, 368, 368, 373, 1248, 1249, 1250, 453,
+	368, 368, 368, 368, 373, 1248, 1249, 1250,
+	368, 368, 368, 455, 368, 373, 1248, 1249,
+	1250, 456, 368, 368, 368, 457, 368, 373,
+	1248, 1249, 1250, 368, 368, 368, 458, 368,
+	373, 1248, 1249, 1250, 459, 460, 461, 462,
+	368, 368, 368, 368, 373, 1248, 1249, 1250,
+	464, 465, 466, 467, 468, 469, 470, 471,
+	472, 368, 368, 368, 368, 373, 1248, 1249,
+	1250, 474, 475, 368, 368, 368, 368, 373,
+	1248, 1249, 1250, 477, 478, 482, 368, 368,
+	368, 368, 373, 1248, 1249, 1250, 479, 480,
+	481, 368, 368, 368, 368, 373, 1248, 1249,
+	1250, 368, 368, 368, 368, 373, 1248, 1249,
+	1250, 484, 489, 491, 493, 495, 485, 486,
+	487, 488, 368, 368, 368, 368, 373, 1248,
+	1249, 1250, 490, 368, 368, 368, 368, 373,
+	1248, 1249, 1250, 492, 368, 368, 368, 368,
+	373, 1248, 1249, 1250, 494, 368, 368, 368,
+	368, 373, 1248, 1249, 1250, 496, 497, 498,
+	368, 368, 368, 368, 373, 1248, 1249, 1250,
+	500, 503, 505, 501, 502, 368, 368, 368,
+	368, 373, 1248, 1249, 1250, 504, 368, 368,
+	368, 368, 373, 1248, 1249, 1250, 506, 507,
+	508, 368, 368, 368, 508, 368, 373, 1248,
+	1249, 1250, 510, 511, 368, 368, 368, 368,
+	373, 1248, 1249, 1250, 513, 514, 515, 516,
+	517, 368, 368, 368, 368, 373, 1248, 1249,
+	1250, 519, 520, 521, 368, 368, 368, 368,
+	373, 1248, 1249, 1250, 523, 368, 368, 368,
+	368, 373, 1248, 1249, 1250, 0, 525, 525,
+	525, 525, 532, 0, 526, 527, 527, 527,
+	526, 527, 531, 0, 527, 527, 527, 528,
+	527, 531, 529, 529, 529, 529, 529, 530,
+	1251, 1252, 1253, 530, 529, 531, 527, 532,
+	525, 534, 534, 534, 534, 542, 535, 541,
+	1254, 1254, 1254, 541, 1255, 1254, 1258, 536,
+	536, 536, 537, 536, 540, 538, 538, 538,
+	538, 538, 539, 1255, 1256, 1257, 539, 538,
+	540, 536, 536, 536, 536, 536, 540, 542,
+	534, 0, 544, 545, 560, 599, 607, 620,
+	1259, 544, 546, 547, 1259, 548, 1259, 549,
+	550, 551, 552, 553, 554, 555, 556, 557,
+	558, 559, 1259, 561, 590, 562, 568, 563,
+	564, 565, 566, 567, 1259, 569, 570, 571,
+	572, 581, 573, 574, 575, 576, 577, 578,
+	579, 580, 1259, 582, 583, 584, 585, 586,
+	587, 588, 589, 1259, 591, 596, 592, 593,
+	594, 595, 1259, 597, 598, 1259, 600, 601,
+	602, 603, 604, 605, 606, 1259, 608, 609,
+	610, 611, 612, 613, 614, 617, 615, 616,
+	1259, 618, 619, 1259, 621, 622, 623, 626,
+	624, 625, 1259, 627, 628, 629, 641, 644,
+	1259, 630, 631, 632, 633, 634, 635, 636,
+	637, 638, 639, 640, 1259, 642, 643, 1259,
+	645, 646, 1259, 0, 648, 649, 655, 672,
+	675, 681, 685, 1260, 648, 650, 651, 652,
+	653, 654, 1260, 656, 662, 668, 657, 658,
+	659, 660, 661, 1260, 663, 665, 664, 1260,
+	666, 667, 1260, 669, 670, 671, 1260, 673,
+	674, 1260, 676, 678, 677, 1260, 679, 680,
+	1260, 682, 683, 684, 1260, 686, 687, 1260,
+	0, 689, 1261, 689, 691, 1262, 693, 694,
+	694, 694, 694, 723, 694, 694, 694, 695,
+	694, 723, 696, 696, 696, 696, 722, 0,
+	696, 696, 696, 697, 696, 722, 698, 698,
+	698, 697, 698, 721, 698, 698, 698, 699,
+	698, 721, 0, 700, 700, 700, 699, 718,
+	718, 718, 718, 718, 700, 717, 700, 700,
+	700, 701, 700, 717, 702, 702, 702, 701,
+	714, 714, 714, 714, 714, 702, 713, 702,
+	702, 702, 703, 702, 713, 704, 704, 704,
+	703, 710, 710, 710, 710, 710, 704, 709,
+	704, 704, 704, 705, 704, 709, 1263, 705,
+	706, 706, 706, 706, 706, 707, 707, 708,
+	708, 708, 708, 708, 1263, 707, 709, 704,
+	711, 711, 712, 712, 712, 712, 712, 704,
+	704, 704, 711, 704, 709, 713, 702, 715,
+	715, 716, 716, 716, 716, 716, 702, 702,
+	702, 715, 702, 713, 717, 700, 719, 719,
+	720, 720, 720, 720, 720, 700, 700, 700,
+	719, 700, 717, 721, 698, 722, 696, 723,
+	694, 725, 726, 726, 726, 726, 728, 727,
+	726, 726, 726, 726, 728, 1264, 728, 726,
+	730, 731, 731, 731, 731, 733, 731, 731,
+	731, 732, 731, 733, 1265, 733, 731, 735,
+	736, 736, 736, 735, 736, 738, 736, 736,
+	736, 737, 736, 738, 1266, 738, 736, 740,
+	0, 741, 741, 741, 741, 742, 1267, 1268,
+	1269, 740, 741, 741, 741, 741, 742, 1267,
+	1268, 1269, 742, 741, 744, 1270, 744, 0,
+	746, 747, 747, 747, 746, 747, 799, 747,
+	747, 747, 748, 752, 794, 747, 799, 749,
+	749, 749, 748, 749, 798, 749, 749, 749,
+	750, 749, 798, 751, 751, 751, 796, 750,
+	751, 795, 751, 751, 751, 751, 795, 753,
+	753, 753, 753, 793, 754, 755, 755, 755,
+	754, 755, 792, 755, 755, 755, 756, 760,
+	787, 755, 792, 757, 757, 757, 756, 757,
+	791, 757, 757, 757, 758, 757, 791, 759,
+	759, 759, 789, 758, 759, 788, 759, 759,
+	759, 759, 788, 761, 761, 761, 761, 786,
+	762, 763, 763, 764, 764, 764, 783, 763,
+	785, 764, 782, 1271, 1278, 1279, 764, 764,
+	764, 765, 764, 782, 1271, 1278, 1279, 766,
+	766, 766, 779, 765, 781, 766, 778, 1271,
+	1276, 1277, 766, 766, 766, 767, 766, 778,
+	1276, 1277, 768, 768, 768, 775, 767, 777,
+	768, 774, 1271, 1274, 1275, 768, 768, 768,
+	769, 768, 774, 1274, 1275, 770, 770, 770,
+	772, 769, 770, 771, 1271, 1272, 1273, 770,
+	770, 770, 770, 771, 1272, 1273, 771, 770,
+	770, 770, 770, 773, 770, 771, 1271, 1272,
+	1273, 773, 774, 768, 768, 768, 768, 776,
+	777, 768, 774, 1271, 1274, 1275, 776, 778,
+	766, 766, 766, 766, 780, 781, 766, 778,
+	1271, 1276, 1277, 780, 782, 764, 764, 764,
+	764, 784, 785, 764, 782, 1271, 1278, 1279,
+	784, 786, 761, 761, 761, 761, 761, 786,
+	788, 759, 759, 759, 759, 790, 759, 788,
+	790, 791, 757, 792, 755, 793, 753, 753,
+	753, 753, 753, 793, 795, 751, 751, 751,
+	751, 797, 751, 795, 797, 798, 749, 799,
+	747, 801, 802, 802, 802, 801, 802, 810,
+	802, 802, 802, 803, 802, 810, 804, 804,
+	804, 803, 804, 809, 804, 804, 804, 805,
+	804, 809, 806, 806, 806, 805, 806, 808,
+	806, 806, 806, 807, 806, 808, 1280, 808,
+	806, 809, 804, 810, 802, 812, 813, 813,
+	813, 812, 813, 827, 813, 813, 813, 814,
+	813, 827, 815, 815, 815, 814, 815, 826,
+	816, 815, 815, 815, 815, 826, 817, 817,
+	817, 817, 825, 818, 817, 817, 817, 817,
+	825, 819, 819, 819, 819, 824, 820, 819,
+	819, 819, 819, 824, 821, 821, 821, 821,
+	823, 821, 821, 821, 822, 821, 823, 1281,
+	823, 821, 824, 819, 825, 817, 826, 815,
+	827, 813, 829, 830, 830, 830, 830, 838,
+	831, 832, 832, 832, 831, 832, 837, 832,
+	832, 832, 833, 832, 837, 834, 834, 834,
+	834, 836, 835, 1282, 836, 834, 837, 832,
+	838, 830, 0, 839, 840, 839, 839, 841,
+	847, 839, 846, 1283, 1284, 1285, 841, 847,
+	842, 0, 843, 843, 844, 845, 839, 839,
+	839, 845, 839, 846, 1283, 1284, 1285, 846,
+	839, 848, 849, 849, 844, 851, 852, 852,
+	852, 851, 852, 862, 852, 852, 852, 853,
+	852, 862, 854, 854, 854, 854, 861, 855,
+	856, 856, 856, 855, 856, 860, 0, 856,
+	856, 856, 857, 856, 860, 858, 858, 858,
+	858, 858, 859, 1286, 1287, 1288, 859, 858,
+	860, 856, 861, 854, 862, 852, 864, 865,
+	865, 865, 864, 865, 872, 865, 865, 865,
+	866, 865, 872, 867, 867, 867, 866, 867,
+	871, 867, 867, 867, 868, 867, 871, 869,
+	869, 869, 869, 869, 870, 1289, 1290, 1291,
+	870, 869, 871, 867, 872, 865, 874, 875,
+	875, 875, 874, 875, 911, 0, 875, 875,
+	875, 876, 890, 897, 904, 875, 911, 877,
+	877, 877, 877, 889, 0, 878, 879, 879,
+	879, 878, 879, 888, 879, 879, 879, 880,
+	879, 888, 0, 881, 881, 881, 884, 884,
+	884, 886, 886, 886, 1292, 881, 883, 1295,
+	1296, 884, 885, 1293, 1294, 886, 887, 1297,
+	1298, 0, 882, 883, 881, 885, 884, 887,
+	886, 888, 879, 889, 877, 891, 891, 891,
+	891, 896, 892, 893, 893, 893, 892, 893,
+	895, 0, 893, 893, 893, 894, 893, 895,
+	0, 894, 881, 881, 881, 884, 884, 884,
+	886, 886, 886, 1292, 881, 883, 1295, 1296,
+	884, 885, 1293, 1294, 886, 887, 1297, 1298,
+	895, 893, 896, 891, 898, 898, 898, 898,
+	903, 899, 900, 900, 900, 899, 900, 902,
+	900, 900, 900, 901, 900, 902, 901, 881,
+	881, 881, 884, 884, 884, 886, 886, 886,
+	1292, 881, 883, 1295, 1296, 884, 885, 1293,
+	1294, 886, 887, 1297, 1298, 902, 900, 903,
+	898, 905, 905, 905, 905, 910, 906, 907,
+	907, 907, 906, 907, 909, 907, 907, 907,
+	908, 907, 909, 881, 881, 881, 884, 884,
+	884, 886, 886, 886, 1292, 881, 883, 1295,
+	1296, 884, 885, 1293, 1294, 886, 887, 1297,
+	1298, 909, 907, 910, 905, 911, 875, 0,
+	913, 947, 968, 982, 989, 994, 1002, 1006,
+	1014, 1020, 1036, 1046, 1049, 1056, 1072, 1082,
+	1085, 914, 914, 914, 938, 941, 945, 914,
+	937, 914, 914, 914, 915, 914, 937, 916,
+	916, 916, 916, 936, 917, 918, 918, 918,
+	917, 918, 935, 918, 918, 918, 919, 918,
+	935, 920, 920, 920, 919, 920, 934, 0,
+	920, 920, 920, 921, 920, 934, 922, 922,
+	922, 921, 922, 933, 922, 922, 922, 923,
+	922, 933, 924, 924, 924, 923, 924, 932,
+	924, 924, 924, 925, 924, 932, 926, 926,
+	926, 925, 926, 931, 926, 926, 926, 927,
+	926, 931, 928, 928, 928, 928, 930, 928,
+	928, 928, 929, 928, 930, 1299, 930, 928,
+	931, 926, 932, 924, 933, 922, 934, 920,
+	935, 918, 936, 916, 937, 914, 939, 940,
+	914, 914, 914, 914, 937, 942, 943, 944,
+	914, 914, 914, 914, 937, 946, 914, 914,
+	914, 914, 937, 948, 950, 957, 960, 964,
+	949, 914, 914, 914, 914, 937, 951, 956,
+	952, 953, 954, 955, 914, 914, 914, 914,
+	937, 914, 914, 914, 914, 937, 958, 959,
+	914, 914, 914, 914, 937, 961, 962, 963,
+	914, 914, 914, 914, 937, 965, 966, 967,
+	914, 914, 914, 914, 937, 969, 973, 981,
+	970, 971, 972, 914, 914, 914, 914, 937,
+	974, 977, 975, 976, 914, 914, 914, 914,
+	937, 978, 979, 980, 914, 914, 914, 914,
+	937, 914, 914, 914, 914, 937, 983, 984,
+	985, 987, 986, 914, 914, 914, 914, 937,
+	988, 914, 914, 914, 914, 937, 990, 991,
+	992, 993, 914, 914, 914, 914, 937, 995,
+	996, 997, 998, 999, 1000, 1001, 914, 914,
+	914, 914, 937, 1003, 1005, 1004, 914, 914,
+	914, 914, 937, 914, 914, 914, 914, 937,
+	1007, 1009, 1011, 1013, 1008, 914, 914, 914,
+	914, 937, 1010, 914, 914, 914, 914, 937,
+	1012, 914, 914, 914, 914, 937, 914, 914,
+	914, 914, 937, 1015, 1019, 1016, 1017, 1018,
+	914, 914, 914, 914, 937, 914, 914, 914,
+	914, 937, 1021, 1025, 1027, 1022, 1023, 1024,
+	914, 914, 914, 914, 937, 1026, 914, 914,
+	914, 914, 937, 914, 914, 914, 1028, 914,
+	937, 1029, 914, 914, 914, 1030, 914, 937,
+	914, 914, 914, 1031, 914, 937, 1032, 1033,
+	1034, 1035, 914, 914, 914, 914, 937, 1037,
+	1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045,
+	914, 914, 914, 914, 937, 1047, 1048, 914,
+	914, 914, 914, 937, 1050, 1051, 1055, 914,
+	914, 914, 914, 937, 1052, 1053, 1054, 914,
+	914, 914, 914, 937, 914, 914, 914, 914,
+	937, 1057, 1062, 1064, 1066, 1068, 1058, 1059,
+	1060, 1061, 914, 914, 914, 914, 937, 1063,
+	914, 914, 914, 914, 937, 1065, 914, 914,
+	914, 914, 937, 1067, 914, 914, 914, 914,
+	937, 1069, 1070, 1071, 914, 914, 914, 914,
+	937, 1073, 1076, 1078, 1074, 1075, 914, 914,
+	914, 914, 937, 1077, 914, 914, 914, 914,
+	937, 1079, 1080, 0, 1081, 914, 914, 914,
+	1081, 914, 937, 1083, 1084, 914, 914, 914,
+	914, 937, 1086, 1087, 1088, 1089, 1090, 914,
+	914, 914, 914, 937, 1092, 1093, 1300, 1095,
+	1096, 1096, 1096, 1095, 1096, 1104, 1096, 1096,
+	1096, 1097, 1096, 1104, 1098, 1098, 1098, 1097,
+	1098, 1103, 1098, 1098, 1098, 1099, 1098, 1103,
+	1100, 1100, 1100, 1100, 1102, 1101, 1301, 1102,
+	1100, 1103, 1098, 1104, 1096, 1106, 1302, 1108,
+	1109, 1109, 1109, 1108, 1109, 1135, 1109, 1109,
+	1109, 1110, 1109, 1135, 1111, 1111, 1111, 1110,
+	1111, 1134, 1111, 1111, 1111, 1112, 1111, 1134,
+	1113, 1113, 1113, 1112, 1113, 1133, 1113, 1113,
+	1113, 1114, 1131, 1113, 1133, 1115, 1115, 1115,
+	1115, 1130, 0, 1115, 1115, 1115, 1116, 1115,
+	1130, 1117, 1118, 1128, 1119, 1120, 1127, 1121,
+	1125, 1122, 1123, 1123, 1124, 1116, 1303, 1126,
+	1129, 1130, 1115, 1132, 1131, 1133, 1113, 1134,
+	1111, 1135, 1109, 1137, 1138, 1138, 1138, 1137,
+	1138, 1148, 1138, 1138, 1138, 1139, 1138, 1148,
+	1140, 1140, 1140, 1139, 1140, 1147, 1140, 1140,
+	1140, 1141, 1140, 1147, 1142, 1142, 1142, 1141,
+	1142, 1146, 1142, 1142, 1142, 1143, 1144, 1142,
+	1146, 1304, 1145, 1144, 1146, 1142, 1147, 1140,
+	1148, 1138, 1150, 1151, 1151, 1151, 1150, 1151,
+	1161, 1151, 1151, 1151, 1152, 1151, 1161, 1153,
+	1153, 1153, 1152, 1153, 1160, 1153, 1153, 1153,
+	1154, 1153, 1160, 1155, 1155, 1155, 1154, 1155,
+	1159, 1155, 1155, 1155, 1156, 1155, 1159, 1157,
+	1157, 1157, 1157, 1157, 1158, 1305, 1306, 1307,
+	1158, 1157, 1159, 1155, 1160, 1153, 1161, 1151,
+	1163, 1164, 1164, 1164, 1163, 1164, 1167, 1164,
+	1164, 1164, 1165, 1164, 1167, 1166, 1165, 1308,
+	1167, 1164, 1169, 1170, 1170, 1170, 1169, 1170,
+	1180, 1170, 1170, 1170, 1171, 1170, 1180, 1172,
+	1172, 1172, 1171, 1172, 1179, 1172, 1172, 1172,
+	1173, 1172, 1179, 1174, 1174, 1174, 1173, 1174,
+	1178, 1174, 1174, 1174, 1175, 1174, 1178, 1176,
+	1176, 1176, 1176, 1176, 1177, 1309, 1310, 1311,
+	1177, 1176, 1178, 1174, 1179, 1172, 1180, 1170,
+	1182, 1183, 1183, 1183, 1182, 1183, 1185, 1183,
+	1183, 1183, 1184, 1183, 1185, 1312, 1184, 1185,
+	1183, 1187, 1188, 1188, 1188, 1187, 1188, 1198,
+	1188, 1188, 1188, 1189, 1188, 1198, 1190, 1191,
+	1192, 0, 1193, 1194, 1195, 1196, 1197, 0,
+	1313, 1198, 1188, 1200, 1201, 0, 1202, 1203,
+	1204, 1314, 1206, 1207, 1208, 1209, 1210, 1315,
+	1212, 1213, 1213, 1213, 1212, 1213, 1218, 1213,
+	1213, 1213, 1214, 1213, 1218, 1215, 1215, 1215,
+	1214, 1215, 1217, 1216, 1215, 1215, 1215, 1215,
+	1217, 1316, 1217, 1215, 1218, 1213, 1220, 1221,
+	1221, 1221, 1220, 1221, 1226, 1222, 1221, 1221,
+	1221, 1221, 1226, 1223, 1223, 1223, 1223, 1225,
+	1224, 1223, 1223, 1223, 1223, 1225, 1317, 1225,
+	1223, 1226, 1221, 0, 1, 177, 1, 1,
+	185, 1227, 176, 1232, 295, 14, 221, 14,
+	14, 231, 253, 1235, 268, 1233, 269, 1236,
+	271, 0, 167, 167, 167, 195, 279, 280,
+	281, 282, 297, 284, 285, 286, 287, 288,
+	289, 290, 291, 292, 293, 294, 1230, 296,
+	0, 188, 195, 279, 280, 281, 282, 283,
+	284, 285, 286, 287, 288, 289, 290, 291,
+	292, 293, 294, 0, 1, 177, 1, 1,
+	185, 1227, 176, 1232, 295, 1, 1, 1232,
+	295, 199, 199, 199, 1232, 200, 203, 203,
+	203, 220, 257, 0, 232, 235, 237, 238,
+	239, 240, 241, 242, 243, 244, 245, 246,
+	247, 248, 249, 250, 251, 252, 1232
+};
+
+static const short _zone_scanner_trans_actions[] = {
+	2526, 0, 5, 7, 577, 739, 739, 739,
+	739, 739, 739, 739, 739, 739, 739, 739,
+	739, 739, 739, 739, 739, 739, 3, 9,
+	3, 9, 2682, 101, 757, 760, 43, 57,
+	55, 53, 0, 59, 754, 763, 377, 0,
+	5, 7, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 3, 9, 2122, 2125, 3150,
+	3154, 0, 0, 0, 3146, 3158, 3166, 4994,
+	5014, 371, 0, 369, 5, 7, 375, 3,
+	9, 385, 412, 2107, 13, 433, 436, 2398,
+	439, 15, 0, 5, 7, 2263, 9, 11,
+	2370, 2116, 373, 11, 427, 13, 394, 400,
+	409, 4989, 3126, 2350, 0, 5, 7, 9,
+	3134, 2113, 412, 11, 2366, 0, 4254, 5,
+	7, 2514, 2806, 2806, 2806, 2806, 2806, 2806,
+	2806, 2806, 2806, 2806, 2806, 2806, 2806, 2806,
+	2806, 2806, 2806, 3, 9, 2110, 2113, 385,
+	412, 5595, 766, 2810, 2814, 4469, 2818, 2119,
+	0, 5, 7, 388, 9, 0, 0, 0,
+	0, 0, 0, 2260, 4054, 4058, 4050, 4062,
+	4066, 5459, 5464, 424, 2354, 2358, 2362, 11,
+	415, 418, 421, 0, 0, 0, 0, 0,
+	0, 2224, 3814, 3818, 3810, 3822, 3826, 5339,
+	5344, 2221, 3794, 3798, 3790, 3802, 3806, 5329,
+	5334, 0, 0, 2179, 3514, 3518, 3510, 3522,
+	3526, 5189, 5194, 0, 0, 0, 2131, 3194,
+	3198, 3190, 3202, 3206, 5029, 5034, 0, 0,
+	0, 2230, 3854, 3858, 3850, 3862, 3866, 5359,
+	5364, 0, 0, 0, 0, 0, 0, 2206,
+	3694, 3698, 3690, 3702, 3706, 5279, 5284, 0,
+	0, 0, 0, 2182, 3534, 3538, 3530, 3542,
+	3546, 5199, 5204, 0, 0, 0, 2203, 3674,
+	3678, 3670, 3682, 3686, 5269, 5274, 2188, 3574,
+	3578, 3570, 3582, 3586, 5219, 5224, 0, 0,
+	0, 0, 0, 2251, 3994, 3998, 3990, 4002,
+	4006, 5429, 5434, 0, 2254, 4014, 4018, 4010,
+	4022, 4026, 5439, 5444, 0, 0, 0, 0,
+	2140, 3254, 3258, 3250, 3262, 3266, 5059, 5064,
+	0, 0, 99, 745, 748, 742, 751, 0,
+	5, 7, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3, 9, 0, 0, 0,
+	0, 0, 0, 2194, 3614, 3618, 3610, 3622,
+	3626, 5239, 5244, 0, 0, 0, 2161, 3394,
+	3398, 3390, 3402, 3406, 5129, 5134, 2176, 3494,
+	3498, 3490, 3502, 3506, 5179, 5184, 0, 0,
+	0, 0, 0, 2242, 3934, 3938, 3930, 3942,
+	3946, 5399, 5404, 0, 2245, 3954, 3958, 3950,
+	3962, 3966, 5409, 5414, 0, 2167, 3434, 3438,
+	3430, 3442, 3446, 5149, 5154, 2248, 3974, 3978,
+	3970, 3982, 3986, 5419, 5424, 0, 0, 0,
+	0, 0, 2143, 3274, 3278, 3270, 3282, 3286,
+	5069, 5074, 2146, 3294, 3298, 3290, 3302, 3306,
+	5079, 5084, 0, 0, 0, 0, 0, 0,
+	2173, 3474, 3478, 3470, 3482, 3486, 5169, 5174,
+	0, 2239, 3914, 3918, 3910, 3922, 3926, 5389,
+	5394, 2128, 3174, 3178, 0, 3170, 3182, 3186,
+	5019, 5024, 0, 2200, 3654, 3658, 0, 3650,
+	3662, 3666, 5259, 5264, 2209, 3714, 3718, 0,
+	3710, 3722, 3726, 5289, 5294, 0, 0, 0,
+	0, 2212, 3734, 3738, 3730, 3742, 3746, 5299,
+	5304, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 2227, 3834, 3838, 3830, 3842, 3846,
+	5349, 5354, 0, 0, 2137, 3234, 3238, 3230,
+	3242, 3246, 5049, 5054, 0, 0, 0, 2152,
+	3334, 3338, 3330, 3342, 3346, 5099, 5104, 0,
+	0, 0, 2197, 3634, 3638, 3630, 3642, 3646,
+	5249, 5254, 2158, 3374, 3378, 3370, 3382, 3386,
+	5119, 5124, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 2218, 3774, 3778, 3770, 3782,
+	3786, 5319, 5324, 0, 2134, 3214, 3218, 3210,
+	3222, 3226, 5039, 5044, 0, 2236, 3894, 3898,
+	3890, 3902, 3906, 5379, 5384, 0, 2170, 3454,
+	3458, 3450, 3462, 3466, 5159, 5164, 0, 0,
+	0, 2191, 3594, 3598, 3590, 3602, 3606, 5229,
+	5234, 0, 0, 0, 0, 0, 2215, 3754,
+	3758, 3750, 3762, 3766, 5309, 5314, 0, 2149,
+	3314, 3318, 3310, 3322, 3326, 5089, 5094, 0,
+	0, 589, 577, 2530, 658, 2658, 2662, 43,
+	2654, 2666, 2670, 4414, 4419, 0, 0, 2257,
+	4034, 4038, 4030, 4042, 4046, 5449, 5454, 0,
+	0, 0, 0, 0, 2233, 3874, 3878, 3870,
+	3882, 3886, 5369, 5374, 11, 427, 0, 5,
+	7, 3, 9, 0, 99, 745, 748, 742,
+	751, 0, 5, 7, 577, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 3, 9,
+	101, 757, 760, 43, 57, 55, 53, 0,
+	59, 754, 763, 2686, 43, 57, 55, 53,
+	0, 59, 679, 2726, 2730, 4429, 2722, 2734,
+	11, 427, 11, 427, 93, 89, 89, 89,
+	0, 0, 0, 0, 0, 0, 87, 39,
+	37, 526, 529, 523, 532, 0, 5, 7,
+	3, 9, 11, 0, 427, 4239, 538, 2442,
+	2450, 2434, 2458, 0, 5, 7, 3, 9,
+	11, 427, 2686, 43, 57, 55, 53, 0,
+	59, 679, 2726, 2730, 4429, 2722, 2734, 11,
+	427, 2502, 2470, 4194, 4209, 4179, 4224, 5481,
+	5505, 0, 5, 7, 3, 9, 385, 412,
+	3142, 3162, 4999, 5004, 5625, 5009, 5734, 5637,
+	5727, 5631, 0, 5, 7, 388, 2306, 0,
+	5, 7, 388, 9, 11, 2366, 442, 2374,
+	2382, 4119, 2390, 11, 391, 397, 406, 0,
+	5, 7, 9, 412, 11, 2366, 3118, 0,
+	0, 0, 0, 0, 81, 0, 0, 77,
+	2494, 535, 2438, 2446, 4169, 2454, 5664, 2462,
+	4184, 4199, 5475, 4214, 0, 5, 7, 388,
+	9, 11, 2366, 4244, 4229, 5487, 5493, 5650,
+	5499, 5741, 5657, 0, 5, 7, 388, 2306,
+	2466, 547, 4189, 4204, 4174, 4219, 13, 394,
+	400, 2282, 409, 424, 4094, 2354, 2358, 2362,
+	11, 415, 418, 421, 424, 2354, 2358, 2362,
+	11, 415, 418, 421, 0, 0, 2164, 3414,
+	3418, 3410, 3422, 3426, 5139, 5144, 0, 0,
+	0, 2155, 3354, 3358, 3350, 3362, 3366, 5109,
+	5114, 0, 2185, 3554, 3558, 3550, 3562, 3566,
+	5209, 5214, 11, 427, 442, 2374, 2382, 4129,
+	11, 391, 397, 4070, 424, 2354, 2358, 11,
+	415, 418, 424, 2354, 2358, 11, 415, 418,
+	11, 427, 13, 394, 400, 409, 2350, 424,
+	2354, 2358, 11, 415, 418, 550, 11, 427,
+	11, 427, 11, 2366, 454, 2402, 17, 457,
+	31, 2426, 29, 0, 490, 2406, 21, 23,
+	0, 481, 460, 19, 463, 472, 25, 25,
+	4139, 466, 469, 27, 487, 703, 65, 0,
+	0, 1, 700, 2742, 706, 69, 69, 709,
+	712, 2738, 71, 65, 0, 0, 67, 706,
+	69, 69, 712, 71, 71, 75, 0, 5,
+	7, 3, 9, 580, 577, 4424, 13, 433,
+	436, 43, 57, 55, 53, 0, 59, 4124,
+	439, 448, 0, 5, 7, 2750, 9, 11,
+	4104, 2686, 2674, 43, 57, 55, 53, 0,
+	59, 673, 2690, 2694, 4429, 5601, 2698, 11,
+	427, 79, 0, 5, 7, 3, 9, 4434,
+	721, 2754, 21, 23, 0, 451, 484, 2410,
+	2414, 460, 19, 5469, 2418, 0, 5, 7,
+	2758, 9, 11, 4109, 463, 475, 25, 25,
+	466, 469, 27, 11, 427, 0, 5, 7,
+	3, 9, 724, 83, 730, 727, 2762, 2766,
+	5607, 2774, 2770, 736, 0, 5, 7, 4439,
+	733, 2778, 2782, 9, 9, 85, 21, 23,
+	0, 2422, 4144, 4149, 460, 19, 5643, 4154,
+	0, 5, 7, 11, 4114, 463, 478, 25,
+	25, 466, 469, 27, 11, 4099, 0, 5,
+	7, 3, 9, 11, 427, 11, 427, 125,
+	117, 119, 121, 0, 123, 0, 5, 7,
+	3, 9, 1, 382, 403, 11, 427, 341,
+	339, 2011, 2014, 2008, 2017, 3090, 4979, 4984,
+	0, 5, 7, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 9, 2020, 2298,
+	2342, 247, 1459, 1462, 0, 0, 0, 1456,
+	1465, 2906, 4519, 4524, 0, 0, 273, 1615,
+	1618, 1612, 1621, 2958, 4649, 4654, 11, 427,
+	0, 0, 0, 0, 0, 0, 337, 1999,
+	2002, 1996, 2005, 3086, 4969, 4974, 0, 0,
+	0, 0, 0, 0, 313, 1855, 1858, 1852,
+	1861, 3038, 4849, 4854, 311, 1843, 1846, 1840,
+	1849, 3034, 4839, 4844, 0, 0, 283, 1675,
+	1678, 1672, 1681, 2978, 4699, 4704, 0, 0,
+	0, 251, 1483, 1486, 1480, 1489, 2914, 4539,
+	4544, 0, 0, 0, 317, 1879, 1882, 1876,
+	1885, 3046, 4869, 4874, 0, 0, 0, 0,
+	0, 0, 301, 1783, 1786, 1780, 1789, 3014,
+	4789, 4794, 0, 0, 0, 0, 285, 1687,
+	1690, 1684, 1693, 2982, 4709, 4714, 0, 0,
+	0, 299, 1771, 1774, 1768, 1777, 3010, 4779,
+	4784, 289, 1711, 1714, 1708, 1717, 2990, 4729,
+	4734, 0, 0, 0, 0, 0, 331, 1963,
+	1966, 1960, 1969, 3074, 4939, 4944, 0, 333,
+	1975, 1978, 1972, 1981, 3078, 4949, 4954, 0,
+	0, 0, 0, 257, 1519, 1522, 1516, 1525,
+	2926, 4569, 4574, 0, 0, 0, 0, 0,
+	0, 0, 293, 1735, 1738, 1732, 1741, 2998,
+	4749, 4754, 0, 0, 0, 271, 1603, 1606,
+	1600, 1609, 2954, 4639, 4644, 281, 1663, 1666,
+	1660, 1669, 2974, 4689, 4694, 0, 0, 0,
+	0, 0, 325, 1927, 1930, 1924, 1933, 3062,
+	4909, 4914, 0, 327, 1939, 1942, 1936, 1945,
+	3066, 4919, 4924, 0, 275, 1627, 1630, 1624,
+	1633, 2962, 4659, 4664, 329, 1951, 1954, 1948,
+	1957, 3070, 4929, 4934, 0, 0, 0, 0,
+	0, 259, 1531, 1534, 1528, 1537, 2930, 4579,
+	4584, 261, 1543, 1546, 1540, 1549, 2934, 4589,
+	4594, 0, 0, 0, 0, 0, 0, 279,
+	1651, 1654, 1648, 1657, 2970, 4679, 4684, 0,
+	323, 1915, 1918, 1912, 1921, 3058, 4899, 4904,
+	249, 1471, 1474, 0, 1468, 1477, 2910, 4529,
+	4534, 0, 297, 1759, 1762, 0, 1756, 1765,
+	3006, 4769, 4774, 303, 1795, 1798, 0, 1792,
+	1801, 3018, 4799, 4804, 0, 0, 0, 0,
+	305, 1807, 1810, 1804, 1813, 3022, 4809, 4814,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 315, 1867, 1870, 1864, 1873, 3042, 4859,
+	4864, 0, 0, 255, 1507, 1510, 1504, 1513,
+	2922, 4559, 4564, 0, 0, 0, 265, 1567,
+	1570, 1564, 1573, 2942, 4609, 4614, 0, 0,
+	0, 295, 1747, 1750, 1744, 1753, 3002, 4759,
+	4764, 269, 1591, 1594, 1588, 1597, 2950, 4629,
+	4634, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 309, 1831, 1834, 1828, 1837, 3030,
+	4829, 4834, 0, 253, 1495, 1498, 1492, 1501,
+	2918, 4549, 4554, 0, 321, 1903, 1906, 1900,
+	1909, 3054, 4889, 4894, 0, 277, 1639, 1642,
+	1636, 1645, 2966, 4669, 4674, 0, 0, 0,
+	291, 1723, 1726, 1720, 1729, 2994, 4739, 4744,
+	0, 0, 0, 0, 0, 307, 1819, 1822,
+	1816, 1825, 3026, 4819, 4824, 0, 263, 1555,
+	1558, 1552, 1561, 2938, 4599, 4604, 0, 0,
+	577, 245, 1447, 1450, 43, 1444, 1453, 2902,
+	4509, 4514, 0, 0, 335, 1987, 1990, 1984,
+	1993, 3082, 4959, 4964, 0, 0, 0, 0,
+	0, 319, 1891, 1894, 1888, 1897, 3050, 4879,
+	4884, 0, 0, 0, 267, 1579, 1582, 1576,
+	1585, 2946, 4619, 4624, 0, 287, 1699, 1702,
+	1696, 1705, 2986, 4719, 4724, 355, 0, 5,
+	7, 3, 9, 583, 577, 51, 664, 667,
+	43, 661, 670, 2890, 0, 5, 7, 113,
+	3, 9, 115, 0, 5, 7, 3, 9,
+	799, 2294, 2338, 11, 427, 11, 427, 11,
+	427, 0, 5, 7, 3, 9, 577, 577,
+	379, 2270, 2274, 43, 1, 2266, 2278, 0,
+	5, 7, 113, 3, 9, 115, 0, 5,
+	7, 3, 9, 799, 2294, 2338, 11, 427,
+	11, 427, 51, 664, 667, 661, 670, 11,
+	427, 361, 577, 0, 0, 0, 0, 0,
+	610, 43, 0, 0, 808, 0, 811, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 817, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 829, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 832, 0, 0, 0, 0, 0,
+	0, 0, 0, 835, 0, 0, 0, 0,
+	0, 0, 838, 0, 0, 841, 0, 0,
+	0, 0, 0, 0, 0, 844, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	847, 0, 0, 850, 0, 0, 0, 0,
+	0, 0, 805, 0, 0, 0, 0, 0,
+	814, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 820, 0, 0, 823,
+	0, 0, 826, 363, 577, 0, 0, 0,
+	0, 0, 0, 625, 43, 0, 0, 0,
+	0, 0, 871, 0, 0, 0, 0, 0,
+	0, 0, 0, 874, 0, 0, 0, 868,
+	0, 0, 862, 0, 0, 0, 865, 0,
+	0, 880, 0, 0, 0, 859, 0, 0,
+	853, 0, 0, 0, 856, 0, 0, 877,
+	772, 769, 2830, 103, 553, 556, 553, 41,
+	562, 565, 559, 568, 0, 5, 7, 553,
+	3, 9, 41, 562, 565, 559, 568, 586,
+	0, 5, 7, 577, 3, 9, 49, 649,
+	652, 43, 646, 655, 0, 5, 7, 577,
+	3, 9, 2678, 49, 649, 652, 43, 57,
+	55, 53, 0, 59, 646, 655, 0, 5,
+	7, 577, 3, 9, 49, 649, 652, 43,
+	57, 55, 53, 0, 59, 646, 655, 0,
+	5, 7, 577, 3, 9, 49, 649, 652,
+	43, 57, 55, 53, 0, 59, 646, 655,
+	0, 5, 7, 577, 3, 9, 643, 43,
+	57, 55, 53, 0, 59, 2686, 43, 57,
+	55, 53, 0, 59, 2702, 4429, 11, 427,
+	2686, 43, 57, 55, 53, 0, 59, 676,
+	2710, 2714, 4429, 2706, 2718, 11, 427, 2686,
+	43, 57, 55, 53, 0, 59, 676, 2710,
+	2714, 4429, 2706, 2718, 11, 427, 2686, 43,
+	57, 55, 53, 0, 59, 676, 2710, 2714,
+	4429, 2706, 2718, 11, 427, 11, 427, 11,
+	427, 493, 35, 508, 511, 505, 514, 493,
+	0, 5, 7, 3, 9, 502, 11, 427,
+	553, 41, 562, 565, 559, 568, 0, 5,
+	7, 553, 3, 9, 556, 11, 427, 577,
+	47, 631, 634, 43, 628, 637, 0, 5,
+	7, 553, 3, 9, 556, 11, 427, 2746,
+	718, 35, 508, 511, 505, 514, 2430, 4159,
+	4164, 493, 0, 5, 7, 3, 9, 715,
+	2290, 2334, 11, 427, 769, 2850, 103, 2098,
+	3094, 343, 2026, 2029, 43, 2023, 2032, 0,
+	5, 7, 577, 0, 0, 3, 9, 347,
+	2050, 2053, 43, 2047, 2056, 0, 5, 7,
+	4409, 3, 9, 592, 2562, 2566, 0, 43,
+	2558, 2570, 0, 5, 7, 3, 9, 0,
+	5, 7, 3, 9, 577, 345, 2038, 2041,
+	43, 2035, 2044, 0, 5, 7, 577, 0,
+	0, 3, 9, 349, 2062, 2065, 43, 2059,
+	2068, 0, 5, 7, 4409, 3, 9, 595,
+	2578, 2582, 0, 43, 2574, 2586, 0, 5,
+	7, 3, 9, 0, 5, 7, 3, 9,
+	0, 4404, 5619, 598, 2594, 2598, 0, 43,
+	598, 2590, 2602, 4384, 5547, 5553, 0, 5,
+	7, 4404, 3, 9, 2095, 2302, 2346, 601,
+	2610, 2614, 0, 43, 601, 2606, 2618, 4389,
+	5559, 5565, 0, 5, 7, 4404, 3, 9,
+	2302, 2346, 604, 2626, 2630, 0, 43, 604,
+	2622, 2634, 4394, 5571, 5577, 0, 5, 7,
+	4404, 3, 9, 2302, 2346, 607, 2642, 2646,
+	0, 43, 2638, 2650, 4399, 5583, 5589, 0,
+	5, 7, 3, 9, 2302, 2346, 11, 427,
+	2554, 4369, 4374, 4259, 4364, 4379, 5541, 5713,
+	5720, 574, 11, 427, 2550, 4349, 4354, 4259,
+	2550, 4344, 4359, 5535, 5699, 5706, 574, 11,
+	427, 2546, 4329, 4334, 4259, 2546, 4324, 4339,
+	5529, 5685, 5692, 574, 11, 427, 2542, 4309,
+	4314, 4259, 2542, 4304, 4319, 5523, 5671, 5678,
+	574, 11, 427, 353, 2086, 2089, 2083, 2092,
+	11, 427, 2538, 4289, 4294, 4259, 4284, 4299,
+	574, 11, 427, 11, 427, 11, 427, 351,
+	2074, 2077, 2071, 2080, 11, 427, 2534, 4269,
+	4274, 4259, 4264, 4279, 574, 11, 427, 11,
+	427, 577, 47, 631, 634, 43, 628, 637,
+	0, 5, 7, 577, 3, 9, 47, 631,
+	634, 43, 628, 637, 0, 5, 7, 577,
+	3, 9, 47, 631, 634, 43, 628, 637,
+	0, 5, 7, 553, 3, 9, 556, 11,
+	427, 11, 427, 11, 427, 577, 47, 631,
+	634, 43, 628, 637, 0, 5, 7, 577,
+	3, 9, 47, 631, 634, 43, 628, 637,
+	493, 0, 5, 7, 3, 9, 35, 508,
+	511, 505, 514, 493, 0, 5, 7, 3,
+	9, 35, 508, 511, 505, 514, 493, 0,
+	5, 7, 3, 9, 35, 508, 511, 505,
+	514, 0, 5, 7, 553, 3, 9, 556,
+	11, 427, 11, 427, 11, 427, 11, 427,
+	11, 427, 367, 0, 5, 7, 3, 9,
+	577, 47, 631, 634, 43, 628, 637, 0,
+	5, 7, 365, 3, 9, 0, 5, 7,
+	3, 9, 127, 1, 11, 427, 11, 427,
+	11, 427, 793, 0, 781, 5, 7, 784,
+	787, 3, 9, 1, 382, 403, 109, 111,
+	0, 2822, 769, 103, 105, 577, 790, 2878,
+	2882, 43, 2874, 2886, 2870, 4499, 4504, 11,
+	427, 0, 769, 103, 107, 577, 47, 631,
+	634, 43, 628, 637, 0, 5, 7, 365,
+	3, 9, 0, 5, 7, 3, 9, 577,
+	45, 616, 619, 43, 613, 622, 796, 0,
+	5, 7, 113, 3, 9, 115, 0, 5,
+	7, 3, 9, 1, 382, 403, 11, 427,
+	11, 427, 11, 427, 11, 427, 577, 45,
+	616, 619, 43, 613, 622, 0, 5, 7,
+	577, 3, 9, 45, 616, 619, 43, 613,
+	622, 0, 5, 7, 113, 3, 9, 115,
+	0, 5, 7, 3, 9, 1, 382, 403,
+	11, 427, 11, 427, 11, 427, 577, 45,
+	616, 619, 43, 613, 622, 883, 0, 5,
+	7, 145, 147, 149, 151, 3, 9, 0,
+	5, 7, 3, 9, 2518, 577, 45, 616,
+	619, 43, 613, 622, 0, 5, 7, 0,
+	3, 9, 2898, 0, 5, 7, 0, 5,
+	7, 0, 5, 7, 1, 3, 9, 382,
+	403, 3, 9, 382, 403, 3, 9, 382,
+	403, 886, 127, 11, 427, 11, 427, 11,
+	427, 11, 427, 11, 427, 0, 5, 7,
+	3, 9, 577, 45, 616, 619, 43, 613,
+	622, 2826, 0, 5, 7, 769, 3, 9,
+	4474, 103, 775, 2838, 2842, 775, 2838, 2842,
+	775, 2838, 2842, 2830, 2834, 2846, 4479, 4484,
+	2834, 2846, 4479, 4484, 2834, 2846, 4479, 4484,
+	11, 427, 11, 427, 0, 5, 7, 3,
+	9, 577, 45, 616, 619, 43, 613, 622,
+	0, 5, 7, 769, 3, 9, 103, 778,
+	2858, 2862, 778, 2858, 2862, 778, 2858, 2862,
+	2850, 2854, 2866, 4489, 4494, 2854, 2866, 4489,
+	4494, 2854, 2866, 4489, 4494, 11, 427, 11,
+	427, 0, 5, 7, 3, 9, 577, 45,
+	616, 619, 43, 613, 622, 0, 5, 7,
+	553, 3, 9, 41, 562, 565, 41, 562,
+	565, 41, 562, 565, 556, 559, 568, 2506,
+	2510, 559, 568, 2506, 2510, 559, 568, 2506,
+	2510, 11, 427, 11, 427, 11, 427, 889,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 153, 895, 898, 0, 0, 0, 892,
+	901, 0, 5, 7, 365, 3, 9, 0,
+	5, 7, 3, 9, 577, 45, 616, 619,
+	43, 613, 622, 0, 5, 7, 577, 3,
+	9, 49, 649, 652, 43, 646, 655, 697,
+	0, 5, 7, 682, 3, 9, 63, 688,
+	691, 61, 685, 694, 0, 5, 7, 682,
+	3, 9, 63, 688, 691, 61, 685, 694,
+	0, 5, 7, 577, 3, 9, 47, 631,
+	634, 43, 628, 637, 0, 5, 7, 553,
+	3, 9, 41, 562, 565, 559, 568, 0,
+	5, 7, 127, 3, 9, 1, 11, 427,
+	11, 427, 11, 427, 11, 427, 11, 427,
+	11, 427, 11, 427, 11, 427, 0, 0,
+	179, 1051, 1054, 1048, 1057, 0, 0, 0,
+	173, 1015, 1018, 1012, 1021, 0, 193, 1135,
+	1138, 1132, 1141, 0, 0, 0, 0, 0,
+	0, 243, 1435, 1438, 1432, 1441, 0, 0,
+	0, 0, 0, 0, 219, 1291, 1294, 1288,
+	1297, 217, 1279, 1282, 1276, 1285, 0, 0,
+	189, 1111, 1114, 1108, 1117, 0, 0, 0,
+	157, 919, 922, 916, 925, 0, 0, 0,
+	223, 1315, 1318, 1312, 1321, 0, 0, 0,
+	0, 0, 0, 207, 1219, 1222, 1216, 1225,
+	0, 0, 0, 0, 191, 1123, 1126, 1120,
+	1129, 0, 0, 0, 205, 1207, 1210, 1204,
+	1213, 195, 1147, 1150, 1144, 1153, 0, 0,
+	0, 0, 0, 237, 1399, 1402, 1396, 1405,
+	0, 239, 1411, 1414, 1408, 1417, 0, 0,
+	0, 0, 163, 955, 958, 952, 961, 0,
+	0, 0, 0, 0, 0, 0, 199, 1171,
+	1174, 1168, 1177, 0, 0, 0, 177, 1039,
+	1042, 1036, 1045, 187, 1099, 1102, 1096, 1105,
+	0, 0, 0, 0, 0, 231, 1363, 1366,
+	1360, 1369, 0, 233, 1375, 1378, 1372, 1381,
+	0, 181, 1063, 1066, 1060, 1069, 235, 1387,
+	1390, 1384, 1393, 0, 0, 0, 0, 0,
+	165, 967, 970, 964, 973, 167, 979, 982,
+	976, 985, 0, 0, 0, 0, 0, 0,
+	185, 1087, 1090, 1084, 1093, 0, 229, 1351,
+	1354, 1348, 1357, 155, 907, 910, 0, 904,
+	913, 0, 203, 1195, 1198, 0, 1192, 1201,
+	209, 1231, 1234, 0, 1228, 1237, 0, 0,
+	0, 0, 211, 1243, 1246, 1240, 1249, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	221, 1303, 1306, 1300, 1309, 0, 0, 161,
+	943, 946, 940, 949, 0, 0, 0, 171,
+	1003, 1006, 1000, 1009, 0, 0, 0, 201,
+	1183, 1186, 1180, 1189, 175, 1027, 1030, 1024,
+	1033, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 215, 1267, 1270, 1264, 1273, 0,
+	159, 931, 934, 928, 937, 0, 227, 1339,
+	1342, 1336, 1345, 0, 183, 1075, 1078, 1072,
+	1081, 0, 0, 0, 197, 1159, 1162, 1156,
+	1165, 0, 0, 0, 0, 0, 213, 1255,
+	1258, 1252, 1261, 0, 169, 991, 994, 988,
+	997, 0, 0, 2522, 577, 47, 631, 634,
+	43, 628, 637, 0, 0, 241, 1423, 1426,
+	1420, 1429, 0, 0, 0, 0, 0, 225,
+	1327, 1330, 1324, 1333, 553, 571, 1, 577,
+	47, 631, 634, 43, 628, 637, 0, 5,
+	7, 577, 3, 9, 45, 616, 619, 43,
+	613, 622, 0, 5, 7, 365, 3, 9,
+	0, 5, 7, 3, 9, 127, 1, 11,
+	427, 11, 427, 11, 427, 127, 1, 577,
+	45, 616, 619, 43, 613, 622, 0, 5,
+	7, 577, 3, 9, 45, 616, 619, 43,
+	613, 622, 0, 5, 7, 577, 3, 9,
+	47, 631, 634, 43, 628, 637, 0, 5,
+	7, 33, 496, 3, 9, 35, 508, 511,
+	505, 514, 802, 0, 5, 7, 499, 3,
+	9, 131, 133, 0, 135, 137, 0, 139,
+	0, 141, 143, 0, 517, 129, 1, 0,
+	0, 11, 427, 115, 113, 11, 427, 11,
+	427, 11, 427, 577, 45, 616, 619, 43,
+	613, 622, 0, 5, 7, 577, 3, 9,
+	45, 616, 619, 43, 613, 622, 0, 5,
+	7, 577, 3, 9, 47, 631, 634, 43,
+	628, 637, 0, 5, 7, 33, 496, 3,
+	9, 502, 115, 113, 11, 427, 11, 427,
+	11, 427, 577, 45, 616, 619, 43, 613,
+	622, 0, 5, 7, 577, 3, 9, 45,
+	616, 619, 43, 613, 622, 0, 5, 7,
+	577, 3, 9, 45, 616, 619, 43, 613,
+	622, 0, 5, 7, 113, 3, 9, 115,
+	0, 5, 7, 3, 9, 1, 382, 403,
+	11, 427, 11, 427, 11, 427, 11, 427,
+	577, 49, 649, 652, 43, 646, 655, 0,
+	5, 7, 577, 3, 9, 640, 43, 1,
+	11, 427, 577, 49, 649, 652, 43, 646,
+	655, 0, 5, 7, 577, 3, 9, 45,
+	616, 619, 43, 613, 622, 0, 5, 7,
+	577, 3, 9, 45, 616, 619, 43, 613,
+	622, 0, 5, 7, 113, 3, 9, 115,
+	0, 5, 7, 3, 9, 1, 382, 403,
+	11, 427, 11, 427, 11, 427, 11, 427,
+	577, 47, 631, 634, 43, 628, 637, 0,
+	5, 7, 769, 3, 9, 2830, 103, 11,
+	427, 577, 47, 631, 634, 43, 628, 637,
+	0, 5, 7, 2104, 3, 9, 115, 113,
+	115, 2894, 359, 113, 115, 113, 115, 3114,
+	3110, 11, 427, 2101, 115, 3106, 357, 113,
+	115, 3098, 2101, 115, 357, 113, 115, 3102,
+	577, 47, 631, 634, 43, 628, 637, 0,
+	5, 7, 577, 3, 9, 47, 631, 634,
+	43, 628, 637, 73, 0, 5, 7, 3,
+	9, 1, 11, 427, 11, 427, 577, 45,
+	616, 619, 43, 613, 622, 493, 0, 5,
+	7, 3, 9, 35, 508, 511, 505, 514,
+	73, 0, 5, 7, 3, 9, 1, 11,
+	427, 11, 427, 544, 541, 0, 2478, 2482,
+	520, 430, 439, 2474, 2486, 541, 371, 2314,
+	2322, 3130, 3138, 2286, 2330, 3122, 3126, 4079,
+	4089, 2498, 541, 2314, 2322, 2802, 2802, 2802,
+	2802, 2802, 2802, 2802, 2802, 2802, 2802, 2802,
+	2802, 2802, 2802, 2802, 2802, 2802, 2286, 2330,
+	4234, 4249, 4464, 4464, 4464, 4464, 4464, 4464,
+	4464, 4464, 4464, 4464, 4464, 4464, 4464, 4464,
+	4464, 4464, 4464, 2490, 2798, 91, 4449, 4454,
+	2794, 2786, 2790, 4444, 4459, 2314, 2322, 2286,
+	2330, 445, 2378, 2386, 4134, 2394, 445, 2310,
+	2318, 2326, 4084, 5511, 5517, 5613, 5613, 5613,
+	5613, 5613, 5613, 5613, 5613, 5613, 5613, 5613,
+	5613, 5613, 5613, 5613, 5613, 5613, 4074
+};
+
+static const short _zone_scanner_eof_actions[] = {
+	0, 2526, 2682, 377, 2122, 369, 2107, 15,
+	15, 369, 369, 2107, 2107, 2107, 4254, 5595,
+	2119, 377, 377, 2122, 2107, 2107, 377, 377,
+	377, 377, 377, 2122, 2122, 377, 377, 2122,
+	377, 377, 377, 2122, 377, 377, 377, 2122,
+	377, 377, 377, 377, 2122, 377, 377, 377,
+	2122, 377, 377, 377, 2122, 2122, 377, 377,
+	377, 377, 2122, 377, 2122, 377, 377, 377,
+	377, 2122, 377, 377, 377, 377, 377, 377,
+	377, 377, 377, 377, 2122, 377, 377, 2122,
+	2122, 377, 377, 2122, 377, 2122, 377, 2122,
+	2122, 377, 377, 377, 377, 2122, 2122, 377,
+	377, 377, 377, 2122, 377, 2122, 2122, 377,
+	2122, 2122, 377, 377, 377, 377, 2122, 377,
+	377, 377, 377, 377, 377, 377, 377, 377,
+	2122, 377, 377, 2122, 377, 2122, 377, 377,
+	377, 2122, 2122, 377, 377, 377, 377, 377,
+	2122, 377, 2122, 377, 2122, 377, 2122, 377,
+	377, 377, 2122, 377, 377, 377, 2122, 377,
+	2122, 377, 377, 589, 2530, 377, 377, 2122,
+	377, 377, 377, 377, 377, 2122, 377, 2526,
+	377, 377, 589, 2682, 2682, 2682, 2682, 377,
+	15, 93, 93, 93, 93, 93, 93, 93,
+	93, 39, 589, 0, 4239, 589, 377, 2682,
+	2682, 2682, 377, 2502, 2530, 3142, 2107, 2526,
+	15, 2107, 15, 4254, 3142, 3142, 3142, 3142,
+	3142, 3142, 3142, 3142, 3142, 3142, 3142, 3142,
+	3142, 3142, 3142, 3142, 2107, 3118, 93, 93,
+	93, 93, 93, 93, 93, 93, 93, 2494,
+	5664, 2526, 2119, 4244, 4254, 4244, 4244, 4244,
+	4244, 4244, 4244, 4244, 4244, 4244, 4244, 4244,
+	4244, 4244, 4244, 4244, 4244, 547, 4254, 2107,
+	15, 2107, 2107, 377, 377, 2122, 377, 377,
+	377, 2122, 377, 2122, 2107, 2107, 15, 2107,
+	2107, 2107, 2107, 369, 4254, 2107, 2107, 550,
+	550, 550, 550, 550, 550, 550, 550, 550,
+	550, 550, 550, 550, 550, 550, 550, 15,
+	2119, 550, 2119, 0, 0, 31, 31, 31,
+	472, 472, 472, 472, 31, 31, 703, 703,
+	2742, 2742, 2742, 2742, 703, 67, 2742, 2742,
+	2742, 2742, 75, 580, 4424, 448, 448, 4424,
+	2674, 4424, 75, 79, 79, 79, 451, 451,
+	451, 475, 475, 475, 475, 451, 79, 0,
+	83, 730, 736, 85, 736, 15, 15, 478,
+	478, 478, 478, 736, 15, 85, 0, 0,
+	125, 125, 125, 125, 125, 125, 125, 341,
+	341, 341, 341, 341, 341, 341, 341, 341,
+	341, 341, 341, 341, 341, 341, 341, 341,
+	341, 341, 341, 341, 341, 341, 341, 341,
+	341, 341, 341, 341, 341, 341, 341, 341,
+	341, 341, 341, 341, 341, 341, 341, 341,
+	341, 341, 341, 341, 341, 341, 341, 341,
+	341, 341, 341, 341, 341, 341, 341, 341,
+	341, 341, 341, 341, 341, 341, 341, 341,
+	341, 341, 341, 341, 341, 341, 341, 341,
+	341, 341, 341, 341, 341, 341, 341, 341,
+	341, 341, 341, 341, 341, 341, 341, 341,
+	341, 341, 341, 341, 341, 341, 341, 341,
+	341, 341, 341, 341, 341, 341, 341, 341,
+	341, 341, 341, 341, 341, 341, 341, 341,
+	341, 341, 341, 341, 341, 341, 341, 341,
+	341, 341, 341, 341, 341, 341, 341, 341,
+	341, 341, 341, 341, 341, 341, 341, 341,
+	341, 341, 341, 341, 341, 341, 341, 341,
+	341, 341, 341, 341, 341, 341, 341, 341,
+	341, 341, 341, 341, 355, 583, 583, 2890,
+	2890, 2890, 2890, 355, 355, 355, 583, 583,
+	2890, 2890, 2890, 2890, 355, 583, 355, 361,
+	361, 361, 361, 361, 361, 361, 361, 361,
+	361, 361, 361, 361, 361, 361, 361, 361,
+	361, 361, 361, 361, 361, 361, 361, 361,
+	361, 361, 361, 361, 361, 361, 361, 361,
+	361, 361, 361, 361, 361, 361, 361, 361,
+	361, 361, 361, 361, 361, 361, 361, 361,
+	361, 361, 361, 361, 361, 361, 361, 361,
+	361, 361, 361, 361, 361, 361, 361, 361,
+	361, 361, 361, 361, 361, 361, 361, 361,
+	361, 361, 361, 361, 361, 361, 361, 361,
+	361, 361, 361, 361, 361, 361, 361, 361,
+	361, 361, 361, 361, 361, 361, 361, 361,
+	361, 361, 361, 361, 361, 361, 361, 363,
+	363, 363, 363, 363, 363, 363, 363, 363,
+	363, 363, 363, 363, 363, 363, 363, 363,
+	363, 363, 363, 363, 363, 363, 363, 363,
+	363, 363, 363, 363, 363, 363, 363, 363,
+	363, 363, 363, 363, 363, 363, 363, 363,
+	772, 772, 369, 369, 369, 369, 369, 369,
+	586, 586, 586, 2678, 586, 2678, 586, 2678,
+	586, 2678, 2678, 2678, 2678, 369, 2678, 2678,
+	2678, 369, 2678, 2678, 2678, 369, 2678, 2678,
+	2678, 369, 369, 369, 369, 369, 369, 369,
+	369, 369, 369, 369, 369, 369, 586, 586,
+	369, 369, 369, 718, 718, 718, 718, 772,
+	772, 2098, 2098, 2098, 2098, 2098, 2098, 2098,
+	2098, 2098, 2098, 2098, 2098, 2098, 2098, 2098,
+	2098, 2098, 2098, 2098, 2098, 2098, 2098, 2098,
+	2098, 2098, 2098, 2098, 2098, 2098, 2098, 2098,
+	2098, 2098, 2098, 2098, 2098, 2098, 2098, 2098,
+	2098, 2098, 2098, 2098, 2098, 2098, 2098, 2098,
+	2098, 2098, 2098, 2098, 2098, 2098, 2098, 2098,
+	586, 586, 586, 586, 586, 586, 369, 369,
+	369, 369, 369, 586, 586, 586, 586, 369,
+	369, 369, 369, 369, 369, 369, 369, 369,
+	369, 369, 369, 369, 369, 369, 586, 586,
+	369, 369, 369, 369, 369, 369, 369, 793,
+	793, 793, 2822, 2822, 793, 793, 369, 793,
+	2822, 2822, 586, 586, 369, 369, 586, 586,
+	796, 796, 796, 796, 369, 369, 369, 586,
+	586, 586, 586, 796, 796, 796, 796, 369,
+	369, 586, 586, 883, 883, 2518, 2518, 883,
+	2898, 886, 886, 886, 886, 886, 886, 886,
+	883, 883, 883, 2518, 2518, 2826, 4474, 883,
+	883, 883, 2518, 2518, 2826, 4474, 883, 883,
+	883, 2518, 2518, 883, 2898, 883, 883, 369,
+	889, 889, 369, 369, 586, 586, 586, 586,
+	697, 697, 697, 697, 586, 586, 369, 369,
+	369, 369, 369, 369, 369, 369, 369, 369,
+	369, 369, 889, 889, 889, 889, 889, 889,
+	889, 889, 889, 889, 889, 889, 889, 889,
+	889, 889, 889, 889, 889, 889, 889, 889,
+	889, 889, 889, 889, 889, 889, 889, 889,
+	889, 889, 889, 889, 889, 889, 889, 889,
+	889, 889, 889, 889, 889, 889, 889, 889,
+	889, 889, 889, 889, 889, 889, 889, 889,
+	889, 889, 889, 889, 889, 889, 889, 889,
+	889, 889, 889, 889, 889, 889, 889, 889,
+	889, 889, 889, 889, 889, 889, 889, 889,
+	889, 889, 889, 889, 889, 889, 889, 889,
+	889, 889, 889, 889, 889, 889, 889, 889,
+	889, 889, 889, 889, 889, 889, 889, 889,
+	889, 889, 889, 889, 889, 889, 889, 889,
+	889, 889, 889, 889, 889, 889, 889, 889,
+	889, 889, 889, 889, 889, 889, 889, 889,
+	889, 889, 889, 889, 889, 889, 889, 889,
+	889, 889, 889, 889, 889, 889, 889, 889,
+	2522, 2522, 889, 889, 889, 889, 889, 889,
+	889, 889, 889, 369, 369, 369, 586, 586,
+	586, 586, 369, 369, 369, 369, 369, 369,
+	369, 369, 369, 586, 586, 586, 586, 586,
+	586, 796, 796, 802, 802, 802, 802, 802,
+	802, 802, 802, 802, 369, 802, 802, 802,
+	802, 802, 369, 796, 796, 369, 369, 369,
+	586, 586, 586, 586, 586, 586, 796, 796,
+	796, 796, 369, 369, 369, 586, 586, 586,
+	586, 586, 586, 796, 796, 796, 796, 369,
+	369, 369, 586, 586, 586, 586, 369, 369,
+	586, 586, 586, 586, 586, 586, 796, 796,
+	796, 796, 369, 369, 369, 586, 586, 772,
+	772, 369, 586, 586, 796, 796, 796, 796,
+	2894, 796, 796, 796, 796, 3114, 369, 796,
+	796, 3106, 796, 796, 3106, 796, 796, 3106,
+	796, 796, 3106, 586, 586, 586, 586, 369,
+	369, 369, 369, 586, 586, 369, 369, 369,
+	369, 369, 369, 0, 0, 0, 0, 91,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0
+};
+
+
+
+
+
+
+__attribute__((visibility("default")))
+int zs_init(
+	zs_scanner_t *s,
+	const char *origin,
+	const uint16_t rclass,
+	const uint32_t ttl)
+{
+	if (s == NULL) {
+		return -1;
+	}
+
+	memset(s, 0, sizeof(*s));
+
+	// Nonzero initial scanner state.
+	s->cs = 1227;
+
+	// Reset the file descriptor.
+	s->file.descriptor = -1;
+
+	// Use the root zone as origin if not specified.
+	if (origin == NULL || strlen(origin) == 0) {
+		origin = ".";
+	}
+	size_t origin_len = strlen(origin);
+
+	// Prepare a zone settings header.
+	const char *format;
+	if (origin[origin_len - 1] != '.') {
+		format = "$ORIGIN %s.\n";
+	} else {
+		format = "$ORIGIN %s\n";
+	}
+
+	char settings[1024];
+	int ret = snprintf(settings, sizeof(settings), format, origin);
+	if (ret <= 0 || ret >= sizeof(settings)) {
+		ERR(ZS_ENOMEM);
+		return -1;
+	}
+
+	// Parse the settings to set up the scanner origin.
+	if (zs_set_input_string(s, settings, ret) != 0 ||
+	    zs_parse_all(s) != 0) {
+		return -1;
+	}
+
+	// Set scanner defaults.
+	s->path = strdup(".");
+	if (s->path == NULL) {
+		ERR(ZS_ENOMEM);
+		return -1;
+	}
+	s->default_class = rclass;
+	s->default_ttl = ttl;
+	s->line_counter = 1;
+
+	s->state = ZS_STATE_NONE;
+	s->process.automatic = false;
+
+	return 0;
+}
+
+static void input_deinit(
+	zs_scanner_t *s,
+	bool keep_filename)
+{
+	// Deinit the file input.
+	if (s->file.descriptor != -1) {
+		// Unmap the file content.
+		if (s->input.start != NULL) {
+			if (s->input.mmaped) {
+				munmap((void *)s->input.start,
+				       s->input.end - s->input.start);
+			} else {
+				free((void *)s->input.start);
+			}
+		}
+
+		// Close the opened file.
+		close(s->file.descriptor);
+		s->file.descriptor = -1;
+	}
+
+	// Keep file name for possible trailing error report.
+	if (!keep_filename) {
+		free(s->file.name);
+		s->file.name = NULL;
+	}
+
+	// Unset the input limits.
+	s->input.start   = NULL;
+	s->input.current = NULL;
+	s->input.end     = NULL;
+	s->input.eof     = false;
+}
+
+__attribute__((visibility("default")))
+void zs_deinit(
+	zs_scanner_t *s)
+{
+	if (s == NULL) {
+		return;
+	}
+
+	input_deinit(s, false);
+	free(s->path);
+}
+
+static int set_input_string(
+	zs_scanner_t *s,
+	const char *input,
+	size_t size,
+	bool final_block)
+{
+	if (s == NULL) {
+		return -1;
+	}
+
+	if (input == NULL) {
+		ERR(ZS_EINVAL);
+		return -1;
+	}
+
+	// Deinit possibly opened file.
+	input_deinit(s, final_block);
+
+	// Set the scanner input limits.
+	s->input.start   = input;
+	s->input.current = input;
+	s->input.end     = input + size;
+	s->input.eof     = final_block;
+
+	return 0;
+}
+
+static char *read_file_to_buf(
+	int fd,
+	size_t *bufsize)
+{
+	size_t bufs = 0, newbufs = 8192;
+	char *buf = malloc(bufs + newbufs);
+	int ret = 0;
+
+	while (buf != NULL && (ret = read(fd, buf + bufs, newbufs)) == newbufs) {
+		bufs += newbufs;
+		newbufs = bufs;
+		char *newbuf = realloc(buf, bufs + newbufs);
+		if (newbuf == NULL) {
+			free(buf);
+		}
+		buf = newbuf;
+	}
+	if (ret < 0) {
+		free(buf);
+		return NULL;
+	}
+
+	*bufsize = bufs + ret;
+	return buf;
+}
+
+__attribute__((visibility("default")))
+int zs_set_input_string(
+	zs_scanner_t *s,
+	const char *input,
+	size_t size)
+{
+	s->state = ZS_STATE_NONE;
+
+	return set_input_string(s, input, size, false);
+}
+
+__attribute__((visibility("default")))
+int zs_set_input_file(
+	zs_scanner_t *s,
+	const char *file_name)
+{
+	if (s == NULL) {
+		return -1;
+	}
+
+	if (file_name == NULL) {
+		ERR(ZS_EINVAL);
+		return -1;
+	}
+
+	// Deinit possibly opened file.
+	input_deinit(s, false);
+
+	// Try to open the file.
+	s->file.descriptor = open(file_name, O_RDONLY);
+	if (s->file.descriptor == -1) {
+		ERR(ZS_FILE_OPEN);
+		return -1;
+	}
+
+	char *start = NULL;
+	size_t size = 0;
+
+	// Check the input.
+	struct stat file_stat;
+	if (fstat(s->file.descriptor, &file_stat) == -1) {
+		ERR(ZS_FILE_INVALID);
+		input_deinit(s, false);
+		return -1;
+	} else if (S_ISCHR(file_stat.st_mode) ||
+	           S_ISBLK(file_stat.st_mode) ||
+	           S_ISFIFO(file_stat.st_mode)) {
+		// Workaround if cannot mmap, read to memory.
+		start = read_file_to_buf(s->file.descriptor, &size);
+		if (start == NULL) {
+			ERR(ZS_FILE_INVALID);
+			input_deinit(s, false);
+			return -1;
+		}
+	} else if (!S_ISREG(file_stat.st_mode)) { // Require regular file.
+		ERR(ZS_FILE_INVALID);
+		input_deinit(s, false);
+		return -1;
+	} else if (file_stat.st_size > 0) { // Mmap non-emtpy file.
+		start = mmap(0, file_stat.st_size, PROT_READ, MAP_SHARED,
+		             s->file.descriptor, 0);
+		if (start == MAP_FAILED) {
+			ERR(ZS_FILE_INVALID);
+			input_deinit(s, false);
+			return -1;
+		}
+
+		size = file_stat.st_size;
+		s->input.mmaped = true;
+
+		// Try to set the mapped memory advise to sequential.
+#if defined(MADV_SEQUENTIAL) && !defined(__sun)
+		(void)madvise(start, size, MADV_SEQUENTIAL);
+#else
+#ifdef POSIX_MADV_SEQUENTIAL
+		(void)posix_madvise(start, size, POSIX_MADV_SEQUENTIAL);
+#endif /* POSIX_MADV_SEQUENTIAL */
+#endif /* MADV_SEQUENTIAL && !__sun */
+	}
+
+	// Set the scanner input limits.
+	s->input.start   = start;
+	s->input.current = start;
+	s->input.end     = start + size;
+
+	// Get absolute path of the zone file if possible.
+	char *full_name = realpath(file_name, NULL);
+	if (full_name != NULL) {
+		free(s->path);
+		s->path = strdup(dirname(full_name));
+		free(full_name);
+		if (s->path == NULL) {
+			ERR(ZS_ENOMEM);
+			input_deinit(s, false);
+			return -1;
+		}
+	}
+
+	s->file.name = strdup(file_name);
+	if (s->file.name == NULL) {
+		ERR(ZS_ENOMEM);
+		input_deinit(s, false);
+		return -1;
+	}
+
+	s->state = ZS_STATE_NONE;
+
+	return 0;
+}
+
+__attribute__((visibility("default")))
+int zs_set_processing(
+	zs_scanner_t *s,
+	void (*process_record)(zs_scanner_t *),
+	void (*process_error)(zs_scanner_t *),
+	void *data)
+{
+	if (s == NULL) {
+		return -1;
+	}
+
+	s->process.record = process_record;
+	s->process.error = process_error;
+	s->process.data = data;
+
+	return 0;
+}
+
+__attribute__((visibility("default")))
+int zs_set_processing_comment(
+	zs_scanner_t *s,
+	void (*process_comment)(zs_scanner_t *))
+{
+	if (s == NULL) {
+		return -1;
+	}
+
+	s->process.comment = process_comment;
+
+	return 0;
+}
+
+typedef enum {
+	WRAP_NONE,     // Initial state.
+	WRAP_DETECTED, // Input block end is a first '\' in rdata.
+	WRAP_PROCESS   // Parsing of auxiliary block = "\".
+} wrap_t;
+
+static void parse(
+	zs_scanner_t *s,
+	wrap_t *wrap)
+{
+	// Restore scanner input limits (Ragel internals).
+	const char *p = s->input.current;
+	const char *pe = s->input.end;
+	const char *eof = s->input.eof ? pe : NULL;
+
+	// Restore state variables (Ragel internals).
+	int cs  = s->cs;
+	int top = s->top;
+	int stack[ZS_RAGEL_STACK_SIZE];
+	memcpy(stack, s->stack, sizeof(stack));
+
+	// Next 2 variables are for better performance.
+	// Restoring r_data pointer to next free space.
+	uint8_t *rdata_tail = s->r_data + s->r_data_tail;
+	// Initialization of the last r_data byte.
+	uint8_t *rdata_stop = s->r_data + ZS_MAX_RDATA_LENGTH - 1;
+
+	// Write scanner body (in C).
+
+	{
+	int _klen;
+	unsigned int _trans;
+	short _widec;
+	const short *_acts;
+	unsigned int _nacts;
+	const short *_keys;
+
+	if ( p == pe )
+		goto _test_eof;
+	if ( cs == 0 )
+		goto _out;
+_resume:
+	_widec = (*p);
+	_klen = _zone_scanner_cond_lengths[cs];
+	_keys = _zone_scanner_cond_keys + (_zone_scanner_cond_offsets[cs]*2);
+	if ( _klen > 0 ) {
+		const short *_lower = _keys;
+		const short *_mid;
+		const short *_upper = _keys + (_klen<<1) - 2;
+		while (1) {
+			if ( _upper < _lower )
+				break;
+
+			_mid = _lower + (((_upper-_lower) >> 1) & ~1);
+			if ( _widec < _mid[0] )
+				_upper = _mid - 2;
+			else if ( _widec > _mid[1] )
+				_lower = _mid + 2;
+			else {
+				switch ( _zone_scanner_cond_spaces[_zone_scanner_cond_offsets[cs] + ((_mid - _keys)>>1)] ) {
+	case 0: {
+		_widec = (short)(640 + ((*p) - -128));
+		if (
+ s->multiline  ) _widec += 256;
+		break;
+	}
+	case 1: {
+		_widec = (short)(1152 + ((*p) - -128));
+		if (
+ !s->multiline  ) _widec += 256;
+		break;
+	}
+	case 2: {
+		_widec = (short)(128 + ((*p) - -128));
+		if (
+ s->multiline  ) _widec += 256;
+		break;
+	}
+	case 3: {
+		_widec = (short)(2688 + ((*p) - -128));
+		if (
+ s->number64 != 0  ) _widec += 256;
+		break;
+	}
+	case 4: {
+		_widec = (short)(4224 + ((*p) - -128));
+		if (
+ s->number64 == 0  ) _widec += 256;
+		break;
+	}
+	case 5: {
+		_widec = (short)(1664 + ((*p) - -128));
+		if (
+ s->multiline  ) _widec += 256;
+		if (
+ !s->multiline  ) _widec += 512;
+		break;
+	}
+	case 6: {
+		_widec = (short)(3200 + ((*p) - -128));
+		if (
+ s->multiline  ) _widec += 256;
+		if (
+ s->number64 != 0  ) _widec += 512;
+		break;
+	}
+	case 7: {
+		_widec = (short)(4736 + ((*p) - -128));
+		if (
+ s->multiline  ) _widec += 256;
+		if (
+ s->number64 == 0  ) _widec += 512;
+		break;
+	}
+	case 8: {
+		_widec = (short)(5760 + ((*p) - -128));
+		if (
+ s->number64 != 0  ) _widec += 256;
+		if (
+ s->number64 == 0  ) _widec += 512;
+		break;
+	}
+	case 9: {
+		_widec = (short)(12928 + ((*p) - -128));
+		if (
+ s->multiline  ) _widec += 256;
+		if (
+ !s->multiline  ) _widec += 512;
+		if (
+ s->number64 == 0  ) _widec += 1024;
+		break;
+	}
+	case 10: {
+		_widec = (short)(6784 + ((*p) - -128));
+		if (
+ s->multiline  ) _widec += 256;
+		if (
+ s->number64 != 0  ) _widec += 512;
+		if (
+ s->number64 == 0  ) _widec += 1024;
+		break;
+	}
+	case 11: {
+		_widec = (short)(8832 + ((*p) - -128));
+		if (
+ s->multiline  ) _widec += 256;
+		if (
+ !s->multiline  ) _widec += 512;
+		if (
+ s->number64 != 0  ) _widec += 1024;
+		if (
+ s->number64 == 0  ) _widec += 2048;
+		break;
+	}
+				}
+				break;
+			}
+		}
+	}
+
+	_keys = _zone_scanner_trans_keys + _zone_scanner_key_offsets[cs];
+	_trans = _zone_scanner_index_offsets[cs];
+
+	_klen = _zone_scanner_single_lengths[cs];
+	if ( _klen > 0 ) {
+		const short *_lower = _keys;
+		const short *_mid;
+		const short *_upper = _keys + _klen - 1;
+		while (1) {
+			if ( _upper < _lower )
+				break;
+
+			_mid = _lower + ((_upper-_lower) >> 1);
+			if ( _widec < *_mid )
+				_upper = _mid - 1;
+			else if ( _widec > *_mid )
+				_lower = _mid + 1;
+			else {
+				_trans += (unsigned int)(_mid - _keys);
+				goto _match;
+			}
+		}
+		_keys += _klen;
+		_trans += _klen;
+	}
+
+	_klen = _zone_scanner_range_lengths[cs];
+	if ( _klen > 0 ) {
+		const short *_lower = _keys;
+		const short *_mid;
+		const short *_upper = _keys + (_klen<<1) - 2;
+		while (1) {
+			if ( _upper < _lower )
+				break;
+
+			_mid = _lower + (((_upper-_lower) >> 1) & ~1);
+			if ( _widec < _mid[0] )
+				_upper = _mid - 2;
+			else if ( _widec > _mid[1] )
+				_lower = _mid + 2;
+			else {
+				_trans += (unsigned int)((_mid - _keys)>>1);
+				goto _match;
+			}
+		}
+		_trans += _klen;
+	}
+
+_match:
+	_trans = _zone_scanner_indicies[_trans];
+	cs = _zone_scanner_trans_targs[_trans];
+
+	if ( _zone_scanner_trans_actions[_trans] == 0 )
+		goto _again;
+
+	_acts = _zone_scanner_actions + _zone_scanner_trans_actions[_trans];
+	_nacts = (unsigned int) *_acts++;
+	while ( _nacts-- > 0 )
+	{
+		switch ( *_acts++ )
+		{
+	case 0:
+	{
+		p--; {cs = stack[--top]; goto _again;}
+	}
+	break;
+	case 1:
+	{
+		s->line_counter++;
+	}
+	break;
+	case 2:
+	{
+		if (s->multiline == true) {
+			ERR(ZS_LEFT_PARENTHESIS);
+			p--; {cs = 299;goto _again;}
+		}
+		s->multiline = true;
+	}
+	break;
+	case 3:
+	{
+		if (s->multiline == false) {
+			ERR(ZS_RIGHT_PARENTHESIS);
+			p--; {cs = 299;goto _again;}
+		}
+		s->multiline = false;
+	}
+	break;
+	case 4:
+	{
+		s->buffer_length = 0;
+	}
+	break;
+	case 5:
+	{
+		if (s->buffer_length < sizeof(s->buffer) - 1) {
+			s->buffer[s->buffer_length++] = (*p);
+		}
+	}
+	break;
+	case 6:
+	{
+		s->buffer[s->buffer_length++] = 0;
+
+		// Execute the comment callback.
+		if (s->process.automatic && s->process.comment != NULL) {
+			s->process.comment(s);
+
+			// Stop if required from the callback.
+			if (s->state == ZS_STATE_STOP) {
+				{p++; goto _out; }
+			}
+		}
+	}
+	break;
+	case 7:
+	{
+		s->buffer[0] = 0;
+		s->buffer_length = 0;
+	}
+	break;
+	case 8:
+	{
+		WARN(ZS_BAD_REST);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 9:
+	{
+		s->buffer_length = 0;
+	}
+	break;
+	case 10:
+	{
+		if ((*p) == '\r') {
+			ERR(ZS_DOS_NEWLINE);
+		}
+
+		if (s->buffer_length < sizeof(s->buffer) - 1) {
+			s->buffer[s->buffer_length++] = (*p);
+		}
+	}
+	break;
+	case 11:
+	{
+		// Terminate the error context string.
+		s->buffer[s->buffer_length++] = 0;
+
+		// Error counter incrementation.
+		s->error.counter++;
+
+		// Initialize the fcall stack.
+		top = 0;
+
+		// Reset the multiline context.
+		s->multiline = false;
+
+		s->state = ZS_STATE_ERROR;
+
+		// Execute the error callback.
+		if (s->process.automatic) {
+			if (s->process.error != NULL) {
+				s->process.error(s);
+
+				// Stop if required from the callback.
+				if (s->state == ZS_STATE_STOP) {
+					{p++; goto _out; }
+				}
+			}
+
+			// Stop the scanner if fatal error.
+			if (s->error.fatal) {
+				{p++; goto _out; }
+			}
+			{cs = 1227;goto _again;}
+		} else {
+			// Return if external processing.
+			p--; cs = 1227; {p++; goto _out; }
+		}
+	}
+	break;
+	case 12:
+	{
+		s->item_length = 0;
+		s->item_length_position = s->dname_tmp_length++;
+	}
+	break;
+	case 13:
+	{
+		// Check for maximum dname label length.
+		if (s->item_length < ZS_MAX_LABEL_LENGTH) {
+			(s->dname)[s->dname_tmp_length++] = (*p);
+			s->item_length++;
+		} else {
+			WARN(ZS_LABEL_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 14:
+	{
+		// Check for maximum dname length overflow after each label.
+		// (at least the next label length must follow).
+		if (s->dname_tmp_length < ZS_MAX_DNAME_LENGTH) {
+			(s->dname)[s->item_length_position] =
+				(uint8_t)(s->item_length);
+		} else {
+			WARN(ZS_DNAME_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 15:
+	{
+		if (s->item_length < ZS_MAX_LABEL_LENGTH) {
+			(s->dname)[s->dname_tmp_length] = 0;
+			s->item_length++;
+		} else {
+			WARN(ZS_LABEL_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 16:
+	{
+		(s->dname)[s->dname_tmp_length] *= 10;
+		(s->dname)[s->dname_tmp_length] += digit_to_num[(uint8_t)(*p)];
+	}
+	break;
+	case 17:
+	{
+		s->dname_tmp_length++;
+	}
+	break;
+	case 18:
+	{
+		WARN(ZS_BAD_NUMBER);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 19:
+	{
+		// Enough room for the terminal label is guaranteed (_label_exit).
+		(s->dname)[s->dname_tmp_length++] = 0;
+	}
+	break;
+	case 20:
+	{
+		// Check for (relative + origin) dname length overflow.
+		if (s->dname_tmp_length + s->zone_origin_length <= ZS_MAX_DNAME_LENGTH) {
+			memcpy(s->dname + s->dname_tmp_length,
+			       s->zone_origin,
+			       s->zone_origin_length);
+
+			s->dname_tmp_length += s->zone_origin_length;
+		} else {
+			WARN(ZS_DNAME_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 21:
+	{
+		// Copy already verified zone origin.
+		memcpy(s->dname,
+		       s->zone_origin,
+		       s->zone_origin_length);
+
+		s->dname_tmp_length = s->zone_origin_length;
+	}
+	break;
+	case 22:
+	{
+		s->item_length_position = 0;
+		s->dname_tmp_length = 0;
+	}
+	break;
+	case 23:
+	{
+		WARN(ZS_BAD_DNAME_CHAR);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 24:
+	{ p--; {stack[top++] = cs; cs = 301;goto _again;} }
+	break;
+	case 25:
+	{
+		if (rdata_tail <= rdata_stop) {
+			s->item_length_location = rdata_tail++;
+		} else {
+			WARN(ZS_RDATA_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 26:
+	{
+		s->item_length = rdata_tail - s->item_length_location - 1;
+
+		if (s->item_length <= MAX_ITEM_LENGTH) {
+			*(s->item_length_location) = (uint8_t)(s->item_length);
+		} else {
+			WARN(ZS_ITEM_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 27:
+	{
+		s->dname = s->r_owner;
+		s->r_owner_length = 0;
+	}
+	break;
+	case 28:
+	{
+		s->r_owner_length = s->dname_tmp_length;
+	}
+	break;
+	case 29:
+	{
+		if (s->r_owner_length == 0) {
+			WARN(ZS_BAD_PREVIOUS_OWNER);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 30:
+	{
+		s->r_owner_length = 0;
+		WARN(ZS_BAD_OWNER);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 31:
+	{
+		s->dname = rdata_tail;
+	}
+	break;
+	case 32:
+	{
+		rdata_tail += s->dname_tmp_length;
+	}
+	break;
+	case 33:
+	{
+		// Overflow check: 10*(s->number64) + fc - '0' <= UINT64_MAX
+		if ((s->number64 < (UINT64_MAX / 10)) ||   // Dominant fast check.
+			((s->number64 == (UINT64_MAX / 10)) && // Marginal case.
+			 ((uint8_t)(*p) <= (UINT64_MAX % 10) + '0')
+			)
+		   ) {
+			s->number64 *= 10;
+			s->number64 += digit_to_num[(uint8_t)(*p)];
+		} else {
+			WARN(ZS_NUMBER64_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 34:
+	{
+		s->number64 = 0;
+	}
+	break;
+	case 35:
+	{
+		WARN(ZS_BAD_NUMBER);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 36:
+	{
+		s->decimal_counter = 0;
+	}
+	break;
+	case 37:
+	{
+		s->number64_tmp = s->number64;
+	}
+	break;
+	case 38:
+	{
+		s->decimal_counter++;
+	}
+	break;
+	case 39:
+	{
+		if (s->decimal_counter == 0 && s->number64 < UINT32_MAX) {
+			s->number64 *= pow(10, s->decimals);
+		} else if (s->decimal_counter <= s->decimals &&
+				 s->number64_tmp < UINT32_MAX) {
+			s->number64 *= pow(10, s->decimals - s->decimal_counter);
+			s->number64 += s->number64_tmp * pow(10, s->decimals);
+		} else {
+			WARN(ZS_FLOAT_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 40:
+	{
+		s->decimals = 2;
+	}
+	break;
+	case 41:
+	{
+		s->decimals = 3;
+	}
+	break;
+	case 42:
+	{
+		if (s->number64 <= UINT8_MAX) {
+			*rdata_tail = (uint8_t)(s->number64);
+			rdata_tail += 1;
+		} else {
+			WARN(ZS_NUMBER8_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 43:
+	{
+		if (s->number64 <= UINT16_MAX) {
+			uint16_t num16 = htons((uint16_t)s->number64);
+			memcpy(rdata_tail, &num16, 2);
+			rdata_tail += 2;
+		} else {
+			WARN(ZS_NUMBER16_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 44:
+	{
+		if (s->number64 <= UINT32_MAX) {
+			uint32_t num32 = htonl((uint32_t)s->number64);
+			memcpy(rdata_tail, &num32, 4);
+			rdata_tail += 4;
+		} else {
+			WARN(ZS_NUMBER32_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 45:
+	{
+		if (s->number64 <= UINT16_MAX) {
+			s->r_type = (uint16_t)(s->number64);
+		} else {
+			WARN(ZS_NUMBER16_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 46:
+	{
+		if (s->number64 <= UINT16_MAX) {
+			s->r_data_length = (uint16_t)(s->number64);
+		} else {
+			WARN(ZS_NUMBER16_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 47:
+	{
+		WARN(ZS_BAD_TIME_UNIT);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 48:
+	{ if (s->number64 <= (UINT32_MAX / 60)) {
+	                  s->number64 *= 60;
+	              } else {
+	                  WARN(ZS_NUMBER32_OVERFLOW);
+	                  p--; {cs = 299;goto _again;}
+	              }
+	            }
+	break;
+	case 49:
+	{ if (s->number64 <= (UINT32_MAX / 3600)) {
+	                  s->number64 *= 3600;
+	              } else {
+	                  WARN(ZS_NUMBER32_OVERFLOW);
+	                  p--; {cs = 299;goto _again;}
+	              }
+	            }
+	break;
+	case 50:
+	{ if (s->number64 <= (UINT32_MAX / 86400)) {
+	                  s->number64 *= 86400;
+	              } else {
+	                  WARN(ZS_NUMBER32_OVERFLOW);
+	                  p--; {cs = 299;goto _again;}
+	              }
+	            }
+	break;
+	case 51:
+	{ if (s->number64 <= (UINT32_MAX / 604800)) {
+	                  s->number64 *= 604800;
+	              } else {
+	                  WARN(ZS_NUMBER32_OVERFLOW);
+	                  p--; {cs = 299;goto _again;}
+	              }
+	            }
+	break;
+	case 52:
+	{
+		s->number64_tmp = s->number64;
+	}
+	break;
+	case 53:
+	{
+		if (s->number64 + s->number64_tmp < UINT32_MAX) {
+			s->number64 += s->number64_tmp;
+		} else {
+			WARN(ZS_NUMBER32_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 54:
+	{
+		s->buffer_length = 0;
+	}
+	break;
+	case 55:
+	{
+		if (s->buffer_length < sizeof(s->buffer) - 1) {
+			s->buffer[s->buffer_length++] = (*p);
+		} else {
+			WARN(ZS_RDATA_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 56:
+	{
+		s->buffer[s->buffer_length] = 0;
+
+		if (s->buffer_length == 14) { // Date; 14 = len("YYYYMMDDHHmmSS").
+			uint32_t timestamp;
+			int ret = date_to_timestamp(s->buffer, &timestamp);
+
+			if (ret == ZS_OK) {
+				*((uint32_t *)rdata_tail) = htonl(timestamp);
+				rdata_tail += 4;
+			} else {
+				WARN(ret);
+				p--; {cs = 299;goto _again;}
+			}
+		} else if (s->buffer_length <= 10) { // Timestamp format.
+			char *end;
+
+			s->number64 = strtoull((char *)(s->buffer), &end,  10);
+
+			if (end == (char *)(s->buffer) || *end != '\0') {
+				WARN(ZS_BAD_TIMESTAMP);
+				p--; {cs = 299;goto _again;}
+			}
+
+			if (s->number64 <= UINT32_MAX) {
+				*((uint32_t *)rdata_tail) = htonl((uint32_t)s->number64);
+				rdata_tail += 4;
+			} else {
+				WARN(ZS_NUMBER32_OVERFLOW);
+				p--; {cs = 299;goto _again;}
+			}
+		} else {
+			WARN(ZS_BAD_TIMESTAMP_LENGTH);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 57:
+	{
+		WARN(ZS_BAD_TIMESTAMP_CHAR);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 58:
+	{
+		if (rdata_tail <= rdata_stop) {
+			// Split long string.
+			if (s->long_string &&
+			    rdata_tail - s->item_length_location == 1 + MAX_ITEM_LENGTH) {
+				// _item_length_exit equivalent.
+				*(s->item_length_location) = MAX_ITEM_LENGTH;
+				// _item_length_init equivalent.
+				s->item_length_location = rdata_tail++;
+
+				if (rdata_tail > rdata_stop) {
+					WARN(ZS_TEXT_OVERFLOW);
+					p--; {cs = 299;goto _again;}
+				}
+			}
+
+			*(rdata_tail++) = (*p);
+		} else {
+			WARN(ZS_TEXT_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 59:
+	{
+		WARN(ZS_BAD_TEXT_CHAR);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 60:
+	{
+		WARN(ZS_BAD_TEXT);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 61:
+	{
+		if (rdata_tail <= rdata_stop) {
+			// Split long string.
+			if (s->long_string &&
+			    rdata_tail - s->item_length_location == 1 + MAX_ITEM_LENGTH) {
+				// _item_length_exit equivalent.
+				*(s->item_length_location) = MAX_ITEM_LENGTH;
+				// _item_length_init equivalent.
+				s->item_length_location = rdata_tail++;
+
+				if (rdata_tail > rdata_stop) {
+					WARN(ZS_TEXT_OVERFLOW);
+					p--; {cs = 299;goto _again;}
+				}
+			}
+
+			*rdata_tail = 0;
+			s->item_length++;
+		} else {
+			WARN(ZS_TEXT_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 62:
+	{
+		if ((*rdata_tail < (UINT8_MAX / 10)) ||   // Dominant fast check.
+			((*rdata_tail == (UINT8_MAX / 10)) && // Marginal case.
+			 ((*p) <= (UINT8_MAX % 10) + '0')
+			)
+		   ) {
+			*rdata_tail *= 10;
+			*rdata_tail += digit_to_num[(uint8_t)(*p)];
+		} else {
+			WARN(ZS_NUMBER8_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 63:
+	{
+		rdata_tail++;
+	}
+	break;
+	case 64:
+	{
+		WARN(ZS_BAD_NUMBER);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 65:
+	{ p--; {stack[top++] = cs; cs = 310;goto _again;} }
+	break;
+	case 66:
+	{
+		s->long_string = true;
+	}
+	break;
+	case 67:
+	{
+		s->long_string = false;
+	}
+	break;
+	case 68:
+	{
+		if (s->number64 <= UINT32_MAX) {
+			s->default_ttl = (uint32_t)(s->number64);
+		} else {
+			ERR(ZS_NUMBER32_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 69:
+	{
+		ERR(ZS_BAD_TTL);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 70:
+	{ p--; {stack[top++] = cs; cs = 322;goto _again;} }
+	break;
+	case 71:
+	{
+		s->dname = s->zone_origin;
+	}
+	break;
+	case 72:
+	{
+		s->zone_origin_length = s->dname_tmp_length;
+	}
+	break;
+	case 73:
+	{
+		ERR(ZS_BAD_ORIGIN);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 74:
+	{ p--; {stack[top++] = cs; cs = 331;goto _again;} }
+	break;
+	case 75:
+	{
+		rdata_tail = s->r_data;
+	}
+	break;
+	case 76:
+	{
+		size_t len = rdata_tail - s->r_data;
+		if (len >= sizeof(s->include_filename)) {
+			ERR(ZS_BAD_INCLUDE_FILENAME);
+			p--; {cs = 299;goto _again;}
+		}
+
+		// Store zero terminated include filename.
+		memcpy(s->include_filename, s->r_data, len);
+		s->include_filename[len] = '\0';
+
+		// For detection whether origin is not present.
+		s->dname = NULL;
+	}
+	break;
+	case 77:
+	{
+		ERR(ZS_BAD_INCLUDE_FILENAME);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 78:
+	{
+		s->dname = s->r_data;
+	}
+	break;
+	case 79:
+	{
+		s->r_data_length = s->dname_tmp_length;
+	}
+	break;
+	case 80:
+	{
+		ERR(ZS_BAD_INCLUDE_ORIGIN);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 81:
+	{
+		// Extend relative file path.
+		if (s->include_filename[0] != '/') {
+			int ret = snprintf((char *)(s->buffer), sizeof(s->buffer),
+			                   "%s/%s", s->path, s->include_filename);
+			if (ret <= 0 || ret >= sizeof(s->buffer)) {
+				ERR(ZS_BAD_INCLUDE_FILENAME);
+				p--; {cs = 299;goto _again;}
+			}
+			memcpy(s->include_filename, s->buffer, ret + 1);
+		}
+
+		// Origin conversion from wire to text form in \DDD notation.
+		if (s->dname == NULL) { // Use current origin.
+			wire_dname_to_str(s->zone_origin,
+			                  s->zone_origin_length,
+			                  (char *)s->buffer);
+		} else { // Use specified origin.
+			wire_dname_to_str(s->r_data,
+			                  s->r_data_length,
+			                  (char *)s->buffer);
+		}
+
+		// Let the caller to solve the include.
+		if (s->process.automatic) {
+			// Create new scanner for included zone file.
+			zs_scanner_t *ss = malloc(sizeof(zs_scanner_t));
+			if (ss == NULL) {
+				ERR(ZS_UNPROCESSED_INCLUDE);
+				p--; {cs = 299;goto _again;}
+			}
+
+			// Parse included zone file.
+			if (zs_init(ss, (char *)s->buffer, s->default_class,
+			            s->default_ttl) != 0 ||
+			    zs_set_input_file(ss, (char *)(s->include_filename)) != 0 ||
+			    zs_set_processing(ss, s->process.record, s->process.error,
+			                      s->process.data) != 0 ||
+			    zs_parse_all(ss) != 0) {
+				// File internal errors are handled by error callback.
+				if (ss->error.counter > 0) {
+					s->error.counter += ss->error.counter;
+					ERR(ZS_UNPROCESSED_INCLUDE);
+				// General include file error.
+				} else {
+					ERR(ss->error.code);
+				}
+				zs_deinit(ss);
+				free(ss);
+				p--; {cs = 299;goto _again;}
+			}
+			zs_deinit(ss);
+			free(ss);
+		} else {
+			s->state = ZS_STATE_INCLUDE;
+			p--; cs = 1227; {p++; goto _out; }
+		}
+	}
+	break;
+	case 82:
+	{ p--; {stack[top++] = cs; cs = 343;goto _again;} }
+	break;
+	case 83:
+	{
+		ERR(ZS_OK);
+	}
+	break;
+	case 84:
+	{
+		NOERR;
+	}
+	break;
+	case 85:
+	{
+		ERR(ZS_BAD_DIRECTIVE);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 86:
+	{
+		s->r_class = s->default_class;
+	}
+	break;
+	case 87:
+	{
+		s->r_ttl = s->default_ttl;
+	}
+	break;
+	case 88:
+	{
+		s->r_class = KNOT_CLASS_IN;
+	}
+	break;
+	case 89:
+	{
+		if (s->number64 <= UINT32_MAX) {
+			s->r_ttl = (uint32_t)(s->number64);
+		} else {
+			WARN(ZS_NUMBER32_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 90:
+	{
+		s->buffer_length = 0;
+	}
+	break;
+	case 91:
+	{
+		if (s->buffer_length < sizeof(s->buffer) - 1) {
+			s->buffer[s->buffer_length++] = (*p);
+		} else {
+			WARN(ZS_RDATA_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 92:
+	{
+		WARN(ZS_BAD_ADDRESS_CHAR);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 93:
+	{
+		s->buffer[s->buffer_length] = 0;
+
+		if (inet_pton(AF_INET, (char *)s->buffer, s->addr) <= 0) {
+			WARN(ZS_BAD_IPV4);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 94:
+	{
+		memcpy(rdata_tail, s->addr, ZS_INET4_ADDR_LENGTH);
+		rdata_tail += ZS_INET4_ADDR_LENGTH;
+	}
+	break;
+	case 95:
+	{
+		s->buffer[s->buffer_length] = 0;
+
+		if (inet_pton(AF_INET6, (char *)s->buffer, s->addr) <= 0) {
+			WARN(ZS_BAD_IPV6);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 96:
+	{
+		memcpy(rdata_tail, s->addr, ZS_INET6_ADDR_LENGTH);
+		rdata_tail += ZS_INET6_ADDR_LENGTH;
+	}
+	break;
+	case 97:
+	{
+		memset(&(s->apl), 0, sizeof(s->apl));
+	}
+	break;
+	case 98:
+	{
+		s->apl.excl_flag = 128; // dec 128  = bin 10000000.
+	}
+	break;
+	case 99:
+	{
+		s->apl.addr_family = 1;
+	}
+	break;
+	case 100:
+	{
+		s->apl.addr_family = 2;
+	}
+	break;
+	case 101:
+	{
+		if ((s->apl.addr_family == 1 && s->number64 <= 32) ||
+		    (s->apl.addr_family == 2 && s->number64 <= 128)) {
+			s->apl.prefix_length = (uint8_t)(s->number64);
+		} else {
+			WARN(ZS_BAD_APL);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 102:
+	{
+		// Copy address to buffer.
+		uint8_t len;
+		switch (s->apl.addr_family) {
+		case 1:
+			len = ZS_INET4_ADDR_LENGTH;
+			memcpy(s->buffer, s->addr, len);
+			break;
+		case 2:
+			len = ZS_INET6_ADDR_LENGTH;
+			memcpy(s->buffer, s->addr, len);
+			break;
+		default:
+			WARN(ZS_BAD_APL);
+			p--; {cs = 299;goto _again;}
+		}
+		// Find prefix without trailing zeroes.
+		while (len > 0) {
+			if ((s->buffer[len - 1] & 255) != 0) {
+				break;
+			}
+			len--;
+		}
+		// Check for rdata overflow.
+		if (rdata_tail + 4 + len > rdata_stop) {
+			WARN(ZS_RDATA_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+		// Write address family.
+		*((uint16_t *)rdata_tail) = htons(s->apl.addr_family);
+		rdata_tail += 2;
+		// Write prefix length in bits.
+		*(rdata_tail) = s->apl.prefix_length;
+		rdata_tail += 1;
+		// Write negation flag + prefix length in bytes.
+		*(rdata_tail) = len + s->apl.excl_flag;
+		rdata_tail += 1;
+		// Write address prefix non-null data.
+		memcpy(rdata_tail, s->buffer, len);
+		rdata_tail += len;
+	}
+	break;
+	case 103:
+	{
+		WARN(ZS_BAD_APL);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 104:
+	{
+		if (rdata_tail <= rdata_stop) {
+			*rdata_tail = first_hex_to_num[(uint8_t)(*p)];
+		} else {
+			WARN(ZS_RDATA_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 105:
+	{
+		*rdata_tail += second_hex_to_num[(uint8_t)(*p)];
+		rdata_tail++;
+	}
+	break;
+	case 106:
+	{
+		WARN(ZS_BAD_HEX_CHAR);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 107:
+	{
+		if ((rdata_tail - s->r_data) != s->r_data_length) {
+			WARN(ZS_BAD_RDATA_LENGTH);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 108:
+	{
+		WARN(ZS_BAD_HEX_RDATA);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 109:
+	{
+		if (rdata_tail <= rdata_stop) {
+			*rdata_tail = first_base64_to_num[(uint8_t)(*p)];
+		} else {
+			WARN(ZS_RDATA_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 110:
+	{
+		*(rdata_tail++) += second_left_base64_to_num[(uint8_t)(*p)];
+
+		if (rdata_tail <= rdata_stop) {
+			*rdata_tail = second_right_base64_to_num[(uint8_t)(*p)];
+		} else {
+			WARN(ZS_RDATA_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 111:
+	{
+		*(rdata_tail++) += third_left_base64_to_num[(uint8_t)(*p)];
+
+		if (rdata_tail <= rdata_stop) {
+			*rdata_tail = third_right_base64_to_num[(uint8_t)(*p)];
+		} else {
+			WARN(ZS_RDATA_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 112:
+	{
+		*(rdata_tail++) += fourth_base64_to_num[(uint8_t)(*p)];
+	}
+	break;
+	case 113:
+	{
+		WARN(ZS_BAD_BASE64_CHAR);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 114:
+	{ p--; {stack[top++] = cs; cs = 360;goto _again;} }
+	break;
+	case 115:
+	{
+		if (rdata_tail <= rdata_stop) {
+			*rdata_tail = first_base32hex_to_num[(uint8_t)(*p)];
+		} else {
+			WARN(ZS_RDATA_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 116:
+	{
+		*(rdata_tail++) += second_left_base32hex_to_num[(uint8_t)(*p)];
+
+		if (rdata_tail <= rdata_stop) {
+			*rdata_tail = second_right_base32hex_to_num[(uint8_t)(*p)];
+		} else {
+			WARN(ZS_RDATA_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 117:
+	{
+		*rdata_tail += third_base32hex_to_num[(uint8_t)(*p)];
+	}
+	break;
+	case 118:
+	{
+		*(rdata_tail++) += fourth_left_base32hex_to_num[(uint8_t)(*p)];
+
+		if (rdata_tail <= rdata_stop) {
+			*rdata_tail = fourth_right_base32hex_to_num[(uint8_t)(*p)];
+		} else {
+			WARN(ZS_RDATA_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 119:
+	{
+		*(rdata_tail++) += fifth_left_base32hex_to_num[(uint8_t)(*p)];
+
+		if (rdata_tail <= rdata_stop) {
+			*rdata_tail = fifth_right_base32hex_to_num[(uint8_t)(*p)];
+		} else {
+			WARN(ZS_RDATA_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 120:
+	{
+		*rdata_tail += sixth_base32hex_to_num[(uint8_t)(*p)];
+	}
+	break;
+	case 121:
+	{
+		*(rdata_tail++) += seventh_left_base32hex_to_num[(uint8_t)(*p)];
+
+		if (rdata_tail <= rdata_stop) {
+			*rdata_tail = seventh_right_base32hex_to_num[(uint8_t)(*p)];
+		} else {
+			WARN(ZS_RDATA_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 122:
+	{
+		*(rdata_tail++) += eighth_base32hex_to_num[(uint8_t)(*p)];
+	}
+	break;
+	case 123:
+	{
+		WARN(ZS_BAD_BASE32HEX_CHAR);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 124:
+	{
+		*(rdata_tail++) = 0;
+	}
+	break;
+	case 125:
+	{
+		*(rdata_tail++) = 1;
+	}
+	break;
+	case 126:
+	{
+		*(rdata_tail++) = 2;
+	}
+	break;
+	case 127:
+	{
+		*(rdata_tail++) = 3;
+	}
+	break;
+	case 128:
+	{
+		*(rdata_tail++) = 5;
+	}
+	break;
+	case 129:
+	{
+		*(rdata_tail++) = 6;
+	}
+	break;
+	case 130:
+	{
+		*(rdata_tail++) = 7;
+	}
+	break;
+	case 131:
+	{
+		*(rdata_tail++) = 8;
+	}
+	break;
+	case 132:
+	{
+		*(rdata_tail++) = 10;
+	}
+	break;
+	case 133:
+	{
+		*(rdata_tail++) = 12;
+	}
+	break;
+	case 134:
+	{
+		*(rdata_tail++) = 13;
+	}
+	break;
+	case 135:
+	{
+		*(rdata_tail++) = 14;
+	}
+	break;
+	case 136:
+	{
+		*(rdata_tail++) = 15;
+	}
+	break;
+	case 137:
+	{
+		*(rdata_tail++) = 16;
+	}
+	break;
+	case 138:
+	{
+		*(rdata_tail++) = 252;
+	}
+	break;
+	case 139:
+	{
+		*(rdata_tail++) = 253;
+	}
+	break;
+	case 140:
+	{
+		*(rdata_tail++) = 254;
+	}
+	break;
+	case 141:
+	{
+		*((uint16_t *)rdata_tail) = htons(1);
+		rdata_tail += 2;
+	}
+	break;
+	case 142:
+	{
+		*((uint16_t *)rdata_tail) = htons(2);
+		rdata_tail += 2;
+	}
+	break;
+	case 143:
+	{
+		*((uint16_t *)rdata_tail) = htons(3);
+		rdata_tail += 2;
+	}
+	break;
+	case 144:
+	{
+		*((uint16_t *)rdata_tail) = htons(4);
+		rdata_tail += 2;
+	}
+	break;
+	case 145:
+	{
+		*((uint16_t *)rdata_tail) = htons(5);
+		rdata_tail += 2;
+	}
+	break;
+	case 146:
+	{
+		*((uint16_t *)rdata_tail) = htons(6);
+		rdata_tail += 2;
+	}
+	break;
+	case 147:
+	{
+		*((uint16_t *)rdata_tail) = htons(7);
+		rdata_tail += 2;
+	}
+	break;
+	case 148:
+	{
+		*((uint16_t *)rdata_tail) = htons(8);
+		rdata_tail += 2;
+	}
+	break;
+	case 149:
+	{
+		*((uint16_t *)rdata_tail) = htons(253);
+		rdata_tail += 2;
+	}
+	break;
+	case 150:
+	{
+		*((uint16_t *)rdata_tail) = htons(254);
+		rdata_tail += 2;
+	}
+	break;
+	case 151:
+	{
+		WARN(ZS_BAD_GATEWAY);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 152:
+	{
+		WARN(ZS_BAD_GATEWAY_KEY);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 153:
+	{
+		WARN(ZS_UNSUPPORTED_TYPE);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 154:
+	{ type_num(KNOT_RRTYPE_A, &rdata_tail); }
+	break;
+	case 155:
+	{ type_num(KNOT_RRTYPE_NS, &rdata_tail); }
+	break;
+	case 156:
+	{ type_num(KNOT_RRTYPE_CNAME, &rdata_tail); }
+	break;
+	case 157:
+	{ type_num(KNOT_RRTYPE_SOA, &rdata_tail); }
+	break;
+	case 158:
+	{ type_num(KNOT_RRTYPE_PTR, &rdata_tail); }
+	break;
+	case 159:
+	{ type_num(KNOT_RRTYPE_HINFO, &rdata_tail); }
+	break;
+	case 160:
+	{ type_num(KNOT_RRTYPE_MINFO, &rdata_tail); }
+	break;
+	case 161:
+	{ type_num(KNOT_RRTYPE_MX, &rdata_tail); }
+	break;
+	case 162:
+	{ type_num(KNOT_RRTYPE_TXT, &rdata_tail); }
+	break;
+	case 163:
+	{ type_num(KNOT_RRTYPE_RP, &rdata_tail); }
+	break;
+	case 164:
+	{ type_num(KNOT_RRTYPE_AFSDB, &rdata_tail); }
+	break;
+	case 165:
+	{ type_num(KNOT_RRTYPE_RT, &rdata_tail); }
+	break;
+	case 166:
+	{ type_num(KNOT_RRTYPE_KEY, &rdata_tail); }
+	break;
+	case 167:
+	{ type_num(KNOT_RRTYPE_AAAA, &rdata_tail); }
+	break;
+	case 168:
+	{ type_num(KNOT_RRTYPE_LOC, &rdata_tail); }
+	break;
+	case 169:
+	{ type_num(KNOT_RRTYPE_SRV, &rdata_tail); }
+	break;
+	case 170:
+	{ type_num(KNOT_RRTYPE_NAPTR, &rdata_tail); }
+	break;
+	case 171:
+	{ type_num(KNOT_RRTYPE_KX, &rdata_tail); }
+	break;
+	case 172:
+	{ type_num(KNOT_RRTYPE_CERT, &rdata_tail); }
+	break;
+	case 173:
+	{ type_num(KNOT_RRTYPE_DNAME, &rdata_tail); }
+	break;
+	case 174:
+	{ type_num(KNOT_RRTYPE_APL, &rdata_tail); }
+	break;
+	case 175:
+	{ type_num(KNOT_RRTYPE_DS, &rdata_tail); }
+	break;
+	case 176:
+	{ type_num(KNOT_RRTYPE_SSHFP, &rdata_tail); }
+	break;
+	case 177:
+	{ type_num(KNOT_RRTYPE_IPSECKEY, &rdata_tail); }
+	break;
+	case 178:
+	{ type_num(KNOT_RRTYPE_RRSIG, &rdata_tail); }
+	break;
+	case 179:
+	{ type_num(KNOT_RRTYPE_NSEC, &rdata_tail); }
+	break;
+	case 180:
+	{ type_num(KNOT_RRTYPE_DNSKEY, &rdata_tail); }
+	break;
+	case 181:
+	{ type_num(KNOT_RRTYPE_DHCID, &rdata_tail); }
+	break;
+	case 182:
+	{ type_num(KNOT_RRTYPE_NSEC3, &rdata_tail); }
+	break;
+	case 183:
+	{ type_num(KNOT_RRTYPE_NSEC3PARAM, &rdata_tail); }
+	break;
+	case 184:
+	{ type_num(KNOT_RRTYPE_TLSA, &rdata_tail); }
+	break;
+	case 185:
+	{ type_num(KNOT_RRTYPE_SMIMEA, &rdata_tail); }
+	break;
+	case 186:
+	{ type_num(KNOT_RRTYPE_CDS, &rdata_tail); }
+	break;
+	case 187:
+	{ type_num(KNOT_RRTYPE_CDNSKEY, &rdata_tail); }
+	break;
+	case 188:
+	{ type_num(KNOT_RRTYPE_OPENPGPKEY, &rdata_tail); }
+	break;
+	case 189:
+	{ type_num(KNOT_RRTYPE_CSYNC, &rdata_tail); }
+	break;
+	case 190:
+	{ type_num(KNOT_RRTYPE_ZONEMD, &rdata_tail); }
+	break;
+	case 191:
+	{ type_num(KNOT_RRTYPE_SPF, &rdata_tail); }
+	break;
+	case 192:
+	{ type_num(KNOT_RRTYPE_NID, &rdata_tail); }
+	break;
+	case 193:
+	{ type_num(KNOT_RRTYPE_L32, &rdata_tail); }
+	break;
+	case 194:
+	{ type_num(KNOT_RRTYPE_L64, &rdata_tail); }
+	break;
+	case 195:
+	{ type_num(KNOT_RRTYPE_LP, &rdata_tail); }
+	break;
+	case 196:
+	{ type_num(KNOT_RRTYPE_EUI48, &rdata_tail); }
+	break;
+	case 197:
+	{ type_num(KNOT_RRTYPE_EUI64, &rdata_tail); }
+	break;
+	case 198:
+	{ type_num(KNOT_RRTYPE_URI, &rdata_tail); }
+	break;
+	case 199:
+	{ type_num(KNOT_RRTYPE_CAA, &rdata_tail); }
+	break;
+	case 200:
+	{
+		if (s->number64 <= UINT16_MAX) {
+			window_add_bit(s->number64, s);
+		} else {
+			WARN(ZS_NUMBER16_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 201:
+	{ window_add_bit(KNOT_RRTYPE_A, s); }
+	break;
+	case 202:
+	{ window_add_bit(KNOT_RRTYPE_NS, s); }
+	break;
+	case 203:
+	{ window_add_bit(KNOT_RRTYPE_CNAME, s); }
+	break;
+	case 204:
+	{ window_add_bit(KNOT_RRTYPE_SOA, s); }
+	break;
+	case 205:
+	{ window_add_bit(KNOT_RRTYPE_PTR, s); }
+	break;
+	case 206:
+	{ window_add_bit(KNOT_RRTYPE_HINFO, s); }
+	break;
+	case 207:
+	{ window_add_bit(KNOT_RRTYPE_MINFO, s); }
+	break;
+	case 208:
+	{ window_add_bit(KNOT_RRTYPE_MX, s); }
+	break;
+	case 209:
+	{ window_add_bit(KNOT_RRTYPE_TXT, s); }
+	break;
+	case 210:
+	{ window_add_bit(KNOT_RRTYPE_RP, s); }
+	break;
+	case 211:
+	{ window_add_bit(KNOT_RRTYPE_AFSDB, s); }
+	break;
+	case 212:
+	{ window_add_bit(KNOT_RRTYPE_RT, s); }
+	break;
+	case 213:
+	{ window_add_bit(KNOT_RRTYPE_KEY, s); }
+	break;
+	case 214:
+	{ window_add_bit(KNOT_RRTYPE_AAAA, s); }
+	break;
+	case 215:
+	{ window_add_bit(KNOT_RRTYPE_LOC, s); }
+	break;
+	case 216:
+	{ window_add_bit(KNOT_RRTYPE_SRV, s); }
+	break;
+	case 217:
+	{ window_add_bit(KNOT_RRTYPE_NAPTR, s); }
+	break;
+	case 218:
+	{ window_add_bit(KNOT_RRTYPE_KX, s); }
+	break;
+	case 219:
+	{ window_add_bit(KNOT_RRTYPE_CERT, s); }
+	break;
+	case 220:
+	{ window_add_bit(KNOT_RRTYPE_DNAME, s); }
+	break;
+	case 221:
+	{ window_add_bit(KNOT_RRTYPE_APL, s); }
+	break;
+	case 222:
+	{ window_add_bit(KNOT_RRTYPE_DS, s); }
+	break;
+	case 223:
+	{ window_add_bit(KNOT_RRTYPE_SSHFP, s); }
+	break;
+	case 224:
+	{ window_add_bit(KNOT_RRTYPE_IPSECKEY, s); }
+	break;
+	case 225:
+	{ window_add_bit(KNOT_RRTYPE_RRSIG, s); }
+	break;
+	case 226:
+	{ window_add_bit(KNOT_RRTYPE_NSEC, s); }
+	break;
+	case 227:
+	{ window_add_bit(KNOT_RRTYPE_DNSKEY, s); }
+	break;
+	case 228:
+	{ window_add_bit(KNOT_RRTYPE_DHCID, s); }
+	break;
+	case 229:
+	{ window_add_bit(KNOT_RRTYPE_NSEC3, s); }
+	break;
+	case 230:
+	{ window_add_bit(KNOT_RRTYPE_NSEC3PARAM, s); }
+	break;
+	case 231:
+	{ window_add_bit(KNOT_RRTYPE_TLSA, s); }
+	break;
+	case 232:
+	{ window_add_bit(KNOT_RRTYPE_SMIMEA, s); }
+	break;
+	case 233:
+	{ window_add_bit(KNOT_RRTYPE_CDS, s); }
+	break;
+	case 234:
+	{ window_add_bit(KNOT_RRTYPE_CDNSKEY, s); }
+	break;
+	case 235:
+	{ window_add_bit(KNOT_RRTYPE_OPENPGPKEY, s); }
+	break;
+	case 236:
+	{ window_add_bit(KNOT_RRTYPE_CSYNC, s); }
+	break;
+	case 237:
+	{ window_add_bit(KNOT_RRTYPE_ZONEMD, s); }
+	break;
+	case 238:
+	{ window_add_bit(KNOT_RRTYPE_SPF, s); }
+	break;
+	case 239:
+	{ window_add_bit(KNOT_RRTYPE_NID, s); }
+	break;
+	case 240:
+	{ window_add_bit(KNOT_RRTYPE_L32, s); }
+	break;
+	case 241:
+	{ window_add_bit(KNOT_RRTYPE_L64, s); }
+	break;
+	case 242:
+	{ window_add_bit(KNOT_RRTYPE_LP, s); }
+	break;
+	case 243:
+	{ window_add_bit(KNOT_RRTYPE_EUI48, s); }
+	break;
+	case 244:
+	{ window_add_bit(KNOT_RRTYPE_EUI64, s); }
+	break;
+	case 245:
+	{ window_add_bit(KNOT_RRTYPE_URI, s); }
+	break;
+	case 246:
+	{ window_add_bit(KNOT_RRTYPE_CAA, s); }
+	break;
+	case 247:
+	{
+		memset(s->windows, 0, sizeof(s->windows));
+		s->last_window = -1;
+	}
+	break;
+	case 248:
+	{
+		for (uint16_t window = 0; window <= s->last_window; window++) {
+			if ((s->windows[window]).length > 0) {
+				if (rdata_tail + 2 + (s->windows[window]).length <= rdata_stop)
+				{
+					// Window number.
+					*rdata_tail = (uint8_t)window;
+					rdata_tail += 1;
+					// Bitmap length.
+					*rdata_tail = (s->windows[window]).length;
+					rdata_tail += 1;
+					// Copying bitmap.
+					memcpy(rdata_tail,
+					       (s->windows[window]).bitmap,
+					       (s->windows[window]).length);
+					rdata_tail += (s->windows[window]).length;
+				} else {
+					WARN(ZS_RDATA_OVERFLOW);
+					p--; {cs = 299;goto _again;}
+				}
+			}
+		}
+	}
+	break;
+	case 249:
+	{
+		WARN(ZS_BAD_BITMAP);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 250:
+	{ p--; {stack[top++] = cs; cs = 367;goto _again;} }
+	break;
+	case 251:
+	{
+		if (s->number64 <= 90) {
+			s->loc.d1 = (uint32_t)(s->number64);
+		} else {
+			WARN(ZS_BAD_NUMBER);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 252:
+	{
+		if (s->number64 <= 180) {
+			s->loc.d2 = (uint32_t)(s->number64);
+		} else {
+			WARN(ZS_BAD_NUMBER);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 253:
+	{
+		if (s->number64 <= 59) {
+			s->loc.m1 = (uint32_t)(s->number64);
+		} else {
+			WARN(ZS_BAD_NUMBER);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 254:
+	{
+		if (s->number64 <= 59) {
+			s->loc.m2 = (uint32_t)(s->number64);
+		} else {
+			WARN(ZS_BAD_NUMBER);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 255:
+	{
+		if (s->number64 <= 59999) {
+			s->loc.s1 = (uint32_t)(s->number64);
+		} else {
+			WARN(ZS_BAD_NUMBER);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 256:
+	{
+		if (s->number64 <= 59999) {
+			s->loc.s2 = (uint32_t)(s->number64);
+		} else {
+			WARN(ZS_BAD_NUMBER);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 257:
+	{
+		if ((s->loc.alt_sign ==  1 && s->number64 <= 4284967295) ||
+		    (s->loc.alt_sign == -1 && s->number64 <=   10000000))
+		{
+			s->loc.alt = (uint32_t)(s->number64);
+		} else {
+			WARN(ZS_BAD_NUMBER);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 258:
+	{
+		if (s->number64 <= 9000000000ULL) {
+			s->loc.siz = s->number64;
+		} else {
+			WARN(ZS_BAD_NUMBER);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 259:
+	{
+		if (s->number64 <= 9000000000ULL) {
+			s->loc.hp = s->number64;
+		} else {
+			WARN(ZS_BAD_NUMBER);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 260:
+	{
+		if (s->number64 <= 9000000000ULL) {
+			s->loc.vp = s->number64;
+		} else {
+			WARN(ZS_BAD_NUMBER);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 261:
+	{
+		s->loc.lat_sign = -1;
+	}
+	break;
+	case 262:
+	{
+		s->loc.long_sign = -1;
+	}
+	break;
+	case 263:
+	{
+		s->loc.alt_sign = -1;
+	}
+	break;
+	case 264:
+	{
+		memset(&(s->loc), 0, sizeof(s->loc));
+		// Defaults.
+		s->loc.siz = 100;
+		s->loc.vp  = 1000;
+		s->loc.hp  = 1000000;
+		s->loc.lat_sign  = 1;
+		s->loc.long_sign = 1;
+		s->loc.alt_sign  = 1;
+	}
+	break;
+	case 265:
+	{
+		// Write version.
+		*(rdata_tail) = 0;
+		rdata_tail += 1;
+		// Write size.
+		*(rdata_tail) = loc64to8(s->loc.siz);
+		rdata_tail += 1;
+		// Write horizontal precision.
+		*(rdata_tail) = loc64to8(s->loc.hp);
+		rdata_tail += 1;
+		// Write vertical precision.
+		*(rdata_tail) = loc64to8(s->loc.vp);
+		rdata_tail += 1;
+		// Write latitude.
+		*((uint32_t *)rdata_tail) = htonl(LOC_LAT_ZERO + s->loc.lat_sign *
+			(3600000 * s->loc.d1 + 60000 * s->loc.m1 + s->loc.s1));
+		rdata_tail += 4;
+		// Write longitude.
+		*((uint32_t *)rdata_tail) = htonl(LOC_LONG_ZERO + s->loc.long_sign *
+			(3600000 * s->loc.d2 + 60000 * s->loc.m2 + s->loc.s2));
+		rdata_tail += 4;
+		// Write altitude.
+		*((uint32_t *)rdata_tail) = htonl(LOC_ALT_ZERO + s->loc.alt_sign *
+			(s->loc.alt));
+		rdata_tail += 4;
+	}
+	break;
+	case 266:
+	{
+		WARN(ZS_BAD_LOC_DATA);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 267:
+	{
+		WARN(ZS_BAD_HEX_RDATA);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 268:
+	{
+		s->item_length = 0;
+	}
+	break;
+	case 269:
+	{
+		s->item_length++;
+	}
+	break;
+	case 270:
+	{
+		if (s->item_length != 6) {
+			WARN(ZS_BAD_EUI_LENGTH);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 271:
+	{
+		if (s->item_length != 8) {
+			WARN(ZS_BAD_EUI_LENGTH);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 272:
+	{
+		WARN(ZS_BAD_CHAR_DASH);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 273:
+	{
+		s->item_length = 0;
+	}
+	break;
+	case 274:
+	{
+		s->item_length++;
+	}
+	break;
+	case 275:
+	{
+		if (s->item_length != 4) {
+			WARN(ZS_BAD_L64_LENGTH);
+			p--; {cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 276:
+	{
+		WARN(ZS_BAD_CHAR_COLON);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 277:
+	{
+		WARN(ZS_BAD_ALGORITHM);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 278:
+	{
+		WARN(ZS_BAD_CERT_TYPE);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 279:
+	{ p--; {stack[top++] = cs; cs = 543;goto _again;} }
+	break;
+	case 280:
+	{ p--; {stack[top++] = cs; cs = 647;goto _again;} }
+	break;
+	case 281:
+	{
+		rdata_tail = s->r_data;
+	}
+	break;
+	case 282:
+	{
+		WARN(ZS_BAD_RDATA);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 283:
+	{
+		p--;
+		switch (s->r_type) {
+		case KNOT_RRTYPE_A:
+			{stack[top++] = cs; cs = 688;goto _again;}
+		case KNOT_RRTYPE_NS:
+		case KNOT_RRTYPE_CNAME:
+		case KNOT_RRTYPE_PTR:
+		case KNOT_RRTYPE_DNAME:
+			{stack[top++] = cs; cs = 690;goto _again;}
+		case KNOT_RRTYPE_SOA:
+			{stack[top++] = cs; cs = 692;goto _again;}
+		case KNOT_RRTYPE_HINFO:
+			{stack[top++] = cs; cs = 724;goto _again;}
+		case KNOT_RRTYPE_MINFO:
+		case KNOT_RRTYPE_RP:
+			{stack[top++] = cs; cs = 729;goto _again;}
+		case KNOT_RRTYPE_MX:
+		case KNOT_RRTYPE_AFSDB:
+		case KNOT_RRTYPE_RT:
+		case KNOT_RRTYPE_KX:
+		case KNOT_RRTYPE_LP:
+			{stack[top++] = cs; cs = 734;goto _again;}
+		case KNOT_RRTYPE_TXT:
+		case KNOT_RRTYPE_SPF:
+			{stack[top++] = cs; cs = 739;goto _again;}
+		case KNOT_RRTYPE_AAAA:
+			{stack[top++] = cs; cs = 743;goto _again;}
+		case KNOT_RRTYPE_LOC:
+			{stack[top++] = cs; cs = 745;goto _again;}
+		case KNOT_RRTYPE_SRV:
+			{stack[top++] = cs; cs = 800;goto _again;}
+		case KNOT_RRTYPE_NAPTR:
+			{stack[top++] = cs; cs = 811;goto _again;}
+		case KNOT_RRTYPE_CERT:
+			{stack[top++] = cs; cs = 828;goto _again;}
+		case KNOT_RRTYPE_APL:
+			{stack[top++] = cs; cs = 839;goto _again;}
+		case KNOT_RRTYPE_DS:
+		case KNOT_RRTYPE_CDS:
+			{stack[top++] = cs; cs = 850;goto _again;}
+		case KNOT_RRTYPE_SSHFP:
+			{stack[top++] = cs; cs = 863;goto _again;}
+		case KNOT_RRTYPE_IPSECKEY:
+			{stack[top++] = cs; cs = 873;goto _again;}
+		case KNOT_RRTYPE_RRSIG:
+			{stack[top++] = cs; cs = 912;goto _again;}
+		case KNOT_RRTYPE_NSEC:
+			{stack[top++] = cs; cs = 1091;goto _again;}
+		case KNOT_RRTYPE_KEY:
+		case KNOT_RRTYPE_DNSKEY:
+		case KNOT_RRTYPE_CDNSKEY:
+			{stack[top++] = cs; cs = 1094;goto _again;}
+		case KNOT_RRTYPE_DHCID:
+		case KNOT_RRTYPE_OPENPGPKEY:
+			{stack[top++] = cs; cs = 1105;goto _again;}
+		case KNOT_RRTYPE_NSEC3:
+			{stack[top++] = cs; cs = 1107;goto _again;}
+		case KNOT_RRTYPE_NSEC3PARAM:
+			{stack[top++] = cs; cs = 1136;goto _again;}
+		case KNOT_RRTYPE_TLSA:
+		case KNOT_RRTYPE_SMIMEA:
+			{stack[top++] = cs; cs = 1149;goto _again;}
+		case KNOT_RRTYPE_CSYNC:
+			{stack[top++] = cs; cs = 1162;goto _again;}
+		case KNOT_RRTYPE_ZONEMD:
+			{stack[top++] = cs; cs = 1168;goto _again;}
+		case KNOT_RRTYPE_NID:
+		case KNOT_RRTYPE_L64:
+			{stack[top++] = cs; cs = 1186;goto _again;}
+		case KNOT_RRTYPE_L32:
+			{stack[top++] = cs; cs = 1181;goto _again;}
+		case KNOT_RRTYPE_EUI48:
+			{stack[top++] = cs; cs = 1199;goto _again;}
+		case KNOT_RRTYPE_EUI64:
+			{stack[top++] = cs; cs = 1205;goto _again;}
+		case KNOT_RRTYPE_URI:
+			{stack[top++] = cs; cs = 1211;goto _again;}
+		case KNOT_RRTYPE_CAA:
+			{stack[top++] = cs; cs = 1219;goto _again;}
+		default:
+			WARN(ZS_CANNOT_TEXT_DATA);
+			{cs = 299;goto _again;}
+		}
+	}
+	break;
+	case 284:
+	{
+		switch (s->r_type) {
+		// Next types must not have empty rdata.
+		case KNOT_RRTYPE_A:
+		case KNOT_RRTYPE_NS:
+		case KNOT_RRTYPE_CNAME:
+		case KNOT_RRTYPE_PTR:
+		case KNOT_RRTYPE_DNAME:
+		case KNOT_RRTYPE_SOA:
+		case KNOT_RRTYPE_HINFO:
+		case KNOT_RRTYPE_MINFO:
+		case KNOT_RRTYPE_MX:
+		case KNOT_RRTYPE_AFSDB:
+		case KNOT_RRTYPE_RT:
+		case KNOT_RRTYPE_KX:
+		case KNOT_RRTYPE_TXT:
+		case KNOT_RRTYPE_SPF:
+		case KNOT_RRTYPE_RP:
+		case KNOT_RRTYPE_AAAA:
+		case KNOT_RRTYPE_LOC:
+		case KNOT_RRTYPE_SRV:
+		case KNOT_RRTYPE_NAPTR:
+		case KNOT_RRTYPE_CERT:
+		case KNOT_RRTYPE_DS:
+		case KNOT_RRTYPE_SSHFP:
+		case KNOT_RRTYPE_IPSECKEY:
+		case KNOT_RRTYPE_RRSIG:
+		case KNOT_RRTYPE_NSEC:
+		case KNOT_RRTYPE_KEY:
+		case KNOT_RRTYPE_DNSKEY:
+		case KNOT_RRTYPE_DHCID:
+		case KNOT_RRTYPE_NSEC3:
+		case KNOT_RRTYPE_NSEC3PARAM:
+		case KNOT_RRTYPE_TLSA:
+		case KNOT_RRTYPE_SMIMEA:
+		case KNOT_RRTYPE_CDS:
+		case KNOT_RRTYPE_CDNSKEY:
+		case KNOT_RRTYPE_OPENPGPKEY:
+		case KNOT_RRTYPE_CSYNC:
+		case KNOT_RRTYPE_ZONEMD:
+		case KNOT_RRTYPE_NID:
+		case KNOT_RRTYPE_L32:
+		case KNOT_RRTYPE_L64:
+		case KNOT_RRTYPE_LP:
+		case KNOT_RRTYPE_EUI48:
+		case KNOT_RRTYPE_EUI64:
+		case KNOT_RRTYPE_URI:
+		case KNOT_RRTYPE_CAA:
+			{stack[top++] = cs; cs = 524;goto _again;}
+		// Next types can have empty rdata.
+		case KNOT_RRTYPE_APL:
+		default:
+			{stack[top++] = cs; cs = 533;goto _again;}
+		}
+	}
+	break;
+	case 285:
+	{
+		if (pe - p == 1) {
+			*wrap = WRAP_DETECTED;
+		}
+	}
+	break;
+	case 286:
+	{
+		if (*wrap == WRAP_NONE) {
+			p--;
+		}
+	}
+	break;
+	case 287:
+	{
+		WARN(ZS_UNSUPPORTED_TYPE);
+		p--; {cs = 299;goto _again;}
+	}
+	break;
+	case 288:
+	{ s->r_type = KNOT_RRTYPE_A; }
+	break;
+	case 289:
+	{ s->r_type = KNOT_RRTYPE_NS; }
+	break;
+	case 290:
+	{ s->r_type = KNOT_RRTYPE_CNAME; }
+	break;
+	case 291:
+	{ s->r_type = KNOT_RRTYPE_SOA; }
+	break;
+	case 292:
+	{ s->r_type = KNOT_RRTYPE_PTR; }
+	break;
+	case 293:
+	{ s->r_type = KNOT_RRTYPE_HINFO; }
+	break;
+	case 294:
+	{ s->r_type = KNOT_RRTYPE_MINFO; }
+	break;
+	case 295:
+	{ s->r_type = KNOT_RRTYPE_MX; }
+	break;
+	case 296:
+	{ s->r_type = KNOT_RRTYPE_TXT; }
+	break;
+	case 297:
+	{ s->r_type = KNOT_RRTYPE_RP; }
+	break;
+	case 298:
+	{ s->r_type = KNOT_RRTYPE_AFSDB; }
+	break;
+	case 299:
+	{ s->r_type = KNOT_RRTYPE_RT; }
+	break;
+	case 300:
+	{ s->r_type = KNOT_RRTYPE_KEY; }
+	break;
+	case 301:
+	{ s->r_type = KNOT_RRTYPE_AAAA; }
+	break;
+	case 302:
+	{ s->r_type = KNOT_RRTYPE_LOC; }
+	break;
+	case 303:
+	{ s->r_type = KNOT_RRTYPE_SRV; }
+	break;
+	case 304:
+	{ s->r_type = KNOT_RRTYPE_NAPTR; }
+	break;
+	case 305:
+	{ s->r_type = KNOT_RRTYPE_KX; }
+	break;
+	case 306:
+	{ s->r_type = KNOT_RRTYPE_CERT; }
+	break;
+	case 307:
+	{ s->r_type = KNOT_RRTYPE_DNAME; }
+	break;
+	case 308:
+	{ s->r_type = KNOT_RRTYPE_APL; }
+	break;
+	case 309:
+	{ s->r_type = KNOT_RRTYPE_DS; }
+	break;
+	case 310:
+	{ s->r_type = KNOT_RRTYPE_SSHFP; }
+	break;
+	case 311:
+	{ s->r_type = KNOT_RRTYPE_IPSECKEY; }
+	break;
+	case 312:
+	{ s->r_type = KNOT_RRTYPE_RRSIG; }
+	break;
+	case 313:
+	{ s->r_type = KNOT_RRTYPE_NSEC; }
+	break;
+	case 314:
+	{ s->r_type = KNOT_RRTYPE_DNSKEY; }
+	break;
+	case 315:
+	{ s->r_type = KNOT_RRTYPE_DHCID; }
+	break;
+	case 316:
+	{ s->r_type = KNOT_RRTYPE_NSEC3; }
+	break;
+	case 317:
+	{ s->r_type = KNOT_RRTYPE_NSEC3PARAM; }
+	break;
+	case 318:
+	{ s->r_type = KNOT_RRTYPE_TLSA; }
+	break;
+	case 319:
+	{ s->r_type = KNOT_RRTYPE_SMIMEA; }
+	break;
+	case 320:
+	{ s->r_type = KNOT_RRTYPE_CDS; }
+	break;
+	case 321:
+	{ s->r_type = KNOT_RRTYPE_CDNSKEY; }
+	break;
+	case 322:
+	{ s->r_type = KNOT_RRTYPE_OPENPGPKEY; }
+	break;
+	case 323:
+	{ s->r_type = KNOT_RRTYPE_CSYNC; }
+	break;
+	case 324:
+	{ s->r_type = KNOT_RRTYPE_ZONEMD; }
+	break;
+	case 325:
+	{ s->r_type = KNOT_RRTYPE_SPF; }
+	break;
+	case 326:
+	{ s->r_type = KNOT_RRTYPE_NID; }
+	break;
+	case 327:
+	{ s->r_type = KNOT_RRTYPE_L32; }
+	break;
+	case 328:
+	{ s->r_type = KNOT_RRTYPE_L64; }
+	break;
+	case 329:
+	{ s->r_type = KNOT_RRTYPE_LP; }
+	break;
+	case 330:
+	{ s->r_type = KNOT_RRTYPE_EUI48; }
+	break;
+	case 331:
+	{ s->r_type = KNOT_RRTYPE_EUI64; }
+	break;
+	case 332:
+	{ s->r_type = KNOT_RRTYPE_URI; }
+	break;
+	case 333:
+	{ s->r_type = KNOT_RRTYPE_CAA; }
+	break;
+	case 334:
+	{
+		if (rdata_tail - s->r_data > UINT16_MAX) {
+			WARN(ZS_RDATA_OVERFLOW);
+			p--; {cs = 299;goto _again;}
+		}
+		s->r_data_length = rdata_tail - s->r_data;
+
+		s->state = ZS_STATE_DATA;
+
+		// Execute the record callback.
+		if (s->process.automatic) {
+			if (s->process.record != NULL) {
+				s->process.record(s);
+
+				// Stop if required from the callback.
+				if (s->state == ZS_STATE_STOP) {
+					{p++; goto _out; }
+				}
+			}
+		} else {
+			// Return if external processing.
+			p--; {p++; goto _out; }
+		}
+	}
+	break;
+		}
+	}
+
+_again:
+	if ( cs == 0 )
+		goto _out;
+	if ( ++p != pe )
+		goto _resume;
+	_test_eof: {}
+	if ( p == eof )
+	{
+	const short *__acts = _zone_scanner_actions + _zone_scanner_eof_actions[cs];
+	unsigned int __nacts = (unsigned int) *__acts++;
+	while ( __nacts-- > 0 ) {
+		switch ( *__acts++ ) {
+	case 8:
+	{
+		WARN(ZS_BAD_REST);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+	case 18:
+	{
+		WARN(ZS_BAD_NUMBER);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+	case 23:
+	{
+		WARN(ZS_BAD_DNAME_CHAR);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+	case 30:
+	{
+		s->r_owner_length = 0;
+		WARN(ZS_BAD_OWNER);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+	case 35:
+	{
+		WARN(ZS_BAD_NUMBER);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+	case 47:
+	{
+		WARN(ZS_BAD_TIME_UNIT);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+	case 57:
+	{
+		WARN(ZS_BAD_TIMESTAMP_CHAR);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+	case 59:
+	{
+		WARN(ZS_BAD_TEXT_CHAR);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+	case 60:
+	{
+		WARN(ZS_BAD_TEXT);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+	case 64:
+	{
+		WARN(ZS_BAD_NUMBER);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+	case 67:
+	{
+		s->long_string = false;
+	}
+	break;
+	case 69:
+	{
+		ERR(ZS_BAD_TTL);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+	case 73:
+	{
+		ERR(ZS_BAD_ORIGIN);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+	case 77:
+	{
+		ERR(ZS_BAD_INCLUDE_FILENAME);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+	case 80:
+	{
+		ERR(ZS_BAD_INCLUDE_ORIGIN);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+	case 84:
+	{
+		NOERR;
+	}
+	break;
+	case 85:
+	{
+		ERR(ZS_BAD_DIRECTIVE);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+	case 92:
+	{
+		WARN(ZS_BAD_ADDRESS_CHAR);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+	case 103:
+	{
+		WARN(ZS_BAD_APL);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+	case 106:
+	{
+		WARN(ZS_BAD_HEX_CHAR);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+	case 108:
+	{
+		WARN(ZS_BAD_HEX_RDATA);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+	case 113:
+	{
+		WARN(ZS_BAD_BASE64_CHAR);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+	case 123:
+	{
+		WARN(ZS_BAD_BASE32HEX_CHAR);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+	case 151:
+	{
+		WARN(ZS_BAD_GATEWAY);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+	case 152:
+	{
+		WARN(ZS_BAD_GATEWAY_KEY);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+	case 153:
+	{
+		WARN(ZS_UNSUPPORTED_TYPE);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+	case 249:
+	{
+		WARN(ZS_BAD_BITMAP);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+	case 266:
+	{
+		WARN(ZS_BAD_LOC_DATA);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+	case 267:
+	{
+		WARN(ZS_BAD_HEX_RDATA);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+	case 272:
+	{
+		WARN(ZS_BAD_CHAR_DASH);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+	case 276:
+	{
+		WARN(ZS_BAD_CHAR_COLON);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+	case 277:
+	{
+		WARN(ZS_BAD_ALGORITHM);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+	case 278:
+	{
+		WARN(ZS_BAD_CERT_TYPE);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+	case 282:
+	{
+		WARN(ZS_BAD_RDATA);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+	case 287:
+	{
+		WARN(ZS_UNSUPPORTED_TYPE);
+		p--; {cs = 299;	if ( p == pe )
+		goto _test_eof;
+goto _again;}
+	}
+	break;
+		}
+	}
+	}
+
+	_out: {}
+	}
+
+
+	// Check if the scanner state machine is in an uncovered state.
+	bool extra_error = false;
+	if (cs == 0) {
+		ERR(ZS_UNCOVERED_STATE);
+		extra_error = true;
+	// Check for an unclosed multiline record.
+	} else if (s->input.eof && s->multiline) {
+		ERR(ZS_UNCLOSED_MULTILINE);
+		extra_error = true;
+	}
+
+	// Treat the extra error.
+	if (extra_error) {
+		s->error.counter++;
+		s->state = ZS_STATE_ERROR;
+
+		// Copy the error context just for the part of the current line.
+		s->buffer_length = 0;
+		while (p < pe && *p != '\n' && s->buffer_length < 50) {
+			s->buffer[s->buffer_length++] = *p++;
+		}
+		s->buffer[s->buffer_length++] = 0;
+
+		// Execute the error callback.
+		if (s->process.automatic && s->process.error != NULL) {
+			s->process.error(s);
+		}
+
+		return;
+	}
+
+	// Storing scanner states.
+	s->cs  = cs;
+	s->top = top;
+	memcpy(s->stack, stack, sizeof(stack));
+
+	// Store the current parser position.
+	s->input.current = p;
+
+	// Storing r_data pointer.
+	s->r_data_tail = rdata_tail - s->r_data;
+
+	if (*wrap == WRAP_DETECTED) {
+		if (set_input_string(s, "\\", 1, true) != 0) {
+			return;
+		}
+
+		*wrap = WRAP_PROCESS;
+		parse(s, wrap);
+	} else {
+		*wrap = WRAP_NONE;
+	}
+}
+
+__attribute__((visibility("default")))
+int zs_parse_record(
+	zs_scanner_t *s)
+{
+	if (s == NULL) {
+		return -1;
+	}
+
+	// Check if parsing is possible.
+	switch (s->state) {
+	case ZS_STATE_NONE:
+	case ZS_STATE_DATA:
+	case ZS_STATE_INCLUDE:
+		break;
+	case ZS_STATE_ERROR:
+		if (s->error.fatal) {
+			return -1;
+		}
+		break;
+	default:
+		// Return if stop or end of file.
+		return 0;
+	}
+
+	// Check for the end of the input.
+	if (s->input.current != s->input.end) {
+		// Try to parse another item.
+		s->state = ZS_STATE_NONE;
+		wrap_t wrap = WRAP_NONE;
+		parse(s, &wrap);
+
+		// Finish if nothing was parsed.
+		if (s->state == ZS_STATE_NONE) {
+			// Parse the final block.
+			if (set_input_string(s, "\n", 1, true) != 0) {
+				return -1;
+			}
+			parse(s, &wrap);
+			if (s->state == ZS_STATE_NONE) {
+				s->state = ZS_STATE_EOF;
+			}
+		}
+	} else {
+		s->state = ZS_STATE_EOF;
+	}
+
+	return 0;
+}
+
+__attribute__((visibility("default")))
+int zs_parse_all(
+	zs_scanner_t *s)
+{
+	if (s == NULL) {
+		return -1;
+	}
+
+	s->process.automatic = true;
+
+	// Parse input block.
+	wrap_t wrap = WRAP_NONE;
+	parse(s, &wrap);
+
+	// Parse trailing newline-char block if it makes sense.
+	if (s->state != ZS_STATE_STOP && !s->error.fatal) {
+		if (set_input_string(s, "\n", 1, true) != 0) {
+			return -1;
+		}
+		parse(s, &wrap);
+	}
+
+	// Check if any errors have occurred.
+	if (s->error.counter > 0) {
+		return -1;
+	}
+
+	return 0;
+}
@@ -158,24 +158,34 @@ static int print_changeset_cb(bool special, const changeset_t *ch, void *ctx)
 	return KNOT_EOK;
 }
 
+static int init_shards(knot_lmdb_shards_t *jdb, const char *path)
+{
+	unsigned count = knot_lmdb_shards_detect(path);
+	return knot_lmdb_shards_init(jdb, count > 0 ? count : 1, path, 0,
+	                             journal_env_flags(JOURNAL_MODE_ROBUST), NULL);
+}
+
 int print_journal(char *path, knot_dname_t *name, print_params_t *params)
 {
-	knot_lmdb_db_t jdb = { 0 };
-	zone_journal_t j = { &jdb, name };
+	knot_lmdb_shards_t jdb = { 0 };
 	bool exists;
 	uint64_t occupied, occupied_all;
 
-	knot_lmdb_init(&jdb, path, 0, journal_env_flags(JOURNAL_MODE_ROBUST), NULL);
-	int ret = knot_lmdb_open(&jdb);
+	int ret = init_shards(&jdb, path);
 	if (ret != KNOT_EOK) {
-		knot_lmdb_deinit(&jdb);
+		return ret;
+	}
+	zone_journal_t j = { knot_lmdb_shard(&jdb, name), name };
+	ret = knot_lmdb_open(j.db);
+	if (ret != KNOT_EOK) {
+		knot_lmdb_shards_deinit(&jdb);
 		return ret;
 	}
 
 	ret = journal_info(j, &exists, NULL, NULL, NULL, NULL, NULL, &occupied, &occupied_all);
 	if (ret != KNOT_EOK || !exists) {
 		fprintf(stderr, "This zone does not exist in DB %s\n", path);
-		knot_lmdb_deinit(&jdb);
+		knot_lmdb_shards_deinit(&jdb);
 		return ret == KNOT_EOK ? KNOT_ENOENT : ret;
 	}
 
@@ -206,7 +216,7 @@ int print_journal(char *path, knot_dname_t *name, print_params_t *params)
 		printf("Occupied all zones together: %"PRIu64" KiB\n", occupied_all / 1024);
 	}
 
-	knot_lmdb_deinit(&jdb);
+	knot_lmdb_shards_deinit(&jdb);
 	return ret;
 }
 
@@ -223,11 +233,12 @@ static int list_zone(const knot_dname_t *zone, void *ctx)
 
 int list_zones(char *path)
 {
-	knot_lmdb_db_t jdb = { 0 };
-	knot_lmdb_init(&jdb, path, 0, journal_env_flags(JOURNAL_MODE_ROBUST), NULL);
-
-	int ret = journals_walk(&jdb, list_zone, NULL);
-	knot_lmdb_deinit(&jdb);
+	knot_lmdb_shards_t jdb = { 0 };
+	int ret = init_shards(&jdb, path);
+	if (ret == KNOT_EOK) {
+		ret = journals_walk(&jdb, list_zone, NULL);
+		knot_lmdb_shards_deinit(&jdb);
+	}
 	return ret;
 }
 
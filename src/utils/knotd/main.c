@@ -472,6 +472,13 @@ int main(int argc, char **argv)
 	/* Reconfigure logging. */
 	log_reconfigure(conf());
 
+	/* Don't let the handler threads wait for the log output. */
+	ret = log_async_start();
+	if (ret != KNOT_EOK && ret != KNOT_ENOTSUP) {
+		log_warning("failed to start asynchronous logging (%s)",
+		            knot_strerror(ret));
+	}
+
 	/* Initialize server. */
 	server_t server;
 	ret = server_init(&server, conf()->cache.srv_bg_threads);
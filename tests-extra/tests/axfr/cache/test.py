@@ -0,0 +1,43 @@
+#!/usr/bin/env python3
+
+'''Test for AXFR from Knot replaying pre-rendered messages to more slaves'''
+
+from dnstest.test import Test
+
+t = Test(tsig=True)
+
+master = t.server("knot")
+slave1 = t.server("knot")
+slave2 = t.server("knot")
+slave3 = t.server("knot")
+zones = t.zone_rnd(5) + t.zone(".") + t.zone("records.")
+
+master.axfr_cache = True
+
+t.link(zones, master, slave1)
+t.link(zones, master, slave2)
+t.link(zones, master, slave3)
+
+t.start()
+
+master.zones_wait(zones)
+slave1.zones_wait(zones)
+slave2.zones_wait(zones)
+slave3.zones_wait(zones)
+t.xfr_diff(master, slave1, zones)
+t.xfr_diff(master, slave2, zones)
+t.xfr_diff(master, slave3, zones)
+
+# Transfers of a changed zone must not replay the previous version.
+serial = master.zone_wait(zones[0])
+master.update_zonefile(zones[0], random=True)
+master.reload()
+master.zone_wait(zones[0], serial)
+slave1.ctl("zone-retransfer %s" % zones[0].name)
+slave2.ctl("zone-retransfer %s" % zones[0].name)
+slave1.zone_wait(zones[0], serial)
+slave2.zone_wait(zones[0], serial)
+t.xfr_diff(master, slave1, zones)
+t.xfr_diff(master, slave2, zones)
+
+t.end()
@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+
+'''Test for queries over the DNS over TLS listener'''
+
+import subprocess
+
+from dnstest.utils import *
+from dnstest.test import Test
+from dnstest import params
+
+def kdig(server, *flags):
+    cmd = [params.kdig_bin, "@%s" % server.addr, "-p", str(server.tls_port),
+           "+time=2", "+retry=0"] + list(flags) + ["example.com.", "SOA"]
+    check_log("KDIG %s" % " ".join(cmd[1:]))
+    proc = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                          universal_newlines=True)
+    detail_log(proc.stdout)
+    return proc.stdout
+
+if not params.kdig_bin:
+    raise Skip("No kdig")
+
+t = Test(tsig=False)
+
+knot = t.server("knot")
+zone = t.zone("example.com.")
+t.link(zone, knot)
+
+knot.tls_cert = t.data_dir + "cert.pem"
+knot.tls_key = t.data_dir + "key.pem"
+
+t.start()
+
+knot.zone_wait(zone)
+
+# Query and response over an established session.
+out = kdig(knot, "+tls")
+isset("status: NOERROR" in out, "TLS query answered")
+isset("SOA" in out.split("ANSWER SECTION")[-1], "TLS answer contains SOA")
+
+# More queries, each in a new TLS session.
+out = kdig(knot, "+tls", "example.com.", "NS")
+compare(out.count("status: NOERROR"), 2, "more TLS queries answered")
+
+# Plain DNS over TCP on the TLS port fails the handshake.
+out = kdig(knot, "+tcp")
+isset("status: NOERROR" not in out, "plain TCP query refused")
+
+# The listener keeps serving after a bad handshake.
+out = kdig(knot, "+tls")
+isset("status: NOERROR" in out, "TLS query after bad handshake")
+
+# Regular listener is unaffected.
+resp = knot.dig("example.com.", "SOA", udp=False)
+resp.check(rcode="NOERROR")
+
+t.end()
@@ -59,6 +59,8 @@ knot_bin = get_binary("KNOT_TEST_KNOT", repo_binary("src/knotd"))
 knot_ctl = get_binary("KNOT_TEST_KNOTC", repo_binary("src/knotc"))
 # KNOT_TEST_KEYMGR - Knot key management binary.
 keymgr_bin = get_binary("KNOT_TEST_KEYMGR", repo_binary("src/keymgr"))
+# KNOT_TEST_KDIG - Knot DNS lookup utility binary.
+kdig_bin = get_binary("KNOT_TEST_KDIG", repo_binary("src/kdig"))
 # KNOT_TEST_BIND - Bind binary.
 bind_bin = get_binary("KNOT_TEST_BIND", "named")
 # KNOT_TEST_BINDC - Bind control binary.
@@ -125,6 +125,9 @@ class Server(object):
         self.port = 0 # Needed for keymgr when port not yet generated
         self.fixed_port = False
         self.ctlport = None
+        self.tls_port = None
+        self.tls_cert = None
+        self.tls_key = None
         self.external = False
         self.ctlkey = None
         self.ctlkeyfile = None
@@ -139,6 +142,7 @@ class Server(object):
         self.udp_max_payload_ipv4 = None
         self.udp_max_payload_ipv6 = None
         self.disable_any = None
+        self.axfr_cache = None
         self.disable_notify = None
         self.semantic_check = True
         self.zonefile_sync = "1d"
@@ -1061,6 +1065,10 @@ class Knot(Server):
         s.item_str("listen", "%s@%s" % (self.addr, self.port))
         for addr in self.addr_extra:
             s.item_str("listen", "%s@%s" % (addr, self.port))
+        if self.tls_port:
+            s.item_str("listen-tls", "%s@%s" % (self.addr, self.tls_port))
+            s.item_str("tls-cert", self.tls_cert)
+            s.item_str("tls-key", self.tls_key)
         self._str(s, "tcp-remote-io-timeout", self.tcp_remote_io_timeout)
         self._str(s, "tcp-io-timeout", "500")
         self._bool(s, "tcp-reuseport", self.tcp_reuseport)
@@ -1251,6 +1259,8 @@ class Knot(Server):
         s.item_str("semantic-checks", "on" if self.semantic_check else "off")
         if self.disable_any:
             s.item_str("disable-any", "on")
+        if self.axfr_cache:
+            s.item_str("axfr-cache", "on")
         if len(self.modules) > 0:
             modules = ""
             for module in self.modules:
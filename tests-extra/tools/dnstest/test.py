@@ -194,6 +194,8 @@ class Test(object):
 
             server.port = self._gen_port()
             server.ctlport = self._gen_port()
+            if server.tls_cert:
+                server.tls_port = self._gen_port()
 
         for server in self.servers:
             server.gen_confile()
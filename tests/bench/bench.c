@@ -0,0 +1,89 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Performance benchmarks, not run by 'make check'.
+ *
+ * Usage: bench [NAME [SIZE]]
+ *
+ * Without arguments, all the benchmarks are run with their default sizes.
+ * Run 'make benchmark' in the tests directory to build and run them all.
+ */
+
+#include <signal.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+
+static const struct {
+	const char *name;
+	bench_run_f run;
+	unsigned long size;
+	const char *size_desc;
+} benchmarks[] = {
+	{ "cname_chain", bench_cname_chain, 50000, "queries" },
+	{ "compr", bench_compr, 100000, "answers" },
+	{ "dname_lower", bench_dname_to_lower, 1000000, "rounds of 4 names" },
+	{ "evsched", bench_evsched, 1000000, "schedule operations" },
+	{ "lazy_parse", bench_lazy_parse, 100000, "parses" },
+	{ "query_prefetch", bench_query_prefetch, 200000, "queries" },
+	{ "trie_batch", bench_trie_batch, 1000000, "names in the trie, e.g. 10000000" },
+	{ "worker_pool", bench_worker_pool, 100000, "tasks per producer thread" },
+	{ NULL }
+};
+
+static void interrupt_handle(int s)
+{
+}
+
+static void print_help(const char *program)
+{
+	printf("Usage: %s [NAME [SIZE]]\n\nBenchmarks:\n", program);
+	for (int i = 0; benchmarks[i].name != NULL; i++) {
+		printf("  %-14s SIZE: %s (default %lu)\n", benchmarks[i].name,
+		       benchmarks[i].size_desc, benchmarks[i].size);
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	const char *name = (argc > 1) ? argv[1] : NULL;
+	unsigned long size = (argc > 2) ? strtoul(argv[2], NULL, 10) : 0;
+
+	// Stopping the scheduler and worker threads interrupts them with a signal.
+	struct sigaction sa;
+	sa.sa_handler = interrupt_handle;
+	sigemptyset(&sa.sa_mask);
+	sa.sa_flags = 0;
+	sigaction(SIGALRM, &sa, NULL);
+
+	bool found = false;
+	for (int i = 0; benchmarks[i].name != NULL; i++) {
+		if (name == NULL || strcmp(name, benchmarks[i].name) == 0) {
+			benchmarks[i].run(size > 0 ? size : benchmarks[i].size);
+			found = true;
+		}
+	}
+
+	if (!found) {
+		print_help(argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
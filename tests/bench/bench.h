@@ -0,0 +1,48 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdio.h>
+
+#include "contrib/time.h"
+
+/*!
+ * \brief Benchmark entry point.
+ *
+ * \param size  Benchmark size (number of operations, items, ...).
+ */
+typedef void (*bench_run_f)(unsigned long size);
+
+/*! \brief Print a benchmark result line. */
+#define bench_report(name, fmt, ...) \
+	printf("%-14s " fmt "\n", name, ##__VA_ARGS__)
+
+/*! \brief Milliseconds elapsed since the given time. */
+inline static double bench_ms(const struct timespec *begin)
+{
+	struct timespec end = time_now();
+	return time_diff_ms(begin, &end);
+}
+
+void bench_cname_chain(unsigned long size);
+void bench_compr(unsigned long size);
+void bench_dname_to_lower(unsigned long size);
+void bench_evsched(unsigned long size);
+void bench_lazy_parse(unsigned long size);
+void bench_trie_batch(unsigned long size);
+void bench_query_prefetch(unsigned long size);
+void bench_worker_pool(unsigned long size);
@@ -0,0 +1,65 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+
+#include "bench.h"
+#include "libknot/dname.h"
+#include "contrib/tolower.h"
+
+/* Label-by-label lowercasing, for comparison. */
+static void label_to_lower(knot_dname_t *name)
+{
+	while (*name != '\0') {
+		for (uint8_t i = 1; i <= *name; i++) {
+			name[i] = knot_tolower(name[i]);
+		}
+		name += *name + 1;
+	}
+}
+
+void bench_dname_to_lower(unsigned long count)
+{
+	/* Names of common sizes. */
+	const knot_dname_t *names[] = {
+		(uint8_t *)"\x07""EXAMPLE""\x03""com",
+		(uint8_t *)"\x03""www""\x07""Example""\x03""com",
+		(uint8_t *)"\x05""_ldap""\x04""_tcp""\x02""dc""\x06""_msdcs""\x09""Subdomain"
+		           "\x07""example""\x03""org",
+		(uint8_t *)"\x1f""a-much-longer-host-name-LABEL-1""\x0c""intermediate"
+		           "\x07""example""\x02""co""\x02""uk",
+	};
+	const size_t names_count = sizeof(names) / sizeof(*names);
+	knot_dname_storage_t work[sizeof(names) / sizeof(*names)];
+
+	double ms[2];
+	for (int label = 0; label < 2; label++) {
+		struct timespec begin = time_now();
+		for (unsigned long n = 0; n < count; n++) {
+			for (size_t i = 0; i < names_count; i++) {
+				memcpy(work[i], names[i], knot_dname_size(names[i]));
+				if (label) {
+					label_to_lower(work[i]);
+				} else {
+					knot_dname_to_lower(work[i]);
+				}
+			}
+		}
+		ms[label] = bench_ms(&begin);
+	}
+	bench_report("dname_lower", "%lu x %zu names: %.0f ms (label-by-label %.0f ms)",
+	             count, names_count, ms[0], ms[1]);
+}
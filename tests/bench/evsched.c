@@ -0,0 +1,65 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+
+#include "bench.h"
+#include "knot/common/evsched.h"
+#include "libknot/errcode.h"
+
+#define POOL 65536
+
+static void fire_cb(event_t *ev)
+{
+}
+
+void bench_evsched(unsigned long ops)
+{
+	evsched_t sched;
+	if (evsched_init(&sched, NULL) != KNOT_EOK) {
+		return;
+	}
+
+	event_t **evs = calloc(POOL, sizeof(*evs));
+	for (int i = 0; i < POOL; i++) {
+		evs[i] = evsched_event_create(&sched, fire_cb, NULL);
+	}
+
+	// Spread the times over all wheel levels, cancel every other event.
+	uint32_t dt = 1;
+	struct timespec begin = time_now();
+	for (unsigned long i = 0; i < ops; i++) {
+		event_t *ev = evs[i % POOL];
+		dt = dt * 1103515245 + 12345;
+		if (evsched_schedule(ev, dt >> (i % 32)) != KNOT_EOK) {
+			break;
+		}
+		if (i % 2 == 1) {
+			evsched_cancel(evs[(i / 2) % POOL]);
+		}
+	}
+	double ms = bench_ms(&begin);
+	bench_report("evsched", "%lu schedules + %lu cancels in %.0f ms (%.0f ns/op)",
+	             ops, ops / 2, ms, ms * 1e6 / (ops + ops / 2));
+
+	for (int i = 0; i < POOL; i++) {
+		evsched_cancel(evs[i]);
+		evsched_event_free(evs[i]);
+	}
+	free(evs);
+
+	evsched_deinit(&sched);
+}
@@ -0,0 +1,97 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "bench.h"
+#include "../libknot/test_pkt.h"
+#include "contrib/mempattern.h"
+#include "contrib/ucw/mempool.h"
+
+void bench_compr(unsigned long count)
+{
+	knot_mm_t mm;
+	mm_ctx_mempool(&mm, MM_DEFAULT_BLKSIZE);
+
+	knot_rrset_t *rrs[COMPR_RRS];
+	compr_rrs(rrs);
+
+	/* Answers like the server creates them, in a new packet each time.
+	 * Best of a few interleaved rounds to reduce noise. */
+	const unsigned answer_rrs = 9;
+	double best[2] = { 0 };
+	for (unsigned round = 0; round < 6; round++) {
+		size_t max_size = KNOT_COMPR_DICT_MINSIZE + round % 2;
+		struct timespec begin = time_now();
+		for (unsigned long i = 0; i < count; i++) {
+			(void)compr_write(rrs, answer_rrs, max_size, &mm, false);
+			mp_flush(mm.ctx);
+		}
+		double ms = bench_ms(&begin);
+		if (round < 2 || ms < best[round % 2]) {
+			best[round % 2] = ms;
+		}
+	}
+	bench_report("compr", "%lu answers with %u RRs: heuristics %.0f ms, "
+	             "dictionary %.0f ms (%+.1f %%)", count, answer_rrs, best[0],
+	             best[1], 100 * (best[1] - best[0]) / best[0]);
+
+	for (unsigned i = 0; i < COMPR_RRS; i++) {
+		knot_rrset_free(rrs[i], NULL);
+	}
+	mp_delete(mm.ctx);
+}
+
+void bench_lazy_parse(unsigned long count)
+{
+	knot_rrset_t *rrs[COMPR_RRS];
+	compr_rrs(rrs);
+
+	/* Query with a few records and EDNS, like an UPDATE or a NOTIFY. */
+	knot_pkt_t *query = knot_pkt_new(NULL, KNOT_WIRE_MAX_PKTSIZE, NULL);
+	knot_rrset_t opt_rr;
+	int ret = knot_edns_init(&opt_rr, 1232, 0, 0, NULL);
+	ret |= knot_pkt_put_question(query, rrs[0]->owner, KNOT_CLASS_IN, KNOT_RRTYPE_SOA);
+	ret |= knot_pkt_begin(query, KNOT_AUTHORITY);
+	for (unsigned i = 0; i < 3; i++) {
+		ret |= knot_pkt_put(query, 0, rrs[i], 0);
+	}
+	ret |= knot_pkt_begin(query, KNOT_ADDITIONAL);
+	ret |= knot_pkt_put(query, 0, &opt_rr, 0);
+	if (ret != KNOT_EOK) {
+		goto finish;
+	}
+
+	knot_pkt_t *pkt = knot_pkt_new(query->wire, query->size, NULL);
+	double ms[2];
+	for (int mode = 0; mode < 2; mode++) {
+		unsigned flags = (mode == 0) ? 0 : KNOT_PF_LAZY;
+		struct timespec begin = time_now();
+		for (unsigned long i = 0; i < count; i++) {
+			(void)knot_pkt_reset(pkt, query->wire, query->size);
+			(void)knot_pkt_parse(pkt, flags);
+		}
+		ms[mode] = bench_ms(&begin);
+	}
+	bench_report("lazy_parse", "%lu parses of a query with 3 RRs and OPT: "
+	             "full %.0f ms, lazy %.0f ms", count, ms[0], ms[1]);
+	knot_pkt_free(pkt);
+
+finish:
+	knot_rrset_clear(&opt_rr, NULL);
+	knot_pkt_free(query);
+	for (unsigned i = 0; i < COMPR_RRS; i++) {
+		knot_rrset_free(rrs[i], NULL);
+	}
+}
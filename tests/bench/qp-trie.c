@@ -0,0 +1,83 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "contrib/macros.h"
+#include "contrib/qp-trie/trie.h"
+
+#define LOOKUPS 1000000
+
+/* Compare batched and scalar lookups of random names in a large trie. */
+void bench_trie_batch(unsigned long name_count)
+{
+	const char *alphabet = "abcdefghijklmn0123456789";
+	trie_t *trie = trie_create(NULL);
+	uint8_t (*names)[24] = malloc(name_count * sizeof(*names));
+	const trie_key_t **keys = malloc(LOOKUPS * sizeof(*keys));
+	trie_val_t **vals = malloc(LOOKUPS * sizeof(*vals));
+	uint32_t *lens = malloc(LOOKUPS * sizeof(*lens));
+	if (trie == NULL || names == NULL || keys == NULL || vals == NULL ||
+	    lens == NULL) {
+		goto finish;
+	}
+
+	/* Names like in a large delegation zone: <tld>\0<random label>\0 */
+	srand(1);
+	for (unsigned long i = 0; i < name_count; ++i) {
+		memcpy(names[i], "com", 4);
+		for (unsigned j = 4; j < sizeof(names[i]) - 1; ++j) {
+			names[i][j] = alphabet[rand() % strlen(alphabet)];
+		}
+		names[i][sizeof(names[i]) - 1] = '\0';
+		trie_val_t *val = trie_get_ins(trie, names[i], sizeof(names[i]));
+		*val = names[i];
+	}
+	for (unsigned i = 0; i < LOOKUPS; ++i) {
+		keys[i] = names[rand() % name_count];
+		lens[i] = sizeof(names[0]);
+	}
+
+	size_t found = 0;
+	struct timespec begin = time_now();
+	for (unsigned i = 0; i < LOOKUPS; ++i) {
+		found += (trie_get_try(trie, keys[i], lens[i]) != NULL);
+	}
+	double scalar_ms = bench_ms(&begin);
+
+	begin = time_now();
+	for (unsigned i = 0; i < LOOKUPS; i += 16) {
+		unsigned n = MIN(16, LOOKUPS - i);
+		trie_get_try_batch(trie, keys + i, lens + i, n, vals + i);
+		for (unsigned j = 0; j < n; ++j) {
+			found += (vals[i + j] != NULL);
+		}
+	}
+	double batch_ms = bench_ms(&begin);
+
+	bench_report("trie_batch", "%u lookups in %lu names: scalar %.0f ms, "
+	             "batch %.0f ms%s", LOOKUPS, name_count, scalar_ms, batch_ms,
+	             (found == 2 * LOOKUPS) ? "" : " (lookups failed)");
+
+finish:
+	trie_free(trie);
+	free(names);
+	free(keys);
+	free(vals);
+	free(lens);
+}
@@ -0,0 +1,117 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "bench.h"
+#include "../knot/test_query.h"
+#include "contrib/sockaddr.h"
+
+#define NAMES 100000
+
+typedef struct {
+	knot_mm_t mm;
+	knot_layer_t layer;
+	server_t server;
+	struct sockaddr_storage remote;
+	knotd_qdata_params_t params;
+} bench_server_t;
+
+static int server_setup(bench_server_t *ctx)
+{
+	memset(ctx, 0, sizeof(*ctx));
+	mm_ctx_mempool(&ctx->mm, MM_DEFAULT_BLKSIZE);
+	knot_layer_init(&ctx->layer, &ctx->mm, process_query_layer());
+
+	int ret = create_fake_server(&ctx->server, &ctx->mm);
+	if (ret == KNOT_EOK) {
+		ret = fill_zone(&ctx->server, NAMES);
+	}
+
+	sockaddr_set(&ctx->remote, AF_INET, "127.0.0.1", 53);
+	ctx->params = (knotd_qdata_params_t) {
+		.remote = &ctx->remote,
+		.flags = KNOTD_QUERY_FLAG_LIMIT_SIZE,
+		.server = &ctx->server
+	};
+
+	return ret;
+}
+
+static void server_cleanup(bench_server_t *ctx)
+{
+	mp_delete(ctx->mm.ctx);
+	server_deinit(&ctx->server);
+	conf_update(NULL, CONF_UPD_FNONE);
+}
+
+void bench_query_prefetch(unsigned long count)
+{
+	bench_server_t ctx;
+	query_t *queries = malloc(count * sizeof(*queries));
+	if (queries == NULL || server_setup(&ctx) != KNOT_EOK) {
+		goto finish;
+	}
+
+	srandom(1);
+	make_queries(queries, count, NAMES);
+
+	struct timespec begin = time_now();
+	answer_all(&ctx.layer, &ctx.params, queries, count, false, NULL, NULL);
+	double plain = bench_ms(&begin);
+	begin = time_now();
+	answer_all(&ctx.layer, &ctx.params, queries, count, true, NULL, NULL);
+	double staged = bench_ms(&begin);
+	bench_report("query_prefetch", "%lu queries, %u names: per-query %.0f ms, "
+	             "staged %.0f ms (%+.1f %%)", count, NAMES, plain, staged,
+	             100 * (plain - staged) / plain);
+
+finish:
+	server_cleanup(&ctx);
+	free(queries);
+}
+
+void bench_cname_chain(unsigned long count)
+{
+	bench_server_t ctx;
+	if (server_setup(&ctx) != KNOT_EOK || fill_cnames(&ctx.server) != KNOT_EOK) {
+		server_cleanup(&ctx);
+		return;
+	}
+
+	query_t query;
+	uint8_t wire[KNOT_WIRE_MIN_PKTSIZE];
+	uint8_t out[ANSWER_SIZE];
+	make_cname_query(&query, wire);
+
+	// Answers with the linked CNAME targets, then with zone lookups.
+	additional_t *saved[CNAME_CHAIN];
+	double ms[2];
+	for (int link = 1; link >= 0; link--) {
+		if (!link) {
+			link_cnames(&ctx.server, saved, false);
+		}
+		struct timespec begin = time_now();
+		for (unsigned long i = 0; i < count; i++) {
+			memcpy(query.wire, wire, query.iov.iov_len);
+			(void)answer(&ctx.layer, &ctx.params, &query.iov, out);
+		}
+		ms[link] = bench_ms(&begin);
+	}
+	link_cnames(&ctx.server, saved, true);
+	bench_report("cname_chain", "%lu queries for a chain of %u CNAMEs: "
+	             "linked %.0f ms, lookups %.0f ms", count, CNAME_CHAIN, ms[1], ms[0]);
+
+	server_cleanup(&ctx);
+}
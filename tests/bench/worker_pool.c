@@ -0,0 +1,83 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "knot/worker/pool.h"
+
+#define THREADS 4
+
+typedef struct {
+	worker_pool_t *pool;
+	task_t *tasks;
+	unsigned long count;
+} producer_t;
+
+static void task_noop(task_t *task)
+{
+}
+
+static void *producer_thread(void *arg)
+{
+	producer_t *producer = arg;
+	for (unsigned long i = 0; i < producer->count; i++) {
+		producer->tasks[i] = (task_t) { .run = task_noop };
+		worker_pool_assign(producer->pool, &producer->tasks[i]);
+	}
+
+	return NULL;
+}
+
+void bench_worker_pool(unsigned long count)
+{
+	worker_pool_t *pool = worker_pool_create(THREADS);
+	if (pool == NULL) {
+		return;
+	}
+	worker_pool_start(pool);
+
+	// Concurrent assignments of many short tasks.
+	pthread_t threads[THREADS];
+	producer_t producers[THREADS];
+	for (int i = 0; i < THREADS; i++) {
+		producers[i] = (producer_t) {
+			.pool = pool,
+			.tasks = calloc(count, sizeof(task_t)),
+			.count = count
+		};
+	}
+	struct timespec begin = time_now();
+	for (int i = 0; i < THREADS; i++) {
+		pthread_create(&threads[i], NULL, producer_thread, &producers[i]);
+	}
+	for (int i = 0; i < THREADS; i++) {
+		pthread_join(threads[i], NULL);
+	}
+	worker_pool_wait(pool);
+	double ms = bench_ms(&begin);
+	bench_report("worker_pool", "%lu tasks from %u threads in %.0f ms (%.0f ns/task)",
+	             THREADS * count, THREADS, ms, ms * 1e6 / (THREADS * count));
+
+	worker_pool_stop(pool);
+	worker_pool_join(pool);
+	worker_pool_destroy(pool);
+
+	for (int i = 0; i < THREADS; i++) {
+		free(producers[i].tasks);
+	}
+}
@@ -0,0 +1,190 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <tap/basic.h>
+
+#include "contrib/addr_trie.h"
+#include "contrib/sockaddr.h"
+#include "libknot/errcode.h"
+
+#define IDS_MAX 256
+
+typedef struct {
+	uint32_t ids[IDS_MAX];
+	unsigned count;
+} ids_t;
+
+static bool collect(uint32_t id, void *ctx)
+{
+	ids_t *ids = ctx;
+	if (ids->count < IDS_MAX) {
+		ids->ids[ids->count++] = id;
+	}
+	return false;
+}
+
+static struct sockaddr_storage addr(int family, const char *str)
+{
+	struct sockaddr_storage ss;
+	sockaddr_set(&ss, family, str, 53);
+	return ss;
+}
+
+/*! \brief Check the matching identifiers (ordered from the shortest prefix). */
+static void check_match(addr_trie_t *trie, int family, const char *str,
+                        const char *expected)
+{
+	struct sockaddr_storage ss = addr(family, str);
+	ids_t ids = { { 0 } };
+	addr_trie_match(trie, &ss, collect, &ids);
+
+	char out[64] = "";
+	for (unsigned i = 0; i < ids.count; i++) {
+		char buf[12];
+		snprintf(buf, sizeof(buf), "%s%u", (i > 0) ? "," : "", ids.ids[i]);
+		strcat(out, buf);
+	}
+	is_string(expected, out, "match %s", str);
+}
+
+static void test_nets(void)
+{
+	addr_trie_t *trie = addr_trie_new();
+	ok(trie != NULL, "create trie");
+
+	struct sockaddr_storage ss;
+	ss = addr(AF_INET, "10.0.0.0");
+	is_int(KNOT_EOK, addr_trie_add_net(trie, &ss, 8, 1), "add 10.0.0.0/8");
+	ss = addr(AF_INET, "10.1.2.0");
+	is_int(KNOT_EOK, addr_trie_add_net(trie, &ss, 24, 2), "add 10.1.2.0/24");
+	ss = addr(AF_INET, "10.1.2.3");
+	is_int(KNOT_EOK, addr_trie_add_net(trie, &ss, -1, 3), "add 10.1.2.3");
+	ss = addr(AF_INET, "10.1.3.0");
+	is_int(KNOT_EOK, addr_trie_add_net(trie, &ss, 24, 4), "add 10.1.3.0/24");
+	ss = addr(AF_INET, "10.1.2.0");
+	is_int(KNOT_EOK, addr_trie_add_net(trie, &ss, 24, 5), "add 10.1.2.0/24 again");
+	ss = addr(AF_INET6, "2001:db8::");
+	is_int(KNOT_EOK, addr_trie_add_net(trie, &ss, 32, 6), "add 2001:db8::/32");
+	ss = addr(AF_INET6, "::");
+	is_int(KNOT_EOK, addr_trie_add_net(trie, &ss, 0, 7), "add ::/0");
+
+	check_match(trie, AF_INET, "10.1.2.3", "1,2,5,3");
+	check_match(trie, AF_INET, "10.1.2.4", "1,2,5");
+	check_match(trie, AF_INET, "10.1.3.3", "1,4");
+	check_match(trie, AF_INET, "10.200.0.1", "1");
+	check_match(trie, AF_INET, "11.0.0.1", "");
+	check_match(trie, AF_INET6, "2001:db8:1::1", "7,6");
+	check_match(trie, AF_INET6, "2001:db9::1", "7");
+
+	ss = addr(AF_INET, "10.1.2.3");
+	ok(addr_trie_contains(trie, &ss), "contains 10.1.2.3");
+	ss = addr(AF_INET, "192.168.0.1");
+	ok(!addr_trie_contains(trie, &ss), "not contains 192.168.0.1");
+	ss.ss_family = AF_UNIX;
+	ok(!addr_trie_contains(trie, &ss), "not contains unix");
+	is_int(KNOT_EINVAL, addr_trie_add_net(trie, &ss, 0, 0), "add unix");
+
+	addr_trie_free(trie);
+}
+
+static void test_ranges(void)
+{
+	addr_trie_t *trie = addr_trie_new();
+
+	struct sockaddr_storage min = addr(AF_INET, "100.0.0.1");
+	struct sockaddr_storage max = addr(AF_INET, "100.0.1.7");
+	is_int(KNOT_EOK, addr_trie_add_range(trie, &min, &max, 1), "add IPv4 range");
+	min = addr(AF_INET6, "::");
+	max = addr(AF_INET6, "::5");
+	is_int(KNOT_EOK, addr_trie_add_range(trie, &min, &max, 2), "add IPv6 range");
+	min = addr(AF_INET, "255.255.255.254");
+	max = addr(AF_INET, "255.255.255.255");
+	is_int(KNOT_EOK, addr_trie_add_range(trie, &min, &max, 3), "add IPv4 range at the end");
+	max = addr(AF_INET6, "::");
+	is_int(KNOT_EINVAL, addr_trie_add_range(trie, &min, &max, 4), "add mixed range");
+
+	check_match(trie, AF_INET, "100.0.0.0", "");
+	check_match(trie, AF_INET, "100.0.0.1", "1");
+	check_match(trie, AF_INET, "100.0.0.255", "1");
+	check_match(trie, AF_INET, "100.0.1.7", "1");
+	check_match(trie, AF_INET, "100.0.1.8", "");
+	check_match(trie, AF_INET, "255.255.255.255", "3");
+	check_match(trie, AF_INET6, "::", "2");
+	check_match(trie, AF_INET6, "::5", "2");
+	check_match(trie, AF_INET6, "::6", "");
+
+	addr_trie_free(trie);
+}
+
+static void test_random(void)
+{
+	addr_trie_t *trie = addr_trie_new();
+
+	// Compare with the linear matching of random networks.
+	struct {
+		struct sockaddr_storage addr;
+		unsigned prefix;
+	} nets[200];
+	for (int i = 0; i < 200; i++) {
+		uint8_t raw[4] = { 10, rand() % 4, rand() % 4, rand() % 256 };
+		sockaddr_set_raw(&nets[i].addr, AF_INET, raw, sizeof(raw));
+		nets[i].prefix = 8 + rand() % 25;
+		addr_trie_add_net(trie, &nets[i].addr, nets[i].prefix, i);
+	}
+
+	bool match = true;
+	for (int i = 0; i < 10000; i++) {
+		struct sockaddr_storage ss;
+		uint8_t raw[4] = { 10, rand() % 4, rand() % 4, rand() % 256 };
+		sockaddr_set_raw(&ss, AF_INET, raw, sizeof(raw));
+
+		uint8_t found[200] = { 0 };
+		ids_t ids = { { 0 } };
+		addr_trie_match(trie, &ss, collect, &ids);
+		for (unsigned j = 0; j < ids.count; j++) {
+			found[ids.ids[j]] = 1;
+		}
+		unsigned expected = 0;
+		for (int j = 0; j < 200; j++) {
+			bool net_match = sockaddr_net_match(&ss, &nets[j].addr, nets[j].prefix);
+			expected += net_match;
+			match = match && (net_match == found[j]);
+		}
+		match = match && (expected == ids.count);
+	}
+	ok(match, "random networks match linear search");
+
+	addr_trie_free(trie);
+}
+
+int main(int argc, char *argv[])
+{
+	plan_lazy();
+
+	diag("networks");
+	test_nets();
+
+	diag("ranges");
+	test_ranges();
+
+	diag("random");
+	test_random();
+
+	return 0;
+}
@@ -178,6 +178,59 @@ static void test_wildcards(void)
 	ok(true, "trie: wildcard searches");
 }
 
+/* Compare batched lookups with the scalar ones, including missing keys. */
+static void test_batch(trie_t *trie, char **keys, unsigned key_count)
+{
+	const unsigned count = 1000;
+	const trie_key_t *bkeys[count];
+	uint32_t lens[count];
+	trie_val_t *vals[count];
+	char *missing[count];
+	for (unsigned i = 0; i < count; ++i) {
+		missing[i] = NULL;
+		if (i % 3 == 0) {
+			/* Prefix or extension of an existing key. */
+			const char *key = keys[rand() % key_count];
+			size_t len = strlen(key) + 1;
+			missing[i] = malloc(len + 1);
+			memcpy(missing[i], key, len);
+			missing[i][len] = 'x';
+			bkeys[i] = (uint8_t *)missing[i];
+			lens[i] = (i % 2 == 0) ? len + 1 : len - 1;
+		} else {
+			bkeys[i] = (uint8_t *)keys[rand() % key_count];
+			lens[i] = strlen((const char *)bkeys[i]) + 1;
+		}
+	}
+
+	/* Counts not aligned to the number of lanes. */
+	bool passed = true;
+	for (unsigned n = 0; n <= count && passed; n += (n < 40) ? 1 : 321) {
+		trie_get_try_batch(trie, bkeys, lens, n, vals);
+		for (unsigned i = 0; i < n; ++i) {
+			if (vals[i] != trie_get_try(trie, bkeys[i], lens[i])) {
+				diag("trie: batch mismatch on key %u/%u", i, n);
+				passed = false;
+				break;
+			}
+		}
+	}
+	ok(passed, "trie: batch lookup");
+
+	trie_t *empty = trie_create(NULL);
+	trie_get_try_batch(empty, bkeys, lens, count, vals);
+	passed = true;
+	for (unsigned i = 0; i < count; ++i) {
+		passed = passed && vals[i] == NULL;
+	}
+	ok(passed, "trie: batch lookup in empty trie");
+	trie_free(empty);
+
+	for (unsigned i = 0; i < count; ++i) {
+		free(missing[i]);
+	}
+}
+
 int main(int argc, char *argv[])
 {
 	plan_lazy();
@@ -250,6 +303,9 @@ int main(int argc, char *argv[])
 	}
 	ok(passed, "trie: find lesser or equal for all keys");
 
+	/* Batched lookups. */
+	test_batch(trie, keys, key_count);
+
 	/* Sorted iteration. */
 	char key_buf[KEY_MAXLEN] = {'\0'};
 	size_t iterated = 0;
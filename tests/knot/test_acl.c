@@ -15,6 +15,9 @@
  */
 
 #include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <sys/types.h>
 #include <sys/socket.h>
 #include <tap/basic.h>
@@ -150,6 +153,8 @@ static void test_acl_allowed(void)
 	check_sockaddr_set(&addr, AF_INET6, "2001::1", 0);
 	ret = acl_allowed(conf(), &acl, ACL_ACTION_TRANSFER, &addr, &key1, zone_name, NULL);
 	ok(ret == true, "Address, key, action match");
+	ok(key1.secret.size == 3 && memcmp(key1.secret.data, "foo", 3) == 0,
+	   "Key secret filled");
 
 	acl = conf_zone_get(conf(), C_ACL, zone_name);
 	ok(acl.code == KNOT_EOK, "Get zone ACL");
@@ -271,10 +276,64 @@ static void test_acl_allowed(void)
 	knot_dname_free(key3_name, NULL);
 }
 
+static void test_acl_many(void)
+{
+	const int rules = 1000;
+	knot_dname_t *zone_name = knot_dname_from_str_alloc(ZONE);
+
+	// Many single-address rules followed by a denying network.
+	char *conf_str = malloc(rules * 128 + 256);
+	assert(conf_str);
+	char *pos = conf_str + sprintf(conf_str, "acl:\n");
+	for (int i = 0; i < rules; i++) {
+		pos += sprintf(pos, "  - id: acl%d\n    address: 10.0.%d.%d\n"
+		                    "    action: transfer\n", i, i / 256, i % 256);
+	}
+	pos += sprintf(pos, "  - id: deny\n    address: 10.0.0.0/8\n    deny: on\n"
+	                    "    action: [ transfer, notify ]\n");
+	pos += sprintf(pos, "zone:\n  - domain: "ZONE"\n    acl: [ deny");
+	for (int i = rules - 1; i >= 0; i--) {
+		pos += sprintf(pos, ", acl%d", i);
+	}
+	sprintf(pos, " ]\n  - domain: "KEY1"\n    acl: [ acl%d, deny ]\n", rules - 1);
+
+	int ret = test_conf(conf_str, NULL);
+	is_int(KNOT_EOK, ret, "Prepare configuration");
+	free(conf_str);
+
+	struct sockaddr_storage addr = { 0 };
+	knot_tsig_key_t key0 = { 0 };
+	conf_val_t acl = conf_zone_get(conf(), C_ACL, zone_name);
+	check_sockaddr_set(&addr, AF_INET, "10.0.3.231", 0);
+	ret = acl_allowed(conf(), &acl, ACL_ACTION_TRANSFER, &addr, &key0, zone_name, NULL);
+	ok(ret == false, "Many rules, denied by the first rule");
+
+	knot_dname_t *key1_name = knot_dname_from_str_alloc(KEY1);
+	acl = conf_zone_get(conf(), C_ACL, key1_name);
+	ret = acl_allowed(conf(), &acl, ACL_ACTION_TRANSFER, &addr, &key0, key1_name, NULL);
+	ok(ret == true, "Many rules, allowed by the first rule");
+
+	check_sockaddr_set(&addr, AF_INET, "10.0.3.232", 0);
+	acl = conf_zone_get(conf(), C_ACL, key1_name);
+	ret = acl_allowed(conf(), &acl, ACL_ACTION_TRANSFER, &addr, &key0, key1_name, NULL);
+	ok(ret == false, "Many rules, denied by the second rule");
+
+	acl = conf_zone_get(conf(), C_ACL, key1_name);
+	ret = acl_allowed(conf(), &acl, ACL_ACTION_UPDATE, &addr, &key0, key1_name, NULL);
+	ok(ret == false, "Many rules, no rule matches");
+
+	conf_update(NULL, CONF_UPD_FNONE);
+	knot_dname_free(zone_name, NULL);
+	knot_dname_free(key1_name, NULL);
+}
+
 int main(int argc, char *argv[])
 {
 	plan_lazy();
 
+	diag("acl_many");
+	test_acl_many();
+
 	diag("acl_allowed");
 	test_acl_allowed();
 
@@ -0,0 +1,115 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <tap/basic.h>
+#include <unistd.h>
+
+#include "knot/query/conn_pool.h"
+#include "libknot/errcode.h"
+#include "contrib/sockaddr.h"
+
+/*! \brief Connected socket pair, returns our end, sets the remote end. */
+static int make_conn(int *peer)
+{
+	int fds[2];
+	int ret = socketpair(AF_UNIX, SOCK_STREAM, 0, fds);
+	if (ret != 0) {
+		return -1;
+	}
+	*peer = fds[1];
+	return fds[0];
+}
+
+static bool is_open(int fd)
+{
+	return fcntl(fd, F_GETFD) != -1;
+}
+
+int main(int argc, char *argv[])
+{
+	plan_lazy();
+
+	struct sockaddr_storage any = { AF_UNSPEC };
+	struct sockaddr_storage src, dst1, dst2;
+	sockaddr_set(&src, AF_INET, "127.0.0.1", 0);
+	sockaddr_set(&dst1, AF_INET, "192.0.2.1", 53);
+	sockaddr_set(&dst2, AF_INET6, "2001:db8::1", 53);
+
+	conn_pool_t *pool = conn_pool_init(2, 60);
+	ok(pool != NULL, "create pool");
+
+	// Keyed by the remote and source address.
+	int peer1, peer2;
+	int fd1 = make_conn(&peer1);
+	int fd2 = make_conn(&peer2);
+	conn_pool_put(pool, &any, &dst1, fd1);
+	conn_pool_put(pool, &src, &dst1, fd2);
+	is_int(-1, conn_pool_get(pool, &any, &dst2), "get: other remote");
+	is_int(fd2, conn_pool_get(pool, &src, &dst1), "get: matching source");
+	is_int(fd1, conn_pool_get(pool, NULL, &dst1), "get: any source");
+	is_int(-1, conn_pool_get(pool, NULL, &dst1), "get: taken");
+
+	// Connections closed by the remote are discarded.
+	conn_pool_put(pool, NULL, &dst1, fd1);
+	close(peer1);
+	is_int(-1, conn_pool_get(pool, NULL, &dst1), "get: closed by remote");
+	ok(!is_open(fd1), "get: closed connection released");
+
+	// The least recently used connection is replaced if full.
+	int peer3, peer4;
+	int fd3 = make_conn(&peer3);
+	int fd4 = make_conn(&peer4);
+	conn_pool_put(pool, NULL, &dst1, fd2);
+	sleep(1);
+	conn_pool_put(pool, NULL, &dst2, fd3);
+	conn_pool_put(pool, NULL, &dst2, fd4);
+	ok(!is_open(fd2), "put: least recently used closed");
+	is_int(2, pool->usage, "put: limit kept");
+
+	// Shrinking closes connections, zero capacity disables pooling.
+	int ret = conn_pool_set(pool, 1, 60);
+	is_int(KNOT_EOK, ret, "set: shrink");
+	is_int(1, pool->usage, "set: connections closed");
+	ret = conn_pool_set(pool, 0, 60);
+	is_int(KNOT_EOK, ret, "set: disable");
+	ok(!is_open(fd3) && !is_open(fd4), "set: all closed");
+	int peer5;
+	int fd5 = make_conn(&peer5);
+	conn_pool_put(pool, NULL, &dst1, fd5);
+	ok(!is_open(fd5), "put: disabled pool closes");
+
+	// Idle connections expire.
+	ret = conn_pool_set(pool, 2, 1);
+	is_int(KNOT_EOK, ret, "set: enable");
+	int peer6;
+	int fd6 = make_conn(&peer6);
+	conn_pool_put(pool, NULL, &dst1, fd6);
+	sleep(2);
+	is_int(-1, conn_pool_get(pool, NULL, &dst1), "get: expired");
+	ok(!is_open(fd6), "get: expired closed");
+
+	conn_pool_deinit(pool);
+
+	close(peer2);
+	close(peer3);
+	close(peer4);
+	close(peer5);
+	close(peer6);
+
+	return 0;
+}
@@ -0,0 +1,143 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <pthread.h>
+#include <signal.h>
+#include <tap/basic.h>
+#include <unistd.h>
+
+#include "knot/common/evsched.h"
+#include "contrib/time.h"
+#include "libknot/errcode.h"
+
+#define EVENTS 200
+
+typedef struct {
+	struct timespec scheduled;
+	struct timespec fired;
+	uint32_t dt;
+	unsigned count;
+} ev_data_t;
+
+static pthread_mutex_t fired_lock = PTHREAD_MUTEX_INITIALIZER;
+static unsigned fired_total;
+
+static void interrupt_handle(int s)
+{
+}
+
+static void fire_cb(event_t *ev)
+{
+	ev_data_t *data = ev->data;
+	data->fired = time_now();
+	pthread_mutex_lock(&fired_lock);
+	data->count++;
+	fired_total++;
+	pthread_mutex_unlock(&fired_lock);
+}
+
+static unsigned get_fired(void)
+{
+	pthread_mutex_lock(&fired_lock);
+	unsigned res = fired_total;
+	pthread_mutex_unlock(&fired_lock);
+	return res;
+}
+
+static void wait_fired(unsigned expected, unsigned timeout_ms)
+{
+	for (unsigned i = 0; i < timeout_ms && get_fired() < expected; i++) {
+		usleep(1000);
+	}
+}
+
+static void test_expiry(evsched_t *sched)
+{
+	event_t *evs[EVENTS];
+	ev_data_t data[EVENTS] = { { { 0 } } };
+
+	// Both level 0 and level 1 of the wheel.
+	for (int i = 0; i < EVENTS; i++) {
+		evs[i] = evsched_event_create(sched, fire_cb, &data[i]);
+		data[i].dt = (i % 2 == 0) ? i / 4 : 64 + i;
+		data[i].scheduled = time_now();
+		evsched_schedule(evs[i], data[i].dt);
+	}
+
+	// Cancelled and rescheduled events.
+	ev_data_t cancelled = { { 0 } }, moved = { { 0 } };
+	event_t *ev_cancelled = evsched_event_create(sched, fire_cb, &cancelled);
+	event_t *ev_moved = evsched_event_create(sched, fire_cb, &moved);
+	evsched_schedule(ev_cancelled, 20);
+	evsched_schedule(ev_moved, 10000);
+	moved.dt = 30;
+	moved.scheduled = time_now();
+	evsched_schedule(ev_moved, moved.dt);
+	evsched_cancel(ev_cancelled);
+
+	evsched_start(sched);
+	wait_fired(EVENTS + 1, 5000);
+	usleep(50 * 1000);
+
+	bool all_once = true, none_early = true;
+	for (int i = 0; i < EVENTS; i++) {
+		all_once = all_once && data[i].count == 1;
+		// One millisecond tolerance for tick rounding.
+		none_early = none_early &&
+		             time_diff_ms(&data[i].scheduled, &data[i].fired) + 1 >= data[i].dt;
+	}
+	ok(all_once, "expiry: all events fired once");
+	ok(none_early, "expiry: no event fired early");
+	ok(cancelled.count == 0, "expiry: cancelled event not fired");
+	ok(moved.count == 1 &&
+	   time_diff_ms(&moved.scheduled, &moved.fired) + 1 >= moved.dt &&
+	   time_diff_ms(&moved.scheduled, &moved.fired) < 5000, "expiry: rescheduled event");
+
+	// Events can be scheduled again after expiry.
+	unsigned before = get_fired();
+	evsched_schedule(evs[0], 1);
+	wait_fired(before + 1, 5000);
+	ok(data[0].count == 2, "expiry: event fired again");
+
+	evsched_stop(sched);
+	evsched_join(sched);
+
+	for (int i = 0; i < EVENTS; i++) {
+		evsched_event_free(evs[i]);
+	}
+	evsched_event_free(ev_cancelled);
+	evsched_event_free(ev_moved);
+}
+
+int main(int argc, char *argv[])
+{
+	plan_lazy();
+
+	// Stopping the scheduler thread interrupts it with a signal.
+	struct sigaction sa;
+	sa.sa_handler = interrupt_handle;
+	sigemptyset(&sa.sa_mask);
+	sa.sa_flags = 0;
+	sigaction(SIGALRM, &sa, NULL);
+
+	evsched_t sched;
+	int ret = evsched_init(&sched, NULL);
+	is_int(KNOT_EOK, ret, "create scheduler");
+	test_expiry(&sched);
+	evsched_deinit(&sched);
+
+	return 0;
+}
@@ -44,6 +44,8 @@ zone_journal_t jj;
 
 unsigned env_flag;
 
+const char *compression = "none";
+
 static void set_conf(int zonefile_sync, size_t journal_usage, const knot_dname_t *apex)
 {
 	char conf_str[512];
@@ -52,8 +54,9 @@ static void set_conf(int zonefile_sync, size_t journal_usage, const knot_dname_t
 	         " - domain: %s\n"
 	         "   zonefile-sync: %d\n"
 	         "   max-journal-usage: %zu\n"
-	         "   max-journal-depth: 1000\n",
-	         (const char *)(apex + 1), zonefile_sync, journal_usage);
+	         "   max-journal-depth: 1000\n"
+	         "   journal-compression: %s\n",
+	         (const char *)(apex + 1), zonefile_sync, journal_usage, compression);
 	int ret = test_conf(conf_str, NULL);
 	(void)ret;
 	assert(ret == KNOT_EOK);
@@ -530,6 +533,7 @@ static changeset_t * tm_chs(const knot_dname_t * apex, int x)
 		changeset_free(chsX);
 		changeset_free(chsY);
 		chsI = chsX = chsY = NULL;
+		serial = 0;
 		return NULL;
 	}
 
@@ -697,6 +701,15 @@ int main(int argc, char *argv[])
 
 	test_stress(apex);
 
+#ifdef HAVE_ZSTD
+	knot_lmdb_deinit(&jdb);
+	compression = "zstd";
+
+	test_store_load(apex);
+
+	test_merge(apex);
+#endif
+
 	knot_lmdb_deinit(&jdb);
 
 	test_rm_rf(test_dir_name);
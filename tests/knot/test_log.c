@@ -0,0 +1,184 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <tap/basic.h>
+#include <tap/files.h>
+#include <unistd.h>
+
+#include "test_conf.h"
+#include "knot/common/log.h"
+#include "libknot/libknot.h"
+
+#define THREADS 4
+#define MESSAGES 200
+#define FLOOD 100000
+
+static void *log_thread(void *arg)
+{
+	long id = (long)arg;
+
+	for (int i = 0; i < MESSAGES; i++) {
+		log_zone_str_info("example.com", "thread %ld, message %d", id, i);
+	}
+
+	return NULL;
+}
+
+static void test_threads(const char *path)
+{
+	int ret = log_async_start();
+	is_int(KNOT_EOK, ret, "start asynchronous logging");
+
+	pthread_t threads[THREADS];
+	for (long i = 0; i < THREADS; i++) {
+		pthread_create(&threads[i], NULL, log_thread, (void *)i);
+	}
+	for (int i = 0; i < THREADS; i++) {
+		pthread_join(threads[i], NULL);
+	}
+
+	log_async_stop();
+
+	FILE *file = fopen(path, "r");
+	ok(file != NULL, "open log file");
+	if (file == NULL) {
+		return;
+	}
+
+	int next[THREADS] = { 0 };
+	unsigned lines = 0, dropped = 0;
+	bool ordered = true;
+	char line[1024];
+	while (fgets(line, sizeof(line), file) != NULL) {
+		long id;
+		int msg;
+		unsigned count;
+		if (sscanf(line, "[example.com.] thread %ld, message %d", &id, &msg) == 2) {
+			ordered = ordered && id < THREADS && msg >= next[id];
+			next[id] = msg + 1;
+			lines++;
+		} else if (sscanf(line, "warning: logging, dropped %u messages", &count) == 1) {
+			dropped += count;
+		}
+	}
+	fclose(file);
+
+	is_int(THREADS * MESSAGES, lines + dropped, "all messages written or reported");
+	ok(ordered, "messages of each thread in order");
+}
+
+static void test_flood(const char *path)
+{
+	FILE *file = fopen(path, "w");
+	fclose(file);
+
+	int ret = log_async_start();
+	is_int(KNOT_EOK, ret, "start asynchronous logging");
+
+	for (int i = 0; i < FLOOD; i++) {
+		log_info("flood %d", i);
+	}
+
+	log_async_stop();
+
+	file = fopen(path, "r");
+	unsigned lines = 0, dropped = 0;
+	char line[1024];
+	while (fgets(line, sizeof(line), file) != NULL) {
+		unsigned count;
+		if (strncmp(line, "flood ", 6) == 0) {
+			lines++;
+		} else if (sscanf(line, "warning: logging, dropped %u messages", &count) == 1) {
+			dropped += count;
+		}
+	}
+	fclose(file);
+
+	diag("flood: %u written, %u dropped", lines, dropped);
+	is_int(FLOOD, lines + dropped, "flood: all messages written or reported");
+}
+
+static void test_filtered(const char *path)
+{
+	FILE *file = fopen(path, "w");
+	fclose(file);
+
+	int ret = log_async_start();
+	is_int(KNOT_EOK, ret, "start asynchronous logging");
+
+	// Debug messages are not accepted by any target.
+	for (int i = 0; i < FLOOD; i++) {
+		log_debug("filtered %d", i);
+	}
+	log_info("accepted");
+
+	log_async_stop();
+
+	file = fopen(path, "r");
+	unsigned lines = 0, dropped = 0;
+	char line[1024];
+	while (fgets(line, sizeof(line), file) != NULL) {
+		unsigned count;
+		if (strncmp(line, "filtered ", 9) == 0) {
+			lines++;
+		} else if (sscanf(line, "warning: logging, dropped %u messages", &count) == 1) {
+			dropped += count;
+		} else if (strncmp(line, "accepted", 8) == 0) {
+			ok(true, "filtered: accepted message written");
+		}
+	}
+	fclose(file);
+
+	ok(lines == 0 && dropped == 0, "filtered: messages not queued");
+}
+
+int main(int argc, char *argv[])
+{
+	plan_lazy();
+
+	char *dir = test_mkdtemp();
+	ok(dir != NULL, "make temporary directory");
+	char path[512];
+	snprintf(path, sizeof(path), "%s/log", dir);
+
+	char conf_str[1024];
+	snprintf(conf_str, sizeof(conf_str),
+	         "log:\n"
+	         "  - target: %s\n"
+	         "    any: info\n", path);
+	int ret = test_conf(conf_str, NULL);
+	is_int(KNOT_EOK, ret, "prepare configuration");
+
+	log_init();
+	log_reconfigure(conf());
+	log_flag_set(LOG_FLAG_NOTIMESTAMP | LOG_FLAG_NOINFO);
+
+	test_threads(path);
+	test_flood(path);
+	test_filtered(path);
+
+	log_close();
+	conf_free(conf());
+
+	test_rm_rf(dir);
+	free(dir);
+
+	return 0;
+}
@@ -22,6 +22,7 @@
 #include "libknot/descriptor.h"
 #include "libknot/packet/wire.h"
 #include "knot/nameserver/process_query.h"
+#include "knot/nameserver/query_module.h"
 #include "test_server.h"
 #include "contrib/sockaddr.h"
 #include "contrib/ucw/mempool.h"
@@ -71,6 +72,161 @@ static void exec_query(knot_layer_t *layer, const char *name,
 	knot_pkt_free(answer);
 }
 
+/* Resolve query with EDNS TCP keepalive option and check the answer. */
+static void exec_keepalive(knot_layer_t *layer, uint16_t query_timeout,
+                           int expected)
+{
+	knot_pkt_t *built = knot_pkt_new(NULL, KNOT_WIRE_MAX_PKTSIZE, NULL);
+	knot_pkt_put_question(built, ROOT_DNAME, KNOT_CLASS_IN, KNOT_RRTYPE_SOA);
+
+	uint8_t data[sizeof(uint16_t)];
+	uint16_t data_len = knot_edns_keepalive_size(query_timeout);
+	knot_edns_keepalive_write(data, sizeof(data), query_timeout);
+
+	knot_rrset_t opt_rr;
+	knot_edns_init(&opt_rr, KNOT_WIRE_MIN_PKTSIZE, 0, KNOT_EDNS_VERSION, NULL);
+	knot_edns_add_option(&opt_rr, KNOT_EDNS_OPTION_TCP_KEEPALIVE, data_len,
+	                     data, NULL);
+	knot_pkt_begin(built, KNOT_ADDITIONAL);
+	knot_pkt_put(built, KNOT_COMPR_HINT_NONE, &opt_rr, KNOT_PF_FREE);
+
+	/* Process the query as received. */
+	knot_pkt_t *query = knot_pkt_new(built->wire, built->size, NULL);
+	knot_pkt_t *answer = knot_pkt_new(NULL, KNOT_WIRE_MAX_PKTSIZE, NULL);
+	knot_layer_reset(layer);
+	knot_pkt_parse(query, 0);
+	knot_layer_consume(layer, query);
+	knot_layer_produce(layer, answer);
+	if (layer->state == KNOT_STATE_FAIL) {
+		knot_layer_produce(layer, answer);
+	}
+
+	knot_pkt_t *parsed = knot_pkt_new(answer->wire, answer->size, NULL);
+	int ret = knot_pkt_parse(parsed, 0);
+	uint8_t *opt = knot_pkt_edns_option(parsed, KNOT_EDNS_OPTION_TCP_KEEPALIVE);
+	if (expected < 0) {
+		ok(ret == KNOT_EOK && knot_pkt_ext_rcode(parsed) == KNOT_RCODE_FORMERR,
+		   "ns: keepalive with timeout in query refused");
+	} else if (ret == KNOT_EOK && opt != NULL &&
+	           knot_edns_opt_get_length(opt) == sizeof(uint16_t)) {
+		uint16_t timeout = knot_wire_read_u16(knot_edns_opt_get_data(opt));
+		is_int(expected, timeout, "ns: keepalive timeout %d advertised", expected);
+	} else {
+		ok(false, "ns: keepalive timeout %d advertised", expected);
+	}
+
+	knot_pkt_free(parsed);
+	knot_pkt_free(answer);
+	knot_pkt_free(query);
+	knot_pkt_free(built);
+}
+
+/* Answer query by the fast path, compare with the layer answer. */
+static void exec_fast(knot_layer_t *layer, knotd_qdata_params_t *params,
+                      const char *name, const knot_pkt_t *built,
+                      knot_pkt_t *query, knot_pkt_t *answer, bool expected)
+{
+	uint8_t wire[KNOT_WIRE_MAX_PKTSIZE], out[KNOT_WIRE_MAX_PKTSIZE];
+	memcpy(wire, built->wire, built->size);
+	knot_pkt_reset(query, wire, built->size);
+	knot_pkt_reset(answer, out, sizeof(out));
+
+	int ret = process_query_fast(query, answer, params, layer->mm);
+	if (!expected) {
+		ok(ret == KNOT_ENOTSUP && memcmp(wire, built->wire, built->size) == 0,
+		   "ns: %s query not answered directly", name);
+		return;
+	}
+	is_int(KNOT_EOK, ret, "ns: %s query answered directly", name);
+
+	/* Reference answer. */
+	memcpy(wire, built->wire, built->size);
+	knot_pkt_t *ref_query = knot_pkt_new(wire, built->size, NULL);
+	knot_pkt_t *ref = knot_pkt_new(NULL, KNOT_WIRE_MAX_PKTSIZE, NULL);
+	knot_layer_begin(layer, params);
+	knot_pkt_parse(ref_query, 0);
+	knot_layer_consume(layer, ref_query);
+	while (layer->state == KNOT_STATE_PRODUCE || layer->state == KNOT_STATE_FAIL) {
+		knot_layer_produce(layer, ref);
+	}
+	ok(ref->size > 0 && ref->size == answer->size &&
+	   memcmp(ref->wire, out, ref->size) == 0, "ns: %s answer match", name);
+	knot_layer_finish(layer);
+
+	knot_pkt_free(ref);
+	knot_pkt_free(ref_query);
+}
+
+static void test_fast(knot_layer_t *layer, knotd_qdata_params_t *params,
+                      zone_t *zone)
+{
+	/* Reused packets like in the UDP handler. */
+	uint8_t empty[KNOT_WIRE_HEADER_SIZE] = { 0 };
+	knot_pkt_t *query = knot_pkt_new(empty, sizeof(empty), NULL);
+	knot_pkt_t *answer = knot_pkt_new(empty, sizeof(empty), NULL);
+	knot_pkt_t *built = knot_pkt_new(NULL, KNOT_WIRE_MAX_PKTSIZE, NULL);
+
+	knot_pkt_put_question(built, ROOT_DNAME, KNOT_CLASS_IN, KNOT_RRTYPE_SOA);
+	exec_fast(layer, params, "fast/soa", built, query, answer, true);
+
+	knot_pkt_clear(built);
+	knot_pkt_put_question(built, (const uint8_t *)"\x03""Www", KNOT_CLASS_IN,
+	                      KNOT_RRTYPE_A);
+	exec_fast(layer, params, "fast/nxdomain", built, query, answer, true);
+
+	/* EDNS with NSID and DO. */
+	knot_rrset_t opt_rr;
+	knot_edns_init(&opt_rr, 1232, 0, KNOT_EDNS_VERSION, NULL);
+	knot_edns_set_do(&opt_rr);
+	knot_edns_add_option(&opt_rr, KNOT_EDNS_OPTION_NSID, 0, NULL, NULL);
+	knot_pkt_begin(built, KNOT_ADDITIONAL);
+	knot_pkt_put(built, KNOT_COMPR_HINT_NONE, &opt_rr, 0);
+	exec_fast(layer, params, "fast/edns", built, query, answer, true);
+
+	/* Bad EDNS version. */
+	knot_pkt_clear(built);
+	knot_pkt_put_question(built, ROOT_DNAME, KNOT_CLASS_IN, KNOT_RRTYPE_NS);
+	knot_edns_set_version(&opt_rr, 1);
+	knot_pkt_begin(built, KNOT_ADDITIONAL);
+	knot_pkt_put(built, KNOT_COMPR_HINT_NONE, &opt_rr, 0);
+	exec_fast(layer, params, "fast/badvers", built, query, answer, true);
+	knot_rrset_clear(&opt_rr, NULL);
+
+	/* Other queries are left to the layer. */
+	knot_pkt_clear(built);
+	knot_pkt_put_question(built, IDSERVER_DNAME, KNOT_CLASS_CH, KNOT_RRTYPE_TXT);
+	exec_fast(layer, params, "fast/chaos", built, query, answer, false);
+
+	knot_pkt_clear(built);
+	knot_pkt_put_question(built, ROOT_DNAME, KNOT_CLASS_IN, KNOT_RRTYPE_AXFR);
+	exec_fast(layer, params, "fast/axfr", built, query, answer, false);
+
+	knot_pkt_clear(built);
+	knot_pkt_put_question(built, ROOT_DNAME, KNOT_CLASS_IN, KNOT_RRTYPE_SOA);
+	knot_rrset_t soa_rr = node_rrset(zone->contents->apex, KNOT_RRTYPE_SOA);
+	knot_pkt_begin(built, KNOT_AUTHORITY);
+	knot_pkt_put(built, KNOT_COMPR_HINT_NONE, &soa_rr, 0);
+	exec_fast(layer, params, "fast/authority", built, query, answer, false);
+
+	knot_pkt_clear(built);
+	knot_pkt_put_question(built, ROOT_DNAME, KNOT_CLASS_IN, KNOT_RRTYPE_SOA);
+	built->wire[built->size++] = 0;
+	exec_fast(layer, params, "fast/trail-garbage", built, query, answer, false);
+
+	/* Zone with query modules, the QNAME case is kept. */
+	knot_pkt_clear(built);
+	knot_pkt_put_question(built, (const uint8_t *)"\x03""Www", KNOT_CLASS_IN,
+	                      KNOT_RRTYPE_A);
+	zone->query_plan = query_plan_create();
+	exec_fast(layer, params, "fast/zone-modules", built, query, answer, false);
+	query_plan_free(zone->query_plan);
+	zone->query_plan = NULL;
+
+	knot_pkt_free(built);
+	knot_pkt_free(answer);
+	knot_pkt_free(query);
+}
+
 /* \internal Helpers */
 #define WIRE_COPY(dst, dst_len, src, src_len) \
 	memcpy(dst, src, src_len); \
@@ -156,6 +312,22 @@ int main(int argc, char *argv[])
 	knot_pkt_put(query, KNOT_COMPR_HINT_NONE, &soa_rr, 0);
 	exec_query(&proc, "IN/ixfr", query, KNOT_RCODE_NOTAUTH);
 
+	/* EDNS TCP keepalive, including the zero timeout. */
+	params.flags = KNOTD_QUERY_FLAG_KEEPALIVE;
+	params.keepalive = 42;
+	exec_keepalive(&proc, 0, 42);
+	params.keepalive = 0;
+	exec_keepalive(&proc, 0, 0);
+	exec_keepalive(&proc, 100, -1);
+	params.flags = 0;
+
+	/* Fast path for plain queries. */
+	knot_layer_finish(&proc);
+	params.flags = KNOTD_QUERY_FLAG_LIMIT_SIZE;
+	test_fast(&proc, &params, zone);
+	params.flags = 0;
+	knot_layer_begin(&proc, &params);
+
 	/* \note Tests below are not possible without proper zone and zone data. */
 	/* #189 Process UPDATE query. */
 	/* #189 Process AXFR client. */
@@ -0,0 +1,197 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test_server.h"
+#include "knot/nameserver/process_query.h"
+#include "knot/nameserver/query_prefetch.h"
+#include "contrib/ucw/mempool.h"
+
+#define ANSWER_SIZE 1232
+
+typedef struct {
+	uint8_t wire[KNOT_WIRE_MIN_PKTSIZE];
+	struct iovec iov;
+} query_t;
+
+/* Fill the root zone with A records of names n0., n1., ... */
+static inline int fill_zone(server_t *server, unsigned names)
+{
+	zone_t *zone = knot_zonedb_find(server->zone_db, ROOT_DNAME);
+	uint8_t addr[4] = { 192, 0, 2, 0 };
+
+	for (unsigned i = 0; i < names; i++) {
+		char name[16];
+		(void)snprintf(name, sizeof(name), "n%u.", i);
+		knot_dname_storage_t owner;
+		knot_dname_from_str(owner, name, sizeof(owner));
+
+		knot_rrset_t *rr = knot_rrset_new(owner, KNOT_RRTYPE_A, KNOT_CLASS_IN,
+		                                  3600, NULL);
+		addr[3] = i;
+		knot_rrset_add_rdata(rr, addr, sizeof(addr), NULL);
+		zone_node_t *node = NULL;
+		int ret = zone_contents_add_rr(zone->contents, rr, &node);
+		knot_rrset_free(rr, NULL);
+		if (ret != KNOT_EOK) {
+			return ret;
+		}
+	}
+
+	return zone_adjust_full(zone->contents);
+}
+
+/* Create queries for random names, some of them nonexistent. */
+static inline void make_queries(query_t *queries, unsigned count, unsigned names)
+{
+	for (unsigned i = 0; i < count; i++) {
+		char name[16];
+		(void)snprintf(name, sizeof(name), "N%u.", (unsigned)random() % (names + names / 8));
+		knot_dname_storage_t qname;
+		knot_dname_from_str(qname, name, sizeof(qname));
+
+		knot_pkt_t *pkt = knot_pkt_new(NULL, sizeof(queries[i].wire), NULL);
+		knot_wire_set_id(pkt->wire, i);
+		knot_pkt_put_question(pkt, qname, KNOT_CLASS_IN, KNOT_RRTYPE_A);
+		memcpy(queries[i].wire, pkt->wire, pkt->size);
+		queries[i].iov.iov_base = queries[i].wire;
+		queries[i].iov.iov_len = pkt->size;
+		knot_pkt_free(pkt);
+	}
+}
+
+/* Answer a query like the UDP handler does. */
+static inline size_t answer(knot_layer_t *layer, knotd_qdata_params_t *params,
+                            const struct iovec *rx, uint8_t *out)
+{
+	knot_layer_begin(layer, params);
+
+	knot_pkt_t *query = knot_pkt_new(rx->iov_base, rx->iov_len, layer->mm);
+	knot_pkt_t *ans = knot_pkt_new(out, ANSWER_SIZE, layer->mm);
+
+	(void)knot_pkt_parse(query, 0);
+	knot_layer_consume(layer, query);
+	while (layer->state == KNOT_STATE_PRODUCE || layer->state == KNOT_STATE_FAIL) {
+		knot_layer_produce(layer, ans);
+	}
+	size_t size = (layer->state == KNOT_STATE_DONE) ? ans->size : 0;
+
+	knot_layer_finish(layer);
+	mp_flush(layer->mm->ctx);
+
+	return size;
+}
+
+/* Answer all queries, optionally with staged prefetching. */
+static inline void answer_all(knot_layer_t *layer, knotd_qdata_params_t *params,
+                              query_t *queries, unsigned count, bool staged,
+                              uint8_t *answers, size_t *sizes)
+{
+	struct iovec batch[QUERY_PREFETCH_BATCH];
+	query_prefetch_t prefetch[QUERY_PREFETCH_BATCH];
+	uint8_t out[ANSWER_SIZE];
+
+	params->prefetch = NULL;
+
+	for (unsigned i = 0; i < count; i++) {
+		unsigned slot = i % QUERY_PREFETCH_BATCH;
+		if (staged && slot == 0) {
+			unsigned n = MIN(count - i, QUERY_PREFETCH_BATCH);
+			for (unsigned j = 0; j < n; j++) {
+				batch[j] = queries[i + j].iov;
+			}
+			query_prefetch(((server_t *)params->server)->zone_db, batch, n,
+			               prefetch);
+		}
+		if (staged) {
+			params->prefetch = &prefetch[slot];
+		}
+		uint8_t *dst = (answers != NULL) ? answers + i * ANSWER_SIZE : out;
+		size_t size = answer(layer, params, &queries[i].iov, dst);
+		if (sizes != NULL) {
+			sizes[i] = size;
+		}
+	}
+
+	params->prefetch = NULL;
+}
+
+#define CNAME_CHAIN 8
+
+/* Add a chain of CNAMEs c0. -> c1. -> ... -> n0. to the root zone. */
+static inline int fill_cnames(server_t *server)
+{
+	zone_t *zone = knot_zonedb_find(server->zone_db, ROOT_DNAME);
+
+	for (unsigned i = 0; i < CNAME_CHAIN; i++) {
+		char name[16], target[16];
+		(void)snprintf(name, sizeof(name), "c%u.", i);
+		(void)snprintf(target, sizeof(target), (i + 1 < CNAME_CHAIN) ? "c%u." : "n0.", i + 1);
+		knot_dname_storage_t owner, rdata;
+		knot_dname_from_str(owner, name, sizeof(owner));
+		knot_dname_from_str(rdata, target, sizeof(rdata));
+
+		knot_rrset_t *rr = knot_rrset_new(owner, KNOT_RRTYPE_CNAME, KNOT_CLASS_IN,
+		                                  3600, NULL);
+		knot_rrset_add_rdata(rr, rdata, knot_dname_size(rdata), NULL);
+		zone_node_t *node = NULL;
+		int ret = zone_contents_add_rr(zone->contents, rr, &node);
+		knot_rrset_free(rr, NULL);
+		if (ret != KNOT_EOK) {
+			return ret;
+		}
+	}
+
+	return zone_adjust_full(zone->contents);
+}
+
+/* Unlink or restore the CNAME targets in the chain. */
+static inline void link_cnames(server_t *server, additional_t **saved, bool link)
+{
+	zone_t *zone = knot_zonedb_find(server->zone_db, ROOT_DNAME);
+
+	for (unsigned i = 0; i < CNAME_CHAIN; i++) {
+		char name[16];
+		(void)snprintf(name, sizeof(name), "c%u.", i);
+		knot_dname_storage_t owner;
+		knot_dname_from_str(owner, name, sizeof(owner));
+		zone_node_t *node = (zone_node_t *)zone_contents_find_node(zone->contents, owner);
+		struct rr_data *cname = &node->rrs[0];
+		if (link) {
+			cname->additional = saved[i];
+		} else {
+			saved[i] = cname->additional;
+			cname->additional = NULL;
+		}
+	}
+}
+
+/* Create a query for the start of the CNAME chain, keep a copy of its wire. */
+static inline void make_cname_query(query_t *query, uint8_t *wire)
+{
+	knot_pkt_t *pkt = knot_pkt_new(NULL, KNOT_WIRE_MIN_PKTSIZE, NULL);
+	knot_pkt_put_question(pkt, (const uint8_t *)"\x02""c0", KNOT_CLASS_IN,
+	                      KNOT_RRTYPE_A);
+	memcpy(wire, pkt->wire, pkt->size);
+	query->iov.iov_base = query->wire;
+	query->iov.iov_len = pkt->size;
+	knot_pkt_free(pkt);
+}
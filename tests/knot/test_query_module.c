@@ -19,8 +19,10 @@
 #include <stdlib.h>
 
 #include "libknot/libknot.h"
+#include "knot/nameserver/process_query.h"
 #include "knot/nameserver/query_module.h"
 #include "libknot/packet/pkt.h"
+#include "contrib/ucw/mempool.h"
 
 /* Universal processing stage. */
 unsigned state_visit(unsigned state, knot_pkt_t *pkt, knotd_qdata_t *qdata,
@@ -33,6 +35,97 @@ unsigned state_visit(unsigned state, knot_pkt_t *pkt, knotd_qdata_t *qdata,
 	return state + 1;
 }
 
+/* Batch hook recording the calls. */
+typedef struct {
+	unsigned calls;
+	unsigned queries;
+	bool copied;
+} batch_visit_t;
+
+static knotd_qdata_t *batch_orig;
+
+static void batch_visit(const knotd_batch_query_t *queries, unsigned count,
+                        knotd_mod_t *mod)
+{
+	batch_visit_t *visit = mod->ctx;
+	visit->calls++;
+	visit->queries += count;
+	for (unsigned i = 0; i < count; i++) {
+		visit->copied = visit->copied && queries[i].qdata != batch_orig &&
+		                queries[i].qdata->rcode == KNOT_RCODE_NXDOMAIN &&
+		                queries[i].qdata->params->thread_id == 7 &&
+		                queries[i].state == KNOTD_STATE_DONE;
+	}
+}
+
+static void test_batch(void)
+{
+	knot_mm_t mm;
+	mm_ctx_mempool(&mm, MM_DEFAULT_BLKSIZE);
+
+	/* Global and zone plans with batch hooks. */
+	batch_visit_t global_visit = { .copied = true }, zone_visit = { .copied = true };
+	struct query_plan *global = query_plan_create();
+	struct query_plan *zone = query_plan_create();
+	knotd_mod_t global_mod = { .plan = global, .ctx = &global_visit };
+	knotd_mod_t zone_mod = { .plan = zone, .ctx = &zone_visit };
+	int ret = knotd_mod_batch_hook(&global_mod, batch_visit);
+	is_int(KNOT_EOK, ret, "query_batch: register global hook");
+	ret = knotd_mod_batch_hook(&zone_mod, batch_visit);
+	is_int(KNOT_EOK, ret, "query_batch: register zone hook");
+
+	/* Direct call for a query not batched. */
+	knotd_qdata_params_t params = { .thread_id = 7 };
+	knotd_qdata_extra_t extra = { 0 };
+	knotd_qdata_t qdata = {
+		.params = &params,
+		.extra = &extra,
+		.rcode = KNOT_RCODE_NXDOMAIN
+	};
+	knot_pkt_t *pkt = knot_pkt_new(NULL, KNOT_WIRE_MIN_PKTSIZE, &mm);
+	knotd_batch_query_t query = { KNOTD_STATE_DONE, pkt, &qdata };
+	query_plan_batch(global, &query, 1);
+	ok(global_visit.calls == 1 && global_visit.queries == 1,
+	   "query_batch: direct call");
+
+	/* Queued queries, the queue for 3 queries is flushed when full. */
+	query_batch_t batch;
+	ret = query_batch_init(&batch, 3, &mm);
+	is_int(KNOT_EOK, ret, "query_batch: init");
+	batch_orig = &qdata;
+	global_visit = (batch_visit_t) { .copied = true };
+	for (unsigned i = 0; i < 5; i++) {
+		params.thread_id = 7;
+		qdata.rcode = KNOT_RCODE_NXDOMAIN;
+		ret = query_batch_add(&batch, KNOTD_STATE_DONE, pkt, &qdata, global,
+		                      (i % 2 == 0) ? zone : NULL);
+		if (ret != KNOT_EOK) {
+			break;
+		}
+		/* Reused for the next query. */
+		params.thread_id = 0;
+		qdata.rcode = KNOT_RCODE_NOERROR;
+	}
+	is_int(KNOT_EOK, ret, "query_batch: add queries");
+	ok(global_visit.calls == 1 && global_visit.queries == 3 &&
+	   zone_visit.calls == 1 && zone_visit.queries == 2,
+	   "query_batch: flushed when full");
+	ok(batch.count == 2, "query_batch: queued queries");
+	query_batch_flush(&batch);
+	ok(global_visit.calls == 2 && global_visit.queries == 5 &&
+	   zone_visit.calls == 2 && zone_visit.queries == 3 && batch.count == 0,
+	   "query_batch: flushed by plan");
+	ok(global_visit.copied && zone_visit.copied, "query_batch: query data");
+
+	query_batch_flush(&batch);
+	ok(global_visit.calls == 2, "query_batch: empty flush");
+
+	query_batch_deinit(&batch);
+	query_plan_free(global);
+	query_plan_free(zone);
+	mp_delete(mm.ctx);
+}
+
 int main(int argc, char *argv[])
 {
 	plan_lazy();
@@ -83,5 +176,7 @@ fatal:
 	/* Free the query plan. */
 	query_plan_free(plan);
 
+	test_batch();
+
 	return 0;
 }
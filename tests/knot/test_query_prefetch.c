@@ -0,0 +1,160 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <tap/basic.h>
+
+#include "test_query.h"
+#include "contrib/sockaddr.h"
+
+#define NAMES   10000
+#define QUERIES 1000
+
+static void test_cname_chain(knot_layer_t *layer, knotd_qdata_params_t *params)
+{
+	server_t *server = (server_t *)params->server;
+	int ret = fill_cnames(server);
+	is_int(KNOT_EOK, ret, "cname: create chain of %u CNAMEs", CNAME_CHAIN);
+
+	query_t query;
+	uint8_t wire[KNOT_WIRE_MIN_PKTSIZE];
+	make_cname_query(&query, wire);
+
+	// Linked targets must not change the answer.
+	additional_t *saved[CNAME_CHAIN];
+	uint8_t linked[ANSWER_SIZE], unlinked[ANSWER_SIZE];
+	memcpy(query.wire, wire, query.iov.iov_len);
+	size_t linked_size = answer(layer, params, &query.iov, linked);
+	link_cnames(server, saved, false);
+	memcpy(query.wire, wire, query.iov.iov_len);
+	size_t unlinked_size = answer(layer, params, &query.iov, unlinked);
+	link_cnames(server, saved, true);
+	ok(linked_size > 0 && linked_size == unlinked_size &&
+	   knot_wire_get_ancount(linked) == CNAME_CHAIN + 1 &&
+	   memcmp(linked, unlinked, linked_size) == 0, "cname: same answers");
+
+	bool all_linked = true;
+	for (unsigned i = 0; i < CNAME_CHAIN; i++) {
+		all_linked = all_linked && saved[i] != NULL;
+	}
+	ok(all_linked, "cname: targets linked");
+}
+
+static void test_lookup(server_t *server)
+{
+	uint8_t compressed[] = {
+		0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, /* Header. */
+		0xc0, 0x0c, 0, 1, 0, 1              /* Compressed QNAME. */
+	};
+	uint8_t response[] = {
+		0, 1, 0x80, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+		1, 'n', 0, 0, 1, 0, 1
+	};
+	uint8_t short_qtype[] = {
+		0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+		2, 'n', '1', 0, 0
+	};
+	struct iovec batch[] = {
+		{ compressed, sizeof(compressed) },
+		{ response, sizeof(response) },
+		{ short_qtype, sizeof(short_qtype) },
+		{ compressed, 5 },
+	};
+
+	query_prefetch_t out[sizeof(batch) / sizeof(*batch)];
+	query_prefetch(server->zone_db, batch, sizeof(batch) / sizeof(*batch), out);
+	bool skipped = true;
+	for (unsigned i = 0; i < sizeof(batch) / sizeof(*batch); i++) {
+		skipped = skipped && out[i].zone == NULL;
+	}
+	ok(skipped, "prefetch: malformed queries skipped");
+
+	// A valid query is looked up.
+	uint8_t valid[] = {
+		0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+		2, 'N', '1', 0, 0, 1, 0, 1
+	};
+	struct iovec single = { valid, sizeof(valid) };
+	query_prefetch(server->zone_db, &single, 1, out);
+	ok(out[0].zone != NULL && out[0].found == ZONE_NAME_FOUND &&
+	   out[0].node != NULL && out[0].qtype == KNOT_RRTYPE_A &&
+	   knot_dname_is_equal(out[0].qname, (const uint8_t *)"\x02n1"),
+	   "prefetch: query looked up");
+}
+
+int main(void)
+{
+	plan_lazy();
+
+	unsigned names = NAMES;
+	unsigned check = QUERIES;
+
+	knot_mm_t mm;
+	mm_ctx_mempool(&mm, MM_DEFAULT_BLKSIZE);
+	knot_layer_t layer;
+	knot_layer_init(&layer, &mm, process_query_layer());
+
+	server_t server;
+	int ret = create_fake_server(&server, &mm);
+	is_int(KNOT_EOK, ret, "create server");
+	if (ret != KNOT_EOK) {
+		goto fatal;
+	}
+	ret = fill_zone(&server, names);
+	is_int(KNOT_EOK, ret, "create zone with %u names", names);
+
+	struct sockaddr_storage ss;
+	sockaddr_set(&ss, AF_INET, "127.0.0.1", 53);
+	knotd_qdata_params_t params = {
+		.remote = &ss,
+		.flags = KNOTD_QUERY_FLAG_LIMIT_SIZE,
+		.server = &server
+	};
+
+	test_lookup(&server);
+
+	query_t *queries = malloc(check * sizeof(*queries));
+	uint8_t *answers = malloc(2 * check * ANSWER_SIZE);
+	size_t *sizes = malloc(2 * check * sizeof(*sizes));
+
+	// Staged processing must not change the answers. The QNAME case is
+	// changed during processing, so the queries are recreated.
+	srandom(1);
+	make_queries(queries, check, names);
+	answer_all(&layer, &params, queries, check, false, answers, sizes);
+	srandom(1);
+	make_queries(queries, check, names);
+	answer_all(&layer, &params, queries, check, true,
+	           answers + check * ANSWER_SIZE, sizes + check);
+	bool same = true;
+	for (unsigned i = 0; i < check; i++) {
+		same = same && sizes[i] > 0 && sizes[i] == sizes[check + i] &&
+		       memcmp(answers + i * ANSWER_SIZE,
+		              answers + (check + i) * ANSWER_SIZE, sizes[i]) == 0;
+	}
+	ok(same, "prefetch: same answers");
+
+	test_cname_chain(&layer, &params);
+
+	free(queries);
+	free(answers);
+	free(sizes);
+fatal:
+	mp_delete(mm.ctx);
+	server_deinit(&server);
+	conf_free(conf());
+
+	return 0;
+}
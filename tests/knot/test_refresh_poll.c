@@ -0,0 +1,252 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <assert.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <tap/basic.h>
+
+#include "test_conf.h"
+#include "knot/events/refresh_poll.h"
+#include "knot/server/server.h"
+#include "libknot/libknot.h"
+#include "contrib/net.h"
+#include "contrib/sockaddr.h"
+
+#define TIMEOUT 300
+
+/*! \brief Remote answering SOA queries over TCP. */
+typedef struct {
+	int fd;
+	struct sockaddr_storage addr;
+	pthread_t thread;
+	int rcode;         /*!< Response code. */
+	uint32_t serial;   /*!< Serial in the answer. */
+	int queries;       /*!< Number of served queries (output). */
+} remote_t;
+
+static void answer(remote_t *remote, int client)
+{
+	uint8_t buf[KNOT_WIRE_MAX_PKTSIZE];
+	int len = net_dns_tcp_recv(client, buf, sizeof(buf), 10 * TIMEOUT);
+	if (len < KNOT_WIRE_HEADER_SIZE) {
+		return;
+	}
+	remote->queries++;
+
+	knot_pkt_t *query = knot_pkt_new(buf, len, NULL);
+	knot_pkt_t *resp = knot_pkt_new(NULL, KNOT_WIRE_MAX_PKTSIZE, NULL);
+	if (knot_pkt_parse(query, 0) == KNOT_EOK &&
+	    knot_pkt_init_response(resp, query) == KNOT_EOK) {
+		knot_wire_set_rcode(resp->wire, remote->rcode);
+		if (remote->rcode == KNOT_RCODE_NOERROR) {
+			uint8_t rdata[2 + 5 * sizeof(uint32_t)] = { 0 };
+			knot_wire_write_u32(rdata + 2, remote->serial);
+			knot_rrset_t *soa = knot_rrset_new(knot_pkt_qname(query),
+			                                   KNOT_RRTYPE_SOA,
+			                                   KNOT_CLASS_IN, 3600, NULL);
+			knot_rrset_add_rdata(soa, rdata, sizeof(rdata), NULL);
+			knot_pkt_begin(resp, KNOT_ANSWER);
+			knot_pkt_put(resp, 0, soa, KNOT_PF_FREE);
+		}
+		net_dns_tcp_send(client, resp->wire, resp->size, 10 * TIMEOUT);
+	}
+	knot_pkt_free(query);
+	knot_pkt_free(resp);
+}
+
+static void *remote_thread(void *arg)
+{
+	remote_t *remote = arg;
+
+	while (true) {
+		struct pollfd pfd = { .fd = remote->fd, .events = POLLIN };
+		if (poll(&pfd, 1, 10 * TIMEOUT) != 1) {
+			return NULL;
+		}
+		int client = accept(remote->fd, NULL, NULL);
+		if (client < 0) {
+			return NULL;
+		}
+		answer(remote, client);
+		close(client);
+	}
+}
+
+/*!
+ * \brief Start a local remote.
+ *
+ * \param listening  Accept connections, otherwise refuse them.
+ * \param answering  Serve the queries, otherwise never answer.
+ */
+static void remote_start(remote_t *remote, bool listening, bool answering)
+{
+	sockaddr_set(&remote->addr, AF_INET, "127.0.0.1", 0);
+	remote->fd = net_bound_socket(SOCK_STREAM, &remote->addr, 0);
+	assert(remote->fd >= 0);
+	socklen_t addr_len = sockaddr_len(&remote->addr);
+	int ret = getsockname(remote->fd, (struct sockaddr *)&remote->addr, &addr_len);
+	assert(ret == 0);
+	(void)ret;
+
+	remote->queries = 0;
+	remote->thread = 0;
+	if (listening) {
+		listen(remote->fd, 10);
+	}
+	if (answering) {
+		pthread_create(&remote->thread, NULL, remote_thread, remote);
+	}
+}
+
+static void remote_stop(remote_t *remote)
+{
+	shutdown(remote->fd, SHUT_RDWR);
+	if (remote->thread != 0) {
+		pthread_join(remote->thread, NULL);
+	}
+	close(remote->fd);
+}
+
+static int make_conf(remote_t *remotes, size_t count, bool race)
+{
+	char conf_str[1024];
+	int len = snprintf(conf_str, sizeof(conf_str),
+	                   "server:\n"
+	                   "  tcp-remote-io-timeout: %d\n"
+	                   "remote:\n", TIMEOUT);
+	for (size_t i = 0; i < count; i++) {
+		len += snprintf(conf_str + len, sizeof(conf_str) - len,
+		                "  - id: r%zu\n"
+		                "    address: 127.0.0.1@%d\n",
+		                i, sockaddr_port(&remotes[i].addr));
+	}
+	len += snprintf(conf_str + len, sizeof(conf_str) - len,
+	                "zone:\n"
+	                "  - domain: example.\n"
+	                "    master: [");
+	for (size_t i = 0; i < count; i++) {
+		len += snprintf(conf_str + len, sizeof(conf_str) - len,
+		                "%sr%zu", (i > 0 ? ", " : ""), i);
+	}
+	(void)snprintf(conf_str + len, sizeof(conf_str) - len,
+	               "]\n"
+	               "    master-race: %s\n", race ? "on" : "off");
+
+	return test_conf(conf_str, NULL);
+}
+
+static bool wait_result(refresh_poll_t *poll, const knot_dname_t *zone,
+                        refresh_poll_result_t *result)
+{
+	for (int i = 0; i < 100; i++) {
+		if (refresh_poll_take(poll, zone, result)) {
+			return true;
+		}
+		usleep(TIMEOUT * 1000 / 10);
+	}
+
+	return false;
+}
+
+static void test_poll(refresh_poll_t *poll, zone_t *zone)
+{
+	refresh_poll_result_t result;
+	remote_t remotes[3];
+
+	// Race, the highest serial wins, the silent master is cut.
+	remote_start(&remotes[0], true, true);
+	remote_start(&remotes[1], true, false);
+	remote_start(&remotes[2], true, true);
+	remotes[0].rcode = remotes[2].rcode = KNOT_RCODE_NOERROR;
+	remotes[0].serial = 5;
+	remotes[2].serial = 7;
+	int ret = make_conf(remotes, 3, true);
+	assert(ret == KNOT_EOK);
+	ret = refresh_poll_submit(poll, conf(), zone);
+	is_int(KNOT_EOK, ret, "race: submit");
+	ok(wait_result(poll, zone->name, &result) && result.ret == KNOT_EOK &&
+	   result.serial == 7 && sockaddr_cmp(&result.remote, &remotes[2].addr) == 0,
+	   "race: highest serial wins");
+	for (int i = 0; i < 3; i++) {
+		remote_stop(&remotes[i]);
+	}
+	conf_update(NULL, CONF_UPD_FNONE);
+
+	// Race without any answer, then one by one.
+	remote_start(&remotes[0], true, false);
+	remote_start(&remotes[1], false, false);
+	remote_start(&remotes[2], true, true);
+	remotes[2].rcode = KNOT_RCODE_REFUSED;
+	ret = make_conf(remotes, 3, true);
+	assert(ret == KNOT_EOK);
+	ret = refresh_poll_submit(poll, conf(), zone);
+	is_int(KNOT_EOK, ret, "race failed: submit");
+	ok(wait_result(poll, zone->name, &result) && result.ret == KNOT_ENOMASTER,
+	   "race failed: no master");
+	for (int i = 0; i < 3; i++) {
+		remote_stop(&remotes[i]);
+	}
+	is_int(2, remotes[2].queries, "race failed: queried one by one");
+	conf_update(NULL, CONF_UPD_FNONE);
+
+	// One by one, the outdated master is skipped.
+	remote_start(&remotes[0], true, true);
+	remote_start(&remotes[1], true, true);
+	remote_start(&remotes[2], true, true);
+	remotes[0].rcode = remotes[1].rcode = remotes[2].rcode = KNOT_RCODE_NOERROR;
+	remotes[0].serial = 0x90000000; // lower than 0 of the empty zone
+	remotes[1].serial = 3;
+	remotes[2].serial = 4;
+	ret = make_conf(remotes, 3, false);
+	assert(ret == KNOT_EOK);
+	ret = refresh_poll_submit(poll, conf(), zone);
+	is_int(KNOT_EOK, ret, "one by one: submit");
+	ok(wait_result(poll, zone->name, &result) && result.ret == KNOT_EOK &&
+	   result.serial == 3 && sockaddr_cmp(&result.remote, &remotes[1].addr) == 0,
+	   "one by one: first usable master wins");
+	for (int i = 0; i < 3; i++) {
+		remote_stop(&remotes[i]);
+	}
+	ok(remotes[0].queries == 1 && remotes[2].queries == 0,
+	   "one by one: the next master not queried");
+	conf_update(NULL, CONF_UPD_FNONE);
+}
+
+int main(int argc, char *argv[])
+{
+	plan_lazy();
+
+	server_t server = { 0 };
+	refresh_poll_t *poll = refresh_poll_init(&server);
+	ok(poll != NULL, "create SOA poller");
+
+	knot_dname_t *name = knot_dname_from_str_alloc("example.");
+	zone_t *zone = zone_new(name);
+
+	refresh_poll_result_t result;
+	ok(!refresh_poll_take(poll, name, &result), "no result for unknown zone");
+
+	test_poll(poll, zone);
+
+	refresh_poll_deinit(poll);
+	zone_free(&zone);
+	knot_dname_free(name, NULL);
+
+	return 0;
+}
@@ -0,0 +1,87 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <tap/basic.h>
+#include <time.h>
+
+#include "knot/events/refresh_sched.h"
+#include "libknot/errcode.h"
+#include "contrib/sockaddr.h"
+
+static const knot_dname_t *zone1 = (const knot_dname_t *)"\x01""a""\x04""test";
+static const knot_dname_t *zone2 = (const knot_dname_t *)"\x01""b""\x04""test";
+static const knot_dname_t *zone3 = (const knot_dname_t *)"\x01""c""\x04""test";
+
+int main(int argc, char *argv[])
+{
+	plan_lazy();
+
+	struct sockaddr_storage rmt1, rmt2;
+	sockaddr_set(&rmt1, AF_INET, "192.0.2.1", 53);
+	sockaddr_set(&rmt2, AF_INET6, "2001:db8::1", 53);
+
+	// No scheduler, no limits.
+	is_int(KNOT_EOK, refresh_sched_acquire(NULL, zone1, &rmt1), "no sched: acquire");
+	refresh_sched_release(NULL, &rmt1);
+
+	refresh_sched_t *sched = refresh_sched_init();
+	ok(sched != NULL, "init");
+
+	// Per remote limit.
+	refresh_sched_set(sched, 3, 2, 0);
+	is_int(KNOT_EOK, refresh_sched_acquire(sched, zone1, &rmt1), "remote limit: first");
+	is_int(KNOT_EOK, refresh_sched_acquire(sched, zone2, &rmt1), "remote limit: second");
+	is_int(KNOT_EBUSY, refresh_sched_acquire(sched, zone3, &rmt1), "remote limit: reached");
+
+	// Global limit.
+	is_int(KNOT_EOK, refresh_sched_acquire(sched, zone3, &rmt2), "global limit: other remote");
+	is_int(KNOT_EBUSY, refresh_sched_acquire(sched, zone3, &rmt2), "global limit: reached");
+
+	// Deferred zones are in the backlog until admitted.
+	time_t now = time(NULL);
+	time_t urgent = refresh_sched_defer(sched, zone3, 0);
+	time_t relaxed = refresh_sched_defer(sched, zone2, now + 7 * 24 * 3600);
+	ok(urgent > now && urgent <= now + 2, "defer: urgent zone retried soon");
+	ok(relaxed > urgent, "defer: zone far from expiration retried later");
+
+	refresh_sched_stats_t stats;
+	refresh_sched_stats(sched, &stats);
+	ok(stats.running == 3 && stats.backlog == 2 && stats.started == 3 &&
+	   stats.deferred == 2, "stats: running and backlog");
+
+	refresh_sched_release(sched, &rmt1);
+	is_int(KNOT_EOK, refresh_sched_acquire(sched, zone3, &rmt1), "release: slot reused");
+	refresh_sched_stats(sched, &stats);
+	ok(stats.running == 3 && stats.backlog == 1 && stats.rate > 0,
+	   "stats: admitted zone left backlog");
+
+	refresh_sched_release(sched, &rmt1);
+	refresh_sched_release(sched, &rmt1);
+	refresh_sched_release(sched, &rmt2);
+	refresh_sched_stats(sched, &stats);
+	is_int(0, stats.running, "release: all finished");
+
+	// Overdue refreshes are spread, planned ones untouched.
+	ok(refresh_sched_spread(sched, now - 10) == now - 10, "spread: no jitter");
+	refresh_sched_set(sched, 0, 0, 100);
+	time_t spread = refresh_sched_spread(sched, now - 10);
+	ok(spread >= now && spread <= time(NULL) + 100, "spread: overdue refresh");
+	ok(refresh_sched_spread(sched, now + 1000) == now + 1000, "spread: future refresh");
+
+	refresh_sched_deinit(sched);
+
+	return 0;
+}
@@ -28,6 +28,7 @@
 #include "contrib/mempattern.h"
 #include "contrib/net.h"
 #include "contrib/sockaddr.h"
+#include "contrib/time.h"
 #include "contrib/ucw/mempool.h"
 
 /* @note Purpose of this test is not to verify process_answer functionality,
@@ -39,6 +40,9 @@ static int in(knot_layer_t *ctx, knot_pkt_t *pkt) { return KNOT_STATE_DONE; }
 static int out(knot_layer_t *ctx, knot_pkt_t *pkt) { return KNOT_STATE_CONSUME; }
 
 static const int TIMEOUT = 2000;
+static const int MANY_TIMEOUT = 500;
+static const int RACE_GRACE = 50;
+#define MANY 8
 
 /*! \brief Dummy answer processing module. */
 const knot_layer_api_t dummy_module = {
@@ -112,6 +116,217 @@ static void test_connected(knot_requestor_t *requestor,
 	knot_request_free(req, requestor->mm);
 }
 
+static void test_many(knot_mm_t *mm, const struct sockaddr_storage *dst,
+                      const struct sockaddr_storage *silent,
+                      const struct sockaddr_storage *src)
+{
+	knot_requestor_t requestors[MANY];
+	knot_request_slot_t slots[MANY];
+
+	/* The last request goes to a remote which never answers. */
+	for (int i = 0; i < MANY; i++) {
+		knot_requestor_init(&requestors[i], &dummy_module, NULL, mm);
+		slots[i].requestor = &requestors[i];
+		slots[i].request = make_query(&requestors[i],
+		                              (i < MANY - 1) ? dst : silent, src);
+	}
+
+	struct timespec begin = time_now();
+	int ret = knot_requestor_exec_many(slots, MANY, MANY_TIMEOUT);
+	struct timespec end = time_now();
+	is_int(KNOT_EOK, ret, "requestor: many/exec");
+
+	bool answered = true;
+	for (int i = 0; i < MANY - 1; i++) {
+		answered = answered && slots[i].ret == KNOT_EOK &&
+		           knot_wire_get_qr(slots[i].request->resp->wire);
+	}
+	ok(answered, "requestor: many/all answered");
+	is_int(KNOT_ETIMEOUT, slots[MANY - 1].ret, "requestor: many/silent timeout");
+	ok(time_diff_ms(&begin, &end) < 2 * MANY_TIMEOUT,
+	   "requestor: many/waited concurrently");
+
+	for (int i = 0; i < MANY; i++) {
+		knot_request_free(slots[i].request, mm);
+		knot_requestor_clear(&requestors[i]);
+	}
+}
+
+static void test_race(knot_mm_t *mm, const struct sockaddr_storage *dst,
+                      const struct sockaddr_storage *silent,
+                      const struct sockaddr_storage *src)
+{
+	knot_requestor_t requestors[2];
+	knot_request_slot_t slots[2];
+
+	/* The first request goes to a remote which never answers. */
+	for (int i = 0; i < 2; i++) {
+		knot_requestor_init(&requestors[i], &dummy_module, NULL, mm);
+		slots[i].requestor = &requestors[i];
+		slots[i].request = make_query(&requestors[i],
+		                              (i == 0) ? silent : dst, src);
+	}
+
+	struct timespec begin = time_now();
+	int ret = knot_requestor_exec_race(slots, 2, TIMEOUT, RACE_GRACE);
+	struct timespec end = time_now();
+	is_int(KNOT_EOK, ret, "requestor: race/exec");
+	is_int(KNOT_EOK, slots[1].ret, "requestor: race/answered");
+	is_int(KNOT_ETIMEOUT, slots[0].ret, "requestor: race/silent timeout");
+	ok(time_diff_ms(&begin, &end) < TIMEOUT / 2,
+	   "requestor: race/silent cut by grace period");
+
+	for (int i = 0; i < 2; i++) {
+		knot_request_free(slots[i].request, mm);
+		knot_requestor_clear(&requestors[i]);
+	}
+}
+
+static void test_loop(knot_mm_t *mm, const struct sockaddr_storage *dst,
+                      const struct sockaddr_storage *silent,
+                      const struct sockaddr_storage *src)
+{
+	knot_requestor_t requestors[2];
+	knot_request_slot_t slots[2];
+
+	/* The first request goes to a remote which never answers. */
+	for (int i = 0; i < 2; i++) {
+		knot_requestor_init(&requestors[i], &dummy_module, NULL, mm);
+		slots[i].requestor = &requestors[i];
+		slots[i].request = make_query(&requestors[i],
+		                              (i == 0) ? silent : dst, src);
+	}
+
+	knot_request_loop_t *loop = knot_request_loop_new();
+	ok(loop != NULL, "requestor: loop/create");
+
+	/* Requests are added one by one, the silent one first. */
+	int ret = knot_request_loop_add(loop, &slots[0], TIMEOUT);
+	is_int(KNOT_EOK, ret, "requestor: loop/add");
+	ok(knot_request_loop_next(loop, 0) == NULL, "requestor: loop/nothing finished");
+	ret = knot_request_loop_add(loop, &slots[1], TIMEOUT);
+	is_int(2, knot_request_loop_pending(loop), "requestor: loop/pending");
+
+	knot_request_slot_t *done = knot_request_loop_next(loop, -1);
+	ok(done == &slots[1] && done->ret == KNOT_EOK, "requestor: loop/answered");
+
+	struct timespec begin = time_now();
+	ret = knot_request_loop_expire(loop, &slots[0], RACE_GRACE);
+	done = knot_request_loop_next(loop, -1);
+	struct timespec end = time_now();
+	ok(ret == KNOT_EOK && done == &slots[0] && done->ret == KNOT_ETIMEOUT &&
+	   time_diff_ms(&begin, &end) < TIMEOUT / 2,
+	   "requestor: loop/silent expired");
+	ok(knot_request_loop_pending(loop) == 0 &&
+	   knot_request_loop_next(loop, -1) == NULL, "requestor: loop/empty");
+
+	knot_request_loop_free(loop);
+	for (int i = 0; i < 2; i++) {
+		knot_request_free(slots[i].request, mm);
+		knot_requestor_clear(&requestors[i]);
+	}
+}
+
+/*! \brief Remote answering pipelined queries in the reverse order. */
+typedef struct {
+	int fd;
+	int conns;  /*!< Number of accepted connections. */
+} pipe_remote_t;
+
+static void *pipe_responder_thread(void *arg)
+{
+	pipe_remote_t *remote = arg;
+
+	uint8_t buf[MANY][KNOT_WIRE_MAX_PKTSIZE];
+	int len[MANY];
+	while (true) {
+		int client = accept(remote->fd, NULL, NULL);
+		if (client < 0) {
+			break;
+		}
+		remote->conns++;
+		for (int i = 0; i < MANY; i++) {
+			len[i] = net_dns_tcp_recv(client, buf[i], sizeof(buf[i]), TIMEOUT);
+			if (len[i] < KNOT_WIRE_HEADER_SIZE) {
+				len[i] = 0;
+			}
+		}
+		for (int i = MANY - 1; i >= 0; i--) {
+			if (len[i] > 0) {
+				knot_wire_set_qr(buf[i]);
+				net_dns_tcp_send(client, buf[i], len[i], TIMEOUT);
+			}
+		}
+		uint8_t rest;
+		(void)recv(client, &rest, sizeof(rest), 0); // Until closed.
+		close(client);
+	}
+
+	return NULL;
+}
+
+static void test_pipeline(knot_mm_t *mm, const struct sockaddr_storage *silent,
+                          const struct sockaddr_storage *src)
+{
+	pipe_remote_t remote = { 0 };
+	struct sockaddr_storage dst = { 0 };
+	sockaddr_set(&dst, AF_INET, "127.0.0.1", 0);
+	remote.fd = net_bound_socket(SOCK_STREAM, &dst, 0);
+	assert(remote.fd >= 0);
+	socklen_t addr_len = sockaddr_len(&dst);
+	int ret = getsockname(remote.fd, (struct sockaddr *)&dst, &addr_len);
+	assert(ret == 0);
+	ret = listen(remote.fd, 10);
+	assert(ret == 0);
+	set_blocking_mode(remote.fd);
+	pthread_t thread;
+	pthread_create(&thread, NULL, pipe_responder_thread, &remote);
+
+	/* All queries have the same message ID. */
+	knot_requestor_t requestors[2 * MANY];
+	knot_request_slot_t slots[2 * MANY];
+	for (int i = 0; i < 2 * MANY; i++) {
+		knot_requestor_init(&requestors[i], &dummy_module, NULL, mm);
+		slots[i].requestor = &requestors[i];
+		slots[i].request = make_query(&requestors[i],
+		                              (i < MANY) ? &dst : silent, src);
+		slots[i].request->flags |= KNOT_REQUEST_PIPELINE;
+	}
+
+	knot_request_loop_t *loop = knot_request_loop_new();
+	for (int i = 0; i < 2 * MANY; i++) {
+		(void)knot_request_loop_add(loop, &slots[i], MANY_TIMEOUT);
+	}
+	struct timespec begin = time_now();
+	while (knot_request_loop_next(loop, -1) != NULL);
+	struct timespec end = time_now();
+	knot_request_loop_free(loop);
+
+	bool answered = true;
+	for (int i = 0; i < MANY; i++) {
+		answered = answered && slots[i].ret == KNOT_EOK &&
+		           knot_wire_get_qr(slots[i].request->resp->wire);
+	}
+	ok(answered, "requestor: pipeline/all answered out of order");
+	is_int(1, remote.conns, "requestor: pipeline/one connection");
+
+	bool timeout = true;
+	for (int i = MANY; i < 2 * MANY; i++) {
+		timeout = timeout && slots[i].ret == KNOT_ETIMEOUT;
+	}
+	ok(timeout && time_diff_ms(&begin, &end) < 2 * MANY_TIMEOUT,
+	   "requestor: pipeline/silent remote timed out at once");
+
+	for (int i = 0; i < 2 * MANY; i++) {
+		knot_request_free(slots[i].request, mm);
+		knot_requestor_clear(&requestors[i]);
+	}
+
+	shutdown(remote.fd, SHUT_RDWR);
+	pthread_join(thread, NULL);
+	close(remote.fd);
+}
+
 int main(int argc, char *argv[])
 {
 	plan_lazy();
@@ -149,6 +364,22 @@ int main(int argc, char *argv[])
 	/* Test requestor in connected environment. */
 	test_connected(&requestor, &server, &client);
 
+	/* Test concurrent requests, one remote accepts but doesn't answer. */
+	struct sockaddr_storage silent = { 0 };
+	sockaddr_set(&silent, AF_INET, "127.0.0.1", 0);
+	int silent_fd = net_bound_socket(SOCK_STREAM, &silent, 0);
+	assert(silent_fd >= 0);
+	addr_len = sockaddr_len(&silent);
+	ret = getsockname(silent_fd, (struct sockaddr *)&silent, &addr_len);
+	assert(ret == 0);
+	ret = listen(silent_fd, 10);
+	assert(ret == 0);
+	test_many(&mm, &server, &silent, &client);
+	test_race(&mm, &server, &silent, &client);
+	test_loop(&mm, &server, &silent, &client);
+	test_pipeline(&mm, &silent, &client);
+	close(silent_fd);
+
 	/* Terminate responder. */
 	int conn = net_connected_socket(SOCK_STREAM, &server, NULL);
 	assert(conn > 0);
@@ -0,0 +1,315 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <sys/socket.h>
+#include <gnutls/x509.h>
+#include <tap/basic.h>
+#include <tap/files.h>
+
+#include "knot/server/tcp-handler.c"
+
+#define TIMEOUT 2000
+#define QUERIES 2
+
+/* Echo layer, answers the query with a copy of it. */
+static knot_pkt_t *echo_query;
+
+static int echo_consume(knot_layer_t *ctx, knot_pkt_t *pkt)
+{
+	echo_query = pkt;
+	return KNOT_STATE_PRODUCE;
+}
+
+static int echo_produce(knot_layer_t *ctx, knot_pkt_t *pkt)
+{
+	memcpy(pkt->wire, echo_query->wire, echo_query->size);
+	pkt->size = echo_query->size;
+	knot_wire_set_qr(pkt->wire);
+	return KNOT_STATE_DONE;
+}
+
+static const knot_layer_api_t echo_api = {
+	.consume = echo_consume,
+	.produce = echo_produce,
+};
+
+/* Client side of a connection. */
+typedef struct {
+	int fd;
+	gnutls_datum_t *session_data; /* Resume from/save to. */
+	bool garbage;                 /* Send non-TLS data instead. */
+	bool resumed;
+	int answers;
+} client_t;
+
+static int write_cert(const char *cert_path, const char *key_path)
+{
+	gnutls_x509_privkey_t key = NULL;
+	gnutls_x509_crt_t crt = NULL;
+	gnutls_datum_t cert_pem = { 0 }, key_pem = { 0 };
+	time_t now = time(NULL);
+
+	int ret = gnutls_x509_privkey_init(&key);
+	ret |= gnutls_x509_privkey_generate(key, GNUTLS_PK_ECDSA,
+	                                    GNUTLS_CURVE_TO_BITS(GNUTLS_ECC_CURVE_SECP256R1), 0);
+	ret |= gnutls_x509_crt_init(&crt);
+	ret |= gnutls_x509_crt_set_version(crt, 3);
+	ret |= gnutls_x509_crt_set_serial(crt, "\x01", 1);
+	ret |= gnutls_x509_crt_set_activation_time(crt, now - 3600);
+	ret |= gnutls_x509_crt_set_expiration_time(crt, now + 3600);
+	ret |= gnutls_x509_crt_set_dn(crt, "CN=localhost", NULL);
+	ret |= gnutls_x509_crt_set_key(crt, key);
+	ret |= gnutls_x509_crt_sign2(crt, crt, key, GNUTLS_DIG_SHA256, 0);
+	ret |= gnutls_x509_crt_export2(crt, GNUTLS_X509_FMT_PEM, &cert_pem);
+	ret |= gnutls_x509_privkey_export2(key, GNUTLS_X509_FMT_PEM, &key_pem);
+
+	FILE *cert_file = fopen(cert_path, "w");
+	FILE *key_file = fopen(key_path, "w");
+	if (ret != GNUTLS_E_SUCCESS || cert_file == NULL || key_file == NULL ||
+	    fwrite(cert_pem.data, cert_pem.size, 1, cert_file) != 1 ||
+	    fwrite(key_pem.data, key_pem.size, 1, key_file) != 1) {
+		ret = KNOT_ERROR;
+	}
+	if (cert_file != NULL) {
+		fclose(cert_file);
+	}
+	if (key_file != NULL) {
+		fclose(key_file);
+	}
+
+	gnutls_free(cert_pem.data);
+	gnutls_free(key_pem.data);
+	gnutls_x509_crt_deinit(crt);
+	gnutls_x509_privkey_deinit(key);
+
+	return (ret == GNUTLS_E_SUCCESS) ? KNOT_EOK : KNOT_ERROR;
+}
+
+static void *client_thread(void *arg)
+{
+	client_t *client = arg;
+
+	if (client->garbage) {
+		static const char junk[] = "\x00\x10 this is not TLS";
+		(void)write(client->fd, junk, sizeof(junk));
+		uint8_t buf[64];
+		(void)read(client->fd, buf, sizeof(buf)); // Until closed.
+		return NULL;
+	}
+
+	gnutls_certificate_credentials_t creds;
+	gnutls_session_t session;
+	gnutls_certificate_allocate_credentials(&creds);
+	gnutls_init(&session, GNUTLS_CLIENT);
+	gnutls_set_default_priority(session);
+	gnutls_credentials_set(session, GNUTLS_CRD_CERTIFICATE, creds);
+	gnutls_transport_set_int(session, client->fd);
+	gnutls_handshake_set_timeout(session, TIMEOUT);
+	if (client->session_data->data != NULL) {
+		gnutls_session_set_data(session, client->session_data->data,
+		                        client->session_data->size);
+	}
+
+	int ret = gnutls_handshake(session);
+	if (ret != GNUTLS_E_SUCCESS) {
+		goto finish;
+	}
+	client->resumed = gnutls_session_is_resumed(session);
+
+	// Pipelined queries in one record.
+	uint8_t query[2 + KNOT_WIRE_HEADER_SIZE] = { 0, KNOT_WIRE_HEADER_SIZE };
+	gnutls_record_cork(session);
+	for (int i = 0; i < QUERIES; i++) {
+		knot_wire_set_id(query + 2, i);
+		gnutls_record_send(session, query, sizeof(query));
+	}
+	if (gnutls_record_uncork(session, GNUTLS_RECORD_WAIT) < 0) {
+		goto finish;
+	}
+
+	for (int i = 0; i < QUERIES; i++) {
+		uint8_t answer[sizeof(query)];
+		size_t done = 0;
+		while (done < sizeof(answer)) {
+			ssize_t len = gnutls_record_recv(session, answer + done,
+			                                 sizeof(answer) - done);
+			if (len == GNUTLS_E_AGAIN || len == GNUTLS_E_INTERRUPTED) {
+				continue; // E.g. after a post-handshake message.
+			} else if (len <= 0) {
+				goto finish;
+			}
+			done += len;
+		}
+		if (knot_wire_get_qr(answer + 2) && knot_wire_get_id(answer + 2) == i) {
+			client->answers++;
+		}
+	}
+
+	if (client->session_data->data == NULL) {
+		gnutls_session_get_data2(session, client->session_data);
+	}
+	gnutls_bye(session, GNUTLS_SHUT_WR);
+finish:
+	gnutls_deinit(session);
+	gnutls_certificate_free_credentials(creds);
+
+	return NULL;
+}
+
+/*!
+ * Serve one client connection the way the TCP handler does, and record
+ * the results of the handshake and the served queries.
+ */
+typedef struct {
+	bool waited;       /* Incomplete handshake kept the connection. */
+	bool established;
+	int served_max;    /* Most queries served in one event. */
+	int ret;           /* Last tcp_event_serve() result. */
+} serve_result_t;
+
+static void serve_client(tcp_context_t *tcp, tls_ctx_t *tls_ctx, client_t *client,
+                         serve_result_t *res)
+{
+	int fds[2];
+	int ret = socketpair(AF_UNIX, SOCK_STREAM, 0, fds);
+	assert(ret == 0);
+	(void)ret;
+	fcntl(fds[0], F_SETFL, O_NONBLOCK);
+	client->fd = fds[1];
+
+	// Accepted connection.
+	tls_conn_t *tls = tls_conn_new(tls_ctx, fds[0]);
+	int i = fdset_add(&tcp->set, fds[0], POLLIN, tls);
+
+	// Nothing received from the client yet.
+	memset(res, 0, sizeof(*res));
+	res->waited = (tcp_event_serve(tcp, i) == KNOT_EOK && !tls->established);
+
+	pthread_t thread;
+	pthread_create(&thread, NULL, client_thread, client);
+
+	while (true) {
+		struct pollfd pfd = { .fd = fds[0], .events = POLLIN };
+		if (poll(&pfd, 1, TIMEOUT) != 1) {
+			break;
+		}
+		uint64_t before = tcp->stats->queries;
+		res->ret = tcp_event_serve(tcp, i);
+		int served = tcp->stats->queries - before;
+		res->served_max = MAX(res->served_max, served);
+		if (res->ret != KNOT_EOK) {
+			break; // The TCP handler closes the connection.
+		}
+	}
+	res->established = tls->established;
+
+	// Close the connection to finish the client.
+	tls_conn_free(tls);
+	fdset_remove(&tcp->set, i);
+	close(fds[0]);
+	pthread_join(thread, NULL);
+	close(fds[1]);
+}
+
+int main(int argc, char *argv[])
+{
+	plan_lazy();
+
+	char *dir = test_mkdtemp();
+	ok(dir != NULL, "make temporary directory");
+	char cert[512], key[512];
+	snprintf(cert, sizeof(cert), "%s/cert.pem", dir);
+	snprintf(key, sizeof(key), "%s/key.pem", dir);
+	int ret = write_cert(cert, key);
+	is_int(KNOT_EOK, ret, "generate certificate");
+
+	tls_ctx_t *tls_ctx = NULL;
+	ret = tls_ctx_init(&tls_ctx, cert, key);
+	is_int(KNOT_EOK, ret, "create TLS context");
+	if (ret != KNOT_EOK) {
+		goto cleanup;
+	}
+
+	// No DNS messages before the handshake.
+	int fds[2];
+	ret = socketpair(AF_UNIX, SOCK_STREAM, 0, fds);
+	assert(ret == 0);
+	tls_conn_t *tls = tls_conn_new(tls_ctx, fds[0]);
+	uint8_t buf[KNOT_WIRE_HEADER_SIZE] = { 0 };
+	ok(tls != NULL && !tls_conn_pending(tls) &&
+	   tls_recv_dns(tls, buf, sizeof(buf), 0) == KNOT_EINVAL &&
+	   tls_send_dns(tls, buf, sizeof(buf), 0) == KNOT_EINVAL,
+	   "no data before handshake");
+	tls_conn_free(tls);
+	close(fds[0]);
+	close(fds[1]);
+
+	// Minimal TCP handler context with the echo layer.
+	knot_mm_t mm;
+	mm_ctx_mempool(&mm, MM_DEFAULT_BLKSIZE);
+	handler_thread_t stats = { 0 };
+	tcp_context_t tcp = {
+		.stats = &stats,
+		.max_worker_fds = 4,
+		.idle_timeout = 10,
+		.io_timeout = TIMEOUT,
+	};
+	knot_layer_init(&tcp.layer, &mm, &echo_api);
+	for (int i = 0; i < 2; i++) {
+		tcp.iov[i].iov_base = malloc(KNOT_WIRE_MAX_PKTSIZE);
+		tcp.iov[i].iov_len = KNOT_WIRE_MAX_PKTSIZE;
+	}
+	fdset_init(&tcp.set, tcp.max_worker_fds);
+
+	// Handshake and pipelined queries.
+	gnutls_datum_t session_data = { 0 };
+	client_t client = { .session_data = &session_data };
+	serve_result_t res;
+	serve_client(&tcp, tls_ctx, &client, &res);
+	ok(res.waited && res.established, "handshake: waits for data, then established");
+	is_int(QUERIES, client.answers, "query: all answers received");
+	is_int(QUERIES, res.served_max, "query: buffered query served without poll");
+	ok(!client.resumed, "handshake: full");
+
+	// Session resumption on a new connection.
+	client = (client_t) { .session_data = &session_data };
+	serve_client(&tcp, tls_ctx, &client, &res);
+	ok(session_data.data != NULL && client.resumed && res.established,
+	   "resumption: session resumed");
+	is_int(QUERIES, client.answers, "resumption: answers received");
+
+	// Non-TLS data on a TLS connection.
+	client = (client_t) { .session_data = &session_data, .garbage = true };
+	uint64_t queries = stats.queries;
+	serve_client(&tcp, tls_ctx, &client, &res);
+	ok(res.ret != KNOT_EOK && !res.established && stats.queries == queries,
+	   "bad handshake: connection refused without processing");
+
+	gnutls_free(session_data.data);
+	fdset_clear(&tcp.set);
+	free(tcp.iov[0].iov_base);
+	free(tcp.iov[1].iov_base);
+	mp_delete(mm.ctx);
+	tls_ctx_deinit(tls_ctx);
+cleanup:
+	test_rm_rf(dir);
+	free(dir);
+
+	return 0;
+}
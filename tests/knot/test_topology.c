@@ -0,0 +1,143 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <tap/basic.h>
+
+#include "knot/server/topology.h"
+#include "libknot/errcode.h"
+
+#define CPUS 16
+
+/*!
+ * Two nodes with four cores each, SMT siblings numbered after all cores:
+ * node 0: CPUs 0-3 and 8-11, node 1: CPUs 4-7 and 12-15.
+ */
+static void smt_topology(topology_t *topo, topo_cpu_t *cpus)
+{
+	for (unsigned i = 0; i < CPUS; i++) {
+		cpus[i].id = i;
+		cpus[i].core = i % 8;
+		cpus[i].node = (i % 8) / 4;
+	}
+	topo->cpus = cpus;
+	topo->count = CPUS;
+}
+
+static bool cpus_equal(const int *place, const int *expected, unsigned count)
+{
+	for (unsigned i = 0; i < count; i++) {
+		if (place[i] != expected[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static bool bg_equal(const placement_t *place, const unsigned *expected, unsigned count)
+{
+	if (place->bg_count != count) {
+		return false;
+	}
+	for (unsigned i = 0; i < count; i++) {
+		if (place->bg[i] != expected[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static void test_smt(void)
+{
+	topology_t topo;
+	topo_cpu_t cpus[CPUS];
+	smt_topology(&topo, cpus);
+	placement_t place;
+
+	is_int(1, topology_cpu_node(&topo, 13), "CPU node");
+	is_int(-1, topology_cpu_node(&topo, CPUS), "CPU node, unknown CPU");
+
+	// Preferred node, the other node is left for the background.
+	int ret = topology_place(&topo, 1, 2, 2, &place);
+	is_int(KNOT_EOK, ret, "place on node");
+	ok(cpus_equal(place.udp, (int []){ 4, 5 }, 2), "place on node, UDP");
+	ok(cpus_equal(place.tcp, (int []){ 6, 7 }, 2), "place on node, TCP");
+	ok(bg_equal(&place, (unsigned []){ 0, 1, 2, 3, 8, 9, 10, 11 }, 8),
+	   "place on node, background avoids serving cores");
+	placement_free(&place);
+
+	// All cores serving, background on the SMT siblings.
+	ret = topology_place(&topo, -1, 4, 4, &place);
+	is_int(KNOT_EOK, ret, "place on all cores");
+	ok(cpus_equal(place.udp, (int []){ 0, 1, 2, 3 }, 4), "place on all cores, UDP");
+	ok(cpus_equal(place.tcp, (int []){ 4, 5, 6, 7 }, 4), "place on all cores, TCP");
+	ok(bg_equal(&place, (unsigned []){ 8, 9, 10, 11, 12, 13, 14, 15 }, 8),
+	   "place on all cores, background on siblings");
+	placement_free(&place);
+
+	// Cores of the other node used before the SMT siblings.
+	ret = topology_place(&topo, 0, 6, 0, &place);
+	is_int(KNOT_EOK, ret, "place cores");
+	ok(cpus_equal(place.udp, (int []){ 0, 1, 2, 3, 4, 5 }, 6),
+	   "place cores, cores first");
+	ok(bg_equal(&place, (unsigned []){ 6, 7, 14, 15 }, 4),
+	   "place cores, background on free cores");
+	placement_free(&place);
+
+	// More threads than CPUs.
+	ret = topology_place(&topo, 0, 16, 4, &place);
+	is_int(KNOT_EOK, ret, "place oversubscribed");
+	ok(cpus_equal(place.udp, (int []){ 0, 1, 2, 3, 4, 5, 6, 7,
+	                                   8, 9, 10, 11, 12, 13, 14, 15 }, 16) &&
+	   cpus_equal(place.tcp, (int []){ 0, 1, 2, 3 }, 4),
+	   "place oversubscribed, threads wrap around");
+	ok(place.bg_count == 0, "place oversubscribed, background not bound");
+	placement_free(&place);
+}
+
+static void test_single(void)
+{
+	topology_t topo = {
+		.cpus = (topo_cpu_t []){ { .id = 0, .node = 0, .core = 0 } },
+		.count = 1
+	};
+	placement_t place;
+
+	int ret = topology_place(&topo, -1, 1, 1, &place);
+	is_int(KNOT_EOK, ret, "place single CPU");
+	ok(place.udp[0] == 0 && place.tcp[0] == 0, "place single CPU, shared");
+	ok(place.bg_count == 0, "place single CPU, background not bound");
+	placement_free(&place);
+}
+
+int main(int argc, char *argv[])
+{
+	plan_lazy();
+
+	test_smt();
+	test_single();
+
+	topology_t topo;
+	int ret = topology_load(&topo);
+	is_int(KNOT_EOK, ret, "load system topology");
+	ok(topo.count > 0, "system topology has CPUs");
+	for (unsigned i = 0; i < topo.count; i++) {
+		diag("CPU %u: node %i, core %u", topo.cpus[i].id,
+		     topo.cpus[i].node, topo.cpus[i].core);
+	}
+	topology_free(&topo);
+
+	return 0;
+}
@@ -20,13 +20,17 @@
 #include <pthread.h>
 #include <sched.h>
 #include <signal.h>
+#include <stdlib.h>
+#include <string.h>
 #include <time.h>
+#include <unistd.h>
 
 #include "knot/worker/pool.h"
 #include "knot/worker/queue.h"
 
 #define THREADS 4
 #define TASKS_BATCH 40
+#define STRESS_TASKS 10000
 
 /*!
  * Task execution log.
@@ -61,10 +65,195 @@ static void task_counting(task_t *task)
 	pthread_mutex_unlock(&log->mx);
 }
 
+/*!
+ * Execution order log.
+ */
+typedef struct order_log {
+	pthread_mutex_t mx;
+	task_prio_t order[TASK_PRIO_COUNT * 2];
+	unsigned count;
+} order_log_t;
+
+static order_log_t order_log = {
+	.mx = PTHREAD_MUTEX_INITIALIZER,
+};
+
+/*!
+ * Task recording its priority class into the order log.
+ */
+static void task_ordering(task_t *task)
+{
+	pthread_mutex_lock(&order_log.mx);
+	order_log.order[order_log.count++] = task->prio;
+	pthread_mutex_unlock(&order_log.mx);
+}
+
+/*!
+ * Task blocking its worker until the mutex in the context is released.
+ */
+static void task_blocking(task_t *task)
+{
+	pthread_mutex_t *mx = task->ctx;
+	pthread_mutex_lock(mx);
+	pthread_mutex_unlock(mx);
+}
+
 static void interrupt_handle(int s)
 {
 }
 
+static void test_priorities(void)
+{
+	worker_pool_t *pool = worker_pool_create(1);
+	ok(pool != NULL, "prio: create worker pool");
+	if (!pool) {
+		return;
+	}
+
+	// Assign in the reverse order of priorities.
+	task_t tasks[TASK_PRIO_COUNT * 2];
+	const task_prio_t assigned[] = {
+		TASK_PRIO_LOW, TASK_PRIO_NORMAL, TASK_PRIO_HIGH,
+		TASK_PRIO_LOW, TASK_PRIO_NORMAL, TASK_PRIO_HIGH,
+	};
+	for (int i = 0; i < TASK_PRIO_COUNT * 2; i++) {
+		tasks[i] = (task_t) { .run = task_ordering, .prio = assigned[i] };
+		worker_pool_assign(pool, &tasks[i]);
+	}
+
+	worker_prio_stats_t stats[TASK_PRIO_COUNT];
+	int running, queued;
+	worker_pool_status(pool, &running, &queued, stats);
+	ok(running == 0 && queued == TASK_PRIO_COUNT * 2 &&
+	   stats[TASK_PRIO_HIGH].queued == 2 && stats[TASK_PRIO_LOW].queued == 2,
+	   "prio: status before start");
+
+	worker_pool_start(pool);
+	worker_pool_wait(pool);
+
+	const task_prio_t expected[] = {
+		TASK_PRIO_HIGH, TASK_PRIO_HIGH, TASK_PRIO_NORMAL,
+		TASK_PRIO_NORMAL, TASK_PRIO_LOW, TASK_PRIO_LOW,
+	};
+	ok(order_log.count == TASK_PRIO_COUNT * 2 &&
+	   memcmp(order_log.order, expected, sizeof(expected)) == 0,
+	   "prio: execution order");
+
+	worker_pool_status(pool, &running, &queued, stats);
+	ok(running == 0 && queued == 0 &&
+	   stats[TASK_PRIO_HIGH].started == 2 && stats[TASK_PRIO_NORMAL].started == 2 &&
+	   stats[TASK_PRIO_LOW].started == 2 && stats[TASK_PRIO_LOW].queued == 0,
+	   "prio: status after finish");
+
+	worker_pool_stop(pool);
+	worker_pool_join(pool);
+	worker_pool_destroy(pool);
+}
+
+static void test_stealing(void)
+{
+	worker_pool_t *pool = worker_pool_create(2);
+	ok(pool != NULL, "steal: create worker pool");
+	if (!pool) {
+		return;
+	}
+
+	task_log_t log = {
+		.mx = PTHREAD_MUTEX_INITIALIZER,
+	};
+	pthread_mutex_t block = PTHREAD_MUTEX_INITIALIZER;
+	pthread_mutex_lock(&block);
+
+	worker_pool_start(pool);
+
+	// One worker gets stuck, the other one must process all the remaining
+	// tasks, including the ones queued for the stuck worker.
+	task_t blocking = { .run = task_blocking, .ctx = &block };
+	worker_pool_assign(pool, &blocking);
+
+	task_t task = { .run = task_counting, .ctx = &log };
+	for (int i = 0; i < TASKS_BATCH; i++) {
+		worker_pool_assign(pool, &task);
+	}
+
+	int running = 1, queued = 1;
+	for (int i = 0; i < 5000 && (running > 1 || queued > 0); i++) {
+		usleep(1000);
+		worker_pool_status(pool, &running, &queued, NULL);
+	}
+	ok(running == 1 && queued == 0 && executed_reset(&log) == TASKS_BATCH,
+	   "steal: tasks of blocked worker executed");
+
+	pthread_mutex_unlock(&block);
+	worker_pool_wait(pool);
+
+	worker_pool_stop(pool);
+	worker_pool_join(pool);
+	worker_pool_destroy(pool);
+
+	pthread_mutex_destroy(&block);
+	pthread_mutex_destroy(&log.mx);
+}
+
+typedef struct {
+	worker_pool_t *pool;
+	task_t *tasks;
+	unsigned count;
+} producer_t;
+
+static unsigned stress_executed;
+
+static void task_stress(task_t *task)
+{
+	__atomic_add_fetch(&stress_executed, 1, __ATOMIC_RELAXED);
+}
+
+static void *producer_thread(void *arg)
+{
+	producer_t *producer = arg;
+	for (unsigned i = 0; i < producer->count; i++) {
+		producer->tasks[i] = (task_t) { .run = task_stress };
+		worker_pool_assign(producer->pool, &producer->tasks[i]);
+	}
+
+	return NULL;
+}
+
+static void test_stress(unsigned count)
+{
+	worker_pool_t *pool = worker_pool_create(THREADS);
+	ok(pool != NULL, "stress: create worker pool");
+	if (!pool) {
+		return;
+	}
+	worker_pool_start(pool);
+
+	// Concurrent assignments of many short tasks.
+	pthread_t threads[THREADS];
+	producer_t producers[THREADS];
+	for (int i = 0; i < THREADS; i++) {
+		producers[i] = (producer_t) {
+			.pool = pool,
+			.tasks = calloc(count, sizeof(task_t)),
+			.count = count
+		};
+		pthread_create(&threads[i], NULL, producer_thread, &producers[i]);
+	}
+	for (int i = 0; i < THREADS; i++) {
+		pthread_join(threads[i], NULL);
+	}
+	worker_pool_wait(pool);
+	is_int(THREADS * count, stress_executed, "stress: all tasks executed");
+
+	worker_pool_stop(pool);
+	worker_pool_join(pool);
+	worker_pool_destroy(pool);
+
+	for (int i = 0; i < THREADS; i++) {
+		free(producers[i].tasks);
+	}
+}
+
 int main(void)
 {
 	plan_lazy();
@@ -148,5 +337,10 @@ int main(void)
 
 	pthread_mutex_destroy(&log.mx);
 
+	test_priorities();
+	test_stealing();
+
+	test_stress(STRESS_TASKS);
+
 	return 0;
 }
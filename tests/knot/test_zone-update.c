@@ -35,6 +35,7 @@ static const char *add_str   = "test. 600 IN TXT \"test2\"\n";
 static const char *del_str   = "test. 600 IN TXT \"test\"\n";
 static const char *node_str1 = "node.test. 601 IN TXT \"abc\"\n";
 static const char *node_str2 = "node.test. 601 IN TXT \"def\"\n";
+static const char *cname_str = "alias.test. 600 IN CNAME node.test.\n";
 
 knot_rrset_t rrset;
 
@@ -286,6 +287,80 @@ void test_incremental(zone_t *zone, zs_scanner_t *sc)
 	// TODO test more things after re-adjust, search for non-unified bi-nodes
 }
 
+/*!< \brief Returns node linked as a target of the CNAME at given owner. */
+static const zone_node_t *cname_target(const zone_t *zone, const char *owner)
+{
+	knot_dname_t *name = knot_dname_from_str_alloc(owner);
+	const zone_node_t *node = zone_contents_find_node(zone->contents, name);
+	knot_dname_free(name, NULL);
+	assert(node);
+
+	knot_rrset_t cname = node_rrset(node, KNOT_RRTYPE_CNAME);
+	const additional_t *target = cname.additional;
+	return (target != NULL) ? glue_node(&target->glues[0], node) : NULL;
+}
+
+static const zone_node_t *find_node(const zone_t *zone, const char *owner)
+{
+	knot_dname_t *name = knot_dname_from_str_alloc(owner);
+	const zone_node_t *node = zone_contents_find_node(zone->contents, name);
+	knot_dname_free(name, NULL);
+	return node;
+}
+
+void test_cname_target(zone_t *zone, zs_scanner_t *sc)
+{
+	/* Target linked when CNAME added. */
+	zone_update_t update;
+	zone_update_init(&update, zone, UPDATE_INCREMENTAL);
+	if (zs_set_input_string(sc, cname_str, strlen(cname_str)) != 0 ||
+	    zs_parse_all(sc) != 0) {
+		assert(0);
+	}
+	int ret = zone_update_add(&update, &rrset);
+	knot_rdataset_clear(&rrset.rrs, NULL);
+	if (ret == KNOT_EOK) {
+		ret = zone_update_commit(conf(), &update);
+	}
+	ok(ret == KNOT_EOK && cname_target(zone, "alias.test") != NULL &&
+	   cname_target(zone, "alias.test") == find_node(zone, "node.test"),
+	   "CNAME target: linked");
+
+	/* Link removed with the target node. */
+	zone_update_init(&update, zone, UPDATE_INCREMENTAL);
+	knot_dname_t *target_name = knot_dname_from_str_alloc("node.test");
+	ret = zone_update_remove_node(&update, target_name);
+	knot_dname_free(target_name, NULL);
+	if (ret == KNOT_EOK) {
+		ret = zone_update_commit(conf(), &update);
+	}
+	ok(ret == KNOT_EOK && find_node(zone, "node.test") == NULL &&
+	   cname_target(zone, "alias.test") == NULL,
+	   "CNAME target: unlinked on removal");
+
+	/* Link restored with the target node. */
+	zone_update_init(&update, zone, UPDATE_INCREMENTAL);
+	if (zs_set_input_string(sc, node_str1, strlen(node_str1)) != 0 ||
+	    zs_parse_all(sc) != 0) {
+		assert(0);
+	}
+	ret = zone_update_add(&update, &rrset);
+	knot_rdataset_clear(&rrset.rrs, NULL);
+	if (ret == KNOT_EOK) {
+		ret = zone_update_commit(conf(), &update);
+	}
+	ok(ret == KNOT_EOK && cname_target(zone, "alias.test") != NULL &&
+	   cname_target(zone, "alias.test") == find_node(zone, "node.test"),
+	   "CNAME target: relinked on addition");
+
+	test_zone_unified(zone);
+
+	ret = zone_adjust_full(zone->contents);
+	ok(ret == KNOT_EOK &&
+	   cname_target(zone, "alias.test") == find_node(zone, "node.test"),
+	   "CNAME target: linked by full adjust");
+}
+
 int main(int argc, char *argv[])
 {
 	plan_lazy();
@@ -315,7 +390,7 @@ int main(int argc, char *argv[])
 	knot_dname_t *apex = knot_dname_from_str_alloc("test");
 	assert(apex);
 	zone_t *zone = zone_new(apex);
-	zone->journaldb = &server.journaldb;
+	zone->journaldb = knot_lmdb_shard(&server.journaldb, zone->name);
 
 	/* Setup zscanner */
 	zs_scanner_t sc;
@@ -327,6 +402,7 @@ int main(int argc, char *argv[])
 	/* Test FULL update, commit it and use the result to test the INCREMENTAL update */
 	test_full(zone, &sc);
 	test_incremental(zone, &sc);
+	test_cname_target(zone, &sc);
 
 	zs_deinit(&sc);
 	zone_free(&zone);
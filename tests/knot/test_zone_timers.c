@@ -56,24 +56,20 @@ static bool remove_all(const knot_dname_t *zone, void *data)
 	return false;
 }
 
-int main(int argc, char *argv[])
+static void test_timers(const char *dbid, unsigned count, unsigned env_flags)
 {
-	plan_lazy();
-	assert(knot_db_lmdb_api());
-
-	char *dbid = test_mkdtemp();
-	if (!dbid) {
-		return EXIT_FAILURE;
-	}
-
 	const knot_dname_t *zone = (uint8_t *)"\x7""example""\x3""com";
+	const knot_dname_t *zone2 = (uint8_t *)"\x7""example""\x3""net";
 	struct zone_timers timers = MOCK_TIMERS;
 
+	diag("%u shard(s)%s", count, (env_flags & MDB_NOSYNC) ? ", group commit" : "");
+
 	// Create database
-	knot_lmdb_db_t _db = { 0 }, *db = &_db;
-	knot_lmdb_init(db, dbid, 1024 * 1024, 0, NULL);
-	int ret = knot_lmdb_open(db);
-	ok(ret == KNOT_EOK && db != NULL, "open timers");
+	knot_lmdb_shards_t _db = { 0 }, *db = &_db;
+	int ret = knot_lmdb_shards_init(db, count, dbid, 1024 * 1024 * count, env_flags, NULL);
+	ok(ret == KNOT_EOK && db->count == count, "init timers");
+	ret = knot_lmdb_open(knot_lmdb_shard(db, zone));
+	ok(ret == KNOT_EOK, "open timers");
 
 	// Lookup nonexistent
 	ret = zone_timers_read(db, zone, &timers);
@@ -82,12 +78,21 @@ int main(int argc, char *argv[])
 	// Write timers
 	ret = zone_timers_write(db, zone, &timers);
 	is_int(KNOT_EOK, ret, "zone_timers_write()");
+	ret = zone_timers_write(db, zone2, &timers);
+	is_int(KNOT_EOK, ret, "zone_timers_write() second zone");
+	ret = knot_lmdb_sync(knot_lmdb_shard(db, zone));
+	is_int(KNOT_EOK, ret, "knot_lmdb_sync()");
 
 	// Read timers
 	memset(&timers, 0, sizeof(timers));
 	ret = zone_timers_read(db, zone, &timers);
 	ok(ret == KNOT_EOK, "zone_timers_read()");
 	ok(timers_eq(&timers, &MOCK_TIMERS), "inconsistent timers");
+	memset(&timers, 0, sizeof(timers));
+	ret = zone_timers_read(db, zone2, &timers);
+	ok(ret == KNOT_EOK && timers_eq(&timers, &MOCK_TIMERS), "zone_timers_read() second zone");
+
+	is_int(count, knot_lmdb_shards_detect(dbid), "detect shards");
 
 	// Sweep none
 	ret = zone_timers_sweep(db, keep_all, NULL);
@@ -100,10 +105,28 @@ int main(int argc, char *argv[])
 	is_int(KNOT_EOK, ret, "zone_timers_sweep() all");
 	ret = zone_timers_read(db, zone, &timers);
 	is_int(KNOT_ENOENT, ret, "zone_timers_read() nonexistent");
+	ret = zone_timers_read(db, zone2, &timers);
+	is_int(KNOT_ENOENT, ret, "zone_timers_read() second nonexistent");
 
 	// Clean up.
-	knot_lmdb_deinit(db);
+	knot_lmdb_shards_deinit(db);
 	test_rm_rf(dbid);
+}
+
+int main(int argc, char *argv[])
+{
+	plan_lazy();
+	assert(knot_db_lmdb_api());
+
+	char *dbid = test_mkdtemp();
+	if (!dbid) {
+		return EXIT_FAILURE;
+	}
+
+	test_timers(dbid, 1, 0);
+	test_timers(dbid, 4, 0);
+	test_timers(dbid, 4, MDB_NOSYNC);
+
 	free(dbid);
 
 	return EXIT_SUCCESS;
@@ -20,6 +20,7 @@
 #include <tap/basic.h>
 
 #include "libknot/dname.h"
+#include "contrib/tolower.h"
 
 /* Test dname_parse_from_wire */
 static int test_fw(size_t l, const char *w) {
@@ -155,6 +156,59 @@ static void test_dname_storage(void)
 	   "knot_dname_storage: valid name");
 }
 
+/* Reference label-by-label lowercasing. */
+static void ref_to_lower(knot_dname_t *name)
+{
+	while (*name != '\0') {
+		for (uint8_t i = 1; i <= *name; i++) {
+			name[i] = knot_tolower(name[i]);
+		}
+		name += *name + 1;
+	}
+}
+
+/* Random name with any label bytes, stored at the end of the buffer. */
+static knot_dname_t *random_dname(uint8_t *buf)
+{
+	const char chars[] = "aAzZ09-_@[`{\x80\xC1\xDA\xFF";
+	uint8_t tmp[KNOT_DNAME_MAXLEN];
+	size_t len = 0;
+	unsigned labels = random() % 8;
+	for (unsigned i = 0; i < labels; i++) {
+		uint8_t lblen = random() % ((random() % 4 == 0) ? 64 : 12);
+		if (len + 1 + lblen + 1 > sizeof(tmp)) {
+			break;
+		}
+		tmp[len++] = lblen;
+		for (uint8_t j = 0; j < lblen; j++) {
+			tmp[len++] = (random() % 2 == 0) ? chars[random() % (sizeof(chars) - 1)]
+			                                 : random() % 256;
+		}
+	}
+	tmp[len++] = '\0';
+
+	knot_dname_t *name = buf + KNOT_DNAME_MAXLEN - len;
+	memcpy(name, tmp, len);
+	return name;
+}
+
+static void test_dname_to_lower(void)
+{
+	/* Cross-check the block operation with the label-by-label one. */
+	bool lower_ok = true;
+	for (unsigned i = 0; i < 100000; i++) {
+		uint8_t *buf = malloc(KNOT_DNAME_MAXLEN);
+		knot_dname_t *name = random_dname(buf);
+		knot_dname_storage_t ref;
+		size_t size = knot_dname_store(ref, name);
+		ref_to_lower(ref);
+		knot_dname_to_lower(name);
+		lower_ok = lower_ok && memcmp(name, ref, size) == 0;
+		free(buf);
+	}
+	ok(lower_ok, "knot_dname_to_lower: same as label-by-label");
+}
+
 int main(int argc, char *argv[])
 {
 	plan_lazy();
@@ -583,5 +637,7 @@ int main(int argc, char *argv[])
 
 	test_dname_storage();
 
+	test_dname_to_lower();
+
 	return 0;
 }
@@ -18,6 +18,7 @@
 
 #include "libknot/libknot.h"
 #include "libknot/packet/pkt.c"
+#include "test_pkt.h"
 #include "contrib/ucw/mempool.h"
 
 #define TTL 7200
@@ -64,6 +65,110 @@ static void packet_match(knot_pkt_t *in, knot_pkt_t *out)
 	is_int(NAMECOUNT, rr_matched, "pkt: RR content match");
 }
 
+static void test_compr_dict(void)
+{
+	knot_mm_t mm;
+	mm_ctx_mempool(&mm, MM_DEFAULT_BLKSIZE);
+
+	knot_rrset_t *rrs[COMPR_RRS];
+	compr_rrs(rrs);
+
+	/* Small packets use the suffix heuristics, larger ones the dictionary. */
+	unsigned count = 9;
+	size_t plain = compr_write(rrs, count, KNOT_COMPR_DICT_MINSIZE, &mm, true);
+	size_t dict = compr_write(rrs, count, KNOT_COMPR_DICT_MINSIZE + 1, &mm, true);
+	size_t all = compr_write(rrs, COMPR_RRS, KNOT_WIRE_MAX_PKTSIZE, &mm, true);
+	ok(plain > 0 && dict > 0 && all > 0, "compr: names written and parsed");
+	ok(dict < plain, "compr: dictionary compresses better (%zu < %zu)", dict, plain);
+
+	/* Names of RRs which didn't fit must be forgotten (dictionary forced). */
+	knot_dname_storage_t qname;
+	knot_dname_from_str(qname, "host0.example.com", sizeof(qname));
+	bool consistent = true;
+	for (size_t max = 200; max < all && consistent; max += 3) {
+		knot_pkt_t *pkt = knot_pkt_new(NULL, max, &mm);
+		pkt->compr.dict.mm = &pkt->mm;
+		knot_pkt_put_question(pkt, qname, KNOT_CLASS_IN, KNOT_RRTYPE_MX);
+		for (unsigned i = 0; i < COMPR_RRS; i++) {
+			(void)knot_pkt_put(pkt, 0, rrs[i], KNOT_PF_NOTRUNC);
+		}
+		knot_compr_dict_t *d = &pkt->compr.dict;
+		for (uint16_t i = 0; i < d->count; i++) {
+			consistent = consistent && d->positions[d->log[i]] < pkt->size;
+		}
+		knot_pkt_clear(pkt);
+		consistent = consistent && d->count == 0 && d->mm == NULL;
+		knot_pkt_free(pkt);
+	}
+	ok(consistent, "compr: dictionary rollback and clear");
+
+	for (unsigned i = 0; i < COMPR_RRS; i++) {
+		knot_rrset_free(rrs[i], NULL);
+	}
+	mp_delete(mm.ctx);
+}
+
+static void test_lazy(knot_pkt_t *in)
+{
+	/* Skipped sections are parsed on demand, OPT is kept. */
+	knot_pkt_t *lazy = knot_pkt_new(in->wire, in->size, NULL);
+	int ret = knot_pkt_parse(lazy, KNOT_PF_LAZY);
+	ok(ret == KNOT_EOK && lazy->parsed == lazy->size && lazy->opt_rr != NULL &&
+	   knot_pkt_section(lazy, KNOT_ANSWER)->count == 0 &&
+	   knot_pkt_section(lazy, KNOT_AUTHORITY)->count == 0 &&
+	   knot_pkt_section(lazy, KNOT_ADDITIONAL)->count == 1,
+	   "pkt: lazy parse");
+	const knot_rdata_t *opt_rdata = lazy->opt_rr->rrs.rdata;
+	ret = knot_pkt_parse_sections(lazy, 0);
+	ok(ret == KNOT_EOK && lazy->opt_rr != NULL &&
+	   lazy->opt_rr->rrs.rdata == opt_rdata && lazy->opt_rr->type == KNOT_RRTYPE_OPT &&
+	   knot_pkt_section(lazy, KNOT_ADDITIONAL)->count == 1,
+	   "pkt: parse skipped sections");
+	packet_match(in, lazy);
+	ret = knot_pkt_parse_sections(lazy, 0);
+	ok(ret == KNOT_EOK && lazy->rrset_count == in->rrset_count,
+	   "pkt: skipped sections parsed once");
+
+	/* TSIG is kept as well. */
+	uint8_t wire[KNOT_WIRE_MAX_PKTSIZE];
+	size_t size = in->size;
+	memcpy(wire, in->wire, size);
+	knot_tsig_key_t key = {
+		.algorithm = DNSSEC_TSIG_HMAC_SHA256,
+		.name = (knot_dname_t *)"\x03""key",
+		.secret = { .data = (uint8_t *)"secret", .size = 6 }
+	};
+	uint8_t digest[64];
+	size_t digest_len = sizeof(digest);
+	ret = knot_tsig_sign(wire, &size, sizeof(wire), NULL, 0, digest, &digest_len,
+	                     &key, 0, 0);
+	assert(ret == KNOT_EOK);
+	ret = knot_pkt_reset(lazy, wire, size);
+	ret |= knot_pkt_parse(lazy, KNOT_PF_LAZY);
+	const knot_rdata_t *tsig_rdata = lazy->tsig_rr->rrs.rdata;
+	ret |= knot_pkt_parse_sections(lazy, 0);
+	ok(ret == KNOT_EOK && lazy->size == in->size && lazy->tsig_rr != NULL &&
+	   lazy->tsig_rr->rrs.rdata == tsig_rdata &&
+	   lazy->tsig_rr == knot_pkt_rr(knot_pkt_section(lazy, KNOT_ADDITIONAL), 1),
+	   "pkt: lazy parse with TSIG");
+	packet_match(in, lazy);
+
+	/* Skipped RRs are checked for boundaries and misplaced OPT. */
+	memcpy(wire, in->wire, in->size);
+	knot_wire_set_nscount(wire, knot_wire_get_nscount(wire) + 1);
+	ret = knot_pkt_reset(lazy, wire, in->size);
+	ret |= knot_pkt_parse(lazy, KNOT_PF_LAZY);
+	is_int(KNOT_EMALF, ret, "pkt: lazy parse of truncated section");
+	memcpy(wire, in->wire, in->size);
+	size_t type_pos = KNOT_WIRE_HEADER_SIZE + knot_pkt_question_size(in) + 2;
+	knot_wire_write_u16(wire + type_pos, KNOT_RRTYPE_OPT);
+	ret = knot_pkt_reset(lazy, wire, in->size);
+	ret |= knot_pkt_parse(lazy, KNOT_PF_LAZY);
+	is_int(KNOT_EMALF, ret, "pkt: lazy parse of OPT in answer");
+
+	knot_pkt_free(lazy);
+}
+
 int main(int argc, char *argv[])
 {
 	plan_lazy();
@@ -183,6 +288,33 @@ int main(int argc, char *argv[])
 	/* Compare copied packet to original. */
 	packet_match(in, copy);
 
+	/*
+	 * Reused packet tests.
+	 */
+	ret = knot_pkt_reset(copy, in->wire, in->size);
+	is_int(KNOT_EINVAL, ret, "pkt: reset packet with owned wire");
+	knot_pkt_t *reused = knot_pkt_new(copy->wire, copy->max_size, NULL);
+	ret = knot_pkt_parse(reused, 0);
+	is_int(KNOT_EOK, ret, "pkt: parse packet for reuse");
+	ret = knot_pkt_reset(reused, in->wire, in->size);
+	ok(ret == KNOT_EOK && reused->rrset_count == 0 && reused->opt_rr == NULL &&
+	   reused->wire == in->wire && reused->size == in->size,
+	   "pkt: reset packet");
+	ret = knot_pkt_parse(reused, 0);
+	is_int(KNOT_EOK, ret, "pkt: parse reused packet");
+	packet_match(in, reused);
+	knot_pkt_free(reused);
+
+	/*
+	 * Lazy parsing tests.
+	 */
+	test_lazy(in);
+
+	/*
+	 * Compression dictionary tests.
+	 */
+	test_compr_dict();
+
 	/* Free packets. */
 	knot_pkt_free(copy);
 	knot_pkt_free(out);
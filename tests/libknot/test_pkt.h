@@ -0,0 +1,88 @@
+/*  Copyright (C) 2019 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdio.h>
+#include <string.h>
+
+#include "libknot/libknot.h"
+
+#define COMPR_RRS 24
+
+/* Create RRSet with RDATA consisting of a fixed prefix and a domain name. */
+static inline knot_rrset_t *compr_rr(const char *owner, uint16_t type, const void *prefix,
+                                     size_t prefix_len, const char *target)
+{
+	knot_dname_storage_t name;
+	knot_dname_from_str(name, owner, sizeof(name));
+	knot_rrset_t *rr = knot_rrset_new(name, type, KNOT_CLASS_IN, 7200, NULL);
+
+	uint8_t rdata[KNOT_DNAME_MAXLEN + 8];
+	memcpy(rdata, prefix, prefix_len);
+	knot_dname_from_str(rdata + prefix_len, target, sizeof(rdata) - prefix_len);
+	knot_rrset_add_rdata(rr, rdata, prefix_len + knot_dname_size(rdata + prefix_len),
+	                     NULL);
+
+	return rr;
+}
+
+/* MX, SRV and CNAME records sharing various name suffixes. */
+static inline void compr_rrs(knot_rrset_t **rrs)
+{
+	const uint8_t mx[] = { 0, 10 }, srv[] = { 0, 0, 0, 0, 0x13, 0xc4 };
+	for (unsigned i = 0; i < COMPR_RRS / 3; i++) {
+		char owner[64], target[64];
+		snprintf(owner, sizeof(owner), "host%u.example.com", i);
+		snprintf(target, sizeof(target), "mail%u.dept.example.com", i % 2);
+		rrs[3 * i] = compr_rr(owner, KNOT_RRTYPE_MX, mx, sizeof(mx), target);
+		snprintf(owner, sizeof(owner), "_sip._udp.host%u.example.com", i);
+		snprintf(target, sizeof(target), "sip%u.dept.example.com", i % 4);
+		rrs[3 * i + 1] = compr_rr(owner, KNOT_RRTYPE_SRV, srv, sizeof(srv), target);
+		snprintf(owner, sizeof(owner), "www%u.example.com", i);
+		rrs[3 * i + 2] = compr_rr(owner, KNOT_RRTYPE_CNAME, NULL, 0, target);
+	}
+}
+
+/* Write the records to a new packet, return the packet size or 0. */
+static inline size_t compr_write(knot_rrset_t **rrs, unsigned count, size_t max_size,
+                                 knot_mm_t *mm, bool check)
+{
+	knot_pkt_t *pkt = knot_pkt_new(NULL, max_size, mm);
+	knot_dname_storage_t qname;
+	knot_dname_from_str(qname, "Host0.Example.Com", sizeof(qname));
+	int ret = knot_pkt_put_question(pkt, qname, KNOT_CLASS_IN, KNOT_RRTYPE_MX);
+	for (unsigned i = 0; i < count && ret == KNOT_EOK; i++) {
+		ret = knot_pkt_put(pkt, 0, rrs[i], 0);
+	}
+	size_t size = (ret == KNOT_EOK) ? pkt->size : 0;
+
+	/* The written names must parse back. */
+	if (check && size > 0) {
+		knot_pkt_t *parsed = knot_pkt_new(pkt->wire, pkt->size, mm);
+		bool same = knot_pkt_parse(parsed, 0) == KNOT_EOK &&
+		            parsed->rrset_count == count;
+		for (unsigned i = 0; same && i < count; i++) {
+			same = knot_rrset_equal(&parsed->rr[i], rrs[i], true);
+		}
+		knot_pkt_free(parsed);
+		size = same ? size : 0;
+	}
+
+	knot_pkt_free(pkt);
+
+	return size;
+}